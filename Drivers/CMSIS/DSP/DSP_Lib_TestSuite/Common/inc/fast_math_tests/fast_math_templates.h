@@ -99,4 +99,141 @@
             return JTEST_TEST_PASSED;                                   \
         }
 
+/**
+ *  Test a function of one input that returns its result, such as
+ *  arm_exp_q31().  The input of element i is given by input_expr.
+ */
+#define FAST_MATH_ELT1_TEST_TEMPLATE(func, suffix, input_expr)              \
+                                                                            \
+    JTEST_DEFINE_TEST(arm_##func##_##suffix##_test, arm_##func##_##suffix)  \
+    {                                                                       \
+        uint32_t i;                                                         \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                *((suffix##_t*)fast_math_output_fut + i) =                  \
+                    arm_##func##_##suffix(input_expr);                      \
+            });                                                             \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                *((suffix##_t*)fast_math_output_ref + i) =                  \
+                    ref_##func##_##suffix(input_expr);                      \
+            });                                                             \
+                                                                            \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                    \
+            FAST_MATH_MAX_LEN,                                              \
+            suffix##_t);                                                    \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/**
+ *  Test a function of two inputs that returns its result, such as
+ *  arm_atan2_q31().
+ */
+#define FAST_MATH_ELT2_TEST_TEMPLATE(func, suffix, input_a_expr,            \
+                                     input_b_expr)                          \
+                                                                            \
+    JTEST_DEFINE_TEST(arm_##func##_##suffix##_test, arm_##func##_##suffix)  \
+    {                                                                       \
+        uint32_t i;                                                         \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                *((suffix##_t*)fast_math_output_fut + i) =                  \
+                    arm_##func##_##suffix(input_a_expr, input_b_expr);      \
+            });                                                             \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                *((suffix##_t*)fast_math_output_ref + i) =                  \
+                    ref_##func##_##suffix(input_a_expr, input_b_expr);      \
+            });                                                             \
+                                                                            \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                    \
+            FAST_MATH_MAX_LEN,                                              \
+            suffix##_t);                                                    \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/**
+ *  Test a function that writes its result through a pointer and returns a
+ *  status, such as arm_log_q31().
+ */
+#define FAST_MATH_STATUS_TEST_TEMPLATE(func, suffix, input_expr)            \
+                                                                            \
+    JTEST_DEFINE_TEST(arm_##func##_##suffix##_test, arm_##func##_##suffix)  \
+    {                                                                       \
+        uint32_t i;                                                         \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                arm_##func##_##suffix(                                      \
+                    input_expr,                                             \
+                    (suffix##_t*)fast_math_output_fut + i);                 \
+            });                                                             \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                ref_##func##_##suffix(                                      \
+                    input_expr,                                             \
+                    (suffix##_t*)fast_math_output_ref + i);                 \
+            });                                                             \
+                                                                            \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                    \
+            FAST_MATH_MAX_LEN,                                              \
+            suffix##_t);                                                    \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/**
+ *  Test a function that returns its result as a mantissa and a shift, such
+ *  as arm_reciprocal_q31().  The shifts must match exactly and the mantissas
+ *  are compared using SNR.
+ */
+#define FAST_MATH_MANT_SHIFT_TEST_TEMPLATE(func, suffix, input_expr)        \
+                                                                            \
+    JTEST_DEFINE_TEST(arm_##func##_##suffix##_test, arm_##func##_##suffix)  \
+    {                                                                       \
+        uint32_t i;                                                         \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                arm_##func##_##suffix(                                      \
+                    input_expr,                                             \
+                    (suffix##_t*)fast_math_output_fut + i,                  \
+                    fast_math_shift_fut + i);                               \
+            });                                                             \
+                                                                            \
+        JTEST_COUNT_CYCLES(                                                 \
+            for(i=0;i<FAST_MATH_MAX_LEN;i++)                                \
+            {                                                               \
+                ref_##func##_##suffix(                                      \
+                    input_expr,                                             \
+                    (suffix##_t*)fast_math_output_ref + i,                  \
+                    fast_math_shift_ref + i);                               \
+            });                                                             \
+                                                                            \
+        TEST_ASSERT_BUFFERS_EQUAL(                                          \
+            fast_math_shift_fut,                                            \
+            fast_math_shift_ref,                                            \
+            FAST_MATH_MAX_LEN);                                             \
+                                                                            \
+        FAST_MATH_SNR_COMPARE_INTERFACE(                                    \
+            FAST_MATH_MAX_LEN,                                              \
+            suffix##_t);                                                    \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
 #endif /* _FAST_MATH_TEMPLATES_H_ */
@@ -20,6 +20,7 @@
 #define FILTERING_MAX_TAP_DELAY 0xFF
 #define FILTERING_MAX_L             3
 #define FILTERING_MAX_M             33
+#define FILTERING_MAX_NUMCHANNELS   8
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
@@ -49,6 +50,7 @@ ARR_DESC_DECLARE( filtering_numtaps );
 ARR_DESC_DECLARE( filtering_numtaps2 );
 ARR_DESC_DECLARE( filtering_postshifts );
 ARR_DESC_DECLARE( filtering_numstages );
+ARR_DESC_DECLARE( filtering_numchannels );
 ARR_DESC_DECLARE( filtering_Ls );
 ARR_DESC_DECLARE( filtering_Ms );
 
@@ -27,6 +27,12 @@
  */
 #define MATRIX_SNR_THRESHOLD 120
 
+/**
+ * SNR threshold for reconstructing a matrix from its decomposition, and for
+ * comparing Q31 decompositions against their floating-point counterparts.
+ */
+#define MATRIX_DECOMPOSITION_SNR_THRESHOLD 100
+
 /**
  *  Compare the outputs from the function under test and the reference
  *  function using SNR.
@@ -51,4 +51,13 @@ extern const q31_t matrix_q31_scale_values[MATRIX_MAX_COEFFS_LEN];
 extern const q15_t matrix_q15_scale_values[MATRIX_MAX_COEFFS_LEN];
 extern const int32_t matrix_shift_values[MATRIX_MAX_SHIFTS_LEN];
 
+/* Random Data Pool */
+extern float32_t matrix_f32_100_rand[100];
+
+/* Decomposition Inputs */
+ARR_DESC_DECLARE( matrix_f32_spd_inputs );
+ARR_DESC_DECLARE( matrix_f32_psd_inputs );
+ARR_DESC_DECLARE( matrix_f32_square_inputs );
+extern arm_matrix_instance_f32 matrix_f32_indefinite_2x2;
+
 #endif /* _MATRIX_TEST_DATA_H_ */
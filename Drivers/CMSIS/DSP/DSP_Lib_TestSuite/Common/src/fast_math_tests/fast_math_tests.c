@@ -16,6 +16,31 @@ SIN_COS_TEST_TEMPLATE_ELT1( f32, float32_t, cos );
 SIN_COS_TEST_TEMPLATE_ELT1( q31, q31_t, cos );
 SIN_COS_TEST_TEMPLATE_ELT1( q15, q15_t, cos );
 
+/*
+ * The inputs are derived from the positive random data so that every
+ * quadrant and both signs are covered.  The reference functions call the
+ * floating-point C library, so their cycle counts give the cost of the
+ * software floating-point path on cores without an FPU.
+ */
+#define FAST_MATH_Q31_SIGNED(i) ((q31_t)((uint32_t)fast_math_q31_inputs[i] << 1))
+
+FAST_MATH_ELT2_TEST_TEMPLATE( atan2, q31,
+                              FAST_MATH_Q31_SIGNED( i ),
+                              FAST_MATH_Q31_SIGNED( FAST_MATH_MAX_LEN - 1 - i ) );
+FAST_MATH_ELT2_TEST_TEMPLATE( atan2, q15,
+                              fast_math_q15_inputs[2 * i],
+                              fast_math_q15_inputs[2 * i + 1] );
+
+/* Inputs in [-8 0) in Q5.26 format */
+FAST_MATH_ELT1_TEST_TEMPLATE( exp, q31, -( fast_math_q31_inputs[i] >> 2 ) );
+
+FAST_MATH_STATUS_TEST_TEMPLATE( log, q31, fast_math_q31_inputs[i] );
+
+FAST_MATH_MANT_SHIFT_TEST_TEMPLATE( reciprocal, q31, FAST_MATH_Q31_SIGNED( i ) );
+FAST_MATH_MANT_SHIFT_TEST_TEMPLATE( reciprocal, q15, fast_math_q15_inputs[i] );
+
+FAST_MATH_MANT_SHIFT_TEST_TEMPLATE( rsqrt, q31, fast_math_q31_inputs[i] );
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -35,4 +60,15 @@ JTEST_DEFINE_GROUP( fast_math_tests )
     JTEST_TEST_CALL( arm_cos_f32_test );
     JTEST_TEST_CALL( arm_cos_q31_test );
     JTEST_TEST_CALL( arm_cos_q15_test );
+
+    JTEST_TEST_CALL( arm_atan2_q31_test );
+    JTEST_TEST_CALL( arm_atan2_q15_test );
+
+    JTEST_TEST_CALL( arm_exp_q31_test );
+    JTEST_TEST_CALL( arm_log_q31_test );
+
+    JTEST_TEST_CALL( arm_reciprocal_q31_test );
+    JTEST_TEST_CALL( arm_reciprocal_q15_test );
+
+    JTEST_TEST_CALL( arm_rsqrt_q31_test );
 }
@@ -215,6 +215,97 @@ JTEST_DEFINE_TEST( arm_biquad_cascade_df2T_f64_test,
 }
 
 
+/*
+ * State buffers of the per-channel reference instances used by the multichannel tests.
+ */
+static float32_t biquad_multi_state_ref[FILTERING_MAX_NUMCHANNELS][FILTERING_MAX_NUMSTAGES * 4];
+
+/*
+ * Trailing postShift argument of the init functions, empty for floating-point.
+ */
+#define BIQUAD_MULTI_POSTSHIFT_f32
+#define BIQUAD_MULTI_POSTSHIFT_q31 , 1
+#define BIQUAD_MULTI_POSTSHIFT_q15 , 1
+
+/*
+ * The multichannel biquads must be bit-exact with one call of the single channel
+ * function per de-interleaved channel.
+ */
+#define BIQUAD_MULTI_DEFINE_TEST(suffix, config_suffix, single_instance_name,  \
+                                 output_type)                                  \
+   JTEST_DEFINE_TEST(arm_biquad_cascade_multi_##config_suffix##_##suffix##_test, \
+         arm_biquad_cascade_multi_##config_suffix##_##suffix)                  \
+   {                                                                           \
+      arm_biquad_cascade_multi_##config_suffix##_instance_##suffix             \
+         biquad_inst_fut = { 0 };                                              \
+      single_instance_name biquad_inst_ref[FILTERING_MAX_NUMCHANNELS];         \
+      output_type * ch_in = (output_type *) filtering_scratch;                 \
+      output_type * ch_out = (output_type *) filtering_scratch2;               \
+      uint32_t ch, i;                                                          \
+                                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                    \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes           \
+            ,                                                                  \
+         TEMPLATE_DO_ARR_DESC(                                                 \
+               numstages_idx, uint16_t, numStages, filtering_numstages         \
+               ,                                                               \
+            TEMPLATE_DO_ARR_DESC(                                              \
+                  numchannels_idx, uint16_t, numChannels, filtering_numchannels \
+                  ,                                                            \
+                  /* Display test parameter values */                          \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                           \
+                                  "Number of Stages: %d\n"                     \
+                                  "Number of Channels: %d\n",                  \
+                                  (int)blockSize,                              \
+                                  (int)numStages,                              \
+                                  (int)numChannels);                           \
+                                                                               \
+                  /* Initialize the multichannel BIQUAD Instance */            \
+                  arm_biquad_cascade_multi_##config_suffix##_init_##suffix(    \
+                        &biquad_inst_fut, numStages, numChannels,              \
+                        (output_type*)filtering_coeffs_b_##suffix,             \
+                        (void *) filtering_pState BIQUAD_MULTI_POSTSHIFT_##suffix); \
+                                                                               \
+                  JTEST_COUNT_CYCLES(                                          \
+                        arm_biquad_cascade_multi_##config_suffix##_##suffix(   \
+                              &biquad_inst_fut,                                \
+                              (void *) filtering_##suffix##_inputs,            \
+                              (void *) filtering_output_fut,                   \
+                              blockSize));                                     \
+                                                                               \
+                  /* Run every channel through its own single channel filter */ \
+                  for (ch = 0; ch < numChannels; ch++)                         \
+                  {                                                            \
+                     arm_biquad_cascade_##config_suffix##_init_##suffix(       \
+                           &biquad_inst_ref[ch], numStages,                    \
+                           (output_type*)filtering_coeffs_b_##suffix,          \
+                           (void *) biquad_multi_state_ref[ch]                 \
+                           BIQUAD_MULTI_POSTSHIFT_##suffix);                   \
+                                                                               \
+                     for (i = 0; i < blockSize; i++)                           \
+                     {                                                         \
+                        ch_in[i] = ((output_type *) filtering_##suffix##_inputs) \
+                           [i * numChannels + ch];                             \
+                     }                                                         \
+                                                                               \
+                     arm_biquad_cascade_##config_suffix##_##suffix(            \
+                           &biquad_inst_ref[ch], ch_in, ch_out, blockSize);    \
+                                                                               \
+                     for (i = 0; i < blockSize; i++)                           \
+                     {                                                         \
+                        ((output_type *) filtering_output_ref)                 \
+                           [i * numChannels + ch] = ch_out[i];                 \
+                     }                                                         \
+                  }                                                            \
+                                                                               \
+                  TEST_ASSERT_BUFFERS_EQUAL(                                   \
+                        filtering_output_ref,                                  \
+                        filtering_output_fut,                                  \
+                        blockSize * numChannels * sizeof(output_type)))));     \
+                                                                               \
+            return JTEST_TEST_PASSED;                                          \
+   }
+
 BIQUAD_DEFINE_TEST( f32, arm_biquad_casd_df1_inst_f32, df1, float32_t );
 BIQUAD_DEFINE_TEST( f32, arm_biquad_cascade_df2T_instance_f32, df2T, float32_t );
 BIQUAD_DEFINE_TEST( f32, arm_biquad_cascade_stereo_df2T_instance_f32, stereo_df2T, float32_t );
@@ -222,6 +313,9 @@ BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q31, df1,, q31_t );
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q15, df1,, q15_t );
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q31, df1, _fast, q31_t );
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q15, df1, _fast, q15_t );
+BIQUAD_MULTI_DEFINE_TEST( f32, df2T, arm_biquad_cascade_df2T_instance_f32, float32_t );
+BIQUAD_MULTI_DEFINE_TEST( q31, df1, arm_biquad_casd_df1_inst_q31, q31_t );
+BIQUAD_MULTI_DEFINE_TEST( q15, df1, arm_biquad_casd_df1_inst_q15, q15_t );
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -241,4 +335,7 @@ JTEST_DEFINE_GROUP( biquad_tests )
     JTEST_TEST_CALL( arm_biquad_cascade_df1_fast_q31_test );
     JTEST_TEST_CALL( arm_biquad_cascade_df1_fast_q15_test );
     JTEST_TEST_CALL( arm_biquad_cas_df1_32x64_q31_test );
+    JTEST_TEST_CALL( arm_biquad_cascade_multi_df2T_f32_test );
+    JTEST_TEST_CALL( arm_biquad_cascade_multi_df1_q31_test );
+    JTEST_TEST_CALL( arm_biquad_cascade_multi_df1_q15_test );
 }
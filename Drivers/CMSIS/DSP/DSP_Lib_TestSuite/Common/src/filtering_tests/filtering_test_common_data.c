@@ -572,6 +572,12 @@ ARR_DESC_DEFINE( uint16_t,
                  CURLY(
                      1, 7, FILTERING_MAX_NUMSTAGES ) );
 
+ARR_DESC_DEFINE( uint16_t,
+                 filtering_numchannels,
+                 4,
+                 CURLY(
+                     1, 2, 3, FILTERING_MAX_NUMCHANNELS ) );
+
 ARR_DESC_DEFINE( uint8_t,
                  filtering_postshifts,
                  3,
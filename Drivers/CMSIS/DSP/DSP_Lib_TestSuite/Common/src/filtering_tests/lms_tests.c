@@ -192,6 +192,167 @@ static const q15_t mu_q15 = 0x7fff;
             return JTEST_TEST_PASSED;                                                  \
    }
 
+/*
+ * The block, block normalized and partial-update variants are run in two
+ * calls of half a block each, so that the state carried between calls
+ * (energy, x0, updateIndex) is exercised. Both the output and the error
+ * blocks are compared with the reference.
+ *
+ * fn is the function name without the arm_ prefix. lms_init is an init call
+ * on lms_inst; it may use numTaps, blockSize and, for the fixed-point tests,
+ * postShift.
+ */
+
+#define LMS_VARIANT_RUN(fn, output_type, lms_init, src, out)                          \
+   do                                                                                  \
+   {                                                                                   \
+      uint32_t half = blockSize / 2;                                                   \
+                                                                                       \
+      for(i=0;i<numTaps;i++)                                                           \
+      {                                                                                \
+         *((output_type*)filtering_coeffs_lms + i) = (output_type)0;                   \
+      }                                                                                \
+                                                                                       \
+      lms_init;                                                                        \
+                                                                                       \
+      fn(&lms_inst,                                                                    \
+         (void *) (src),                                                               \
+         (void *) filtering_input_lms,                                                 \
+         (void *) (out),                                                               \
+         (void *) ((output_type*)(out) + blockSize),                                   \
+         half);                                                                        \
+      fn(&lms_inst,                                                                    \
+         (void *) ((output_type*)(src) + half),                                        \
+         (void *) ((output_type*)filtering_input_lms + half),                          \
+         (void *) ((output_type*)(out) + half),                                        \
+         (void *) ((output_type*)(out) + blockSize + half),                            \
+         blockSize - half);                                                            \
+   } while (0)
+
+#define LMS_VARIANT_DEFINE_TEST(fn, instance_type, lms_init)                           \
+   JTEST_DEFINE_TEST(arm_##fn##_test, arm_##fn)                                        \
+   {                                                                                   \
+      instance_type lms_inst = { 0 };                                                  \
+      arm_fir_instance_f32 fir_inst = { 0 };                                           \
+      uint32_t i;                                                                      \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            blocksize_idx, uint32_t, blockSize, lms_blocksizes                         \
+            ,                                                                          \
+         TEMPLATE_DO_ARR_DESC(                                                         \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps                       \
+               ,                                                                       \
+               arm_fir_init_f32(                                                       \
+                     &fir_inst, numTaps,                                               \
+                     (float32_t*)filtering_coeffs_f32,                                 \
+                     (void *) filtering_pState, blockSize);                            \
+                                                                                       \
+               ref_fir_f32(                                                            \
+                     &fir_inst,                                                        \
+                     (void *) filtering_f32_inputs,                                    \
+                     (void *) filtering_input_lms,                                     \
+                     blockSize);                                                       \
+                                                                                       \
+               for(i=0;i<blockSize;i++)                                                \
+               {                                                                       \
+                  /* scaled down so that lms will converge           */                \
+                  /* scaled down by almost the max of the abs(input) */                \
+                  *((float32_t*)filtering_input_lms + i) =                             \
+                        *((float32_t*)filtering_input_lms + i) / 200.0f;               \
+                                                                                       \
+                  *((float32_t*)filtering_output_f32_fut + i) =                        \
+                        *((float32_t*)filtering_f32_inputs + i) / 200.0f;              \
+               }                                                                       \
+                                                                                       \
+               JTEST_DUMP_STRF("Block Size: %d\n"                                      \
+                               "Number of Taps: %d\n",                                 \
+                               (int)blockSize,                                         \
+                               (int)numTaps);                                          \
+                                                                                       \
+               JTEST_COUNT_CYCLES(                                                     \
+                     LMS_VARIANT_RUN(arm_##fn, float32_t, lms_init,                    \
+                                     filtering_output_f32_fut,                         \
+                                     filtering_output_fut));                           \
+                                                                                       \
+               LMS_VARIANT_RUN(ref_##fn, float32_t, lms_init,                          \
+                               filtering_output_f32_fut,                               \
+                               filtering_output_ref);                                  \
+                                                                                       \
+               FILTERING_SNR_COMPARE_INTERFACE_OFFSET(                                 \
+                     blockSize,                                                        \
+                     blockSize,                                                        \
+                     float32_t);                                                       \
+                                                                                       \
+               FILTERING_SNR_COMPARE_INTERFACE(                                        \
+                     blockSize,                                                        \
+                     float32_t)));                                                     \
+                                                                                       \
+            return JTEST_TEST_PASSED;                                                  \
+   }
+
+#define LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(fn, instance_type, suffix, output_type, lms_init) \
+   JTEST_DEFINE_TEST(arm_##fn##_test, arm_##fn)                                        \
+   {                                                                                   \
+      instance_type lms_inst = { 0 };                                                  \
+      arm_fir_instance_##suffix fir_inst = { 0 };                                      \
+      uint32_t i;                                                                      \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            blocksize_idx, uint32_t, blockSize, lms_blocksizes                         \
+            ,                                                                          \
+         TEMPLATE_DO_ARR_DESC(                                                         \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps                       \
+               ,                                                                       \
+               TEMPLATE_DO_ARR_DESC(                                                   \
+                     postshifts_idx, uint8_t, postShift, filtering_postshifts          \
+                     ,                                                                 \
+                  arm_fir_init_##suffix(                                               \
+                        &fir_inst, numTaps,                                            \
+                        (output_type*)filtering_coeffs_##suffix,                       \
+                        (void *) filtering_pState, blockSize);                         \
+                                                                                       \
+                  ref_fir_##suffix(                                                    \
+                        &fir_inst,                                                     \
+                        (void *) filtering_##suffix##_inputs,                          \
+                        (void *) filtering_input_lms,                                  \
+                        blockSize);                                                    \
+                                                                                       \
+                  for(i=0;i<blockSize;i++)                                             \
+                  {                                                                    \
+                     /* scaled down so that lms will converge */                       \
+                     /* scaled down by log2(numTaps) bits     */                       \
+                     *((output_type*)filtering_output_f32_fut + i) =                   \
+                           *((output_type*)filtering_##suffix##_inputs + i) >> 6;      \
+                  }                                                                    \
+                                                                                       \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                                   \
+                                  "Number of Taps: %d\n"                               \
+                                  "Post Shift: %d\n",                                  \
+                                  (int)blockSize,                                      \
+                                  (int)numTaps,                                        \
+                                  (int)postShift);                                     \
+                                                                                       \
+                  JTEST_COUNT_CYCLES(                                                  \
+                        LMS_VARIANT_RUN(arm_##fn, output_type, lms_init,               \
+                                        filtering_output_f32_fut,                      \
+                                        filtering_output_fut));                        \
+                                                                                       \
+                  LMS_VARIANT_RUN(ref_##fn, output_type, lms_init,                     \
+                                  filtering_output_f32_fut,                            \
+                                  filtering_output_ref);                               \
+                                                                                       \
+                  FILTERING_SNR_COMPARE_INTERFACE_OFFSET(                              \
+                        blockSize,                                                     \
+                        blockSize,                                                     \
+                        output_type);                                                  \
+                                                                                       \
+                  FILTERING_SNR_COMPARE_INTERFACE(                                     \
+                        blockSize,                                                     \
+                        output_type))));                                               \
+                                                                                       \
+            return JTEST_TEST_PASSED;                                                  \
+   }
+
 LMS_DEFINE_TEST( f32,, float32_t, mu_f32 );
 LMS_WITH_POSTSHIFT_DEFINE_TEST( q31,, q31_t );
 LMS_WITH_POSTSHIFT_DEFINE_TEST( q15,, q15_t );
@@ -200,6 +361,48 @@ LMS_DEFINE_TEST( f32, _norm, float32_t, mu2_f32 );
 LMS_WITH_POSTSHIFT_DEFINE_TEST( q31, _norm, q31_t );
 LMS_WITH_POSTSHIFT_DEFINE_TEST( q15, _norm, q15_t );
 
+LMS_VARIANT_DEFINE_TEST(
+   lms_block_f32, arm_lms_instance_f32,
+   arm_lms_init_f32(&lms_inst, numTaps, (float32_t*)filtering_coeffs_lms,
+                    (void *) filtering_pState, mu_f32, blockSize) );
+LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(
+   lms_block_q31, arm_lms_instance_q31, q31, q31_t,
+   arm_lms_init_q31(&lms_inst, numTaps, (q31_t*)filtering_coeffs_lms,
+                    (void *) filtering_pState, mu_q31, blockSize, postShift) );
+LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(
+   lms_block_q15, arm_lms_instance_q15, q15, q15_t,
+   arm_lms_init_q15(&lms_inst, numTaps, (q15_t*)filtering_coeffs_lms,
+                    (void *) filtering_pState, mu_q15, blockSize, postShift) );
+
+LMS_VARIANT_DEFINE_TEST(
+   lms_norm_block_f32, arm_lms_norm_instance_f32,
+   arm_lms_norm_init_f32(&lms_inst, numTaps, (float32_t*)filtering_coeffs_lms,
+                         (void *) filtering_pState, mu2_f32, blockSize) );
+LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(
+   lms_norm_block_q31, arm_lms_norm_instance_q31, q31, q31_t,
+   arm_lms_norm_init_q31(&lms_inst, numTaps, (q31_t*)filtering_coeffs_lms,
+                         (void *) filtering_pState, mu_q31, blockSize, postShift) );
+LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(
+   lms_norm_block_q15, arm_lms_norm_instance_q15, q15, q15_t,
+   arm_lms_norm_init_q15(&lms_inst, numTaps, (q15_t*)filtering_coeffs_lms,
+                         (void *) filtering_pState, mu_q15, blockSize, postShift) );
+
+LMS_VARIANT_DEFINE_TEST(
+   lms_partial_f32, arm_lms_partial_instance_f32,
+   arm_lms_partial_init_f32(&lms_inst, numTaps, (float32_t*)filtering_coeffs_lms,
+                            (void *) filtering_pState, mu_f32, blockSize,
+                            (numTaps + 2) / 3) );
+LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(
+   lms_partial_q31, arm_lms_partial_instance_q31, q31, q31_t,
+   arm_lms_partial_init_q31(&lms_inst, numTaps, (q31_t*)filtering_coeffs_lms,
+                            (void *) filtering_pState, mu_q31, blockSize, postShift,
+                            (numTaps + 2) / 3) );
+LMS_VARIANT_WITH_POSTSHIFT_DEFINE_TEST(
+   lms_partial_q15, arm_lms_partial_instance_q15, q15, q15_t,
+   arm_lms_partial_init_q15(&lms_inst, numTaps, (q15_t*)filtering_coeffs_lms,
+                            (void *) filtering_pState, mu_q15, blockSize, postShift,
+                            (numTaps + 2) / 3) );
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -216,4 +419,16 @@ JTEST_DEFINE_GROUP( lms_tests )
     JTEST_TEST_CALL( arm_lms_norm_f32_test );
     JTEST_TEST_CALL( arm_lms_norm_q31_test );
     JTEST_TEST_CALL( arm_lms_norm_q15_test );
+
+    JTEST_TEST_CALL( arm_lms_block_f32_test );
+    JTEST_TEST_CALL( arm_lms_block_q31_test );
+    JTEST_TEST_CALL( arm_lms_block_q15_test );
+
+    JTEST_TEST_CALL( arm_lms_norm_block_f32_test );
+    JTEST_TEST_CALL( arm_lms_norm_block_q31_test );
+    JTEST_TEST_CALL( arm_lms_norm_block_q15_test );
+
+    JTEST_TEST_CALL( arm_lms_partial_f32_test );
+    JTEST_TEST_CALL( arm_lms_partial_q31_test );
+    JTEST_TEST_CALL( arm_lms_partial_q15_test );
 }
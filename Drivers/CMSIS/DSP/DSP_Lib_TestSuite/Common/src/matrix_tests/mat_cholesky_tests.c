@@ -0,0 +1,265 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * The decompositions are checked by rebuilding the (permuted) input from the
+ * factors with the reference matrix functions.  The Q31 factors are converted
+ * to floating-point and compared with the floating-point factors.
+ */
+
+static float32_t chol_l_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t chol_d_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t chol_tmp1_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t chol_tmp2_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t chol_ref_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t chol_fut_f32[MATRIX_TEST_MAX_ELTS];
+static q31_t chol_a_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t chol_l_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t chol_d_q31[MATRIX_TEST_MAX_ELTS];
+static uint16_t chol_pp[MATRIX_TEST_MAX_ROWS];
+static uint16_t chol_pp_q31[MATRIX_TEST_MAX_ROWS];
+
+/**
+ *  Compute dst = l * d * l^T, or l * l^T when d is NULL.
+ */
+static void mat_chol_rebuild(
+    arm_matrix_instance_f32 *l,
+    arm_matrix_instance_f32 *d,
+    float32_t *dst )
+{
+    uint16_t n = l->numRows;
+    arm_matrix_instance_f32 lt = {n, n, chol_tmp1_f32};
+    arm_matrix_instance_f32 dlt = {n, n, chol_tmp2_f32};
+    arm_matrix_instance_f32 out = {n, n, dst};
+
+    ref_mat_trans_f32( l, &lt );
+
+    if( d != NULL )
+    {
+        ref_mat_mult_f32( d, &lt, &dlt );
+        ref_mat_mult_f32( l, &dlt, &out );
+    }
+    else
+    {
+        ref_mat_mult_f32( l, &lt, &out );
+    }
+}
+
+JTEST_DEFINE_TEST( arm_mat_cholesky_f32_test, arm_mat_cholesky_f32 )
+{
+    arm_status status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_spd_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 l;
+
+        arm_mat_init_f32( &l, n, n, chol_l_f32 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        JTEST_COUNT_CYCLES( status = arm_mat_cholesky_f32( mat_ptr, &l ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* L * L^T must give back the input */
+        mat_chol_rebuild( &l, NULL, chol_fut_f32 );
+        memcpy( chol_ref_f32, mat_ptr->pData, n * n * sizeof( float32_t ) );
+
+        TEST_ASSERT_SNR( chol_ref_f32, chol_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    /* A matrix that is not positive definite must be rejected */
+    {
+        arm_matrix_instance_f32 l = {2, 2, chol_l_f32};
+
+        if( arm_mat_cholesky_f32( &matrix_f32_indefinite_2x2, &l ) !=
+            ARM_MATH_DECOMPOSITION_FAILURE )
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST( arm_mat_cholesky_q31_test, arm_mat_cholesky_q31 )
+{
+    arm_status status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_spd_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 l;
+        arm_matrix_instance_q31 a_q31;
+        arm_matrix_instance_q31 l_q31;
+
+        arm_mat_init_f32( &l, n, n, chol_l_f32 );
+        arm_mat_init_q31( &a_q31, n, n, chol_a_q31 );
+        arm_mat_init_q31( &l_q31, n, n, chol_l_q31 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        arm_float_to_q31( mat_ptr->pData, chol_a_q31, n * n );
+
+        JTEST_COUNT_CYCLES( status = arm_mat_cholesky_q31( &a_q31, &l_q31 ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* The Q31 factor must match the floating-point factor */
+        arm_mat_cholesky_f32( mat_ptr, &l );
+        arm_q31_to_float( chol_l_q31, chol_fut_f32, n * n );
+
+        TEST_ASSERT_SNR( chol_l_f32, chol_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    /* A matrix that is not positive definite must be rejected */
+    {
+        arm_matrix_instance_q31 a_q31 = {2, 2, chol_a_q31};
+        arm_matrix_instance_q31 l_q31 = {2, 2, chol_l_q31};
+
+        arm_float_to_q31( matrix_f32_indefinite_2x2.pData, chol_a_q31, 4 );
+
+        if( arm_mat_cholesky_q31( &a_q31, &l_q31 ) !=
+            ARM_MATH_DECOMPOSITION_FAILURE )
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST( arm_mat_ldlt_f32_test, arm_mat_ldlt_f32 )
+{
+    arm_status status;
+    uint32_t i, j;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_psd_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 l;
+        arm_matrix_instance_f32 d;
+
+        arm_mat_init_f32( &l, n, n, chol_l_f32 );
+        arm_mat_init_f32( &d, n, n, chol_d_f32 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        JTEST_COUNT_CYCLES( status = arm_mat_ldlt_f32( mat_ptr, &l, &d, chol_pp ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* L * D * L^T must give back P * A * P^T */
+        mat_chol_rebuild( &l, &d, chol_fut_f32 );
+
+        for( i = 0; i < n; i++ )
+        {
+            for( j = 0; j < n; j++ )
+            {
+                chol_ref_f32[i * n + j] =
+                    mat_ptr->pData[chol_pp[i] * n + chol_pp[j]];
+            }
+        }
+
+        TEST_ASSERT_SNR( chol_ref_f32, chol_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST( arm_mat_ldlt_q31_test, arm_mat_ldlt_q31 )
+{
+    arm_status status;
+    uint32_t i;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_psd_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 l;
+        arm_matrix_instance_f32 d;
+        arm_matrix_instance_q31 a_q31;
+        arm_matrix_instance_q31 l_q31;
+        arm_matrix_instance_q31 d_q31;
+
+        arm_mat_init_f32( &l, n, n, chol_l_f32 );
+        arm_mat_init_f32( &d, n, n, chol_d_f32 );
+        arm_mat_init_q31( &a_q31, n, n, chol_a_q31 );
+        arm_mat_init_q31( &l_q31, n, n, chol_l_q31 );
+        arm_mat_init_q31( &d_q31, n, n, chol_d_q31 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        arm_float_to_q31( mat_ptr->pData, chol_a_q31, n * n );
+
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_ldlt_q31( &a_q31, &l_q31, &d_q31, chol_pp_q31 ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* The Q31 factors must match the floating-point factors */
+        arm_mat_ldlt_f32( mat_ptr, &l, &d, chol_pp );
+
+        for( i = 0; i < n; i++ )
+        {
+            if( chol_pp[i] != chol_pp_q31[i] )
+            {
+                return JTEST_TEST_FAILED;
+            }
+        }
+
+        arm_q31_to_float( chol_l_q31, chol_fut_f32, n * n );
+        TEST_ASSERT_SNR( chol_l_f32, chol_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD );
+
+        arm_q31_to_float( chol_d_q31, chol_fut_f32, n * n );
+        TEST_ASSERT_SNR( chol_d_f32, chol_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( mat_cholesky_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_mat_cholesky_f32_test );
+    JTEST_TEST_CALL( arm_mat_cholesky_q31_test );
+    JTEST_TEST_CALL( arm_mat_ldlt_f32_test );
+    JTEST_TEST_CALL( arm_mat_ldlt_q31_test );
+}
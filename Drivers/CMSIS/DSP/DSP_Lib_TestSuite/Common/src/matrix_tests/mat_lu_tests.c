@@ -0,0 +1,133 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * The LU decompositions are checked by rebuilding P * A from the factors with
+ * the reference matrix multiplication.
+ */
+
+static float32_t lu_l_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t lu_u_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t lu_ref_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t lu_fut_f32[MATRIX_TEST_MAX_ELTS];
+static q31_t lu_a_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t lu_l_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t lu_u_q31[MATRIX_TEST_MAX_ELTS];
+static uint16_t lu_pp[MATRIX_TEST_MAX_ROWS];
+
+/**
+ *  Compute lu_fut_f32 = L * U and lu_ref_f32 = P * A.
+ */
+static void mat_lu_rebuild(
+    arm_matrix_instance_f32 *a,
+    arm_matrix_instance_f32 *l,
+    arm_matrix_instance_f32 *u )
+{
+    uint16_t n = a->numRows;
+    arm_matrix_instance_f32 out = {n, n, lu_fut_f32};
+    uint32_t i;
+
+    ref_mat_mult_f32( l, u, &out );
+
+    for( i = 0; i < n; i++ )
+    {
+        memcpy( &lu_ref_f32[i * n], &a->pData[lu_pp[i] * n], n * sizeof( float32_t ) );
+    }
+}
+
+JTEST_DEFINE_TEST( arm_mat_lu_f32_test, arm_mat_lu_f32 )
+{
+    arm_status status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_square_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 l;
+        arm_matrix_instance_f32 u;
+
+        arm_mat_init_f32( &l, n, n, lu_l_f32 );
+        arm_mat_init_f32( &u, n, n, lu_u_f32 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        JTEST_COUNT_CYCLES( status = arm_mat_lu_f32( mat_ptr, &l, &u, lu_pp ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        mat_lu_rebuild( mat_ptr, &l, &u );
+
+        TEST_ASSERT_SNR( lu_ref_f32, lu_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST( arm_mat_lu_q31_test, arm_mat_lu_q31 )
+{
+    arm_status status;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_square_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 l;
+        arm_matrix_instance_f32 u;
+        arm_matrix_instance_q31 a_q31;
+        arm_matrix_instance_q31 l_q31;
+        arm_matrix_instance_q31 u_q31;
+
+        arm_mat_init_f32( &l, n, n, lu_l_f32 );
+        arm_mat_init_f32( &u, n, n, lu_u_f32 );
+        arm_mat_init_q31( &a_q31, n, n, lu_a_q31 );
+        arm_mat_init_q31( &l_q31, n, n, lu_l_q31 );
+        arm_mat_init_q31( &u_q31, n, n, lu_u_q31 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        arm_float_to_q31( mat_ptr->pData, lu_a_q31, n * n );
+
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_lu_q31( &a_q31, &l_q31, &u_q31, lu_pp ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* Rebuild P * A from the factors converted to floating-point */
+        arm_q31_to_float( lu_l_q31, lu_l_f32, n * n );
+        arm_q31_to_float( lu_u_q31, lu_u_f32, n * n );
+        mat_lu_rebuild( mat_ptr, &l, &u );
+
+        TEST_ASSERT_SNR( lu_ref_f32, lu_fut_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( mat_lu_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_mat_lu_f32_test );
+    JTEST_TEST_CALL( arm_mat_lu_q31_test );
+}
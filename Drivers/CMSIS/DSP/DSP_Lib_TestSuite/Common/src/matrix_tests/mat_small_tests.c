@@ -0,0 +1,205 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * The unrolled 2x2, 3x3, 4x4 and 6x6 kernels must give bit-exact results with
+ * the reference functions, both when called directly and through the generic
+ * arm_mat_mult_*() and arm_mat_trans_*() entry points. Each test also reports
+ * the cycle counts of the reference loop, the generic entry point and the
+ * kernel on the same data.
+ *
+ * A and B are taken from the random pool at different offsets. For Q31 the
+ * pool is scaled by 1/128 so that no 6x6 dot product overflows.
+ */
+
+#define MAT_SMALL_SIZES_LEN 4
+#define MAT_SMALL_Q31_SCALE (1.0f / 128.0f)
+
+static const uint16_t mat_small_sizes[MAT_SMALL_SIZES_LEN] = {2, 3, 4, 6};
+
+static void (* const mat_mult_small_f32_kernels[MAT_SMALL_SIZES_LEN])(
+    const float32_t *, const float32_t *, float32_t *) =
+{
+    arm_mat_mult_2x2_f32,
+    arm_mat_mult_3x3_f32,
+    arm_mat_mult_4x4_f32,
+    arm_mat_mult_6x6_f32
+};
+
+static void (* const mat_mult_small_q31_kernels[MAT_SMALL_SIZES_LEN])(
+    const q31_t *, const q31_t *, q31_t *) =
+{
+    arm_mat_mult_2x2_q31,
+    arm_mat_mult_3x3_q31,
+    arm_mat_mult_4x4_q31,
+    arm_mat_mult_6x6_q31
+};
+
+static void (* const mat_trans_small_f32_kernels[MAT_SMALL_SIZES_LEN])(
+    const float32_t *, float32_t *) =
+{
+    arm_mat_trans_2x2_f32,
+    arm_mat_trans_3x3_f32,
+    arm_mat_trans_4x4_f32,
+    arm_mat_trans_6x6_f32
+};
+
+static void (* const mat_trans_small_q31_kernels[MAT_SMALL_SIZES_LEN])(
+    const q31_t *, q31_t *) =
+{
+    arm_mat_trans_2x2_q31,
+    arm_mat_trans_3x3_q31,
+    arm_mat_trans_4x4_q31,
+    arm_mat_trans_6x6_q31
+};
+
+static float32_t small_a_f32[36];
+static float32_t small_b_f32[36];
+static q31_t small_a_q31[36];
+static q31_t small_b_q31[36];
+
+/**
+ *  Fill the A and B inputs of both types from the random pool.
+ */
+static void mat_small_setup(
+    void )
+{
+    memcpy( small_a_f32, matrix_f32_100_rand, sizeof( small_a_f32 ) );
+    memcpy( small_b_f32, matrix_f32_100_rand + 37, sizeof( small_b_f32 ) );
+
+    arm_scale_f32( small_a_f32, MAT_SMALL_Q31_SCALE, matrix_output_fut.pData, 36 );
+    arm_float_to_q31( matrix_output_fut.pData, small_a_q31, 36 );
+    arm_scale_f32( small_b_f32, MAT_SMALL_Q31_SCALE, matrix_output_fut.pData, 36 );
+    arm_float_to_q31( matrix_output_fut.pData, small_b_q31, 36 );
+}
+
+#define MAT_MULT_SMALL_DEFINE_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_mat_mult_small_##suffix##_test,                   \
+                      arm_mat_mult_small_##suffix)                          \
+    {                                                                       \
+        arm_matrix_instance_##suffix a;                                     \
+        arm_matrix_instance_##suffix b;                                     \
+        arm_matrix_instance_##suffix fut;                                   \
+        arm_matrix_instance_##suffix ref;                                   \
+        arm_status status;                                                  \
+        uint32_t i;                                                         \
+        uint16_t n;                                                         \
+                                                                            \
+        mat_small_setup();                                                  \
+                                                                            \
+        for (i = 0; i < MAT_SMALL_SIZES_LEN; i++)                           \
+        {                                                                   \
+            n = mat_small_sizes[i];                                         \
+            arm_mat_init_##suffix(&a, n, n, small_a_##suffix);              \
+            arm_mat_init_##suffix(&b, n, n, small_b_##suffix);              \
+            arm_mat_init_##suffix(&fut, n, n,                               \
+                (TYPE_FROM_ABBREV(suffix) *) matrix_output_fut.pData);      \
+            arm_mat_init_##suffix(&ref, n, n,                               \
+                (TYPE_FROM_ABBREV(suffix) *) matrix_output_ref.pData);      \
+                                                                            \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);  \
+                                                                            \
+            JTEST_COUNT_CYCLES(ref_mat_mult_##suffix(&a, &b, &ref));        \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                status = arm_mat_mult_##suffix(&a, &b, &fut));              \
+                                                                            \
+            if (status != ARM_MATH_SUCCESS)                                 \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                fut.pData, ref.pData,                                       \
+                n * n * sizeof(TYPE_FROM_ABBREV(suffix)));                  \
+                                                                            \
+            memset(fut.pData, 0, n * n * sizeof(TYPE_FROM_ABBREV(suffix))); \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                mat_mult_small_##suffix##_kernels[i](                       \
+                    a.pData, b.pData, fut.pData));                          \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                fut.pData, ref.pData,                                       \
+                n * n * sizeof(TYPE_FROM_ABBREV(suffix)));                  \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define MAT_TRANS_SMALL_DEFINE_TEST(suffix)                                 \
+    JTEST_DEFINE_TEST(arm_mat_trans_small_##suffix##_test,                  \
+                      arm_mat_trans_small_##suffix)                         \
+    {                                                                       \
+        arm_matrix_instance_##suffix a;                                     \
+        arm_matrix_instance_##suffix fut;                                   \
+        arm_matrix_instance_##suffix ref;                                   \
+        arm_status status;                                                  \
+        uint32_t i;                                                         \
+        uint16_t n;                                                         \
+                                                                            \
+        mat_small_setup();                                                  \
+                                                                            \
+        for (i = 0; i < MAT_SMALL_SIZES_LEN; i++)                           \
+        {                                                                   \
+            n = mat_small_sizes[i];                                         \
+            arm_mat_init_##suffix(&a, n, n, small_a_##suffix);              \
+            arm_mat_init_##suffix(&fut, n, n,                               \
+                (TYPE_FROM_ABBREV(suffix) *) matrix_output_fut.pData);      \
+            arm_mat_init_##suffix(&ref, n, n,                               \
+                (TYPE_FROM_ABBREV(suffix) *) matrix_output_ref.pData);      \
+                                                                            \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);  \
+                                                                            \
+            JTEST_COUNT_CYCLES(ref_mat_trans_##suffix(&a, &ref));           \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                status = arm_mat_trans_##suffix(&a, &fut));                 \
+                                                                            \
+            if (status != ARM_MATH_SUCCESS)                                 \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                fut.pData, ref.pData,                                       \
+                n * n * sizeof(TYPE_FROM_ABBREV(suffix)));                  \
+                                                                            \
+            memset(fut.pData, 0, n * n * sizeof(TYPE_FROM_ABBREV(suffix))); \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                mat_trans_small_##suffix##_kernels[i](a.pData, fut.pData)); \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(                                      \
+                fut.pData, ref.pData,                                       \
+                n * n * sizeof(TYPE_FROM_ABBREV(suffix)));                  \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+MAT_MULT_SMALL_DEFINE_TEST( f32 );
+MAT_MULT_SMALL_DEFINE_TEST( q31 );
+MAT_TRANS_SMALL_DEFINE_TEST( f32 );
+MAT_TRANS_SMALL_DEFINE_TEST( q31 );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( mat_small_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_mat_mult_small_f32_test );
+    JTEST_TEST_CALL( arm_mat_mult_small_q31_test );
+    JTEST_TEST_CALL( arm_mat_trans_small_f32_test );
+    JTEST_TEST_CALL( arm_mat_trans_small_q31_test );
+}
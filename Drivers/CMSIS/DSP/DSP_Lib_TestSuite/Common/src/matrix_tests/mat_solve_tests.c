@@ -0,0 +1,251 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * The triangular solvers use the Cholesky factor of the positive definite test
+ * matrices as L and its transpose as U, with the input matrix scaled by 1/8 as
+ * right-hand side, and check that T * X gives back the right-hand side.
+ *
+ * arm_mat_cholesky_solve_q31_test solves A * X = B through the Q31 Cholesky
+ * factor and both triangular solvers, and reports its cycle count and SNR next
+ * to those of arm_mat_inverse_f32() followed by arm_mat_mult_f32().
+ */
+
+#define MATRIX_SOLVE_RHS_SCALE 0.125f
+
+static float32_t solve_t_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t solve_b_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t solve_x_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t solve_inv_f32[MATRIX_TEST_MAX_ELTS];
+static float32_t solve_fut_f32[MATRIX_TEST_MAX_ELTS];
+static q31_t solve_a_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t solve_t_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t solve_b_q31[MATRIX_TEST_MAX_ELTS];
+static q31_t solve_x_q31[MATRIX_TEST_MAX_ELTS];
+
+/**
+ *  Set up solve_t_f32 as the Cholesky factor of a (transposed when upper is
+ *  non-zero) and solve_b_f32 as the scaled copy of a.
+ */
+static void mat_solve_setup(
+    arm_matrix_instance_f32 *a,
+    int upper )
+{
+    uint16_t n = a->numRows;
+    arm_matrix_instance_f32 t = {n, n, solve_t_f32};
+    arm_matrix_instance_f32 tmp = {n, n, solve_inv_f32};
+
+    arm_mat_cholesky_f32( a, &t );
+
+    if( upper )
+    {
+        ref_mat_trans_f32( &t, &tmp );
+        memcpy( solve_t_f32, solve_inv_f32, n * n * sizeof( float32_t ) );
+    }
+
+    arm_scale_f32( a->pData, MATRIX_SOLVE_RHS_SCALE, solve_b_f32, n * n );
+}
+
+/**
+ *  solve_fut_f32 = T * X with X in solve_x_f32.
+ */
+static void mat_solve_rebuild(
+    uint16_t n )
+{
+    arm_matrix_instance_f32 t = {n, n, solve_t_f32};
+    arm_matrix_instance_f32 x = {n, n, solve_x_f32};
+    arm_matrix_instance_f32 out = {n, n, solve_fut_f32};
+
+    ref_mat_mult_f32( &t, &x, &out );
+}
+
+#define MAT_SOLVE_DEFINE_TEST_F32(kind, upper)                              \
+    JTEST_DEFINE_TEST(arm_mat_solve_##kind##_triangular_f32_test,           \
+                      arm_mat_solve_##kind##_triangular_f32)                \
+    {                                                                       \
+        arm_status status;                                                  \
+                                                                            \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_spd_inputs \
+            ,                                                               \
+            uint16_t n = mat_ptr->numRows;                                  \
+            arm_matrix_instance_f32 t;                                      \
+            arm_matrix_instance_f32 b;                                      \
+            arm_matrix_instance_f32 x;                                      \
+                                                                            \
+            arm_mat_init_f32( &t, n, n, solve_t_f32 );                      \
+            arm_mat_init_f32( &b, n, n, solve_b_f32 );                      \
+            arm_mat_init_f32( &x, n, n, solve_x_f32 );                      \
+                                                                            \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                            (int)mat_ptr->numRows,                          \
+                            (int)mat_ptr->numCols);                         \
+                                                                            \
+            mat_solve_setup(mat_ptr, upper);                                \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                status = arm_mat_solve_##kind##_triangular_f32(&t, &b, &x)); \
+                                                                            \
+            if (status != ARM_MATH_SUCCESS)                                 \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            mat_solve_rebuild(n);                                           \
+                                                                            \
+            TEST_ASSERT_SNR(solve_b_f32, solve_fut_f32, n * n,              \
+                            MATRIX_DECOMPOSITION_SNR_THRESHOLD));           \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define MAT_SOLVE_DEFINE_TEST_Q31(kind, upper)                              \
+    JTEST_DEFINE_TEST(arm_mat_solve_##kind##_triangular_q31_test,           \
+                      arm_mat_solve_##kind##_triangular_q31)                \
+    {                                                                       \
+        arm_status status;                                                  \
+                                                                            \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_spd_inputs \
+            ,                                                               \
+            uint16_t n = mat_ptr->numRows;                                  \
+            arm_matrix_instance_q31 t;                                      \
+            arm_matrix_instance_q31 b;                                      \
+            arm_matrix_instance_q31 x;                                      \
+                                                                            \
+            arm_mat_init_q31( &t, n, n, solve_t_q31 );                      \
+            arm_mat_init_q31( &b, n, n, solve_b_q31 );                      \
+            arm_mat_init_q31( &x, n, n, solve_x_q31 );                      \
+                                                                            \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                            (int)mat_ptr->numRows,                          \
+                            (int)mat_ptr->numCols);                         \
+                                                                            \
+            mat_solve_setup(mat_ptr, upper);                                \
+            arm_float_to_q31(solve_t_f32, solve_t_q31, n * n);              \
+            arm_float_to_q31(solve_b_f32, solve_b_q31, n * n);              \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                status = arm_mat_solve_##kind##_triangular_q31(&t, &b, &x)); \
+                                                                            \
+            if (status != ARM_MATH_SUCCESS)                                 \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            arm_q31_to_float(solve_x_q31, solve_x_f32, n * n);              \
+            mat_solve_rebuild(n);                                           \
+                                                                            \
+            TEST_ASSERT_SNR(solve_b_f32, solve_fut_f32, n * n,              \
+                            MATRIX_DECOMPOSITION_SNR_THRESHOLD));           \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+MAT_SOLVE_DEFINE_TEST_F32( lower, 0 );
+MAT_SOLVE_DEFINE_TEST_F32( upper, 1 );
+MAT_SOLVE_DEFINE_TEST_Q31( lower, 0 );
+MAT_SOLVE_DEFINE_TEST_Q31( upper, 1 );
+
+JTEST_DEFINE_TEST( arm_mat_cholesky_solve_q31_test, arm_mat_cholesky_q31 )
+{
+    arm_status status;
+    uint32_t i;
+
+    TEMPLATE_DO_ARR_DESC(
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr, matrix_f32_spd_inputs
+        ,
+        uint16_t n = mat_ptr->numRows;
+        arm_matrix_instance_f32 inv;
+        arm_matrix_instance_f32 b;
+        arm_matrix_instance_f32 x;
+        arm_matrix_instance_f32 a_copy;
+        arm_matrix_instance_q31 a_q31;
+        arm_matrix_instance_q31 l_q31;
+        arm_matrix_instance_q31 b_q31;
+        arm_matrix_instance_q31 x_q31;
+        float32_t snr;
+
+        arm_mat_init_f32( &inv, n, n, solve_inv_f32 );
+        arm_mat_init_f32( &b, n, n, solve_b_f32 );
+        arm_mat_init_f32( &x, n, n, solve_x_f32 );
+        arm_mat_init_f32( &a_copy, n, n, solve_fut_f32 );
+        arm_mat_init_q31( &a_q31, n, n, solve_a_q31 );
+        arm_mat_init_q31( &l_q31, n, n, solve_t_q31 );
+        arm_mat_init_q31( &b_q31, n, n, solve_b_q31 );
+        arm_mat_init_q31( &x_q31, n, n, solve_x_q31 );
+
+        JTEST_DUMP_STRF( "Matrix Dimensions: %dx%d\n",
+                        ( int )mat_ptr->numRows,
+                        ( int )mat_ptr->numCols );
+
+        /* Right-hand side B = A / 64 keeps the solution X = I / 64 in range */
+        arm_scale_f32( mat_ptr->pData, 1.0f / 64.0f, solve_b_f32, n * n );
+        arm_float_to_q31( mat_ptr->pData, solve_a_q31, n * n );
+        arm_float_to_q31( solve_b_f32, solve_b_q31, n * n );
+
+        /* Floating-point: X = inv(A) * B */
+        memcpy( solve_fut_f32, mat_ptr->pData, n * n * sizeof( float32_t ) );
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_inverse_f32( &a_copy, &inv );
+            arm_mat_mult_f32( &inv, &b, &x ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* Q31: A = L * L^T, L * Y = B, L^T * X = Y */
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_cholesky_q31( &a_q31, &l_q31 );
+            arm_mat_trans_q31( &l_q31, &a_q31 );
+            arm_mat_solve_lower_triangular_q31( &l_q31, &b_q31, &x_q31 );
+            arm_mat_solve_upper_triangular_q31( &a_q31, &x_q31, &x_q31 ) );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* Both must give X = I / 64 */
+        arm_fill_f32( 0.0f, solve_b_f32, n * n );
+
+        for( i = 0; i < n; i++ )
+        {
+            solve_b_f32[i * n + i] = 1.0f / 64.0f;
+        }
+
+        snr = arm_snr_f32( solve_b_f32, solve_x_f32, n * n );
+        JTEST_DUMP_STRF( "arm_mat_inverse_f32 SNR: %f\n", ( double )snr );
+
+        arm_q31_to_float( solve_x_q31, solve_x_f32, n * n );
+        snr = arm_snr_f32( solve_b_f32, solve_x_f32, n * n );
+        JTEST_DUMP_STRF( "arm_mat_cholesky_q31 SNR: %f\n", ( double )snr );
+
+        TEST_ASSERT_SNR( solve_b_f32, solve_x_f32, n * n,
+                        MATRIX_DECOMPOSITION_SNR_THRESHOLD ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( mat_solve_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_mat_solve_lower_triangular_f32_test );
+    JTEST_TEST_CALL( arm_mat_solve_upper_triangular_f32_test );
+    JTEST_TEST_CALL( arm_mat_solve_lower_triangular_q31_test );
+    JTEST_TEST_CALL( arm_mat_solve_upper_triangular_q31_test );
+    JTEST_TEST_CALL( arm_mat_cholesky_solve_q31_test );
+}
@@ -259,3 +259,95 @@ MATRIX_DEFINE_INPUTS( f64 );
 MATRIX_DEFINE_INPUTS( f32 );
 MATRIX_DEFINE_INPUTS( q31 );
 MATRIX_DEFINE_INPUTS( q15 );
+
+/*--------------------------------------------------------------------------------*/
+/* Decomposition Inputs */
+/*--------------------------------------------------------------------------------*/
+
+/* Symmetric positive definite matrices. All elements are below 1.0 so they can
+ * also be converted to Q31. */
+float32_t matrix_f32_spd_2x2_data[4] =
+{
+    0.5f, 0.1f,
+    0.1f, 0.3f
+};
+
+float32_t matrix_f32_spd_3x3_data[9] =
+{
+    0.4f,  0.1f,  -0.05f,
+    0.1f,  0.3f,  0.02f,
+    -0.05f, 0.02f, 0.2f
+};
+
+float32_t matrix_f32_spd_4x4_data[16] =
+{
+    0.6f,  0.2f,   -0.1f,  0.05f,
+    0.2f,  0.5f,   0.1f,   -0.02f,
+    -0.1f, 0.1f,   0.4f,   0.08f,
+    0.05f, -0.02f, 0.08f,  0.3f
+};
+
+/* Rank one positive semi-definite matrix v * v^T with v = {0.5, -0.25, 0.5, 0.125} */
+float32_t matrix_f32_psd_4x4_data[16] =
+{
+    0.25f,    -0.125f,   0.25f,    0.0625f,
+    -0.125f,  0.0625f,   -0.125f,  -0.03125f,
+    0.25f,    -0.125f,   0.25f,    0.0625f,
+    0.0625f,  -0.03125f, 0.0625f,  0.015625f
+};
+
+/* General non-symmetric matrix that needs row exchanges */
+float32_t matrix_f32_general_4x4_data[16] =
+{
+    0.1f,  0.5f,  -0.2f, 0.3f,
+    0.4f,  0.1f,  0.3f,  -0.1f,
+    -0.3f, 0.2f,  0.1f,  0.25f,
+    0.2f,  -0.4f, 0.15f, 0.1f
+};
+
+/* Symmetric matrix with a negative eigenvalue */
+float32_t matrix_f32_indefinite_2x2_data[4] =
+{
+    0.1f, 0.3f,
+    0.3f, 0.1f
+};
+
+arm_matrix_instance_f32 matrix_f32_spd_1x1 = {1, 1, matrix_f32_spd_2x2_data};
+arm_matrix_instance_f32 matrix_f32_spd_2x2 = {2, 2, matrix_f32_spd_2x2_data};
+arm_matrix_instance_f32 matrix_f32_spd_3x3 = {3, 3, matrix_f32_spd_3x3_data};
+arm_matrix_instance_f32 matrix_f32_spd_4x4 = {4, 4, matrix_f32_spd_4x4_data};
+arm_matrix_instance_f32 matrix_f32_psd_4x4 = {4, 4, matrix_f32_psd_4x4_data};
+arm_matrix_instance_f32 matrix_f32_general_4x4 = {4, 4, matrix_f32_general_4x4_data};
+arm_matrix_instance_f32 matrix_f32_indefinite_2x2 = {2, 2, matrix_f32_indefinite_2x2_data};
+
+ARR_DESC_DEFINE( arm_matrix_instance_f32 *,
+                 matrix_f32_spd_inputs,
+                 4,
+                 CURLY(
+                     &matrix_f32_spd_1x1,
+                     &matrix_f32_spd_2x2,
+                     &matrix_f32_spd_3x3,
+                     &matrix_f32_spd_4x4
+                 ) );
+
+ARR_DESC_DEFINE( arm_matrix_instance_f32 *,
+                 matrix_f32_psd_inputs,
+                 5,
+                 CURLY(
+                     &matrix_f32_spd_1x1,
+                     &matrix_f32_spd_2x2,
+                     &matrix_f32_spd_3x3,
+                     &matrix_f32_spd_4x4,
+                     &matrix_f32_psd_4x4
+                 ) );
+
+ARR_DESC_DEFINE( arm_matrix_instance_f32 *,
+                 matrix_f32_square_inputs,
+                 5,
+                 CURLY(
+                     &matrix_f32_spd_1x1,
+                     &matrix_f32_spd_2x2,
+                     &matrix_f32_spd_3x3,
+                     &matrix_f32_spd_4x4,
+                     &matrix_f32_general_4x4
+                 ) );
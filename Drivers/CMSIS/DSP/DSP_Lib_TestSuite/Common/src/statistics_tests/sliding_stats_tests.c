@@ -0,0 +1,184 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * The sliding window functions are checked against the batch functions applied
+ * to each window.  The stream is processed in two calls, then again in one call
+ * after a reset, so the saved state and the reset functions are exercised too.
+ */
+
+#define SLIDING_STATS_NUM_SAMPLES STATISTICS_MAX_INPUT_ELEMENTS
+#define SLIDING_STATS_SPLIT 13
+
+static STATISTICS_BIGGEST_INPUT_TYPE sliding_state[STATISTICS_MAX_INPUT_ELEMENTS];
+static uint32_t sliding_index[STATISTICS_MAX_INPUT_ELEMENTS];
+
+/*
+ * Batch references for one window of length len.
+ */
+#define SLIDING_REF_mean(suffix, src, len, dst)         \
+    arm_mean_##suffix(src, len, dst)
+
+#define SLIDING_REF_rms(suffix, src, len, dst)          \
+    arm_rms_##suffix(src, len, dst)
+
+#define SLIDING_REF_var(suffix, src, len, dst)          \
+    if (len == 1)                                       \
+    {                                                   \
+        *(dst) = 0;                                     \
+    }                                                   \
+    else                                                \
+    {                                                   \
+        arm_var_##suffix(src, len, dst);                \
+    }
+
+#define SLIDING_REF_max(suffix, src, len, dst)          \
+    arm_max_##suffix(src, len, dst, &statistics_idx_ref)
+
+#define SLIDING_REF_min(suffix, src, len, dst)          \
+    arm_min_##suffix(src, len, dst, &statistics_idx_ref)
+
+/*
+ * Fixed-point outputs must be bit-exact, floating-point outputs are compared by SNR.
+ */
+#define SLIDING_COMPARE_f32(ref, fut)                               \
+    TEST_CONVERT_AND_ASSERT_SNR(statistics_output_f32_ref, ref,     \
+                                statistics_output_f32_fut, fut,     \
+                                SLIDING_STATS_NUM_SAMPLES,          \
+                                float32_t,                          \
+                                STATISTICS_SNR_THRESHOLD_float32_t)
+
+#define SLIDING_COMPARE_q31(ref, fut)                               \
+    TEST_ASSERT_BUFFERS_EQUAL(ref, fut,                             \
+                              SLIDING_STATS_NUM_SAMPLES * sizeof(q31_t))
+
+#define SLIDING_COMPARE_q15(ref, fut)                               \
+    TEST_ASSERT_BUFFERS_EQUAL(ref, fut,                             \
+                              SLIDING_STATS_NUM_SAMPLES * sizeof(q15_t))
+
+#define SLIDING_DEFINE_TEST(fn_name, suffix, instance_name, init_call, reset_fn) \
+    JTEST_DEFINE_TEST(arm_sliding_##fn_name##_##suffix##_test,              \
+                      arm_sliding_##fn_name##_##suffix)                     \
+    {                                                                       \
+        instance_name S;                                                    \
+        TYPE_FROM_ABBREV(suffix) * input =                                  \
+            (TYPE_FROM_ABBREV(suffix) *) statistics_f_32.data_ptr;          \
+        TYPE_FROM_ABBREV(suffix) * out_fut =                                \
+            (TYPE_FROM_ABBREV(suffix) *) statistics_output_fut.data_ptr;    \
+        TYPE_FROM_ABBREV(suffix) * out_ref =                                \
+            (TYPE_FROM_ABBREV(suffix) *) statistics_output_ref.data_ptr;    \
+        uint32_t n, start;                                                  \
+                                                                            \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            window_idx, uint32_t, window_size, statistics_block_sizes       \
+            ,                                                               \
+            /* Display test parameter values */                             \
+            JTEST_DUMP_STRF("Window Size: %d\n", (int)window_size);         \
+                                                                            \
+            /* Batch function applied to every window */                    \
+            for (n = 0; n < SLIDING_STATS_NUM_SAMPLES; n++)                 \
+            {                                                               \
+                start = (n + 1 > window_size) ? (n + 1 - window_size) : 0;  \
+                SLIDING_REF_##fn_name(suffix, input + start,                \
+                                      n + 1 - start, out_ref + n);          \
+            }                                                               \
+                                                                            \
+            init_call;                                                      \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_sliding_##fn_name##_##suffix(                           \
+                    &S, input, out_fut, SLIDING_STATS_SPLIT));              \
+                                                                            \
+            arm_sliding_##fn_name##_##suffix(                               \
+                &S,                                                         \
+                input + SLIDING_STATS_SPLIT,                                \
+                out_fut + SLIDING_STATS_SPLIT,                              \
+                SLIDING_STATS_NUM_SAMPLES - SLIDING_STATS_SPLIT);           \
+                                                                            \
+            SLIDING_COMPARE_##suffix(out_ref, out_fut);                     \
+                                                                            \
+            /* The reset function must restart the window */                \
+            reset_fn(&S);                                                   \
+                                                                            \
+            arm_sliding_##fn_name##_##suffix(                               \
+                &S, input, out_fut, SLIDING_STATS_NUM_SAMPLES);             \
+                                                                            \
+            SLIDING_COMPARE_##suffix(out_ref, out_fut));                    \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define JTEST_ARM_SLIDING_STATS_TEST(fn_name, suffix)                       \
+    SLIDING_DEFINE_TEST(                                                    \
+        fn_name,                                                            \
+        suffix,                                                             \
+        arm_sliding_stats_instance_##suffix,                                \
+        arm_sliding_stats_init_##suffix(                                    \
+            &S, window_size, (TYPE_FROM_ABBREV(suffix) *) sliding_state),   \
+        arm_sliding_stats_reset_##suffix)
+
+#define JTEST_ARM_SLIDING_MINMAX_TEST(fn_name, suffix)                      \
+    SLIDING_DEFINE_TEST(                                                    \
+        fn_name,                                                            \
+        suffix,                                                             \
+        arm_sliding_minmax_instance_##suffix,                               \
+        arm_sliding_minmax_init_##suffix(                                   \
+            &S, window_size, (TYPE_FROM_ABBREV(suffix) *) sliding_state,    \
+            sliding_index),                                                 \
+        arm_sliding_minmax_reset_##suffix)
+
+JTEST_ARM_SLIDING_STATS_TEST( mean, f32 );
+JTEST_ARM_SLIDING_STATS_TEST( mean, q31 );
+JTEST_ARM_SLIDING_STATS_TEST( mean, q15 );
+
+JTEST_ARM_SLIDING_STATS_TEST( var, f32 );
+JTEST_ARM_SLIDING_STATS_TEST( var, q31 );
+JTEST_ARM_SLIDING_STATS_TEST( var, q15 );
+
+JTEST_ARM_SLIDING_STATS_TEST( rms, f32 );
+JTEST_ARM_SLIDING_STATS_TEST( rms, q31 );
+JTEST_ARM_SLIDING_STATS_TEST( rms, q15 );
+
+JTEST_ARM_SLIDING_MINMAX_TEST( max, f32 );
+JTEST_ARM_SLIDING_MINMAX_TEST( max, q31 );
+JTEST_ARM_SLIDING_MINMAX_TEST( max, q15 );
+
+JTEST_ARM_SLIDING_MINMAX_TEST( min, f32 );
+JTEST_ARM_SLIDING_MINMAX_TEST( min, q31 );
+JTEST_ARM_SLIDING_MINMAX_TEST( min, q15 );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( sliding_stats_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_sliding_mean_f32_test );
+    JTEST_TEST_CALL( arm_sliding_mean_q31_test );
+    JTEST_TEST_CALL( arm_sliding_mean_q15_test );
+
+    JTEST_TEST_CALL( arm_sliding_var_f32_test );
+    JTEST_TEST_CALL( arm_sliding_var_q31_test );
+    JTEST_TEST_CALL( arm_sliding_var_q15_test );
+
+    JTEST_TEST_CALL( arm_sliding_rms_f32_test );
+    JTEST_TEST_CALL( arm_sliding_rms_q31_test );
+    JTEST_TEST_CALL( arm_sliding_rms_q15_test );
+
+    JTEST_TEST_CALL( arm_sliding_max_f32_test );
+    JTEST_TEST_CALL( arm_sliding_max_q31_test );
+    JTEST_TEST_CALL( arm_sliding_max_q15_test );
+
+    JTEST_TEST_CALL( arm_sliding_min_f32_test );
+    JTEST_TEST_CALL( arm_sliding_min_q31_test );
+    JTEST_TEST_CALL( arm_sliding_min_q15_test );
+}
@@ -8,6 +8,7 @@ JTEST_DEFINE_GROUP( statistics_tests )
     JTEST_GROUP_CALL( min_tests );
     JTEST_GROUP_CALL( power_tests );
     JTEST_GROUP_CALL( rms_tests );
+    JTEST_GROUP_CALL( sliding_stats_tests );
     JTEST_GROUP_CALL( std_tests );
     JTEST_GROUP_CALL( var_tests );
     return;
@@ -0,0 +1,255 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "arm_const_structs.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+
+/*
+ * Every instance in arm_const_structs.h is referenced here, so the test only
+ * links when all of them are built (the default FFT table selection).
+ *
+ * The CFFT instances are run forward against the reference CFFT. The RFFT
+ * instances are compared field by field with the instance the matching init
+ * function builds.
+ */
+
+#define CONST_CFFT_STRUCTS_LEN 9
+#define CONST_RFFT_STRUCTS_LEN 9
+#define CONST_RFFT_FAST_STRUCTS_LEN 8
+
+static const arm_cfft_instance_f32 * const const_cfft_f32_structs[CONST_CFFT_STRUCTS_LEN] =
+{
+    &arm_cfft_sR_f32_len16,   &arm_cfft_sR_f32_len32,   &arm_cfft_sR_f32_len64,
+    &arm_cfft_sR_f32_len128,  &arm_cfft_sR_f32_len256,  &arm_cfft_sR_f32_len512,
+    &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+};
+
+static const arm_cfft_instance_q31 * const const_cfft_q31_structs[CONST_CFFT_STRUCTS_LEN] =
+{
+    &arm_cfft_sR_q31_len16,   &arm_cfft_sR_q31_len32,   &arm_cfft_sR_q31_len64,
+    &arm_cfft_sR_q31_len128,  &arm_cfft_sR_q31_len256,  &arm_cfft_sR_q31_len512,
+    &arm_cfft_sR_q31_len1024, &arm_cfft_sR_q31_len2048, &arm_cfft_sR_q31_len4096
+};
+
+static const arm_cfft_instance_q15 * const const_cfft_q15_structs[CONST_CFFT_STRUCTS_LEN] =
+{
+    &arm_cfft_sR_q15_len16,   &arm_cfft_sR_q15_len32,   &arm_cfft_sR_q15_len64,
+    &arm_cfft_sR_q15_len128,  &arm_cfft_sR_q15_len256,  &arm_cfft_sR_q15_len512,
+    &arm_cfft_sR_q15_len1024, &arm_cfft_sR_q15_len2048, &arm_cfft_sR_q15_len4096
+};
+
+static const arm_cfft_instance_q7 * const const_cfft_q7_structs[CONST_CFFT_STRUCTS_LEN] =
+{
+    &arm_cfft_sR_q7_len16,   &arm_cfft_sR_q7_len32,   &arm_cfft_sR_q7_len64,
+    &arm_cfft_sR_q7_len128,  &arm_cfft_sR_q7_len256,  &arm_cfft_sR_q7_len512,
+    &arm_cfft_sR_q7_len1024, &arm_cfft_sR_q7_len2048, &arm_cfft_sR_q7_len4096
+};
+
+static const arm_rfft_fast_instance_f32 * const const_rfft_fast_f32_structs[CONST_RFFT_FAST_STRUCTS_LEN] =
+{
+    &arm_rfft_fast_sR_f32_len32,   &arm_rfft_fast_sR_f32_len64,
+    &arm_rfft_fast_sR_f32_len128,  &arm_rfft_fast_sR_f32_len256,
+    &arm_rfft_fast_sR_f32_len512,  &arm_rfft_fast_sR_f32_len1024,
+    &arm_rfft_fast_sR_f32_len2048, &arm_rfft_fast_sR_f32_len4096
+};
+
+static const arm_rfft_instance_q31 * const const_rfft_q31_structs[CONST_RFFT_STRUCTS_LEN] =
+{
+    &arm_rfft_sR_q31_len32,   &arm_rfft_sR_q31_len64,   &arm_rfft_sR_q31_len128,
+    &arm_rfft_sR_q31_len256,  &arm_rfft_sR_q31_len512,  &arm_rfft_sR_q31_len1024,
+    &arm_rfft_sR_q31_len2048, &arm_rfft_sR_q31_len4096, &arm_rfft_sR_q31_len8192
+};
+
+static const arm_rfft_instance_q15 * const const_rfft_q15_structs[CONST_RFFT_STRUCTS_LEN] =
+{
+    &arm_rfft_sR_q15_len32,   &arm_rfft_sR_q15_len64,   &arm_rfft_sR_q15_len128,
+    &arm_rfft_sR_q15_len256,  &arm_rfft_sR_q15_len512,  &arm_rfft_sR_q15_len1024,
+    &arm_rfft_sR_q15_len2048, &arm_rfft_sR_q15_len4096, &arm_rfft_sR_q15_len8192
+};
+
+static const arm_rfft_instance_q7 * const const_rfft_q7_structs[CONST_RFFT_STRUCTS_LEN] =
+{
+    &arm_rfft_sR_q7_len32,   &arm_rfft_sR_q7_len64,   &arm_rfft_sR_q7_len128,
+    &arm_rfft_sR_q7_len256,  &arm_rfft_sR_q7_len512,  &arm_rfft_sR_q7_len1024,
+    &arm_rfft_sR_q7_len2048, &arm_rfft_sR_q7_len4096, &arm_rfft_sR_q7_len8192
+};
+
+/**
+ *  Fail the test if a field of a constant instance differs from the expected
+ *  value.
+ */
+#define CONST_STRUCTS_ASSERT_FIELD(fftlen, field, expected)               \
+    do                                                                  \
+    {                                                                   \
+        if ((field) != (expected))                                      \
+        {                                                               \
+            JTEST_DUMP_STRF("Length %d: %s mismatch\n",                 \
+                            (int)(fftlen), #field);                     \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+#define CONST_CFFT_DEFINE_TEST(suffix, output_type)                             \
+    JTEST_DEFINE_TEST(arm_cfft_const_structs_##suffix##_test,                   \
+                      arm_cfft_##suffix)                                        \
+    {                                                                           \
+        const arm_cfft_instance_##suffix * cfft_inst_ptr;                       \
+        uint32_t i;                                                             \
+                                                                                \
+        for (i = 0; i < CONST_CFFT_STRUCTS_LEN; i++)                            \
+        {                                                                       \
+            cfft_inst_ptr = const_cfft_##suffix##_structs[i];                   \
+                                                                                \
+            CONST_STRUCTS_ASSERT_FIELD(16U << i, cfft_inst_ptr->fftLen,         \
+                                       16U << i);                               \
+            CONST_STRUCTS_ASSERT_FIELD(16U << i,                                \
+                                       cfft_inst_ptr->pTwiddle == NULL, 0);     \
+            CONST_STRUCTS_ASSERT_FIELD(16U << i,                                \
+                                       cfft_inst_ptr->pBitRevTable == NULL, 0); \
+                                                                                \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                   \
+                transform_fft_##suffix##_inputs,                                \
+                cfft_inst_ptr->fftLen *                                         \
+                sizeof(output_type) *                                           \
+                2 /*complex_inputs*/);                                          \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n",                                 \
+                            (int)cfft_inst_ptr->fftLen);                        \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_##suffix(cfft_inst_ptr,                                \
+                                  (void *) transform_fft_inplace_input_fut,     \
+                                  0,                                            \
+                                  1));                                          \
+            ref_cfft_##suffix(cfft_inst_ptr,                                    \
+                              (void *) transform_fft_inplace_input_ref,         \
+                              0,                                                \
+                              1);                                               \
+                                                                                \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                              \
+                cfft_inst_ptr->fftLen,                                          \
+                output_type);                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+#define CONST_RFFT_DEFINE_TEST(suffix)                                          \
+    JTEST_DEFINE_TEST(arm_rfft_const_structs_##suffix##_test,                   \
+                      arm_rfft_init_##suffix)                                   \
+    {                                                                           \
+        const arm_rfft_instance_##suffix * rfft_inst_ptr;                       \
+        arm_rfft_instance_##suffix rfft_inst;                                   \
+        uint32_t fftlen;                                                        \
+        uint32_t i;                                                             \
+                                                                                \
+        for (i = 0; i < CONST_RFFT_STRUCTS_LEN; i++)                            \
+        {                                                                       \
+            rfft_inst_ptr = const_rfft_##suffix##_structs[i];                   \
+            fftlen = 32U << i;                                                  \
+                                                                                \
+            if (arm_rfft_init_##suffix(&rfft_inst, fftlen, 0U, 1U)              \
+                != ARM_MATH_SUCCESS)                                            \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->fftLenReal,       \
+                                       rfft_inst.fftLenReal);                   \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->ifftFlagR,        \
+                                       rfft_inst.ifftFlagR);                    \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->bitReverseFlagR,  \
+                                       rfft_inst.bitReverseFlagR);              \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->twidCoefRModifier, \
+                                       rfft_inst.twidCoefRModifier);            \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->pTwiddleAReal,    \
+                                       rfft_inst.pTwiddleAReal);                \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->pTwiddleBReal,    \
+                                       rfft_inst.pTwiddleBReal);                \
+            CONST_STRUCTS_ASSERT_FIELD(fftlen, rfft_inst_ptr->pCfft,            \
+                                       rfft_inst.pCfft);                        \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+JTEST_DEFINE_TEST( arm_rfft_fast_const_structs_f32_test,
+                   arm_rfft_fast_init_f32 )
+{
+    const arm_rfft_fast_instance_f32 *rfft_inst_ptr;
+    arm_rfft_fast_instance_f32 rfft_inst;
+    uint16_t fftlen;
+    uint32_t i;
+
+    for( i = 0; i < CONST_RFFT_FAST_STRUCTS_LEN; i++ )
+    {
+        rfft_inst_ptr = const_rfft_fast_f32_structs[i];
+        fftlen = ( uint16_t )( 32U << i );
+
+        if( arm_rfft_fast_init_f32( &rfft_inst, fftlen ) != ARM_MATH_SUCCESS )
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        CONST_STRUCTS_ASSERT_FIELD( fftlen, rfft_inst_ptr->fftLenRFFT,
+                                    rfft_inst.fftLenRFFT );
+        CONST_STRUCTS_ASSERT_FIELD( fftlen, rfft_inst_ptr->pTwiddleRFFT,
+                                    rfft_inst.pTwiddleRFFT );
+        CONST_STRUCTS_ASSERT_FIELD( fftlen, rfft_inst_ptr->Sint.fftLen,
+                                    rfft_inst.Sint.fftLen );
+        CONST_STRUCTS_ASSERT_FIELD( fftlen, rfft_inst_ptr->Sint.pTwiddle,
+                                    rfft_inst.Sint.pTwiddle );
+        CONST_STRUCTS_ASSERT_FIELD( fftlen, rfft_inst_ptr->Sint.pBitRevTable,
+                                    rfft_inst.Sint.pBitRevTable );
+        CONST_STRUCTS_ASSERT_FIELD( fftlen, rfft_inst_ptr->Sint.bitRevLength,
+                                    rfft_inst.Sint.bitRevLength );
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST( arm_cfft_const_structs_q7_test,
+                   arm_cfft_q7 )
+{
+    const arm_cfft_instance_q7 *cfft_inst_ptr;
+    uint32_t i;
+
+    for( i = 0; i < CONST_CFFT_STRUCTS_LEN; i++ )
+    {
+        cfft_inst_ptr = const_cfft_q7_structs[i];
+
+        CONST_STRUCTS_ASSERT_FIELD( 16U << i, cfft_inst_ptr->fftLen,
+                                    16U << i );
+        CONST_STRUCTS_ASSERT_FIELD( 16U << i, cfft_inst_ptr->pTwiddle,
+                                    const_cfft_q15_structs[i]->pTwiddle );
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+CONST_CFFT_DEFINE_TEST( f32, float32_t );
+CONST_CFFT_DEFINE_TEST( q31, q31_t );
+CONST_CFFT_DEFINE_TEST( q15, q15_t );
+CONST_RFFT_DEFINE_TEST( q31 );
+CONST_RFFT_DEFINE_TEST( q15 );
+CONST_RFFT_DEFINE_TEST( q7 );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( const_structs_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_cfft_const_structs_f32_test );
+    JTEST_TEST_CALL( arm_cfft_const_structs_q31_test );
+    JTEST_TEST_CALL( arm_cfft_const_structs_q15_test );
+    JTEST_TEST_CALL( arm_cfft_const_structs_q7_test );
+    JTEST_TEST_CALL( arm_rfft_fast_const_structs_f32_test );
+    JTEST_TEST_CALL( arm_rfft_const_structs_q31_test );
+    JTEST_TEST_CALL( arm_rfft_const_structs_q15_test );
+    JTEST_TEST_CALL( arm_rfft_const_structs_q7_test );
+}
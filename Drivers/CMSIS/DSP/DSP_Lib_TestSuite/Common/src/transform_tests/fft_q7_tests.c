@@ -0,0 +1,215 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "arm_const_structs.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+
+/*
+ * The Q7 block floating-point transforms are validated against the Q15
+ * transforms of the same input: the Q7 input is promoted to Q15 exactly, both
+ * outputs are converted to the unnormalized transform in floating point and
+ * compared by SNR. The cycle counts of the Q15 transforms are reported next to
+ * those of the Q7 transforms.
+ *
+ * The Q7 output carries about 7 bits, so the SNR thresholds are far below the
+ * ones of the wider types. Longer transforms lose a little more to the
+ * truncation of every stage.
+ */
+
+#define FFT_Q7_CFFT_LENS_LEN 9
+#define FFT_Q7_RFFT_LENS_LEN 8
+
+#define FFT_Q7_SNR_THRESHOLD 15
+
+static const arm_cfft_instance_q7 * const fft_q7_cfft_structs[FFT_Q7_CFFT_LENS_LEN] =
+{
+    &arm_cfft_sR_q7_len16,   &arm_cfft_sR_q7_len32,   &arm_cfft_sR_q7_len64,
+    &arm_cfft_sR_q7_len128,  &arm_cfft_sR_q7_len256,  &arm_cfft_sR_q7_len512,
+    &arm_cfft_sR_q7_len1024, &arm_cfft_sR_q7_len2048, &arm_cfft_sR_q7_len4096
+};
+
+static const arm_cfft_instance_q15 * const fft_q7_cfft_q15_structs[FFT_Q7_CFFT_LENS_LEN] =
+{
+    &arm_cfft_sR_q15_len16,   &arm_cfft_sR_q15_len32,   &arm_cfft_sR_q15_len64,
+    &arm_cfft_sR_q15_len128,  &arm_cfft_sR_q15_len256,  &arm_cfft_sR_q15_len512,
+    &arm_cfft_sR_q15_len1024, &arm_cfft_sR_q15_len2048, &arm_cfft_sR_q15_len4096
+};
+
+static const uint16_t fft_q7_rfft_lens[FFT_Q7_RFFT_LENS_LEN] =
+{
+    32, 64, 128, 256, 512, 1024, 2048, 4096
+};
+
+/* Q7 and Q15 working buffers */
+#define FFT_Q7_FUT_BUF ((q7_t *) transform_fft_input_fut)
+#define FFT_Q7_FUT_DST ((q7_t *) transform_fft_output_f32_fut)
+#define FFT_Q7_REF_BUF ((q15_t *) transform_fft_input_ref)
+#define FFT_Q7_REF_DST ((q15_t *) transform_fft_output_f32_ref)
+
+/**
+ *  Convert the Q7 input to Q7 and to the same values in Q15.
+ */
+static void fft_q7_prepare_inputs(
+    uint32_t len )
+{
+    arm_q15_to_q7( transform_fft_q15_inputs, FFT_Q7_FUT_BUF, len );
+    arm_q7_to_q15( FFT_Q7_FUT_BUF, FFT_Q7_REF_BUF, len );
+}
+
+/**
+ *  Turn a Q7 input into the first half of the spectrum of a real signal, in
+ *  both formats: the imaginary parts of DC and Nyquist are cleared.
+ */
+static void fft_q7_prepare_inverse_inputs(
+    uint32_t fftlen )
+{
+    fft_q7_prepare_inputs( fftlen + 2U );
+
+    FFT_Q7_FUT_BUF[1] = 0;
+    FFT_Q7_FUT_BUF[fftlen + 1U] = 0;
+    FFT_Q7_REF_BUF[1] = 0;
+    FFT_Q7_REF_BUF[fftlen + 1U] = 0;
+}
+
+/**
+ *  Convert the Q7 output with its block exponent and the Q15 output, which is
+ *  the transform divided by the length, to the unnormalized transform.
+ */
+static void fft_q7_convert_outputs(
+    const q7_t *pQ7,
+    int8_t blockExp,
+    const q15_t *pQ15,
+    uint32_t fftlen,
+    uint32_t len )
+{
+    arm_q7_to_float( ( q7_t * ) pQ7, transform_fft_output_fut, len );
+    arm_scale_f32( transform_fft_output_fut, ( float32_t )( 1UL << blockExp ),
+                   transform_fft_output_fut, len );
+
+    arm_q15_to_float( ( q15_t * ) pQ15, transform_fft_output_ref, len );
+    arm_scale_f32( transform_fft_output_ref, ( float32_t ) fftlen,
+                   transform_fft_output_ref, len );
+}
+
+#define FFT_Q7_CFFT_DEFINE_TEST(config_suffix, ifft_flag)                       \
+    JTEST_DEFINE_TEST(arm_cfft_q7_##config_suffix##_test,                       \
+                      arm_cfft_q7)                                              \
+    {                                                                           \
+        uint32_t i;                                                             \
+        uint32_t fftlen;                                                        \
+        int8_t blockExp;                                                        \
+                                                                                \
+        for (i = 0; i < FFT_Q7_CFFT_LENS_LEN; i++)                              \
+        {                                                                       \
+            fftlen = fft_q7_cfft_structs[i]->fftLen;                            \
+                                                                                \
+            fft_q7_prepare_inputs(2U * fftlen);                                 \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Inverse-transform flag: %d\n",                     \
+                            (int)fftlen,                                        \
+                            (int)ifft_flag);                                    \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_q7(fft_q7_cfft_structs[i], FFT_Q7_FUT_BUF,             \
+                            ifft_flag, 1, &blockExp));                          \
+                                                                                \
+            JTEST_DUMP_STR("Q15 for comparison\n");                             \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_q15(fft_q7_cfft_q15_structs[i], FFT_Q7_REF_BUF,        \
+                             ifft_flag, 1));                                    \
+                                                                                \
+            JTEST_DUMP_STRF("Block Exponent: %d\n", (int)blockExp);             \
+                                                                                \
+            fft_q7_convert_outputs(FFT_Q7_FUT_BUF, blockExp, FFT_Q7_REF_BUF,    \
+                                   fftlen, 2U * fftlen);                        \
+                                                                                \
+            TEST_ASSERT_SNR(transform_fft_output_ref,                           \
+                            transform_fft_output_fut,                           \
+                            2U * fftlen,                                        \
+                            FFT_Q7_SNR_THRESHOLD);                              \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+FFT_Q7_CFFT_DEFINE_TEST( forward, 0U );
+FFT_Q7_CFFT_DEFINE_TEST( inverse, 1U );
+
+#define FFT_Q7_RFFT_DEFINE_TEST(config_suffix, ifft_flag)                       \
+    JTEST_DEFINE_TEST(arm_rfft_q7_##config_suffix##_test,                       \
+                      arm_rfft_q7)                                              \
+    {                                                                           \
+        arm_rfft_instance_q7 rfft_inst_fut;                                     \
+        arm_rfft_instance_q15 rfft_inst_ref;                                    \
+        uint32_t i;                                                             \
+        uint32_t fftlen;                                                        \
+        int8_t blockExp;                                                        \
+                                                                                \
+        for (i = 0; i < FFT_Q7_RFFT_LENS_LEN; i++)                              \
+        {                                                                       \
+            fftlen = fft_q7_rfft_lens[i];                                       \
+                                                                                \
+            if ((arm_rfft_init_q7(&rfft_inst_fut, fftlen, ifft_flag, 1U)        \
+                 != ARM_MATH_SUCCESS) ||                                        \
+                (arm_rfft_init_q15(&rfft_inst_ref, fftlen, ifft_flag, 1U)       \
+                 != ARM_MATH_SUCCESS))                                          \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            if (ifft_flag)                                                      \
+            {                                                                   \
+                fft_q7_prepare_inverse_inputs(fftlen);                          \
+            }                                                                   \
+            else                                                                \
+            {                                                                   \
+                fft_q7_prepare_inputs(fftlen);                                  \
+            }                                                                   \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Inverse-transform flag: %d\n",                     \
+                            (int)fftlen,                                        \
+                            (int)ifft_flag);                                    \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_rfft_q7(&rfft_inst_fut, FFT_Q7_FUT_BUF, FFT_Q7_FUT_DST,     \
+                            &blockExp));                                        \
+                                                                                \
+            JTEST_DUMP_STR("Q15 for comparison\n");                             \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_rfft_q15(&rfft_inst_ref, FFT_Q7_REF_BUF, FFT_Q7_REF_DST));  \
+                                                                                \
+            JTEST_DUMP_STRF("Block Exponent: %d\n", (int)blockExp);             \
+                                                                                \
+            /* The forward transforms are compared up to Nyquist */             \
+            fft_q7_convert_outputs(FFT_Q7_FUT_DST, blockExp, FFT_Q7_REF_DST,    \
+                                   fftlen, fftlen + 2U * !(ifft_flag));         \
+                                                                                \
+            TEST_ASSERT_SNR(transform_fft_output_ref,                           \
+                            transform_fft_output_fut,                           \
+                            fftlen + 2U * !(ifft_flag),                         \
+                            FFT_Q7_SNR_THRESHOLD);                              \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+FFT_Q7_RFFT_DEFINE_TEST( forward, 0U );
+FFT_Q7_RFFT_DEFINE_TEST( inverse, 1U );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( fft_q7_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_cfft_q7_forward_test );
+    JTEST_TEST_CALL( arm_cfft_q7_inverse_test );
+    JTEST_TEST_CALL( arm_rfft_q7_forward_test );
+    JTEST_TEST_CALL( arm_rfft_q7_inverse_test );
+}
@@ -0,0 +1,391 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*
+ * The block mode tests compare the Goertzel bins against the same bins of the
+ * reference real FFT, for 1, 4 and 16 bins at N = 256 and N = 1024, and report
+ * the cycle counts of the Goertzel filter bank next to those of the full real
+ * FFT of the same type.
+ *
+ * The sliding mode tests feed a longer input in odd-sized blocks and compare
+ * the bins against a direct evaluation of the damped DFT over the last N
+ * samples.
+ *
+ * The Q15 coefficients place the bins close to DC too far off their nominal
+ * frequency for N = 1024, so the Q15 results are checked up to N = 256 only.
+ * The cycle counts are reported for both lengths.
+ */
+
+#define GOERTZEL_MAX_BINS 16
+#define GOERTZEL_FFTLENS_LEN 2
+#define GOERTZEL_NUM_BINS_LEN 3
+
+#define GOERTZEL_SNR_THRESHOLD_f32 60
+#define GOERTZEL_SNR_THRESHOLD_q31 95
+#define GOERTZEL_SNR_THRESHOLD_q15 30
+
+#define GOERTZEL_SNR_MAX_FFTLEN_q31 1024
+#define GOERTZEL_SNR_MAX_FFTLEN_q15 256
+
+#define GOERTZEL_SLIDING_LEN 256
+#define GOERTZEL_SLIDING_BINS 4
+#define GOERTZEL_SLIDING_INPUT_LEN 600
+#define GOERTZEL_SLIDING_BLOCK 37
+#define GOERTZEL_SLIDING_DAMPING 0.9999
+
+static const uint16_t goertzel_fftlens[GOERTZEL_FFTLENS_LEN] = {256, 1024};
+static const uint16_t goertzel_num_bins[GOERTZEL_NUM_BINS_LEN] = {1, 4, 16};
+
+static float32_t goertzel_freqs_f32[GOERTZEL_MAX_BINS];
+static q31_t goertzel_freqs_q31[GOERTZEL_MAX_BINS];
+static q15_t goertzel_freqs_q15[GOERTZEL_MAX_BINS];
+static float32_t goertzel_coeffs_f32[2 * GOERTZEL_MAX_BINS];
+static q31_t goertzel_coeffs_q31[2 * GOERTZEL_MAX_BINS];
+static q15_t goertzel_coeffs_q15[2 * GOERTZEL_MAX_BINS];
+static float32_t goertzel_state_f32[2 * GOERTZEL_MAX_BINS];
+static q31_t goertzel_state_q31[2 * GOERTZEL_MAX_BINS];
+
+static float32_t goertzel_delay_f32[GOERTZEL_SLIDING_LEN];
+static q31_t goertzel_delay_q31[GOERTZEL_SLIDING_LEN];
+static q15_t goertzel_delay_q15[GOERTZEL_SLIDING_LEN];
+
+static float32_t goertzel_out_f32[2 * GOERTZEL_MAX_BINS];
+static q31_t goertzel_out_q31[2 * GOERTZEL_MAX_BINS];
+static q15_t goertzel_out_q15[2 * GOERTZEL_MAX_BINS];
+static float32_t goertzel_ref_f32[2 * GOERTZEL_MAX_BINS];
+
+/**
+ *  DFT bin used for the i-th Goertzel bin: spread over the band, starting close
+ *  to DC.
+ */
+static uint32_t goertzel_bin(
+    uint32_t i,
+    uint32_t fftlen )
+{
+    return 3U + i * ( fftlen / 2U - 6U ) / GOERTZEL_MAX_BINS;
+}
+
+/**
+ *  Set the normalised frequencies k / N of the first num_bins bins in all
+ *  formats.
+ */
+static void goertzel_setup_freqs(
+    uint32_t num_bins,
+    uint32_t fftlen )
+{
+    uint32_t i;
+
+    for( i = 0; i < num_bins; i++ )
+    {
+        goertzel_freqs_f32[i] = ( float32_t ) goertzel_bin( i, fftlen ) / fftlen;
+    }
+
+    arm_float_to_q31( goertzel_freqs_f32, goertzel_freqs_q31, num_bins );
+    arm_float_to_q15( goertzel_freqs_f32, goertzel_freqs_q15, num_bins );
+}
+
+/**
+ *  Compute the reference real FFT of the floating-point copy of the input in
+ *  transform_fft_input_ref into transform_fft_output_ref.
+ */
+static void goertzel_reference_fft(
+    uint32_t fftlen )
+{
+    arm_rfft_fast_instance_f32 rfft_inst;
+
+    arm_rfft_fast_init_f32( &rfft_inst, fftlen );
+    ref_rfft_fast_f32( &rfft_inst, transform_fft_input_ref,
+                       transform_fft_output_ref, 0 );
+}
+
+/**
+ *  Gather the Goertzel bins from the reference real FFT.
+ */
+static void goertzel_gather_ref(
+    uint32_t num_bins,
+    uint32_t fftlen )
+{
+    uint32_t i, k;
+
+    for( i = 0; i < num_bins; i++ )
+    {
+        k = goertzel_bin( i, fftlen );
+        goertzel_ref_f32[2 * i] = transform_fft_output_ref[2 * k];
+        goertzel_ref_f32[2 * i + 1] = transform_fft_output_ref[2 * k + 1];
+    }
+}
+
+/**
+ *  Direct evaluation of the damped DFT over the last GOERTZEL_SLIDING_LEN
+ *  samples of pSrc, for the first GOERTZEL_SLIDING_BINS bins.
+ */
+static void goertzel_sliding_ref(
+    const float32_t *pSrc,
+    uint32_t len )
+{
+    uint32_t i, age;
+    float64_t w, weight, re, im;
+
+    for( i = 0; i < GOERTZEL_SLIDING_BINS; i++ )
+    {
+        w = 2.0 * PI * goertzel_bin( i, GOERTZEL_SLIDING_LEN ) / GOERTZEL_SLIDING_LEN;
+        weight = 1.0;
+        re = 0.0;
+        im = 0.0;
+
+        for( age = 0; age < GOERTZEL_SLIDING_LEN; age++ )
+        {
+            re += pSrc[len - 1 - age] * weight * cos( w * ( age + 1 ) );
+            im += pSrc[len - 1 - age] * weight * sin( w * ( age + 1 ) );
+            weight *= GOERTZEL_SLIDING_DAMPING;
+        }
+
+        goertzel_ref_f32[2 * i] = ( float32_t ) re;
+        goertzel_ref_f32[2 * i + 1] = ( float32_t ) im;
+    }
+}
+
+JTEST_DEFINE_TEST( arm_goertzel_f32_test, arm_goertzel_f32 )
+{
+    arm_goertzel_instance_f32 goertzel_inst;
+    arm_rfft_fast_instance_f32 rfft_inst;
+    uint32_t len_idx, bins_idx, fftlen, num_bins;
+
+    for( len_idx = 0; len_idx < GOERTZEL_FFTLENS_LEN; len_idx++ )
+    {
+        fftlen = goertzel_fftlens[len_idx];
+
+        memcpy( transform_fft_input_ref, transform_fft_f32_inputs,
+                fftlen * sizeof( float32_t ) );
+        memcpy( transform_fft_input_fut, transform_fft_f32_inputs,
+                fftlen * sizeof( float32_t ) );
+        goertzel_reference_fft( fftlen );
+
+        JTEST_DUMP_STRF( "Block Size: %d\n", ( int )fftlen );
+
+        /* Full real FFT for comparison */
+        arm_rfft_fast_init_f32( &rfft_inst, fftlen );
+        JTEST_COUNT_CYCLES(
+            arm_rfft_fast_f32( &rfft_inst, transform_fft_input_fut,
+                               transform_fft_output_fut, 0 ) );
+
+        for( bins_idx = 0; bins_idx < GOERTZEL_NUM_BINS_LEN; bins_idx++ )
+        {
+            num_bins = goertzel_num_bins[bins_idx];
+
+            goertzel_setup_freqs( num_bins, fftlen );
+            arm_goertzel_coeffs_f32( goertzel_freqs_f32, num_bins,
+                                     goertzel_coeffs_f32 );
+            arm_goertzel_init_f32( &goertzel_inst, num_bins,
+                                   goertzel_coeffs_f32, goertzel_state_f32 );
+
+            JTEST_DUMP_STRF( "Number of Bins: %d\n", ( int )num_bins );
+
+            JTEST_COUNT_CYCLES(
+                arm_goertzel_f32( &goertzel_inst, transform_fft_f32_inputs,
+                                  fftlen ) );
+
+            arm_goertzel_cmplx_f32( &goertzel_inst, goertzel_out_f32 );
+            goertzel_gather_ref( num_bins, fftlen );
+
+            TEST_ASSERT_SNR( goertzel_ref_f32, goertzel_out_f32, 2 * num_bins,
+                             GOERTZEL_SNR_THRESHOLD_f32 );
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+#define GOERTZEL_FIXED_DEFINE_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                         \
+                      arm_goertzel_##suffix)                                \
+    {                                                                       \
+        arm_goertzel_instance_##suffix goertzel_inst;                       \
+        arm_rfft_instance_##suffix rfft_inst;                               \
+        uint32_t len_idx, bins_idx, fftlen, num_bins, i;                    \
+        uint8_t shift;                                                      \
+                                                                            \
+        for (len_idx = 0; len_idx < GOERTZEL_FFTLENS_LEN; len_idx++)        \
+        {                                                                   \
+            fftlen = goertzel_fftlens[len_idx];                             \
+                                                                            \
+            /* Headroom for random input */                                 \
+            shift = 31U - __CLZ(fftlen) + 2U;                               \
+                                                                            \
+            arm_##suffix##_to_float(transform_fft_##suffix##_inputs,        \
+                                    transform_fft_input_ref, fftlen);       \
+            goertzel_reference_fft(fftlen);                                 \
+                                                                            \
+            JTEST_DUMP_STRF("Block Size: %d\n", (int)fftlen);               \
+                                                                            \
+            /* Full real FFT for comparison */                              \
+            memcpy(transform_fft_input_fut,                                 \
+                   transform_fft_##suffix##_inputs,                         \
+                   fftlen * sizeof(TYPE_FROM_ABBREV(suffix)));              \
+            arm_rfft_init_##suffix(&rfft_inst, fftlen, 0, 1);               \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_rfft_##suffix(                                          \
+                    &rfft_inst,                                             \
+                    (TYPE_FROM_ABBREV(suffix) *) transform_fft_input_fut,   \
+                    (TYPE_FROM_ABBREV(suffix) *) transform_fft_output_fut)); \
+                                                                            \
+            for (bins_idx = 0; bins_idx < GOERTZEL_NUM_BINS_LEN; bins_idx++) \
+            {                                                               \
+                num_bins = goertzel_num_bins[bins_idx];                     \
+                                                                            \
+                goertzel_setup_freqs(num_bins, fftlen);                     \
+                arm_goertzel_coeffs_##suffix(goertzel_freqs_##suffix,       \
+                                             num_bins,                      \
+                                             goertzel_coeffs_##suffix);     \
+                arm_goertzel_init_##suffix(&goertzel_inst, num_bins,        \
+                                           goertzel_coeffs_##suffix,        \
+                                           goertzel_state_q31, shift);      \
+                                                                            \
+                JTEST_DUMP_STRF("Number of Bins: %d\n", (int)num_bins);     \
+                                                                            \
+                JTEST_COUNT_CYCLES(                                         \
+                    arm_goertzel_##suffix(&goertzel_inst,                   \
+                                          transform_fft_##suffix##_inputs,  \
+                                          fftlen));                         \
+                                                                            \
+                arm_goertzel_cmplx_##suffix(&goertzel_inst,                 \
+                                            goertzel_out_##suffix);         \
+                arm_##suffix##_to_float(goertzel_out_##suffix,              \
+                                        goertzel_out_f32, 2 * num_bins);    \
+                                                                            \
+                for (i = 0; i < 2 * num_bins; i++)                          \
+                {                                                           \
+                    goertzel_out_f32[i] *= (float32_t) (1UL << shift);      \
+                }                                                           \
+                                                                            \
+                goertzel_gather_ref(num_bins, fftlen);                      \
+                                                                            \
+                if (fftlen <= GOERTZEL_SNR_MAX_FFTLEN_##suffix)             \
+                {                                                           \
+                    TEST_ASSERT_SNR(goertzel_ref_f32, goertzel_out_f32,     \
+                                    2 * num_bins,                           \
+                                    GOERTZEL_SNR_THRESHOLD_##suffix);       \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+GOERTZEL_FIXED_DEFINE_TEST( q31 );
+GOERTZEL_FIXED_DEFINE_TEST( q15 );
+
+JTEST_DEFINE_TEST( arm_goertzel_sliding_f32_test, arm_goertzel_sliding_f32 )
+{
+    arm_goertzel_instance_f32 goertzel_inst;
+    uint32_t done, block;
+
+    goertzel_setup_freqs( GOERTZEL_SLIDING_BINS, GOERTZEL_SLIDING_LEN );
+    arm_goertzel_coeffs_f32( goertzel_freqs_f32, GOERTZEL_SLIDING_BINS,
+                             goertzel_coeffs_f32 );
+    arm_goertzel_sliding_init_f32( &goertzel_inst, GOERTZEL_SLIDING_BINS,
+                                   goertzel_coeffs_f32, goertzel_state_f32,
+                                   GOERTZEL_SLIDING_LEN, goertzel_delay_f32,
+                                   ( float32_t ) GOERTZEL_SLIDING_DAMPING );
+
+    JTEST_DUMP_STRF( "Window Length: %d\n", ( int )GOERTZEL_SLIDING_LEN );
+
+    for( done = 0; done < GOERTZEL_SLIDING_INPUT_LEN; done += block )
+    {
+        block = GOERTZEL_SLIDING_INPUT_LEN - done;
+
+        if( block > GOERTZEL_SLIDING_BLOCK )
+        {
+            block = GOERTZEL_SLIDING_BLOCK;
+        }
+
+        arm_goertzel_sliding_f32( &goertzel_inst,
+                                  transform_fft_f32_inputs + done, block );
+    }
+
+    arm_goertzel_cmplx_f32( &goertzel_inst, goertzel_out_f32 );
+    goertzel_sliding_ref( transform_fft_f32_inputs, GOERTZEL_SLIDING_INPUT_LEN );
+
+    TEST_ASSERT_SNR( goertzel_ref_f32, goertzel_out_f32,
+                     2 * GOERTZEL_SLIDING_BINS, GOERTZEL_SNR_THRESHOLD_f32 );
+
+    return JTEST_TEST_PASSED;
+}
+
+#define GOERTZEL_SLIDING_FIXED_DEFINE_TEST(suffix)                          \
+    JTEST_DEFINE_TEST(arm_goertzel_sliding_##suffix##_test,                 \
+                      arm_goertzel_sliding_##suffix)                        \
+    {                                                                       \
+        arm_goertzel_instance_##suffix goertzel_inst;                       \
+        uint32_t done, block, i;                                            \
+        uint8_t shift = 31U - __CLZ(GOERTZEL_SLIDING_LEN) + 2U;             \
+                                                                            \
+        goertzel_setup_freqs(GOERTZEL_SLIDING_BINS, GOERTZEL_SLIDING_LEN);  \
+        arm_goertzel_coeffs_##suffix(goertzel_freqs_##suffix,               \
+                                     GOERTZEL_SLIDING_BINS,                 \
+                                     goertzel_coeffs_##suffix);             \
+        arm_goertzel_sliding_init_##suffix(                                 \
+            &goertzel_inst, GOERTZEL_SLIDING_BINS,                          \
+            goertzel_coeffs_##suffix, goertzel_state_q31,                   \
+            GOERTZEL_SLIDING_LEN, goertzel_delay_##suffix,                  \
+            (q31_t) (GOERTZEL_SLIDING_DAMPING * 2147483648.0), shift);      \
+                                                                            \
+        JTEST_DUMP_STRF("Window Length: %d\n", (int)GOERTZEL_SLIDING_LEN);  \
+                                                                            \
+        for (done = 0; done < GOERTZEL_SLIDING_INPUT_LEN; done += block)    \
+        {                                                                   \
+            block = GOERTZEL_SLIDING_INPUT_LEN - done;                      \
+                                                                            \
+            if (block > GOERTZEL_SLIDING_BLOCK)                             \
+            {                                                               \
+                block = GOERTZEL_SLIDING_BLOCK;                             \
+            }                                                               \
+                                                                            \
+            arm_goertzel_sliding_##suffix(                                  \
+                &goertzel_inst, transform_fft_##suffix##_inputs + done,     \
+                block);                                                     \
+        }                                                                   \
+                                                                            \
+        arm_goertzel_cmplx_##suffix(&goertzel_inst, goertzel_out_##suffix); \
+        arm_##suffix##_to_float(goertzel_out_##suffix, goertzel_out_f32,    \
+                                2 * GOERTZEL_SLIDING_BINS);                 \
+                                                                            \
+        for (i = 0; i < 2 * GOERTZEL_SLIDING_BINS; i++)                     \
+        {                                                                   \
+            goertzel_out_f32[i] *= (float32_t) (1UL << shift);              \
+        }                                                                   \
+                                                                            \
+        arm_##suffix##_to_float(transform_fft_##suffix##_inputs,            \
+                                transform_fft_input_ref,                    \
+                                GOERTZEL_SLIDING_INPUT_LEN);                \
+        goertzel_sliding_ref(transform_fft_input_ref,                       \
+                             GOERTZEL_SLIDING_INPUT_LEN);                   \
+                                                                            \
+        TEST_ASSERT_SNR(goertzel_ref_f32, goertzel_out_f32,                 \
+                        2 * GOERTZEL_SLIDING_BINS,                          \
+                        GOERTZEL_SNR_THRESHOLD_##suffix);                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+GOERTZEL_SLIDING_FIXED_DEFINE_TEST( q31 );
+GOERTZEL_SLIDING_FIXED_DEFINE_TEST( q15 );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( goertzel_tests )
+{
+    JTEST_TEST_CALL( arm_goertzel_f32_test );
+    JTEST_TEST_CALL( arm_goertzel_q31_test );
+    JTEST_TEST_CALL( arm_goertzel_q15_test );
+    JTEST_TEST_CALL( arm_goertzel_sliding_f32_test );
+    JTEST_TEST_CALL( arm_goertzel_sliding_q31_test );
+    JTEST_TEST_CALL( arm_goertzel_sliding_q15_test );
+}
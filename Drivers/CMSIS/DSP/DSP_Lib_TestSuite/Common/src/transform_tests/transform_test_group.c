@@ -5,7 +5,10 @@ JTEST_DEFINE_GROUP( transform_tests )
 {
     JTEST_GROUP_CALL( cfft_tests );
     JTEST_GROUP_CALL( cfft_family_tests );
+    JTEST_GROUP_CALL( const_structs_tests );
     JTEST_GROUP_CALL( rfft_tests );
     JTEST_GROUP_CALL( rfft_fast_tests );
     JTEST_GROUP_CALL( dct4_tests );
+    JTEST_GROUP_CALL( goertzel_tests );
+    JTEST_GROUP_CALL( fft_q7_tests );
 }
@@ -480,6 +480,20 @@ arm_status ref_sqrt_q31( q31_t in, q31_t *pOut );
 
 arm_status ref_sqrt_q15( q15_t in, q15_t *pOut );
 
+q31_t ref_atan2_q31( q31_t y, q31_t x );
+
+q15_t ref_atan2_q15( q15_t y, q15_t x );
+
+q31_t ref_exp_q31( q31_t x );
+
+arm_status ref_log_q31( q31_t in, q31_t *pOut );
+
+arm_status ref_reciprocal_q31( q31_t in, q31_t *pOut, uint8_t *pShift );
+
+arm_status ref_reciprocal_q15( q15_t in, q15_t *pOut, uint8_t *pShift );
+
+arm_status ref_rsqrt_q31( q31_t in, q31_t *pOut, uint8_t *pShift );
+
 /*
  * Filtering Functions
  */
@@ -911,6 +925,78 @@ void ref_lms_norm_q15(
     q15_t *pErr,
     uint32_t blockSize );
 
+void ref_lms_block_f32(
+    const arm_lms_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_block_q31(
+    const arm_lms_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_block_q15(
+    const arm_lms_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_norm_block_f32(
+    arm_lms_norm_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_norm_block_q31(
+    arm_lms_norm_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_norm_block_q15(
+    arm_lms_norm_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_partial_f32(
+    arm_lms_partial_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_partial_q31(
+    arm_lms_partial_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize );
+
+void ref_lms_partial_q15(
+    arm_lms_partial_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize );
+
 void ref_fir_interpolate_f32(
     const arm_fir_interpolate_instance_f32 *S,
     float32_t *pSrc,
@@ -0,0 +1,11 @@
+#include "ref.h"
+
+q31_t ref_atan2_q31( q31_t y, q31_t x )
+{
+    return ( q31_t )( atan2f( ( float32_t )y, ( float32_t )x ) * 536870912.0f );
+}
+
+q15_t ref_atan2_q15( q15_t y, q15_t x )
+{
+    return ( q15_t )( atan2f( ( float32_t )y, ( float32_t )x ) * 8192.0f );
+}
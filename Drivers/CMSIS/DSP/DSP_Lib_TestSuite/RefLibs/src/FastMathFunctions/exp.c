@@ -0,0 +1,8 @@
+#include "ref.h"
+
+q31_t ref_exp_q31( q31_t x )
+{
+    float32_t out = expf( ( float32_t )x / 67108864.0f ) * 2147483648.0f;
+
+    return ( out >= 2147483648.0f ) ? 0x7FFFFFFF : ( q31_t )out;
+}
@@ -0,0 +1,14 @@
+#include "ref.h"
+
+arm_status ref_log_q31( q31_t in, q31_t *pOut )
+{
+    if( in <= 0 )
+    {
+        *pOut = ( q31_t )0x80000000;
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    *pOut = ( q31_t )( logf( ( float32_t )in / 2147483648.0f ) * 67108864.0f );
+
+    return ARM_MATH_SUCCESS;
+}
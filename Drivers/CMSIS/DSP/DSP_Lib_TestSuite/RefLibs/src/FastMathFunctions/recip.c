@@ -0,0 +1,54 @@
+#include "ref.h"
+
+/*
+ * Split v into a mantissa in (0.5 1] and a left shift.
+ */
+static float32_t ref_mant_shift( float32_t v, uint8_t *pShift )
+{
+    int exp;
+    float32_t mant = frexpf( v, &exp );
+
+    if( fabsf( mant ) == 0.5f )
+    {
+        mant *= 2.0f;
+        exp--;
+    }
+
+    *pShift = ( uint8_t )exp;
+
+    return mant;
+}
+
+arm_status ref_reciprocal_q31( q31_t in, q31_t *pOut, uint8_t *pShift )
+{
+    float32_t mant;
+
+    if( in == 0 )
+    {
+        *pOut = 0x7FFFFFFF;
+        *pShift = 31;
+        return ARM_MATH_NANINF;
+    }
+
+    mant = ref_mant_shift( 2147483648.0f / ( float32_t )in, pShift );
+    *pOut = ( mant >= 1.0f ) ? 0x7FFFFFFF : ( q31_t )( mant * 2147483648.0f );
+
+    return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_reciprocal_q15( q15_t in, q15_t *pOut, uint8_t *pShift )
+{
+    float32_t mant;
+
+    if( in == 0 )
+    {
+        *pOut = 0x7FFF;
+        *pShift = 15;
+        return ARM_MATH_NANINF;
+    }
+
+    mant = ref_mant_shift( 32768.0f / ( float32_t )in, pShift );
+    *pOut = ( mant >= 1.0f ) ? 0x7FFF : ( q15_t )( mant * 32768.0f );
+
+    return ARM_MATH_SUCCESS;
+}
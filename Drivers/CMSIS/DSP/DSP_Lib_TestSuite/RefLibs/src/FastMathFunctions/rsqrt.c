@@ -0,0 +1,28 @@
+#include "ref.h"
+
+arm_status ref_rsqrt_q31( q31_t in, q31_t *pOut, uint8_t *pShift )
+{
+    int exp;
+    float32_t mant;
+
+    if( in <= 0 )
+    {
+        *pOut = ( in == 0 ) ? 0x7FFFFFFF : 0;
+        *pShift = ( in == 0 ) ? 16 : 0;
+        return ( in == 0 ) ? ARM_MATH_NANINF : ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Split 1/sqrt(in) into a mantissa in (0.5 1] and a left shift */
+    mant = frexpf( 1.0f / sqrtf( ( float32_t )in / 2147483648.0f ), &exp );
+
+    if( mant == 0.5f )
+    {
+        mant = 1.0f;
+        exp--;
+    }
+
+    *pOut = ( mant >= 1.0f ) ? 0x7FFFFFFF : ( q31_t )( mant * 2147483648.0f );
+    *pShift = ( uint8_t )exp;
+
+    return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,495 @@
+#include "ref.h"
+
+/*
+ * Block LMS: the block is filtered with fixed coefficients, then each
+ * coefficient is updated once with the gradient of the block.
+ */
+
+void ref_lms_block_f32(
+    const arm_lms_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, n;
+    float32_t sum;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+    }
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        sum = 0.0f;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            sum += pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = sum;
+        pErr[n] = pRef[n] - sum;
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        sum = 0.0f;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            sum += pErr[n] * pState[n + i];
+        }
+
+        pCoeffs[i] += S->mu * sum;
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+void ref_lms_block_q31(
+    const arm_lms_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;
+    q31_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, n;
+    q63_t acc;
+    q31_t alpha;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+    }
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        acc = 0;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            acc += ( q63_t )pState[n + i] * pCoeffs[i];
+        }
+
+        /* 2.62 to 1.31 with postShift, wrapping like the LMS filter */
+        pOut[n] = ( q31_t )( acc >> ( 31 - S->postShift ) );
+        pErr[n] = pRef[n] - pOut[n];
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        acc = 0;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            alpha = ( q31_t )( ( ( q63_t )pErr[n] * S->mu ) >> 31 );
+            acc += ( q63_t )alpha * pState[n + i];
+        }
+
+        pCoeffs[i] = ref_sat_q31( ( q63_t )pCoeffs[i] + ( acc >> 31 ) );
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+void ref_lms_block_q15(
+    const arm_lms_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState;
+    q15_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, n;
+    q63_t acc;
+    q15_t alpha;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+    }
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        acc = 0;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            acc += ( q31_t )pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = ref_sat_q15( ( q31_t )( acc >> ( 15 - S->postShift ) ) );
+        pErr[n] = ( q15_t )( pRef[n] - pOut[n] );
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        acc = 0;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            alpha = ( q15_t )( ( ( q31_t )pErr[n] * S->mu ) >> 15 );
+            acc += ( q31_t )alpha * pState[n + i];
+        }
+
+        pCoeffs[i] = ref_sat_q15( ref_sat_q31( ( q63_t )pCoeffs[i] + ( acc >> 15 ) ) );
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/*
+ * Block normalized LMS: as the block LMS, with mu divided by the mean energy
+ * of the state window over the block.
+ */
+
+void ref_lms_norm_block_f32(
+    arm_lms_norm_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, n;
+    float32_t sum, energySum = 0.0f, w;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+    }
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        S->energy -= S->x0 * S->x0;
+        S->energy += pSrc[n] * pSrc[n];
+        energySum += S->energy;
+        S->x0 = pState[n];
+    }
+
+    w = S->mu / ( energySum / blockSize + 0.000000119209289f );
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        sum = 0.0f;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            sum += pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = sum;
+        pErr[n] = pRef[n] - sum;
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        sum = 0.0f;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            sum += pErr[n] * pState[n + i];
+        }
+
+        pCoeffs[i] += w * sum;
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+void ref_lms_norm_block_q31(
+    arm_lms_norm_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;
+    q31_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, n;
+    q63_t acc, energySum = 0;
+    q31_t alpha, meanEnergy;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+    }
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        S->energy = ( q31_t )( ( ( ( q63_t )S->energy << 32 ) - ( ( ( q63_t )S->x0 * S->x0 ) << 1 ) ) >> 32 );
+        S->energy = ( q31_t )( ( ( ( ( q63_t )pSrc[n] * pSrc[n] ) << 1 ) + ( ( q63_t )S->energy << 32 ) ) >> 32 );
+        energySum += S->energy;
+        S->x0 = pState[n];
+    }
+
+    meanEnergy = ( q31_t )( energySum / ( q63_t )blockSize );
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        acc = 0;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            acc += ( q63_t )pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = ( q31_t )( acc >> ( 31 - S->postShift ) );
+        pErr[n] = pRef[n] - pOut[n];
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        acc = 0;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            alpha = ref_sat_q31( ( ( q63_t )pErr[n] * S->mu ) / ( meanEnergy + DELTA_Q31 ) );
+            acc += ( q63_t )alpha * pState[n + i];
+        }
+
+        pCoeffs[i] = ref_sat_q31( ( q63_t )pCoeffs[i] + ( acc >> 31 ) );
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+void ref_lms_norm_block_q15(
+    arm_lms_norm_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState;
+    q15_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, n;
+    q63_t acc, energySum = 0;
+    q31_t energy = S->energy;
+    q15_t alpha, meanEnergy;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+    }
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        energy -= ( ( q31_t )S->x0 * S->x0 ) >> 15;
+        energy += ( ( q31_t )pSrc[n] * pSrc[n] ) >> 15;
+        energySum += energy;
+        S->x0 = pState[n];
+    }
+
+    S->energy = ( q15_t )energy;
+    meanEnergy = ( q15_t )( energySum / ( q63_t )blockSize );
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        acc = 0;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            acc += ( q31_t )pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = ref_sat_q15( ( q31_t )( acc >> ( 15 - S->postShift ) ) );
+        pErr[n] = ( q15_t )( pRef[n] - pOut[n] );
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        acc = 0;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            alpha = ref_sat_q15( ( ( q31_t )pErr[n] * S->mu ) / ( meanEnergy + DELTA_Q15 ) );
+            acc += ( q31_t )alpha * pState[n + i];
+        }
+
+        pCoeffs[i] = ref_sat_q15( ref_sat_q31( ( q63_t )pCoeffs[i] + ( acc >> 15 ) ) );
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/*
+ * Partial-update LMS: the full output is computed for every sample, then
+ * numUpdate coefficients starting at updateIndex are updated.
+ */
+
+void ref_lms_partial_f32(
+    arm_lms_partial_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, k, n;
+    float32_t sum, w;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+
+        sum = 0.0f;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            sum += pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = sum;
+        pErr[n] = pRef[n] - sum;
+
+        w = pErr[n] * S->mu;
+
+        for( k = 0; k < S->numUpdate; k++ )
+        {
+            i = ( S->updateIndex + k ) % numTaps;
+            pCoeffs[i] += w * pState[n + i];
+        }
+
+        S->updateIndex = ( S->updateIndex + S->numUpdate ) % numTaps;
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+void ref_lms_partial_q31(
+    arm_lms_partial_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;
+    q31_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, k, n;
+    q63_t acc;
+    q31_t alpha, coef;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+
+        acc = 0;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            acc += ( q63_t )pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = ( q31_t )( acc >> ( 31 - S->postShift ) );
+        pErr[n] = pRef[n] - pOut[n];
+
+        alpha = ( q31_t )( ( ( q63_t )pErr[n] * S->mu ) >> 31 );
+
+        for( k = 0; k < S->numUpdate; k++ )
+        {
+            i = ( S->updateIndex + k ) % numTaps;
+            coef = ( q31_t )( ( ( q63_t )alpha * pState[n + i] ) >> 32 );
+            pCoeffs[i] = ref_sat_q31( ( q63_t )pCoeffs[i] + ( coef << 1 ) );
+        }
+
+        S->updateIndex = ( S->updateIndex + S->numUpdate ) % numTaps;
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+void ref_lms_partial_q15(
+    arm_lms_partial_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState;
+    q15_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t i, k, n;
+    q63_t acc;
+    q15_t alpha;
+
+    for( n = 0; n < blockSize; n++ )
+    {
+        pState[numTaps - 1U + n] = pSrc[n];
+
+        acc = 0;
+
+        for( i = 0; i < numTaps; i++ )
+        {
+            acc += ( q31_t )pState[n + i] * pCoeffs[i];
+        }
+
+        pOut[n] = ref_sat_q15( ( q31_t )( acc >> ( 15 - S->postShift ) ) );
+        pErr[n] = ( q15_t )( pRef[n] - pOut[n] );
+
+        alpha = ( q15_t )( ( ( q31_t )pErr[n] * S->mu ) >> 15 );
+
+        for( k = 0; k < S->numUpdate; k++ )
+        {
+            i = ( S->updateIndex + k ) % numTaps;
+            pCoeffs[i] = ref_sat_q15( pCoeffs[i] + ( ( ( q31_t )alpha * pState[n + i] ) >> 15 ) );
+        }
+
+        S->updateIndex = ( S->updateIndex + S->numUpdate ) % numTaps;
+    }
+
+    for( i = 0; i < numTaps - 1; i++ )
+    {
+        pState[i] = pState[blockSize + i];
+    }
+}
@@ -0,0 +1,324 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2026 ARM Limited. All rights reserved.
+*
+* $Date:         18. October 2026
+* $Revision:     V1.5.1
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_lms_benchmark_example_f32.c
+*
+* Description:   Example code comparing the cost and convergence of the
+*                LMS filter variants.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup LmsBenchmark LMS Filter Benchmark Example
+ *
+ * \par Description:
+ * \par
+ * Compares the cost per frame and the convergence speed of the LMS filter
+ * variants on the system identification problem of the
+ * \ref SignalConvergence "Signal Convergence Example".
+ *
+ * \par Algorithm:
+ * \par
+ * White noise is passed through an FIR lowpass filter and each adaptive filter
+ * learns its transfer function, starting from the same initial coefficients.
+ * For every variant the example records:
+ * - the SysTick cycles spent in the adaptive filter for one frame of
+ *   \c BLOCKSIZE samples, averaged over all frames;
+ * - the first frame in which the error power is more than 40 dB below the
+ *   power of the reference signal.
+ * \par
+ * The variants are the sample-by-sample LMS and normalized LMS filters, the
+ * block LMS and block normalized LMS filters, which update the coefficients
+ * once per frame, and the partial-update LMS filter, which updates a quarter
+ * of the coefficients per sample with a larger step size. The step sizes are
+ * chosen so that every variant converges on this data. The results are left in \c lmsResults for
+ * inspection in the debugger.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c testInput_f32 points to the input data
+ * \li \c FIRCoeff_f32 points to the coefficients of the lowpass filter to be learnt
+ * \li \c lmsNormCoeff_f32 points to the initial coefficients of the adaptive filters
+ * \li \c lmsCoeff_f32 points to the coefficients of the adaptive filter under test
+ * \li \c lmsResults holds the cycles per frame and the convergence frame of each variant
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_init_f32()
+ * - arm_fir_f32()
+ * - arm_lms_init_f32()
+ * - arm_lms_f32()
+ * - arm_lms_norm_init_f32()
+ * - arm_lms_norm_f32()
+ * - arm_lms_block_f32()
+ * - arm_lms_norm_block_f32()
+ * - arm_lms_partial_init_f32()
+ * - arm_lms_partial_f32()
+ * - arm_power_f32()
+ * - arm_copy_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_lms_benchmark_example_f32.c \endlink
+ *
+ */
+
+
+/** \example arm_lms_benchmark_example_f32.c
+  */
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "arm_math.h"
+
+/* ----------------------------------------------------------------------
+** Global defines for the benchmark
+* ------------------------------------------------------------------- */
+
+#define TEST_LENGTH_SAMPLES 1536
+#define NUMTAPS               32
+#define BLOCKSIZE             32
+#define MU_NORM             0.5f
+#define MU_LMS              0.01f
+#define MU_PARTIAL          0.03f
+#define NUMUPDATE           (NUMTAPS / 4)
+#define CONVERGED_RATIO     0.0001f         /* -40 dB */
+
+#define NUMFRAMES (TEST_LENGTH_SAMPLES / BLOCKSIZE)
+
+/* ----------------------------------------------------------------------
+* Variants under test
+* ------------------------------------------------------------------- */
+
+typedef enum
+{
+    LMS_VARIANT_NORM = 0,
+    LMS_VARIANT_LMS,
+    LMS_VARIANT_BLOCK,
+    LMS_VARIANT_NORM_BLOCK,
+    LMS_VARIANT_PARTIAL,
+    LMS_VARIANT_COUNT
+} lms_variant;
+
+typedef struct
+{
+    uint32_t cyclesPerFrame;      /**< average SysTick cycles per frame */
+    uint32_t convergedFrame;      /**< first converged frame, NUMFRAMES if none */
+} lms_result;
+
+lms_result lmsResults[LMS_VARIANT_COUNT];
+
+/* ----------------------------------------------------------------------
+* Declare filter state buffers and structures
+* ------------------------------------------------------------------- */
+
+float32_t firStateF32[NUMTAPS + BLOCKSIZE];
+arm_fir_instance_f32 LPF_instance;
+
+float32_t lmsStateF32[NUMTAPS + BLOCKSIZE];
+float32_t lmsCoeff_f32[NUMTAPS];
+arm_lms_instance_f32 lms_instance;
+arm_lms_norm_instance_f32 lmsNorm_instance;
+arm_lms_partial_instance_f32 lmsPartial_instance;
+
+/* ----------------------------------------------------------------------
+* External Declarations for the test data
+* ------------------------------------------------------------------- */
+extern float32_t testInput_f32[TEST_LENGTH_SAMPLES];
+extern float32_t lmsNormCoeff_f32[32];
+extern const float32_t FIRCoeff_f32[32];
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+
+float32_t wire1[BLOCKSIZE];
+float32_t wire2[BLOCKSIZE];
+float32_t wire3[BLOCKSIZE];
+float32_t err_signal[BLOCKSIZE];
+
+/* ----------------------------------------------------------------------
+* Internal functions
+* ------------------------------------------------------------------- */
+
+void init_variant( lms_variant variant );
+
+void run_variant( lms_variant variant );
+
+void benchmark_variant( lms_variant variant,
+                        lms_result *result );
+
+/* ----------------------------------------------------------------------
+* Initialize the filter of a variant from the initial coefficients
+* ------------------------------------------------------------------- */
+
+void init_variant( lms_variant variant )
+{
+    arm_copy_f32( lmsNormCoeff_f32, lmsCoeff_f32, NUMTAPS );
+
+    switch( variant )
+    {
+        case LMS_VARIANT_NORM:
+        case LMS_VARIANT_NORM_BLOCK:
+            arm_lms_norm_init_f32( &lmsNorm_instance, NUMTAPS, lmsCoeff_f32, lmsStateF32, MU_NORM, BLOCKSIZE );
+            break;
+
+        case LMS_VARIANT_LMS:
+        case LMS_VARIANT_BLOCK:
+            arm_lms_init_f32( &lms_instance, NUMTAPS, lmsCoeff_f32, lmsStateF32, MU_LMS, BLOCKSIZE );
+            break;
+
+        default:
+            arm_lms_partial_init_f32( &lmsPartial_instance, NUMTAPS, lmsCoeff_f32, lmsStateF32, MU_PARTIAL, BLOCKSIZE, NUMUPDATE );
+            break;
+    }
+}
+
+/* ----------------------------------------------------------------------
+* Run the filter of a variant on one frame
+* ------------------------------------------------------------------- */
+
+void run_variant( lms_variant variant )
+{
+    switch( variant )
+    {
+        case LMS_VARIANT_NORM:
+            arm_lms_norm_f32( &lmsNorm_instance, wire1, wire2, wire3, err_signal, BLOCKSIZE );
+            break;
+
+        case LMS_VARIANT_LMS:
+            arm_lms_f32( &lms_instance, wire1, wire2, wire3, err_signal, BLOCKSIZE );
+            break;
+
+        case LMS_VARIANT_BLOCK:
+            arm_lms_block_f32( &lms_instance, wire1, wire2, wire3, err_signal, BLOCKSIZE );
+            break;
+
+        case LMS_VARIANT_NORM_BLOCK:
+            arm_lms_norm_block_f32( &lmsNorm_instance, wire1, wire2, wire3, err_signal, BLOCKSIZE );
+            break;
+
+        default:
+            arm_lms_partial_f32( &lmsPartial_instance, wire1, wire2, wire3, err_signal, BLOCKSIZE );
+            break;
+    }
+}
+
+/* ----------------------------------------------------------------------
+* Measure the cost and the convergence of a variant
+* ------------------------------------------------------------------- */
+
+void benchmark_variant( lms_variant variant,
+                        lms_result *result )
+{
+    uint32_t i;
+    uint32_t start, cycles = 0;
+    float32_t refPower, errPower;
+
+    init_variant( variant );
+
+    /* Restart the lowpass filter so that every variant sees the same reference */
+    arm_fir_init_f32( &LPF_instance, NUMTAPS, ( float32_t * )FIRCoeff_f32, firStateF32, BLOCKSIZE );
+
+    result->convergedFrame = NUMFRAMES;
+
+    for( i = 0; i < NUMFRAMES; i++ )
+    {
+        /* Read the input data - random noise - into wire1 */
+        arm_copy_f32( testInput_f32 + ( i * BLOCKSIZE ), wire1, BLOCKSIZE );
+
+        /* Execute the FIR processing function.  Input wire1 and output wire2 */
+        arm_fir_f32( &LPF_instance, wire1, wire2, BLOCKSIZE );
+
+        /* Time the adaptive filter only. SysTick counts down. */
+        start = SysTick->VAL;
+        run_variant( variant );
+        cycles += ( start - SysTick->VAL ) & SysTick_LOAD_RELOAD_Msk;
+
+        /* Compare the error power with the reference power */
+        arm_power_f32( wire2, BLOCKSIZE, &refPower );
+        arm_power_f32( err_signal, BLOCKSIZE, &errPower );
+
+        if( ( result->convergedFrame == NUMFRAMES ) && ( errPower < ( refPower * CONVERGED_RATIO ) ) )
+        {
+            result->convergedFrame = i;
+        }
+    }
+
+    result->cyclesPerFrame = cycles / NUMFRAMES;
+}
+
+/* ----------------------------------------------------------------------
+* LMS benchmark
+* ------------------------------------------------------------------- */
+
+int32_t main( void )
+{
+    uint32_t i;
+    arm_status status;
+
+    /* Free running SysTick, no interrupt */
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0U;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < LMS_VARIANT_COUNT; i++ )
+    {
+        benchmark_variant( ( lms_variant )i, &lmsResults[i] );
+
+        if( lmsResults[i].convergedFrame == NUMFRAMES )
+        {
+            status = ARM_MATH_TEST_FAILURE;
+        }
+    }
+
+    /* ----------------------------------------------------------------------
+    * Loop here if a variant did not converge.
+    * This denotes a test failure
+    * ------------------------------------------------------------------- */
+
+    if( status != ARM_MATH_SUCCESS )
+    {
+        while( 1 );
+    }
+
+    while( 1 );                            /* main function does not return */
+}
+
+/** \endlink */
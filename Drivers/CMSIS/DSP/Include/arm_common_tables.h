@@ -31,6 +31,34 @@
 
 #include "arm_math.h"
 
+/*
+ * FFT table selection.
+ *
+ * By default every FFT twiddle and bit reversal table is built, together with
+ * every constant instance in arm_const_structs.c. When ARM_DSP_CONFIG_TABLES is
+ * defined only the tables selected with the ARM_TABLE_* macros below are built;
+ * constant instances and init function cases whose tables are missing are
+ * left out as well. ARM_ALL_FFT_TABLES selects every table again.
+ *
+ * ARM_TABLE_TWIDDLECOEF_F32_<N>      twiddleCoef_<N>                (N = 16 .. 4096)
+ * ARM_TABLE_TWIDDLECOEF_Q31_<N>      twiddleCoef_<N>_q31            (N = 16 .. 4096)
+ * ARM_TABLE_TWIDDLECOEF_Q15_<N>      twiddleCoef_<N>_q15            (N = 16 .. 4096)
+ * ARM_TABLE_BITREVIDX_FLT_<N>        armBitRevIndexTable<N>         (N = 16 .. 4096)
+ * ARM_TABLE_BITREVIDX_FXT_<N>        armBitRevIndexTable_fixed_<N>  (N = 16 .. 4096)
+ * ARM_TABLE_TWIDDLECOEF_RFFT_F32_<N> twiddleCoef_rfft_<N>           (N = 32 .. 4096)
+ * ARM_TABLE_BITREV_1024              armBitRevTable
+ * ARM_TABLE_REALCOEF_Q31             realCoefAQ31, realCoefBQ31
+ * ARM_TABLE_REALCOEF_Q15             realCoefAQ15, realCoefBQ15
+ *
+ * The radix-2 and radix-4 init functions need the 4096-point twiddle table of
+ * their type and ARM_TABLE_BITREV_1024. DSP/Scripts/fft_tables.py derives the
+ * macro list from the transforms an application uses and reports the size of
+ * the selected tables.
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) && !defined(ARM_ALL_FFT_TABLES)
+#define ARM_ALL_FFT_TABLES
+#endif
+
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
@@ -118,4 +146,11 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Tables for Fast Math arctangent, logarithm, exponential and inverse square root */
+extern const q31_t atanTable_q31[33];
+extern const q15_t atanTable_q15[33];
+extern const q31_t logTable_q31[64];
+extern const q31_t exp2Table_q31[64];
+extern const q31_t rsqrtTable_q31[48];
+
 #endif /*  ARM_COMMON_TABLES_H */
@@ -63,4 +63,53 @@ extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024;
 extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048;
 extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096;
 
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len16;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len32;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len64;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len128;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len256;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len512;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len1024;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len2048;
+extern const arm_cfft_instance_q7 arm_cfft_sR_q7_len4096;
+
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len32;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len64;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len128;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len256;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len512;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len1024;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len2048;
+extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len4096;
+
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len32;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len64;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len128;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len256;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len512;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len1024;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len2048;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len4096;
+extern const arm_rfft_instance_q31 arm_rfft_sR_q31_len8192;
+
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len32;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len64;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len128;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len256;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len512;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len1024;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len2048;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len4096;
+extern const arm_rfft_instance_q15 arm_rfft_sR_q15_len8192;
+
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len32;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len64;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len128;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len256;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len512;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len1024;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len2048;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len4096;
+extern const arm_rfft_instance_q7 arm_rfft_sR_q7_len8192;
+
 #endif
@@ -120,6 +120,17 @@
    *
    * Define macro ARM_MATH_ROUNDING for rounding on support functions
    *
+   * - ARM_MATH_SMALL_MATRIX_DISABLE:
+   *
+   * Define macro ARM_MATH_SMALL_MATRIX_DISABLE to stop the matrix multiplication and transpose functions
+   * from using the unrolled 2x2, 3x3, 4x4 and 6x6 kernels, which saves code size
+   *
+   * - ARM_DSP_CONFIG_TABLES:
+   *
+   * Define macro ARM_DSP_CONFIG_TABLES to build only the FFT twiddle and bit reversal tables selected with the
+   * ARM_TABLE_* macros listed in arm_common_tables.h. Scripts/fft_tables.py derives the macros from the transforms used
+   * and reports the table sizes. ARM_ALL_FFT_TABLES builds every table again.
+   *
    * - ARM_MATH_CMx:
    *
    * Define macro ARM_MATH_CM4 for building the library on Cortex-M4 target, ARM_MATH_CM3 for building library on Cortex-M3 target
@@ -174,6 +185,10 @@
  * operate on individual values and not arrays.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
+ * The fixed-point arctangent, exponential, logarithm, reciprocal and inverse square root
+ * functions use only integer operations, so they avoid the software floating-point
+ * library on cores without an FPU.
+ *
  */
 
 /**
@@ -404,7 +419,8 @@ typedef enum
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix does not have the required properties. */
 } arm_status;
 
 /**
@@ -513,6 +529,19 @@ typedef double float64_t;
 
 #endif
 
+/**
+* @brief definition to extract the n-th 8 bit value, in memory order, of a word read with _SIMD32_OFFSET.
+*/
+#ifndef ARM_MATH_BIG_ENDIAN
+
+#define __UNPACKq7(x, n)      ( (q7_t) ((x) >> (8 * (n))) )
+
+#else
+
+#define __UNPACKq7(x, n)      ( (q7_t) ((x) >> (24 - 8 * (n))) )
+
+#endif
+
 
 /**
  * @brief Clips Q63 to Q31 values.
@@ -1344,6 +1373,95 @@ void arm_biquad_cascade_df1_init_f32(
     float32_t *pState );
 
 
+/**
+ * @brief Instance structure for the multichannel Q15 Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;    /**< number of interleaved channels sharing the coefficients. */
+    q15_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q15_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;        /**< Additional shift, in bits, applied to each output sample. */
+} arm_biquad_cascade_multi_df1_instance_q15;
+
+/**
+ * @brief Instance structure for the multichannel Q31 Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;    /**< number of interleaved channels sharing the coefficients. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+} arm_biquad_cascade_multi_df1_instance_q31;
+
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter. N interleaved channels
+ * @param[in]  S          points to an instance of the multichannel Q15 Biquad cascade structure.
+ * @param[in]  pSrc       points to the block of interleaved input data.
+ * @param[out] pDst       points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples per channel to process.
+ */
+void arm_biquad_cascade_multi_df1_q15(
+    const arm_biquad_cascade_multi_df1_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the multichannel Q15 Biquad cascade filter.
+ * @param[in,out] S            points to an instance of the multichannel Q15 Biquad cascade structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     numChannels  number of interleaved channels.
+ * @param[in]     pCoeffs      points to the filter coefficients.
+ * @param[in]     pState       points to the state buffer.
+ * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+ */
+void arm_biquad_cascade_multi_df1_init_q15(
+    arm_biquad_cascade_multi_df1_instance_q15 *S,
+    uint8_t numStages,
+    uint16_t numChannels,
+    q15_t *pCoeffs,
+    q15_t *pState,
+    int8_t postShift );
+
+
+/**
+ * @brief Processing function for the Q31 Biquad cascade filter. N interleaved channels
+ * @param[in]  S          points to an instance of the multichannel Q31 Biquad cascade structure.
+ * @param[in]  pSrc       points to the block of interleaved input data.
+ * @param[out] pDst       points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples per channel to process.
+ */
+void arm_biquad_cascade_multi_df1_q31(
+    const arm_biquad_cascade_multi_df1_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the multichannel Q31 Biquad cascade filter.
+ * @param[in,out] S            points to an instance of the multichannel Q31 Biquad cascade structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     numChannels  number of interleaved channels.
+ * @param[in]     pCoeffs      points to the filter coefficients.
+ * @param[in]     pState       points to the state buffer.
+ * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+ */
+void arm_biquad_cascade_multi_df1_init_q31(
+    arm_biquad_cascade_multi_df1_instance_q31 *S,
+    uint8_t numStages,
+    uint16_t numChannels,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    int8_t postShift );
+
+
 /**
  * @brief Instance structure for the floating-point matrix structure.
  */
@@ -1507,6 +1625,110 @@ arm_status arm_mat_trans_q31(
     arm_matrix_instance_q31 *pDst );
 
 
+/**
+ * @brief Floating-point 2x2 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 4 elements of the input matrix
+ * @param[out] pDst  points to the 4 elements of the output matrix
+ */
+void arm_mat_trans_2x2_f32(
+    const float32_t * pSrc,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point 3x3 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 9 elements of the input matrix
+ * @param[out] pDst  points to the 9 elements of the output matrix
+ */
+void arm_mat_trans_3x3_f32(
+    const float32_t * pSrc,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point 4x4 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 16 elements of the input matrix
+ * @param[out] pDst  points to the 16 elements of the output matrix
+ */
+void arm_mat_trans_4x4_f32(
+    const float32_t * pSrc,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point 6x6 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 36 elements of the input matrix
+ * @param[out] pDst  points to the 36 elements of the output matrix
+ */
+void arm_mat_trans_6x6_f32(
+    const float32_t * pSrc,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point matrix transpose using the unrolled kernels.
+ * @param[in]  pSrc  points to the input matrix
+ * @param[out] pDst  points to the output matrix
+ * @return    The function returns <code>ARM_MATH_SUCCESS</code> if both matrices are 2x2, 3x3, 4x4 or 6x6
+ * and <code>ARM_MATH_ARGUMENT_ERROR</code> otherwise.
+ */
+arm_status arm_mat_trans_small_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pDst );
+
+
+/**
+ * @brief Q31 2x2 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 4 elements of the input matrix
+ * @param[out] pDst  points to the 4 elements of the output matrix
+ */
+void arm_mat_trans_2x2_q31(
+    const q31_t * pSrc,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 3x3 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 9 elements of the input matrix
+ * @param[out] pDst  points to the 9 elements of the output matrix
+ */
+void arm_mat_trans_3x3_q31(
+    const q31_t * pSrc,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 4x4 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 16 elements of the input matrix
+ * @param[out] pDst  points to the 16 elements of the output matrix
+ */
+void arm_mat_trans_4x4_q31(
+    const q31_t * pSrc,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 6x6 matrix transpose without size checking.
+ * @param[in]  pSrc  points to the 36 elements of the input matrix
+ * @param[out] pDst  points to the 36 elements of the output matrix
+ */
+void arm_mat_trans_6x6_q31(
+    const q31_t * pSrc,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 matrix transpose using the unrolled kernels.
+ * @param[in]  pSrc  points to the input matrix
+ * @param[out] pDst  points to the output matrix
+ * @return    The function returns <code>ARM_MATH_SUCCESS</code> if both matrices are 2x2, 3x3, 4x4 or 6x6
+ * and <code>ARM_MATH_ARGUMENT_ERROR</code> otherwise.
+ */
+arm_status arm_mat_trans_small_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pDst );
+
+
 /**
  * @brief Floating-point matrix multiplication
  * @param[in]  pSrcA  points to the first input matrix structure
@@ -1567,6 +1789,130 @@ arm_status arm_mat_mult_q31(
     arm_matrix_instance_q31 *pDst );
 
 
+/**
+ * @brief Floating-point 2x2 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 4 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 4 elements of the second input matrix
+ * @param[out] pDst   points to the 4 elements of the output matrix
+ */
+void arm_mat_mult_2x2_f32(
+    const float32_t * pSrcA,
+    const float32_t * pSrcB,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point 3x3 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 9 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 9 elements of the second input matrix
+ * @param[out] pDst   points to the 9 elements of the output matrix
+ */
+void arm_mat_mult_3x3_f32(
+    const float32_t * pSrcA,
+    const float32_t * pSrcB,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point 4x4 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 16 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 16 elements of the second input matrix
+ * @param[out] pDst   points to the 16 elements of the output matrix
+ */
+void arm_mat_mult_4x4_f32(
+    const float32_t * pSrcA,
+    const float32_t * pSrcB,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point 6x6 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 36 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 36 elements of the second input matrix
+ * @param[out] pDst   points to the 36 elements of the output matrix
+ */
+void arm_mat_mult_6x6_f32(
+    const float32_t * pSrcA,
+    const float32_t * pSrcB,
+    float32_t * pDst);
+
+
+/**
+ * @brief Floating-point matrix multiplication using the unrolled kernels.
+ * @param[in]  pSrcA  points to the first input matrix structure
+ * @param[in]  pSrcB  points to the second input matrix structure
+ * @param[out] pDst   points to output matrix structure
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code> if all three matrices are 2x2, 3x3, 4x4 or 6x6
+ * and <code>ARM_MATH_ARGUMENT_ERROR</code> otherwise.
+ */
+arm_status arm_mat_mult_small_f32(
+    const arm_matrix_instance_f32 *pSrcA,
+    const arm_matrix_instance_f32 *pSrcB,
+    arm_matrix_instance_f32 *pDst );
+
+
+/**
+ * @brief Q31 2x2 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 4 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 4 elements of the second input matrix
+ * @param[out] pDst   points to the 4 elements of the output matrix
+ */
+void arm_mat_mult_2x2_q31(
+    const q31_t * pSrcA,
+    const q31_t * pSrcB,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 3x3 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 9 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 9 elements of the second input matrix
+ * @param[out] pDst   points to the 9 elements of the output matrix
+ */
+void arm_mat_mult_3x3_q31(
+    const q31_t * pSrcA,
+    const q31_t * pSrcB,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 4x4 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 16 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 16 elements of the second input matrix
+ * @param[out] pDst   points to the 16 elements of the output matrix
+ */
+void arm_mat_mult_4x4_q31(
+    const q31_t * pSrcA,
+    const q31_t * pSrcB,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 6x6 matrix multiplication without size checking.
+ * @param[in]  pSrcA  points to the 36 elements of the first input matrix
+ * @param[in]  pSrcB  points to the 36 elements of the second input matrix
+ * @param[out] pDst   points to the 36 elements of the output matrix
+ */
+void arm_mat_mult_6x6_q31(
+    const q31_t * pSrcA,
+    const q31_t * pSrcB,
+    q31_t * pDst);
+
+
+/**
+ * @brief Q31 matrix multiplication using the unrolled kernels.
+ * @param[in]  pSrcA  points to the first input matrix structure
+ * @param[in]  pSrcB  points to the second input matrix structure
+ * @param[out] pDst   points to output matrix structure
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code> if all three matrices are 2x2, 3x3, 4x4 or 6x6
+ * and <code>ARM_MATH_ARGUMENT_ERROR</code> otherwise.
+ */
+arm_status arm_mat_mult_small_q31(
+    const arm_matrix_instance_q31 *pSrcA,
+    const arm_matrix_instance_q31 *pSrcB,
+    arm_matrix_instance_q31 *pDst );
+
+
 /**
  * @brief Q31 matrix multiplication (fast variant) for Cortex-M3 and Cortex-M4
  * @param[in]  pSrcA  points to the first input matrix structure
@@ -2099,6 +2445,22 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag );
 
+/**
+ * @brief Instance structure for the Q7 block floating-point CFFT/CIFFT function.
+ */
+typedef struct
+{
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q15_t *pTwiddle;             /**< points to the Q15 Twiddle factor table of the same length. */
+} arm_cfft_instance_q7;
+
+void arm_cfft_q7(
+    const arm_cfft_instance_q7 *S,
+    q7_t *p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int8_t *pBlockExp );
+
 /**
  * @brief Instance structure for the fixed-point CFFT/CIFFT function.
  */
@@ -2158,6 +2520,32 @@ void arm_rfft_q15(
     q15_t *pSrc,
     q15_t *pDst );
 
+/**
+ * @brief Instance structure for the Q7 block floating-point RFFT/RIFFT function.
+ */
+typedef struct
+{
+    uint32_t fftLenReal;                      /**< length of the real FFT. */
+    uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
+    q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
+    const arm_cfft_instance_q7 *pCfft;        /**< points to the complex FFT instance. */
+} arm_rfft_instance_q7;
+
+arm_status arm_rfft_init_q7(
+    arm_rfft_instance_q7 *S,
+    uint32_t fftLenReal,
+    uint32_t ifftFlagR,
+    uint32_t bitReverseFlag );
+
+void arm_rfft_q7(
+    const arm_rfft_instance_q7 *S,
+    q7_t *pSrc,
+    q7_t *pDst,
+    int8_t *pBlockExp );
+
 /**
  * @brief Instance structure for the Q31 RFFT/RIFFT function.
  */
@@ -2366,83 +2754,435 @@ void arm_dct4_q15(
     q15_t *pState,
     q15_t *pInlineBuffer );
 
+/**
+ * @brief Instance structure for the floating-point Goertzel filter bank.
+ */
+typedef struct
+{
+    uint16_t numBins;          /**< number of frequency bins. */
+    uint32_t windowLen;        /**< length of the sliding window, 0 in block mode. */
+    uint32_t delayIndex;       /**< position of the oldest sample in the delay line. */
+    const float32_t *pCoeffs;  /**< points to the coefficient array of size 2*numBins: cos(w) and sin(w) of each bin. */
+    float32_t *pState;         /**< points to the state array of size 2*numBins. */
+    float32_t *pDelay;         /**< points to the delay line of size windowLen, NULL in block mode. */
+    float32_t damping;         /**< damping factor r of the sliding mode, 1 in block mode. */
+    float32_t dampingSq;       /**< r^2. */
+    float32_t dampingPowN;     /**< r^windowLen. */
+} arm_goertzel_instance_f32;
 
 /**
- * @brief Floating-point vector addition.
- * @param[in]  pSrcA      points to the first input vector
- * @param[in]  pSrcB      points to the second input vector
- * @param[out] pDst       points to the output vector
- * @param[in]  blockSize  number of samples in each vector
+ * @brief Instance structure for the Q31 Goertzel filter bank.
  */
-void arm_add_f32(
-    float32_t *pSrcA,
-    float32_t *pSrcB,
-    float32_t *pDst,
-    uint32_t blockSize );
+typedef struct
+{
+    uint16_t numBins;          /**< number of frequency bins. */
+    uint32_t windowLen;        /**< length of the sliding window, 0 in block mode. */
+    uint32_t delayIndex;       /**< position of the oldest sample in the delay line. */
+    const q31_t *pCoeffs;      /**< points to the coefficient array of size 2*numBins: cos(w) and sin(w) of each bin. */
+    q31_t *pState;             /**< points to the state array of size 2*numBins. */
+    q31_t *pDelay;             /**< points to the delay line of size windowLen, NULL in block mode. */
+    q31_t damping;             /**< damping factor r of the sliding mode in 1.31 format, 1 in block mode. */
+    q31_t dampingSq;           /**< r^2. */
+    q31_t dampingPowN;         /**< r^windowLen. */
+    uint8_t inputShift;        /**< number of bits the input is shifted right by to give the states headroom. */
+} arm_goertzel_instance_q31;
+
+/**
+ * @brief Instance structure for the Q15 Goertzel filter bank.
+ */
+typedef struct
+{
+    uint16_t numBins;          /**< number of frequency bins. */
+    uint32_t windowLen;        /**< length of the sliding window, 0 in block mode. */
+    uint32_t delayIndex;       /**< position of the oldest sample in the delay line. */
+    const q15_t *pCoeffs;      /**< points to the coefficient array of size 2*numBins: cos(w) and sin(w) of each bin. */
+    q31_t *pState;             /**< points to the state array of size 2*numBins. */
+    q15_t *pDelay;             /**< points to the delay line of size windowLen, NULL in block mode. */
+    q31_t damping;             /**< damping factor r of the sliding mode in 1.31 format, 1 in block mode. */
+    q31_t dampingSq;           /**< r^2. */
+    q31_t dampingPowN;         /**< r^windowLen. */
+    uint8_t inputShift;        /**< number of bits the input is shifted right by to give the states headroom. */
+} arm_goertzel_instance_q15;
+
+
+/**
+ * @brief  Floating-point Goertzel filter bank initialization function for the block mode.
+ * @param[in,out] S           points to an instance of the Floating-point Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[in]     pCoeffs     points to the coefficient array of size 2*numBins.
+ * @param[in]     pState      points to the state array of size 2*numBins.
+ */
+void arm_goertzel_init_f32(
+    arm_goertzel_instance_f32 *S,
+    uint16_t numBins,
+    const float32_t *pCoeffs,
+    float32_t *pState );
 
 
 /**
- * @brief Q7 vector addition.
- * @param[in]  pSrcA      points to the first input vector
- * @param[in]  pSrcB      points to the second input vector
- * @param[out] pDst       points to the output vector
- * @param[in]  blockSize  number of samples in each vector
+ * @brief  Floating-point Goertzel filter bank initialization function for the sliding mode.
+ * @param[in,out] S           points to an instance of the Floating-point Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[in]     pCoeffs     points to the coefficient array of size 2*numBins.
+ * @param[in]     pState      points to the state array of size 2*numBins.
+ * @param[in]     windowLen   length of the sliding window.
+ * @param[in]     pDelay      points to the delay line of size windowLen.
+ * @param[in]     damping     damping factor r, slightly below 1.
  */
-void arm_add_q7(
-    q7_t *pSrcA,
-    q7_t *pSrcB,
-    q7_t *pDst,
-    uint32_t blockSize );
+void arm_goertzel_sliding_init_f32(
+    arm_goertzel_instance_f32 *S,
+    uint16_t numBins,
+    const float32_t *pCoeffs,
+    float32_t *pState,
+    uint32_t windowLen,
+    float32_t *pDelay,
+    float32_t damping );
 
 
 /**
- * @brief Q15 vector addition.
- * @param[in]  pSrcA      points to the first input vector
- * @param[in]  pSrcB      points to the second input vector
- * @param[out] pDst       points to the output vector
- * @param[in]  blockSize  number of samples in each vector
+ * @brief  Floating-point Goertzel filter bank reset function.
+ * @param[in,out] S  points to an instance of the Floating-point Goertzel structure.
  */
-void arm_add_q15(
-    q15_t *pSrcA,
-    q15_t *pSrcB,
-    q15_t *pDst,
-    uint32_t blockSize );
+void arm_goertzel_reset_f32(
+    arm_goertzel_instance_f32 *S );
 
 
 /**
- * @brief Q31 vector addition.
- * @param[in]  pSrcA      points to the first input vector
- * @param[in]  pSrcB      points to the second input vector
- * @param[out] pDst       points to the output vector
- * @param[in]  blockSize  number of samples in each vector
+ * @brief  Floating-point Goertzel coefficient computation.
+ * @param[in]  pFreqs   points to the normalised bin frequencies f / fs.
+ * @param[in]  numBins  number of frequency bins.
+ * @param[out] pCoeffs  points to the coefficient array of size 2*numBins.
  */
-void arm_add_q31(
-    q31_t *pSrcA,
-    q31_t *pSrcB,
-    q31_t *pDst,
-    uint32_t blockSize );
+void arm_goertzel_coeffs_f32(
+    const float32_t *pFreqs,
+    uint16_t numBins,
+    float32_t *pCoeffs );
 
 
 /**
- * @brief Floating-point vector subtraction.
- * @param[in]  pSrcA      points to the first input vector
- * @param[in]  pSrcB      points to the second input vector
- * @param[out] pDst       points to the output vector
- * @param[in]  blockSize  number of samples in each vector
+ * @brief  Floating-point Goertzel filter bank, block mode.
+ * @param[in]  S          points to an instance of the Floating-point Goertzel structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  blockSize  number of samples to process.
  */
-void arm_sub_f32(
-    float32_t *pSrcA,
-    float32_t *pSrcB,
-    float32_t *pDst,
+void arm_goertzel_f32(
+    const arm_goertzel_instance_f32 *S,
+    const float32_t *pSrc,
     uint32_t blockSize );
 
 
 /**
- * @brief Q7 vector subtraction.
- * @param[in]  pSrcA      points to the first input vector
- * @param[in]  pSrcB      points to the second input vector
- * @param[out] pDst       points to the output vector
- * @param[in]  blockSize  number of samples in each vector
+ * @brief  Floating-point Goertzel filter bank, sliding mode.
+ * @param[in,out] S          points to an instance of the Floating-point Goertzel structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_goertzel_sliding_f32(
+    arm_goertzel_instance_f32 *S,
+    const float32_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Floating-point Goertzel filter bank complex output.
+ * @param[in]  S     points to an instance of the Floating-point Goertzel structure.
+ * @param[out] pDst  points to the output array of size 2*numBins.
+ */
+void arm_goertzel_cmplx_f32(
+    const arm_goertzel_instance_f32 *S,
+    float32_t *pDst );
+
+
+/**
+ * @brief  Floating-point Goertzel filter bank squared magnitude output.
+ * @param[in]  S     points to an instance of the Floating-point Goertzel structure.
+ * @param[out] pDst  points to the output array of size numBins.
+ */
+void arm_goertzel_power_f32(
+    const arm_goertzel_instance_f32 *S,
+    float32_t *pDst );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank initialization function for the block mode.
+ * @param[in,out] S           points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[in]     pCoeffs     points to the coefficient array of size 2*numBins.
+ * @param[in]     pState      points to the state array of size 2*numBins.
+ * @param[in]     inputShift  number of bits the input is shifted right by.
+ */
+void arm_goertzel_init_q31(
+    arm_goertzel_instance_q31 *S,
+    uint16_t numBins,
+    const q31_t *pCoeffs,
+    q31_t *pState,
+    uint8_t inputShift );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank initialization function for the sliding mode.
+ * @param[in,out] S           points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[in]     pCoeffs     points to the coefficient array of size 2*numBins.
+ * @param[in]     pState      points to the state array of size 2*numBins.
+ * @param[in]     windowLen   length of the sliding window.
+ * @param[in]     pDelay      points to the delay line of size windowLen.
+ * @param[in]     damping     damping factor r, slightly below 1, in 1.31 format.
+ * @param[in]     inputShift  number of bits the input is shifted right by.
+ */
+void arm_goertzel_sliding_init_q31(
+    arm_goertzel_instance_q31 *S,
+    uint16_t numBins,
+    const q31_t *pCoeffs,
+    q31_t *pState,
+    uint32_t windowLen,
+    q31_t *pDelay,
+    q31_t damping,
+    uint8_t inputShift );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank reset function.
+ * @param[in,out] S  points to an instance of the Q31 Goertzel structure.
+ */
+void arm_goertzel_reset_q31(
+    arm_goertzel_instance_q31 *S );
+
+
+/**
+ * @brief  Q31 Goertzel coefficient computation.
+ * @param[in]  pFreqs   points to the normalised bin frequencies f / fs, in 1.31 format.
+ * @param[in]  numBins  number of frequency bins.
+ * @param[out] pCoeffs  points to the coefficient array of size 2*numBins.
+ */
+void arm_goertzel_coeffs_q31(
+    const q31_t *pFreqs,
+    uint16_t numBins,
+    q31_t *pCoeffs );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank, block mode.
+ * @param[in]  S          points to an instance of the Q31 Goertzel structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_goertzel_q31(
+    const arm_goertzel_instance_q31 *S,
+    const q31_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank, sliding mode.
+ * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_goertzel_sliding_q31(
+    arm_goertzel_instance_q31 *S,
+    const q31_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank complex output.
+ * @param[in]  S     points to an instance of the Q31 Goertzel structure.
+ * @param[out] pDst  points to the output array of size 2*numBins.
+ */
+void arm_goertzel_cmplx_q31(
+    const arm_goertzel_instance_q31 *S,
+    q31_t *pDst );
+
+
+/**
+ * @brief  Q31 Goertzel filter bank squared magnitude output.
+ * @param[in]  S     points to an instance of the Q31 Goertzel structure.
+ * @param[out] pDst  points to the output array of size numBins.
+ */
+void arm_goertzel_power_q31(
+    const arm_goertzel_instance_q31 *S,
+    q31_t *pDst );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank initialization function for the block mode.
+ * @param[in,out] S           points to an instance of the Q15 Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[in]     pCoeffs     points to the coefficient array of size 2*numBins.
+ * @param[in]     pState      points to the state array of size 2*numBins.
+ * @param[in]     inputShift  number of bits the input is shifted right by.
+ */
+void arm_goertzel_init_q15(
+    arm_goertzel_instance_q15 *S,
+    uint16_t numBins,
+    const q15_t *pCoeffs,
+    q31_t *pState,
+    uint8_t inputShift );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank initialization function for the sliding mode.
+ * @param[in,out] S           points to an instance of the Q15 Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[in]     pCoeffs     points to the coefficient array of size 2*numBins.
+ * @param[in]     pState      points to the state array of size 2*numBins.
+ * @param[in]     windowLen   length of the sliding window.
+ * @param[in]     pDelay      points to the delay line of size windowLen.
+ * @param[in]     damping     damping factor r, slightly below 1, in 1.31 format.
+ * @param[in]     inputShift  number of bits the input is shifted right by.
+ */
+void arm_goertzel_sliding_init_q15(
+    arm_goertzel_instance_q15 *S,
+    uint16_t numBins,
+    const q15_t *pCoeffs,
+    q31_t *pState,
+    uint32_t windowLen,
+    q15_t *pDelay,
+    q31_t damping,
+    uint8_t inputShift );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank reset function.
+ * @param[in,out] S  points to an instance of the Q15 Goertzel structure.
+ */
+void arm_goertzel_reset_q15(
+    arm_goertzel_instance_q15 *S );
+
+
+/**
+ * @brief  Q15 Goertzel coefficient computation.
+ * @param[in]  pFreqs   points to the normalised bin frequencies f / fs, in 1.15 format.
+ * @param[in]  numBins  number of frequency bins.
+ * @param[out] pCoeffs  points to the coefficient array of size 2*numBins.
+ */
+void arm_goertzel_coeffs_q15(
+    const q15_t *pFreqs,
+    uint16_t numBins,
+    q15_t *pCoeffs );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank, block mode.
+ * @param[in]  S          points to an instance of the Q15 Goertzel structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_goertzel_q15(
+    const arm_goertzel_instance_q15 *S,
+    const q15_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank, sliding mode.
+ * @param[in,out] S          points to an instance of the Q15 Goertzel structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_goertzel_sliding_q15(
+    arm_goertzel_instance_q15 *S,
+    const q15_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank complex output.
+ * @param[in]  S     points to an instance of the Q15 Goertzel structure.
+ * @param[out] pDst  points to the output array of size 2*numBins.
+ */
+void arm_goertzel_cmplx_q15(
+    const arm_goertzel_instance_q15 *S,
+    q15_t *pDst );
+
+
+/**
+ * @brief  Q15 Goertzel filter bank squared magnitude output.
+ * @param[in]  S     points to an instance of the Q15 Goertzel structure.
+ * @param[out] pDst  points to the output array of size numBins.
+ */
+void arm_goertzel_power_q15(
+    const arm_goertzel_instance_q15 *S,
+    q15_t *pDst );
+
+
+/**
+ * @brief Floating-point vector addition.
+ * @param[in]  pSrcA      points to the first input vector
+ * @param[in]  pSrcB      points to the second input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ */
+void arm_add_f32(
+    float32_t *pSrcA,
+    float32_t *pSrcB,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Q7 vector addition.
+ * @param[in]  pSrcA      points to the first input vector
+ * @param[in]  pSrcB      points to the second input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ */
+void arm_add_q7(
+    q7_t *pSrcA,
+    q7_t *pSrcB,
+    q7_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Q15 vector addition.
+ * @param[in]  pSrcA      points to the first input vector
+ * @param[in]  pSrcB      points to the second input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ */
+void arm_add_q15(
+    q15_t *pSrcA,
+    q15_t *pSrcB,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Q31 vector addition.
+ * @param[in]  pSrcA      points to the first input vector
+ * @param[in]  pSrcB      points to the second input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ */
+void arm_add_q31(
+    q31_t *pSrcA,
+    q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Floating-point vector subtraction.
+ * @param[in]  pSrcA      points to the first input vector
+ * @param[in]  pSrcB      points to the second input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ */
+void arm_sub_f32(
+    float32_t *pSrcA,
+    float32_t *pSrcB,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Q7 vector subtraction.
+ * @param[in]  pSrcA      points to the first input vector
+ * @param[in]  pSrcB      points to the second input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
  */
 void arm_sub_q7(
     q7_t *pSrcA,
@@ -3603,6 +4343,17 @@ typedef struct
     float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
 } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+/**
+ * @brief Instance structure for the multichannel floating-point transposed direct form II Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels sharing the coefficients. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+} arm_biquad_cascade_multi_df2T_instance_f32;
+
 /**
  * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
  */
@@ -3642,6 +4393,20 @@ void arm_biquad_cascade_stereo_df2T_f32(
     uint32_t blockSize );
 
 
+/**
+ * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+ * @param[in]  S          points to an instance of the filter data structure.
+ * @param[in]  pSrc       points to the block of interleaved input data.
+ * @param[out] pDst       points to the block of interleaved output data
+ * @param[in]  blockSize  number of samples per channel to process.
+ */
+void arm_biquad_cascade_multi_df2T_f32(
+    const arm_biquad_cascade_multi_df2T_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
 /**
  * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
  * @param[in]  S          points to an instance of the filter data structure.
@@ -3684,6 +4449,22 @@ void arm_biquad_cascade_stereo_df2T_init_f32(
     float32_t *pState );
 
 
+/**
+ * @brief  Initialization function for the multichannel floating-point transposed direct form II Biquad cascade filter.
+ * @param[in,out] S            points to an instance of the filter data structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     numChannels  number of interleaved channels.
+ * @param[in]     pCoeffs      points to the filter coefficients.
+ * @param[in]     pState       points to the state buffer.
+ */
+void arm_biquad_cascade_multi_df2T_init_f32(
+    arm_biquad_cascade_multi_df2T_instance_f32 *S,
+    uint8_t numStages,
+    uint16_t numChannels,
+    float32_t *pCoeffs,
+    float32_t *pState );
+
+
 /**
  * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
  * @param[in,out] S          points to an instance of the filter data structure.
@@ -4252,48 +5033,318 @@ void arm_lms_norm_init_q15(
 
 
 /**
- * @brief Correlation of floating-point sequences.
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @brief Processing function for the floating-point block LMS filter.
+ * @param[in]  S          points to an instance of the floating-point LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
  */
-void arm_correlate_f32(
-    float32_t *pSrcA,
-    uint32_t srcALen,
-    float32_t *pSrcB,
-    uint32_t srcBLen,
-    float32_t *pDst );
+void arm_lms_block_f32(
+    const arm_lms_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize );
 
 
 /**
-* @brief Correlation of Q15 sequences
-* @param[in]  pSrcA     points to the first input sequence.
-* @param[in]  srcALen   length of the first input sequence.
-* @param[in]  pSrcB     points to the second input sequence.
-* @param[in]  srcBLen   length of the second input sequence.
-* @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-* @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-*/
-void arm_correlate_opt_q15(
-    q15_t *pSrcA,
-    uint32_t srcALen,
-    q15_t *pSrcB,
-    uint32_t srcBLen,
-    q15_t *pDst,
-    q15_t *pScratch );
+ * @brief Processing function for the Q31 block LMS filter.
+ * @param[in]  S          points to an instance of the Q31 LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_block_q31(
+    const arm_lms_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize );
 
 
 /**
- * @brief Correlation of Q15 sequences.
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @brief Processing function for the Q15 block LMS filter.
+ * @param[in]  S          points to an instance of the Q15 LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
  */
-
+void arm_lms_block_q15(
+    const arm_lms_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the floating-point block normalized LMS filter.
+ * @param[in]  S          points to an instance of the floating-point normalized LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_norm_block_f32(
+    arm_lms_norm_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the Q31 block normalized LMS filter.
+ * @param[in]  S          points to an instance of the Q31 normalized LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_norm_block_q31(
+    arm_lms_norm_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the Q15 block normalized LMS filter.
+ * @param[in]  S          points to an instance of the Q15 normalized LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_norm_block_q15(
+    arm_lms_norm_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Instance structure for the floating-point partial-update LMS filter.
+ */
+typedef struct
+{
+    uint16_t numTaps;      /**< number of coefficients in the filter. */
+    float32_t *pState;     /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;    /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;          /**< step size that controls filter coefficient updates. */
+    uint16_t numUpdate;    /**< number of coefficients updated per sample. */
+    uint16_t updateIndex;  /**< index of the first coefficient updated for the next sample. */
+} arm_lms_partial_instance_f32;
+
+
+/**
+ * @brief Processing function for the floating-point partial-update LMS filter.
+ * @param[in,out] S       points to an instance of the floating-point partial-update LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_partial_f32(
+    arm_lms_partial_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Initialization function for the floating-point partial-update LMS filter.
+ * @param[in] S          points to an instance of the floating-point partial-update LMS filter structure.
+ * @param[in] numTaps    number of filter coefficients.
+ * @param[in] pCoeffs    points to coefficient buffer.
+ * @param[in] pState     points to state buffer.
+ * @param[in] mu         step size that controls filter coefficient updates.
+ * @param[in] blockSize  number of samples to process.
+ * @param[in] numUpdate  number of coefficients updated per sample.
+ */
+void arm_lms_partial_init_f32(
+    arm_lms_partial_instance_f32 *S,
+    uint16_t numTaps,
+    float32_t *pCoeffs,
+    float32_t *pState,
+    float32_t mu,
+    uint32_t blockSize,
+    uint16_t numUpdate );
+
+
+/**
+ * @brief Instance structure for the Q31 partial-update LMS filter.
+ */
+typedef struct
+{
+    uint16_t numTaps;      /**< number of coefficients in the filter. */
+    q31_t *pState;         /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;              /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;    /**< bit shift applied to coefficients. */
+    uint16_t numUpdate;    /**< number of coefficients updated per sample. */
+    uint16_t updateIndex;  /**< index of the first coefficient updated for the next sample. */
+} arm_lms_partial_instance_q31;
+
+
+/**
+ * @brief Processing function for the Q31 partial-update LMS filter.
+ * @param[in,out] S       points to an instance of the Q31 partial-update LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_partial_q31(
+    arm_lms_partial_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Initialization function for the Q31 partial-update LMS filter.
+ * @param[in] S          points to an instance of the Q31 partial-update LMS filter structure.
+ * @param[in] numTaps    number of filter coefficients.
+ * @param[in] pCoeffs    points to coefficient buffer.
+ * @param[in] pState     points to state buffer.
+ * @param[in] mu         step size that controls filter coefficient updates.
+ * @param[in] blockSize  number of samples to process.
+ * @param[in] postShift  bit shift applied to coefficients.
+ * @param[in] numUpdate  number of coefficients updated per sample.
+ */
+void arm_lms_partial_init_q31(
+    arm_lms_partial_instance_q31 *S,
+    uint16_t numTaps,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    q31_t mu,
+    uint32_t blockSize,
+    uint32_t postShift,
+    uint16_t numUpdate );
+
+
+/**
+ * @brief Instance structure for the Q15 partial-update LMS filter.
+ */
+typedef struct
+{
+    uint16_t numTaps;      /**< number of coefficients in the filter. */
+    q15_t *pState;         /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;              /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;    /**< bit shift applied to coefficients. */
+    uint16_t numUpdate;    /**< number of coefficients updated per sample. */
+    uint16_t updateIndex;  /**< index of the first coefficient updated for the next sample. */
+} arm_lms_partial_instance_q15;
+
+
+/**
+ * @brief Processing function for the Q15 partial-update LMS filter.
+ * @param[in,out] S       points to an instance of the Q15 partial-update LMS filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  pRef       points to the block of reference data.
+ * @param[out] pOut       points to the block of output data.
+ * @param[out] pErr       points to the block of error data.
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_lms_partial_q15(
+    arm_lms_partial_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pRef,
+    q15_t *pOut,
+    q15_t *pErr,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Initialization function for the Q15 partial-update LMS filter.
+ * @param[in] S          points to an instance of the Q15 partial-update LMS filter structure.
+ * @param[in] numTaps    number of filter coefficients.
+ * @param[in] pCoeffs    points to coefficient buffer.
+ * @param[in] pState     points to state buffer.
+ * @param[in] mu         step size that controls filter coefficient updates.
+ * @param[in] blockSize  number of samples to process.
+ * @param[in] postShift  bit shift applied to coefficients.
+ * @param[in] numUpdate  number of coefficients updated per sample.
+ */
+void arm_lms_partial_init_q15(
+    arm_lms_partial_instance_q15 *S,
+    uint16_t numTaps,
+    q15_t *pCoeffs,
+    q15_t *pState,
+    q15_t mu,
+    uint32_t blockSize,
+    uint32_t postShift,
+    uint16_t numUpdate );
+
+
+/**
+ * @brief Correlation of floating-point sequences.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ */
+void arm_correlate_f32(
+    float32_t *pSrcA,
+    uint32_t srcALen,
+    float32_t *pSrcB,
+    uint32_t srcBLen,
+    float32_t *pDst );
+
+
+/**
+* @brief Correlation of Q15 sequences
+* @param[in]  pSrcA     points to the first input sequence.
+* @param[in]  srcALen   length of the first input sequence.
+* @param[in]  pSrcB     points to the second input sequence.
+* @param[in]  srcBLen   length of the second input sequence.
+* @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+* @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+*/
+void arm_correlate_opt_q15(
+    q15_t *pSrcA,
+    uint32_t srcALen,
+    q15_t *pSrcB,
+    uint32_t srcBLen,
+    q15_t *pDst,
+    q15_t *pScratch );
+
+
+/**
+ * @brief Correlation of Q15 sequences.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ */
+
 void arm_correlate_q15(
     q15_t *pSrcA,
     uint32_t srcALen,
@@ -4925,6 +5976,150 @@ arm_status arm_mat_inverse_f64(
     arm_matrix_instance_f64 *dst );
 
 
+/**
+ * @brief Floating-point Cholesky decomposition of a positive definite matrix.
+ * @param[in]  pSrc  points to the instance of the input floating-point matrix structure.
+ * @param[out] pDst  points to the instance of the output floating-point lower triangular matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+ */
+arm_status arm_mat_cholesky_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pDst );
+
+
+/**
+ * @brief Floating-point LDL^T decomposition of a positive semi-definite matrix.
+ * @param[in]  pSrc  points to the instance of the input floating-point matrix structure.
+ * @param[out] pL    points to the instance of the output floating-point unit lower triangular matrix structure.
+ * @param[out] pD    points to the instance of the output floating-point diagonal matrix structure.
+ * @param[out] pp    points to the output permutation vector.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is not positive semi-definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+ */
+arm_status arm_mat_ldlt_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pL,
+    arm_matrix_instance_f32 *pD,
+    uint16_t *pp );
+
+
+/**
+ * @brief Floating-point LU decomposition with partial pivoting.
+ * @param[in]  pSrc  points to the instance of the input floating-point matrix structure.
+ * @param[out] pL    points to the instance of the output floating-point unit lower triangular matrix structure.
+ * @param[out] pU    points to the instance of the output floating-point upper triangular matrix structure.
+ * @param[out] pp    points to the output permutation vector.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is singular, then the function returns ARM_MATH_SINGULAR.
+ */
+arm_status arm_mat_lu_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pL,
+    arm_matrix_instance_f32 *pU,
+    uint16_t *pp );
+
+
+/**
+ * @brief Solve floating-point lower triangular system.
+ * @param[in]  lt   points to the instance of the lower triangular floating-point matrix structure.
+ * @param[in]  a    points to the instance of the right-hand side floating-point matrix structure.
+ * @param[out] dst  points to the instance of the solution floating-point matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If a diagonal element of lt is zero, then the function returns ARM_MATH_SINGULAR.
+ */
+arm_status arm_mat_solve_lower_triangular_f32(
+    const arm_matrix_instance_f32 *lt,
+    const arm_matrix_instance_f32 *a,
+    arm_matrix_instance_f32 *dst );
+
+
+/**
+ * @brief Solve floating-point upper triangular system.
+ * @param[in]  ut   points to the instance of the upper triangular floating-point matrix structure.
+ * @param[in]  a    points to the instance of the right-hand side floating-point matrix structure.
+ * @param[out] dst  points to the instance of the solution floating-point matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If a diagonal element of ut is zero, then the function returns ARM_MATH_SINGULAR.
+ */
+arm_status arm_mat_solve_upper_triangular_f32(
+    const arm_matrix_instance_f32 *ut,
+    const arm_matrix_instance_f32 *a,
+    arm_matrix_instance_f32 *dst );
+
+
+/**
+ * @brief Q31 Cholesky decomposition of a positive definite matrix.
+ * @param[in]  pSrc  points to the instance of the input Q31 matrix structure.
+ * @param[out] pDst  points to the instance of the output Q31 lower triangular matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+ */
+arm_status arm_mat_cholesky_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pDst );
+
+
+/**
+ * @brief Q31 LDL^T decomposition of a positive semi-definite matrix.
+ * @param[in]  pSrc  points to the instance of the input Q31 matrix structure.
+ * @param[out] pL    points to the instance of the output Q31 unit lower triangular matrix structure.
+ * @param[out] pD    points to the instance of the output Q31 diagonal matrix structure.
+ * @param[out] pp    points to the output permutation vector.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is not positive semi-definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+ */
+arm_status arm_mat_ldlt_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pL,
+    arm_matrix_instance_q31 *pD,
+    uint16_t *pp );
+
+
+/**
+ * @brief Q31 LU decomposition with partial pivoting.
+ * @param[in]  pSrc  points to the instance of the input Q31 matrix structure.
+ * @param[out] pL    points to the instance of the output Q31 unit lower triangular matrix structure.
+ * @param[out] pU    points to the instance of the output Q31 upper triangular matrix structure.
+ * @param[out] pp    points to the output permutation vector.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is singular, then the function returns ARM_MATH_SINGULAR.
+ */
+arm_status arm_mat_lu_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pL,
+    arm_matrix_instance_q31 *pU,
+    uint16_t *pp );
+
+
+/**
+ * @brief Solve Q31 lower triangular system.
+ * @param[in]  lt   points to the instance of the lower triangular Q31 matrix structure.
+ * @param[in]  a    points to the instance of the right-hand side Q31 matrix structure.
+ * @param[out] dst  points to the instance of the solution Q31 matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If a diagonal element of lt is zero, then the function returns ARM_MATH_SINGULAR.
+ */
+arm_status arm_mat_solve_lower_triangular_q31(
+    const arm_matrix_instance_q31 *lt,
+    const arm_matrix_instance_q31 *a,
+    arm_matrix_instance_q31 *dst );
+
+
+/**
+ * @brief Solve Q31 upper triangular system.
+ * @param[in]  ut   points to the instance of the upper triangular Q31 matrix structure.
+ * @param[in]  a    points to the instance of the right-hand side Q31 matrix structure.
+ * @param[out] dst  points to the instance of the solution Q31 matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If a diagonal element of ut is zero, then the function returns ARM_MATH_SINGULAR.
+ */
+arm_status arm_mat_solve_upper_triangular_q31(
+    const arm_matrix_instance_q31 *ut,
+    const arm_matrix_instance_q31 *a,
+    arm_matrix_instance_q31 *dst );
+
+
 
 /**
  * @ingroup groupController
@@ -5781,6 +6976,91 @@ arm_status arm_sqrt_q15(
  */
 
 
+/**
+ * @brief  Q31 inverse square root function.
+ * @param[in]  in      input value.  The range of the input value is (0 +1) or 0x00000001 to 0x7FFFFFFF.
+ * @param[out] pOut    mantissa of the inverse square root, in Q31 format.
+ * @param[out] pShift  left shift to apply to the mantissa.
+ * @return The function returns ARM_MATH_SUCCESS for positive inputs, ARM_MATH_NANINF for
+ * a zero input and ARM_MATH_ARGUMENT_ERROR for negative inputs.
+ */
+arm_status arm_rsqrt_q31(
+    q31_t in,
+    q31_t *pOut,
+    uint8_t *pShift );
+
+
+/**
+ * @brief  Q31 reciprocal function.
+ * @param[in]  in      input value.
+ * @param[out] pOut    mantissa of the reciprocal, in Q31 format.
+ * @param[out] pShift  left shift to apply to the mantissa.
+ * @return The function returns ARM_MATH_SUCCESS for nonzero inputs and ARM_MATH_NANINF
+ * when the input is zero.
+ */
+arm_status arm_reciprocal_q31(
+    q31_t in,
+    q31_t *pOut,
+    uint8_t *pShift );
+
+
+/**
+ * @brief  Q15 reciprocal function.
+ * @param[in]  in      input value.
+ * @param[out] pOut    mantissa of the reciprocal, in Q15 format.
+ * @param[out] pShift  left shift to apply to the mantissa.
+ * @return The function returns ARM_MATH_SUCCESS for nonzero inputs and ARM_MATH_NANINF
+ * when the input is zero.
+ */
+arm_status arm_reciprocal_q15(
+    q15_t in,
+    q15_t *pOut,
+    uint8_t *pShift );
+
+
+/**
+ * @brief  Q31 four-quadrant arctangent function.
+ * @param[in] y  ordinate of the point.
+ * @param[in] x  abscissa of the point.
+ * @return  atan2(y, x) in radians, in Q2.29 format.
+ */
+q31_t arm_atan2_q31(
+    q31_t y,
+    q31_t x );
+
+
+/**
+ * @brief  Q15 four-quadrant arctangent function.
+ * @param[in] y  ordinate of the point.
+ * @param[in] x  abscissa of the point.
+ * @return  atan2(y, x) in radians, in Q2.13 format.
+ */
+q15_t arm_atan2_q15(
+    q15_t y,
+    q15_t x );
+
+
+/**
+ * @brief  Q31 natural exponential function.
+ * @param[in] x  input value in Q5.26 format.
+ * @return  e^x in Q31 format.
+ */
+q31_t arm_exp_q31(
+    q31_t x );
+
+
+/**
+ * @brief  Q31 natural logarithm function.
+ * @param[in]  in    input value.  The range of the input value is (0 +1) or 0x00000001 to 0x7FFFFFFF.
+ * @param[out] pOut  natural logarithm of the input value, in Q5.26 format.
+ * @return The function returns ARM_MATH_SUCCESS if the input value is positive and
+ * ARM_MATH_ARGUMENT_ERROR otherwise.
+ */
+arm_status arm_log_q31(
+    q31_t in,
+    q31_t *pOut );
+
+
 /**
  * @brief floating-point Circular write function.
  */
@@ -6532,6 +7812,420 @@ void arm_max_f32(
     uint32_t *pIndex );
 
 
+/**
+ * @brief Instance structure for the Q15 sliding window statistics.
+ */
+typedef struct
+{
+    uint32_t windowSize;       /**< number of samples in the sliding window. */
+    uint32_t index;            /**< position of the oldest sample in the window buffer. */
+    uint32_t count;            /**< number of samples currently in the window. */
+    q15_t *pState;             /**< points to the window buffer of length windowSize. */
+    q63_t sum;                 /**< running sum of the window samples. */
+    q63_t sumOfSquares;        /**< running sum of the squared window samples. */
+} arm_sliding_stats_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 sliding window statistics.
+ */
+typedef struct
+{
+    uint32_t windowSize;       /**< number of samples in the sliding window. */
+    uint32_t index;            /**< position of the oldest sample in the window buffer. */
+    uint32_t count;            /**< number of samples currently in the window. */
+    q31_t *pState;             /**< points to the window buffer of length windowSize. */
+    q63_t sum;                 /**< running sum of the window samples. */
+    q63_t sumOfSquares;        /**< running sum of the squared window samples. */
+} arm_sliding_stats_instance_q31;
+
+/**
+ * @brief Instance structure for the floating-point sliding window statistics.
+ */
+typedef struct
+{
+    uint32_t windowSize;       /**< number of samples in the sliding window. */
+    uint32_t index;            /**< position of the oldest sample in the window buffer. */
+    uint32_t count;            /**< number of samples currently in the window. */
+    float32_t *pState;         /**< points to the window buffer of length windowSize. */
+    float32_t sum;             /**< running sum of the window samples. */
+    float32_t sumOfSquares;    /**< running sum of squared deviations from the mean for the variance, running sum of squares otherwise. */
+} arm_sliding_stats_instance_f32;
+
+/**
+ * @brief Instance structure for the Q15 sliding window minimum and maximum.
+ */
+typedef struct
+{
+    uint32_t windowSize;       /**< number of samples in the sliding window. */
+    uint32_t head;             /**< position of the front of the deque. */
+    uint32_t length;           /**< number of entries in the deque. */
+    uint32_t sampleIndex;      /**< position of the next input sample in the stream. */
+    q15_t *pValues;            /**< points to the deque value buffer of length windowSize. */
+    uint32_t *pIndex;          /**< points to the deque position buffer of length windowSize. */
+} arm_sliding_minmax_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 sliding window minimum and maximum.
+ */
+typedef struct
+{
+    uint32_t windowSize;       /**< number of samples in the sliding window. */
+    uint32_t head;             /**< position of the front of the deque. */
+    uint32_t length;           /**< number of entries in the deque. */
+    uint32_t sampleIndex;      /**< position of the next input sample in the stream. */
+    q31_t *pValues;            /**< points to the deque value buffer of length windowSize. */
+    uint32_t *pIndex;          /**< points to the deque position buffer of length windowSize. */
+} arm_sliding_minmax_instance_q31;
+
+/**
+ * @brief Instance structure for the floating-point sliding window minimum and maximum.
+ */
+typedef struct
+{
+    uint32_t windowSize;       /**< number of samples in the sliding window. */
+    uint32_t head;             /**< position of the front of the deque. */
+    uint32_t length;           /**< number of entries in the deque. */
+    uint32_t sampleIndex;      /**< position of the next input sample in the stream. */
+    float32_t *pValues;        /**< points to the deque value buffer of length windowSize. */
+    uint32_t *pIndex;          /**< points to the deque position buffer of length windowSize. */
+} arm_sliding_minmax_instance_f32;
+
+/**
+ * @brief  Initialization function for the Q15 sliding window statistics.
+ * @param[in,out] S           points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     windowSize  number of samples in the sliding window.
+ * @param[in]     pState      points to the window buffer of length windowSize.
+ */
+void arm_sliding_stats_init_q15(
+    arm_sliding_stats_instance_q15 *S,
+    uint32_t windowSize,
+    q15_t *pState );
+
+
+/**
+ * @brief  Reset function for the Q15 sliding window statistics.
+ * @param[in,out] S  points to an instance of the Q15 sliding window statistics structure.
+ */
+void arm_sliding_stats_reset_q15(
+    arm_sliding_stats_instance_q15 *S );
+
+
+/**
+ * @brief  Mean of a Q15 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_mean_q15(
+    arm_sliding_stats_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Variance of a Q15 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_var_q15(
+    arm_sliding_stats_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Root Mean Square of a Q15 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_rms_q15(
+    arm_sliding_stats_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q31 sliding window statistics.
+ * @param[in,out] S           points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     windowSize  number of samples in the sliding window.
+ * @param[in]     pState      points to the window buffer of length windowSize.
+ */
+void arm_sliding_stats_init_q31(
+    arm_sliding_stats_instance_q31 *S,
+    uint32_t windowSize,
+    q31_t *pState );
+
+
+/**
+ * @brief  Reset function for the Q31 sliding window statistics.
+ * @param[in,out] S  points to an instance of the Q31 sliding window statistics structure.
+ */
+void arm_sliding_stats_reset_q31(
+    arm_sliding_stats_instance_q31 *S );
+
+
+/**
+ * @brief  Mean of a Q31 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_mean_q31(
+    arm_sliding_stats_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Variance of a Q31 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_var_q31(
+    arm_sliding_stats_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Root Mean Square of a Q31 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_rms_q31(
+    arm_sliding_stats_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the floating-point sliding window statistics.
+ * @param[in,out] S           points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     windowSize  number of samples in the sliding window.
+ * @param[in]     pState      points to the window buffer of length windowSize.
+ */
+void arm_sliding_stats_init_f32(
+    arm_sliding_stats_instance_f32 *S,
+    uint32_t windowSize,
+    float32_t *pState );
+
+
+/**
+ * @brief  Reset function for the floating-point sliding window statistics.
+ * @param[in,out] S  points to an instance of the floating-point sliding window statistics structure.
+ */
+void arm_sliding_stats_reset_f32(
+    arm_sliding_stats_instance_f32 *S );
+
+
+/**
+ * @brief  Mean of a floating-point stream over a sliding window.
+ * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_mean_f32(
+    arm_sliding_stats_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Variance of a floating-point stream over a sliding window.
+ * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_var_f32(
+    arm_sliding_stats_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Root Mean Square of a floating-point stream over a sliding window.
+ * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_rms_f32(
+    arm_sliding_stats_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q15 sliding window minimum and maximum.
+ * @param[in,out] S           points to an instance of the Q15 sliding window minimum/maximum structure.
+ * @param[in]     windowSize  number of samples in the sliding window.
+ * @param[in]     pValues     points to the deque value buffer of length windowSize.
+ * @param[in]     pIndex      points to the deque position buffer of length windowSize.
+ */
+void arm_sliding_minmax_init_q15(
+    arm_sliding_minmax_instance_q15 *S,
+    uint32_t windowSize,
+    q15_t *pValues,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief  Reset function for the Q15 sliding window minimum and maximum.
+ * @param[in,out] S  points to an instance of the Q15 sliding window minimum/maximum structure.
+ */
+void arm_sliding_minmax_reset_q15(
+    arm_sliding_minmax_instance_q15 *S );
+
+
+/**
+ * @brief  Maximum of a Q15 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q15 sliding window minimum/maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_max_q15(
+    arm_sliding_minmax_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Minimum of a Q15 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q15 sliding window minimum/maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_min_q15(
+    arm_sliding_minmax_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q31 sliding window minimum and maximum.
+ * @param[in,out] S           points to an instance of the Q31 sliding window minimum/maximum structure.
+ * @param[in]     windowSize  number of samples in the sliding window.
+ * @param[in]     pValues     points to the deque value buffer of length windowSize.
+ * @param[in]     pIndex      points to the deque position buffer of length windowSize.
+ */
+void arm_sliding_minmax_init_q31(
+    arm_sliding_minmax_instance_q31 *S,
+    uint32_t windowSize,
+    q31_t *pValues,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief  Reset function for the Q31 sliding window minimum and maximum.
+ * @param[in,out] S  points to an instance of the Q31 sliding window minimum/maximum structure.
+ */
+void arm_sliding_minmax_reset_q31(
+    arm_sliding_minmax_instance_q31 *S );
+
+
+/**
+ * @brief  Maximum of a Q31 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q31 sliding window minimum/maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_max_q31(
+    arm_sliding_minmax_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Minimum of a Q31 stream over a sliding window.
+ * @param[in,out] S          points to an instance of the Q31 sliding window minimum/maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_min_q31(
+    arm_sliding_minmax_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the floating-point sliding window minimum and maximum.
+ * @param[in,out] S           points to an instance of the floating-point sliding window minimum/maximum structure.
+ * @param[in]     windowSize  number of samples in the sliding window.
+ * @param[in]     pValues     points to the deque value buffer of length windowSize.
+ * @param[in]     pIndex      points to the deque position buffer of length windowSize.
+ */
+void arm_sliding_minmax_init_f32(
+    arm_sliding_minmax_instance_f32 *S,
+    uint32_t windowSize,
+    float32_t *pValues,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief  Reset function for the floating-point sliding window minimum and maximum.
+ * @param[in,out] S  points to an instance of the floating-point sliding window minimum/maximum structure.
+ */
+void arm_sliding_minmax_reset_f32(
+    arm_sliding_minmax_instance_f32 *S );
+
+
+/**
+ * @brief  Maximum of a floating-point stream over a sliding window.
+ * @param[in,out] S          points to an instance of the floating-point sliding window minimum/maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_max_f32(
+    arm_sliding_minmax_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Minimum of a floating-point stream over a sliding window.
+ * @param[in,out] S          points to an instance of the floating-point sliding window minimum/maximum structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_sliding_min_f32(
+    arm_sliding_minmax_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
 /**
  * @brief  Q15 complex-by-complex multiplication
  * @param[in]  pSrcA       points to the first input vector
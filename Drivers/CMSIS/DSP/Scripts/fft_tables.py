@@ -0,0 +1,175 @@
+#!/usr/bin/python
+#
+# FFT table selection for the CMSIS DSP library.
+#
+# Maps the transforms used by an application onto the ARM_TABLE_* macros that
+# build only their twiddle and bit reversal tables (see arm_common_tables.h),
+# and reports how many bytes of constant data each selection costs.
+#
+# Transforms are given as any of:
+#   arm_cfft_sR_q15_len256            an instance from arm_const_structs.h
+#   arm_rfft_fast_init_f32:1024       an init function and its length
+#   arm_cfft_radix4_init_q31          a radix-2/radix-4 init function
+#   ARM_TABLE_TWIDDLECOEF_F32_64      a table macro
+#
+# Examples:
+#   fft_tables.py arm_cfft_sR_q15_len256 arm_rfft_fast_init_f32:1024
+#   fft_tables.py --header arm_dsp_tables.h arm_rfft_init_q31:512
+#   fft_tables.py --size arm_cfft_sR_f32_len64
+#   fft_tables.py --size --all
+#
+# The macros are printed as compiler -D options. With --header they are written
+# to a file that can be passed to the compiler as a pre-include instead.
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+TABLE_SOURCES = ['Source/CommonTables/arm_common_tables.c',
+                 'Source/TransformFunctions/arm_rfft_init_q31.c',
+                 'Source/TransformFunctions/arm_rfft_init_q15.c']
+STRUCT_SOURCE = 'Source/CommonTables/arm_const_structs.c'
+LENGTH_HEADER = 'Include/arm_common_tables.h'
+
+TYPE_SIZE = {'uint16_t': 2, 'q15_t': 2, 'q31_t': 4, 'float32_t': 4}
+
+GUARD = re.compile(r'#if defined\(ARM_ALL_FFT_TABLES\) \|\|(.*)')
+TABLE = re.compile(r'const (\w+) (?:ALIGN4 )?(\w+)\[(\w+)\] =')
+STRUCT = re.compile(r'const \w+ (arm_\w+_sR_\w+) =')
+MACRO = re.compile(r'ARM_TABLE_\w+')
+
+
+def read(path):
+  with open(os.path.join(ROOT, path)) as f:
+    return f.read()
+
+
+def table_lengths():
+  lengths = {}
+  for m in re.finditer(r'#define (ARMBITREVINDEXTABLE\w*_TABLE_LENGTH) \(\(uint16_t\)(\d+)\)',
+                       read(LENGTH_HEADER)):
+    lengths[m.group(1)] = int(m.group(2))
+  return lengths
+
+
+def guarded(path):
+  """Yields (macros, declaration line) for every guarded definition in a file."""
+  lines = read(path).replace('\\\n', ' ').split('\n')
+  for i, line in enumerate(lines):
+    m = GUARD.match(line)
+    if m:
+      yield MACRO.findall(m.group(1)), lines[i + 1]
+
+
+def load_tables():
+  """Returns {macro: [(name, bytes)]}."""
+  lengths = table_lengths()
+  tables = {}
+  for path in TABLE_SOURCES:
+    for macros, decl in guarded(path):
+      m = TABLE.match(decl)
+      if not m:
+        continue
+      ctype, name, count = m.groups()
+      count = lengths[count] if count in lengths else int(count)
+      tables.setdefault(macros[0], []).append((name, count * TYPE_SIZE[ctype]))
+  return tables
+
+
+def load_structs():
+  """Returns {instance name: [macros]}."""
+  structs = {}
+  for macros, decl in guarded(STRUCT_SOURCE):
+    m = STRUCT.match(decl)
+    if m:
+      structs[m.group(1)] = macros
+  return structs
+
+
+def resolve(name, structs):
+  m = re.match(r'arm_cfft_(f32|q31|q15|q7)(?::(\d+))?$', name)
+  if m and m.group(2):
+    name = 'arm_cfft_sR_%s_len%s' % m.groups()
+  m = re.match(r'arm_rfft_fast_init_f32:(\d+)$', name)
+  if m:
+    name = 'arm_rfft_fast_sR_f32_len%s' % m.group(1)
+  m = re.match(r'arm_rfft_init_(q31|q15|q7):(\d+)$', name)
+  if m:
+    name = 'arm_rfft_sR_%s_len%s' % m.groups()
+  m = re.match(r'arm_cfft_radix[24]_init_(f32|q31|q15)$', name)
+  if m:
+    return ['ARM_TABLE_TWIDDLECOEF_%s_4096' % m.group(1).upper(), 'ARM_TABLE_BITREV_1024']
+  if name.startswith('ARM_TABLE_'):
+    return [name]
+  if name in structs:
+    return structs[name]
+  raise ValueError('unknown transform %s' % name)
+
+
+def sort_key(macro):
+  m = re.match(r'(.*?)_?(\d*)$', macro)
+  return (m.group(1), int(m.group(2) or 0))
+
+
+def size_report(selected, tables):
+  total = 0
+  print('%-36s %-30s %8s' % ('Macro', 'Table', 'Bytes'))
+  for macro in sorted(selected, key=sort_key):
+    for name, size in tables[macro]:
+      print('%-36s %-30s %8d' % (macro, name, size))
+      total += size
+  everything = sum(size for entries in tables.values() for _, size in entries)
+  print('%-67s %8d' % ('Selected', total))
+  print('%-67s %8d' % ('All FFT tables', everything))
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Select the CMSIS DSP FFT tables used by an application.')
+  parser.add_argument('transforms', nargs='*', help='instances, init functions or ARM_TABLE_* macros')
+  parser.add_argument('--all', action='store_true', help='select every table')
+  parser.add_argument('--header', metavar='FILE', help='write the selection to a pre-include header')
+  parser.add_argument('--size', action='store_true', help='print the size of the selected tables')
+  parser.add_argument('--list', action='store_true', help='list the constant instances and their tables')
+  args = parser.parse_args()
+
+  tables = load_tables()
+  structs = load_structs()
+
+  if args.list:
+    for name in sorted(structs, key=sort_key):
+      print('%-32s %s' % (name, ' '.join(structs[name])))
+    return 0
+
+  selected = set(tables) if args.all else set()
+  for name in args.transforms:
+    try:
+      selected.update(resolve(name, structs))
+    except ValueError as e:
+      print('error: %s' % e, file=sys.stderr)
+      return 1
+  unknown = [macro for macro in selected if macro not in tables]
+  if unknown:
+    print('error: unknown table macro %s' % ' '.join(unknown), file=sys.stderr)
+    return 1
+
+  macros = ['ARM_DSP_CONFIG_TABLES'] + sorted(selected, key=sort_key)
+  if args.header:
+    with open(args.header, 'w') as f:
+      f.write('/* FFT tables selected by fft_tables.py %s */\n' % ' '.join(sys.argv[1:]))
+      for macro in macros:
+        f.write('#define %s\n' % macro)
+  elif not args.size:
+    print(' '.join('-D' + macro for macro in macros))
+
+  if args.size:
+    size_report(selected, tables)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -64,6 +64,7 @@
 /*
 * @brief  Table for bit reversal process
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREV_1024)
 const uint16_t armBitRevTable[1024] =
 {
     0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700, 0x80, 0x480, 0x280,
@@ -170,6 +171,7 @@ const uint16_t armBitRevTable[1024] =
     0x67e, 0x17e, 0x57e, 0x37e, 0x77e, 0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe,
     0x5fe, 0x3fe, 0x7fe, 0x1
 };
+#endif
 
 
 /*
@@ -191,6 +193,7 @@ const uint16_t armBitRevTable[1024] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_16)
 const float32_t twiddleCoef_16[32] =
 {
     1.000000000f,  0.000000000f,
@@ -210,6 +213,7 @@ const float32_t twiddleCoef_16[32] =
     0.707106781f, -0.707106781f,
     0.923879533f, -0.382683432f
 };
+#endif
 
 /**
 * \par
@@ -226,6 +230,7 @@ const float32_t twiddleCoef_16[32] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_32)
 const float32_t twiddleCoef_32[64] =
 {
     1.000000000f,  0.000000000f,
@@ -261,6 +266,7 @@ const float32_t twiddleCoef_32[64] =
     0.923879533f, -0.382683432f,
     0.980785280f, -0.195090322f
 };
+#endif
 
 /**
 * \par
@@ -277,6 +283,7 @@ const float32_t twiddleCoef_32[64] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_64)
 const float32_t twiddleCoef_64[128] =
 {
     1.000000000f,  0.000000000f,
@@ -344,6 +351,7 @@ const float32_t twiddleCoef_64[128] =
     0.980785280f, -0.195090322f,
     0.995184727f, -0.098017140f
 };
+#endif
 
 /**
 * \par
@@ -361,6 +369,7 @@ const float32_t twiddleCoef_64[128] =
 *
 */
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_128)
 const float32_t twiddleCoef_128[256] =
 {
     1.000000000f,  0.000000000f,
@@ -492,6 +501,7 @@ const float32_t twiddleCoef_128[256] =
     0.995184727f, -0.098017140f,
     0.998795456f, -0.049067674f
 };
+#endif
 
 /**
 * \par
@@ -508,6 +518,7 @@ const float32_t twiddleCoef_128[256] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_256)
 const float32_t twiddleCoef_256[512] =
 {
     1.000000000f,  0.000000000f,
@@ -767,6 +778,7 @@ const float32_t twiddleCoef_256[512] =
     0.998795456f, -0.049067674f,
     0.999698819f, -0.024541229f
 };
+#endif
 
 /**
 * \par
@@ -783,6 +795,7 @@ const float32_t twiddleCoef_256[512] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_512)
 const float32_t twiddleCoef_512[1024] =
 {
     1.000000000f,  0.000000000f,
@@ -1298,6 +1311,7 @@ const float32_t twiddleCoef_512[1024] =
     0.999698819f, -0.024541229f,
     0.999924702f, -0.012271538f
 };
+#endif
 /**
 * \par
 * Example code for Floating-point Twiddle factors Generation:
@@ -1313,6 +1327,7 @@ const float32_t twiddleCoef_512[1024] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_1024)
 const float32_t twiddleCoef_1024[2048] =
 {
     1.000000000f,  0.000000000f,
@@ -2340,6 +2355,7 @@ const float32_t twiddleCoef_1024[2048] =
     0.999924702f, -0.012271538f,
     0.999981175f, -0.006135885f
 };
+#endif
 
 /**
 * \par
@@ -2356,6 +2372,7 @@ const float32_t twiddleCoef_1024[2048] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_2048)
 const float32_t twiddleCoef_2048[4096] =
 {
     1.000000000f,  0.000000000f,
@@ -4407,6 +4424,7 @@ const float32_t twiddleCoef_2048[4096] =
     0.999981175f, -0.006135885f,
     0.999995294f, -0.003067957f
 };
+#endif
 
 /**
 * \par
@@ -4423,6 +4441,7 @@ const float32_t twiddleCoef_2048[4096] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
 const float32_t twiddleCoef_4096[8192] =
 {
     1.000000000f,  0.000000000f,
@@ -8522,6 +8541,7 @@ const float32_t twiddleCoef_4096[8192] =
     0.999995294f, -0.003067957f,
     0.999998823f, -0.001533980f
 };
+#endif
 
 /*
 * @brief  Q31 Twiddle factors Table
@@ -8546,6 +8566,7 @@ const float32_t twiddleCoef_4096[8192] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_16)
 const q31_t twiddleCoef_16_q31[24] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000,
@@ -8561,6 +8582,7 @@ const q31_t twiddleCoef_16_q31[24] =
     ( q31_t )0xA57D8666, ( q31_t )0xA57D8666,
     ( q31_t )0xCF043AB2, ( q31_t )0x89BE50C3
 };
+#endif
 
 /**
 * \par
@@ -8580,6 +8602,7 @@ const q31_t twiddleCoef_16_q31[24] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_32)
 const q31_t twiddleCoef_32_q31[48] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000,
@@ -8607,6 +8630,7 @@ const q31_t twiddleCoef_32_q31[48] =
     ( q31_t )0xCF043AB2, ( q31_t )0x89BE50C3,
     ( q31_t )0xE70747C3, ( q31_t )0x8275A0C0
 };
+#endif
 
 /**
 * \par
@@ -8626,6 +8650,7 @@ const q31_t twiddleCoef_32_q31[48] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_64)
 const q31_t twiddleCoef_64_q31[96] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7F62368F,
@@ -8661,6 +8686,7 @@ const q31_t twiddleCoef_64_q31[96] =
     ( q31_t )0xDAD7F3A2, ( q31_t )0x8582FAA4, ( q31_t )0xE70747C3,
     ( q31_t )0x8275A0C0, ( q31_t )0xF3742CA1, ( q31_t )0x809DC970
 };
+#endif
 
 /**
 * \par
@@ -8680,6 +8706,7 @@ const q31_t twiddleCoef_64_q31[96] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_128)
 const q31_t twiddleCoef_128_q31[192] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FD8878D,
@@ -8747,6 +8774,7 @@ const q31_t twiddleCoef_128_q31[192] =
     ( q31_t )0xED37EF91, ( q31_t )0x8162AA03, ( q31_t )0xF3742CA1,
     ( q31_t )0x809DC970, ( q31_t )0xF9B82683, ( q31_t )0x80277872
 };
+#endif
 
 /**
 * \par
@@ -8766,6 +8794,7 @@ const q31_t twiddleCoef_128_q31[192] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_256)
 const q31_t twiddleCoef_256_q31[384] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FF62182,
@@ -8897,6 +8926,7 @@ const q31_t twiddleCoef_256_q31[384] =
     ( q31_t )0xF6956FB6, ( q31_t )0x8058C94C, ( q31_t )0xF9B82683,
     ( q31_t )0x80277872, ( q31_t )0xFCDBD541, ( q31_t )0x8009DE7D
 };
+#endif
 
 /**
 * \par
@@ -8916,6 +8946,7 @@ const q31_t twiddleCoef_256_q31[384] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_512)
 const q31_t twiddleCoef_512_q31[768] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFD885A,
@@ -9175,6 +9206,7 @@ const q31_t twiddleCoef_512_q31[768] =
     ( q31_t )0xFB49E6A2, ( q31_t )0x80163440, ( q31_t )0xFCDBD541,
     ( q31_t )0x8009DE7D, ( q31_t )0xFE6DE2E0, ( q31_t )0x800277A5
 };
+#endif
 
 /**
 * \par
@@ -9194,6 +9226,7 @@ const q31_t twiddleCoef_512_q31[768] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_1024)
 const q31_t twiddleCoef_1024_q31[1536] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFF6216,
@@ -9709,6 +9742,7 @@ const q31_t twiddleCoef_1024_q31[1536] =
     ( q31_t )0xFDA4D928, ( q31_t )0x80058D2E, ( q31_t )0xFE6DE2E0,
     ( q31_t )0x800277A5, ( q31_t )0xFF36F078, ( q31_t )0x80009DE9
 };
+#endif
 
 /**
 * \par
@@ -9728,6 +9762,7 @@ const q31_t twiddleCoef_1024_q31[1536] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_2048)
 const q31_t twiddleCoef_2048_q31[3072] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFFD885,
@@ -10755,6 +10790,7 @@ const q31_t twiddleCoef_2048_q31[3072] =
     ( q31_t )0xFED2694F, ( q31_t )0x8001634D, ( q31_t )0xFF36F078,
     ( q31_t )0x80009DE9, ( q31_t )0xFF9B781D, ( q31_t )0x8000277A
 };
+#endif
 
 /**
 * \par
@@ -10774,6 +10810,7 @@ const q31_t twiddleCoef_2048_q31[3072] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_4096)
 const q31_t twiddleCoef_4096_q31[6144] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFFF621,
@@ -12825,6 +12862,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
     ( q31_t )0xFF69343E, ( q31_t )0x800058D3, ( q31_t )0xFF9B781D,
     ( q31_t )0x8000277A, ( q31_t )0xFFCDBC0A, ( q31_t )0x800009DE
 };
+#endif
 
 
 
@@ -12851,6 +12889,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_16)
 const q15_t twiddleCoef_16_q15[24] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000,
@@ -12866,6 +12905,7 @@ const q15_t twiddleCoef_16_q15[24] =
     ( q15_t )0xA57D, ( q15_t )0xA57D,
     ( q15_t )0xCF04, ( q15_t )0x89BE
 };
+#endif
 
 /**
 * \par
@@ -12885,6 +12925,7 @@ const q15_t twiddleCoef_16_q15[24] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
 const q15_t twiddleCoef_32_q15[48] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000,
@@ -12912,6 +12953,7 @@ const q15_t twiddleCoef_32_q15[48] =
     ( q15_t )0xCF04, ( q15_t )0x89BE,
     ( q15_t )0xE707, ( q15_t )0x8275
 };
+#endif
 
 /**
 * \par
@@ -12931,6 +12973,7 @@ const q15_t twiddleCoef_32_q15[48] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
 const q15_t twiddleCoef_64_q15[96] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7F62, ( q15_t )0x0C8B,
@@ -12958,6 +13001,7 @@ const q15_t twiddleCoef_64_q15[96] =
     ( q15_t )0xCF04, ( q15_t )0x89BE, ( q15_t )0xDAD7, ( q15_t )0x8582,
     ( q15_t )0xE707, ( q15_t )0x8275, ( q15_t )0xF374, ( q15_t )0x809D
 };
+#endif
 
 /**
 * \par
@@ -12977,6 +13021,7 @@ const q15_t twiddleCoef_64_q15[96] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
 const q15_t twiddleCoef_128_q15[192] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FD8, ( q15_t )0x0647,
@@ -13028,6 +13073,7 @@ const q15_t twiddleCoef_128_q15[192] =
     ( q15_t )0xE707, ( q15_t )0x8275, ( q15_t )0xED37, ( q15_t )0x8162,
     ( q15_t )0xF374, ( q15_t )0x809D, ( q15_t )0xF9B8, ( q15_t )0x8027
 };
+#endif
 
 /**
 * \par
@@ -13047,6 +13093,7 @@ const q15_t twiddleCoef_128_q15[192] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
 const q15_t twiddleCoef_256_q15[384] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FF6, ( q15_t )0x0324,
@@ -13146,6 +13193,7 @@ const q15_t twiddleCoef_256_q15[384] =
     ( q15_t )0xF374, ( q15_t )0x809D, ( q15_t )0xF695, ( q15_t )0x8058,
     ( q15_t )0xF9B8, ( q15_t )0x8027, ( q15_t )0xFCDB, ( q15_t )0x8009
 };
+#endif
 
 /**
 * \par
@@ -13165,6 +13213,7 @@ const q15_t twiddleCoef_256_q15[384] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
 const q15_t twiddleCoef_512_q15[768] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFD, ( q15_t )0x0192,
@@ -13360,6 +13409,7 @@ const q15_t twiddleCoef_512_q15[768] =
     ( q15_t )0xF9B8, ( q15_t )0x8027, ( q15_t )0xFB49, ( q15_t )0x8016,
     ( q15_t )0xFCDB, ( q15_t )0x8009, ( q15_t )0xFE6D, ( q15_t )0x8002
 };
+#endif
 
 /**
 * \par
@@ -13379,6 +13429,7 @@ const q15_t twiddleCoef_512_q15[768] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
 const q15_t twiddleCoef_1024_q15[1536] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFF, ( q15_t )0x00C9,
@@ -13766,6 +13817,7 @@ const q15_t twiddleCoef_1024_q15[1536] =
     ( q15_t )0xFCDB, ( q15_t )0x8009, ( q15_t )0xFDA4, ( q15_t )0x8005,
     ( q15_t )0xFE6D, ( q15_t )0x8002, ( q15_t )0xFF36, ( q15_t )0x8000
 };
+#endif
 
 /**
 * \par
@@ -13785,6 +13837,7 @@ const q15_t twiddleCoef_1024_q15[1536] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
 const q15_t twiddleCoef_2048_q15[3072] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFF, ( q15_t )0x0064,
@@ -14556,6 +14609,7 @@ const q15_t twiddleCoef_2048_q15[3072] =
     ( q15_t )0xFE6D, ( q15_t )0x8002, ( q15_t )0xFED2, ( q15_t )0x8001,
     ( q15_t )0xFF36, ( q15_t )0x8000, ( q15_t )0xFF9B, ( q15_t )0x8000
 };
+#endif
 
 /**
 * \par
@@ -14575,6 +14629,7 @@ const q15_t twiddleCoef_2048_q15[3072] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
 const q15_t twiddleCoef_4096_q15[6144] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFF, ( q15_t )0x0032,
@@ -16114,6 +16169,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
     ( q15_t )0xFF36, ( q15_t )0x8000, ( q15_t )0xFF69, ( q15_t )0x8000,
     ( q15_t )0xFF9B, ( q15_t )0x8000, ( q15_t )0xFFCD, ( q15_t )0x8000
 };
+#endif
 
 
 /**
@@ -16156,12 +16212,15 @@ const q31_t armRecipTableQ31[64] =
     0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_16)
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH] =
 {
     /* 8x2, size 20 */
     8, 64, 24, 72, 16, 64, 40, 80, 32, 64, 56, 88, 48, 72, 88, 104, 72, 96, 104, 112
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_32)
 const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH] =
 {
     /* 8x4, size 48 */
@@ -16169,7 +16228,9 @@ const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH] =
     80, 144, 96, 192, 104, 208, 112, 152, 120, 216, 136, 192, 144, 160, 168, 208,
     152, 224, 176, 208, 184, 232, 216, 240, 200, 224, 232, 240
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_64)
 const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH] =
 {
     /* radix 8, size 56 */
@@ -16178,7 +16239,9 @@ const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH] =
     184, 464, 224, 280, 232, 344, 240, 408, 248, 472, 296, 352, 304, 416, 312, 480,
     368, 424, 376, 488, 440, 496
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_128)
 const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
 {
     /* 8x2, size 208 */
@@ -16196,7 +16259,9 @@ const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
     792, 864, 808, 904, 816, 864, 824, 920, 840, 864, 856, 880, 872, 944, 888, 1008,
     904, 928, 912, 960, 920, 992, 944, 968, 952, 1000, 968, 992, 984, 1008
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_256)
 const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
 {
     /* 8x4, size 440 */
@@ -16234,7 +16299,9 @@ const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
     1880, 1904, 1888, 1984, 1896, 2000, 1912, 2032, 1904, 2016, 1976, 2032,
     1960, 1968, 2008, 2032, 1992, 2016, 2024, 2032
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_512)
 const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
 {
     /* radix 8, size 448 */
@@ -16274,7 +16341,9 @@ const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
     3064, 4072, 3128, 3632, 3192, 3696, 3256, 3760, 3320, 3824, 3384, 3888,
     3448, 3952, 3512, 4016, 3576, 4080
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_1024)
 const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH] =
 {
     /* 8x2, size 1800 */
@@ -16426,7 +16495,9 @@ const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH] =
     8008, 8032, 8024, 8048, 8056, 8120, 8072, 8096, 8080, 8128, 8088, 8160,
     8112, 8136, 8120, 8168, 8136, 8160, 8152, 8176
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_2048)
 const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH] =
 {
     /* 8x2, size 3808 */
@@ -16768,7 +16839,9 @@ const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH] =
     16248, 16368, 16264, 16288, 16280, 16296, 16296, 16304, 16344, 16368,
     16328, 16352, 16360, 16368
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_4096)
 const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] =
 {
     /* radix 8, size 4032 */
@@ -17139,21 +17212,27 @@ const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] =
     31096, 31544, 31160, 32056, 31224, 32568, 31672, 32120, 31736, 32632,
     32248, 32696
 };
+#endif
 
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_16)
 const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] =
 {
     /* radix 4, size 12 */
     8, 64, 16, 32, 24, 96, 40, 80, 56, 112, 88, 104
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_32)
 const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH] =
 {
     /* 4x2, size 24 */
     8, 128, 16, 64, 24, 192, 40, 160, 48, 96, 56, 224, 72, 144,
     88, 208, 104, 176, 120, 240, 152, 200, 184, 232
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_64)
 const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH] =
 {
     /* radix 4, size 56 */
@@ -17161,7 +17240,9 @@ const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_L
     112, 224, 120, 480, 136, 272, 152, 400, 168, 336, 176, 208, 184, 464, 200, 304, 216, 432,
     232, 368, 248, 496, 280, 392, 296, 328, 312, 456, 344, 424, 376, 488, 440, 472
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_128)
 const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH] =
 {
     /* 4x2, size 112 */
@@ -17172,7 +17253,9 @@ const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE
     472, 880, 488, 752, 504, 1008, 536, 776, 552, 648, 568, 904, 600, 840, 616, 712, 632, 968,
     664, 808, 696, 936, 728, 872, 760, 1000, 824, 920, 888, 984
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_256)
 const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH] =
 {
     /* radix 4, size 240 */
@@ -17191,7 +17274,9 @@ const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE
     1368, 1704, 1384, 1448, 1400, 1960, 1432, 1640, 1464, 1896, 1496, 1768, 1528, 2024, 1592, 1816,
     1624, 1688, 1656, 1944, 1720, 1880, 1784, 2008, 1912, 1976
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_512)
 const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH] =
 {
     /* 4x2, size 480 */
@@ -17225,7 +17310,9 @@ const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE
     3128, 3608, 3160, 3352, 3192, 3864, 3256, 3736, 3288, 3480, 3320, 3992, 3384, 3672, 3448, 3928,
     3512, 3800, 3576, 4056, 3704, 3896, 3832, 4024
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_1024)
 const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] =
 {
     /* radix 4, size 992 */
@@ -17299,7 +17386,9 @@ const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TAB
     6872, 7000, 6904, 8024, 6968, 7384, 7032, 7896, 7096, 7640, 7160, 8152, 7288, 7736,
     7352, 7480, 7416, 7992, 7544, 7864, 7672, 8120, 7928, 8056
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_2048)
 const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] =
 {
     /* 4x2, size 1984 */
@@ -17455,7 +17544,9 @@ const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TAB
     14456, 15416, 14520, 14904, 14584, 15928, 14712, 15672, 14776, 15160, 14840, 16184,
     14968, 15544, 15096, 16056, 15224, 15800, 15352, 16312, 15608, 15992, 15864, 16248
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_4096)
 const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] =
 {
     /* radix 4, size 4032 */
@@ -17793,6 +17884,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
     30456, 32184, 30584, 31672, 30712, 32696, 30968, 31864, 31096, 31352, 31224, 32376,
     31480, 32120, 31736, 32632, 32248, 32504
 };
+#endif
 
 /**
 * \par
@@ -17802,6 +17894,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
 * \par
 * Real and Imag values are in interleaved fashion
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_32)
 const float32_t twiddleCoef_rfft_32[32] =
 {
     0.000000000f,  1.000000000f,
@@ -17821,7 +17914,9 @@ const float32_t twiddleCoef_rfft_32[32] =
     0.382683432f, -0.923879533f,
     0.195090322f, -0.980785280f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_64)
 const float32_t twiddleCoef_rfft_64[64] =
 {
     0.000000000000000f,  1.000000000000000f,
@@ -17857,7 +17952,9 @@ const float32_t twiddleCoef_rfft_64[64] =
     0.195090322016129f, -0.980785280403230f,
     0.098017140329561f, -0.995184726672197f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_128)
 const float32_t twiddleCoef_rfft_128[128] =
 {
     0.000000000f,  1.000000000f,
@@ -17925,7 +18022,9 @@ const float32_t twiddleCoef_rfft_128[128] =
     0.098017140f, -0.995184727f,
     0.049067674f, -0.998795456f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_256)
 const float32_t twiddleCoef_rfft_256[256] =
 {
     0.000000000f,  1.000000000f,
@@ -18057,7 +18156,9 @@ const float32_t twiddleCoef_rfft_256[256] =
     0.049067674f, -0.998795456f,
     0.024541229f, -0.999698819f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_512)
 const float32_t twiddleCoef_rfft_512[512] =
 {
     0.000000000f,  1.000000000f,
@@ -18317,7 +18418,9 @@ const float32_t twiddleCoef_rfft_512[512] =
     0.024541229f, -0.999698819f,
     0.012271538f, -0.999924702f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024)
 const float32_t twiddleCoef_rfft_1024[1024] =
 {
     0.000000000f,  1.000000000f,
@@ -18833,7 +18936,9 @@ const float32_t twiddleCoef_rfft_1024[1024] =
     0.012271538f, -0.999924702f,
     0.006135885f, -0.999981175f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048)
 const float32_t twiddleCoef_rfft_2048[2048] =
 {
     0.000000000f,  1.000000000f,
@@ -19861,7 +19966,9 @@ const float32_t twiddleCoef_rfft_2048[2048] =
     0.006135885f, -0.999981175f,
     0.003067957f, -0.999995294f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096)
 const float32_t twiddleCoef_rfft_4096[4096] =
 {
     0.000000000f,  1.000000000f,
@@ -21913,6 +22020,7 @@ const float32_t twiddleCoef_rfft_4096[4096] =
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+#endif
 
 
 /**
@@ -22213,3 +22321,108 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] =
     -5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411,
     -2009, -1608, -1206, -804, -402, 0
 };
+
+/**
+ * \par
+ * Table of atan(n/32) for n = 0..32, in Q31 (1.31 fixed-point format).
+ * Used as the base angle by the arctangent functions:
+ * <pre>
+ * for(n = 0; n < 33; n++)
+ * {
+ *  atanTable[n] = atan(n / 32.0);
+ * } </pre>
+ * converted to Q31 and rounded to the nearest integer value.
+ */
+const q31_t atanTable_q31[33] =
+{
+    0x00000000, 0x03FFAAB7, 0x07FD56EE, 0x0BF70C13, 0x0FEADD4D, 0x13D6EEE9,
+    0x17B97B4C, 0x1B90D753, 0x1F5B75F9, 0x2317EB46, 0x26C4EE6E, 0x2A615B33,
+    0x2DEC3284, 0x31649A73, 0x34C9DD88, 0x381B6993, 0x3B58CE0B, 0x3E81BA17,
+    0x4195FA53, 0x44957670, 0x47802EAF, 0x4A563965, 0x4D17C073, 0x4FC4FEE2,
+    0x525E3E8D, 0x54E3D5EE, 0x5756261C, 0x59B598E5, 0x5C029F16, 0x5E3DAEF5,
+    0x606742DC, 0x627FD7FD, 0x6487ED51
+};
+
+/**
+ * \par
+ * Table of atan(n/32) for n = 0..32, in Q15 (1.15 fixed-point format),
+ * generated as the Q31 table above.
+ */
+const q15_t atanTable_q15[33] =
+{
+    0x0000, 0x0400, 0x07FD, 0x0BF7, 0x0FEB, 0x13D7, 0x17B9, 0x1B91,
+    0x1F5B, 0x2318, 0x26C5, 0x2A61, 0x2DEC, 0x3165, 0x34CA, 0x381B,
+    0x3B59, 0x3E82, 0x4196, 0x4495, 0x4780, 0x4A56, 0x4D18, 0x4FC5,
+    0x525E, 0x54E4, 0x5756, 0x59B6, 0x5C03, 0x5E3E, 0x6067, 0x6280,
+    0x6488
+};
+
+/**
+ * \par
+ * Table of -ln(armRecipTableQ31[n] / 2^31) for n = 0..63, in Q31 (1.31
+ * fixed-point format).  The logarithm is taken of the rounded reciprocal
+ * table entries, so that the two tables cancel exactly in the logarithm
+ * function.
+ */
+const q31_t logTable_q31[64] =
+{
+    0x00FD0938, 0x02F53A8C, 0x04E5C7B1, 0x06CEEB11, 0x08B0DC84, 0x0A8BD171,
+    0x0C5FFCF7, 0x0E2D900C, 0x0FF4B99B, 0x11B5A69F, 0x13708245, 0x152575FA,
+    0x16D4A98C, 0x187E4339, 0x1A2267CB, 0x1BC13AA2, 0x1D5ADDCA, 0x1EEF7210,
+    0x207F1709, 0x2209EB2A, 0x23900BCC, 0x25119546, 0x268EA2ED, 0x28074F23,
+    0x297BB367, 0x2AEBE85E, 0x2C5805D7, 0x2DC022D6, 0x2F2455A4, 0x3084B3D0,
+    0x31E15238, 0x333A4511, 0x348F9FEE, 0x35E175C8, 0x372FD906, 0x387ADB7B,
+    0x39C28E74, 0x3B0702BA, 0x3C484898, 0x3D866FDD, 0x3EC187EA, 0x3FF99FA5,
+    0x412EC590, 0x426107C3, 0x439073F2, 0x44BD176E, 0x45E6FF2F, 0x470E37CD,
+    0x4832CD92, 0x4954CC6E, 0x4A744004, 0x4B9133A8, 0x4CABB260, 0x4DC3C6EF,
+    0x4ED97BD0, 0x4FECDB39, 0x50FDEF1E, 0x520CC136, 0x53195AFF, 0x5423C5AF,
+    0x552C0A53, 0x563231B1, 0x57364463, 0x58384ACF
+};
+
+/**
+ * \par
+ * Table of 2^(n/64 - 1) for n = 0..63, in Q31 (1.31 fixed-point format):
+ * <pre>
+ * for(n = 0; n < 64; n++)
+ * {
+ *  exp2Table[n] = pow(2, n / 64.0 - 1);
+ * } </pre>
+ * converted to Q31 and rounded to the nearest integer value.
+ */
+const q31_t exp2Table_q31[64] =
+{
+    0x40000000, 0x40B268FA, 0x4166C34C, 0x421D1462, 0x42D561B4, 0x438FB0CB,
+    0x444C0740, 0x450A6ABB, 0x45CAE0F2, 0x468D6FAE, 0x47521CC6, 0x4818EE22,
+    0x48E1E9BA, 0x49AD1598, 0x4A7A77D4, 0x4B4A169C, 0x4C1BF829, 0x4CF022CA,
+    0x4DC69CDD, 0x4E9F6CD4, 0x4F7A9930, 0x50582888, 0x51382182, 0x521A8AD7,
+    0x52FF6B55, 0x53E6C9DA, 0x54D0AD5A, 0x55BD1CDB, 0x56AC1F75, 0x579DBC57,
+    0x5891FAC1, 0x5988E209, 0x5A82799A, 0x5B7EC8F2, 0x5C7DD7A4, 0x5D7FAD59,
+    0x5E8451D0, 0x5F8BCCDB, 0x60962665, 0x61A3666D, 0x62B39509, 0x63C6BA64,
+    0x64DCDEC3, 0x65F60A7F, 0x6712460B, 0x683199ED, 0x69540EC9, 0x6A79AD56,
+    0x6BA27E65, 0x6CCE8AE1, 0x6DFDDBCC, 0x6F307A41, 0x70666F76, 0x719FC4B9,
+    0x72DC8374, 0x741CB528, 0x75606374, 0x76A7980F, 0x77F25CCE, 0x7940BB9E,
+    0x7A92BE8B, 0x7BE86FBA, 0x7D41D96E, 0x7E9F0606
+};
+
+/**
+ * \par
+ * Initial estimates of the inverse square root, in Q30 (2.30 fixed-point
+ * format), for the normalised inputs [0.25 1) split into 48 segments of
+ * width 1/64.  Each entry is taken at the centre of its segment:
+ * <pre>
+ * for(n = 0; n < 48; n++)
+ * {
+ *  rsqrtTable[n] = 1 / sqrt((n + 16.5) / 64.0);
+ * } </pre>
+ */
+const q31_t rsqrtTable_q31[48] =
+{
+    0x7E0BB221, 0x7A64336B, 0x77099EFB, 0x73F1F68D, 0x7114F644, 0x6E6BB6E9,
+    0x6BF06762, 0x699E16D0, 0x67708AF9, 0x65641FAE, 0x6375AD16, 0x61A27320,
+    0x5FE808FC, 0x5E444FAF, 0x5CB56711, 0x5B39A4C7, 0x59CF8CBC, 0x5875CADE,
+    0x572B2DE0, 0x55EEA2C4, 0x54BF311A, 0x539BF7CD, 0x52842A5F, 0x51770E8F,
+    0x5073FA50, 0x4F7A5202, 0x4E8986EA, 0x4DA115DA, 0x4CC08605, 0x4BE767F5,
+    0x4B1554A6, 0x4A49ECB3, 0x4984D7A4, 0x48C5C34B, 0x480C6332, 0x4758701C,
+    0x46A9A794, 0x45FFCB80, 0x455AA1CB, 0x44B9F40B, 0x441D8F3B, 0x43854374,
+    0x42F0E3AE, 0x4260458E, 0x41D3412A, 0x4149B0E5, 0x40C3713B, 0x404060A1
+};
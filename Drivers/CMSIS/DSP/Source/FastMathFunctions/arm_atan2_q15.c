@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q15.c
+ * Description:  Q15 four-quadrant arctangent function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Q15 four-quadrant arctangent.
+ * @param[in] y  ordinate of the point.
+ * @param[in] x  abscissa of the point.
+ * @return  atan2(y, x) in radians, in Q2.13 format.
+ *
+ * All the intermediate products fit in 32 bits.  One Newton-Raphson iteration
+ * is used for the reciprocal and <code>atan(s)</code> is approximated by
+ * <code>s</code>.
+ */
+
+q15_t arm_atan2_q15(
+    q15_t y,
+    q15_t x )
+{
+    q31_t ax, ay;                                  /* Magnitudes of the inputs */
+    q31_t a, b;                                    /* Larger and smaller magnitude */
+    q31_t lz, index, e;                            /* Normalisation, table index, exponent */
+    q31_t r, m, mr;                                /* Reciprocal estimate and denominator */
+    q31_t num, den;                                /* Numerator and denominator of s */
+    q31_t angle;                                   /* Output angle */
+
+    ax = ( x < 0 ) ? -( q31_t ) x : ( q31_t ) x;
+    ay = ( y < 0 ) ? -( q31_t ) y : ( q31_t ) y;
+
+    if( ( ax | ay ) == 0 )
+    {
+        return ( 0 );
+    }
+
+    /* Reduce to the first octant */
+    if( ay > ax )
+    {
+        a = ay;
+        b = ax;
+    }
+    else
+    {
+        a = ax;
+        b = ay;
+    }
+
+    /* Normalise a to [0.5 1) and scale b by the same amount */
+    lz = ( q31_t ) __CLZ( a ) - 17;
+
+    if( lz >= 0 )
+    {
+        a <<= lz;
+        b <<= lz;
+    }
+    else
+    {
+        a >>= 1;
+        b >>= 1;
+    }
+
+    /* Base point index, from a coarse estimate of b/a */
+    r = armRecipTableQ15[( a >> 8 ) & INDEX_MASK];
+    index = ( b * r + 0x800000 ) >> 24;
+
+    if( index > 32 )
+    {
+        index = 32;
+    }
+
+    /* s = (32*b - n*a) / (32*a + n*b) */
+    num = ( b << 5 ) - index * a;
+    den = ( a << 5 ) + index * b;
+
+    /* Normalise the denominator to [0.5 1) */
+    e = ( den >= 0x100000 ) ? 6 : 5;
+    m = den >> e;
+
+    /* Reciprocal of the denominator in Q14, one Newton-Raphson iteration */
+    r = armRecipTableQ15[( m >> 8 ) & INDEX_MASK];
+    mr = ( m * r ) >> 15;
+    r = ( r * ( 0x8000 - mr ) ) >> 14;
+
+    /* First octant angle in Q15, with atan(s) = s, converted to Q2.13 */
+    angle = ( atanTable_q15[index] + ( ( num * r ) >> ( 14 + e ) ) + 2 ) >> 2;
+
+    /* Fold back into the full circle */
+    if( ay > ax )
+    {
+        angle = 12868 - angle;
+    }
+
+    if( x < 0 )
+    {
+        angle = 25736 - angle;
+    }
+
+    if( y < 0 )
+    {
+        angle = -angle;
+    }
+
+    return ( ( q15_t ) angle );
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Q31 four-quadrant arctangent function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Arctangent of Two Arguments
+ *
+ * Computes the angle of the point <code>(x, y)</code> in all four quadrants, that is
+ * <code>atan2(y, x)</code>.  There are separate functions for Q15 and Q31 data types.
+ * The inputs share the same format and only their ratio matters.  The result is in
+ * radians, in the range [-pi pi], and is returned in Q2.29 format for the Q31 version
+ * and in Q2.13 format for the Q15 version.  <code>atan2(0, 0)</code> returns 0.
+ *
+ * The functions do not divide.  The magnitudes of x and y are first reduced to the
+ * first octant, with <code>b <= a</code>, and the ratio is split into a base point
+ * <code>c = n/32</code> and a small remainder:
+ * <pre>
+ *     atan(b / a) = atan(c) + atan(s),    s = (b - c*a) / (a + c*b)
+ * </pre>
+ * The index <code>n</code> is picked from a coarse estimate of <code>b/a</code>
+ * made with the reciprocal table, <code>atan(c)</code> is read from a table of 33
+ * values and <code>1/(a + c*b)</code> is refined by Newton-Raphson iterations.
+ * As <code>|s| < 0.024</code>, a short odd polynomial is enough for
+ * <code>atan(s)</code>.  The octant is then folded back into the full circle.
+ *
+ * The maximum error is 2 LSB for the Q31 version and 1 LSB for the Q15 version.
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Q31 four-quadrant arctangent.
+ * @param[in] y  ordinate of the point.
+ * @param[in] x  abscissa of the point.
+ * @return  atan2(y, x) in radians, in Q2.29 format.
+ */
+
+q31_t arm_atan2_q31(
+    q31_t y,
+    q31_t x )
+{
+    uint32_t ax, ay;                               /* Magnitudes of the inputs */
+    uint32_t a, b;                                 /* Larger and smaller magnitude */
+    uint32_t lz, index, e;                         /* Normalisation, table index, exponent */
+    q31_t r, m, mr;                                /* Reciprocal estimate and denominator */
+    q31_t s, s2, p;                                /* Remainder and polynomial terms */
+    q63_t num, den;                                /* Numerator and denominator of s */
+    q31_t angle;                                   /* Output angle */
+
+    ax = ( x < 0 ) ? ( 0U - ( uint32_t ) x ) : ( uint32_t ) x;
+    ay = ( y < 0 ) ? ( 0U - ( uint32_t ) y ) : ( uint32_t ) y;
+
+    if( ( ax | ay ) == 0U )
+    {
+        return ( 0 );
+    }
+
+    /* Reduce to the first octant */
+    if( ay > ax )
+    {
+        a = ay;
+        b = ax;
+    }
+    else
+    {
+        a = ax;
+        b = ay;
+    }
+
+    /* Normalise a to [0.5 1) and scale b by the same amount */
+    lz = __CLZ( a );
+    a = ( a << lz ) >> 1;
+    b = ( b << lz ) >> 1;
+
+    /* Base point index, from a coarse estimate of b/a */
+    r = armRecipTableQ31[( a >> 24 ) & INDEX_MASK];
+    index = ( uint32_t )( ( ( q63_t ) b * r + 0x0080000000000000LL ) >> 56 );
+
+    if( index > 32U )
+    {
+        index = 32U;
+    }
+
+    /* s = (32*b - n*a) / (32*a + n*b) */
+    num = ( ( q63_t ) b << 5 ) - ( q63_t ) index * a;
+    den = ( ( q63_t ) a << 5 ) + ( q63_t ) index * b;
+
+    /* Normalise the denominator to [0.5 1) */
+    e = ( den >= 0x1000000000LL ) ? 6U : 5U;
+    m = ( q31_t )( den >> e );
+
+    /* Reciprocal of the denominator in Q30, two Newton-Raphson iterations */
+    r = armRecipTableQ31[( m >> 24 ) & INDEX_MASK];
+    mr = ( q31_t )( ( ( q63_t ) m * r ) >> 31 );
+    r = ( q31_t )( ( ( q63_t ) r * ( 0x80000000LL - mr ) ) >> 30 );
+    mr = ( q31_t )( ( ( q63_t ) m * r ) >> 31 );
+    r = ( q31_t )( ( ( q63_t ) r * ( 0x80000000LL - mr ) ) >> 30 );
+
+    s = ( q31_t )( ( num * r ) >> ( 30U + e ) );
+
+    /* atan(s) = s - s^3/3 + s^5/5 */
+    s2 = ( q31_t )( ( ( q63_t ) s * s ) >> 31 );
+    p = ( q31_t )( ( ( ( q63_t ) s2 * s2 ) >> 31 ) * 0x1999999A >> 31 );
+    p -= ( q31_t )( ( ( q63_t ) s2 * 0x2AAAAAAB ) >> 31 );
+    s += ( q31_t )( ( ( q63_t ) s * p ) >> 31 );
+
+    /* First octant angle in Q31, converted to Q2.29 */
+    angle = ( atanTable_q31[index] + s + 2 ) >> 2;
+
+    /* Fold back into the full circle */
+    if( ay > ax )
+    {
+        angle = 0x3243F6A9 - angle;
+    }
+
+    if( x < 0 )
+    {
+        angle = 0x6487ED51 - angle;
+    }
+
+    if( y < 0 )
+    {
+        angle = -angle;
+    }
+
+    return ( angle );
+}
+
+/**
+ * @} end of atan2 group
+ */
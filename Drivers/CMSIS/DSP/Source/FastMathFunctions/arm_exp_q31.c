@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp_q31.c
+ * Description:  Q31 exponential function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup exp Exponential
+ *
+ * Computes the natural exponential <code>e^x</code> of a fixed-point value.
+ * The input is in Q5.26 format, in the range [-32 32), and the result in Q31
+ * format, so that <code>arm_exp_q31()</code> is the inverse of
+ * <code>arm_log_q31()</code>.  Inputs of 0 and above saturate to
+ * <code>0x7FFFFFFF</code> and inputs below about -21.5 underflow to 0.
+ *
+ * The input is converted to base 2, <code>x*log2(e) = n + i/64 + g</code>,
+ * with <code>n</code> an integer, <code>i</code> in [0 63] and
+ * <code>0 <= g < 1/64</code>.  Then
+ * <pre>
+ *     e^x = 2^(n+1) * 2^(i/64-1) * e^(g*ln(2))
+ * </pre>
+ * where <code>2^(i/64-1)</code> is read from a table of 64 values, the last
+ * factor is a fourth-order Taylor polynomial and the power of two is a shift.
+ *
+ * The maximum error is 2 LSB.
+ */
+
+/**
+ * @addtogroup exp
+ * @{
+ */
+
+/**
+ * @brief  Q31 natural exponential.
+ * @param[in] x  input value in Q5.26 format.
+ * @return  e^x in Q31 format.
+ */
+
+q31_t arm_exp_q31(
+    q31_t x )
+{
+    q63_t y;                                       /* x * log2(e) in Q57 */
+    q63_t acc;                                     /* Unscaled result in Q62 */
+    q31_t n;                                       /* Integer part of y */
+    uint32_t index, shift;                         /* Table index and output shift */
+    q31_t g, u, u2, p;                             /* Remainder and polynomial terms */
+    q31_t t, out;                                  /* Table value and output value */
+
+    if( x >= 0 )
+    {
+        return ( 0x7FFFFFFF );
+    }
+
+    /* y = x * log2(e) = x + x * (log2(e) - 1), in Q57 */
+    y = ( ( q63_t ) x << 31 ) + ( q63_t ) x * 0x38AA3B29;
+
+    /* Split y into the integer part, the table index and the remainder */
+    n = ( q31_t )( y >> 57 );
+    y &= 0x01FFFFFFFFFFFFFFLL;
+    index = ( uint32_t )( y >> 51 );
+    g = ( q31_t )( ( y & 0x0007FFFFFFFFFFFFLL ) >> 26 );
+
+    /* e^u - 1 with u = g * ln(2), in Q37 as u < 1/64 */
+    u = ( q31_t )( ( ( q63_t ) g * 0x58B90BFC + 0x1000000 ) >> 25 );
+    u2 = ( q31_t )( ( ( q63_t ) u * u ) >> 37 );
+    p = u + ( u2 >> 1 );
+    p += ( q31_t )( ( ( ( ( q63_t ) u2 * u ) >> 37 ) * 0x15555555 ) >> 31 );
+    p += ( q31_t )( ( ( ( ( q63_t ) u2 * u2 ) >> 37 ) * 0x05555555 ) >> 31 );
+
+    /* 2^(i/64-1) * e^u, in [0.5 1] */
+    t = exp2Table_q31[index];
+    acc = ( ( q63_t ) t << 31 ) + ( ( ( q63_t ) t * p ) >> 6 );
+
+    /* Scale by 2^(n+1), with n <= -1, and round to Q31 */
+    shift = ( uint32_t )( 30 - n );
+
+    if( shift > 62U )
+    {
+        out = 0;
+    }
+    else
+    {
+        out = clip_q63_to_q31( ( acc + ( 1LL << ( shift - 1U ) ) ) >> shift );
+    }
+
+    return ( out );
+}
+
+/**
+ * @} end of exp group
+ */
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log_q31.c
+ * Description:  Q31 natural logarithm function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup log Natural Logarithm
+ *
+ * Computes the natural logarithm of a fixed-point value.  The input is in Q31
+ * format, in the range (0 1), and the result in Q5.26 format, in the range
+ * [-21.5 0].
+ *
+ * The input is normalised to <code>2^-k * (1 + f) / 2</code>, with
+ * <code>0 <= f < 1</code>.  The reciprocal table gives an estimate
+ * <code>r</code> of <code>1/(1 + f)</code> from the top six bits of
+ * <code>f</code>, and
+ * <pre>
+ *     ln(in) = -ln(r) + ln(1 + t) - (k + 1) * ln(2),    t = (1 + f) * r - 1
+ * </pre>
+ * where <code>-ln(r)</code> is read from a table of 64 values computed from the
+ * rounded reciprocal table.  As <code>|t| < 1/128</code>, a third-order Taylor
+ * polynomial is enough for <code>ln(1 + t)</code>.
+ *
+ * The maximum error is 1 LSB.
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/**
+ * @brief  Q31 natural logarithm.
+ * @param[in]  in    input value.  The range of the input value is (0 +1) or 0x00000001 to 0x7FFFFFFF.
+ * @param[out] pOut  natural logarithm of the input value, in Q5.26 format.
+ * @return The function returns ARM_MATH_SUCCESS if the input value is positive
+ * and ARM_MATH_ARGUMENT_ERROR otherwise.  For inputs of zero or below, the function
+ * returns <code>*pOut = 0x80000000</code> (-32).
+ */
+
+arm_status arm_log_q31(
+    q31_t in,
+    q31_t *pOut )
+{
+    uint32_t lz, index;                            /* Normalisation and table index */
+    q31_t m;                                       /* Normalised input */
+    q31_t t, t2, t3;                               /* Remainder and polynomial terms */
+    q31_t lnf;                                     /* ln(1 + f) in Q31 */
+    q63_t acc;                                     /* ln(in) in Q31 */
+
+    if( in <= 0 )
+    {
+        *pOut = ( q31_t ) 0x80000000;
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    /* Normalise the input to [0.5 1) */
+    lz = __CLZ( in ) - 1U;
+    m = in << lz;
+
+    /* t = (1 + f) * r - 1, where m is (1 + f) in Q30 */
+    index = ( ( uint32_t ) m >> 24 ) & INDEX_MASK;
+    t = ( q31_t )( ( ( ( q63_t ) m * armRecipTableQ31[index] ) >> 30 ) - 0x80000000LL );
+
+    /* ln(1 + f) = -ln(r) + t - t^2/2 + t^3/3 */
+    t2 = ( q31_t )( ( ( q63_t ) t * t ) >> 31 );
+    t3 = ( q31_t )( ( ( q63_t ) t2 * t ) >> 31 );
+    lnf = logTable_q31[index] + t - ( t2 >> 1 );
+    lnf += ( q31_t )( ( ( q63_t ) t3 * 0x2AAAAAAB ) >> 31 );
+
+    /* Subtract (k + 1) * ln(2) and convert to Q5.26 */
+    acc = ( q63_t ) lnf - ( q63_t )( lz + 1U ) * 0x58B90BFC;
+    *pOut = ( q31_t )( ( acc + 16 ) >> 5 );
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of log group
+ */
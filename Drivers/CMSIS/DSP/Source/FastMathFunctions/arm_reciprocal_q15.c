@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_reciprocal_q15.c
+ * Description:  Q15 reciprocal function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Reciprocal
+ * @{
+ */
+
+/**
+ * @brief  Q15 reciprocal.
+ * @param[in]  in      input value.
+ * @param[out] pOut    mantissa of the reciprocal, in Q15 format.
+ * @param[out] pShift  left shift to apply to the mantissa.
+ * @return The function returns ARM_MATH_SUCCESS for nonzero inputs and
+ * ARM_MATH_NANINF when the input is zero.  For a zero input, the function
+ * returns <code>*pOut = 0x7FFF</code> and <code>*pShift = 15</code>.
+ */
+
+arm_status arm_reciprocal_q15(
+    q15_t in,
+    q15_t *pOut,
+    uint8_t *pShift )
+{
+    uint32_t mag;                                  /* Magnitude of the input */
+    uint32_t lz;                                   /* Normalisation shift */
+    uint32_t r, mr;                                /* Reciprocal estimate in Q14 */
+
+    if( in == 0 )
+    {
+        *pOut = 0x7FFF;
+        *pShift = 15U;
+        return ( ARM_MATH_NANINF );
+    }
+
+    mag = ( in < 0 ) ? ( uint32_t ) - in : ( uint32_t ) in;
+
+    /* Normalise the magnitude to [0.5 1) in Q16 */
+    lz = __CLZ( mag ) - 16U;
+    mag <<= lz;
+
+    /* Initial estimate of 1/m in Q14 */
+    r = ( uint32_t ) armRecipTableQ15[( mag >> 9 ) & INDEX_MASK];
+
+    /* Two Newton-Raphson iterations */
+    mr = ( mag * r ) >> 16;
+    r = ( r * ( 0x8000U - mr ) ) >> 14;
+    mr = ( mag * r ) >> 16;
+    r = ( r * ( 0x8000U - mr ) ) >> 14;
+
+    /* 1/m in Q14 is 1/(2*m) in Q15 */
+    if( r > 0x7FFFU )
+    {
+        r = 0x7FFFU;
+    }
+
+    *pOut = ( in < 0 ) ? -( q15_t ) r : ( q15_t ) r;
+    *pShift = ( uint8_t ) lz;
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of Reciprocal group
+ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_reciprocal_q31.c
+ * Description:  Q31 reciprocal function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup Reciprocal Reciprocal
+ *
+ * Computes the reciprocal <code>1/in</code> of a fixed-point value.  There are
+ * separate functions for Q15 and Q31 data types.  As the reciprocal of a
+ * fractional value does not fit in the input format, it is returned as a
+ * normalised mantissa and a left shift:
+ * <pre>
+ *     1/in = out * 2^shift
+ * </pre>
+ * where <code>|out|</code> is in the range (0.5 1] (saturated to the largest
+ * positive value) and <code>shift</code> is in the range [0 31] for Q31 and
+ * [0 15] for Q15.
+ *
+ * The magnitude of the input is normalised to <code>m</code> in [0.5 1).  An
+ * initial estimate of <code>1/m</code> with 7 bits of precision is read from
+ * <code>armRecipTableQ31</code> or <code>armRecipTableQ15</code>, the tables
+ * used by the normalized LMS filters, and refined by Newton-Raphson iterations:
+ * <pre>
+ *     r = r * (2 - m * r)
+ * </pre>
+ * Each iteration doubles the number of correct bits.  The Q31 version runs
+ * three iterations and the Q15 version two.
+ *
+ * The maximum error of the mantissa is 2 LSB for both data types.
+ */
+
+/**
+ * @addtogroup Reciprocal
+ * @{
+ */
+
+/**
+ * @brief  Q31 reciprocal.
+ * @param[in]  in      input value.
+ * @param[out] pOut    mantissa of the reciprocal, in Q31 format.
+ * @param[out] pShift  left shift to apply to the mantissa.
+ * @return The function returns ARM_MATH_SUCCESS for nonzero inputs and
+ * ARM_MATH_NANINF when the input is zero.  For a zero input, the function
+ * returns <code>*pOut = 0x7FFFFFFF</code> and <code>*pShift = 31</code>.
+ */
+
+arm_status arm_reciprocal_q31(
+    q31_t in,
+    q31_t *pOut,
+    uint8_t *pShift )
+{
+    uint32_t mag;                                  /* Magnitude of the input */
+    uint32_t lz;                                   /* Normalisation shift */
+    uint32_t r, mr;                                /* Reciprocal estimate in Q30 */
+    uint32_t i;                                    /* Loop counter */
+
+    if( in == 0 )
+    {
+        *pOut = 0x7FFFFFFF;
+        *pShift = 31U;
+        return ( ARM_MATH_NANINF );
+    }
+
+    mag = ( in < 0 ) ? ( 0U - ( uint32_t ) in ) : ( uint32_t ) in;
+
+    /* Normalise the magnitude to [0.5 1) in Q32 */
+    lz = __CLZ( mag );
+    mag <<= lz;
+
+    /* Initial estimate of 1/m in Q30 */
+    r = ( uint32_t ) armRecipTableQ31[( mag >> 25 ) & INDEX_MASK];
+
+    /* Newton-Raphson iterations */
+    for( i = 0U; i < 3U; i++ )
+    {
+        mr = ( uint32_t )( ( ( uint64_t ) mag * r ) >> 32 );
+        r = ( uint32_t )( ( ( uint64_t ) r * ( 0x80000000U - mr ) ) >> 30 );
+    }
+
+    /* 1/m in Q30 is 1/(2*m) in Q31 */
+    if( r > 0x7FFFFFFFU )
+    {
+        r = 0x7FFFFFFFU;
+    }
+
+    *pOut = ( in < 0 ) ? -( q31_t ) r : ( q31_t ) r;
+    *pShift = ( uint8_t ) lz;
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of Reciprocal group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rsqrt_q31.c
+ * Description:  Q31 inverse square root function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup RSQRT Inverse Square Root
+ *
+ * Computes the inverse square root <code>1/sqrt(in)</code> of a positive Q31
+ * value.  As the result does not fit in the input format, it is returned as a
+ * normalised mantissa and a left shift:
+ * <pre>
+ *     1/sqrt(in) = out * 2^shift
+ * </pre>
+ * where <code>out</code> is in the range (0.5 1] (saturated to
+ * <code>0x7FFFFFFF</code>) and <code>shift</code> is in the range [1 16].
+ *
+ * The input is normalised by an even power of two to <code>m</code> in
+ * [0.25 1).  An initial estimate of <code>1/sqrt(m)</code> is read from a table
+ * of 48 values and refined by three Newton-Raphson iterations:
+ * <pre>
+ *     r = r * (3 - m * r^2) / 2
+ * </pre>
+ * Unlike <code>arm_sqrt_q31()</code>, no floating-point operation is used for the
+ * initial estimate.
+ *
+ * The maximum error of the mantissa is 2 LSB.
+ */
+
+/**
+ * @addtogroup RSQRT
+ * @{
+ */
+
+/**
+ * @brief  Q31 inverse square root.
+ * @param[in]  in      input value.  The range of the input value is (0 +1) or 0x00000001 to 0x7FFFFFFF.
+ * @param[out] pOut    mantissa of the inverse square root, in Q31 format.
+ * @param[out] pShift  left shift to apply to the mantissa.
+ * @return The function returns ARM_MATH_SUCCESS for positive inputs,
+ * ARM_MATH_NANINF for a zero input and ARM_MATH_ARGUMENT_ERROR for negative
+ * inputs.  For a zero input, the function returns <code>*pOut = 0x7FFFFFFF</code>
+ * and <code>*pShift = 16</code>, and for negative inputs <code>*pOut = 0</code>
+ * and <code>*pShift = 0</code>.
+ */
+
+arm_status arm_rsqrt_q31(
+    q31_t in,
+    q31_t *pOut,
+    uint8_t *pShift )
+{
+    uint32_t k;                                    /* Half the normalisation shift */
+    uint32_t m;                                    /* Normalised input */
+    uint32_t r, mr, mr2;                           /* Estimate in Q30 and products */
+    uint32_t i;                                    /* Loop counter */
+
+    if( in <= 0 )
+    {
+        if( in == 0 )
+        {
+            *pOut = 0x7FFFFFFF;
+            *pShift = 16U;
+            return ( ARM_MATH_NANINF );
+        }
+
+        *pOut = 0;
+        *pShift = 0U;
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    /* Normalise the input to [0.25 1) by an even shift */
+    k = ( __CLZ( in ) - 1U ) >> 1;
+    m = ( uint32_t ) in << ( 2U * k );
+
+    /* Initial estimate of 1/sqrt(m) in Q30 */
+    r = ( uint32_t ) rsqrtTable_q31[( m >> 25 ) - 16U];
+
+    /* Newton-Raphson iterations */
+    for( i = 0U; i < 3U; i++ )
+    {
+        mr = ( uint32_t )( ( ( uint64_t ) m * r + 0x40000000U ) >> 31 );
+        mr2 = ( uint32_t )( ( ( uint64_t ) mr * r + 0x20000000U ) >> 30 );
+        r = ( uint32_t )( ( ( uint64_t ) r * ( 0xC0000000U - mr2 ) + 0x40000000U ) >> 31 );
+    }
+
+    /* 1/sqrt(m) in Q30 is 1/(2*sqrt(m)) in Q31 */
+    if( r > 0x7FFFFFFFU )
+    {
+        r = 0x7FFFFFFFU;
+    }
+
+    *pOut = ( q31_t ) r;
+    *pShift = ( uint8_t )( k + 1U );
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of RSQRT group
+ */
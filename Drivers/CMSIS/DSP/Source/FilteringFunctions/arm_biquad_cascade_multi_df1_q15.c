@@ -0,0 +1,268 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df1_q15.c
+ * Description:  Processing function for the Q15 Biquad cascade DirectFormI(DF1) filter. N interleaved channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the multichannel Q15 Biquad cascade filter.
+ * @param[in]  *S points to an instance of the multichannel Q15 Biquad cascade structure.
+ * @param[in]  *pSrc points to the block of interleaved input data.
+ * @param[out] *pDst points to the block of interleaved output data.
+ * @param[in]  blockSize number of samples per channel to process per call.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize*numChannels</code> values
+ * arranged as <code>{x0[0], x1[0], ..., xN-1[0], x0[1], x1[1], ...}</code>.
+ * All channels share one set of coefficients. The coefficients of a stage are loaded once
+ * and every channel is then run through that stage directly on the interleaved buffer,
+ * so no de-interleaving is needed.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each channel is computed with exactly the same arithmetic as <code>arm_biquad_cascade_df1_q15()</code>,
+ * so the output of every channel is bit-exact with a single-channel call on the de-interleaved data.
+ */
+
+void arm_biquad_cascade_multi_df1_q15(
+    const arm_biquad_cascade_multi_df1_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q15_t *pIn = pSrc;                             /*  Source pointer                               */
+    q15_t *pX;                                     /*  Per channel source pointer                   */
+    q15_t *pOut;                                   /*  Per channel destination pointer              */
+    q15_t *pState = S->pState;                     /*  State pointer                                */
+    q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+    uint32_t numChannels = S->numChannels;         /*  Number of interleaved channels               */
+    uint32_t sample, channel;                      /*  Loop counters                                */
+    uint32_t stage = ( uint32_t ) S->numStages;    /*  Stage loop counter                           */
+    q63_t acc;                                     /*  Accumulator                                  */
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    q31_t in;                                      /*  Temporary variable to hold input value       */
+    q31_t out;                                     /*  Temporary variable to hold output value      */
+    q31_t b0, b1, a1;                              /*  Filter coefficients                          */
+    q31_t state_in, state_out;                     /*  Filter state variables                       */
+    q31_t acc_l, acc_h;
+    int32_t lShift = ( 15 - ( int32_t ) S->postShift );   /*  Post shift                                   */
+    int32_t uShift = ( 32 - lShift );
+
+    do
+    {
+        /* Read the b0 and 0 coefficients using SIMD  */
+        b0 = *__SIMD32( pCoeffs )++;
+
+        /* Read the b1 and b2 coefficients using SIMD */
+        b1 = *__SIMD32( pCoeffs )++;
+
+        /* Read the a1 and a2 coefficients using SIMD */
+        a1 = *__SIMD32( pCoeffs )++;
+
+        /* The coefficients stay in registers while every channel runs through this stage */
+        for ( channel = 0U; channel < numChannels; channel++ )
+        {
+            pX = pIn + channel;
+            pOut = pDst + channel;
+
+            /* Read the input state values from the state buffer:  x[n-1], x[n-2] */
+            state_in = *__SIMD32( pState )++;
+
+            /* Read the output state values from the state buffer:  y[n-1], y[n-2] */
+            state_out = *__SIMD32( pState )--;
+
+            sample = blockSize;
+
+            while( sample > 0U )
+            {
+                /* Read the input */
+                in = *pX;
+                pX += numChannels;
+
+                /* out =  b0 * x[n] + 0 * 0 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+                out = __SMUAD( b0, in );
+
+#else
+
+                out = __SMUADX( b0, in );
+
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+
+                /* acc =  b1 * x[n-1] + b2 * x[n-2] + out */
+                acc = __SMLALD( b1, state_in, out );
+                /* acc +=  a1 * y[n-1] + a2 * y[n-2] */
+                acc = __SMLALD( a1, state_out, acc );
+
+                /* Calc lower part of acc */
+                acc_l = acc & 0xffffffff;
+
+                /* Calc upper part of acc */
+                acc_h = ( acc >> 32 ) & 0xffffffff;
+
+                /* Apply shift for lower part of acc and upper part of acc */
+                out = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+                out = __SSAT( out, 16 );
+
+                /* Store the output in the destination buffer. */
+                *pOut = ( q15_t ) out;
+                pOut += numChannels;
+
+                /* x[n-N], x[n-N-1] are packed together to make state_in of type q31 */
+                /* y[n-N], y[n-N-1] are packed together to make state_out of type q31 */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+                state_in = __PKHBT( in, state_in, 16 );
+                state_out = __PKHBT( out, state_out, 16 );
+
+#else
+
+                state_in = __PKHBT( state_in >> 16, in, 16 );
+                state_out = __PKHBT( state_out >> 16, out, 16 );
+
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /*  Store the updated state variables back into the state array */
+            *__SIMD32( pState )++ = state_in;
+            *__SIMD32( pState )++ = state_out;
+        }
+
+        /*  The first stage goes from the input buffer to the output buffer. */
+        /*  Subsequent stages occur in-place in the output buffer */
+        pIn = pDst;
+
+        /* Decrement the loop counter */
+        stage--;
+
+    } while( stage > 0U );
+
+#else
+
+    /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+    q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+    q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+    q15_t Xn;                                      /*  temporary input               */
+    int32_t shift = ( 15 - ( int32_t ) S->postShift ); /*  Post shift                                   */
+
+    do
+    {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        pCoeffs++;  // skip the 0 coefficient
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        /* The coefficients stay in registers while every channel runs through this stage */
+        for ( channel = 0U; channel < numChannels; channel++ )
+        {
+            pX = pIn + channel;
+            pOut = pDst + channel;
+
+            /* Reading the state values */
+            Xn1 = pState[0];
+            Xn2 = pState[1];
+            Yn1 = pState[2];
+            Yn2 = pState[3];
+
+            sample = blockSize;
+
+            while( sample > 0U )
+            {
+                /* Read the input */
+                Xn = *pX;
+                pX += numChannels;
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                acc = ( q31_t ) b0 * Xn;
+                acc += ( q31_t ) b1 * Xn1;
+                acc += ( q31_t ) b2 * Xn2;
+                acc += ( q31_t ) a1 * Yn1;
+                acc += ( q31_t ) a2 * Yn2;
+
+                /* The result is converted to 1.15  */
+                acc = __SSAT( ( acc >> shift ), 16 );
+
+                /* Every time after the output is computed state should be updated. */
+                Xn2 = Xn1;
+                Xn1 = Xn;
+                Yn2 = Yn1;
+                Yn1 = ( q15_t ) acc;
+
+                /* Store the output in the destination buffer. */
+                *pOut = ( q15_t ) acc;
+                pOut += numChannels;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /*  Store the updated state variables back into the pState array */
+            *pState++ = Xn1;
+            *pState++ = Xn2;
+            *pState++ = Yn1;
+            *pState++ = Yn2;
+        }
+
+        /*  The first stage goes from the input buffer to the output buffer. */
+        /*  Subsequent stages occur in-place in the output buffer */
+        pIn = pDst;
+
+    } while( --stage );
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+}
+
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
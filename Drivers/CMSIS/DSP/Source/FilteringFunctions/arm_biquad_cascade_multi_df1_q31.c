@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df1_q31.c
+ * Description:  Processing function for the Q31 Biquad cascade DirectFormI(DF1) filter. N interleaved channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the multichannel Q31 Biquad cascade filter.
+ * @param[in]  *S         points to an instance of the multichannel Q31 Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input data.
+ * @param[out] *pDst      points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples per channel to process per call.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize*numChannels</code> values
+ * arranged as <code>{x0[0], x1[0], ..., xN-1[0], x0[1], x1[1], ...}</code>.
+ * All channels share one set of coefficients. The coefficients of a stage are loaded once
+ * and every channel is then run through that stage directly on the interleaved buffer.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each channel is computed with exactly the same arithmetic as <code>arm_biquad_cascade_df1_q31()</code>,
+ * so the output of every channel is bit-exact with a single-channel call on the de-interleaved data.
+ */
+
+void arm_biquad_cascade_multi_df1_q31(
+    const arm_biquad_cascade_multi_df1_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q63_t acc;                                     /*  accumulator                   */
+    uint32_t uShift = ( ( uint32_t ) S->postShift + 1U );
+    uint32_t lShift = 32U - uShift;                /*  Shift to be applied to the output */
+    q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+    q31_t *pX;                                     /*  per channel input pointer     */
+    q31_t *pOut;                                   /*  per channel output pointer    */
+    q31_t *pState = S->pState;                     /*  pState pointer initialization */
+    q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+    q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+    q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+    q31_t Xn;                                      /*  temporary input               */
+    uint32_t numChannels = S->numChannels;         /*  number of interleaved channels */
+    uint32_t sample, channel, stage = S->numStages;   /*  loop counters             */
+
+    do
+    {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        /* The coefficients stay in registers while every channel runs through this stage */
+        for ( channel = 0U; channel < numChannels; channel++ )
+        {
+            pX = pIn + channel;
+            pOut = pDst + channel;
+
+            /* Reading the state values */
+            Xn1 = pState[0];
+            Xn2 = pState[1];
+            Yn1 = pState[2];
+            Yn2 = pState[3];
+
+#if defined (ARM_MATH_CM0_FAMILY)
+
+            /* Run the below code for Cortex-M0 */
+
+            sample = blockSize;
+
+#else
+
+            /* Run the below code for Cortex-M3, Cortex-M4 and Cortex-M7 */
+
+            /* Apply loop unrolling and compute 2 output values per iteration,
+             ** swapping the roles of the state registers instead of moving them. */
+            sample = blockSize >> 1U;
+
+            while( sample > 0U )
+            {
+                /* Read the first input */
+                Xn = *pX;
+                pX += numChannels;
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                acc = ( q63_t ) b0 * Xn;
+                acc += ( q63_t ) b1 * Xn1;
+                acc += ( q63_t ) b2 * Xn2;
+                acc += ( q63_t ) a1 * Yn1;
+                acc += ( q63_t ) a2 * Yn2;
+
+                /* The result is converted to 1.31, Yn2 variable is reused */
+                Yn2 = ( q31_t ) ( acc >> lShift );
+
+                /* Store the output in the destination buffer. */
+                *pOut = Yn2;
+                pOut += numChannels;
+
+                /* Read the second input, Xn2 variable is reused */
+                Xn2 = *pX;
+                pX += numChannels;
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                acc = ( q63_t ) b0 * Xn2;
+                acc += ( q63_t ) b1 * Xn;
+                acc += ( q63_t ) b2 * Xn1;
+                acc += ( q63_t ) a1 * Yn2;
+                acc += ( q63_t ) a2 * Yn1;
+
+                /* The result is converted to 1.31, Yn1 variable is reused */
+                Yn1 = ( q31_t ) ( acc >> lShift );
+
+                /* Store the output in the destination buffer. */
+                *pOut = Yn1;
+                pOut += numChannels;
+
+                /* Restore the state ordering: x[n-1] = Xn2, x[n-2] = Xn */
+                Xn1 = Xn2;
+                Xn2 = Xn;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /* If the blockSize is not a multiple of 2, compute the remaining output sample here. */
+            sample = blockSize & 0x1U;
+
+#endif /* #if defined (ARM_MATH_CM0_FAMILY) */
+
+            while( sample > 0U )
+            {
+                /* Read the input */
+                Xn = *pX;
+                pX += numChannels;
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                acc = ( q63_t ) b0 * Xn;
+                acc += ( q63_t ) b1 * Xn1;
+                acc += ( q63_t ) b2 * Xn2;
+                acc += ( q63_t ) a1 * Yn1;
+                acc += ( q63_t ) a2 * Yn2;
+
+                /* The result is converted to 1.31  */
+                acc = acc >> lShift;
+
+                /* Every time after the output is computed state should be updated. */
+                Xn2 = Xn1;
+                Xn1 = Xn;
+                Yn2 = Yn1;
+                Yn1 = ( q31_t ) acc;
+
+                /* Store the output in the destination buffer. */
+                *pOut = ( q31_t ) acc;
+                pOut += numChannels;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /*  Store the updated state variables back into the pState array */
+            *pState++ = Xn1;
+            *pState++ = Xn2;
+            *pState++ = Yn1;
+            *pState++ = Yn2;
+        }
+
+        /*  The first stage goes from the input buffer to the output buffer. */
+        /*  Subsequent stages occur in-place in the output buffer */
+        pIn = pDst;
+
+    } while( --stage );
+}
+
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the multichannel floating-point transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data
+* @param[in]  blockSize number of samples per channel to process.
+* @return none.
+*
+* \par
+* <code>pSrc</code> and <code>pDst</code> hold <code>blockSize*numChannels</code> values
+* arranged as <code>{x0[0], x1[0], ..., xN-1[0], x0[1], x1[1], ...}</code>.
+* All channels share one set of coefficients. The coefficients of a stage are loaded once
+* and every channel is then run through that stage directly on the interleaved buffer.
+* The operations are performed in the same order as in <code>arm_biquad_cascade_df2T_f32()</code>,
+* so the output of every channel is bit-exact with a single-channel call on the de-interleaved data.
+*/
+
+
+LOW_OPTIMIZATION_ENTER
+void arm_biquad_cascade_multi_df2T_f32(
+    const arm_biquad_cascade_multi_df2T_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize )
+{
+
+    float32_t *pIn = pSrc;                         /*  source pointer            */
+    float32_t *pX;                                 /*  per channel source pointer      */
+    float32_t *pOut;                               /*  per channel destination pointer */
+    float32_t *pState = S->pState;                 /*  State pointer             */
+    float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+    float32_t acc1;                                /*  accumulator               */
+    float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+    float32_t Xn1;                                 /*  temporary input           */
+    float32_t d1, d2;                              /*  state variables           */
+    uint32_t numChannels = S->numChannels;         /*  number of interleaved channels */
+    uint32_t sample, channel, stage = S->numStages;   /*  loop counters          */
+
+    do
+    {
+        /* Reading the coefficients */
+        b0 = *pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        /* The coefficients stay in registers while every channel runs through this stage */
+        for ( channel = 0U; channel < numChannels; channel++ )
+        {
+            pX = pIn + channel;
+            pOut = pDst + channel;
+
+            /*Reading the state values */
+            d1 = pState[0];
+            d2 = pState[1];
+
+            sample = blockSize;
+
+            while( sample > 0U )
+            {
+                /* Read the input */
+                Xn1 = *pX;
+                pX += numChannels;
+
+                /* y[n] = b0 * x[n] + d1 */
+                acc1 = ( b0 * Xn1 ) + d1;
+
+                /* Store the result in the accumulator in the destination buffer. */
+                *pOut = acc1;
+                pOut += numChannels;
+
+#if defined(ARM_MATH_CM7)
+
+                /* d1 = b1 * x[n] + d2 + a1 * y[n] */
+                d1 = b1 * Xn1 + d2;
+                d1 += a1 * acc1;
+
+                /* d2 = b2 * x[n] + a2 * y[n] */
+                d2 = b2 * Xn1;
+                d2 += a2 * acc1;
+
+#else
+
+                /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+                d1 = ( ( b1 * Xn1 ) + ( a1 * acc1 ) ) + d2;
+
+                /* d2 = b2 * x[n] + a2 * y[n] */
+                d2 = ( b2 * Xn1 ) + ( a2 * acc1 );
+
+#endif /* #if defined(ARM_MATH_CM7) */
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /* Store the updated state variables back into the state array */
+            *pState++ = d1;
+            *pState++ = d2;
+        }
+
+        /* The current stage input is given as the output to the next stage */
+        pIn = pDst;
+
+        /* decrement the loop counter */
+        stage--;
+
+    } while( stage > 0U );
+
+}
+LOW_OPTIMIZATION_EXIT
+
+/**
+   * @} end of BiquadCascadeDF2T group
+   */
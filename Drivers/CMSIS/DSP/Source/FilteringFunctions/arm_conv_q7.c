@@ -641,12 +641,19 @@ void arm_conv_q7(
 
 #else
 
-    /* Run the below code for Cortex-M0 */
+    /* Run the below code for Cortex-M0 and Cortex-M3 */
 
     q7_t *pIn1 = pSrcA;                            /* input pointer */
     q7_t *pIn2 = pSrcB;                            /* coefficient pointer */
     q31_t sum;                                     /* Accumulator */
-    uint32_t i, j;                                 /* loop counter */
+    uint32_t i;                                    /* loop counter */
+#if defined (ARM_MATH_CM3) && !defined (UNALIGNED_SUPPORT_DISABLE)
+    q7_t *px, *py;                                 /* Pointers to x[j] and y[i-j] */
+    q31_t inX, inY;                                /* 4 packed samples of each input */
+    uint32_t jStart, jEnd, k;                      /* Range of j and loop counter */
+#else
+    uint32_t j;                                    /* loop counter */
+#endif
 
     /* Loop to calculate output of convolution for output length number of times */
     for( i = 0; i < ( srcALen + srcBLen - 1 ); i++ )
@@ -654,6 +661,44 @@ void arm_conv_q7(
         /* Initialize sum with zero to carry on MAC operations */
         sum = 0;
 
+#if defined (ARM_MATH_CM3) && !defined (UNALIGNED_SUPPORT_DISABLE)
+
+        /* Only the j for which both x[j] and y[i-j] exist contribute */
+        jStart = ( i < srcBLen ) ? 0U : ( i - srcBLen ) + 1U;
+        jEnd = ( i < srcALen ) ? i : srcALen - 1U;
+
+        px = pIn1 + jStart;
+        py = pIn2 + ( i - jStart );
+
+        /* Read 4 samples of each input with one word load each.
+         * y is read backwards, so its bytes are used in reverse order. */
+        k = ( ( jEnd - jStart ) + 1U ) >> 2U;
+
+        while( k > 0U )
+        {
+            inX = _SIMD32_OFFSET( px );
+            inY = _SIMD32_OFFSET( py - 3 );
+
+            sum += ( q15_t ) __UNPACKq7( inX, 0 ) * __UNPACKq7( inY, 3 );
+            sum += ( q15_t ) __UNPACKq7( inX, 1 ) * __UNPACKq7( inY, 2 );
+            sum += ( q15_t ) __UNPACKq7( inX, 2 ) * __UNPACKq7( inY, 1 );
+            sum += ( q15_t ) __UNPACKq7( inX, 3 ) * __UNPACKq7( inY, 0 );
+
+            px += 4;
+            py -= 4;
+            k--;
+        }
+
+        k = ( ( jEnd - jStart ) + 1U ) & 0x3U;
+
+        while( k > 0U )
+        {
+            sum += ( q15_t ) * px++ * *py--;
+            k--;
+        }
+
+#else
+
         /* Loop to perform MAC operations according to convolution equation */
         for( j = 0; j <= i; j++ )
         {
@@ -665,6 +710,8 @@ void arm_conv_q7(
             }
         }
 
+#endif /* #if defined (ARM_MATH_CM3) && !defined (UNALIGNED_SUPPORT_DISABLE) */
+
         /* Store the output in the destination buffer */
         pDst[i] = ( q7_t ) __SSAT( ( sum >> 7U ), 8U );
     }
@@ -688,7 +688,7 @@ void arm_correlate_q7(
 
 #else
 
-    /* Run the below code for Cortex-M0 */
+    /* Run the below code for Cortex-M0 and Cortex-M3 */
 
     q7_t *pIn1 = pSrcA;                            /* inputA pointer */
     q7_t *pIn2 = pSrcB + ( srcBLen - 1U );         /* inputB pointer */
@@ -696,6 +696,11 @@ void arm_correlate_q7(
     uint32_t i = 0U, j;                            /* loop counters */
     uint32_t inv = 0U;                             /* Reverse order flag */
     uint32_t tot = 0U;                             /* Length */
+#if defined (ARM_MATH_CM3) && !defined (UNALIGNED_SUPPORT_DISABLE)
+    q7_t *px, *py;                                 /* Pointers to x[j] and y[j-i] */
+    q31_t inX, inY;                                /* 4 packed samples of each input */
+    uint32_t jStart, jEnd, k;                      /* Range of j and loop counter */
+#endif
 
     /* The algorithm implementation is based on the lengths of the inputs. */
     /* srcB is always made to slide across srcA. */
@@ -752,6 +757,43 @@ void arm_correlate_q7(
         /* Initialize sum with zero to carry on MAC operations */
         sum = 0;
 
+#if defined (ARM_MATH_CM3) && !defined (UNALIGNED_SUPPORT_DISABLE)
+
+        /* Only the j for which both pIn1[j] and pIn2[j-i] exist contribute */
+        jStart = ( i < srcBLen ) ? 0U : ( i - srcBLen ) + 1U;
+        jEnd = ( i < srcALen ) ? i : srcALen - 1U;
+
+        px = pIn1 + jStart;
+        py = pIn2 - ( i - jStart );
+
+        /* Both inputs are read forwards, 4 samples with one word load each */
+        k = ( ( jEnd - jStart ) + 1U ) >> 2U;
+
+        while( k > 0U )
+        {
+            inX = _SIMD32_OFFSET( px );
+            inY = _SIMD32_OFFSET( py );
+
+            sum += ( q15_t ) __UNPACKq7( inX, 0 ) * __UNPACKq7( inY, 0 );
+            sum += ( q15_t ) __UNPACKq7( inX, 1 ) * __UNPACKq7( inY, 1 );
+            sum += ( q15_t ) __UNPACKq7( inX, 2 ) * __UNPACKq7( inY, 2 );
+            sum += ( q15_t ) __UNPACKq7( inX, 3 ) * __UNPACKq7( inY, 3 );
+
+            px += 4;
+            py += 4;
+            k--;
+        }
+
+        k = ( ( jEnd - jStart ) + 1U ) & 0x3U;
+
+        while( k > 0U )
+        {
+            sum += ( q15_t ) * px++ * *py++;
+            k--;
+        }
+
+#else
+
         /* Loop to perform MAC operations according to convolution equation */
         for( j = 0U; j <= i; j++ )
         {
@@ -763,6 +805,8 @@ void arm_correlate_q7(
             }
         }
 
+#endif /* #if defined (ARM_MATH_CM3) && !defined (UNALIGNED_SUPPORT_DISABLE) */
+
         /* Store the output in the destination buffer */
         if( inv == 1 )
         {
@@ -61,7 +61,7 @@ void arm_fir_q7(
     uint32_t blockSize )
 {
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_DSP) || defined (ARM_MATH_CM3)
 
     /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -70,6 +70,9 @@ void arm_fir_q7(
     q7_t *pStateCurnt;                             /* Points to the current sample of the state */
     q7_t x0, x1, x2, x3;                           /* Temporary variables to hold state */
     q7_t c0;                                       /* Temporary variable to hold coefficient value */
+#if !defined (UNALIGNED_SUPPORT_DISABLE)
+    q31_t inC, inX;                                /* 4 packed coefficients and 4 packed samples */
+#endif
     q7_t *px;                                      /* Temporary pointer for state */
     q7_t *pb;                                      /* Temporary pointer for coefficient buffer */
     q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
@@ -124,6 +127,51 @@ void arm_fir_q7(
 
         while( i > 0U )
         {
+#if !defined (UNALIGNED_SUPPORT_DISABLE)
+
+            /* Read 4 coefficients and the next 4 samples with one word load each,
+             * instead of 8 byte loads */
+            inC = _SIMD32_OFFSET( pb );
+            inX = _SIMD32_OFFSET( px );
+
+            /* b[numTaps] and x[n-numTaps-3] */
+            c0 = __UNPACKq7( inC, 0 );
+            x3 = __UNPACKq7( inX, 0 );
+
+            acc0 += ( ( q15_t ) x0 * c0 );
+            acc1 += ( ( q15_t ) x1 * c0 );
+            acc2 += ( ( q15_t ) x2 * c0 );
+            acc3 += ( ( q15_t ) x3 * c0 );
+
+            /* b[numTaps-1] and x[n-numTaps-4] */
+            c0 = __UNPACKq7( inC, 1 );
+            x0 = __UNPACKq7( inX, 1 );
+
+            acc0 += ( ( q15_t ) x1 * c0 );
+            acc1 += ( ( q15_t ) x2 * c0 );
+            acc2 += ( ( q15_t ) x3 * c0 );
+            acc3 += ( ( q15_t ) x0 * c0 );
+
+            /* b[numTaps-2] and x[n-numTaps-5] */
+            c0 = __UNPACKq7( inC, 2 );
+            x1 = __UNPACKq7( inX, 2 );
+
+            acc0 += ( ( q15_t ) x2 * c0 );
+            acc1 += ( ( q15_t ) x3 * c0 );
+            acc2 += ( ( q15_t ) x0 * c0 );
+            acc3 += ( ( q15_t ) x1 * c0 );
+
+            /* b[numTaps-3] and x[n-numTaps-6] */
+            c0 = __UNPACKq7( inC, 3 );
+            x2 = __UNPACKq7( inX, 3 );
+
+            acc0 += ( ( q15_t ) x3 * c0 );
+            acc1 += ( ( q15_t ) x0 * c0 );
+            acc2 += ( ( q15_t ) x1 * c0 );
+            acc3 += ( ( q15_t ) x2 * c0 );
+
+#else
+
             /* Read the b[numTaps] coefficient */
             c0 = *pb;
 
@@ -178,6 +226,8 @@ void arm_fir_q7(
             acc2 += ( ( q15_t ) x1 * c0 );
             acc3 += ( ( q15_t ) x2 * c0 );
 
+#endif /* #if !defined (UNALIGNED_SUPPORT_DISABLE) */
+
             /* update coefficient pointer */
             pb += 4U;
             px += 4U;
@@ -377,7 +427,7 @@ void arm_fir_q7(
         i--;
     }
 
-#endif /*   #if defined (ARM_MATH_DSP) */
+#endif /*   #if defined (ARM_MATH_DSP) || defined (ARM_MATH_CM3) */
 
 }
 
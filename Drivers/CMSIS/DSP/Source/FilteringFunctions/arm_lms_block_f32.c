@@ -0,0 +1,372 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_block_f32.c
+ * Description:  Processing function for the floating-point block LMS filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup LMS_BLOCK Block and Partial-Update LMS Filters
+ *
+ * These functions are variants of the LMS and normalized LMS filters that
+ * reduce the cost of the coefficient update. They share the instance
+ * structures, the state buffer layout and the coefficient ordering of the
+ * LMS and LMS_NORM functions, so an instance initialized with
+ * <code>arm_lms_init_f32()</code> can be processed by either
+ * <code>arm_lms_f32()</code> or <code>arm_lms_block_f32()</code>.
+ *
+ * \par Block LMS
+ * <code>arm_lms_block_f32()</code>, <code>arm_lms_block_q31()</code> and
+ * <code>arm_lms_block_q15()</code> hold the filter coefficients fixed for a
+ * whole call. The block is first filtered:
+ * <pre>
+ *     y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+ *     e[n] = d[n] - y[n],                       for n=0, 1, ..., blockSize-1
+ * </pre>
+ * and the coefficients are then updated once with the gradient of the block:
+ * <pre>
+ *     b[k] = b[k] + mu * (e[0] * x[-k] + e[1] * x[1-k] + ... + e[blockSize-1] * x[blockSize-1-k])
+ * </pre>
+ * This is the sum of the per-sample updates of the LMS filter with the
+ * coefficients held for the block, so for small <code>mu</code> both filters
+ * adapt at the same rate per sample. Filtering and the gradient are both
+ * computed as correlations with the coefficients and errors kept in registers,
+ * which removes the read-modify-write of every coefficient on every sample.
+ * Because the update is delayed by up to <code>blockSize</code> samples the
+ * stable range of <code>mu</code> is roughly <code>blockSize</code> times
+ * smaller than for the LMS filter.
+ *
+ * \par Block normalized LMS
+ * <code>arm_lms_norm_block_f32()</code>, <code>arm_lms_norm_block_q31()</code>
+ * and <code>arm_lms_norm_block_q15()</code> apply the same block update with
+ * the step size normalized by the mean energy of the filter state over the block:
+ * <pre>
+ *     E[n] = x[n]^2 + x[n-1]^2 + ... + x[n-numTaps+1]^2
+ *     b[k] = b[k] + (mu / mean(E[n])) * (e[0] * x[-k] + ... + e[blockSize-1] * x[blockSize-1-k])
+ * </pre>
+ * The energy is tracked sample by sample exactly as in the normalized LMS
+ * filter and only one reciprocal is computed per block. Keep
+ * <code>mu * blockSize</code> below about <code>numTaps</code>.
+ *
+ * \par Partial-update LMS
+ * <code>arm_lms_partial_f32()</code>, <code>arm_lms_partial_q31()</code> and
+ * <code>arm_lms_partial_q15()</code> compute the full filter output for every
+ * sample but update only <code>numUpdate</code> of the <code>numTaps</code>
+ * coefficients per sample. The updated coefficients are selected sequentially:
+ * each sample updates the next <code>numUpdate</code> coefficients, wrapping
+ * around at the end of the array, so every coefficient is updated once every
+ * <code>numTaps / numUpdate</code> samples. The cost of the update drops by
+ * the same factor, at the expense of a slower convergence. The update position
+ * is kept in the instance, so the selection continues across calls.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 and Q31 functions use the same output scaling with
+ * <code>postShift</code>, the same accumulators and the same saturation of the
+ * coefficient update as the corresponding LMS and normalized LMS functions.
+ */
+
+/**
+ * @addtogroup LMS_BLOCK
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point block LMS filter.
+ * @param[in]  *S points to an instance of the floating-point LMS filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[in]  *pRef points to the block of reference data.
+ * @param[out] *pOut points to the block of output data.
+ * @param[out] *pErr points to the block of error data.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ *
+ * \par
+ * The coefficients are updated once, after the whole block has been filtered.
+ * The error block is read back from <code>pErr</code> for the update, so
+ * <code>pErr</code> must not overlap <code>pSrc</code> or <code>pRef</code>.
+ */
+
+void arm_lms_block_f32(
+    const arm_lms_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;                 /* State pointer */
+    float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+    float32_t *px, *pb, *pe;                       /* Temporary pointers for state, coefficient and error buffers */
+    float32_t mu = S->mu;                          /* Adaptive factor */
+    uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    uint32_t tapCnt, blkCnt;                       /* Loop counters */
+    float32_t acc0;                                /* Accumulator */
+#if !defined (ARM_MATH_CM0_FAMILY)
+    float32_t acc1, acc2, acc3;                    /* Accumulators */
+    float32_t x0, x1, x2, x3, c0, e;               /* Temporary variables to hold state, coefficient and error values */
+    float32_t *pxs;                                /* Pointer to the newest state sample of the window */
+#endif
+
+    /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+    /* pStateCurnt points to the location where the new input data should be written */
+    pStateCurnt = &( S->pState[( numTaps - 1U )] );
+
+    /* Copy the new input block into the state buffer */
+    blkCnt = blockSize;
+
+    while( blkCnt > 0U )
+    {
+        *pStateCurnt++ = *pSrc++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Filter the block with the coefficients of the previous block */
+    px = pState;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time. Each coefficient is loaded once for the
+       4 outputs and the state window slides through registers. */
+    blkCnt = blockSize >> 2U;
+
+    while( blkCnt > 0U )
+    {
+        acc0 = 0.0f;
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+
+        /* Read the first 3 samples of the window */
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        pxs = px + 3U;
+
+        pb = pCoeffs;
+
+        tapCnt = numTaps;
+
+        while( tapCnt > 0U )
+        {
+            c0 = *pb++;
+            x3 = *pxs++;
+
+            acc0 += x0 * c0;
+            acc1 += x1 * c0;
+            acc2 += x2 * c0;
+            acc3 += x3 * c0;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* Store the outputs and the errors */
+        pOut[0] = acc0;
+        pOut[1] = acc1;
+        pOut[2] = acc2;
+        pOut[3] = acc3;
+        pOut += 4U;
+
+        pErr[0] = pRef[0] - acc0;
+        pErr[1] = pRef[1] - acc1;
+        pErr[2] = pRef[2] - acc2;
+        pErr[3] = pRef[3] - acc3;
+        pErr += 4U;
+        pRef += 4U;
+
+        px += 4U;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute the remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+    while( blkCnt > 0U )
+    {
+        acc0 = 0.0f;
+        pb = pCoeffs;
+        pe = px;
+
+        tapCnt = numTaps;
+
+        while( tapCnt > 0U )
+        {
+            acc0 += ( *pe++ ) * ( *pb++ );
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        *pOut++ = acc0;
+        *pErr++ = *pRef++ - acc0;
+
+        px++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Update the coefficients with the gradient of the whole block:
+       b[k] += mu * sum(e[n] * x[n-k]) */
+    pErr -= blockSize;
+    px = pState;
+    pb = pCoeffs;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Update 4 coefficients at a time. Each error sample is loaded once for
+       the 4 coefficients. */
+    tapCnt = numTaps >> 2U;
+
+    while( tapCnt > 0U )
+    {
+        acc0 = 0.0f;
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        pxs = px + 3U;
+
+        pe = pErr;
+
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
+        {
+            e = *pe++;
+            x3 = *pxs++;
+
+            acc0 += e * x0;
+            acc1 += e * x1;
+            acc2 += e * x2;
+            acc3 += e * x3;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        pb[0] += mu * acc0;
+        pb[1] += mu * acc1;
+        pb[2] += mu * acc2;
+        pb[3] += mu * acc3;
+        pb += 4U;
+
+        px += 4U;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    /* If the filter length is not a multiple of 4, update the remaining coefficients */
+    tapCnt = numTaps % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = numTaps;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+    while( tapCnt > 0U )
+    {
+        acc0 = 0.0f;
+        pe = pErr;
+        pStateCurnt = px;
+
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
+        {
+            acc0 += ( *pe++ ) * ( *pStateCurnt++ );
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        *pb++ += mu * acc0;
+
+        px++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    /* Processing is complete. Now copy the last numTaps - 1 samples to the
+       start of the state buffer. This prepares the state buffer for the
+       next function call. */
+
+    /* Points to the start of the pState buffer */
+    pStateCurnt = S->pState;
+    pState = S->pState + blockSize;
+
+    /* Copy (numTaps - 1U) samples */
+    tapCnt = ( numTaps - 1U );
+
+    while( tapCnt > 0U )
+    {
+        *pStateCurnt++ = *pState++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+}
+
+/**
+ * @} end of LMS_BLOCK group
+ */
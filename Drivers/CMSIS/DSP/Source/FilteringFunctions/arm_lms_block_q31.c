@@ -0,0 +1,348 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_block_q31.c
+ * Description:  Processing function for the Q31 block LMS filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_BLOCK
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 block LMS filter.
+ * @param[in]  *S points to an instance of the Q31 LMS filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[in]  *pRef points to the block of reference data.
+ * @param[out] *pOut points to the block of output data.
+ * @param[out] *pErr points to the block of error data.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The filter output is computed exactly as in <code>arm_lms_q31()</code>: a 2.62
+ * accumulator with a single guard bit, shifted by <code>postShift</code> and
+ * truncated to 1.31 format. The input signal must be scaled down by
+ * log2(numTaps) bits to avoid wrap around.
+ * \par
+ * For the update each error sample is first scaled by <code>mu</code> to 1.31
+ * format. The products with the state are summed over the block in a 2.62
+ * accumulator, which is shifted to 1.31 format and added to the coefficient
+ * with saturation.
+ * \par
+ * The error block is read back from <code>pErr</code> for the update, so
+ * <code>pErr</code> must not overlap <code>pSrc</code> or <code>pRef</code>.
+ */
+
+void arm_lms_block_q31(
+    const arm_lms_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;                     /* State pointer */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+    q31_t *px, *pb, *pe, *pxs;                     /* Temporary pointers for state, coefficient and error buffers */
+    q31_t mu = S->mu;                              /* Adaptive factor */
+    uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    uint32_t tapCnt, blkCnt;                       /* Loop counters */
+    q63_t acc0;                                    /* Accumulator */
+    q31_t alpha;                                   /* Error sample scaled by mu */
+    q31_t acc_l, acc_h;                            /* Temporary variables to hold the accumulator parts */
+    uint32_t uShift = ( ( uint32_t ) S->postShift + 1U );
+    uint32_t lShift = 32U - uShift;                /* Shift to be applied to the output */
+#if !defined (ARM_MATH_CM0_FAMILY)
+    q63_t acc1, acc2, acc3;                        /* Accumulators */
+    q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+#endif
+
+    /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+    /* pStateCurnt points to the location where the new input data should be written */
+    pStateCurnt = &( S->pState[( numTaps - 1U )] );
+
+    /* Copy the new input block into the state buffer */
+    blkCnt = blockSize;
+
+    while( blkCnt > 0U )
+    {
+        *pStateCurnt++ = *pSrc++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Filter the block with the coefficients of the previous block */
+    px = pState;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time. Each coefficient is loaded once for the
+       4 outputs and the state window slides through registers. */
+    blkCnt = blockSize >> 2U;
+
+    while( blkCnt > 0U )
+    {
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        /* Read the first 3 samples of the window */
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        pxs = px + 3U;
+
+        pb = pCoeffs;
+
+        tapCnt = numTaps;
+
+        while( tapCnt > 0U )
+        {
+            c0 = *pb++;
+            x3 = *pxs++;
+
+            acc0 += ( q63_t ) x0 * c0;
+            acc1 += ( q63_t ) x1 * c0;
+            acc2 += ( q63_t ) x2 * c0;
+            acc3 += ( q63_t ) x3 * c0;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* Convert the results to 1.31 format */
+        acc_l = acc0 & 0xffffffff;
+        acc_h = ( acc0 >> 32 ) & 0xffffffff;
+        acc0 = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+        acc_l = acc1 & 0xffffffff;
+        acc_h = ( acc1 >> 32 ) & 0xffffffff;
+        acc1 = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+        acc_l = acc2 & 0xffffffff;
+        acc_h = ( acc2 >> 32 ) & 0xffffffff;
+        acc2 = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+        acc_l = acc3 & 0xffffffff;
+        acc_h = ( acc3 >> 32 ) & 0xffffffff;
+        acc3 = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+        /* Store the outputs and the errors */
+        pOut[0] = ( q31_t ) acc0;
+        pOut[1] = ( q31_t ) acc1;
+        pOut[2] = ( q31_t ) acc2;
+        pOut[3] = ( q31_t ) acc3;
+        pOut += 4U;
+
+        pErr[0] = pRef[0] - ( q31_t ) acc0;
+        pErr[1] = pRef[1] - ( q31_t ) acc1;
+        pErr[2] = pRef[2] - ( q31_t ) acc2;
+        pErr[3] = pRef[3] - ( q31_t ) acc3;
+        pErr += 4U;
+        pRef += 4U;
+
+        px += 4U;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute the remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+    while( blkCnt > 0U )
+    {
+        acc0 = 0;
+        pb = pCoeffs;
+        pxs = px;
+
+        tapCnt = numTaps;
+
+        while( tapCnt > 0U )
+        {
+            acc0 += ( q63_t )( *pxs++ ) * ( *pb++ );
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* Convert the result to 1.31 format */
+        acc_l = acc0 & 0xffffffff;
+        acc_h = ( acc0 >> 32 ) & 0xffffffff;
+        acc0 = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+        *pOut++ = ( q31_t ) acc0;
+        *pErr++ = *pRef++ - ( q31_t ) acc0;
+
+        px++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Update the coefficients with the gradient of the whole block:
+       b[k] += sum((mu * e[n]) * x[n-k]) */
+    pErr -= blockSize;
+    px = pState;
+    pb = pCoeffs;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Update 4 coefficients at a time. Each scaled error sample is computed
+       once for the 4 coefficients. */
+    tapCnt = numTaps >> 2U;
+
+    while( tapCnt > 0U )
+    {
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        pxs = px + 3U;
+
+        pe = pErr;
+
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
+        {
+            alpha = ( q31_t )( ( ( q63_t ) * pe++ * mu ) >> 31 );
+            x3 = *pxs++;
+
+            acc0 += ( q63_t ) alpha * x0;
+            acc1 += ( q63_t ) alpha * x1;
+            acc2 += ( q63_t ) alpha * x2;
+            acc3 += ( q63_t ) alpha * x3;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        pb[0] = clip_q63_to_q31( ( q63_t ) pb[0] + ( acc0 >> 31 ) );
+        pb[1] = clip_q63_to_q31( ( q63_t ) pb[1] + ( acc1 >> 31 ) );
+        pb[2] = clip_q63_to_q31( ( q63_t ) pb[2] + ( acc2 >> 31 ) );
+        pb[3] = clip_q63_to_q31( ( q63_t ) pb[3] + ( acc3 >> 31 ) );
+        pb += 4U;
+
+        px += 4U;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    /* If the filter length is not a multiple of 4, update the remaining coefficients */
+    tapCnt = numTaps % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = numTaps;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+    while( tapCnt > 0U )
+    {
+        acc0 = 0;
+        pe = pErr;
+        pxs = px;
+
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
+        {
+            alpha = ( q31_t )( ( ( q63_t ) * pe++ * mu ) >> 31 );
+            acc0 += ( q63_t ) alpha * ( *pxs++ );
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        *pb = clip_q63_to_q31( ( q63_t ) * pb + ( acc0 >> 31 ) );
+        pb++;
+
+        px++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    /* Processing is complete. Now copy the last numTaps - 1 samples to the
+       start of the state buffer. This prepares the state buffer for the
+       next function call. */
+
+    /* Points to the start of the pState buffer */
+    pStateCurnt = S->pState;
+    pState = S->pState + blockSize;
+
+    /* Copy (numTaps - 1U) samples */
+    tapCnt = ( numTaps - 1U );
+
+    while( tapCnt > 0U )
+    {
+        *pStateCurnt++ = *pState++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+}
+
+/**
+ * @} end of LMS_BLOCK group
+ */
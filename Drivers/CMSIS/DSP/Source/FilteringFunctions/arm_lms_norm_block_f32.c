@@ -0,0 +1,354 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_norm_block_f32.c
+ * Description:  Processing function for the floating-point block normalized LMS filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_BLOCK
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point block normalized LMS filter.
+ * @param[in]  *S points to an instance of the floating-point normalized LMS filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[in]  *pRef points to the block of reference data.
+ * @param[out] *pOut points to the block of output data.
+ * @param[out] *pErr points to the block of error data.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ *
+ * \par
+ * The coefficients are updated once, after the whole block has been filtered,
+ * with the step size <code>mu</code> divided by the mean energy of the filter
+ * state over the block. The energy and the oldest state sample are saved in
+ * the instance for the next call, as in <code>arm_lms_norm_f32()</code>.
+ * The error block is read back from <code>pErr</code> for the update, so
+ * <code>pErr</code> must not overlap <code>pSrc</code> or <code>pRef</code>.
+ */
+
+void arm_lms_norm_block_f32(
+    arm_lms_norm_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pRef,
+    float32_t *pOut,
+    float32_t *pErr,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;                 /* State pointer */
+    float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+    float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+    float32_t *px, *pb, *pe;                       /* Temporary pointers for state, coefficient and error buffers */
+    float32_t mu = S->mu;                          /* Adaptive factor */
+    float32_t energy = S->energy;                  /* Energy of the state window */
+    float32_t x0 = S->x0;                          /* Oldest sample of the previous state window */
+    float32_t energySum = 0.0f;                    /* Sum of the window energies over the block */
+    float32_t w;                                   /* Normalized step size */
+    uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    uint32_t tapCnt, blkCnt;                       /* Loop counters */
+    float32_t acc0;                                /* Accumulator */
+#if !defined (ARM_MATH_CM0_FAMILY)
+    float32_t acc1, acc2, acc3;                    /* Accumulators */
+    float32_t x1, x2, x3, c0, e;                   /* Temporary variables to hold state, coefficient and error values */
+    float32_t *pxs;                                /* Pointer to the newest state sample of the window */
+#endif
+
+    /* The mean energy of an empty block is undefined */
+    if( blockSize == 0U )
+    {
+        return;
+    }
+
+    /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+    /* pStateCurnt points to the location where the new input data should be written */
+    pStateCurnt = &( S->pState[( numTaps - 1U )] );
+
+    /* Copy the new input block into the state buffer */
+    blkCnt = blockSize;
+
+    while( blkCnt > 0U )
+    {
+        *pStateCurnt++ = *pSrc++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Track the energy of the state window sample by sample, as in
+       arm_lms_norm_f32(), and sum it over the block */
+    px = pState;
+    pe = pState + ( numTaps - 1U );
+
+    blkCnt = blockSize;
+
+    while( blkCnt > 0U )
+    {
+        energy -= x0 * x0;
+        energy += ( *pe ) * ( *pe );
+        pe++;
+
+        energySum += energy;
+
+        /* Save the oldest sample of the window for the next sample */
+        x0 = *px++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save energy and x0 values for the next frame */
+    S->energy = energy;
+    S->x0 = x0;
+
+    /* Normalize the step size by the mean energy of the block */
+    w = mu / ( ( energySum / ( float32_t ) blockSize ) + 0.000000119209289f );
+
+    /* Filter the block with the coefficients of the previous block */
+    px = pState;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time. Each coefficient is loaded once for the
+       4 outputs and the state window slides through registers. */
+    blkCnt = blockSize >> 2U;
+
+    while( blkCnt > 0U )
+    {
+        acc0 = 0.0f;
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+
+        /* Read the first 3 samples of the window */
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        pxs = px + 3U;
+
+        pb = pCoeffs;
+
+        tapCnt = numTaps;
+
+        while( tapCnt > 0U )
+        {
+            c0 = *pb++;
+            x3 = *pxs++;
+
+            acc0 += x0 * c0;
+            acc1 += x1 * c0;
+            acc2 += x2 * c0;
+            acc3 += x3 * c0;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* Store the outputs and the errors */
+        pOut[0] = acc0;
+        pOut[1] = acc1;
+        pOut[2] = acc2;
+        pOut[3] = acc3;
+        pOut += 4U;
+
+        pErr[0] = pRef[0] - acc0;
+        pErr[1] = pRef[1] - acc1;
+        pErr[2] = pRef[2] - acc2;
+        pErr[3] = pRef[3] - acc3;
+        pErr += 4U;
+        pRef += 4U;
+
+        px += 4U;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute the remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+    while( blkCnt > 0U )
+    {
+        acc0 = 0.0f;
+        pb = pCoeffs;
+        pe = px;
+
+        tapCnt = numTaps;
+
+        while( tapCnt > 0U )
+        {
+            acc0 += ( *pe++ ) * ( *pb++ );
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        *pOut++ = acc0;
+        *pErr++ = *pRef++ - acc0;
+
+        px++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Update the coefficients with the gradient of the whole block:
+       b[k] += w * sum(e[n] * x[n-k]) */
+    pErr -= blockSize;
+    px = pState;
+    pb = pCoeffs;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Update 4 coefficients at a time. Each error sample is loaded once for
+       the 4 coefficients. */
+    tapCnt = numTaps >> 2U;
+
+    while( tapCnt > 0U )
+    {
+        acc0 = 0.0f;
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        pxs = px + 3U;
+
+        pe = pErr;
+
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
+        {
+            e = *pe++;
+            x3 = *pxs++;
+
+            acc0 += e * x0;
+            acc1 += e * x1;
+            acc2 += e * x2;
+            acc3 += e * x3;
+
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        pb[0] += w * acc0;
+        pb[1] += w * acc1;
+        pb[2] += w * acc2;
+        pb[3] += w * acc3;
+        pb += 4U;
+
+        px += 4U;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    /* If the filter length is not a multiple of 4, update the remaining coefficients */
+    tapCnt = numTaps % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = numTaps;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+    while( tapCnt > 0U )
+    {
+        acc0 = 0.0f;
+        pe = pErr;
+        pStateCurnt = px;
+
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
+        {
+            acc0 += ( *pe++ ) * ( *pStateCurnt++ );
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        *pb++ += w * acc0;
+
+        px++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    /* Processing is complete. Now copy the last numTaps - 1 samples to the
+       start of the state buffer. This prepares the state buffer for the
+       next function call. */
+
+    /* Points to the start of the pState buffer */
+    pStateCurnt = S->pState;
+    pState = S->pState + blockSize;
+
+    /* Copy (numTaps - 1U) samples */
+    tapCnt = ( numTaps - 1U );
+
+    while( tapCnt > 0U )
+    {
+        *pStateCurnt++ = *pState++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+}
+
+/**
+ * @} end of LMS_BLOCK group
+ */
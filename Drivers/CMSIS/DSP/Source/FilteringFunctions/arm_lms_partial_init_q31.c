@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_partial_init_q31.c
+ * Description:  Initialization function for the Q31 partial-update LMS filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_BLOCK
+ * @{
+ */
+
+/**
+ * @brief Initialization function for the Q31 partial-update LMS filter.
+ * @param[in] *S points to an instance of the Q31 partial-update LMS filter structure.
+ * @param[in] numTaps  number of filter coefficients.
+ * @param[in] *pCoeffs points to coefficient buffer.
+ * @param[in] *pState points to state buffer.
+ * @param[in] mu step size that controls filter coefficient updates.
+ * @param[in] blockSize number of samples to process.
+ * @param[in] postShift bit shift applied to coefficients.
+ * @param[in] numUpdate number of coefficients updated per sample.
+ * @return none.
+ *
+ * \par Description:
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * The initial filter coefficients serve as a starting point for the adaptive filter.
+ * <code>pState</code> points to an array of length <code>numTaps+blockSize-1</code> samples,
+ * where <code>blockSize</code> is the number of input samples processed by each call to
+ * <code>arm_lms_partial_q31()</code>.
+ * <code>numUpdate</code> is limited to the range <code>[1, numTaps]</code>;
+ * with <code>numUpdate</code> equal to <code>numTaps</code> the filter behaves
+ * like <code>arm_lms_q31()</code>. The update starts at the first coefficient.
+ */
+
+void arm_lms_partial_init_q31(
+    arm_lms_partial_instance_q31 *S,
+    uint16_t numTaps,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    q31_t mu,
+    uint32_t blockSize,
+    uint32_t postShift,
+    uint16_t numUpdate )
+{
+    /* Assign filter taps */
+    S->numTaps = numTaps;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and size is always blockSize + numTaps - 1 */
+    memset( pState, 0, ( ( uint32_t ) numTaps + ( blockSize - 1U ) ) * sizeof( q31_t ) );
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    /* Assign Step size value */
+    S->mu = mu;
+
+    /* Assign postShift value to be applied */
+    S->postShift = postShift;
+
+    /* Limit the number of coefficients updated per sample to [1, numTaps] */
+    if( numUpdate > numTaps )
+    {
+        numUpdate = numTaps;
+    }
+
+    if( numUpdate == 0U )
+    {
+        numUpdate = 1U;
+    }
+
+    S->numUpdate = numUpdate;
+
+    /* Start the update at the first coefficient */
+    S->updateIndex = 0U;
+}
+
+/**
+ * @} end of LMS_BLOCK group
+ */
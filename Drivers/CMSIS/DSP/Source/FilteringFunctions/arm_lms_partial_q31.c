@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_partial_q31.c
+ * Description:  Processing function for the Q31 partial-update LMS filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_BLOCK
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 partial-update LMS filter.
+ * @param[in,out] *S points to an instance of the Q31 partial-update LMS filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[in]  *pRef points to the block of reference data.
+ * @param[out] *pOut points to the block of output data.
+ * @param[out] *pErr points to the block of error data.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The filter output, the error and the coefficient update are computed
+ * exactly as in <code>arm_lms_q31()</code>: a 2.62 accumulator with a single
+ * guard bit, shifted by <code>postShift</code> to 1.31 format, and a saturated
+ * coefficient update. The input signal must be scaled down by log2(numTaps)
+ * bits to avoid wrap around.
+ * \par
+ * For every sample the full filter output is computed, but only the
+ * <code>numUpdate</code> coefficients starting at <code>updateIndex</code>
+ * are updated. <code>updateIndex</code> then advances by <code>numUpdate</code>,
+ * modulo <code>numTaps</code>.
+ */
+
+void arm_lms_partial_q31(
+    arm_lms_partial_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pRef,
+    q31_t *pOut,
+    q31_t *pErr,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;                     /* State pointer */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+    q31_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+    q31_t mu = S->mu;                              /* Adaptive factor */
+    uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+    uint32_t numUpdate = S->numUpdate;             /* Number of coefficients updated per sample */
+    uint32_t index = S->updateIndex;               /* First coefficient updated for the current sample */
+    uint32_t tapCnt, blkCnt, runCnt;               /* Loop counters */
+    q63_t acc;                                     /* Accumulator */
+    q31_t e;                                       /* Error sample */
+    q31_t alpha;                                   /* Intermediate constant for taps update */
+    q31_t coef;                                    /* Temporary variable for coef */
+    q31_t acc_l, acc_h;                            /* Temporary variables to hold the accumulator parts */
+    uint32_t uShift = ( ( uint32_t ) S->postShift + 1U );
+    uint32_t lShift = 32U - uShift;                /* Shift to be applied to the output */
+
+    /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+    /* pStateCurnt points to the location where the new input data should be written */
+    pStateCurnt = &( S->pState[( numTaps - 1U )] );
+
+    blkCnt = blockSize;
+
+    while( blkCnt > 0U )
+    {
+        /* Copy the new input sample into the state buffer */
+        *pStateCurnt++ = *pSrc++;
+
+        /* Initialize pState pointer */
+        px = pState;
+
+        /* Initialize coeff pointer */
+        pb = pCoeffs;
+
+        /* Set the accumulator to zero */
+        acc = 0;
+
+#if !defined (ARM_MATH_CM0_FAMILY)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling.  Process 4 taps at a time. */
+        tapCnt = numTaps >> 2U;
+
+        while( tapCnt > 0U )
+        {
+            /* Perform the multiply-accumulate */
+            acc += ( q63_t )( *px++ ) * ( *pb++ );
+            acc += ( q63_t )( *px++ ) * ( *pb++ );
+            acc += ( q63_t )( *px++ ) * ( *pb++ );
+            acc += ( q63_t )( *px++ ) * ( *pb++ );
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+        tapCnt = numTaps % 0x4U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        tapCnt = numTaps;
+
+#endif /* #if !defined (ARM_MATH_CM0_FAMILY) */
+
+        while( tapCnt > 0U )
+        {
+            /* Perform the multiply-accumulate */
+            acc += ( q63_t )( *px++ ) * ( *pb++ );
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* Converting the result to 1.31 format */
+        acc_l = acc & 0xffffffff;
+        acc_h = ( acc >> 32 ) & 0xffffffff;
+        acc = ( uint32_t ) acc_l >> lShift | acc_h << uShift;
+
+        /* Store the result from accumulator into the destination buffer. */
+        *pOut++ = ( q31_t ) acc;
+
+        /* Compute and store error */
+        e = *pRef++ - ( q31_t ) acc;
+        *pErr++ = e;
+
+        /* Compute alpha i.e. intermediate constant for taps update */
+        alpha = ( q31_t )( ( ( q63_t ) e * mu ) >> 31 );
+
+        /* Update numUpdate coefficients starting at index, in at most two
+           runs when the selection wraps around the end of the array */
+        tapCnt = numUpdate;
+
+        while( tapCnt > 0U )
+        {
+            runCnt = numTaps - index;
+
+            if( runCnt > tapCnt )
+            {
+                runCnt = tapCnt;
+            }
+
+            tapCnt -= runCnt;
+
+            px = pState + index;
+            pb = pCoeffs + index;
+
+            index += runCnt;
+
+            if( index == numTaps )
+            {
+                index = 0U;
+            }
+
+            while( runCnt > 0U )
+            {
+                coef = ( q31_t )( ( ( q63_t ) alpha * ( *px++ ) ) >> ( 32 ) );
+                *pb = clip_q63_to_q31( ( q63_t ) * pb + ( coef << 1U ) );
+                pb++;
+
+                /* Decrement the loop counter */
+                runCnt--;
+            }
+        }
+
+        /* Advance state pointer by 1 for the next sample */
+        pState = pState + 1;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the update position for the next call */
+    S->updateIndex = index;
+
+    /* Processing is complete. Now copy the last numTaps - 1 samples to the
+       start of the state buffer. This prepares the state buffer for the
+       next function call. */
+
+    /* Points to the start of the pState buffer */
+    pStateCurnt = S->pState;
+
+    /* Copy (numTaps - 1U) samples */
+    tapCnt = ( numTaps - 1U );
+
+    while( tapCnt > 0U )
+    {
+        *pStateCurnt++ = *pState++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+}
+
+/**
+ * @} end of LMS_BLOCK group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDLT Decomposition
+ *
+ * Computes the Cholesky or LDL<sup>T</sup> decomposition of a symmetric matrix.
+ *
+ * The Cholesky decomposition of a symmetric positive definite matrix A is
+ * <pre>
+ *     A = L * L<sup>T</sup>
+ * </pre>
+ * where L is lower triangular with a positive diagonal.
+ *
+ * The LDL<sup>T</sup> decomposition of a symmetric positive semi-definite matrix A is
+ * <pre>
+ *     P * A * P<sup>T</sup> = L * D * L<sup>T</sup>
+ * </pre>
+ * where L is lower triangular with a unit diagonal, D is diagonal and P is a permutation
+ * matrix. It needs no square roots and also works on singular matrices.
+ *
+ * \par
+ * Linear systems <code>A * X = B</code> with a symmetric matrix A, such as the
+ * innovation covariance of a Kalman filter, are then solved with two triangular solves
+ * instead of an explicit matrix inverse. See arm_mat_solve_lower_triangular_f32() and
+ * arm_mat_solve_upper_triangular_f32().
+ *
+ * \par
+ * Only the lower triangle of the input matrix is read.
+ * The functions check that the input and output matrices are square and of the same size.
+ * There are separate functions for floating-point and Q31 data types.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition of a positive definite matrix.
+ * @param[in]       *pSrc points to the instance of the input floating-point matrix structure.
+ * @param[out]      *pDst points to the instance of the output floating-point matrix structure.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The lower triangular factor L is written to <code>pDst</code> and its upper triangle is set to zero.
+ * The Cholesky-Crout algorithm is used, computing L one column at a time.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_cholesky_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pDst )
+{
+    float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+    float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+    float32_t *pRowI, *pRowJ;                      /* output row pointers */
+    float32_t sum;                                 /* accumulator */
+    float32_t invDiag;                             /* reciprocal of the diagonal element */
+    uint32_t n = pSrc->numRows;                    /* size of the matrix */
+    uint32_t i, j, k;                              /* loop counters */
+    arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( pSrc->numRows != pSrc->numCols ) || ( pDst->numRows != pDst->numCols )
+            || ( pSrc->numRows != pDst->numRows ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        for ( j = 0U; j < n; j++ )
+        {
+            pRowJ = pL + ( j * n );
+
+            /* L[j][j] = sqrt(A[j][j] - (L[j][0]^2 + ... + L[j][j-1]^2)) */
+            sum = pA[( j * n ) + j];
+
+            for ( k = 0U; k < j; k++ )
+            {
+                sum -= pRowJ[k] * pRowJ[k];
+            }
+
+            /* The matrix is not positive definite */
+            if( sum <= 0.0f )
+            {
+                status = ARM_MATH_DECOMPOSITION_FAILURE;
+                break;
+            }
+
+            arm_sqrt_f32( sum, &pRowJ[j] );
+            invDiag = 1.0f / pRowJ[j];
+
+            /* Clear the upper triangle of row j */
+            for ( k = j + 1U; k < n; k++ )
+            {
+                pRowJ[k] = 0.0f;
+            }
+
+            /* L[i][j] = (A[i][j] - (L[i][0] * L[j][0] + ... + L[i][j-1] * L[j][j-1])) / L[j][j] */
+            for ( i = j + 1U; i < n; i++ )
+            {
+                pRowI = pL + ( i * n );
+                sum = pA[( i * n ) + j];
+
+                for ( k = 0U; k < j; k++ )
+                {
+                    sum -= pRowI[k] * pRowJ[k];
+                }
+
+                pRowI[j] = sum * invDiag;
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_q31.c
+ * Description:  Q31 Cholesky decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Q31 Cholesky decomposition of a positive definite matrix.
+ * @param[in]       *pSrc points to the instance of the input Q31 matrix structure.
+ * @param[out]      *pDst points to the instance of the output Q31 matrix structure.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The input and output matrices are in 1.31 format.
+ * For a positive definite matrix every element of L satisfies
+ * <code>|L[i][j]| <= sqrt(A[i][i])</code>, so L always fits in 1.31 format and no
+ * scaling of the input is needed. If the input is scaled by 2<sup>-k</sup>, L is scaled by 2<sup>-k/2</sup>.
+ *
+ * \par
+ * The dot products are computed in 64-bit accumulators in 2.62 format which keep the
+ * full precision of the intermediate multiplications. By the Cauchy-Schwarz inequality
+ * every partial sum stays below 2.0, so the accumulators cannot overflow.
+ * The diagonal elements are computed with an exact 64-bit integer square root
+ * rounded to 1.31 format, and the other elements with a 64-bit division by the diagonal.
+ */
+
+arm_status arm_mat_cholesky_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pDst )
+{
+    q31_t *pA = pSrc->pData;                       /* input data matrix pointer */
+    q31_t *pL = pDst->pData;                       /* output data matrix pointer */
+    q31_t *pRowI, *pRowJ;                          /* output row pointers */
+    q63_t acc;                                     /* accumulator */
+    uint64_t rem, root, bit;                       /* square root variables */
+    uint32_t n = pSrc->numRows;                    /* size of the matrix */
+    uint32_t i, j, k;                              /* loop counters */
+    arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( pSrc->numRows != pSrc->numCols ) || ( pDst->numRows != pDst->numCols )
+            || ( pSrc->numRows != pDst->numRows ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        for ( j = 0U; j < n; j++ )
+        {
+            pRowJ = pL + ( j * n );
+
+            /* A[j][j] - (L[j][0]^2 + ... + L[j][j-1]^2) in 2.62 format */
+            acc = ( q63_t ) pA[( j * n ) + j] << 31;
+
+            for ( k = 0U; k < j; k++ )
+            {
+                acc -= ( q63_t ) pRowJ[k] * pRowJ[k];
+            }
+
+            /* The matrix is not positive definite */
+            if( acc <= 0 )
+            {
+                status = ARM_MATH_DECOMPOSITION_FAILURE;
+                break;
+            }
+
+            /* Integer square root of the 2.62 value yields the 1.31 result directly */
+            rem = ( uint64_t ) acc;
+            root = 0U;
+            bit = ( uint64_t ) 1U << 62;
+
+            while( bit > rem )
+            {
+                bit >>= 2U;
+            }
+
+            while( bit != 0U )
+            {
+                if( rem >= ( root + bit ) )
+                {
+                    rem -= root + bit;
+                    root = ( root >> 1U ) + bit;
+                }
+                else
+                {
+                    root >>= 1U;
+                }
+
+                bit >>= 2U;
+            }
+
+            /* Round to nearest */
+            if( rem > root )
+            {
+                root++;
+            }
+
+            pRowJ[j] = ( root > 0x7FFFFFFFU ) ? 0x7FFFFFFF : ( q31_t ) root;
+
+            /* Clear the upper triangle of row j */
+            for ( k = j + 1U; k < n; k++ )
+            {
+                pRowJ[k] = 0;
+            }
+
+            /* L[i][j] = (A[i][j] - (L[i][0] * L[j][0] + ... + L[i][j-1] * L[j][j-1])) / L[j][j] */
+            for ( i = j + 1U; i < n; i++ )
+            {
+                pRowI = pL + ( i * n );
+                acc = ( q63_t ) pA[( i * n ) + j] << 31;
+
+                for ( k = 0U; k < j; k++ )
+                {
+                    acc -= ( q63_t ) pRowI[k] * pRowJ[k];
+                }
+
+                /* 2.62 divided by 1.31 yields 1.31 */
+                pRowI[j] = clip_q63_to_q31( acc / pRowJ[j] );
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f32.c
+ * Description:  Floating-point LDL^T decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL<sup>T</sup> decomposition of a positive semi-definite matrix.
+ * @param[in]       *pSrc points to the instance of the input floating-point matrix structure.
+ * @param[out]      *pL   points to the instance of the output floating-point unit lower triangular matrix structure.
+ * @param[out]      *pD   points to the instance of the output floating-point diagonal matrix structure.
+ * @param[out]      *pp   points to the output permutation vector of length <code>numRows</code>.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of an output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive semi-definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The decomposition is <code>P * A * P<sup>T</sup> = L * D * L<sup>T</sup></code>.
+ * Row <code>i</code> of <code>P * A</code> is row <code>pp[i]</code> of A.
+ * At each step the largest remaining diagonal element is chosen as the pivot
+ * (symmetric diagonal pivoting), which keeps the elements of L bounded by 1.
+ * When the remaining block is zero the decomposition stops: the rest of D is zero and
+ * the rest of L is the identity.
+ * The matrix <code>pL</code> is used as workspace, so it must not be the same as <code>pSrc</code>.
+ *
+ * \par
+ * Rounding errors can make a singular positive semi-definite matrix look slightly
+ * indefinite. Pivots smaller in magnitude than <code>numRows</code> times the single precision
+ * epsilon times the largest diagonal element of the input are treated as zero.
+ */
+
+arm_status arm_mat_ldlt_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pL,
+    arm_matrix_instance_f32 *pD,
+    uint16_t *pp )
+{
+    float32_t *a = pL->pData;                      /* workspace, holds L at the end */
+    float32_t *d = pD->pData;                      /* output diagonal matrix pointer */
+    float32_t pivot;                               /* current pivot */
+    float32_t tmp;                                 /* temporary value for swaps */
+    float32_t invPivot;                            /* reciprocal of the pivot */
+    float32_t tol;                                 /* tolerance for zero pivots */
+    uint32_t n = pSrc->numRows;                    /* size of the matrix */
+    uint32_t i, k, m, w, x;                        /* loop counters and indices */
+    uint32_t rank;                                 /* number of non-zero pivots */
+    uint16_t tmpIndex;                             /* temporary index for swaps */
+    arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( pSrc->numRows != pSrc->numCols ) || ( pL->numRows != pL->numCols )
+            || ( pD->numRows != pD->numCols ) || ( pSrc->numRows != pL->numRows )
+            || ( pSrc->numRows != pD->numRows ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        /* Copy the lower triangle of the input into a symmetric workspace */
+        for ( i = 0U; i < n; i++ )
+        {
+            for ( k = 0U; k <= i; k++ )
+            {
+                a[( i * n ) + k] = pSrc->pData[( i * n ) + k];
+                a[( k * n ) + i] = pSrc->pData[( i * n ) + k];
+            }
+
+            pp[i] = ( uint16_t ) i;
+        }
+
+        /* Pivots below this tolerance are treated as zero */
+        tol = 0.0f;
+
+        for ( k = 0U; k < n; k++ )
+        {
+            if( a[( k * n ) + k] > tol )
+            {
+                tol = a[( k * n ) + k];
+            }
+        }
+
+        tol = tol * ( float32_t ) n * 1.2e-7f;
+
+        for ( k = 0U; k < n; k++ )
+        {
+            /* Find the largest remaining diagonal element */
+            m = k;
+
+            for ( i = k + 1U; i < n; i++ )
+            {
+                if( a[( i * n ) + i] > a[( m * n ) + m] )
+                {
+                    m = i;
+                }
+            }
+
+            /* Swap rows and columns k and m */
+            if( m != k )
+            {
+                for ( i = 0U; i < n; i++ )
+                {
+                    tmp = a[( k * n ) + i];
+                    a[( k * n ) + i] = a[( m * n ) + i];
+                    a[( m * n ) + i] = tmp;
+                }
+
+                for ( i = 0U; i < n; i++ )
+                {
+                    tmp = a[( i * n ) + k];
+                    a[( i * n ) + k] = a[( i * n ) + m];
+                    a[( i * n ) + m] = tmp;
+                }
+
+                tmpIndex = pp[k];
+                pp[k] = pp[m];
+                pp[m] = tmpIndex;
+            }
+
+            pivot = a[( k * n ) + k];
+
+            /* Negative pivot: the matrix is not positive semi-definite */
+            if( pivot < -tol )
+            {
+                status = ARM_MATH_DECOMPOSITION_FAILURE;
+                break;
+            }
+
+            /* Zero pivot: the remaining block is zero and the matrix has rank k */
+            if( pivot <= tol )
+            {
+                break;
+            }
+
+            invPivot = 1.0f / pivot;
+
+            /* Update the remaining block with the Schur complement, keeping it symmetric */
+            for ( w = k + 1U; w < n; w++ )
+            {
+                for ( x = k + 1U; x <= w; x++ )
+                {
+                    a[( w * n ) + x] -= ( a[( w * n ) + k] * a[( x * n ) + k] ) * invPivot;
+                    a[( x * n ) + w] = a[( w * n ) + x];
+                }
+            }
+
+            /* Column k of L */
+            for ( w = k + 1U; w < n; w++ )
+            {
+                a[( w * n ) + k] *= invPivot;
+            }
+        }
+
+        if( status == ARM_MATH_SUCCESS )
+        {
+            /* Columns from the first zero pivot onwards belong to the zero block */
+            rank = k;
+
+            /* Split the workspace into D and the unit lower triangular L */
+            for ( i = 0U; i < n; i++ )
+            {
+                for ( k = 0U; k < n; k++ )
+                {
+                    d[( i * n ) + k] = 0.0f;
+
+                    if( ( k > i ) || ( ( k >= rank ) && ( k != i ) ) )
+                    {
+                        a[( i * n ) + k] = 0.0f;
+                    }
+                }
+
+                if( i < rank )
+                {
+                    d[( i * n ) + i] = a[( i * n ) + i];
+                }
+
+                a[( i * n ) + i] = 1.0f;
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,224 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_q31.c
+ * Description:  Q31 LDL^T decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Q31 LDL<sup>T</sup> decomposition of a positive semi-definite matrix.
+ * @param[in]       *pSrc points to the instance of the input Q31 matrix structure.
+ * @param[out]      *pL   points to the instance of the output Q31 unit lower triangular matrix structure.
+ * @param[out]      *pD   points to the instance of the output Q31 diagonal matrix structure.
+ * @param[out]      *pp   points to the output permutation vector of length <code>numRows</code>.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of an output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive semi-definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The decomposition is <code>P * A * P<sup>T</sup> = L * D * L<sup>T</sup></code>.
+ * Row <code>i</code> of <code>P * A</code> is row <code>pp[i]</code> of A.
+ * At each step the largest remaining diagonal element is chosen as the pivot
+ * (symmetric diagonal pivoting), which keeps the elements of L bounded by 1.
+ * When the remaining block is zero the decomposition stops: the rest of D is zero and
+ * the rest of L is the identity.
+ * The matrix <code>pL</code> is used as workspace, so it must not be the same as <code>pSrc</code>.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The input and output matrices are in 1.31 format.
+ * With diagonal pivoting every element of L satisfies <code>|L[i][j]| <= 1</code> and
+ * every element of D is bounded by the largest diagonal element of A, so no scaling of
+ * the input is needed. Elements of L equal to 1.0, including the unit diagonal, are
+ * stored as <code>0x7FFFFFFF</code>.
+ *
+ * \par
+ * The Schur complement updates are computed as a 2.62 product divided by the 1.31
+ * pivot, which keeps the full precision of the multiplication before rounding to 1.31.
+ * Each update can round by one LSB, so pivots within <code>numRows</code> LSBs of zero
+ * end the decomposition and mark the matrix as rank deficient.
+ */
+
+arm_status arm_mat_ldlt_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pL,
+    arm_matrix_instance_q31 *pD,
+    uint16_t *pp )
+{
+    q31_t *a = pL->pData;                          /* workspace, holds L at the end */
+    q31_t *d = pD->pData;                          /* output diagonal matrix pointer */
+    q31_t pivot;                                   /* current pivot */
+    q31_t tmp;                                     /* temporary value for swaps */
+    uint32_t n = pSrc->numRows;                    /* size of the matrix */
+    uint32_t i, k, m, w, x;                        /* loop counters and indices */
+    uint32_t rank;                                 /* number of non-zero pivots */
+    uint16_t tmpIndex;                             /* temporary index for swaps */
+    arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( pSrc->numRows != pSrc->numCols ) || ( pL->numRows != pL->numCols )
+            || ( pD->numRows != pD->numCols ) || ( pSrc->numRows != pL->numRows )
+            || ( pSrc->numRows != pD->numRows ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        /* Copy the lower triangle of the input into a symmetric workspace */
+        for ( i = 0U; i < n; i++ )
+        {
+            for ( k = 0U; k <= i; k++ )
+            {
+                a[( i * n ) + k] = pSrc->pData[( i * n ) + k];
+                a[( k * n ) + i] = pSrc->pData[( i * n ) + k];
+            }
+
+            pp[i] = ( uint16_t ) i;
+        }
+
+        for ( k = 0U; k < n; k++ )
+        {
+            /* Find the largest remaining diagonal element */
+            m = k;
+
+            for ( i = k + 1U; i < n; i++ )
+            {
+                if( a[( i * n ) + i] > a[( m * n ) + m] )
+                {
+                    m = i;
+                }
+            }
+
+            /* Swap rows and columns k and m */
+            if( m != k )
+            {
+                for ( i = 0U; i < n; i++ )
+                {
+                    tmp = a[( k * n ) + i];
+                    a[( k * n ) + i] = a[( m * n ) + i];
+                    a[( m * n ) + i] = tmp;
+                }
+
+                for ( i = 0U; i < n; i++ )
+                {
+                    tmp = a[( i * n ) + k];
+                    a[( i * n ) + k] = a[( i * n ) + m];
+                    a[( i * n ) + m] = tmp;
+                }
+
+                tmpIndex = pp[k];
+                pp[k] = pp[m];
+                pp[m] = tmpIndex;
+            }
+
+            pivot = a[( k * n ) + k];
+
+            /* Negative pivot: the matrix is not positive semi-definite */
+            if( pivot < -( q31_t ) n )
+            {
+                status = ARM_MATH_DECOMPOSITION_FAILURE;
+                break;
+            }
+
+            /* Zero pivot: the remaining block is zero and the matrix has rank k */
+            if( pivot <= ( q31_t ) n )
+            {
+                break;
+            }
+
+            /* Update the remaining block with the Schur complement, keeping it symmetric */
+            for ( w = k + 1U; w < n; w++ )
+            {
+                for ( x = k + 1U; x <= w; x++ )
+                {
+                    a[( w * n ) + x] -= ( q31_t )( ( ( q63_t ) a[( w * n ) + k] * a[( x * n ) + k] ) / pivot );
+                    a[( x * n ) + w] = a[( w * n ) + x];
+                }
+            }
+
+            /* Column k of L */
+            for ( w = k + 1U; w < n; w++ )
+            {
+                a[( w * n ) + k] = clip_q63_to_q31( ( ( q63_t ) a[( w * n ) + k] << 31 ) / pivot );
+            }
+        }
+
+        if( status == ARM_MATH_SUCCESS )
+        {
+            /* Columns from the first zero pivot onwards belong to the zero block */
+            rank = k;
+
+            /* Split the workspace into D and the unit lower triangular L */
+            for ( i = 0U; i < n; i++ )
+            {
+                for ( k = 0U; k < n; k++ )
+                {
+                    d[( i * n ) + k] = 0;
+
+                    if( ( k > i ) || ( ( k >= rank ) && ( k != i ) ) )
+                    {
+                        a[( i * n ) + k] = 0;
+                    }
+                }
+
+                if( i < rank )
+                {
+                    d[( i * n ) + i] = a[( i * n ) + i];
+                }
+
+                a[( i * n ) + i] = 0x7FFFFFFF;
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixChol group
+ */
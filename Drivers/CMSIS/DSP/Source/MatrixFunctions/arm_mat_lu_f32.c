@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_f32.c
+ * Description:  Floating-point LU decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLU LU Decomposition
+ *
+ * Computes the LU decomposition of a square matrix with partial pivoting:
+ * <pre>
+ *     P * A = L * U
+ * </pre>
+ * where L is lower triangular with a unit diagonal, U is upper triangular and P is a
+ * row permutation matrix.
+ *
+ * \par
+ * A linear system <code>A * X = B</code> is then solved by permuting the rows of B,
+ * solving <code>L * Y = P * B</code> with arm_mat_solve_lower_triangular_f32() and
+ * <code>U * X = Y</code> with arm_mat_solve_upper_triangular_f32().
+ *
+ * \par Algorithm
+ * Gaussian elimination is applied one column at a time. In each column the element
+ * with the largest magnitude on or below the diagonal is swapped onto the diagonal,
+ * so every element of L has a magnitude of at most 1.
+ * If a whole column is zero, the matrix is singular and the function returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ *
+ * \par
+ * The functions check that the input and output matrices are square and of the same size.
+ * There are separate functions for floating-point and Q31 data types.
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point LU decomposition with partial pivoting.
+ * @param[in]       *pSrc points to the instance of the input floating-point matrix structure.
+ * @param[out]      *pL   points to the instance of the output floating-point unit lower triangular matrix structure.
+ * @param[out]      *pU   points to the instance of the output floating-point upper triangular matrix structure.
+ * @param[out]      *pp   points to the output permutation vector of length <code>numRows</code>.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of an output matrix does not match the size of the input matrix.
+ * If the input matrix is singular, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The decomposition is <code>P * A = L * U</code>.
+ * Row <code>i</code> of <code>P * A</code> is row <code>pp[i]</code> of A.
+ * <code>pU</code> may point to the same matrix as <code>pSrc</code>, in which case the input is overwritten.
+ */
+
+arm_status arm_mat_lu_f32(
+    const arm_matrix_instance_f32 *pSrc,
+    arm_matrix_instance_f32 *pL,
+    arm_matrix_instance_f32 *pU,
+    uint16_t *pp )
+{
+    float32_t *l = pL->pData;                      /* output lower triangular matrix pointer */
+    float32_t *u = pU->pData;                      /* output upper triangular matrix pointer */
+    float32_t tmp;                                 /* temporary value for swaps */
+    float32_t maxVal, val;                         /* pivot search values */
+    float32_t factor;                              /* elimination factor */
+    float32_t invPivot;                            /* reciprocal of the pivot */
+    uint32_t n = pSrc->numRows;                    /* size of the matrix */
+    uint32_t i, j, k, m;                           /* loop counters and indices */
+    uint16_t tmpIndex;                             /* temporary index for swaps */
+    arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( pSrc->numRows != pSrc->numCols ) || ( pL->numRows != pL->numCols )
+            || ( pU->numRows != pU->numCols ) || ( pSrc->numRows != pL->numRows )
+            || ( pSrc->numRows != pU->numRows ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        /* U starts as a copy of the input and L as the identity */
+        for ( i = 0U; i < n; i++ )
+        {
+            for ( j = 0U; j < n; j++ )
+            {
+                u[( i * n ) + j] = pSrc->pData[( i * n ) + j];
+                l[( i * n ) + j] = 0.0f;
+            }
+
+            pp[i] = ( uint16_t ) i;
+        }
+
+        for ( k = 0U; k < n; k++ )
+        {
+            /* Find the element of column k with the largest magnitude */
+            m = k;
+            maxVal = 0.0f;
+
+            for ( i = k; i < n; i++ )
+            {
+                val = fabsf( u[( i * n ) + k] );
+
+                if( val > maxVal )
+                {
+                    maxVal = val;
+                    m = i;
+                }
+            }
+
+            /* The whole column is zero */
+            if( maxVal == 0.0f )
+            {
+                status = ARM_MATH_SINGULAR;
+                break;
+            }
+
+            /* Swap rows k and m of U, of the computed part of L and of the permutation */
+            if( m != k )
+            {
+                for ( j = 0U; j < n; j++ )
+                {
+                    tmp = u[( k * n ) + j];
+                    u[( k * n ) + j] = u[( m * n ) + j];
+                    u[( m * n ) + j] = tmp;
+                }
+
+                for ( j = 0U; j < k; j++ )
+                {
+                    tmp = l[( k * n ) + j];
+                    l[( k * n ) + j] = l[( m * n ) + j];
+                    l[( m * n ) + j] = tmp;
+                }
+
+                tmpIndex = pp[k];
+                pp[k] = pp[m];
+                pp[m] = tmpIndex;
+            }
+
+            l[( k * n ) + k] = 1.0f;
+
+            invPivot = 1.0f / u[( k * n ) + k];
+
+            /* Eliminate the elements below the diagonal */
+            for ( i = k + 1U; i < n; i++ )
+            {
+                factor = u[( i * n ) + k] * invPivot;
+                l[( i * n ) + k] = factor;
+                u[( i * n ) + k] = 0.0f;
+
+                for ( j = k + 1U; j < n; j++ )
+                {
+                    u[( i * n ) + j] -= factor * u[( k * n ) + j];
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixLU group
+ */
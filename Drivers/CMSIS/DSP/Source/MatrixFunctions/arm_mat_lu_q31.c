@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_q31.c
+ * Description:  Q31 LU decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Q31 LU decomposition with partial pivoting.
+ * @param[in]       *pSrc points to the instance of the input Q31 matrix structure.
+ * @param[out]      *pL   points to the instance of the output Q31 unit lower triangular matrix structure.
+ * @param[out]      *pU   points to the instance of the output Q31 upper triangular matrix structure.
+ * @param[out]      *pp   points to the output permutation vector of length <code>numRows</code>.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of an output matrix does not match the size of the input matrix.
+ * If the input matrix is singular, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The decomposition is <code>P * A = L * U</code>.
+ * Row <code>i</code> of <code>P * A</code> is row <code>pp[i]</code> of A.
+ * <code>pU</code> may point to the same matrix as <code>pSrc</code>, in which case the input is overwritten.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The input and output matrices are in 1.31 format.
+ * Partial pivoting keeps every element of L within [-1, 1]; elements equal to 1.0,
+ * including the unit diagonal, are stored as <code>0x7FFFFFFF</code>.
+ * The elements of U can grow during the elimination, by at most a factor of
+ * 2<sup>numRows-1</sup> and in practice much less. The updates of U are saturated
+ * to 1.31 format, so the input should be scaled down if the elements of U may exceed 1.0.
+ *
+ * \par
+ * The elimination factors are computed as a 64-bit division of the 2.62 value by the
+ * 1.31 pivot, and the updates of U keep the full 2.62 precision of the product before
+ * they are rounded down to 1.31 format.
+ */
+
+arm_status arm_mat_lu_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pL,
+    arm_matrix_instance_q31 *pU,
+    uint16_t *pp )
+{
+    q31_t *l = pL->pData;                          /* output lower triangular matrix pointer */
+    q31_t *u = pU->pData;                          /* output upper triangular matrix pointer */
+    q31_t tmp;                                     /* temporary value for swaps */
+    q31_t maxVal, val;                             /* pivot search values */
+    q31_t factor;                                  /* elimination factor */
+    q31_t pivot;                                   /* current pivot */
+    uint32_t n = pSrc->numRows;                    /* size of the matrix */
+    uint32_t i, j, k, m;                           /* loop counters and indices */
+    uint16_t tmpIndex;                             /* temporary index for swaps */
+    arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( pSrc->numRows != pSrc->numCols ) || ( pL->numRows != pL->numCols )
+            || ( pU->numRows != pU->numCols ) || ( pSrc->numRows != pL->numRows )
+            || ( pSrc->numRows != pU->numRows ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        /* U starts as a copy of the input and L as the identity */
+        for ( i = 0U; i < n; i++ )
+        {
+            for ( j = 0U; j < n; j++ )
+            {
+                u[( i * n ) + j] = pSrc->pData[( i * n ) + j];
+                l[( i * n ) + j] = 0;
+            }
+
+            pp[i] = ( uint16_t ) i;
+        }
+
+        for ( k = 0U; k < n; k++ )
+        {
+            /* Find the element of column k with the largest magnitude */
+            m = k;
+            maxVal = 0;
+
+            for ( i = k; i < n; i++ )
+            {
+                val = ( u[( i * n ) + k] > 0 ) ? u[( i * n ) + k] : ( q31_t ) __QSUB( 0, u[( i * n ) + k] );
+
+                if( val > maxVal )
+                {
+                    maxVal = val;
+                    m = i;
+                }
+            }
+
+            /* The whole column is zero */
+            if( maxVal == 0 )
+            {
+                status = ARM_MATH_SINGULAR;
+                break;
+            }
+
+            /* Swap rows k and m of U, of the computed part of L and of the permutation */
+            if( m != k )
+            {
+                for ( j = 0U; j < n; j++ )
+                {
+                    tmp = u[( k * n ) + j];
+                    u[( k * n ) + j] = u[( m * n ) + j];
+                    u[( m * n ) + j] = tmp;
+                }
+
+                for ( j = 0U; j < k; j++ )
+                {
+                    tmp = l[( k * n ) + j];
+                    l[( k * n ) + j] = l[( m * n ) + j];
+                    l[( m * n ) + j] = tmp;
+                }
+
+                tmpIndex = pp[k];
+                pp[k] = pp[m];
+                pp[m] = tmpIndex;
+            }
+
+            l[( k * n ) + k] = 0x7FFFFFFF;
+
+            pivot = u[( k * n ) + k];
+
+            /* Eliminate the elements below the diagonal */
+            for ( i = k + 1U; i < n; i++ )
+            {
+                /* 2.62 divided by 1.31 yields 1.31 */
+                factor = clip_q63_to_q31( ( ( q63_t ) u[( i * n ) + k] << 31 ) / pivot );
+                l[( i * n ) + k] = factor;
+                u[( i * n ) + k] = 0;
+
+                for ( j = k + 1U; j < n; j++ )
+                {
+                    u[( i * n ) + j] = clip_q63_to_q31( ( q63_t ) u[( i * n ) + j]
+                                                        - ( ( ( q63_t ) factor * u[( k * n ) + j] ) >> 31 ) );
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixLU group
+ */
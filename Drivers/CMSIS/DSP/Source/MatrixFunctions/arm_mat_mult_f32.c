@@ -46,6 +46,13 @@
  * When matrix size checking is enabled, the functions check: (1) that the inner dimensions of
  * <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output
  * matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.
+ *
+ * \par Small matrices
+ * When all three matrices are 2x2, 3x3, 4x4 or 6x6, <code>arm_mat_mult_f32()</code> and
+ * <code>arm_mat_mult_q31()</code> hand over to fully unrolled kernels without any loop overhead.
+ * These kernels can also be called directly on the matrix data, for example
+ * <code>arm_mat_mult_3x3_f32()</code>, which skips the size checks as well.
+ * Define <code>ARM_MATH_SMALL_MATRIX_DISABLE</code> when building the library to leave them out.
  */
 
 
@@ -100,6 +107,17 @@ arm_status arm_mat_mult_f32(
     else
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 products are handled by the unrolled kernels */
+    if( arm_mat_mult_small_f32( pSrcA, pSrcB, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
         /* row loop */
@@ -203,6 +221,17 @@ arm_status arm_mat_mult_f32(
     else
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 products are handled by the unrolled kernels */
+    if( arm_mat_mult_small_f32( pSrcA, pSrcB, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* The following loop performs the dot-product of each row in pInA with each column in pInB */
         /* row loop */
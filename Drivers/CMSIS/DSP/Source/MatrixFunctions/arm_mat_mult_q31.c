@@ -99,6 +99,17 @@ arm_status arm_mat_mult_q31(
     else
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 products are handled by the unrolled kernels */
+    if( arm_mat_mult_small_q31( pSrcA, pSrcB, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
         /* row loop */
@@ -209,6 +220,17 @@ arm_status arm_mat_mult_q31(
     else
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 products are handled by the unrolled kernels */
+    if( arm_mat_mult_small_q31( pSrcA, pSrcB, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
         /* row loop */
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_small_q31.c
+ * Description:  Q31 small matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/*
+ * Fully unrolled kernels for the products of two 2x2, 3x3, 4x4 or 6x6
+ * matrices, generated from arm_mat_small_template.h. They take the matrix data
+ * directly and do no size checking. The destination must not overlap either
+ * source.
+ *
+ * The products are accumulated in a 2.62 format 64-bit accumulator and the
+ * result is truncated and saturated to 1.31 format, exactly as in the
+ * Cortex-M0 code path of arm_mat_mult_q31(). The Cortex-M3/M4 code path of
+ * arm_mat_mult_q31() does not saturate, so when a sum of products overflows
+ * the 1.31 range the generic and unrolled results differ; they are otherwise
+ * bit-exact.
+ */
+
+#define ARM_MAT_SMALL_T                q31_t
+#define ARM_MAT_SMALL_ACC              q63_t
+#define ARM_MAT_SMALL_MAC(acc, a, b)   acc += ( q63_t ) ( a ) * ( b )
+#define ARM_MAT_SMALL_OUT(acc)         ( q31_t ) clip_q63_to_q31( ( acc ) >> 31 )
+
+#define ARM_MAT_SMALL_N                2
+#define ARM_MAT_SMALL_MULT             arm_mat_mult_2x2_q31
+#include "arm_mat_small_template.h"
+
+#define ARM_MAT_SMALL_N                3
+#define ARM_MAT_SMALL_MULT             arm_mat_mult_3x3_q31
+#include "arm_mat_small_template.h"
+
+#define ARM_MAT_SMALL_N                4
+#define ARM_MAT_SMALL_MULT             arm_mat_mult_4x4_q31
+#include "arm_mat_small_template.h"
+
+#define ARM_MAT_SMALL_N                6
+#define ARM_MAT_SMALL_MULT             arm_mat_mult_6x6_q31
+#include "arm_mat_small_template.h"
+
+/**
+ * @brief Q31 small matrix multiplication dispatch.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return          The function returns <code>ARM_MATH_SUCCESS</code> when all three matrices are
+ * 2x2, 3x3, 4x4 or 6x6 and the product has been computed, and <code>ARM_MATH_ARGUMENT_ERROR</code>
+ * otherwise, in which case <code>pDst</code> is left untouched.
+ *
+ * \par
+ * Called by <code>arm_mat_mult_q31()</code> before its generic loops.
+ */
+
+arm_status arm_mat_mult_small_q31(
+    const arm_matrix_instance_q31 *pSrcA,
+    const arm_matrix_instance_q31 *pSrcB,
+    arm_matrix_instance_q31 *pDst )
+{
+    uint16_t n = pSrcA->numRows;                   /* matrix dimension */
+
+    if( ( pSrcA->numCols != n ) || ( pSrcB->numRows != n ) || ( pSrcB->numCols != n ) ||
+            ( pDst->numRows != n ) || ( pDst->numCols != n ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    switch( n )
+    {
+        case 2U:
+            arm_mat_mult_2x2_q31( pSrcA->pData, pSrcB->pData, pDst->pData );
+            break;
+
+        case 3U:
+            arm_mat_mult_3x3_q31( pSrcA->pData, pSrcB->pData, pDst->pData );
+            break;
+
+        case 4U:
+            arm_mat_mult_4x4_q31( pSrcA->pData, pSrcB->pData, pDst->pData );
+            break;
+
+        case 6U:
+            arm_mat_mult_6x6_q31( pSrcA->pData, pSrcB->pData, pDst->pData );
+            break;
+
+        default:
+            return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of MatrixMult group
+ */
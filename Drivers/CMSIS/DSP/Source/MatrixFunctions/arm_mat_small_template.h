@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_small_template.h
+ * Description:  Unrolled kernel template for small square matrices
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Template for the fixed-size matrix kernels. It is included once per matrix
+ * size by arm_mat_mult_small_<type>.c and arm_mat_trans_small_<type>.c. Before
+ * each inclusion, the including file defines:
+ *
+ *   ARM_MAT_SMALL_N              matrix dimension: 2, 3, 4 or 6
+ *   ARM_MAT_SMALL_T              element type
+ *
+ * and either ARM_MAT_SMALL_MULT, the name of the multiplication function to
+ * define, together with
+ *
+ *   ARM_MAT_SMALL_ACC            accumulator type
+ *   ARM_MAT_SMALL_MAC(acc, a, b) accumulates the product a * b into acc
+ *   ARM_MAT_SMALL_OUT(acc)       converts acc to ARM_MAT_SMALL_T
+ *
+ * or ARM_MAT_SMALL_TRANS, the name of the transpose function to define.
+ *
+ * The products are accumulated from zero in increasing index order, as in the
+ * generic kernels, so the results are bit-exact with a plain triple loop.
+ * ARM_MAT_SMALL_N and the function name are undefined again at the end.
+ */
+
+/* Fully unrolled index sequences. Rows, columns and the inner dimension each
+ * have their own macro so that they can be nested. */
+#if ARM_MAT_SMALL_N == 2
+#define ARM_MAT_SMALL_FOR_R(OP)          OP(0) OP(1)
+#define ARM_MAT_SMALL_FOR_C(OP, r)       OP(r, 0) OP(r, 1)
+#define ARM_MAT_SMALL_FOR_K(OP, r, c)    OP(r, c, 0) OP(r, c, 1)
+#elif ARM_MAT_SMALL_N == 3
+#define ARM_MAT_SMALL_FOR_R(OP)          OP(0) OP(1) OP(2)
+#define ARM_MAT_SMALL_FOR_C(OP, r)       OP(r, 0) OP(r, 1) OP(r, 2)
+#define ARM_MAT_SMALL_FOR_K(OP, r, c)    OP(r, c, 0) OP(r, c, 1) OP(r, c, 2)
+#elif ARM_MAT_SMALL_N == 4
+#define ARM_MAT_SMALL_FOR_R(OP)          OP(0) OP(1) OP(2) OP(3)
+#define ARM_MAT_SMALL_FOR_C(OP, r)       OP(r, 0) OP(r, 1) OP(r, 2) OP(r, 3)
+#define ARM_MAT_SMALL_FOR_K(OP, r, c)    OP(r, c, 0) OP(r, c, 1) OP(r, c, 2) OP(r, c, 3)
+#elif ARM_MAT_SMALL_N == 6
+#define ARM_MAT_SMALL_FOR_R(OP)          OP(0) OP(1) OP(2) OP(3) OP(4) OP(5)
+#define ARM_MAT_SMALL_FOR_C(OP, r)       OP(r, 0) OP(r, 1) OP(r, 2) OP(r, 3) OP(r, 4) OP(r, 5)
+#define ARM_MAT_SMALL_FOR_K(OP, r, c)    OP(r, c, 0) OP(r, c, 1) OP(r, c, 2) OP(r, c, 3) OP(r, c, 4) OP(r, c, 5)
+#else
+#error "arm_mat_small_template.h: ARM_MAT_SMALL_N must be 2, 3, 4 or 6"
+#endif
+
+#ifdef ARM_MAT_SMALL_MULT
+
+/* rowA[k] = a(r,k) */
+#define ARM_MAT_SMALL_LOAD_A(r, c, k)                                       \
+    rowA[k] = pSrcA[( r ) * ARM_MAT_SMALL_N + ( k )];
+
+/* acc += a(r,k) * b(k,c) */
+#define ARM_MAT_SMALL_MAC_K(r, c, k)                                        \
+    ARM_MAT_SMALL_MAC( acc, rowA[k], pSrcB[( k ) * ARM_MAT_SMALL_N + ( c )] );
+
+/* c(r,c) = a(r,0) * b(0,c) + a(r,1) * b(1,c) + ... */
+#define ARM_MAT_SMALL_MULT_ELT(r, c)                                        \
+    acc = 0;                                                                \
+    ARM_MAT_SMALL_FOR_K( ARM_MAT_SMALL_MAC_K, r, c )                        \
+    pDst[( r ) * ARM_MAT_SMALL_N + ( c )] = ARM_MAT_SMALL_OUT( acc );
+
+/* Row r of A is loaded once and kept in registers for the whole output row */
+#define ARM_MAT_SMALL_MULT_ROW(r)                                           \
+    ARM_MAT_SMALL_FOR_K( ARM_MAT_SMALL_LOAD_A, r, 0 )                       \
+    ARM_MAT_SMALL_FOR_C( ARM_MAT_SMALL_MULT_ELT, r )
+
+void ARM_MAT_SMALL_MULT(
+    const ARM_MAT_SMALL_T * pSrcA,
+    const ARM_MAT_SMALL_T * pSrcB,
+    ARM_MAT_SMALL_T * pDst )
+{
+    ARM_MAT_SMALL_T rowA[ARM_MAT_SMALL_N];         /* current row of matrix A */
+    ARM_MAT_SMALL_ACC acc;                         /* Accumulator */
+
+    ARM_MAT_SMALL_FOR_R( ARM_MAT_SMALL_MULT_ROW )
+}
+
+#undef ARM_MAT_SMALL_LOAD_A
+#undef ARM_MAT_SMALL_MAC_K
+#undef ARM_MAT_SMALL_MULT_ELT
+#undef ARM_MAT_SMALL_MULT_ROW
+#undef ARM_MAT_SMALL_MULT
+
+#endif /* #ifdef ARM_MAT_SMALL_MULT */
+
+#ifdef ARM_MAT_SMALL_TRANS
+
+/* b(c,r) = a(r,c) */
+#define ARM_MAT_SMALL_TRANS_ELT(r, c)                                       \
+    pDst[( c ) * ARM_MAT_SMALL_N + ( r )] = pSrc[( r ) * ARM_MAT_SMALL_N + ( c )];
+
+#define ARM_MAT_SMALL_TRANS_ROW(r)                                          \
+    ARM_MAT_SMALL_FOR_C( ARM_MAT_SMALL_TRANS_ELT, r )
+
+void ARM_MAT_SMALL_TRANS(
+    const ARM_MAT_SMALL_T * pSrc,
+    ARM_MAT_SMALL_T * pDst )
+{
+    ARM_MAT_SMALL_FOR_R( ARM_MAT_SMALL_TRANS_ROW )
+}
+
+#undef ARM_MAT_SMALL_TRANS_ELT
+#undef ARM_MAT_SMALL_TRANS_ROW
+#undef ARM_MAT_SMALL_TRANS
+
+#endif /* #ifdef ARM_MAT_SMALL_TRANS */
+
+#undef ARM_MAT_SMALL_FOR_R
+#undef ARM_MAT_SMALL_FOR_C
+#undef ARM_MAT_SMALL_FOR_K
+#undef ARM_MAT_SMALL_N
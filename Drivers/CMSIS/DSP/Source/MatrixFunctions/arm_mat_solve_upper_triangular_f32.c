@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_f32.c
+ * Description:  Solve floating-point upper triangular system
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInv
+ * @{
+ */
+
+/**
+ * @brief Solve floating-point upper triangular system.
+ * @param[in]       *ut  points to the instance of the upper triangular floating-point matrix structure.
+ * @param[in]       *a   points to the instance of the right-hand side floating-point matrix structure.
+ * @param[out]      *dst points to the instance of the solution floating-point matrix structure.
+ * @return          The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if <code>ut</code> is not square or if the sizes of
+ * the matrices do not match.
+ * If a diagonal element of <code>ut</code> is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Solves <code>ut * X = a</code> by back substitution, from the last row to the first:
+ * <pre>
+ *     x[i][j] = (a[i][j] - (ut[i][i+1] * x[i+1][j] + ... + ut[i][n-1] * x[n-1][j])) / ut[i][i]
+ * </pre>
+ * Only the upper triangle of <code>ut</code> is read.
+ * Each column of <code>a</code> is an independent right-hand side, and <code>dst</code>
+ * may point to the same matrix as <code>a</code>.
+ * Solving with the factors of a decomposition is cheaper and more accurate than
+ * multiplying by an explicit inverse.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+    const arm_matrix_instance_f32 *ut,
+    const arm_matrix_instance_f32 *a,
+    arm_matrix_instance_f32 *dst )
+{
+    float32_t *pT = ut->pData;                     /* triangular matrix pointer */
+    float32_t *pA = a->pData;                      /* right-hand side matrix pointer */
+    float32_t *pX = dst->pData;                    /* solution matrix pointer */
+    float32_t acc;                                 /* accumulator */
+    uint32_t n = ut->numRows;                      /* size of the triangular matrix */
+    uint32_t numCols = a->numCols;                 /* number of right-hand sides */
+    uint32_t i, j, k;                              /* loop counters */
+    arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+    /* Check for matrix mismatch condition */
+    if( ( ut->numRows != ut->numCols ) || ( a->numRows != ut->numRows )
+            || ( dst->numRows != a->numRows ) || ( dst->numCols != a->numCols ) )
+    {
+        /* Set status as ARM_MATH_SIZE_MISMATCH */
+        status = ARM_MATH_SIZE_MISMATCH;
+    }
+    else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+
+        /* A zero on the diagonal makes the system singular */
+        for ( i = 0U; i < n; i++ )
+        {
+            if( pT[( i * n ) + i] == 0.0f )
+            {
+                status = ARM_MATH_SINGULAR;
+            }
+        }
+
+        for ( j = 0U; ( j < numCols ) && ( status == ARM_MATH_SUCCESS ); j++ )
+        {
+            for ( i = n; i > 0U; )
+            {
+                i--;
+
+                acc = pA[( i * numCols ) + j];
+
+                for ( k = i + 1U; k < n; k++ )
+                {
+                    acc -= pT[( i * n ) + k] * pX[( k * numCols ) + j];
+                }
+
+                pX[( i * numCols ) + j] = acc / pT[( i * n ) + i];
+            }
+        }
+    }
+
+    /* Return to application */
+    return ( status );
+}
+
+/**
+ * @} end of MatrixInv group
+ */
@@ -32,6 +32,10 @@
  * Tranposes a matrix.
  * Transposing an <code>M x N</code> matrix flips it around the center diagonal and results in an <code>N x M</code> matrix.
  * \image html MatrixTranspose.gif "Transpose of a 3 x 3 matrix"
+ *
+ * \par
+ * 2x2, 3x3, 4x4 and 6x6 floating-point and Q31 matrices are transposed by fully unrolled kernels,
+ * which can also be called directly on the matrix data, for example <code>arm_mat_trans_3x3_f32()</code>.
  */
 
 #include "arm_math.h"
@@ -84,6 +88,17 @@ arm_status arm_mat_trans_f32(
     else
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 matrices are handled by the unrolled kernels */
+    if( arm_mat_trans_small_f32( pSrc, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* Matrix transpose by exchanging the rows with columns */
         /* row loop     */
@@ -161,6 +176,17 @@ arm_status arm_mat_trans_f32(
     else
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 matrices are handled by the unrolled kernels */
+    if( arm_mat_trans_small_f32( pSrc, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* Matrix transpose by exchanging the rows with columns */
         /* row loop     */
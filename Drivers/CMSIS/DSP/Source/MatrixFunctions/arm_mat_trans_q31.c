@@ -75,6 +75,17 @@ arm_status arm_mat_trans_q31(
     else
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 matrices are handled by the unrolled kernels */
+    if( arm_mat_trans_small_q31( pSrc, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* Matrix transpose by exchanging the rows with columns */
         /* row loop     */
@@ -152,6 +163,17 @@ arm_status arm_mat_trans_q31(
     else
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
+#ifndef ARM_MATH_SMALL_MATRIX_DISABLE
+
+    /* 2x2, 3x3, 4x4 and 6x6 matrices are handled by the unrolled kernels */
+    if( arm_mat_trans_small_q31( pSrc, pDst ) == ARM_MATH_SUCCESS )
+    {
+        /* Set status as ARM_MATH_SUCCESS */
+        status = ARM_MATH_SUCCESS;
+    }
+    else
+#endif /*    #ifndef ARM_MATH_SMALL_MATRIX_DISABLE    */
+
     {
         /* Matrix transpose by exchanging the rows with columns */
         /* row loop     */
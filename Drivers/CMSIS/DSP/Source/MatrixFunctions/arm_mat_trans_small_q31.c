@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_small_q31.c
+ * Description:  Q31 small matrix transpose
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixTrans
+ * @{
+ */
+
+/*
+ * Fully unrolled transposes of 2x2, 3x3, 4x4 and 6x6 matrices, generated from
+ * arm_mat_small_template.h. They take the matrix data directly and do no size
+ * checking. The destination must not overlap the source.
+ */
+
+#define ARM_MAT_SMALL_T                q31_t
+
+#define ARM_MAT_SMALL_N                2
+#define ARM_MAT_SMALL_TRANS            arm_mat_trans_2x2_q31
+#include "arm_mat_small_template.h"
+
+#define ARM_MAT_SMALL_N                3
+#define ARM_MAT_SMALL_TRANS            arm_mat_trans_3x3_q31
+#include "arm_mat_small_template.h"
+
+#define ARM_MAT_SMALL_N                4
+#define ARM_MAT_SMALL_TRANS            arm_mat_trans_4x4_q31
+#include "arm_mat_small_template.h"
+
+#define ARM_MAT_SMALL_N                6
+#define ARM_MAT_SMALL_TRANS            arm_mat_trans_6x6_q31
+#include "arm_mat_small_template.h"
+
+/**
+ * @brief Q31 small matrix transpose dispatch.
+ * @param[in]  *pSrc points to the input matrix
+ * @param[out] *pDst points to the output matrix
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code> when both matrices are
+ * 2x2, 3x3, 4x4 or 6x6 and the transpose has been computed, and <code>ARM_MATH_ARGUMENT_ERROR</code>
+ * otherwise, in which case <code>pDst</code> is left untouched.
+ *
+ * \par
+ * Called by <code>arm_mat_trans_q31()</code> before its generic loops.
+ */
+
+arm_status arm_mat_trans_small_q31(
+    const arm_matrix_instance_q31 *pSrc,
+    arm_matrix_instance_q31 *pDst )
+{
+    uint16_t n = pSrc->numRows;                    /* matrix dimension */
+
+    if( ( pSrc->numCols != n ) || ( pDst->numRows != n ) || ( pDst->numCols != n ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    switch( n )
+    {
+        case 2U:
+            arm_mat_trans_2x2_q31( pSrc->pData, pDst->pData );
+            break;
+
+        case 3U:
+            arm_mat_trans_3x3_q31( pSrc->pData, pDst->pData );
+            break;
+
+        case 4U:
+            arm_mat_trans_4x4_q31( pSrc->pData, pDst->pData );
+            break;
+
+        case 6U:
+            arm_mat_trans_6x6_q31( pSrc->pData, pDst->pData );
+            break;
+
+        default:
+            return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of MatrixTrans group
+ */
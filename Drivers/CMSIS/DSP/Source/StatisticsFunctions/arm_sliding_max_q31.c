@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_max_q31.c
+ * Description:  Maximum of a Q31 stream over a sliding window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingMinMax
+ * @{
+ */
+
+/**
+ * @brief Maximum of a Q31 stream over a sliding window.
+ * @param[in,out] *S         points to an instance of the Q31 sliding window minimum/maximum structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Each output is the maximum of the last <code>windowSize</code> input samples, which is the
+ * value arm_max_q31() would return for those samples.
+ * Sample positions are compared with unsigned wrap-around, so streams longer than
+ * 2^32 samples are handled correctly.
+ */
+
+void arm_sliding_max_q31(
+    arm_sliding_minmax_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pValues = S->pValues;                   /* deque sample values */
+    uint32_t *pIndex = S->pIndex;                  /* deque sample positions */
+    uint32_t windowSize = S->windowSize;           /* window length */
+    uint32_t head = S->head;                       /* position of the front of the deque */
+    uint32_t length = S->length;                   /* number of entries in the deque */
+    uint32_t sampleIndex = S->sampleIndex;         /* position of the current sample in the stream */
+    uint32_t back;                                 /* position of the back of the deque */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    q31_t in;                                      /* input sample */
+
+    while( blkCnt > 0U )
+    {
+        /* Read the input sample */
+        in = *pSrc++;
+
+        /* Drop the front entry once it has left the window */
+        if( ( length > 0U ) && ( ( sampleIndex - pIndex[head] ) >= windowSize ) )
+        {
+            head++;
+
+            if( head == windowSize )
+            {
+                head = 0U;
+            }
+
+            length--;
+        }
+
+        /* Drop the entries at the back that are not larger than the new sample */
+        while( length > 0U )
+        {
+            back = head + length - 1U;
+
+            if( back >= windowSize )
+            {
+                back -= windowSize;
+            }
+
+            if( pValues[back] <= in )
+            {
+                length--;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        /* Append the new sample at the back of the deque */
+        back = head + length;
+
+        if( back >= windowSize )
+        {
+            back -= windowSize;
+        }
+
+        pValues[back] = in;
+        pIndex[back] = sampleIndex;
+        length++;
+
+        /* The front of the deque is the maximum of the window */
+        *pDst++ = pValues[head];
+
+        /* Update the stream position and decrement the loop counter */
+        sampleIndex++;
+        blkCnt--;
+    }
+
+    /* Save the deque state for the next call */
+    S->head = head;
+    S->length = length;
+    S->sampleIndex = sampleIndex;
+}
+
+/**
+ * @} end of SlidingMinMax group
+ */
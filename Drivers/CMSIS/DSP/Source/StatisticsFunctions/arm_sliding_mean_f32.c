@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_mean_f32.c
+ * Description:  Mean of a floating-point stream over a sliding window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup SlidingStats Sliding Window Statistics
+ *
+ * Computes the mean, variance or root mean square of the most recent
+ * <code>windowSize</code> samples of a stream, producing one output per input sample.
+ * The batch functions arm_mean_*, arm_var_* and arm_rms_* need O(windowSize) work for
+ * every new sample when they are used on a sliding window. These functions keep the
+ * window in a circular state buffer together with running sums, so each new sample
+ * costs O(1): the sample leaving the window is subtracted and the new sample is added.
+ *
+ * \par
+ * Until <code>windowSize</code> samples have been received, the statistic is computed
+ * over all samples received since the last reset. After that the window slides:
+ * output <code>n</code> is the statistic of the input samples <code>n-windowSize+1</code> to <code>n</code>.
+ *
+ * \par Instance Structure
+ * The window buffer, its length and the running sums are stored in an instance data structure.
+ * A separate instance is needed for each statistic and for each stream, because the
+ * running sums held in the instance depend on the statistic being computed.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the window buffer and the running sums.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * windowSize, pState. Zero out pState and set index, count, sum and sumOfSquares to zero.
+ * The reset functions clear the window without changing its length or buffer.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 and Q31 functions keep exact integer sums, using the same scaling as
+ * arm_mean_q15(), arm_var_q15(), arm_rms_q15() and their Q31 versions. Adding and later
+ * removing a sample leaves no rounding error, so every output is bit-exact with the
+ * corresponding batch function applied to the current window.
+ *
+ * \par Floating-Point Behavior
+ * The floating-point variance is tracked with a sliding form of Welford's update, which
+ * avoids the cancellation of the <code>sumOfSquares - sum * sum / n</code> form when the
+ * mean is large compared to the spread. To stop rounding errors from building up over
+ * long streams, the floating-point sums are recomputed from the window buffer each time
+ * the window has been completely replaced. This costs O(windowSize) once every
+ * <code>windowSize</code> samples, so the average cost per sample stays O(1).
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Mean of a floating-point stream over a sliding window.
+ * @param[in,out] *S         points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The running sum is recomputed from the window buffer each time the window has been
+ * completely replaced, so rounding errors do not build up over long streams.
+ */
+
+void arm_sliding_mean_f32(
+    arm_sliding_stats_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;                 /* window buffer pointer */
+    uint32_t windowSize = S->windowSize;           /* window length */
+    uint32_t index = S->index;                     /* position of the oldest sample in the window */
+    uint32_t count = S->count;                     /* number of samples in the window */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    float32_t sum = S->sum;                        /* running sum of the window */
+    float32_t in, out;                             /* input sample and sample leaving the window */
+    uint32_t i;                                    /* loop counter */
+
+    while( blkCnt > 0U )
+    {
+        /* Read the input sample */
+        in = *pSrc++;
+
+        /* Remove the oldest sample once the window is full, otherwise grow the window */
+        if( count == windowSize )
+        {
+            out = pState[index];
+            sum -= out;
+        }
+        else
+        {
+            count++;
+        }
+
+        /* Add the new sample to the window */
+        sum += in;
+        pState[index] = in;
+
+        /* Advance the window position circularly */
+        index++;
+
+        if( index == windowSize )
+        {
+            index = 0U;
+        }
+
+        /* Recompute the sum from the window buffer once all of it has been replaced */
+        if( ( index == 0U ) && ( count == windowSize ) )
+        {
+            sum = 0.0f;
+
+            for ( i = 0U; i < windowSize; i++ )
+            {
+                sum += pState[i];
+            }
+        }
+
+        /* C = (A[n-windowSize+1] + ... + A[n]) / count */
+        *pDst++ = sum / ( float32_t ) count;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the window position and running sums for the next call */
+    S->index = index;
+    S->count = count;
+    S->sum = sum;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_mean_q31.c
+ * Description:  Mean of a Q31 stream over a sliding window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Mean of a Q31 stream over a sliding window.
+ * @param[in,out] *S         points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The running sum is kept in a 64-bit accumulator exactly as in arm_mean_q31().
+ * Each output is bit-exact with arm_mean_q31() applied to the samples in the window.
+ */
+
+void arm_sliding_mean_q31(
+    arm_sliding_stats_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;                     /* window buffer pointer */
+    uint32_t windowSize = S->windowSize;           /* window length */
+    uint32_t index = S->index;                     /* position of the oldest sample in the window */
+    uint32_t count = S->count;                     /* number of samples in the window */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    q63_t sum = S->sum;                            /* running sum of the window */
+    q31_t in, out;                                 /* input sample and sample leaving the window */
+
+    while( blkCnt > 0U )
+    {
+        /* Read the input sample */
+        in = *pSrc++;
+
+        /* Remove the oldest sample once the window is full, otherwise grow the window */
+        if( count == windowSize )
+        {
+            out = pState[index];
+            sum -= out;
+        }
+        else
+        {
+            count++;
+        }
+
+        /* Add the new sample to the window */
+        sum += in;
+        pState[index] = in;
+
+        /* Advance the window position circularly */
+        index++;
+
+        if( index == windowSize )
+        {
+            index = 0U;
+        }
+
+        /* C = (A[n-windowSize+1] + ... + A[n]) / count */
+        *pDst++ = ( q31_t )( sum / ( int32_t ) count );
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the window position and running sums for the next call */
+    S->index = index;
+    S->count = count;
+    S->sum = sum;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_minmax_init_q31.c
+ * Description:  Q31 sliding window minimum and maximum initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingMinMax
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding window minimum and maximum.
+ * @param[in,out] *S           points to an instance of the Q31 sliding window minimum/maximum structure.
+ * @param[in]     windowSize   number of samples in the sliding window.
+ * @param[in]     *pValues     points to the deque value buffer of length <code>windowSize</code>.
+ * @param[in]     *pIndex      points to the deque position buffer of length <code>windowSize</code>.
+ * @return        none
+ */
+
+void arm_sliding_minmax_init_q31(
+    arm_sliding_minmax_instance_q31 *S,
+    uint32_t windowSize,
+    q31_t *pValues,
+    uint32_t *pIndex )
+{
+    /* Assign the window length */
+    S->windowSize = windowSize;
+
+    /* Assign the deque buffer pointers */
+    S->pValues = pValues;
+    S->pIndex = pIndex;
+
+    /* Empty the deque */
+    arm_sliding_minmax_reset_q31( S );
+}
+
+/**
+ * @} end of SlidingMinMax group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_minmax_reset_q15.c
+ * Description:  Q15 sliding window minimum and maximum reset function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingMinMax
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the Q15 sliding window minimum and maximum.
+ * @param[in,out] *S points to an instance of the Q15 sliding window minimum/maximum structure.
+ * @return none.
+ * \par Description:
+ * The function empties the deque and restarts the sample count.
+ * The window length and buffer pointers are unchanged.
+ */
+
+void arm_sliding_minmax_reset_q15(
+    arm_sliding_minmax_instance_q15 *S )
+{
+    /* Empty the deque */
+    S->head = 0U;
+    S->length = 0U;
+
+    /* Restart the sample count */
+    S->sampleIndex = 0U;
+}
+
+/**
+ * @} end of SlidingMinMax group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_rms_f32.c
+ * Description:  Root Mean Square of a floating-point stream over a sliding window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Root Mean Square of a floating-point stream over a sliding window.
+ * @param[in,out] *S         points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The running sum of squares is recomputed from the window buffer each time the window
+ * has been completely replaced, so rounding errors do not build up over long streams.
+ */
+
+void arm_sliding_rms_f32(
+    arm_sliding_stats_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;                 /* window buffer pointer */
+    uint32_t windowSize = S->windowSize;           /* window length */
+    uint32_t index = S->index;                     /* position of the oldest sample in the window */
+    uint32_t count = S->count;                     /* number of samples in the window */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    float32_t sumOfSquares = S->sumOfSquares;      /* running sum of squares of the window */
+    float32_t in, out;                             /* input sample and sample leaving the window */
+    uint32_t i;                                    /* loop counter */
+
+    while( blkCnt > 0U )
+    {
+        /* Read the input sample */
+        in = *pSrc++;
+
+        /* Remove the oldest sample once the window is full, otherwise grow the window */
+        if( count == windowSize )
+        {
+            out = pState[index];
+            sumOfSquares -= out * out;
+        }
+        else
+        {
+            count++;
+        }
+
+        /* Add the new sample to the window */
+        sumOfSquares += in * in;
+        pState[index] = in;
+
+        /* Advance the window position circularly */
+        index++;
+
+        if( index == windowSize )
+        {
+            index = 0U;
+        }
+
+        /* Recompute the sum of squares from the window buffer once all of it has been replaced */
+        if( ( index == 0U ) && ( count == windowSize ) )
+        {
+            sumOfSquares = 0.0f;
+
+            for ( i = 0U; i < windowSize; i++ )
+            {
+                sumOfSquares += pState[i] * pState[i];
+            }
+        }
+
+        /* C = sqrt((A[n-windowSize+1]^2 + ... + A[n]^2) / count) */
+        arm_sqrt_f32( sumOfSquares / ( float32_t ) count, pDst++ );
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the window position and running sums for the next call */
+    S->index = index;
+    S->count = count;
+    S->sumOfSquares = sumOfSquares;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
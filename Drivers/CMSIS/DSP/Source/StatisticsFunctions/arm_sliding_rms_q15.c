@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_rms_q15.c
+ * Description:  Root Mean Square of a Q15 stream over a sliding window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Root Mean Square of a Q15 stream over a sliding window.
+ * @param[in,out] *S         points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The running sum of squares is kept in a 64-bit accumulator in 34.30 format exactly as in
+ * arm_rms_q15(), so there is no risk of overflow.
+ * Each output is bit-exact with arm_rms_q15() applied to the samples in the window.
+ */
+
+void arm_sliding_rms_q15(
+    arm_sliding_stats_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState;                     /* window buffer pointer */
+    uint32_t windowSize = S->windowSize;           /* window length */
+    uint32_t index = S->index;                     /* position of the oldest sample in the window */
+    uint32_t count = S->count;                     /* number of samples in the window */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    q63_t sumOfSquares = S->sumOfSquares;          /* running sum of squares of the window */
+    q15_t in, out;                                 /* input sample and sample leaving the window */
+
+    while( blkCnt > 0U )
+    {
+        /* Read the input sample */
+        in = *pSrc++;
+
+        /* Remove the oldest sample once the window is full, otherwise grow the window */
+        if( count == windowSize )
+        {
+            out = pState[index];
+            sumOfSquares -= ( q31_t ) out * out;
+        }
+        else
+        {
+            count++;
+        }
+
+        /* Add the new sample to the window */
+        sumOfSquares += ( q31_t ) in * in;
+        pState[index] = in;
+
+        /* Advance the window position circularly */
+        index++;
+
+        if( index == windowSize )
+        {
+            index = 0U;
+        }
+
+        /* C = sqrt((A[n-windowSize+1]^2 + ... + A[n]^2) / count) */
+        arm_sqrt_q15( __SSAT( ( sumOfSquares / ( q63_t ) count ) >> 15, 16 ), pDst++ );
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the window position and running sums for the next call */
+    S->index = index;
+    S->count = count;
+    S->sumOfSquares = sumOfSquares;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
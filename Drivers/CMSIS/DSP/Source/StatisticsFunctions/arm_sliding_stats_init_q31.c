@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_init_q31.c
+ * Description:  Q31 sliding window statistics initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding window statistics.
+ * @param[in,out] *S           points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     windowSize   number of samples in the sliding window.
+ * @param[in]     *pState      points to the window buffer.
+ * @return        none
+ *
+ * \par Description:
+ * <code>pState</code> points to an array of length <code>windowSize</code>.
+ * The window buffer and the running sums are cleared.
+ * The same instance must only be used with one of arm_sliding_mean_q31(),
+ * arm_sliding_var_q31() or arm_sliding_rms_q31().
+ */
+
+void arm_sliding_stats_init_q31(
+    arm_sliding_stats_instance_q31 *S,
+    uint32_t windowSize,
+    q31_t *pState )
+{
+    /* Assign the window length */
+    S->windowSize = windowSize;
+
+    /* Assign the window buffer pointer */
+    S->pState = pState;
+
+    /* Clear the window buffer and the running sums */
+    arm_sliding_stats_reset_q31( S );
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_reset_f32.c
+ * Description:  Floating-point sliding window statistics reset function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the floating-point sliding window statistics.
+ * @param[in,out] *S points to an instance of the floating-point sliding window statistics structure.
+ * @return none.
+ * \par Description:
+ * The function empties the window and clears the running sums.
+ * The window length and buffer pointer are unchanged.
+ */
+
+void arm_sliding_stats_reset_f32(
+    arm_sliding_stats_instance_f32 *S )
+{
+    /* Clear the window buffer */
+    memset( S->pState, 0, S->windowSize * sizeof( float32_t ) );
+
+    /* Empty the window */
+    S->index = 0U;
+    S->count = 0U;
+
+    /* Clear the running sums */
+    S->sum = 0.0f;
+    S->sumOfSquares = 0.0f;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_var_f32.c
+ * Description:  Variance of a floating-point stream over a sliding window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Variance of a floating-point stream over a sliding window.
+ * @param[in,out] *S         points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The variance is normalized by <code>count - 1</code> like arm_var_f32(), and is zero
+ * while the window holds a single sample.
+ * <code>S->sum</code> holds the running sum and <code>S->sumOfSquares</code> holds the
+ * running sum of squared deviations from the mean, which is updated with a sliding form
+ * of Welford's algorithm:
+ * <pre>
+ *     window growing:  M2 += (x - oldMean) * (x - newMean)
+ *     window full:     M2 += (x - xOld) * (x - newMean + xOld - oldMean)
+ * </pre>
+ * Both are recomputed with the two-pass method of arm_var_f32() each time the window has
+ * been completely replaced, so rounding errors do not build up over long streams.
+ */
+
+void arm_sliding_var_f32(
+    arm_sliding_stats_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize )
+{
+    float32_t *pState = S->pState;                 /* window buffer pointer */
+    uint32_t windowSize = S->windowSize;           /* window length */
+    uint32_t index = S->index;                     /* position of the oldest sample in the window */
+    uint32_t count = S->count;                     /* number of samples in the window */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    float32_t sum = S->sum;                        /* running sum of the window */
+    float32_t m2 = S->sumOfSquares;                /* running sum of squared deviations */
+    float32_t oldMean, newMean;                    /* mean before and after the update */
+    float32_t in, out;                             /* input sample and sample leaving the window */
+    uint32_t i;                                    /* loop counter */
+
+    while( blkCnt > 0U )
+    {
+        /* Read the input sample */
+        in = *pSrc++;
+
+        /* Mean of the window before this sample */
+        oldMean = ( count > 0U ) ? ( sum / ( float32_t ) count ) : 0.0f;
+
+        if( count == windowSize )
+        {
+            /* Replace the oldest sample, the window length is unchanged */
+            out = pState[index];
+            sum += in - out;
+            newMean = sum / ( float32_t ) count;
+            m2 += ( in - out ) * ( ( in - newMean ) + ( out - oldMean ) );
+        }
+        else
+        {
+            /* Grow the window by one sample */
+            count++;
+            sum += in;
+            newMean = sum / ( float32_t ) count;
+            m2 += ( in - oldMean ) * ( in - newMean );
+        }
+
+        pState[index] = in;
+
+        /* Advance the window position circularly */
+        index++;
+
+        if( index == windowSize )
+        {
+            index = 0U;
+        }
+
+        /* Recompute the sums from the window buffer once all of it has been replaced */
+        if( ( index == 0U ) && ( count == windowSize ) )
+        {
+            sum = 0.0f;
+
+            for ( i = 0U; i < windowSize; i++ )
+            {
+                sum += pState[i];
+            }
+
+            newMean = sum / ( float32_t ) windowSize;
+            m2 = 0.0f;
+
+            for ( i = 0U; i < windowSize; i++ )
+            {
+                m2 += ( pState[i] - newMean ) * ( pState[i] - newMean );
+            }
+        }
+
+        /* Rounding can leave a tiny negative value when all samples are equal */
+        if( m2 < 0.0f )
+        {
+            m2 = 0.0f;
+        }
+
+        /* C = sum((A[i] - mean)^2) / (count - 1) */
+        *pDst++ = ( count > 1U ) ? ( m2 / ( float32_t )( count - 1U ) ) : 0.0f;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the window position and running sums for the next call */
+    S->index = index;
+    S->count = count;
+    S->sum = sum;
+    S->sumOfSquares = m2;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,273 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_q7.c
+ * Description:  Radix-2 block floating-point Q7 CFFT processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Keeps v in the running maximum and minimum of the values written by a stage */
+#define CFFT_Q7_TRACK(v)          \
+    do                            \
+    {                             \
+        if( ( v ) > maxVal )      \
+        {                         \
+            maxVal = ( v );       \
+        }                         \
+        if( ( v ) < minVal )      \
+        {                         \
+            minVal = ( v );       \
+        }                         \
+    } while( 0 )
+
+/**
+ * @brief  Right shift that keeps a radix-2 stage from overflowing.
+ * @param[in]  maxVal   largest magnitude of a real or imaginary part.
+ * @return     shift of 0, 1 or 2.
+ *
+ * A radix-2 butterfly grows a real or imaginary part by at most 2*sqrt(2),
+ * which leaves room for the rounding of the outputs.
+ */
+
+static uint32_t arm_cfft_q7_stage_shift(
+    q31_t maxVal )
+{
+    if( maxVal <= 44 )
+    {
+        return 0U;
+    }
+    else if( maxVal <= 89 )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 2U;
+    }
+}
+
+/**
+ * @brief  In-place bit reversal of a Q7 complex buffer.
+ * @param[in, out] pSrc    points to the complex data buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @return none.
+ *
+ * The indices are reversed on the fly, so no bit reversal table is needed.
+ */
+
+static void arm_bitreversal_q7(
+    q7_t *pSrc,
+    uint32_t fftLen )
+{
+    uint32_t i, j, k;
+    q7_t in;
+
+    j = 0U;
+
+    for( i = 0U; i < fftLen - 1U; i++ )
+    {
+        if( i < j )
+        {
+            in = pSrc[2U * i];
+            pSrc[2U * i] = pSrc[2U * j];
+            pSrc[2U * j] = in;
+
+            in = pSrc[( 2U * i ) + 1U];
+            pSrc[( 2U * i ) + 1U] = pSrc[( 2U * j ) + 1U];
+            pSrc[( 2U * j ) + 1U] = in;
+        }
+
+        /* Increment the reversed index */
+        k = fftLen >> 1U;
+
+        while( k <= j )
+        {
+            j -= k;
+            k >>= 1U;
+        }
+
+        j += k;
+    }
+}
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @details
+* @brief       Processing function for the Q7 block floating-point complex FFT.
+* @param[in]      *S    points to an instance of the Q7 CFFT structure.
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @param[out]    *pBlockExp     points to the block exponent of the output.
+* @return none.
+*
+* \par Block floating-point scaling:
+* The transform is computed with radix-2 decimation in frequency stages. Before every
+* stage the largest magnitude of the data is compared with the growth a stage can cause,
+* and the stage shifts its outputs right by 0, 1 or 2 bits accordingly. The shifts are
+* added up in <code>*pBlockExp</code>, so that
+* <pre>
+*     p1[n] * 2^(*pBlockExp)
+* </pre>
+* is the unnormalized DFT of the input, in the units of the input. The inverse transform
+* is unnormalized as well, i.e. it is <code>fftLen</code> times the inverse DFT. Small
+* inputs are not downscaled at all, which keeps most of the 8 bits for the result.
+* \par
+* The data are kept in 1.7 format between the stages and the twiddle factors are the Q15
+* tables of the Q15 CFFT, so there is no overflow and no saturation.
+* \par
+* Supported FFT lengths are 16, 32, 64, 128, 256, 512, 1024, 2048 and 4096. The constant
+* instances <code>arm_cfft_sR_q7_len16</code> ... <code>arm_cfft_sR_q7_len4096</code> are
+* declared in arm_const_structs.h.
+*/
+
+void arm_cfft_q7(
+    const arm_cfft_instance_q7 *S,
+    q7_t *p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int8_t *pBlockExp )
+{
+    uint32_t fftLen = S->fftLen;                   /* Length of the FFT */
+    const q15_t *pCoef = S->pTwiddle;              /* Twiddle factor table */
+    uint32_t n1, n2, i, j, l;                      /* Loop counters and indices */
+    uint32_t twidStep, shift;                      /* Twiddle step and stage shift */
+    q31_t rnd, rndTw;                              /* Rounding constants of the stage */
+    q31_t xa, ya, xb, yb, xt, yt;                  /* Butterfly inputs and differences */
+    q31_t out1, out2;                              /* Butterfly outputs */
+    q31_t cosVal, sinVal;                          /* Twiddle factor */
+    q31_t maxVal = 0, minVal = 0;                  /* Range of the stage input */
+    int32_t blockExp = 0;                          /* Sum of the stage shifts */
+
+    /* Range of the input */
+    for( i = 0U; i < 2U * fftLen; i++ )
+    {
+        xa = p1[i];
+        CFFT_Q7_TRACK( xa );
+    }
+
+    twidStep = 1U;
+
+    for( n1 = fftLen; n1 > 1U; n1 >>= 1U )
+    {
+        n2 = n1 >> 1U;
+
+        shift = arm_cfft_q7_stage_shift( ( -minVal > maxVal ) ? -minVal : maxVal );
+        blockExp += ( int32_t ) shift;
+
+        /* Round to nearest, so that the stages do not add up a truncation bias */
+        rnd = ( q31_t )( ( 1U << shift ) >> 1U );
+        rndTw = ( q31_t )( 1U << ( 14U + shift ) );
+
+        maxVal = 0;
+        minVal = 0;
+
+        /* The first butterfly of every group has a unit twiddle factor */
+        for( i = 0U; i < fftLen; i += n1 )
+        {
+            l = i + n2;
+
+            xa = p1[2U * i];
+            ya = p1[( 2U * i ) + 1U];
+            xb = p1[2U * l];
+            yb = p1[( 2U * l ) + 1U];
+
+            out1 = ( xa + xb + rnd ) >> shift;
+            out2 = ( ya + yb + rnd ) >> shift;
+            p1[2U * i] = ( q7_t ) out1;
+            p1[( 2U * i ) + 1U] = ( q7_t ) out2;
+            CFFT_Q7_TRACK( out1 );
+            CFFT_Q7_TRACK( out2 );
+
+            out1 = ( xa - xb + rnd ) >> shift;
+            out2 = ( ya - yb + rnd ) >> shift;
+            p1[2U * l] = ( q7_t ) out1;
+            p1[( 2U * l ) + 1U] = ( q7_t ) out2;
+            CFFT_Q7_TRACK( out1 );
+            CFFT_Q7_TRACK( out2 );
+        }
+
+        for( j = 1U; j < n2; j++ )
+        {
+            cosVal = pCoef[2U * j * twidStep];
+            sinVal = pCoef[( 2U * j * twidStep ) + 1U];
+
+            /* The inverse transform uses the conjugate twiddle factors */
+            if( ifftFlag == 1U )
+            {
+                sinVal = -sinVal;
+            }
+
+            for( i = j; i < fftLen; i += n1 )
+            {
+                l = i + n2;
+
+                xa = p1[2U * i];
+                ya = p1[( 2U * i ) + 1U];
+                xb = p1[2U * l];
+                yb = p1[( 2U * l ) + 1U];
+
+                out1 = ( xa + xb + rnd ) >> shift;
+                out2 = ( ya + yb + rnd ) >> shift;
+                p1[2U * i] = ( q7_t ) out1;
+                p1[( 2U * i ) + 1U] = ( q7_t ) out2;
+                CFFT_Q7_TRACK( out1 );
+                CFFT_Q7_TRACK( out2 );
+
+                xt = xa - xb;
+                yt = ya - yb;
+
+                /* (xt + j yt) * (cos - j sin) in 2.22 format, shifted down to 1.7 */
+                out1 = ( ( xt * cosVal ) + ( yt * sinVal ) + rndTw ) >> ( 15U + shift );
+                out2 = ( ( yt * cosVal ) - ( xt * sinVal ) + rndTw ) >> ( 15U + shift );
+                p1[2U * l] = ( q7_t ) out1;
+                p1[( 2U * l ) + 1U] = ( q7_t ) out2;
+                CFFT_Q7_TRACK( out1 );
+                CFFT_Q7_TRACK( out2 );
+            }
+        }
+
+        twidStep <<= 1U;
+    }
+
+    if( bitReverseFlag )
+    {
+        arm_bitreversal_q7( p1, fftLen );
+    }
+
+    *pBlockExp = ( int8_t ) blockExp;
+}
+
+/**
+* @} end of ComplexFFT group
+*/
@@ -72,8 +72,11 @@ arm_status arm_cfft_radix2_init_f32(
     /*  Initialise the FFT length */
     S->fftLen = fftLen;
 
+#if defined(ARM_ALL_FFT_TABLES) || \
+    (defined(ARM_TABLE_TWIDDLECOEF_F32_4096) && defined(ARM_TABLE_BITREV_1024))
     /*  Initialise the Twiddle coefficient pointer */
     S->pTwiddle = ( float32_t * ) twiddleCoef;
+#endif
 
     /*  Initialise the Flag for selection of CFFT or CIFFT */
     S->ifftFlag = ifftFlag;
@@ -82,6 +85,8 @@ arm_status arm_cfft_radix2_init_f32(
     S->bitReverseFlag = bitReverseFlag;
 
     /*  Initializations of structure parameters depending on the FFT length */
+#if defined(ARM_ALL_FFT_TABLES) || \
+    (defined(ARM_TABLE_TWIDDLECOEF_F32_4096) && defined(ARM_TABLE_BITREV_1024))
     switch( S->fftLen )
     {
 
@@ -183,6 +188,10 @@ arm_status arm_cfft_radix2_init_f32(
         status = ARM_MATH_ARGUMENT_ERROR;
         break;
     }
+#else
+    /*  Reporting argument error if the tables are not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+#endif
 
     return ( status );
 }
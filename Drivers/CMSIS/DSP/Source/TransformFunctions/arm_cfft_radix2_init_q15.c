@@ -73,14 +73,19 @@ arm_status arm_cfft_radix2_init_q15(
     /*  Initialise the FFT length */
     S->fftLen = fftLen;
 
+#if defined(ARM_ALL_FFT_TABLES) || \
+    (defined(ARM_TABLE_TWIDDLECOEF_Q15_4096) && defined(ARM_TABLE_BITREV_1024))
     /*  Initialise the Twiddle coefficient pointer */
     S->pTwiddle = ( q15_t * ) twiddleCoef_4096_q15;
+#endif
     /*  Initialise the Flag for selection of CFFT or CIFFT */
     S->ifftFlag = ifftFlag;
     /*  Initialise the Flag for calculation Bit reversal or not */
     S->bitReverseFlag = bitReverseFlag;
 
     /*  Initializations of structure parameters depending on the FFT length */
+#if defined(ARM_ALL_FFT_TABLES) || \
+    (defined(ARM_TABLE_TWIDDLECOEF_Q15_4096) && defined(ARM_TABLE_BITREV_1024))
     switch( S->fftLen )
     {
     case 4096U:
@@ -168,6 +173,10 @@ arm_status arm_cfft_radix2_init_q15(
         status = ARM_MATH_ARGUMENT_ERROR;
         break;
     }
+#else
+    /*  Reporting argument error if the tables are not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+#endif
 
     return ( status );
 }
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_coeffs_q31.c
+ * Description:  Q31 Goertzel coefficient computation
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Q31 Goertzel coefficient computation.
+ * @param[in]  *pFreqs   points to the normalised frequencies <code>f / fs</code> in the range [0 0.5), in 1.31 format.
+ * @param[in]  numBins   number of frequency bins.
+ * @param[out] *pCoeffs  points to the coefficient array of size <code>2*numBins</code>.
+ * @return     none.
+ *
+ * \par
+ * Computes <code>cos(w)</code> and <code>sin(w)</code> of every bin, with <code>w = 2 * pi * f</code>,
+ * using <code>arm_sin_cos_q31()</code>. For the DFT bin k of a block of N samples, <code>f = k / N</code>.
+ */
+
+void arm_goertzel_coeffs_q31(
+    const q31_t *pFreqs,
+    uint16_t numBins,
+    q31_t *pCoeffs )
+{
+    q31_t sinVal, cosVal;                          /* sine and cosine of the bin */
+    uint16_t bin = numBins;                        /* bin counter */
+
+    while( bin > 0U )
+    {
+        /* arm_sin_cos_q31() maps [-1 1) to [-180 180) degrees, so w = 2 * pi * f is 2 * f */
+        arm_sin_cos_q31( *pFreqs++ << 1, &sinVal, &cosVal );
+
+        *pCoeffs++ = cosVal;
+        *pCoeffs++ = sinVal;
+
+        /* Decrement the loop counter */
+        bin--;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filter bank, block mode
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank
+ *
+ * Computes a few bins of the discrete Fourier transform of a real signal, for
+ * applications such as DTMF decoding or harmonic monitoring that need only a
+ * handful of frequencies and would otherwise throw away most of an FFT.
+ * Each bin costs one multiplication and two additions per input sample, so the
+ * Goertzel filter bank is cheaper than a full real FFT as long as the number of
+ * bins is small compared to log2(N).
+ *
+ * \par Algorithm
+ * Every bin is a second-order resonator at its normalised frequency
+ * <code>f = k / N</code>, with <code>w = 2 * pi * f</code>:
+ * <pre>
+ *     s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]
+ * </pre>
+ * After the N samples <code>x[0]</code> to <code>x[N-1]</code> have been processed,
+ * starting from zero states, the DFT bin is
+ * <pre>
+ *     X(k) = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1]
+ * </pre>
+ * which is the value <code>arm_rfft_fast_f32()</code> returns for bin k.
+ * The frequencies do not have to be integer bins; DTMF tones, for example, can
+ * be placed on their exact frequencies.
+ *
+ * \par Block Mode
+ * <code>arm_goertzel_init_f32()</code> sets the filter bank up for blocks of N samples.
+ * The samples can be passed to <code>arm_goertzel_f32()</code> in one or several calls.
+ * <code>arm_goertzel_cmplx_f32()</code> and <code>arm_goertzel_power_f32()</code> then
+ * return the bins, and <code>arm_goertzel_reset_f32()</code> starts the next block.
+ * Every bin is updated over the whole input block in turn, so the states of a bin
+ * stay in registers and the input is only read from memory.
+ *
+ * \par Sliding Mode
+ * <code>arm_goertzel_sliding_init_f32()</code> sets the filter bank up as a sliding DFT
+ * over the last <code>windowLen</code> samples.
+ * <code>arm_goertzel_sliding_f32()</code> keeps these samples in a delay line and
+ * removes the oldest one from the resonators with a comb filter:
+ * <pre>
+ *     d[n] = x[n] - r^N * x[n-N]
+ *     s[n] = d[n] + 2 * r * cos(w) * s[n-1] - r^2 * s[n-2]
+ * </pre>
+ * The result can be read at any time and is the DFT of the last N samples, each
+ * weighted by <code>r^age</code>. The damping factor <code>r</code> slightly below 1, for
+ * example 0.9999, moves the poles inside the unit circle so that rounding errors die out
+ * instead of accumulating. The comb only cancels the resonators exactly for integer bins
+ * <code>k / N</code>.
+ *
+ * \par Coefficients
+ * <code>pCoeffs</code> holds <code>cos(w)</code> and <code>sin(w)</code> of every bin, in this order:
+ * <pre>
+ *     {cos(w0), sin(w0), cos(w1), sin(w1), ...}
+ * </pre>
+ * and can be computed with <code>arm_goertzel_coeffs_f32()</code> from the normalised
+ * frequencies. The state array holds <code>2*numBins</code> values and the delay line of
+ * the sliding mode <code>windowLen</code> samples.
+ *
+ * \par Fixed-Point Behavior
+ * The resonators of the Q31 and Q15 versions run on 32-bit states with a 64-bit
+ * intermediate product. A tone at the bin frequency grows the states to about
+ * <code>N / (2 * sin(w))</code> times its amplitude, so the input is shifted right
+ * by <code>inputShift</code> bits before it enters the resonators. Choose
+ * <code>inputShift</code> so that <code>N / (2 * sin(w)) < 2^inputShift</code> for the
+ * lowest (or highest) bin and the expected signal, or the states wrap around.
+ * The complex results are returned scaled down by <code>2^inputShift</code>.
+ * The Q15 coefficients limit the centre frequency accuracy to about
+ * <code>2^-15 / sin(w)</code> radians; use the Q31 version for bins close to DC or
+ * to half the sampling rate.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Floating-point Goertzel filter bank, block mode.
+ * @param[in]  *S         points to an instance of the Floating-point Goertzel structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[in]  blockSize  number of samples to process.
+ * @return     none.
+ *
+ * \par
+ * Runs every bin of the filter bank over the input block. Blocks of any size can be passed in
+ * several calls; the states carry over from one call to the next until
+ * <code>arm_goertzel_reset_f32()</code> is called.
+ */
+
+void arm_goertzel_f32(
+    const arm_goertzel_instance_f32 *S,
+    const float32_t *pSrc,
+    uint32_t blockSize )
+{
+    const float32_t *pCoeffs = S->pCoeffs;               /* coefficient pointer */
+    float32_t *pState = S->pState;                      /* state pointer */
+    const float32_t *px;                          /* input pointer */
+    float32_t coeff;                               /* 2 * cos(w) of the current bin */
+    float32_t s0, s1, s2;                          /* resonator states s[n], s[n-1] and s[n-2] */
+    uint32_t blkCnt;                               /* loop counter */
+    uint16_t bin = S->numBins;                     /* bin counter */
+
+    /* Each bin runs over the whole block in turn, so that its states stay in registers */
+    while( bin > 0U )
+    {
+        coeff = 2.0f * pCoeffs[0];
+        s1 = pState[0];
+        s2 = pState[1];
+        px = pSrc;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling. s1 and s2 swap roles on every sample, so no moves are needed */
+        blkCnt = blockSize >> 2U;
+
+        while( blkCnt > 0U )
+        {
+            /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+            s2 = *px++ + coeff * s1 - s2;
+            s1 = *px++ + coeff * s2 - s1;
+            s2 = *px++ + coeff * s1 - s2;
+            s1 = *px++ + coeff * s2 - s1;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+         ** No loop unrolling is used. */
+        blkCnt = blockSize % 0x4U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while( blkCnt > 0U )
+        {
+            /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+            s0 = *px++ + coeff * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        /* Store the states of the bin */
+        pState[0] = s1;
+        pState[1] = s2;
+
+        /* Advance to the next bin */
+        pState += 2U;
+        pCoeffs += 2U;
+        bin--;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Floating-point Goertzel filter bank initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Floating-point Goertzel filter bank initialization function for the block mode.
+ * @param[in,out] *S       points to an instance of the Floating-point Goertzel structure.
+ * @param[in]  numBins    number of frequency bins.
+ * @param[in]  *pCoeffs   points to the coefficient array of size <code>2*numBins</code>.
+ * @param[in]  *pState    points to the state array of size <code>2*numBins</code>.
+ * @return     none.
+ *
+ * \par
+ * Clears the states. The samples of a block are then passed to <code>arm_goertzel_f32()</code>.
+ */
+
+void arm_goertzel_init_f32(
+    arm_goertzel_instance_f32 *S,
+    uint16_t numBins,
+    const float32_t *pCoeffs,
+    float32_t *pState )
+{
+    /* Assign bin number, coefficient and state pointers */
+    S->numBins = numBins;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    /* Block mode: no delay line and no damping */
+    S->windowLen = 0U;
+    S->pDelay = NULL;
+    S->damping = 1.0f;
+    S->dampingSq = 1.0f;
+    S->dampingPowN = 1.0f;
+
+    /* Clear the states and the delay line */
+    arm_goertzel_reset_f32( S );
+}
+
+/**
+ * @} end of Goertzel group
+ */
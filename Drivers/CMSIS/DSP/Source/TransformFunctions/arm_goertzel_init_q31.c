@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Q31 Goertzel filter bank initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Q31 Goertzel filter bank initialization function for the block mode.
+ * @param[in,out] *S       points to an instance of the Q31 Goertzel structure.
+ * @param[in]  numBins    number of frequency bins.
+ * @param[in]  *pCoeffs   points to the coefficient array of size <code>2*numBins</code>.
+ * @param[in]  *pState    points to the state array of size <code>2*numBins</code>.
+ * @param[in]  inputShift number of bits the input is shifted right by before it enters the resonators.
+ * @return     none.
+ *
+ * \par
+ * Clears the states. The samples of a block are then passed to <code>arm_goertzel_q31()</code>.
+ */
+
+void arm_goertzel_init_q31(
+    arm_goertzel_instance_q31 *S,
+    uint16_t numBins,
+    const q31_t *pCoeffs,
+    q31_t *pState,
+    uint8_t inputShift )
+{
+    /* Assign bin number, coefficient and state pointers */
+    S->numBins = numBins;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->inputShift = inputShift;
+
+    /* Block mode: no delay line and no damping */
+    S->windowLen = 0U;
+    S->pDelay = NULL;
+    S->damping = 0x7FFFFFFF;
+    S->dampingSq = 0x7FFFFFFF;
+    S->dampingPowN = 0x7FFFFFFF;
+
+    /* Clear the states and the delay line */
+    arm_goertzel_reset_q31( S );
+}
+
+/**
+ * @} end of Goertzel group
+ */
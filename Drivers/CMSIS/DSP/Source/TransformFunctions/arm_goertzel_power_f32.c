@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_power_f32.c
+ * Description:  Floating-point Goertzel filter bank squared magnitude output
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Floating-point Goertzel filter bank squared magnitude output.
+ * @param[in]  *S     points to an instance of the Floating-point Goertzel structure.
+ * @param[out] *pDst  points to the output array of size <code>numBins</code> for <code>|X(k)|^2</code>.
+ * @return     none.
+ *
+ * \par
+ * Returns the power of every bin, for example to compare it against a detection threshold.
+ * The states are not modified, so the result can be read while the block or the
+ * sliding window is still being processed.
+ */
+
+void arm_goertzel_power_f32(
+    const arm_goertzel_instance_f32 *S,
+    float32_t *pDst )
+{
+    const float32_t *pCoeffs = S->pCoeffs;               /* coefficient pointer */
+    const float32_t *pState = S->pState;                /* state pointer */
+    float32_t r = S->damping;                      /* damping factor, 1 in block mode */
+    float32_t re, im;                              /* real and imaginary part of the bin */
+    uint16_t bin = S->numBins;                     /* bin counter */
+
+    while( bin > 0U )
+    {
+        /* X(k) = (cos(w) * s[N-1] - r * s[N-2]) + j * sin(w) * s[N-1] */
+        re = pCoeffs[0] * pState[0] - r * pState[1];
+        im = pCoeffs[1] * pState[0];
+
+        *pDst++ = re * re + im * im;
+
+        /* Advance to the next bin */
+        pState += 2U;
+        pCoeffs += 2U;
+        bin--;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filter bank, block mode
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Q31 Goertzel filter bank, block mode.
+ * @param[in]  *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[in]  blockSize  number of samples to process.
+ * @return     none.
+ *
+ * \par
+ * Runs every bin of the filter bank over the input block. Blocks of any size can be passed in
+ * several calls; the states carry over from one call to the next until
+ * <code>arm_goertzel_reset_q31()</code> is called.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted right by <code>inputShift</code> bits and the states are kept in 1.31 format.
+ * The product <code>2 * cos(w) * s[n-1]</code> is computed with a 64-bit intermediate and rounded back
+ * to 1.31 format. The states are not saturated and wrap around if <code>inputShift</code> is too small;
+ * see the Fixed-Point Behavior section of the group description.
+ */
+
+void arm_goertzel_q31(
+    const arm_goertzel_instance_q31 *S,
+    const q31_t *pSrc,
+    uint32_t blockSize )
+{
+    const q31_t *pCoeffs = S->pCoeffs;                   /* coefficient pointer */
+    q31_t *pState = S->pState;                          /* state pointer */
+    const q31_t *px;                              /* input pointer */
+    q31_t coeff;                                   /* cos(w) of the current bin */
+    q31_t s0, s1, s2;                              /* resonator states s[n], s[n-1] and s[n-2] */
+    uint8_t shift = S->inputShift;                 /* input scaling */
+    uint32_t blkCnt;                               /* loop counter */
+    uint16_t bin = S->numBins;                     /* bin counter */
+
+    /* Each bin runs over the whole block in turn, so that its states stay in registers */
+    while( bin > 0U )
+    {
+        coeff = pCoeffs[0];
+        s1 = pState[0];
+        s2 = pState[1];
+        px = pSrc;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling. s1 and s2 swap roles on every sample, so no moves are needed */
+        blkCnt = blockSize >> 2U;
+
+        while( blkCnt > 0U )
+        {
+            /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+            s2 = ( *px++ >> shift ) + ( q31_t ) ( ( ( q63_t ) coeff * s1 + 0x20000000 ) >> 30 ) - s2;
+            s1 = ( *px++ >> shift ) + ( q31_t ) ( ( ( q63_t ) coeff * s2 + 0x20000000 ) >> 30 ) - s1;
+            s2 = ( *px++ >> shift ) + ( q31_t ) ( ( ( q63_t ) coeff * s1 + 0x20000000 ) >> 30 ) - s2;
+            s1 = ( *px++ >> shift ) + ( q31_t ) ( ( ( q63_t ) coeff * s2 + 0x20000000 ) >> 30 ) - s1;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+         ** No loop unrolling is used. */
+        blkCnt = blockSize % 0x4U;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while( blkCnt > 0U )
+        {
+            /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+            s0 = ( *px++ >> shift ) + ( q31_t ) ( ( ( q63_t ) coeff * s1 + 0x20000000 ) >> 30 ) - s2;
+            s2 = s1;
+            s1 = s0;
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        /* Store the states of the bin */
+        pState[0] = s1;
+        pState[1] = s2;
+
+        /* Advance to the next bin */
+        pState += 2U;
+        pCoeffs += 2U;
+        bin--;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_reset_q31.c
+ * Description:  Q31 Goertzel filter bank reset function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Q31 Goertzel filter bank reset function.
+ * @param[in,out] *S  points to an instance of the Q31 Goertzel structure.
+ * @return        none.
+ *
+ * \par
+ * Clears the states, and in sliding mode the delay line, to start a new block.
+ */
+
+void arm_goertzel_reset_q31(
+    arm_goertzel_instance_q31 *S )
+{
+    /* Clear the states */
+    memset( S->pState, 0, 2U * S->numBins * sizeof( q31_t ) );
+
+    /* Clear the delay line of the sliding mode */
+    if( S->pDelay != NULL )
+    {
+        memset( S->pDelay, 0, S->windowLen * sizeof( q31_t ) );
+    }
+
+    S->delayIndex = 0U;
+}
+
+/**
+ * @} end of Goertzel group
+ */
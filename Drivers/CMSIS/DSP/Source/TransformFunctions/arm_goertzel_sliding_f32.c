@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_sliding_f32.c
+ * Description:  Floating-point Goertzel filter bank, sliding mode
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Floating-point Goertzel filter bank, sliding mode.
+ * @param[in,out] *S         points to an instance of the Floating-point Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Pushes the input block through the delay line and updates every bin, so that after the
+ * call the states describe the last <code>windowLen</code> samples. The instance must have
+ * been set up with <code>arm_goertzel_sliding_init_f32()</code>.
+ */
+
+void arm_goertzel_sliding_f32(
+    arm_goertzel_instance_f32 *S,
+    const float32_t *pSrc,
+    uint32_t blockSize )
+{
+    const float32_t *pCoeffs;                    /* coefficient pointer */
+    float32_t *pState;                            /* state pointer */
+    float32_t *pDelay = S->pDelay;                   /* delay line */
+    float32_t r = S->damping;                      /* damping factor r */
+    float32_t r2 = S->dampingSq;                   /* r^2 */
+    float32_t rN = S->dampingPowN;                 /* r^N */
+    float32_t in, d, s0;                           /* input sample, comb output and new state */
+    uint32_t index = S->delayIndex;                /* position of x[n-N] in the delay line */
+    uint32_t windowLen = S->windowLen;             /* window length N */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    uint16_t bin;                                  /* bin counter */
+
+    /* The comb output is shared by all bins, so every sample updates all of them */
+    while( blkCnt > 0U )
+    {
+        /* d[n] = x[n] - r^N * x[n-N] */
+        in = *pSrc++;
+        d = in - rN * pDelay[index];
+
+        /* Replace x[n-N] by x[n] in the delay line */
+        pDelay[index] = in;
+        index++;
+
+        if( index == windowLen )
+        {
+            index = 0U;
+        }
+
+        pCoeffs = S->pCoeffs;
+        pState = S->pState;
+        bin = S->numBins;
+
+        while( bin > 0U )
+        {
+            /* s[n] = d[n] + 2 * r * cos(w) * s[n-1] - r^2 * s[n-2] */
+            s0 = d + r * ( 2.0f * pCoeffs[0] ) * pState[0] - r2 * pState[1];
+            pState[1] = pState[0];
+            pState[0] = s0;
+
+            /* Advance to the next bin */
+            pState += 2U;
+            pCoeffs += 2U;
+            bin--;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the position of the oldest sample */
+    S->delayIndex = index;
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_sliding_init_f32.c
+ * Description:  Floating-point sliding Goertzel filter bank initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Floating-point Goertzel filter bank initialization function for the sliding mode.
+ * @param[in,out] *S       points to an instance of the Floating-point Goertzel structure.
+ * @param[in]  numBins    number of frequency bins.
+ * @param[in]  *pCoeffs   points to the coefficient array of size <code>2*numBins</code>.
+ * @param[in]  *pState    points to the state array of size <code>2*numBins</code>.
+ * @param[in]  windowLen  length N of the sliding window.
+ * @param[in]  *pDelay    points to the delay line of size <code>windowLen</code>.
+ * @param[in]  damping    damping factor r, slightly below 1.
+ * @return     none.
+ *
+ * \par
+ * Clears the states and the delay line. <code>arm_goertzel_sliding_f32()</code> can then be
+ * called with blocks of any size.
+ */
+
+void arm_goertzel_sliding_init_f32(
+    arm_goertzel_instance_f32 *S,
+    uint16_t numBins,
+    const float32_t *pCoeffs,
+    float32_t *pState,
+    uint32_t windowLen,
+    float32_t *pDelay,
+    float32_t damping )
+{
+    float32_t powN = 1.0f;                         /* r^N */
+    uint32_t i;                                    /* loop counter */
+
+    /* Assign bin number, coefficient and state pointers */
+    S->numBins = numBins;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    /* Sliding mode: window of windowLen samples */
+    S->windowLen = windowLen;
+    S->pDelay = pDelay;
+
+    /* r^N, computed once here rather than with powf() */
+    for( i = 0U; i < windowLen; i++ )
+    {
+        powN *= damping;
+    }
+
+    S->damping = damping;
+    S->dampingSq = damping * damping;
+    S->dampingPowN = powN;
+
+    /* Clear the states and the delay line */
+    arm_goertzel_reset_f32( S );
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_sliding_init_q15.c
+ * Description:  Q15 sliding Goertzel filter bank initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Q15 Goertzel filter bank initialization function for the sliding mode.
+ * @param[in,out] *S       points to an instance of the Q15 Goertzel structure.
+ * @param[in]  numBins    number of frequency bins.
+ * @param[in]  *pCoeffs   points to the coefficient array of size <code>2*numBins</code>.
+ * @param[in]  *pState    points to the state array of size <code>2*numBins</code>.
+ * @param[in]  windowLen  length N of the sliding window.
+ * @param[in]  *pDelay    points to the delay line of size <code>windowLen</code>.
+ * @param[in]  damping    damping factor r, slightly below 1, in 1.31 format.
+ * @param[in]  inputShift number of bits the input is shifted right by before it enters the resonators.
+ * @return     none.
+ *
+ * \par
+ * Clears the states and the delay line. <code>arm_goertzel_sliding_q15()</code> can then be
+ * called with blocks of any size.
+ */
+
+void arm_goertzel_sliding_init_q15(
+    arm_goertzel_instance_q15 *S,
+    uint16_t numBins,
+    const q15_t *pCoeffs,
+    q31_t *pState,
+    uint32_t windowLen,
+    q15_t *pDelay,
+    q31_t damping,
+    uint8_t inputShift )
+{
+    q31_t powN = 0x7FFFFFFF;                       /* r^N */
+    uint32_t i;                                    /* loop counter */
+
+    /* Assign bin number, coefficient and state pointers */
+    S->numBins = numBins;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->inputShift = inputShift;
+
+    /* Sliding mode: window of windowLen samples */
+    S->windowLen = windowLen;
+    S->pDelay = pDelay;
+
+    /* r^N, computed once here by repeated multiplication */
+    for( i = 0U; i < windowLen; i++ )
+    {
+        powN = ( q31_t ) ( ( ( q63_t ) powN * damping ) >> 31 );
+    }
+
+    S->damping = damping;
+    S->dampingSq = ( q31_t ) ( ( ( q63_t ) damping * damping ) >> 31 );
+    S->dampingPowN = powN;
+
+    /* Clear the states and the delay line */
+    arm_goertzel_reset_q15( S );
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_sliding_q15.c
+ * Description:  Q15 Goertzel filter bank, sliding mode
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Q15 Goertzel filter bank, sliding mode.
+ * @param[in,out] *S         points to an instance of the Q15 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Pushes the input block through the delay line and updates every bin, so that after the
+ * call the states describe the last <code>windowLen</code> samples. The instance must have
+ * been set up with <code>arm_goertzel_sliding_init_q15()</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The scaling is the same as in <code>arm_goertzel_q15()</code>. The damping products are computed
+ * with 64-bit intermediates and rounded back to 1.31 format.
+ */
+
+void arm_goertzel_sliding_q15(
+    arm_goertzel_instance_q15 *S,
+    const q15_t *pSrc,
+    uint32_t blockSize )
+{
+    const q15_t *pCoeffs;                        /* coefficient pointer */
+    q31_t *pState;                                /* state pointer */
+    q15_t *pDelay = S->pDelay;                       /* delay line */
+    q31_t r = S->damping;                          /* damping factor r */
+    q31_t r2 = S->dampingSq;                       /* r^2 */
+    q31_t rN = S->dampingPowN;                     /* r^N */
+    q31_t rc;                                      /* r * cos(w) of the current bin */
+    q31_t d, s0;                                   /* comb output and new state */
+    q15_t in;                                  /* input sample */
+    uint8_t shift = S->inputShift;                 /* input scaling */
+    uint32_t index = S->delayIndex;                /* position of x[n-N] in the delay line */
+    uint32_t windowLen = S->windowLen;             /* window length N */
+    uint32_t blkCnt = blockSize;                   /* loop counter */
+    uint16_t bin;                                  /* bin counter */
+
+    /* The comb output is shared by all bins, so every sample updates all of them */
+    while( blkCnt > 0U )
+    {
+        /* d[n] = x[n] - r^N * x[n-N] */
+        in = *pSrc++;
+        d = ( ( ( q31_t ) in << 16 ) >> shift ) -
+            ( q31_t ) ( ( ( q63_t ) rN * ( ( ( q31_t ) pDelay[index] << 16 ) >> shift ) + 0x40000000 ) >> 31 );
+
+        /* Replace x[n-N] by x[n] in the delay line */
+        pDelay[index] = in;
+        index++;
+
+        if( index == windowLen )
+        {
+            index = 0U;
+        }
+
+        pCoeffs = S->pCoeffs;
+        pState = S->pState;
+        bin = S->numBins;
+
+        while( bin > 0U )
+        {
+            /* s[n] = d[n] + 2 * r * cos(w) * s[n-1] - r^2 * s[n-2] */
+            rc = ( q31_t ) ( ( ( q63_t ) r * pCoeffs[0] ) >> 15 );
+            s0 = d + ( q31_t ) ( ( ( q63_t ) rc * pState[0] + 0x20000000 ) >> 30 ) -
+                 ( q31_t ) ( ( ( q63_t ) r2 * pState[1] + 0x40000000 ) >> 31 );
+            pState[1] = pState[0];
+            pState[0] = s0;
+
+            /* Advance to the next bin */
+            pState += 2U;
+            pCoeffs += 2U;
+            bin--;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Save the position of the oldest sample */
+    S->delayIndex = index;
+}
+
+/**
+ * @} end of Goertzel group
+ */
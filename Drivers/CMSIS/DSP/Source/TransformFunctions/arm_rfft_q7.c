@@ -0,0 +1,287 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_q7.c
+ * Description:  RFFT & RIFFT Q7 block floating-point process function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Right shift that keeps the split step from overflowing.
+ * @param[in]  pSrc   points to the input buffer.
+ * @param[in]  len    number of values in the input buffer.
+ * @return     shift of 0, 1 or 2.
+ *
+ * The split step grows a real or imaginary part by at most 2, and the
+ * outputs are rounded to nearest.
+ */
+
+static uint32_t arm_split_shift_q7(
+    const q7_t *pSrc,
+    uint32_t len )
+{
+    q31_t maxVal = 0;
+    q31_t in;
+    uint32_t i;
+
+    for( i = 0U; i < len; i++ )
+    {
+        in = pSrc[i];
+
+        if( in < 0 )
+        {
+            in = -in;
+        }
+
+        if( in > maxVal )
+        {
+            maxVal = in;
+        }
+    }
+
+    if( maxVal <= 63 )
+    {
+        return 0U;
+    }
+    else if( maxVal <= 126 )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 2U;
+    }
+}
+
+/**
+* @brief  Core Real FFT process
+* @param[in]   *pSrc        points to the output of the complex FFT.
+* @param[in]   fftLen       length of the complex FFT.
+* @param[in]   *pATable     points to the A twiddle Coef buffer.
+* @param[in]   *pBTable     points to the B twiddle Coef buffer.
+* @param[out]  *pDst        points to the output buffer.
+* @param[in]   modifier     twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+* @return      right shift applied to the output.
+*/
+
+static uint32_t arm_split_rfft_q7(
+    const q7_t *pSrc,
+    uint32_t fftLen,
+    const q15_t *pATable,
+    const q15_t *pBTable,
+    q7_t *pDst,
+    uint32_t modifier )
+{
+    uint32_t i;                                    /* Loop Counter */
+    uint32_t shift;                                /* Output shift */
+    q31_t rnd;                                     /* Rounding constant of the output */
+    q31_t outR, outI;                              /* Temporary variables for output */
+    const q15_t *pCoefA, *pCoefB;                  /* Temporary pointers for twiddle factors */
+    const q7_t *pSrc1, *pSrc2;                     /* Pointers to Z[k] and Z[fftLen - k] */
+
+    shift = arm_split_shift_q7( pSrc, 2U * fftLen );
+    rnd = ( q31_t )( 1U << ( 14U + shift ) );
+
+    pCoefA = &pATable[modifier * 2U];
+    pCoefB = &pBTable[modifier * 2U];
+
+    pSrc1 = &pSrc[2];
+    pSrc2 = &pSrc[( 2U * fftLen ) - 2U];
+
+    for( i = 1U; i < fftLen; i++ )
+    {
+        /* outR = (pSrc[2 * i] * pATable[2 * i] - pSrc[2 * i + 1] * pATable[2 * i + 1]
+                 + pSrc[2 * n - 2 * i] * pBTable[2 * i] + pSrc[2 * n - 2 * i + 1] * pBTable[2 * i + 1]) */
+        outR = ( pSrc1[0] * pCoefA[0] ) - ( pSrc1[1] * pCoefA[1] )
+               + ( pSrc2[0] * pCoefB[0] ) + ( pSrc2[1] * pCoefB[1] );
+
+        /* outI = (pSrc[2 * i + 1] * pATable[2 * i] + pSrc[2 * i] * pATable[2 * i + 1]
+                 + pSrc[2 * n - 2 * i] * pBTable[2 * i + 1] - pSrc[2 * n - 2 * i + 1] * pBTable[2 * i]) */
+        outI = ( pSrc1[1] * pCoefA[0] ) + ( pSrc1[0] * pCoefA[1] )
+               + ( pSrc2[0] * pCoefB[1] ) - ( pSrc2[1] * pCoefB[0] );
+
+        outR = ( outR + rnd ) >> ( 15U + shift );
+        outI = ( outI + rnd ) >> ( 15U + shift );
+
+        /* write output */
+        pDst[2U * i] = ( q7_t ) outR;
+        pDst[( 2U * i ) + 1U] = ( q7_t ) outI;
+
+        /* write complex conjugate output */
+        pDst[( 4U * fftLen ) - ( 2U * i )] = ( q7_t ) outR;
+        pDst[( ( 4U * fftLen ) - ( 2U * i ) ) + 1U] = ( q7_t ) - outI;
+
+        pSrc1 += 2U;
+        pSrc2 -= 2U;
+
+        /* update coefficient pointer */
+        pCoefA = pCoefA + ( 2U * modifier );
+        pCoefB = pCoefB + ( 2U * modifier );
+    }
+
+    pDst[2U * fftLen] = ( q7_t )( ( pSrc[0] - pSrc[1] + ( rnd >> 15 ) ) >> shift );
+    pDst[( 2U * fftLen ) + 1U] = 0;
+
+    pDst[0] = ( q7_t )( ( pSrc[0] + pSrc[1] + ( rnd >> 15 ) ) >> shift );
+    pDst[1] = 0;
+
+    return shift;
+}
+
+/**
+* @brief  Core Real IFFT process
+* @param[in]   *pSrc        points to the input spectrum.
+* @param[in]   fftLen       length of the complex FFT.
+* @param[in]   *pATable     points to the twiddle Coef A buffer.
+* @param[in]   *pBTable     points to the twiddle Coef B buffer.
+* @param[out]  *pDst        points to the input of the complex IFFT.
+* @param[in]   modifier     twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+* @return      right shift applied to the output.
+*/
+
+static uint32_t arm_split_rifft_q7(
+    const q7_t *pSrc,
+    uint32_t fftLen,
+    const q15_t *pATable,
+    const q15_t *pBTable,
+    q7_t *pDst,
+    uint32_t modifier )
+{
+    uint32_t i;                                    /* Loop Counter */
+    uint32_t shift;                                /* Output shift */
+    q31_t rnd;                                     /* Rounding constant of the output */
+    q31_t outR, outI;                              /* Temporary variables for output */
+    const q15_t *pCoefA, *pCoefB;                  /* Temporary pointers for twiddle factors */
+    const q7_t *pSrc1, *pSrc2;                     /* Pointers to X[k] and X[fftLen - k] */
+
+    shift = arm_split_shift_q7( pSrc, ( 2U * fftLen ) + 2U );
+    rnd = ( q31_t )( 1U << ( 14U + shift ) );
+
+    pCoefA = &pATable[0];
+    pCoefB = &pBTable[0];
+
+    pSrc1 = &pSrc[0];
+    pSrc2 = &pSrc[2U * fftLen];
+
+    for( i = 0U; i < fftLen; i++ )
+    {
+        /* outR = (pIn[2 * i] * pATable[2 * i] + pIn[2 * i + 1] * pATable[2 * i + 1]
+                 + pIn[2 * n - 2 * i] * pBTable[2 * i] - pIn[2 * n - 2 * i + 1] * pBTable[2 * i + 1]) */
+        outR = ( pSrc1[0] * pCoefA[0] ) + ( pSrc1[1] * pCoefA[1] )
+               + ( pSrc2[0] * pCoefB[0] ) - ( pSrc2[1] * pCoefB[1] );
+
+        /* outI = (pIn[2 * i + 1] * pATable[2 * i] - pIn[2 * i] * pATable[2 * i + 1]
+                 - pIn[2 * n - 2 * i] * pBTable[2 * i + 1] - pIn[2 * n - 2 * i + 1] * pBTable[2 * i]) */
+        outI = ( pSrc1[1] * pCoefA[0] ) - ( pSrc1[0] * pCoefA[1] )
+               - ( pSrc2[0] * pCoefB[1] ) - ( pSrc2[1] * pCoefB[0] );
+
+        /* write output */
+        pDst[2U * i] = ( q7_t )( ( outR + rnd ) >> ( 15U + shift ) );
+        pDst[( 2U * i ) + 1U] = ( q7_t )( ( outI + rnd ) >> ( 15U + shift ) );
+
+        pSrc1 += 2U;
+        pSrc2 -= 2U;
+
+        /* update coefficient pointer */
+        pCoefA = pCoefA + ( 2U * modifier );
+        pCoefB = pCoefB + ( 2U * modifier );
+    }
+
+    return shift;
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q7 block floating-point RFFT/RIFFT.
+* @param[in]  *S         points to an instance of the Q7 RFFT/RIFFT structure.
+* @param[in]  *pSrc      points to the input buffer.
+* @param[out] *pDst      points to the output buffer.
+* @param[out] *pBlockExp points to the block exponent of the output.
+* @return none.
+*
+* \par
+* The real FFT of length <code>fftLenReal</code> is computed with a complex FFT of half
+* the length, arm_cfft_q7(), followed by a split step. The forward transform writes the
+* full spectrum of <code>fftLenReal</code> complex values to <code>pDst</code> and uses
+* <code>pSrc</code> as its working buffer. The inverse transform reads the
+* <code>fftLenReal/2+1</code> complex values of the first half of the spectrum from
+* <code>pSrc</code> and writes <code>fftLenReal</code> real values to <code>pDst</code>.
+*
+* \par Block floating-point scaling:
+* As with arm_cfft_q7(), every step shifts its outputs right only as much as is needed to
+* avoid overflow, and
+* <pre>
+*     pDst[n] * 2^(*pBlockExp)
+* </pre>
+* is the unnormalized transform in the units of the input. The inverse transform is
+* <code>fftLenReal</code> times the inverse DFT.
+*/
+
+void arm_rfft_q7(
+    const arm_rfft_instance_q7 *S,
+    q7_t *pSrc,
+    q7_t *pDst,
+    int8_t *pBlockExp )
+{
+    const arm_cfft_instance_q7 *S_CFFT = S->pCfft;
+    uint32_t L2 = S->fftLenReal >> 1;
+    uint32_t shift;
+    int8_t blockExp;
+
+    /* Calculation of RIFFT of input */
+    if( S->ifftFlagR == 1U )
+    {
+        /*  Real IFFT core process */
+        shift = arm_split_rifft_q7( pSrc, L2, S->pTwiddleAReal,
+                                    S->pTwiddleBReal, pDst, S->twidCoefRModifier );
+
+        /* Complex IFFT process */
+        arm_cfft_q7( S_CFFT, pDst, S->ifftFlagR, S->bitReverseFlagR, &blockExp );
+
+        /* The half length complex IFFT gives fftLenReal/2 times the inverse DFT */
+        *pBlockExp = ( int8_t )( blockExp + ( int32_t ) shift + 1 );
+    }
+    else
+    {
+        /* Calculation of RFFT of input */
+
+        /* Complex FFT process */
+        arm_cfft_q7( S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR, &blockExp );
+
+        /*  Real FFT core process */
+        shift = arm_split_rfft_q7( pSrc, L2, S->pTwiddleAReal,
+                                   S->pTwiddleBReal, pDst, S->twidCoefRModifier );
+
+        *pBlockExp = ( int8_t )( blockExp + ( int32_t ) shift );
+    }
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -43,7 +43,9 @@
    * - Fully-connected Layer Functions
    * - Neural Network Pooling Functions
    * - Softmax Functions
+   * - Recurrent Layer Functions
    * - Neural Network Support Functions
+   * - Neural Network Graph Functions
    *
    * The library has separate functions for operating on different weight and activation data
    * types including 8-bit integers (q7_t) and 16-bit integers (q15_t). The descrition of the
@@ -536,6 +538,212 @@ arm_convolve_HWC_q15_fast_nonsquare( const q15_t *Im_in,
                                      q15_t *bufferA,
                                      q7_t *bufferB );
 
+/**
+ * @brief Instance structure for the Q7 streaming 1-D convolution.
+ */
+typedef struct
+{
+    uint16_t  ch_im_in;         /**< number of input channels. */
+    uint16_t  ch_im_out;        /**< number of filters, i.e., output channels. */
+    uint16_t  dim_kernel;       /**< filter kernel size. */
+    uint16_t  dilation;         /**< distance between the taps of the kernel. */
+    const q7_t *wt;             /**< points to the kernel weights. */
+    const q7_t *bias;           /**< points to the bias. */
+    uint16_t  bias_shift;       /**< amount of left-shift for bias. */
+    uint16_t  out_shift;        /**< amount of right-shift for output. */
+    uint16_t  stateLength;      /**< number of frames in the state, (dim_kernel-1)*dilation+1. */
+    uint16_t  stateIndex;       /**< index of the oldest frame in the state. */
+    q7_t     *pState;           /**< points to the state ring buffer of stateLength frames. */
+} arm_convolve_1d_instance_q7;
+
+/**
+ * @brief Instance structure for the Q15 streaming 1-D convolution.
+ */
+typedef struct
+{
+    uint16_t  ch_im_in;         /**< number of input channels. */
+    uint16_t  ch_im_out;        /**< number of filters, i.e., output channels. */
+    uint16_t  dim_kernel;       /**< filter kernel size. */
+    uint16_t  dilation;         /**< distance between the taps of the kernel. */
+    const q15_t *wt;            /**< points to the kernel weights. */
+    const q15_t *bias;          /**< points to the bias. */
+    uint16_t  bias_shift;       /**< amount of left-shift for bias. */
+    uint16_t  out_shift;        /**< amount of right-shift for output. */
+    uint16_t  stateLength;      /**< number of frames in the state, (dim_kernel-1)*dilation+1. */
+    uint16_t  stateIndex;       /**< index of the oldest frame in the state. */
+    q15_t    *pState;           /**< points to the state ring buffer of stateLength frames. */
+} arm_convolve_1d_instance_q15;
+
+/**
+ * @brief Q7 1-D convolution function
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor length
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding size before the first frame
+ * @param[in]       stride      convolution stride
+ * @param[in]       dilation    distance between the taps of the kernel
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @param[in]       dim_im_out  output tensor length
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ */
+
+arm_status arm_convolve_1d_q7( const q7_t *Im_in,
+                               const uint16_t dim_im_in,
+                               const uint16_t ch_im_in,
+                               const q7_t *wt,
+                               const uint16_t ch_im_out,
+                               const uint16_t dim_kernel,
+                               const uint16_t padding,
+                               const uint16_t stride,
+                               const uint16_t dilation,
+                               const q7_t *bias,
+                               const uint16_t bias_shift,
+                               const uint16_t out_shift,
+                               q7_t *Im_out,
+                               const uint16_t dim_im_out,
+                               q15_t *bufferA );
+
+/**
+ * @brief Q15 1-D convolution function
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor length
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding size before the first frame
+ * @param[in]       stride      convolution stride
+ * @param[in]       dilation    distance between the taps of the kernel
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @param[in]       dim_im_out  output tensor length
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ */
+
+arm_status arm_convolve_1d_q15( const q15_t *Im_in,
+                                const uint16_t dim_im_in,
+                                const uint16_t ch_im_in,
+                                const q15_t *wt,
+                                const uint16_t ch_im_out,
+                                const uint16_t dim_kernel,
+                                const uint16_t padding,
+                                const uint16_t stride,
+                                const uint16_t dilation,
+                                const q15_t *bias,
+                                const uint16_t bias_shift,
+                                const uint16_t out_shift,
+                                q15_t *Im_out,
+                                const uint16_t dim_im_out,
+                                q15_t *bufferA );
+
+/**
+ * @brief Initialization function for the Q7 streaming 1-D convolution
+ * @param[in,out]   S           points to an instance of the Q7 streaming 1-D convolution structure
+ * @param[in]       ch_im_in    number of input channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       dilation    distance between the taps of the kernel
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       pState      pointer to the state buffer
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ * pState size: ((dim_kernel-1)*dilation+1)*ch_im_in
+ */
+
+arm_status arm_convolve_1d_stream_init_q7( arm_convolve_1d_instance_q7 *S,
+        const uint16_t ch_im_in,
+        const q7_t *wt,
+        const uint16_t ch_im_out,
+        const uint16_t dim_kernel,
+        const uint16_t dilation,
+        const q7_t *bias,
+        const uint16_t bias_shift,
+        const uint16_t out_shift,
+        q7_t *pState );
+
+/**
+ * @brief Q7 streaming 1-D convolution function
+ * @param[in,out]   S           points to an instance of the Q7 streaming 1-D convolution structure
+ * @param[in]       pSrc        pointer to blockSize input frames
+ * @param[out]      pDst        pointer to blockSize output frames
+ * @param[in]       blockSize   number of frames to process
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @return none.
+ *
+ * bufferA size: ch_im_in*dim_kernel
+ */
+
+void      arm_convolve_1d_stream_q7( arm_convolve_1d_instance_q7 *S,
+                                     const q7_t *pSrc,
+                                     q7_t *pDst,
+                                     uint32_t blockSize,
+                                     q15_t *bufferA );
+
+/**
+ * @brief Initialization function for the Q15 streaming 1-D convolution
+ * @param[in,out]   S           points to an instance of the Q15 streaming 1-D convolution structure
+ * @param[in]       ch_im_in    number of input channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       dilation    distance between the taps of the kernel
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       pState      pointer to the state buffer
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ * pState size: ((dim_kernel-1)*dilation+1)*ch_im_in
+ */
+
+arm_status arm_convolve_1d_stream_init_q15( arm_convolve_1d_instance_q15 *S,
+        const uint16_t ch_im_in,
+        const q15_t *wt,
+        const uint16_t ch_im_out,
+        const uint16_t dim_kernel,
+        const uint16_t dilation,
+        const q15_t *bias,
+        const uint16_t bias_shift,
+        const uint16_t out_shift,
+        q15_t *pState );
+
+/**
+ * @brief Q15 streaming 1-D convolution function
+ * @param[in,out]   S           points to an instance of the Q15 streaming 1-D convolution structure
+ * @param[in]       pSrc        pointer to blockSize input frames
+ * @param[out]      pDst        pointer to blockSize output frames
+ * @param[in]       blockSize   number of frames to process
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @return none.
+ *
+ * bufferA size: ch_im_in*dim_kernel
+ */
+
+void      arm_convolve_1d_stream_q15( arm_convolve_1d_instance_q15 *S,
+                                      const q15_t *pSrc,
+                                      q15_t *pDst,
+                                      uint32_t blockSize,
+                                      q15_t *bufferA );
+
 /**
  * @brief Q7 depthwise separable convolution function
  * @param[in]       Im_in       pointer to input tensor
@@ -629,6 +837,113 @@ arm_status arm_depthwise_separable_conv_HWC_q7_nonsquare( const q7_t *Im_in,
         q15_t *bufferA,
         q7_t *bufferB );
 
+/**
+ * @brief int8 convolution function with per-channel requantization
+ * @param[in]       input               pointer to input tensor
+ * @param[in]       input_x             input tensor dimension x
+ * @param[in]       input_y             input tensor dimension y
+ * @param[in]       input_ch            number of input tensor channels
+ * @param[in]       kernel              pointer to kernel weights
+ * @param[in]       output_ch           number of filters, i.e., output tensor channels
+ * @param[in]       kernel_x            filter kernel size x
+ * @param[in]       kernel_y            filter kernel size y
+ * @param[in]       pad_x               padding size x
+ * @param[in]       pad_y               padding size y
+ * @param[in]       stride_x            convolution stride x
+ * @param[in]       stride_y            convolution stride y
+ * @param[in]       bias                pointer to per-channel int32 bias
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_shift        pointer to per-channel output shifts
+ * @param[in]       output_mult         pointer to per-channel output multipliers
+ * @param[in]       out_offset          output zero point
+ * @param[in]       input_offset        negated input zero point, in the range [-127, 128]
+ * @param[in]       out_activation_min  minimum output value, usually -128
+ * @param[in]       out_activation_max  maximum output value, usually 127
+ * @param[in]       output_x            output tensor dimension x
+ * @param[in]       output_y            output tensor dimension y
+ * @param[in,out]   buffer_a            pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * buffer_a size: 2*input_ch*kernel_x*kernel_y
+ */
+
+arm_status arm_convolve_s8( const q7_t *input,
+                            const uint16_t input_x,
+                            const uint16_t input_y,
+                            const uint16_t input_ch,
+                            const q7_t *kernel,
+                            const uint16_t output_ch,
+                            const uint16_t kernel_x,
+                            const uint16_t kernel_y,
+                            const uint16_t pad_x,
+                            const uint16_t pad_y,
+                            const uint16_t stride_x,
+                            const uint16_t stride_y,
+                            const int32_t *bias,
+                            q7_t *output,
+                            const int32_t *output_shift,
+                            const int32_t *output_mult,
+                            const int32_t out_offset,
+                            const int32_t input_offset,
+                            const int32_t out_activation_min,
+                            const int32_t out_activation_max,
+                            const uint16_t output_x,
+                            const uint16_t output_y,
+                            q15_t *buffer_a );
+
+/**
+ * @brief int8 depthwise convolution function with per-channel requantization
+ * @param[in]       input               pointer to input tensor
+ * @param[in]       input_x             input tensor dimension x
+ * @param[in]       input_y             input tensor dimension y
+ * @param[in]       input_ch            number of input tensor channels
+ * @param[in]       kernel              pointer to kernel weights
+ * @param[in]       output_ch           number of output tensor channels, input_ch * ch_mult
+ * @param[in]       ch_mult             channel multiplier
+ * @param[in]       kernel_x            filter kernel size x
+ * @param[in]       kernel_y            filter kernel size y
+ * @param[in]       pad_x               padding size x
+ * @param[in]       pad_y               padding size y
+ * @param[in]       stride_x            convolution stride x
+ * @param[in]       stride_y            convolution stride y
+ * @param[in]       bias                pointer to per-channel int32 bias
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_shift        pointer to per-channel output shifts
+ * @param[in]       output_mult         pointer to per-channel output multipliers
+ * @param[in]       output_x            output tensor dimension x
+ * @param[in]       output_y            output tensor dimension y
+ * @param[in]       output_offset       output zero point
+ * @param[in]       input_offset        negated input zero point, in the range [-127, 128]
+ * @param[in]       output_activation_min   minimum output value, usually -128
+ * @param[in]       output_activation_max   maximum output value, usually 127
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ */
+
+arm_status arm_depthwise_conv_s8( const q7_t *input,
+                                  const uint16_t input_x,
+                                  const uint16_t input_y,
+                                  const uint16_t input_ch,
+                                  const q7_t *kernel,
+                                  const uint16_t output_ch,
+                                  const uint16_t ch_mult,
+                                  const uint16_t kernel_x,
+                                  const uint16_t kernel_y,
+                                  const uint16_t pad_x,
+                                  const uint16_t pad_y,
+                                  const uint16_t stride_x,
+                                  const uint16_t stride_y,
+                                  const int32_t *bias,
+                                  q7_t *output,
+                                  const int32_t *output_shift,
+                                  const int32_t *output_mult,
+                                  const uint16_t output_x,
+                                  const uint16_t output_y,
+                                  const int32_t output_offset,
+                                  const int32_t input_offset,
+                                  const int32_t output_activation_min,
+                                  const int32_t output_activation_max );
+
 
 /**
  * @defgroup FC Fully-connected Layer Functions
@@ -796,6 +1111,74 @@ arm_status arm_fully_connected_mat_q7_vec_q15_opt( const q15_t *pV,
         q15_t *pOut,
         q15_t *vec_buffer );
 
+/**
+ * @brief int8 fully-connected layer function
+ * @param[in]       pV                      pointer to input vector
+ * @param[in]       pM                      pointer to matrix weights
+ * @param[in]       dim_vec                 length of the vector
+ * @param[in]       num_of_rows             number of rows in weight matrix
+ * @param[in]       input_offset            negated input zero point, in the range [-127, 128]
+ * @param[in]       out_mult                output multiplier
+ * @param[in]       out_shift               output shift, positive to the left
+ * @param[in]       output_offset           output zero point
+ * @param[in]       bias                    pointer to int32 bias
+ * @param[in,out]   pOut                    pointer to output vector
+ * @param[in]       output_activation_min   minimum output value, usually -128
+ * @param[in]       output_activation_max   maximum output value, usually 127
+ * @param[in,out]   vec_buffer              pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * vec_buffer size: dim_vec
+ */
+
+arm_status arm_fully_connected_s8( const q7_t *pV,
+                                   const q7_t *pM,
+                                   const uint16_t dim_vec,
+                                   const uint16_t num_of_rows,
+                                   const int32_t input_offset,
+                                   const int32_t out_mult,
+                                   const int32_t out_shift,
+                                   const int32_t output_offset,
+                                   const int32_t *bias,
+                                   q7_t *pOut,
+                                   const int32_t output_activation_min,
+                                   const int32_t output_activation_max,
+                                   q15_t *vec_buffer );
+
+/**
+ * @brief int8 opt fully-connected layer function
+ * @param[in]       pV                      pointer to input vector
+ * @param[in]       pM                      pointer to matrix weights, packed with arm_nn_pack_weights_q7_q15_x4()
+ * @param[in]       dim_vec                 length of the vector
+ * @param[in]       num_of_rows             number of rows in weight matrix
+ * @param[in]       input_offset            negated input zero point, in the range [-127, 128]
+ * @param[in]       out_mult                output multiplier
+ * @param[in]       out_shift               output shift, positive to the left
+ * @param[in]       output_offset           output zero point
+ * @param[in]       bias                    pointer to int32 bias
+ * @param[in,out]   pOut                    pointer to output vector
+ * @param[in]       output_activation_min   minimum output value, usually -128
+ * @param[in]       output_activation_max   maximum output value, usually 127
+ * @param[in,out]   vec_buffer              pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * vec_buffer size: dim_vec
+ */
+
+arm_status arm_fully_connected_s8_opt( const q7_t *pV,
+                                       const q7_t *pM,
+                                       const uint16_t dim_vec,
+                                       const uint16_t num_of_rows,
+                                       const int32_t input_offset,
+                                       const int32_t out_mult,
+                                       const int32_t out_shift,
+                                       const int32_t output_offset,
+                                       const int32_t *bias,
+                                       q7_t *pOut,
+                                       const int32_t output_activation_min,
+                                       const int32_t output_activation_max,
+                                       q15_t *vec_buffer );
+
 /**
  * @brief Matrix-Multiplication Kernels for Convolution
  *
@@ -852,6 +1235,34 @@ q7_t     *arm_nn_mat_mult_kernel_q7_q15_reordered( const q7_t *pA,
         const q7_t *bias,
         q7_t *pOut );
 
+/**
+ * @brief Matrix-multiplication function for int8 convolution
+ * @param[in]       input_a         pointer to operand A, the int8 weights
+ * @param[in]       input_b         pointer to operand B, always consists of 2 vectors
+ * @param[in]       output_ch       numRow of A
+ * @param[in]       out_shift       per-channel output shifts
+ * @param[in]       out_mult        per-channel output multipliers
+ * @param[in]       out_offset      output zero point
+ * @param[in]       activation_min  minimum output value
+ * @param[in]       activation_max  maximum output value
+ * @param[in]       num_col_a       numCol of A
+ * @param[in]       output_bias     per-channel int32 bias
+ * @param[in,out]   out_0           pointer to output
+ * @return     The function returns the incremented output pointer
+ */
+
+q7_t     *arm_nn_mat_mult_kernel_s8_s16( const q7_t *input_a,
+        const q15_t *input_b,
+        const uint16_t output_ch,
+        const int32_t *out_shift,
+        const int32_t *out_mult,
+        const int32_t out_offset,
+        const int16_t activation_min,
+        const int16_t activation_max,
+        const uint16_t num_col_a,
+        const int32_t *output_bias,
+        q7_t *out_0 );
+
 #ifdef __cplusplus
 }
 #endif
@@ -974,6 +1385,313 @@ void      arm_avepool_q7_HWC( q7_t *Im_in,
                               q7_t *bufferA,
                               q7_t *Im_out );
 
+/**
+ * @brief Q7 max pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for input
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ */
+
+void      arm_maxpool_q7_HWC_nonsquare( const q7_t *Im_in,
+                                        const uint16_t dim_im_in_x,
+                                        const uint16_t dim_im_in_y,
+                                        const uint16_t ch_im_in,
+                                        const uint16_t dim_kernel_x,
+                                        const uint16_t dim_kernel_y,
+                                        const uint16_t padding_x,
+                                        const uint16_t padding_y,
+                                        const uint16_t stride_x,
+                                        const uint16_t stride_y,
+                                        const uint16_t dim_im_out_x,
+                                        const uint16_t dim_im_out_y,
+                                        q7_t *bufferA,
+                                        q7_t *Im_out );
+
+/**
+ * @brief Q7 average pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ */
+
+void      arm_avepool_q7_HWC_nonsquare( const q7_t *Im_in,
+                                        const uint16_t dim_im_in_x,
+                                        const uint16_t dim_im_in_y,
+                                        const uint16_t ch_im_in,
+                                        const uint16_t dim_kernel_x,
+                                        const uint16_t dim_kernel_y,
+                                        const uint16_t padding_x,
+                                        const uint16_t padding_y,
+                                        const uint16_t stride_x,
+                                        const uint16_t stride_y,
+                                        const uint16_t dim_im_out_x,
+                                        const uint16_t dim_im_out_y,
+                                        q7_t *bufferA,
+                                        q7_t *Im_out );
+
+/**
+ * @brief Q15 max pooling function
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor dimension
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding sizes
+ * @param[in]       stride      pooling stride
+ * @param[in]       dim_im_out  output tensor dimension
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @return none.
+ *
+ */
+
+void      arm_maxpool_q15_HWC( const q15_t *Im_in,
+                               const uint16_t dim_im_in,
+                               const uint16_t ch_im_in,
+                               const uint16_t dim_kernel,
+                               const uint16_t padding,
+                               const uint16_t stride,
+                               const uint16_t dim_im_out,
+                               q15_t *bufferA,
+                               q15_t *Im_out );
+
+/**
+ * @brief Q15 average pooling function
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor dimension
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding sizes
+ * @param[in]       stride      pooling stride
+ * @param[in]       dim_im_out  output tensor dimension
+ * @param[in,out]   bufferA     pointer to buffer space for the sums
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @return none.
+ *
+ */
+
+void      arm_avepool_q15_HWC( const q15_t *Im_in,
+                               const uint16_t dim_im_in,
+                               const uint16_t ch_im_in,
+                               const uint16_t dim_kernel,
+                               const uint16_t padding,
+                               const uint16_t stride,
+                               const uint16_t dim_im_out,
+                               q15_t *bufferA,
+                               q15_t *Im_out );
+
+/**
+ * @brief Q15 max pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for input
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ */
+
+void      arm_maxpool_q15_HWC_nonsquare( const q15_t *Im_in,
+                                         const uint16_t dim_im_in_x,
+                                         const uint16_t dim_im_in_y,
+                                         const uint16_t ch_im_in,
+                                         const uint16_t dim_kernel_x,
+                                         const uint16_t dim_kernel_y,
+                                         const uint16_t padding_x,
+                                         const uint16_t padding_y,
+                                         const uint16_t stride_x,
+                                         const uint16_t stride_y,
+                                         const uint16_t dim_im_out_x,
+                                         const uint16_t dim_im_out_y,
+                                         q15_t *bufferA,
+                                         q15_t *Im_out );
+
+/**
+ * @brief Q15 average pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ */
+
+void      arm_avepool_q15_HWC_nonsquare( const q15_t *Im_in,
+                                         const uint16_t dim_im_in_x,
+                                         const uint16_t dim_im_in_y,
+                                         const uint16_t ch_im_in,
+                                         const uint16_t dim_kernel_x,
+                                         const uint16_t dim_kernel_y,
+                                         const uint16_t padding_x,
+                                         const uint16_t padding_y,
+                                         const uint16_t stride_x,
+                                         const uint16_t stride_y,
+                                         const uint16_t dim_im_out_x,
+                                         const uint16_t dim_im_out_y,
+                                         q15_t *bufferA,
+                                         q15_t *Im_out );
+
+/**
+ * @brief Q7 global average pooling function
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor, ch_im_in values
+ * @return none.
+ *
+ * bufferA size:  6*ch_im_in
+ */
+
+void      arm_global_avepool_q7_HWC( const q7_t *Im_in,
+                                     const uint16_t dim_im_in_x,
+                                     const uint16_t dim_im_in_y,
+                                     const uint16_t ch_im_in,
+                                     q7_t *bufferA,
+                                     q7_t *Im_out );
+
+/**
+ * @brief Q15 global average pooling function
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor, ch_im_in values
+ * @return none.
+ *
+ * bufferA size:  2*ch_im_in
+ */
+
+void      arm_global_avepool_q15_HWC( const q15_t *Im_in,
+                                      const uint16_t dim_im_in_x,
+                                      const uint16_t dim_im_in_y,
+                                      const uint16_t ch_im_in,
+                                      q15_t *bufferA,
+                                      q15_t *Im_out );
+
+/**
+ * @brief int8 max pooling function
+ * @param[in]       input       pointer to input tensor
+ * @param[in]       input_x     input tensor dimension x
+ * @param[in]       input_y     input tensor dimension y
+ * @param[in]       ch          number of input and output tensor channels
+ * @param[in]       kernel_x    filter kernel size x
+ * @param[in]       kernel_y    filter kernel size y
+ * @param[in]       pad_x       padding size x
+ * @param[in]       pad_y       padding size y
+ * @param[in]       stride_x    pooling stride x
+ * @param[in]       stride_y    pooling stride y
+ * @param[in]       act_min     minimum output value
+ * @param[in]       act_max     maximum output value
+ * @param[in,out]   output      pointer to output tensor
+ * @param[in]       output_x    output tensor dimension x
+ * @param[in]       output_y    output tensor dimension y
+ * @return none.
+ *
+ */
+
+void      arm_max_pool_s8( const q7_t *input,
+                           const uint16_t input_x,
+                           const uint16_t input_y,
+                           const uint16_t ch,
+                           const uint16_t kernel_x,
+                           const uint16_t kernel_y,
+                           const uint16_t pad_x,
+                           const uint16_t pad_y,
+                           const uint16_t stride_x,
+                           const uint16_t stride_y,
+                           const int32_t act_min,
+                           const int32_t act_max,
+                           q7_t *output,
+                           const uint16_t output_x,
+                           const uint16_t output_y );
+
+/**
+ * @brief int8 average pooling function
+ * @param[in]       input       pointer to input tensor
+ * @param[in]       input_x     input tensor dimension x
+ * @param[in]       input_y     input tensor dimension y
+ * @param[in]       ch          number of input and output tensor channels
+ * @param[in]       kernel_x    filter kernel size x
+ * @param[in]       kernel_y    filter kernel size y
+ * @param[in]       pad_x       padding size x
+ * @param[in]       pad_y       padding size y
+ * @param[in]       stride_x    pooling stride x
+ * @param[in]       stride_y    pooling stride y
+ * @param[in]       act_min     minimum output value
+ * @param[in]       act_max     maximum output value
+ * @param[in,out]   output      pointer to output tensor
+ * @param[in]       output_x    output tensor dimension x
+ * @param[in]       output_y    output tensor dimension y
+ * @param[in,out]   buffer_a    pointer to buffer space for the sums
+ * @return none.
+ *
+ * buffer_a size:  2*ch
+ */
+
+void      arm_avgpool_s8( const q7_t *input,
+                          const uint16_t input_x,
+                          const uint16_t input_y,
+                          const uint16_t ch,
+                          const uint16_t kernel_x,
+                          const uint16_t kernel_y,
+                          const uint16_t pad_x,
+                          const uint16_t pad_y,
+                          const uint16_t stride_x,
+                          const uint16_t stride_y,
+                          const int32_t act_min,
+                          const int32_t act_max,
+                          q7_t *output,
+                          const uint16_t output_x,
+                          const uint16_t output_y,
+                          q15_t *buffer_a );
+
 /**
  * @defgroup Softmax Softmax Functions
  *
@@ -1003,6 +1721,233 @@ void      arm_softmax_q7( const q7_t *vec_in, const uint16_t dim_vec, q7_t *p_ou
 
 void      arm_softmax_q15( const q15_t *vec_in, const uint16_t dim_vec, q15_t *p_out );
 
+/**
+ * @brief int8 softmax function
+ * @param[in]       input       pointer to input, num_rows * row_size values
+ * @param[in]       num_rows    number of rows
+ * @param[in]       row_size    number of elements in a row
+ * @param[in]       mult        input multiplier
+ * @param[in]       shift       input left shift
+ * @param[in]       diff_min    minimum difference with the row maximum that is not ignored
+ * @param[out]      output      pointer to output, scale 1/256 and zero point -128
+ * @return none.
+ *
+ */
+
+void      arm_softmax_s8( const q7_t *input,
+                          const int32_t num_rows,
+                          const int32_t row_size,
+                          const int32_t mult,
+                          const int32_t shift,
+                          const int32_t diff_min,
+                          q7_t *output );
+
+/**
+ * @defgroup RNN Recurrent Layer Functions
+ *
+ * Perform one time step of a recurrent layer, GRU or LSTM, with
+ * q7_t weights and q15_t activations and states
+ *
+ */
+
+/**
+ * @brief Mixed Q15-Q7 GRU cell function
+ * @param[in]       x               pointer to input vector
+ * @param[in]       dim_x           length of the input vector
+ * @param[in,out]   h               pointer to hidden state, Q0.15
+ * @param[in]       dim_h           length of the hidden state
+ * @param[in]       wt_x            pointer to input weights, reordered for the opt fully-connected function
+ * @param[in]       bias_x          pointer to input bias
+ * @param[in]       bias_shift_x    amount of left-shift for the input bias
+ * @param[in]       out_shift_x     amount of right-shift for the input part
+ * @param[in]       wt_h            pointer to recurrent weights, reordered for the opt fully-connected function
+ * @param[in]       bias_h          pointer to recurrent bias
+ * @param[in]       bias_shift_h    amount of left-shift for the recurrent bias
+ * @param[in]       out_shift_h     amount of right-shift for the recurrent part
+ * @param[in]       gate_int_width  integer bits of the gate pre-activations, up to 3
+ * @param[in,out]   bufferA         pointer to buffer space for the gates
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ */
+
+arm_status arm_gru_cell_q7_q15( const q15_t *x,
+                                const uint16_t dim_x,
+                                q15_t *h,
+                                const uint16_t dim_h,
+                                const q7_t *wt_x,
+                                const q7_t *bias_x,
+                                const uint16_t bias_shift_x,
+                                const uint16_t out_shift_x,
+                                const q7_t *wt_h,
+                                const q7_t *bias_h,
+                                const uint16_t bias_shift_h,
+                                const uint16_t out_shift_h,
+                                const uint16_t gate_int_width,
+                                q15_t *bufferA );
+
+/**
+ * @brief Mixed Q15-Q7 LSTM cell function
+ * @param[in]       x               pointer to input vector
+ * @param[in]       dim_x           length of the input vector
+ * @param[in,out]   h               pointer to hidden state, Q0.15
+ * @param[in,out]   c               pointer to cell state
+ * @param[in]       dim_h           length of the hidden and cell states
+ * @param[in]       wt              pointer to gate weights, reordered for the opt fully-connected function
+ * @param[in]       bias            pointer to gate bias
+ * @param[in]       bias_shift      amount of left-shift for bias
+ * @param[in]       out_shift       amount of right-shift for output
+ * @param[in]       gate_int_width  integer bits of the gate pre-activations, up to 3
+ * @param[in]       cell_int_width  integer bits of the cell state, up to 3
+ * @param[in,out]   bufferA         pointer to buffer space for the input and the gates
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ */
+
+arm_status arm_lstm_cell_q7_q15( const q15_t *x,
+                                 const uint16_t dim_x,
+                                 q15_t *h,
+                                 q15_t *c,
+                                 const uint16_t dim_h,
+                                 const q7_t *wt,
+                                 const q7_t *bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 const uint16_t gate_int_width,
+                                 const uint16_t cell_int_width,
+                                 q15_t *bufferA );
+
+/**
+ * @defgroup NNGraph Neural Network Graph Functions
+ *
+ * Run a network described as a list of q7 layers from a single
+ * statically planned memory arena.
+ *
+ */
+
+/**
+ * @brief Layer types of the graph executor
+ *
+ */
+typedef enum
+{
+    ARM_NN_LAYER_CONV = 0,
+    /**< Convolution, arm_convolve_HWC_q7_*() */
+    ARM_NN_LAYER_DEPTHWISE_CONV = 1,
+    /**< Depthwise separable convolution, arm_depthwise_separable_conv_HWC_q7_nonsquare() */
+    ARM_NN_LAYER_FULLY_CONNECTED = 2,
+    /**< Fully-connected layer, arm_fully_connected_q7() */
+    ARM_NN_LAYER_MAX_POOL = 3,
+    /**< Max pooling, arm_maxpool_q7_HWC() */
+    ARM_NN_LAYER_AVE_POOL = 4,
+    /**< Average pooling, arm_avepool_q7_HWC() */
+    ARM_NN_LAYER_RELU = 5,
+    /**< ReLU, arm_relu_q7(), in place */
+    ARM_NN_LAYER_SOFTMAX = 6,
+    /**< Softmax, arm_softmax_q7() */
+} arm_nn_layer_type;
+
+/**
+ * @brief Layer of the graph executor
+ *
+ * The dimensions follow the arguments of the layer function. A
+ * fully-connected layer takes in_x * in_y * in_ch inputs and gives
+ * out_ch outputs, with out_x = out_y = 1. Unused fields are 0.
+ */
+typedef struct
+{
+    arm_nn_layer_type type;     /**< layer type */
+    uint16_t  input;            /**< index of the input tensor */
+    uint16_t  output;           /**< index of the output tensor */
+    uint16_t  in_x;             /**< input dimension x */
+    uint16_t  in_y;             /**< input dimension y */
+    uint16_t  in_ch;            /**< number of input channels */
+    uint16_t  out_x;            /**< output dimension x */
+    uint16_t  out_y;            /**< output dimension y */
+    uint16_t  out_ch;           /**< number of output channels */
+    uint16_t  kernel_x;         /**< kernel size x */
+    uint16_t  kernel_y;         /**< kernel size y */
+    uint16_t  pad_x;            /**< padding size x */
+    uint16_t  pad_y;            /**< padding size y */
+    uint16_t  stride_x;         /**< stride x */
+    uint16_t  stride_y;         /**< stride y */
+    const q7_t *weights;        /**< weights, NULL for layers without */
+    const q7_t *bias;           /**< bias, NULL for layers without */
+    uint16_t  bias_shift;       /**< amount of left-shift for bias */
+    uint16_t  out_shift;        /**< amount of right-shift for output */
+} arm_nn_layer;
+
+/**
+ * @brief Tensor placement computed by arm_nn_graph_plan()
+ *
+ */
+typedef struct
+{
+    uint32_t  size;             /**< size in bytes, 0 for an unused tensor */
+    uint32_t  offset;           /**< byte offset in the arena */
+    int16_t   first;            /**< first layer the tensor is live in */
+    int16_t   last;             /**< last layer the tensor is live in */
+} arm_nn_tensor;
+
+/**
+ * @brief Graph executor instance
+ *
+ * tensors holds num_tensors activation tensors followed by one scratch
+ * buffer per layer, i.e. ARM_NN_GRAPH_NUM_TENSORS(num_tensors, num_layers)
+ * entries. cycles, when not NULL, receives the number of cycles of each
+ * layer as measured with get_cycles.
+ */
+typedef struct
+{
+    const arm_nn_layer *layers; /**< layers, in execution order */
+    uint16_t  num_layers;       /**< number of layers */
+    uint16_t  num_tensors;      /**< number of activation tensors */
+    uint16_t  input;            /**< index of the network input tensor */
+    uint16_t  output;           /**< index of the network output tensor */
+    arm_nn_tensor *tensors;     /**< tensor placement, see above */
+    q7_t     *arena;            /**< memory arena, word aligned */
+    uint32_t  arena_size;       /**< size of the arena in bytes */
+    uint32_t  peak_size;        /**< arena size needed by the plan, in bytes */
+    uint32_t  ( *get_cycles )( void ); /**< cycle counter, may be NULL */
+    uint32_t *cycles;           /**< cycles per layer, may be NULL */
+} arm_nn_graph;
+
+#define ARM_NN_GRAPH_NUM_TENSORS(num_tensors, num_layers) ((num_tensors) + (num_layers))
+
+/**
+ * @brief Plans the memory of a graph
+ * @param[in,out]   graph       pointer to the graph instance
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>,
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions of connected layers
+ * differ or a layer does not meet the constraints of its function, or
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> if the tensors are not connected
+ * properly.
+ *
+ */
+
+arm_status arm_nn_graph_plan( arm_nn_graph *graph );
+
+/**
+ * @brief Returns the location of a tensor in the arena
+ * @param[in]       graph       pointer to the graph instance
+ * @param[in]       tensor      index of the tensor
+ * @return     pointer to the tensor data
+ *
+ */
+
+q7_t     *arm_nn_graph_tensor( const arm_nn_graph *graph, const uint16_t tensor );
+
+/**
+ * @brief Runs the layers of a planned graph
+ * @param[in,out]   graph       pointer to the graph instance
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>, or
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the arena is smaller than the plan.
+ *
+ */
+
+arm_status arm_nn_graph_run( arm_nn_graph *graph );
+
 #ifdef __cplusplus
 }
 #endif
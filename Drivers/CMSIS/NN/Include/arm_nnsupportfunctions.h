@@ -93,6 +93,58 @@ void      arm_q7_to_q15_no_shift( const q7_t *pSrc, q15_t *pDst, uint32_t blockS
 
 void      arm_q7_to_q15_reordered_no_shift( const q7_t *pSrc, q15_t *pDst, uint32_t blockSize );
 
+/**
+ * @brief Converts the elements of the Q7 vector to Q15 vector with an added offset
+ * @param[in]       *pSrc   points to the Q7 input vector
+ * @param[out]      *pDst   points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       offset  offset added to each element, in the range [-255, 255]
+ * @return none.
+ *
+ * Used by the int8 asymmetric kernels to remove the input zero point
+ * while the data is expanded for the SIMD multiply-accumulate.
+ */
+
+void      arm_q7_to_q15_with_offset( const q7_t *pSrc, q15_t *pDst, uint32_t blockSize, q15_t offset );
+
+/**
+ * @brief Packs a q7 weight matrix for arm_fully_connected_q7_opt()
+ * @param[in]       *pSrc         points to the weight matrix, num_of_rows x dim_vec in row-major order
+ * @param[in]       num_of_rows   number of rows in weight matrix
+ * @param[in]       dim_vec       length of the vector, i.e. number of columns
+ * @param[out]      *pDst         points to the packed weights, num_of_rows * dim_vec values
+ * @return none.
+ *
+ */
+
+void      arm_nn_pack_weights_q7_x4( const q7_t *pSrc, const uint16_t num_of_rows, const uint16_t dim_vec, q7_t *pDst );
+
+/**
+ * @brief Packs a q7 weight matrix for arm_fully_connected_mat_q7_vec_q15_opt() and arm_fully_connected_s8_opt()
+ * @param[in]       *pSrc         points to the weight matrix, num_of_rows x dim_vec in row-major order
+ * @param[in]       num_of_rows   number of rows in weight matrix
+ * @param[in]       dim_vec       length of the vector, i.e. number of columns
+ * @param[out]      *pDst         points to the packed weights, num_of_rows * dim_vec values
+ * @return none.
+ *
+ */
+
+void      arm_nn_pack_weights_q7_q15_x4( const q7_t *pSrc, const uint16_t num_of_rows, const uint16_t dim_vec,
+        q7_t *pDst );
+
+/**
+ * @brief Packs a q15 weight matrix for arm_fully_connected_q15_opt()
+ * @param[in]       *pSrc         points to the weight matrix, num_of_rows x dim_vec in row-major order
+ * @param[in]       num_of_rows   number of rows in weight matrix
+ * @param[in]       dim_vec       length of the vector, i.e. number of columns
+ * @param[out]      *pDst         points to the packed weights, num_of_rows * dim_vec values
+ * @return none.
+ *
+ */
+
+void      arm_nn_pack_weights_q15_x4( const q15_t *pSrc, const uint16_t num_of_rows, const uint16_t dim_vec,
+                                      q15_t *pDst );
+
 #if defined (ARM_MATH_DSP)
 
 /**
@@ -186,6 +238,109 @@ void arm_nn_mult_q7(
     const uint16_t out_shift,
     uint32_t blockSize );
 
+/**
+ * @defgroup NNRequant Requantization Functions for Neural Network Computation
+ *
+ * Integer rescaling used by the int8 asymmetric kernels. A real scale factor
+ * is represented by a Q31 multiplier in [0.5, 1) and a power-of-two shift,
+ * where a positive shift is a left shift. The arithmetic is bit-exact with
+ * the TensorFlow Lite reference kernels.
+ *
+ */
+
+#define NN_Q31_MAX ((q31_t)(0x7FFFFFFFL))
+#define NN_Q31_MIN ((q31_t)(0x80000000L))
+#define NN_Q7_MAX  ((q7_t)(0x7F))
+#define NN_Q7_MIN  ((q7_t)(0x80))
+
+#ifndef MAX
+#define MAX(A,B) ((A) > (B) ? (A) : (B))
+#endif
+#ifndef MIN
+#define MIN(A,B) ((A) < (B) ? (A) : (B))
+#endif
+
+#define LEFT_SHIFT(_shift)  ((_shift) > 0 ? (_shift) : 0)
+#define RIGHT_SHIFT(_shift) ((_shift) > 0 ? 0 : -(_shift))
+
+/**
+ * @brief           Saturating doubling high multiply
+ * @param[in]       m1          first multiplicand
+ * @param[in]       m2          second multiplicand
+ * @return          the upper 32 bits of 2 * m1 * m2, rounded to the nearest
+ *
+ * The only overflow, m1 == m2 == NN_Q31_MIN, saturates to NN_Q31_MAX.
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_sat_doubling_high_mult( const q31_t m1, const q31_t m2 )
+{
+    q31_t     result;
+    /* Rounding offset for the right shift by 31 */
+    q63_t     mult = 1 << 30;
+
+    if( ( m1 < 0 ) ^ ( m2 < 0 ) )
+    {
+        mult = 1 - mult;
+    }
+
+    mult = mult + ( q63_t )m1 * m2;
+
+    /* Division rounds towards zero, which together with the offset above
+       rounds half away from zero. */
+    result = ( q31_t )( mult / ( 1LL << 31 ) );
+
+    if( ( m1 == m2 ) && ( m1 == NN_Q31_MIN ) )
+    {
+        result = NN_Q31_MAX;
+    }
+
+    return result;
+}
+
+/**
+ * @brief           Rounding divide by a power of two
+ * @param[in]       dividend    value to divide
+ * @param[in]       exponent    power of two, in the range [0, 31]
+ * @return          dividend / 2^exponent, rounded half away from zero
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_divide_by_power_of_two( const q31_t dividend, const q31_t exponent )
+{
+    const q31_t remainder_mask = ( q31_t )( ( 1UL << exponent ) - 1U );
+    const q31_t remainder = remainder_mask & dividend;
+    q31_t     result = dividend >> exponent;
+    q31_t     threshold = remainder_mask >> 1;
+
+    if( result < 0 )
+    {
+        threshold++;
+    }
+
+    if( remainder > threshold )
+    {
+        result++;
+    }
+
+    return result;
+}
+
+/**
+ * @brief           Requantize a 32-bit accumulator
+ * @param[in]       val         accumulator
+ * @param[in]       multiplier  Q31 multiplier
+ * @param[in]       shift       power-of-two shift, positive to the left
+ * @return          val * multiplier * 2^shift, rounded
+ *
+ * A left shift is applied before the multiplication and a right shift after
+ * it, as MultiplyByQuantizedMultiplier() does in TensorFlow Lite.
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_requantize( const q31_t val, const q31_t multiplier, const q31_t shift )
+{
+    return arm_nn_divide_by_power_of_two( arm_nn_sat_doubling_high_mult( val * ( 1 << LEFT_SHIFT( shift ) ), multiplier ),
+                                          RIGHT_SHIFT( shift ) );
+}
+
 /**
  * @brief defition to adding rouding offset
  */
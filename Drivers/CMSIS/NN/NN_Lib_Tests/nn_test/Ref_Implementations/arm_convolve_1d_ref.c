@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+void arm_convolve_1d_q7_ref( const q7_t *Im_in,
+                             const uint16_t dim_im_in,
+                             const uint16_t ch_im_in,
+                             const q7_t *wt,
+                             const uint16_t ch_im_out,
+                             const uint16_t dim_kernel,
+                             const uint16_t padding,
+                             const uint16_t stride,
+                             const uint16_t dilation,
+                             const q7_t *bias,
+                             const uint16_t bias_shift,
+                             const uint16_t out_shift,
+                             q7_t *Im_out,
+                             const uint16_t dim_im_out,
+                             q15_t *bufferA )
+{
+    int       i, j, k, l;
+    int       in_col;
+    int       conv_out;
+
+    for( i = 0; i < ch_im_out; i++ )
+    {
+        for( j = 0; j < dim_im_out; j++ )
+        {
+            conv_out = ( ( q31_t )bias[i] << bias_shift ) + NN_ROUND( out_shift );
+
+            for( k = 0; k < dim_kernel; k++ )
+            {
+                in_col = stride * j + k * dilation - padding;
+
+                if( in_col >= 0 && in_col < dim_im_in )
+                {
+                    for( l = 0; l < ch_im_in; l++ )
+                    {
+                        conv_out += Im_in[in_col * ch_im_in + l] * wt[( i * dim_kernel + k ) * ch_im_in + l];
+                    }
+                }
+            }
+
+            Im_out[i + j * ch_im_out] = ( q7_t ) __SSAT( ( conv_out >> out_shift ), 8 );
+        }
+    }
+}
+
+void arm_convolve_1d_q15_ref( const q15_t *Im_in,
+                              const uint16_t dim_im_in,
+                              const uint16_t ch_im_in,
+                              const q15_t *wt,
+                              const uint16_t ch_im_out,
+                              const uint16_t dim_kernel,
+                              const uint16_t padding,
+                              const uint16_t stride,
+                              const uint16_t dilation,
+                              const q15_t *bias,
+                              const uint16_t bias_shift,
+                              const uint16_t out_shift,
+                              q15_t *Im_out,
+                              const uint16_t dim_im_out,
+                              q15_t *bufferA )
+{
+    int       i, j, k, l;
+    int       in_col;
+    int       conv_out;
+
+    for( i = 0; i < ch_im_out; i++ )
+    {
+        for( j = 0; j < dim_im_out; j++ )
+        {
+            conv_out = ( ( q31_t )bias[i] << bias_shift ) + NN_ROUND( out_shift );
+
+            for( k = 0; k < dim_kernel; k++ )
+            {
+                in_col = stride * j + k * dilation - padding;
+
+                if( in_col >= 0 && in_col < dim_im_in )
+                {
+                    for( l = 0; l < ch_im_in; l++ )
+                    {
+                        conv_out += Im_in[in_col * ch_im_in + l] * wt[( i * dim_kernel + k ) * ch_im_in + l];
+                    }
+                }
+            }
+
+            Im_out[i + j * ch_im_out] = ( q15_t ) __SSAT( ( conv_out >> out_shift ), 16 );
+        }
+    }
+}
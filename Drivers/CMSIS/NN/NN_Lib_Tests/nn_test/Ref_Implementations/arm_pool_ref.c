@@ -98,3 +98,185 @@ void arm_maxpool_q7_HWC_ref( const q7_t *Im_in, // input image
         }
     }
 }
+
+void arm_maxpool_q7_HWC_nonsquare_ref( const q7_t *Im_in,
+                                       const uint16_t dim_im_in_x,
+                                       const uint16_t dim_im_in_y,
+                                       const uint16_t ch_im_in,
+                                       const uint16_t dim_kernel_x,
+                                       const uint16_t dim_kernel_y,
+                                       const uint16_t padding_x,
+                                       const uint16_t padding_y,
+                                       const uint16_t stride_x,
+                                       const uint16_t stride_y,
+                                       const uint16_t dim_im_out_x,
+                                       const uint16_t dim_im_out_y,
+                                       q7_t *bufferA,
+                                       q7_t *Im_out )
+{
+    int16_t   i_ch_in, i_x, i_y;
+    int16_t   k_x, k_y;
+
+    for( i_ch_in = 0; i_ch_in < ch_im_in; i_ch_in++ )
+    {
+        for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+        {
+            for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+            {
+                int       max = -129;
+
+                for( k_y = i_y * stride_y - padding_y; k_y < i_y * stride_y - padding_y + dim_kernel_y; k_y++ )
+                {
+                    for( k_x = i_x * stride_x - padding_x; k_x < i_x * stride_x - padding_x + dim_kernel_x; k_x++ )
+                    {
+                        if( k_y >= 0 && k_x >= 0 && k_y < dim_im_in_y && k_x < dim_im_in_x )
+                        {
+                            if( Im_in[i_ch_in + ch_im_in * ( k_x + k_y * dim_im_in_x )] > max )
+                            {
+                                max = Im_in[i_ch_in + ch_im_in * ( k_x + k_y * dim_im_in_x )];
+                            }
+                        }
+                    }
+                }
+
+                Im_out[i_ch_in + ch_im_in * ( i_x + i_y * dim_im_out_x )] = max;
+            }
+        }
+    }
+}
+
+void arm_avepool_q7_HWC_nonsquare_ref( const q7_t *Im_in,
+                                       const uint16_t dim_im_in_x,
+                                       const uint16_t dim_im_in_y,
+                                       const uint16_t ch_im_in,
+                                       const uint16_t dim_kernel_x,
+                                       const uint16_t dim_kernel_y,
+                                       const uint16_t padding_x,
+                                       const uint16_t padding_y,
+                                       const uint16_t stride_x,
+                                       const uint16_t stride_y,
+                                       const uint16_t dim_im_out_x,
+                                       const uint16_t dim_im_out_y,
+                                       q7_t *bufferA,
+                                       q7_t *Im_out )
+{
+    int16_t   i_ch_in, i_x, i_y;
+    int16_t   k_x, k_y;
+
+    for( i_ch_in = 0; i_ch_in < ch_im_in; i_ch_in++ )
+    {
+        for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+        {
+            for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+            {
+                int       sum = 0;
+                int       count = 0;
+
+                for( k_y = i_y * stride_y - padding_y; k_y < i_y * stride_y - padding_y + dim_kernel_y; k_y++ )
+                {
+                    for( k_x = i_x * stride_x - padding_x; k_x < i_x * stride_x - padding_x + dim_kernel_x; k_x++ )
+                    {
+                        if( k_y >= 0 && k_x >= 0 && k_y < dim_im_in_y && k_x < dim_im_in_x )
+                        {
+                            sum += Im_in[i_ch_in + ch_im_in * ( k_x + k_y * dim_im_in_x )];
+                            count++;
+                        }
+                    }
+                }
+
+                Im_out[i_ch_in + ch_im_in * ( i_x + i_y * dim_im_out_x )] = sum / count;
+            }
+        }
+    }
+}
+
+void arm_maxpool_q15_HWC_nonsquare_ref( const q15_t *Im_in,
+                                        const uint16_t dim_im_in_x,
+                                        const uint16_t dim_im_in_y,
+                                        const uint16_t ch_im_in,
+                                        const uint16_t dim_kernel_x,
+                                        const uint16_t dim_kernel_y,
+                                        const uint16_t padding_x,
+                                        const uint16_t padding_y,
+                                        const uint16_t stride_x,
+                                        const uint16_t stride_y,
+                                        const uint16_t dim_im_out_x,
+                                        const uint16_t dim_im_out_y,
+                                        q15_t *bufferA,
+                                        q15_t *Im_out )
+{
+    int16_t   i_ch_in, i_x, i_y;
+    int16_t   k_x, k_y;
+
+    for( i_ch_in = 0; i_ch_in < ch_im_in; i_ch_in++ )
+    {
+        for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+        {
+            for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+            {
+                int       max = -32769;
+
+                for( k_y = i_y * stride_y - padding_y; k_y < i_y * stride_y - padding_y + dim_kernel_y; k_y++ )
+                {
+                    for( k_x = i_x * stride_x - padding_x; k_x < i_x * stride_x - padding_x + dim_kernel_x; k_x++ )
+                    {
+                        if( k_y >= 0 && k_x >= 0 && k_y < dim_im_in_y && k_x < dim_im_in_x )
+                        {
+                            if( Im_in[i_ch_in + ch_im_in * ( k_x + k_y * dim_im_in_x )] > max )
+                            {
+                                max = Im_in[i_ch_in + ch_im_in * ( k_x + k_y * dim_im_in_x )];
+                            }
+                        }
+                    }
+                }
+
+                Im_out[i_ch_in + ch_im_in * ( i_x + i_y * dim_im_out_x )] = max;
+            }
+        }
+    }
+}
+
+void arm_avepool_q15_HWC_nonsquare_ref( const q15_t *Im_in,
+                                        const uint16_t dim_im_in_x,
+                                        const uint16_t dim_im_in_y,
+                                        const uint16_t ch_im_in,
+                                        const uint16_t dim_kernel_x,
+                                        const uint16_t dim_kernel_y,
+                                        const uint16_t padding_x,
+                                        const uint16_t padding_y,
+                                        const uint16_t stride_x,
+                                        const uint16_t stride_y,
+                                        const uint16_t dim_im_out_x,
+                                        const uint16_t dim_im_out_y,
+                                        q15_t *bufferA,
+                                        q15_t *Im_out )
+{
+    int16_t   i_ch_in, i_x, i_y;
+    int16_t   k_x, k_y;
+
+    for( i_ch_in = 0; i_ch_in < ch_im_in; i_ch_in++ )
+    {
+        for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+        {
+            for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+            {
+                int       sum = 0;
+                int       count = 0;
+
+                for( k_y = i_y * stride_y - padding_y; k_y < i_y * stride_y - padding_y + dim_kernel_y; k_y++ )
+                {
+                    for( k_x = i_x * stride_x - padding_x; k_x < i_x * stride_x - padding_x + dim_kernel_x; k_x++ )
+                    {
+                        if( k_y >= 0 && k_x >= 0 && k_y < dim_im_in_y && k_x < dim_im_in_x )
+                        {
+                            sum += Im_in[i_ch_in + ch_im_in * ( k_x + k_y * dim_im_in_x )];
+                            count++;
+                        }
+                    }
+                }
+
+                Im_out[i_ch_in + ch_im_in * ( i_x + i_y * dim_im_out_x )] = sum / count;
+            }
+        }
+    }
+}
@@ -23,6 +23,8 @@
 #include "arm_nnfunctions.h"
 //#include "arm_nnsupportfunctions.h"
 #include "fully_connected_testing_weights.h"
+#include "s8_golden_vectors.h"
+#include "rnn_golden_vectors.h"
 
 #ifdef __cplusplus
 extern    "C"
@@ -143,6 +145,38 @@ void      arm_depthwise_separable_conv_HWC_q7_ref_nonsquare( const q7_t *Im_in,
         q7_t *bufferB   //buffer space for output
                                                            );
 
+void      arm_convolve_1d_q7_ref( const q7_t *Im_in,
+                                  const uint16_t dim_im_in,
+                                  const uint16_t ch_im_in,
+                                  const q7_t *wt,
+                                  const uint16_t ch_im_out,
+                                  const uint16_t dim_kernel,
+                                  const uint16_t padding,
+                                  const uint16_t stride,
+                                  const uint16_t dilation,
+                                  const q7_t *bias,
+                                  const uint16_t bias_shift,
+                                  const uint16_t out_shift,
+                                  q7_t *Im_out,
+                                  const uint16_t dim_im_out,
+                                  q15_t *bufferA );
+
+void      arm_convolve_1d_q15_ref( const q15_t *Im_in,
+                                   const uint16_t dim_im_in,
+                                   const uint16_t ch_im_in,
+                                   const q15_t *wt,
+                                   const uint16_t ch_im_out,
+                                   const uint16_t dim_kernel,
+                                   const uint16_t padding,
+                                   const uint16_t stride,
+                                   const uint16_t dilation,
+                                   const q15_t *bias,
+                                   const uint16_t bias_shift,
+                                   const uint16_t out_shift,
+                                   q15_t *Im_out,
+                                   const uint16_t dim_im_out,
+                                   q15_t *bufferA );
+
 /*
  *
  * Fully-connected reference implemenation
@@ -229,6 +263,66 @@ void      arm_maxpool_q7_HWC_ref( const q7_t *Im_in,    // input image
                                   q7_t *bufferA,     // a buffer for local storage
                                   q7_t *Im_out );
 
+void      arm_avepool_q7_HWC_nonsquare_ref( const q7_t *Im_in,
+                                            const uint16_t dim_im_in_x,
+                                            const uint16_t dim_im_in_y,
+                                            const uint16_t ch_im_in,
+                                            const uint16_t dim_kernel_x,
+                                            const uint16_t dim_kernel_y,
+                                            const uint16_t padding_x,
+                                            const uint16_t padding_y,
+                                            const uint16_t stride_x,
+                                            const uint16_t stride_y,
+                                            const uint16_t dim_im_out_x,
+                                            const uint16_t dim_im_out_y,
+                                            q7_t *bufferA,
+                                            q7_t *Im_out );
+
+void      arm_maxpool_q7_HWC_nonsquare_ref( const q7_t *Im_in,
+                                            const uint16_t dim_im_in_x,
+                                            const uint16_t dim_im_in_y,
+                                            const uint16_t ch_im_in,
+                                            const uint16_t dim_kernel_x,
+                                            const uint16_t dim_kernel_y,
+                                            const uint16_t padding_x,
+                                            const uint16_t padding_y,
+                                            const uint16_t stride_x,
+                                            const uint16_t stride_y,
+                                            const uint16_t dim_im_out_x,
+                                            const uint16_t dim_im_out_y,
+                                            q7_t *bufferA,
+                                            q7_t *Im_out );
+
+void      arm_avepool_q15_HWC_nonsquare_ref( const q15_t *Im_in,
+                                             const uint16_t dim_im_in_x,
+                                             const uint16_t dim_im_in_y,
+                                             const uint16_t ch_im_in,
+                                             const uint16_t dim_kernel_x,
+                                             const uint16_t dim_kernel_y,
+                                             const uint16_t padding_x,
+                                             const uint16_t padding_y,
+                                             const uint16_t stride_x,
+                                             const uint16_t stride_y,
+                                             const uint16_t dim_im_out_x,
+                                             const uint16_t dim_im_out_y,
+                                             q15_t *bufferA,
+                                             q15_t *Im_out );
+
+void      arm_maxpool_q15_HWC_nonsquare_ref( const q15_t *Im_in,
+                                             const uint16_t dim_im_in_x,
+                                             const uint16_t dim_im_in_y,
+                                             const uint16_t ch_im_in,
+                                             const uint16_t dim_kernel_x,
+                                             const uint16_t dim_kernel_y,
+                                             const uint16_t padding_x,
+                                             const uint16_t padding_y,
+                                             const uint16_t stride_x,
+                                             const uint16_t stride_y,
+                                             const uint16_t dim_im_out_x,
+                                             const uint16_t dim_im_out_y,
+                                             q15_t *bufferA,
+                                             q15_t *Im_out );
+
 /*
  *
  * Other reference implemenation
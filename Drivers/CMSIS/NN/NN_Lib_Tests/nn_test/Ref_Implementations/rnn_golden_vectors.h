@@ -0,0 +1,32 @@
+/* Generated by Scripts/NNFunctions/rnn_golden_vector_generation.py, do not edit. */
+
+#define RNN_GRU_DIM_X 5
+#define RNN_GRU_DIM_H 7
+#define RNN_GRU_SEQ_LEN 8
+#define RNN_GRU_BIAS_SHIFT_X 13
+#define RNN_GRU_OUT_SHIFT_X 7
+#define RNN_GRU_BIAS_SHIFT_H 15
+#define RNN_GRU_OUT_SHIFT_H 9
+#define RNN_GRU_GATE_INT_WIDTH 2
+#define RNN_GRU_WT_X {55,7,-46,-59,12,-40,54,46,43,-43,56,-68,-48,61,6,-60,0,-35,65,14,66,58,16,-62,9,10,29,-72,49,62,58,-2,44,7,19,33,0,49,65,62,-62,75,-68,-4,-46,-46,38,74,32,2,-6,57,69,-56,11,-59,-42,-11,50,-15,-46,-59,61,14,1,-14,-65,-15,-19,19,31,-41,71,65,-22,15,-45,-54,29,-8,47,-73,-37,63,35,-16,69,39,-18,-70,52,62,76,-19,-70,49,-28,8,42,45,-60,-8,-53,-61,-46}
+#define RNN_GRU_BIAS_X {40,60,-46,-12,35,4,-35,58,9,-45,-8,-55,59,33,8,14,-3,-27,-8,-40,-34}
+#define RNN_GRU_WT_H {-51,-51,73,18,12,-71,38,76,59,17,49,18,-68,-27,-50,43,60,-34,-69,-24,28,75,-28,29,33,9,43,51,-45,-54,-57,-37,-43,-63,35,25,33,-29,23,-8,2,16,19,37,13,-37,-22,6,-68,-35,-72,73,-16,48,11,-57,-18,-17,15,53,-56,62,12,68,-15,-48,-50,8,21,-60,-8,71,37,19,-53,60,20,69,-71,38,70,70,-21,57,1,25,70,-47,54,31,52,66,24,40,-10,76,-52,-52,-76,-53,-74,-62,59,-55,43,31,53,57,34,-27,18,-62,71,37,-41,-31,6,61,-24,-18,-15,-72,-74,12,-52,73,55,37,74,-9,43,22,-74,-30,48,-62,-44,-55,-71,71,-35,18,-76,49,66,72,45}
+#define RNN_GRU_BIAS_H {-7,38,-26,-59,-11,49,35,-14,61,-30,1,4,0,-37,-45,-31,44,19,19,-55,-51}
+#define RNN_GRU_INPUT {223,-15561,-6048,-5569,-5842,-3522,-16039,11906,-12682,-15711,-11987,12661,-3145,11280,-5766,5588,5010,16116,2584,-2016,-6356,13075,-11205,756,-16065,-9756,2029,-1707,-29,-6131,-6245,166,7362,6262,12258,2551,-320,3611,-11816,-11016}
+#define RNN_GRU_H_INIT {-16051,-8385,-13700,-5365,-4471,-15233,750}
+#define RNN_GRU_OUTPUT {-8647,-9403,7264,-20518,-23060,-25379,8216,11651,-8868,6,-26898,-9119,-29021,8443,-22652,-7614,2031,-9165,-17875,-23667,-789,-13655,-157,-1927,-12640,25408,-22259,-13415,-29552,-5379,5140,9393,13638,-19819,-890,-27620,-7300,-9263,11207,-4137,-18367,3368,-22555,-3451,-16548,10662,11480,-7766,-13671,-11849,-2248,-9857,-9564,16835,-21129,-4374}
+
+#define RNN_LSTM_DIM_X 5
+#define RNN_LSTM_DIM_H 6
+#define RNN_LSTM_SEQ_LEN 8
+#define RNN_LSTM_BIAS_SHIFT 15
+#define RNN_LSTM_OUT_SHIFT 10
+#define RNN_LSTM_GATE_INT_WIDTH 3
+#define RNN_LSTM_CELL_INT_WIDTH 2
+#define RNN_LSTM_WT {22,75,-65,63,-4,15,39,64,17,56,-52,-6,49,16,5,28,-8,-6,-9,-27,22,48,-7,-74,24,-28,-63,-60,52,-42,-3,-59,-72,10,42,39,31,-46,-19,-6,-43,1,43,-32,59,-58,-32,-26,46,65,4,-18,-46,19,-2,27,-45,-16,-68,33,21,73,-65,24,-18,-52,-4,46,64,75,39,-68,9,-49,-6,-45,45,71,-47,72,5,47,66,41,30,68,30,58,-43,-63,-69,27,-2,8,-26,70,-35,2,-67,-50,39,16,28,39,75,9,52,44,16,-13,-67,-36,-75,-29,13,-4,49,58,33,51,54,73,-7,16,-59,31,-30,-53,-76,-9,-45,-54,73,47,-14,8,13,67,-67,37,-40,-77,-25,-1,62,-76,-10,-4,-30,-77,41,14,-51,0,11,45,67,48,71,45,48,44,-56,-8,-26,-32,47,10,50,18,35,46,-32,-5,16,54,-43,6,-33,28,35,39,68,52,16,-39,-63,42,-48,25,-21,56,-61,26,73,-46,-9,-53,-13,77,37,52,-62,-63,-58,18,-49,-46,-9,-26,-5,-24,2,-52,-64,20,-65,-51,40,-70,-38,50,29,-70,9,-57,-23,-1,20,0,-39,-26,-69,53,68,-42,74,-16,55,70,-4,-17,-42,-46,64,-3,-40,-27,66,-18,72,-56,-64,36,-45,77,-17,-13,35,35,52,32,4,-68}
+#define RNN_LSTM_BIAS {45,-42,30,-46,-6,13,-39,-60,15,-59,42,15,26,-11,6,55,-54,-15,7,-56,33,-11,-58,5}
+#define RNN_LSTM_INPUT {15215,-10911,9184,15017,2343,2451,8670,10631,-6727,15662,-1517,-12902,-9381,5610,-15976,-3267,-12345,-5227,6098,15277,16059,4098,8369,-15493,-12356,11145,217,9960,-1746,7194,-2632,-15883,-9669,-3280,5995,12626,4173,6282,2824,14492}
+#define RNN_LSTM_H_INIT {1270,-8052,10298,-16281,-11818,2645}
+#define RNN_LSTM_C_INIT {-1351,5276,-7302,518,-2991,6363}
+#define RNN_LSTM_OUTPUT {2086,3478,-8214,1121,-7948,4218,-647,-2236,-5877,3133,-4721,3140,1334,-220,567,3741,-5454,441,637,-1196,-53,3269,-7080,-11,5404,179,2966,4382,-3510,-2281,4697,-1572,3319,4404,-4809,-3080,4506,-695,2535,3908,-5340,-3159,4207,-2366,264,4506,-6072,-2232}
+#define RNN_LSTM_CELL {1047,2002,-4046,625,-5163,2756,-282,-1507,-2073,1808,-4762,1531,622,-142,306,1786,-3395,227,335,-986,-22,1712,-4552,-6,2331,106,1412,2146,-3231,-1114,2405,-956,1438,2198,-3832,-1647,2438,-569,1154,1869,-3410,-1713,2016,-1442,110,2453,-4743,-1269}
@@ -0,0 +1,109 @@
+/* Generated by Scripts/NNFunctions/s8_golden_vector_generation.py, do not edit. */
+
+#define S8_CONV1_INPUT_X 7
+#define S8_CONV1_INPUT_Y 5
+#define S8_CONV1_INPUT_CH 3
+#define S8_CONV1_OUTPUT_CH 5
+#define S8_CONV1_KERNEL_X 3
+#define S8_CONV1_KERNEL_Y 3
+#define S8_CONV1_PAD_X 1
+#define S8_CONV1_PAD_Y 1
+#define S8_CONV1_STRIDE_X 1
+#define S8_CONV1_STRIDE_Y 1
+#define S8_CONV1_OUTPUT_X 7
+#define S8_CONV1_OUTPUT_Y 5
+#define S8_CONV1_INPUT_OFFSET 64
+#define S8_CONV1_OUTPUT_OFFSET -32
+#define S8_CONV1_ACT_MIN -128
+#define S8_CONV1_ACT_MAX 127
+#define S8_CONV1_INPUT {111,36,80,41,127,-28,120,-18,52,46,-110,114,-98,27,26,113,-113,-110,103,-104,-58,98,-40,-3,79,125,-42,-87,99,107,100,102,-117,62,0,51,-55,93,70,109,-88,55,22,-89,-75,-90,-62,69,47,125,123,-72,53,69,116,-28,64,-105,-115,-21,75,-119,-30,-79,81,2,125,89,23,0,91,-71,113,-23,-39,123,26,20,-90,-62,-94,-37,-20,52,-42,-13,-101,96,60,-17,24,85,-11,4,-32,24,69,0,21,-121,18,-42,17,90,-26}
+#define S8_CONV1_KERNEL {-25,-78,-91,12,94,27,38,-94,39,-66,-58,34,-72,-47,99,-50,-103,20,97,-58,72,-76,117,52,-20,81,127,-89,-23,-41,123,-30,96,65,-63,-122,-85,27,37,3,-127,60,-42,59,0,-22,-44,49,36,-101,-88,52,55,-75,39,-9,52,59,71,35,-17,-104,-30,106,-65,106,49,-109,60,41,28,-77,15,-6,-82,127,-14,-11,-29,-29,-73,88,12,30,-120,46,-41,-102,81,77,102,111,-3,41,-45,50,127,-27,108,-36,38,-91,19,-106,70,-58,26,84,-76,-44,77,-43,10,-36,-43,-86,-77,-102,31,3,-7,125,-57,118,77,-30,91,-13,-21,-36,-110,111,-12,-127,-14}
+#define S8_CONV1_BIAS {602,1561,4057,-813,3200}
+#define S8_CONV1_OUTPUT_MULT {2122448123,2112585117,2139676626,2081228692,2091985323}
+#define S8_CONV1_OUTPUT_SHIFT {-9,-9,-9,-9,-9}
+#define S8_CONV1_OUTPUT {-66,5,18,14,-23,26,-128,-5,69,-35,7,-85,-45,84,-51,2,-9,42,3,-128,46,-119,57,56,-14,31,-77,-38,-3,18,-85,-57,52,22,-65,-74,18,16,15,-44,4,-128,-27,76,-73,20,-100,9,27,-82,-52,-116,-90,39,-3,-90,-53,45,69,-7,-18,-18,-22,-36,52,-61,51,72,23,-80,33,-1,-93,-60,-128,-28,-100,35,98,-128,4,-49,-33,-48,-89,-67,-64,43,96,-49,-16,-66,43,36,-128,66,-81,59,59,-87,-58,13,55,-57,-47,-41,-50,-58,0,-18,-70,-88,-42,55,-101,-30,-128,24,68,-20,-96,-101,-3,111,-28,-42,-37,90,-22,-74,-1,-83,-23,23,-95,-8,-9,-7,-90,-64,-62,-59,-44,13,-12,-122,-13,-13,-9,-15,-98,-107,13,70,-60,-82,-13,-3,37,-83,-54,1,67,-23,-73,-118,-128,1,80,-35,-28,-15,-50,-48,11}
+
+#define S8_CONV2_INPUT_X 9
+#define S8_CONV2_INPUT_Y 6
+#define S8_CONV2_INPUT_CH 4
+#define S8_CONV2_OUTPUT_CH 6
+#define S8_CONV2_KERNEL_X 2
+#define S8_CONV2_KERNEL_Y 3
+#define S8_CONV2_PAD_X 0
+#define S8_CONV2_PAD_Y 1
+#define S8_CONV2_STRIDE_X 2
+#define S8_CONV2_STRIDE_Y 2
+#define S8_CONV2_OUTPUT_X 4
+#define S8_CONV2_OUTPUT_Y 3
+#define S8_CONV2_INPUT_OFFSET 64
+#define S8_CONV2_OUTPUT_OFFSET -32
+#define S8_CONV2_ACT_MIN -128
+#define S8_CONV2_ACT_MAX 127
+#define S8_CONV2_INPUT {-62,-31,-31,99,37,105,125,11,-127,-22,102,101,15,-96,6,-126,65,18,-115,-76,33,102,-66,-76,-39,-90,32,79,84,12,-93,118,58,116,-96,-88,-92,95,-101,-112,-7,69,108,-21,90,43,-88,-50,113,-50,77,-97,7,76,-91,23,-26,126,-93,48,-45,-61,70,26,-90,-48,49,119,-45,34,-95,15,105,-29,-67,0,-89,-94,-117,-58,-77,-124,1,-40,51,-16,41,-114,22,59,-105,103,8,103,-44,23,-64,113,95,-100,-72,50,68,-86,-24,-6,85,84,79,40,65,-117,46,-56,85,47,86,-89,-33,13,-53,2,-67,24,60,-91,-122,18,-87,88,59,69,112,122,-62,-64,-74,-43,-38,84,65,-81,-5,112,41,0,62,55,124,81,56,-46,-27,-24,67,110,30,-85,-10,-107,-111,7,93,-126,98,-29,-22,65,8,-29,-125,-112,113,108,-56,-114,46,-111,-103,-63,-36,-77,2,83,25,61,-60,-127,-42,-48,120,48,86,-107,-123,-47,-98,-82,44,-55,22,123,58,2,51,-110,-16,-24,89,33,77,45,2,-114,-41,41}
+#define S8_CONV2_KERNEL {-92,-2,-124,88,-84,-31,3,88,63,-9,-64,79,-115,-111,40,-120,-115,41,-127,74,117,-7,108,-102,23,27,-119,112,52,-110,-53,-108,-117,35,-97,-55,127,16,-61,-125,-66,78,-20,-15,-111,21,89,43,-108,-85,-11,111,53,-122,127,-73,67,65,78,32,58,-46,-64,91,-2,-3,-27,-80,69,9,-39,118,90,-100,-32,-64,-58,-127,-20,119,5,32,50,48,-105,72,93,12,-89,-104,-19,-109,59,-17,-125,-124,-119,-113,5,30,-61,-20,95,-127,-83,81,-14,103,-43,-49,91,6,6,24,95,97,-54,5,13,-80,2,111,-102,-24,90,28,-117,-93,-99,-110,-127,114,114,85,47,-116,-87,5,31,-126,-24,-108,21,-125}
+#define S8_CONV2_BIAS {-3790,1157,-1664,3683,4,-2981}
+#define S8_CONV2_OUTPUT_MULT {2100401457,1080024587,2140313697,2096228158,2035692841,2130860095}
+#define S8_CONV2_OUTPUT_SHIFT {-9,-8,-9,-9,-9,-9}
+#define S8_CONV2_OUTPUT {-21,-5,-14,-31,-3,15,23,-55,-7,-57,14,-34,-82,5,1,-100,-65,-122,-128,-41,43,-125,-18,-86,-35,-114,12,-128,-70,-95,-128,-7,-29,-108,-70,-24,-73,-50,-70,-128,-102,-75,-110,-94,14,-52,-33,-128,-127,-128,-48,0,-55,-90,-53,-123,-35,7,-13,-64,-110,-60,5,-55,-62,-128,-95,-9,-100,-86,-128,-43}
+
+#define S8_DW_INPUT_X 6
+#define S8_DW_INPUT_Y 6
+#define S8_DW_INPUT_CH 3
+#define S8_DW_OUTPUT_CH 6
+#define S8_DW_KERNEL_X 3
+#define S8_DW_KERNEL_Y 3
+#define S8_DW_PAD_X 1
+#define S8_DW_PAD_Y 1
+#define S8_DW_STRIDE_X 2
+#define S8_DW_STRIDE_Y 2
+#define S8_DW_OUTPUT_X 3
+#define S8_DW_OUTPUT_Y 3
+#define S8_DW_INPUT_OFFSET 1
+#define S8_DW_OUTPUT_OFFSET 18
+#define S8_DW_ACT_MIN -100
+#define S8_DW_ACT_MAX 100
+#define S8_DW_CH_MULT 2
+#define S8_DW_INPUT {15,-37,29,-4,118,64,106,108,124,33,-38,33,24,-123,-1,17,86,31,-118,78,-74,-25,32,121,-119,-23,-12,-37,6,-62,-70,-48,-96,-127,-25,72,-8,-49,0,-108,-128,105,-83,-51,0,89,-24,-85,74,-110,54,34,-4,-18,-4,-124,77,-9,17,125,-12,73,84,33,121,-91,-43,-119,61,72,-26,-62,126,-123,81,7,9,70,-112,-52,91,100,96,-32,-52,69,69,109,-91,69,-95,32,9,-80,13,20,-55,97,-81,-84,-77,96,-82,-63,-20,8,39,51}
+#define S8_DW_KERNEL {86,119,-26,33,-16,116,-111,-9,-50,-106,127,127,-119,-22,-3,80,-120,81,85,-85,-7,100,94,116,9,-85,-64,25,-57,127,127,-62,91,-45,-6,-78,-40,53,-16,4,15,41,112,59,127,-21,63,127,23,-127,110,127,-118,65}
+#define S8_DW_BIAS {-3572,1341,-1751,-1548,3134,-112}
+#define S8_DW_OUTPUT_MULT {1183366153,1986001142,2120297911,1192540381,1980848107,1949735441}
+#define S8_DW_OUTPUT_SHIFT {-7,-8,-8,-7,-8,-8}
+#define S8_DW_OUTPUT {-57,5,100,-5,-47,8,-32,-30,-42,88,55,90,-14,37,39,-44,-16,-12,10,58,-90,27,-95,55,75,38,100,33,100,100,100,-75,-30,3,-46,-34,-36,-1,90,64,-15,100,21,38,55,-49,47,100,69,-44,-38,100,42,8}
+
+#define S8_FC_COLS 37
+#define S8_FC_ROWS 9
+#define S8_FC_INPUT_OFFSET -63
+#define S8_FC_OUTPUT_OFFSET -1
+#define S8_FC_OUTPUT_MULT 1078679026
+#define S8_FC_OUTPUT_SHIFT -9
+#define S8_FC_ACT_MIN -128
+#define S8_FC_ACT_MAX 127
+#define S8_FC_INPUT {-44,105,-124,5,-101,-63,-33,-23,68,-84,35,4,73,-86,-10,113,-25,32,124,-34,-93,-21,98,74,-40,64,107,78,43,-41,56,27,-126,-57,-40,-61,21}
+#define S8_FC_WEIGHTS {-22,-107,-28,27,-47,27,-51,30,-105,14,38,108,-33,124,-119,44,-30,50,15,-49,123,37,-31,-25,-23,-23,-80,23,65,-60,-72,-104,-46,25,119,-18,-92,-89,-91,-13,26,20,-1,-29,-51,-48,112,96,46,-112,16,110,-112,-68,100,71,-13,-40,-35,17,5,-72,-36,-53,-6,54,-21,-15,26,34,-72,14,33,-71,-77,69,-96,-114,-117,-96,-55,62,-59,102,-66,-108,-6,-95,25,-2,-4,-67,-118,49,-74,40,-109,-82,-114,-2,106,-26,-77,38,-99,110,-112,108,-69,29,-21,10,0,16,19,-95,-12,-69,-52,28,111,63,-113,50,-41,-72,-26,-28,-49,106,68,-14,42,-75,8,18,-13,-18,-57,28,94,116,39,-31,48,-116,-119,-1,12,-87,13,9,72,102,-11,96,-70,11,-111,-9,-110,-83,76,65,5,29,-55,-46,-62,-52,122,66,43,26,-14,93,-51,84,42,-64,-124,114,-49,-1,-32,-48,8,64,-12,-122,-52,11,-117,95,-69,17,123,-125,-85,93,-104,59,126,100,98,105,38,-112,-11,-12,-116,73,57,-68,-69,-45,15,-123,-112,-82,-78,-20,35,47,-37,1,-43,-62,-126,63,55,-116,-21,10,-34,-102,-24,31,-18,30,-54,-92,100,-2,53,71,112,80,-91,-115,-47,-124,-116,-28,52,-42,9,-62,-47,48,9,-46,112,6,37,18,-34,84,63,-48,93,-101,28,9,-86,-103,52,-65,44,-68,-30,98,-118,98,-50,126,19,-5,118,-25,-71,92,36,49,75,-105,-61,-11,101,98,-107,83,-115,83,107,-69,-79,-79,93,127,124,-83,39,0,-40,-16,-45,-48,-47,-103,-58,-2,118,-90,127,30,-94,-45,43,-99,109,101,52}
+#define S8_FC_BIAS {3210,-13300,-14194,1420,15670,-1734,16106,3742,-8084}
+#define S8_FC_OUTPUT {-16,-19,72,33,11,61,72,-57,-41}
+
+#define S8_POOL_INPUT_X 7
+#define S8_POOL_INPUT_Y 7
+#define S8_POOL_CH 5
+#define S8_POOL_KERNEL_X 3
+#define S8_POOL_KERNEL_Y 3
+#define S8_POOL_PAD_X 1
+#define S8_POOL_PAD_Y 1
+#define S8_POOL_STRIDE_X 2
+#define S8_POOL_STRIDE_Y 2
+#define S8_POOL_OUTPUT_X 4
+#define S8_POOL_OUTPUT_Y 4
+#define S8_POOL_ACT_MIN -90
+#define S8_POOL_ACT_MAX 110
+#define S8_POOL_INPUT {34,-4,-31,48,-100,49,52,107,-14,126,-107,89,-3,7,112,-68,-69,33,22,-64,-69,93,-76,35,12,122,49,-21,99,-105,61,-74,92,33,8,-114,0,-10,45,71,72,25,98,-32,-53,-3,108,40,81,117,-88,111,116,32,84,-126,70,-73,39,11,91,114,-96,-26,105,-125,-69,44,-77,-120,1,58,118,58,-5,18,-89,118,-48,21,20,12,-107,118,93,-118,36,32,53,32,10,104,59,-69,-21,80,-60,-126,53,-14,-81,110,115,-58,-41,18,17,80,-122,-29,64,94,9,109,26,-79,-123,116,19,59,-53,-119,101,105,-128,-7,-60,73,-43,27,-90,36,75,-24,-9,58,87,106,108,-102,25,-74,-35,53,115,3,-24,-12,41,12,114,-99,-17,-20,55,-48,0,-79,-63,8,-108,41,-77,-57,19,65,-65,8,-112,5,96,14,-2,-104,-39,-73,29,31,66,46,-66,-19,-67,114,-28,124,-115,-37,44,-36,-58,-20,58,48,-24,64,-10,52,-44,53,-22,16,71,-125,-17,80,-81,86,-26,-67,97,-46,63,-79,-96,-17,8,-23,12,118,96,121,-112,118,-97,-100,52,7,-82,-67,32,46,-75,-86,-123,-123,-28,-110,-33,-48,22,-38,-88,-79,-92}
+#define S8_POOL_AVG_OUTPUT {10,18,41,12,11,-24,53,65,16,54,-23,61,-20,34,7,37,5,5,7,-28,10,18,69,2,5,-19,6,58,49,28,-33,26,18,13,10,-11,36,20,-4,-30,-5,4,1,44,24,0,-47,8,44,-6,-29,-20,31,-35,-7,31,1,57,-47,-38,-15,-7,1,28,10,-4,5,-29,42,-22,-35,9,1,-54,-38,-11,-33,-10,-66,-56}
+#define S8_POOL_MAX_OUTPUT {72,52,107,48,110,72,110,110,81,110,110,110,110,99,105,110,110,92,99,105,72,94,110,109,71,72,110,110,110,110,91,110,110,105,105,91,110,110,108,105,64,94,80,110,110,110,94,110,110,59,65,41,101,105,53,96,87,106,108,5,97,29,63,110,110,110,110,58,110,110,64,52,71,48,53,80,16,86,-26,-17}
+
+#define S8_SOFTMAX_ROWS 3
+#define S8_SOFTMAX_COLS 10
+#define S8_SOFTMAX_MULT 1288490189
+#define S8_SOFTMAX_SHIFT 24
+#define S8_SOFTMAX_DIFF_MIN -124
+#define S8_SOFTMAX_INPUT {127,-83,57,-94,-94,-119,-88,-79,61,2,96,12,61,14,44,-112,-33,-27,42,-82,-25,79,-97,-94,76,60,-27,-57,-113,54}
+#define S8_SOFTMAX_OUTPUT {127,-128,-128,-128,-128,-128,-128,-128,-128,-128,126,-128,-127,-128,-128,-128,-128,-128,-128,-128,-128,21,-128,-128,-33,-119,-128,-128,-128,-124}
@@ -45,12 +45,38 @@
 #define TEST_IP
 #define TEST_CONV
 #define TEST_NONSQUARE
+#define TEST_CONV1D
 #define TEST_NNMULT
+#define TEST_S8
+#define TEST_RNN
+#define TEST_GRAPH
 
 int test_index = 0;
-q7_t test_flags[50];
+q7_t test_flags[200];
 bool test_pass;
 
+#ifdef TEST_GRAPH
+static uint32_t graph_ticks = 0;
+
+// stands in for a cycle counter such as DWT->CYCCNT
+static uint32_t graph_get_cycles( void )
+{
+    return graph_ticks++;
+}
+#endif
+
+#ifdef TEST_CONV1D
+// DWT cycle counter of Cortex-M3 and above, 0 on Cortex-M0 and on the host
+static uint32_t conv1d_get_cycles( void )
+{
+#if defined (__arm__) && defined (DWT)
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+#endif
+
 int main()
 {
     printf( "start tests\n" );
@@ -63,7 +89,7 @@ int main()
     q7_t     *test3;
     q15_t    *test4;
 
-    for( test_index = 0; test_index < 50; test_index++ )
+    for( test_index = 0; test_index < 200; test_index++ )
     {
         test_flags[test_index] = -1;
     }
@@ -301,6 +327,137 @@ int main()
     delete[]test2;
     delete[]test3;
 
+#define POOL_NSQ_IM_X 13
+#define POOL_NSQ_IM_Y 9
+#define POOL_NSQ_CH 7
+#define POOL_NSQ_KER_X 3
+#define POOL_NSQ_KER_Y 2
+#define POOL_NSQ_PAD_X 1
+#define POOL_NSQ_PAD_Y 0
+#define POOL_NSQ_STRIDE_X 2
+#define POOL_NSQ_STRIDE_Y 1
+#define POOL_NSQ_OUT_X 7
+#define POOL_NSQ_OUT_Y 8
+#define POOL_NSQ_OUT_SIZE (POOL_NSQ_OUT_X * POOL_NSQ_OUT_Y * POOL_NSQ_CH)
+
+// large enough for the global pooling, which adds more than 256 pixels
+#define POOL_GLOBAL_IM_X 24
+#define POOL_GLOBAL_IM_Y 20
+#define POOL_GLOBAL_CH 11
+
+    test1 = new q7_t[POOL_GLOBAL_IM_X * POOL_GLOBAL_IM_Y * POOL_GLOBAL_CH];
+    test2 = new q15_t[POOL_GLOBAL_IM_X * POOL_GLOBAL_IM_Y * POOL_GLOBAL_CH];
+    test3 = new q7_t[POOL_NSQ_OUT_SIZE * 2];
+    test4 = new q15_t[POOL_NSQ_OUT_SIZE * 2];
+
+    // word aligned buffer for the sums
+    q31_t     pool_sum_buf[2 * POOL_GLOBAL_CH];
+
+    for( int i = 0; i < POOL_GLOBAL_IM_X * POOL_GLOBAL_IM_Y * POOL_GLOBAL_CH; i++ )
+    {
+        test1[i] = ( rand() % 256 - 128 );
+        test2[i] = ( rand() % 65536 - 32768 );
+    }
+
+    initialize_results_q7( test3, test3 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start maxpool q7 non-square implementation\n" );
+
+    arm_maxpool_q7_HWC_nonsquare_ref( test1, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                      POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                      POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, NULL, test3 );
+    arm_maxpool_q7_HWC_nonsquare( test1, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                  POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                  POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, NULL, test3 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q7( test3, test3 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    initialize_results_q7( test3, test3 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start avepool q7 non-square implementation\n" );
+
+    arm_avepool_q7_HWC_nonsquare_ref( test1, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                      POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                      POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, NULL, test3 );
+    arm_avepool_q7_HWC_nonsquare( test1, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                  POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                  POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, ( q7_t * ) pool_sum_buf, test3 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q7( test3, test3 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    initialize_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start maxpool q15 non-square implementation\n" );
+
+    arm_maxpool_q15_HWC_nonsquare_ref( test2, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                       POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                       POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, NULL, test4 );
+    arm_maxpool_q15_HWC_nonsquare( test2, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                   POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                   POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, NULL, test4 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    initialize_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start avepool q15 non-square implementation\n" );
+
+    arm_avepool_q15_HWC_nonsquare_ref( test2, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                       POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                       POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, NULL, test4 );
+    arm_avepool_q15_HWC_nonsquare( test2, POOL_NSQ_IM_X, POOL_NSQ_IM_Y, POOL_NSQ_CH, POOL_NSQ_KER_X, POOL_NSQ_KER_Y,
+                                   POOL_NSQ_PAD_X, POOL_NSQ_PAD_Y, POOL_NSQ_STRIDE_X, POOL_NSQ_STRIDE_Y,
+                                   POOL_NSQ_OUT_X, POOL_NSQ_OUT_Y, ( q15_t * ) pool_sum_buf, test4 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    initialize_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start maxpool q15 implementation\n" );
+
+    // 9x9 input, 3x3 window, stride 2, padding 1 gives 5x5 outputs
+    arm_maxpool_q15_HWC_nonsquare_ref( test2, 9, 9, POOL_NSQ_CH, 3, 3, 1, 1, 2, 2, 5, 5, NULL, test4 );
+    arm_maxpool_q15_HWC( test2, 9, POOL_NSQ_CH, 3, 1, 2, 5, NULL, test4 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, 5 * 5 * POOL_NSQ_CH );
+
+    initialize_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start avepool q15 implementation\n" );
+
+    arm_avepool_q15_HWC_nonsquare_ref( test2, 9, 9, POOL_NSQ_CH, 3, 3, 1, 1, 2, 2, 5, 5, NULL, test4 );
+    arm_avepool_q15_HWC( test2, 9, POOL_NSQ_CH, 3, 1, 2, 5, ( q15_t * ) pool_sum_buf, test4 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, 5 * 5 * POOL_NSQ_CH );
+
+    initialize_results_q7( test3, test3 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start global avepool q7 implementation\n" );
+
+    // the global pooling is an average pooling with the whole input as window
+    arm_avepool_q7_HWC_nonsquare_ref( test1, POOL_GLOBAL_IM_X, POOL_GLOBAL_IM_Y, POOL_GLOBAL_CH, POOL_GLOBAL_IM_X,
+                                      POOL_GLOBAL_IM_Y, 0, 0, 1, 1, 1, 1, NULL, test3 );
+    arm_global_avepool_q7_HWC( test1, POOL_GLOBAL_IM_X, POOL_GLOBAL_IM_Y, POOL_GLOBAL_CH, ( q7_t * ) pool_sum_buf,
+                               test3 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q7( test3, test3 + POOL_NSQ_OUT_SIZE, POOL_GLOBAL_CH );
+
+    initialize_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_NSQ_OUT_SIZE );
+
+    printf( "Start global avepool q15 implementation\n" );
+
+    arm_avepool_q15_HWC_nonsquare_ref( test2, POOL_GLOBAL_IM_X, POOL_GLOBAL_IM_Y, POOL_GLOBAL_CH, POOL_GLOBAL_IM_X,
+                                       POOL_GLOBAL_IM_Y, 0, 0, 1, 1, 1, 1, NULL, test4 );
+    arm_global_avepool_q15_HWC( test2, POOL_GLOBAL_IM_X, POOL_GLOBAL_IM_Y, POOL_GLOBAL_CH, ( q15_t * ) pool_sum_buf,
+                                test4 + POOL_NSQ_OUT_SIZE );
+
+    verify_results_q15( test4, test4 + POOL_NSQ_OUT_SIZE, POOL_GLOBAL_CH );
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+    delete[]test4;
+
 #endif
 
 #ifdef TEST_RELU
@@ -472,6 +629,55 @@ int main()
 
     verify_results_q15( ip_out_q15_ref, ip_out_q15_opt, IP_ROW_DIM );
 
+    // the packing functions give the layouts of Scripts/NNFunctions/fully_connected_opt_weight_generation.py
+    q7_t     *ip_packed_q7 = new q7_t[IP_ROW_DIM * IP_COL_DIM];
+    q15_t    *ip_packed_q15 = new q15_t[IP_ROW_DIM * IP_COL_DIM];
+
+    printf( "Start weight packing\n" );
+
+    arm_nn_pack_weights_q7_x4( ip_weights, IP_ROW_DIM, IP_COL_DIM, ip_packed_q7 );
+
+    verify_results_q7( ip_q7_opt_weights, ip_packed_q7, IP_ROW_DIM * IP_COL_DIM );
+
+    arm_nn_pack_weights_q7_q15_x4( ip_weights, IP_ROW_DIM, IP_COL_DIM, ip_packed_q7 );
+
+    verify_results_q7( ip_q7_q15_opt_weights, ip_packed_q7, IP_ROW_DIM * IP_COL_DIM );
+
+    arm_nn_pack_weights_q15_x4( ip_q15_weights, IP_ROW_DIM, IP_COL_DIM, ip_packed_q15 );
+
+    verify_results_q15( ip_q15_opt_weights, ip_packed_q15, IP_ROW_DIM * IP_COL_DIM );
+
+    // int8 layer: the packed 4-row kernel against the unpacked one
+    int32_t  *ip_bias_s32 = new int32_t[IP_ROW_DIM];
+
+    for( int i = 0; i < IP_ROW_DIM; i++ )
+    {
+        ip_bias_s32[i] = rand() % 8192 - 4096;
+    }
+
+    for( int rows = IP_ROW_DIM - 3; rows <= IP_ROW_DIM; rows++ )
+    {
+        initialize_results_q7( ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM );
+
+        printf( "Start s8 implementation, %d rows\n", rows );
+
+        arm_fully_connected_s8( test1, ip_weights, IP_COL_DIM, rows, 28, 1288490189, -9, -5, ip_bias_s32,
+                                ip_out_q7_ref, -128, 127, test2 );
+
+        printf( "Start s8 opt implementation, %d rows\n", rows );
+
+        // 0 to 3 left-over rows
+        arm_nn_pack_weights_q7_q15_x4( ip_weights, rows, IP_COL_DIM, ip_packed_q7 );
+        arm_fully_connected_s8_opt( test1, ip_packed_q7, IP_COL_DIM, rows, 28, 1288490189, -9, -5, ip_bias_s32,
+                                    ip_out_q7_opt, -128, 127, test2 );
+
+        verify_results_q7( ip_out_q7_ref, ip_out_q7_opt, rows );
+    }
+
+    delete[]ip_packed_q7;
+    delete[]ip_packed_q15;
+    delete[]ip_bias_s32;
+
     delete[]test1;
     delete[]test2;
     delete[]test3;
@@ -636,6 +842,198 @@ int main()
     delete [] test4;
 #endif
 
+#ifdef TEST_CONV1D
+
+#define CONV1D_IM_DIM 40
+#define CONV1D_IM_CH 12
+#define CONV1D_OUT_CH 10
+#define CONV1D_KER_DIM 5
+#define CONV1D_PADDING 2
+#define CONV1D_DIL_KER_DIM 3
+#define CONV1D_DILATION 4
+#define CONV1D_CAUSAL_PADDING ((CONV1D_DIL_KER_DIM - 1) * CONV1D_DILATION)
+#define CONV1D_STATE_SIZE ((CONV1D_CAUSAL_PADDING + 1) * CONV1D_IM_CH)
+#define CONV1D_WT_SIZE (CONV1D_KER_DIM * CONV1D_IM_CH * CONV1D_OUT_CH)
+#define CONV1D_IM_SIZE (CONV1D_IM_DIM * CONV1D_IM_CH)
+#define CONV1D_OUT_SIZE (CONV1D_IM_DIM * CONV1D_OUT_CH)
+
+#if defined (__arm__) && defined (DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    uint32_t  conv1d_cycles_1d, conv1d_cycles_2d;
+
+    test1 = new q7_t[CONV1D_WT_SIZE + CONV1D_OUT_CH + CONV1D_IM_SIZE];
+    test2 = new q15_t[2 * CONV1D_KER_DIM * CONV1D_IM_CH];
+    test3 = new q7_t[2 * CONV1D_OUT_SIZE + CONV1D_STATE_SIZE];
+    test4 = new q15_t[CONV1D_WT_SIZE + CONV1D_OUT_CH + CONV1D_IM_SIZE + 2 * CONV1D_OUT_SIZE + CONV1D_STATE_SIZE];
+
+    for( int i = 0; i < CONV1D_WT_SIZE + CONV1D_OUT_CH + CONV1D_IM_SIZE; i++ )
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for( int i = 0; i < CONV1D_WT_SIZE + CONV1D_OUT_CH + CONV1D_IM_SIZE; i++ )
+    {
+        test4[i] = rand() % 8192 - 4096;
+    }
+
+    q7_t     *conv1d_weight_q7 = test1;
+    q7_t     *conv1d_bias_q7 = test1 + CONV1D_WT_SIZE;
+    q7_t     *conv1d_im_in_q7 = conv1d_bias_q7 + CONV1D_OUT_CH;
+    q7_t     *conv1d_out_ref_q7 = test3;
+    q7_t     *conv1d_out_opt_q7 = test3 + CONV1D_OUT_SIZE;
+    q7_t     *conv1d_state_q7 = test3 + 2 * CONV1D_OUT_SIZE;
+
+    q15_t    *conv1d_weight_q15 = test4;
+    q15_t    *conv1d_bias_q15 = test4 + CONV1D_WT_SIZE;
+    q15_t    *conv1d_im_in_q15 = conv1d_bias_q15 + CONV1D_OUT_CH;
+    q15_t    *conv1d_out_ref_q15 = conv1d_im_in_q15 + CONV1D_IM_SIZE;
+    q15_t    *conv1d_out_opt_q15 = conv1d_out_ref_q15 + CONV1D_OUT_SIZE;
+    q15_t    *conv1d_state_q15 = conv1d_out_opt_q15 + CONV1D_OUT_SIZE;
+
+    arm_convolve_1d_instance_q7 conv1d_stream_q7;
+    arm_convolve_1d_instance_q15 conv1d_stream_q15;
+
+    initialize_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q7 ref implementation\n" );
+    arm_convolve_1d_q7_ref( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                            CONV1D_PADDING, 1, 1, conv1d_bias_q7, 3, 9, conv1d_out_ref_q7, CONV1D_IM_DIM, NULL );
+
+    printf( "start conv1d q7 opt implementation\n" );
+    conv1d_cycles_1d = conv1d_get_cycles();
+    arm_convolve_1d_q7( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                        CONV1D_PADDING, 1, 1, conv1d_bias_q7, 3, 9, conv1d_out_opt_q7, CONV1D_IM_DIM, test2 );
+    conv1d_cycles_1d = conv1d_get_cycles() - conv1d_cycles_1d;
+
+    verify_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    // the same layer as a 1 x N image through the 2-D non-square path
+    initialize_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q7 as 2-D non-square implementation\n" );
+    conv1d_cycles_2d = conv1d_get_cycles();
+    arm_convolve_HWC_q7_basic_nonsquare( conv1d_im_in_q7, CONV1D_IM_DIM, 1, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH,
+                                         CONV1D_KER_DIM, 1, CONV1D_PADDING, 0, 1, 1, conv1d_bias_q7, 3, 9,
+                                         conv1d_out_opt_q7, CONV1D_IM_DIM, 1, test2, NULL );
+    conv1d_cycles_2d = conv1d_get_cycles() - conv1d_cycles_2d;
+
+    arm_convolve_1d_q7_ref( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                            CONV1D_PADDING, 1, 1, conv1d_bias_q7, 3, 9, conv1d_out_ref_q7, CONV1D_IM_DIM, NULL );
+
+    verify_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    printf( "conv1d q7 cycles: 1-D %u, 2-D non-square %u\n", ( unsigned ) conv1d_cycles_1d, ( unsigned ) conv1d_cycles_2d );
+
+    // stride 2 with an odd number of output frames
+    initialize_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q7 strided implementation\n" );
+    arm_convolve_1d_q7_ref( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                            1, 2, 1, conv1d_bias_q7, 3, 9, conv1d_out_ref_q7, CONV1D_IM_DIM / 2 - 1, NULL );
+    arm_convolve_1d_q7( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                        1, 2, 1, conv1d_bias_q7, 3, 9, conv1d_out_opt_q7, CONV1D_IM_DIM / 2 - 1, test2 );
+
+    verify_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, ( CONV1D_IM_DIM / 2 - 1 ) * CONV1D_OUT_CH );
+
+    // causal dilated convolution, all at once and then streamed
+    initialize_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q7 dilated causal implementation\n" );
+    arm_convolve_1d_q7_ref( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH,
+                            CONV1D_DIL_KER_DIM, CONV1D_CAUSAL_PADDING, 1, CONV1D_DILATION, conv1d_bias_q7, 3, 9,
+                            conv1d_out_ref_q7, CONV1D_IM_DIM, NULL );
+    arm_convolve_1d_q7( conv1d_im_in_q7, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH,
+                        CONV1D_DIL_KER_DIM, CONV1D_CAUSAL_PADDING, 1, CONV1D_DILATION, conv1d_bias_q7, 3, 9,
+                        conv1d_out_opt_q7, CONV1D_IM_DIM, test2 );
+
+    verify_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    initialize_results_q7( conv1d_out_opt_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q7 streaming implementation\n" );
+    arm_convolve_1d_stream_init_q7( &conv1d_stream_q7, CONV1D_IM_CH, conv1d_weight_q7, CONV1D_OUT_CH, CONV1D_DIL_KER_DIM,
+                                    CONV1D_DILATION, conv1d_bias_q7, 3, 9, conv1d_state_q7 );
+    arm_convolve_1d_stream_q7( &conv1d_stream_q7, conv1d_im_in_q7, conv1d_out_opt_q7, 7, test2 );
+    arm_convolve_1d_stream_q7( &conv1d_stream_q7, conv1d_im_in_q7 + 7 * CONV1D_IM_CH,
+                               conv1d_out_opt_q7 + 7 * CONV1D_OUT_CH, CONV1D_IM_DIM - 7, test2 );
+
+    verify_results_q7( conv1d_out_ref_q7, conv1d_out_opt_q7, CONV1D_OUT_SIZE );
+
+    initialize_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q15 ref implementation\n" );
+    arm_convolve_1d_q15_ref( conv1d_im_in_q15, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH,
+                             CONV1D_KER_DIM, CONV1D_PADDING, 1, 1, conv1d_bias_q15, 2, 14, conv1d_out_ref_q15,
+                             CONV1D_IM_DIM, NULL );
+
+    printf( "start conv1d q15 opt implementation\n" );
+    conv1d_cycles_1d = conv1d_get_cycles();
+    arm_convolve_1d_q15( conv1d_im_in_q15, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                         CONV1D_PADDING, 1, 1, conv1d_bias_q15, 2, 14, conv1d_out_opt_q15, CONV1D_IM_DIM, test2 );
+    conv1d_cycles_1d = conv1d_get_cycles() - conv1d_cycles_1d;
+
+    verify_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    initialize_results_q15( conv1d_out_opt_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q15 as 2-D non-square implementation\n" );
+    conv1d_cycles_2d = conv1d_get_cycles();
+    arm_convolve_HWC_q15_fast_nonsquare( conv1d_im_in_q15, CONV1D_IM_DIM, 1, CONV1D_IM_CH, conv1d_weight_q15,
+                                         CONV1D_OUT_CH, CONV1D_KER_DIM, 1, CONV1D_PADDING, 0, 1, 1, conv1d_bias_q15, 2, 14,
+                                         conv1d_out_opt_q15, CONV1D_IM_DIM, 1, test2, NULL );
+    conv1d_cycles_2d = conv1d_get_cycles() - conv1d_cycles_2d;
+
+    verify_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    printf( "conv1d q15 cycles: 1-D %u, 2-D non-square %u\n", ( unsigned ) conv1d_cycles_1d, ( unsigned ) conv1d_cycles_2d );
+
+    initialize_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q15 strided implementation\n" );
+    arm_convolve_1d_q15_ref( conv1d_im_in_q15, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH,
+                             CONV1D_KER_DIM, 1, 2, 1, conv1d_bias_q15, 2, 14, conv1d_out_ref_q15, CONV1D_IM_DIM / 2 - 1,
+                             NULL );
+    arm_convolve_1d_q15( conv1d_im_in_q15, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH, CONV1D_KER_DIM,
+                         1, 2, 1, conv1d_bias_q15, 2, 14, conv1d_out_opt_q15, CONV1D_IM_DIM / 2 - 1, test2 );
+
+    verify_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, ( CONV1D_IM_DIM / 2 - 1 ) * CONV1D_OUT_CH );
+
+    initialize_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q15 dilated causal implementation\n" );
+    arm_convolve_1d_q15_ref( conv1d_im_in_q15, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH,
+                             CONV1D_DIL_KER_DIM, CONV1D_CAUSAL_PADDING, 1, CONV1D_DILATION, conv1d_bias_q15, 2, 14,
+                             conv1d_out_ref_q15, CONV1D_IM_DIM, NULL );
+    arm_convolve_1d_q15( conv1d_im_in_q15, CONV1D_IM_DIM, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH,
+                         CONV1D_DIL_KER_DIM, CONV1D_CAUSAL_PADDING, 1, CONV1D_DILATION, conv1d_bias_q15, 2, 14,
+                         conv1d_out_opt_q15, CONV1D_IM_DIM, test2 );
+
+    verify_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    initialize_results_q15( conv1d_out_opt_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    printf( "start conv1d q15 streaming implementation\n" );
+    arm_convolve_1d_stream_init_q15( &conv1d_stream_q15, CONV1D_IM_CH, conv1d_weight_q15, CONV1D_OUT_CH,
+                                     CONV1D_DIL_KER_DIM, CONV1D_DILATION, conv1d_bias_q15, 2, 14, conv1d_state_q15 );
+
+    for( int i = 0; i < CONV1D_IM_DIM; i++ )
+    {
+        // one frame per inference step
+        arm_convolve_1d_stream_q15( &conv1d_stream_q15, conv1d_im_in_q15 + i * CONV1D_IM_CH,
+                                    conv1d_out_opt_q15 + i * CONV1D_OUT_CH, 1, test2 );
+    }
+
+    verify_results_q15( conv1d_out_ref_q15, conv1d_out_opt_q15, CONV1D_OUT_SIZE );
+
+    delete [] test1;
+    delete [] test2;
+    delete [] test3;
+    delete [] test4;
+#endif
+
 #ifdef TEST_CONV
 
 #define CONV_IM_DIM 16
@@ -787,6 +1185,304 @@ int main()
     delete[]test3;
     delete[]test4;
 
+#endif
+
+#ifdef TEST_S8
+
+    // golden vectors from Scripts/NNFunctions/s8_golden_vector_generation.py
+    q7_t      s8_conv1_in[] = S8_CONV1_INPUT;
+    q7_t      s8_conv1_kernel[] = S8_CONV1_KERNEL;
+    int32_t   s8_conv1_bias[] = S8_CONV1_BIAS;
+    int32_t   s8_conv1_mult[] = S8_CONV1_OUTPUT_MULT;
+    int32_t   s8_conv1_shift[] = S8_CONV1_OUTPUT_SHIFT;
+    q7_t      s8_conv1_ref[] = S8_CONV1_OUTPUT;
+
+    q7_t      s8_conv2_in[] = S8_CONV2_INPUT;
+    q7_t      s8_conv2_kernel[] = S8_CONV2_KERNEL;
+    int32_t   s8_conv2_bias[] = S8_CONV2_BIAS;
+    int32_t   s8_conv2_mult[] = S8_CONV2_OUTPUT_MULT;
+    int32_t   s8_conv2_shift[] = S8_CONV2_OUTPUT_SHIFT;
+    q7_t      s8_conv2_ref[] = S8_CONV2_OUTPUT;
+
+    q7_t      s8_dw_in[] = S8_DW_INPUT;
+    q7_t      s8_dw_kernel[] = S8_DW_KERNEL;
+    int32_t   s8_dw_bias[] = S8_DW_BIAS;
+    int32_t   s8_dw_mult[] = S8_DW_OUTPUT_MULT;
+    int32_t   s8_dw_shift[] = S8_DW_OUTPUT_SHIFT;
+    q7_t      s8_dw_ref[] = S8_DW_OUTPUT;
+
+    q7_t      s8_fc_in[] = S8_FC_INPUT;
+    q7_t      s8_fc_weights[] = S8_FC_WEIGHTS;
+    int32_t   s8_fc_bias[] = S8_FC_BIAS;
+    q7_t      s8_fc_ref[] = S8_FC_OUTPUT;
+
+    q7_t      s8_pool_in[] = S8_POOL_INPUT;
+    q7_t      s8_avgpool_ref[] = S8_POOL_AVG_OUTPUT;
+    q7_t      s8_maxpool_ref[] = S8_POOL_MAX_OUTPUT;
+
+    q7_t      s8_softmax_in[] = S8_SOFTMAX_INPUT;
+    q7_t      s8_softmax_ref[] = S8_SOFTMAX_OUTPUT;
+
+#define S8_OUT_DIM 256
+#define S8_BUF_DIM 128
+
+    test3 = new q7_t[S8_OUT_DIM];
+    test4 = new q15_t[S8_BUF_DIM];
+
+    printf( "start s8 convolution implementation\n" );
+
+    arm_convolve_s8( s8_conv1_in, S8_CONV1_INPUT_X, S8_CONV1_INPUT_Y, S8_CONV1_INPUT_CH, s8_conv1_kernel,
+                     S8_CONV1_OUTPUT_CH, S8_CONV1_KERNEL_X, S8_CONV1_KERNEL_Y, S8_CONV1_PAD_X, S8_CONV1_PAD_Y,
+                     S8_CONV1_STRIDE_X, S8_CONV1_STRIDE_Y, s8_conv1_bias, test3, s8_conv1_shift, s8_conv1_mult,
+                     S8_CONV1_OUTPUT_OFFSET, S8_CONV1_INPUT_OFFSET, S8_CONV1_ACT_MIN, S8_CONV1_ACT_MAX,
+                     S8_CONV1_OUTPUT_X, S8_CONV1_OUTPUT_Y, test4 );
+
+    verify_results_q7( s8_conv1_ref, test3, S8_CONV1_OUTPUT_X * S8_CONV1_OUTPUT_Y * S8_CONV1_OUTPUT_CH );
+
+    printf( "start s8 nonsquare convolution implementation\n" );
+
+    arm_convolve_s8( s8_conv2_in, S8_CONV2_INPUT_X, S8_CONV2_INPUT_Y, S8_CONV2_INPUT_CH, s8_conv2_kernel,
+                     S8_CONV2_OUTPUT_CH, S8_CONV2_KERNEL_X, S8_CONV2_KERNEL_Y, S8_CONV2_PAD_X, S8_CONV2_PAD_Y,
+                     S8_CONV2_STRIDE_X, S8_CONV2_STRIDE_Y, s8_conv2_bias, test3, s8_conv2_shift, s8_conv2_mult,
+                     S8_CONV2_OUTPUT_OFFSET, S8_CONV2_INPUT_OFFSET, S8_CONV2_ACT_MIN, S8_CONV2_ACT_MAX,
+                     S8_CONV2_OUTPUT_X, S8_CONV2_OUTPUT_Y, test4 );
+
+    verify_results_q7( s8_conv2_ref, test3, S8_CONV2_OUTPUT_X * S8_CONV2_OUTPUT_Y * S8_CONV2_OUTPUT_CH );
+
+    printf( "start s8 depthwise convolution implementation\n" );
+
+    arm_depthwise_conv_s8( s8_dw_in, S8_DW_INPUT_X, S8_DW_INPUT_Y, S8_DW_INPUT_CH, s8_dw_kernel,
+                           S8_DW_OUTPUT_CH, S8_DW_CH_MULT, S8_DW_KERNEL_X, S8_DW_KERNEL_Y, S8_DW_PAD_X, S8_DW_PAD_Y,
+                           S8_DW_STRIDE_X, S8_DW_STRIDE_Y, s8_dw_bias, test3, s8_dw_shift, s8_dw_mult,
+                           S8_DW_OUTPUT_X, S8_DW_OUTPUT_Y, S8_DW_OUTPUT_OFFSET, S8_DW_INPUT_OFFSET,
+                           S8_DW_ACT_MIN, S8_DW_ACT_MAX );
+
+    verify_results_q7( s8_dw_ref, test3, S8_DW_OUTPUT_X * S8_DW_OUTPUT_Y * S8_DW_OUTPUT_CH );
+
+    printf( "start s8 fully-connected implementation\n" );
+
+    arm_fully_connected_s8( s8_fc_in, s8_fc_weights, S8_FC_COLS, S8_FC_ROWS, S8_FC_INPUT_OFFSET,
+                            S8_FC_OUTPUT_MULT, S8_FC_OUTPUT_SHIFT, S8_FC_OUTPUT_OFFSET, s8_fc_bias, test3,
+                            S8_FC_ACT_MIN, S8_FC_ACT_MAX, test4 );
+
+    verify_results_q7( s8_fc_ref, test3, S8_FC_ROWS );
+
+    printf( "start s8 opt fully-connected implementation\n" );
+
+    q7_t      s8_fc_packed[S8_FC_ROWS * S8_FC_COLS];
+
+    arm_nn_pack_weights_q7_q15_x4( s8_fc_weights, S8_FC_ROWS, S8_FC_COLS, s8_fc_packed );
+    arm_fully_connected_s8_opt( s8_fc_in, s8_fc_packed, S8_FC_COLS, S8_FC_ROWS, S8_FC_INPUT_OFFSET,
+                                S8_FC_OUTPUT_MULT, S8_FC_OUTPUT_SHIFT, S8_FC_OUTPUT_OFFSET, s8_fc_bias, test3,
+                                S8_FC_ACT_MIN, S8_FC_ACT_MAX, test4 );
+
+    verify_results_q7( s8_fc_ref, test3, S8_FC_ROWS );
+
+    printf( "start s8 average pooling implementation\n" );
+
+    arm_avgpool_s8( s8_pool_in, S8_POOL_INPUT_X, S8_POOL_INPUT_Y, S8_POOL_CH, S8_POOL_KERNEL_X, S8_POOL_KERNEL_Y,
+                    S8_POOL_PAD_X, S8_POOL_PAD_Y, S8_POOL_STRIDE_X, S8_POOL_STRIDE_Y, S8_POOL_ACT_MIN, S8_POOL_ACT_MAX,
+                    test3, S8_POOL_OUTPUT_X, S8_POOL_OUTPUT_Y, test4 );
+
+    verify_results_q7( s8_avgpool_ref, test3, S8_POOL_OUTPUT_X * S8_POOL_OUTPUT_Y * S8_POOL_CH );
+
+    printf( "start s8 max pooling implementation\n" );
+
+    arm_max_pool_s8( s8_pool_in, S8_POOL_INPUT_X, S8_POOL_INPUT_Y, S8_POOL_CH, S8_POOL_KERNEL_X, S8_POOL_KERNEL_Y,
+                     S8_POOL_PAD_X, S8_POOL_PAD_Y, S8_POOL_STRIDE_X, S8_POOL_STRIDE_Y, S8_POOL_ACT_MIN, S8_POOL_ACT_MAX,
+                     test3, S8_POOL_OUTPUT_X, S8_POOL_OUTPUT_Y );
+
+    verify_results_q7( s8_maxpool_ref, test3, S8_POOL_OUTPUT_X * S8_POOL_OUTPUT_Y * S8_POOL_CH );
+
+    printf( "start s8 softmax implementation\n" );
+
+    arm_softmax_s8( s8_softmax_in, S8_SOFTMAX_ROWS, S8_SOFTMAX_COLS, S8_SOFTMAX_MULT, S8_SOFTMAX_SHIFT,
+                    S8_SOFTMAX_DIFF_MIN, test3 );
+
+    verify_results_q7( s8_softmax_ref, test3, S8_SOFTMAX_ROWS * S8_SOFTMAX_COLS );
+
+    delete[]test3;
+    delete[]test4;
+
+#endif
+
+#ifdef TEST_RNN
+
+    // golden vectors from Scripts/NNFunctions/rnn_golden_vector_generation.py
+    q7_t      gru_wt_x[] = RNN_GRU_WT_X;
+    q7_t      gru_bias_x[] = RNN_GRU_BIAS_X;
+    q7_t      gru_wt_h[] = RNN_GRU_WT_H;
+    q7_t      gru_bias_h[] = RNN_GRU_BIAS_H;
+    q15_t     gru_in[] = RNN_GRU_INPUT;
+    q15_t     gru_h[] = RNN_GRU_H_INIT;
+    q15_t     gru_ref[] = RNN_GRU_OUTPUT;
+
+    q7_t      lstm_wt[] = RNN_LSTM_WT;
+    q7_t      lstm_bias[] = RNN_LSTM_BIAS;
+    q15_t     lstm_in[] = RNN_LSTM_INPUT;
+    q15_t     lstm_h[] = RNN_LSTM_H_INIT;
+    q15_t     lstm_c[] = RNN_LSTM_C_INIT;
+    q15_t     lstm_ref[] = RNN_LSTM_OUTPUT;
+    q15_t     lstm_c_ref[] = RNN_LSTM_CELL;
+
+    test4 = new q15_t[RNN_LSTM_DIM_X + 5 * RNN_LSTM_DIM_H + 6 * RNN_GRU_DIM_H];
+
+    printf( "start GRU implementation\n" );
+
+    for( int t = 0; t < RNN_GRU_SEQ_LEN; t++ )
+    {
+        test_flags[test_index++] = arm_gru_cell_q7_q15( gru_in + t * RNN_GRU_DIM_X, RNN_GRU_DIM_X, gru_h, RNN_GRU_DIM_H,
+                                   gru_wt_x, gru_bias_x, RNN_GRU_BIAS_SHIFT_X, RNN_GRU_OUT_SHIFT_X,
+                                   gru_wt_h, gru_bias_h, RNN_GRU_BIAS_SHIFT_H, RNN_GRU_OUT_SHIFT_H,
+                                   RNN_GRU_GATE_INT_WIDTH, test4 ) != ARM_MATH_SUCCESS;
+
+        verify_results_q15( gru_ref + t * RNN_GRU_DIM_H, gru_h, RNN_GRU_DIM_H );
+    }
+
+    printf( "start LSTM implementation\n" );
+
+    for( int t = 0; t < RNN_LSTM_SEQ_LEN; t++ )
+    {
+        test_flags[test_index++] = arm_lstm_cell_q7_q15( lstm_in + t * RNN_LSTM_DIM_X, RNN_LSTM_DIM_X, lstm_h, lstm_c,
+                                   RNN_LSTM_DIM_H, lstm_wt, lstm_bias, RNN_LSTM_BIAS_SHIFT, RNN_LSTM_OUT_SHIFT,
+                                   RNN_LSTM_GATE_INT_WIDTH, RNN_LSTM_CELL_INT_WIDTH, test4 ) != ARM_MATH_SUCCESS;
+
+        verify_results_q15( lstm_ref + t * RNN_LSTM_DIM_H, lstm_h, RNN_LSTM_DIM_H );
+        verify_results_q15( lstm_c_ref + t * RNN_LSTM_DIM_H, lstm_c, RNN_LSTM_DIM_H );
+    }
+
+    // the activation tables do not go beyond 3 integer bits
+    test_flags[test_index++] = arm_lstm_cell_q7_q15( lstm_in, RNN_LSTM_DIM_X, lstm_h, lstm_c, RNN_LSTM_DIM_H, lstm_wt,
+                               lstm_bias, RNN_LSTM_BIAS_SHIFT, RNN_LSTM_OUT_SHIFT, 4, RNN_LSTM_CELL_INT_WIDTH,
+                               test4 ) != ARM_MATH_ARGUMENT_ERROR;
+
+    delete[]test4;
+
+#endif
+
+#ifdef TEST_GRAPH
+
+#define GRAPH_NUM_LAYERS 10
+#define GRAPH_NUM_TENSORS 9
+#define GRAPH_IM_DIM 16
+#define GRAPH_IM_CH 3
+#define GRAPH_OUT_DIM 10
+
+    // weights and biases of all layers, in one random pool
+    q7_t     *graph_wt = new q7_t[4096];
+
+    for( int i = 0; i < 4096; i++ )
+    {
+        graph_wt[i] = rand() % 256 - 128;
+    }
+
+    // input 16x16x3 -> conv 5x5 -> relu -> maxpool -> depthwise 3x3 -> conv 1x1 -> relu
+    //   -> avepool -> conv 3x3 -> fully-connected -> softmax
+    const arm_nn_layer graph_layers[GRAPH_NUM_LAYERS] =
+    {
+        { ARM_NN_LAYER_CONV, 0, 1, 16, 16, 3, 16, 16, 8, 5, 5, 2, 2, 1, 1, graph_wt, graph_wt + 600, 0, 9 },
+        { ARM_NN_LAYER_RELU, 1, 1, 16, 16, 8, 16, 16, 8, 0, 0, 0, 0, 0, 0, NULL, NULL, 0, 0 },
+        { ARM_NN_LAYER_MAX_POOL, 1, 2, 16, 16, 8, 8, 8, 8, 3, 3, 1, 1, 2, 2, NULL, NULL, 0, 0 },
+        { ARM_NN_LAYER_DEPTHWISE_CONV, 2, 3, 8, 8, 8, 8, 8, 8, 3, 3, 1, 1, 1, 1, graph_wt + 700, graph_wt + 800, 0, 7 },
+        { ARM_NN_LAYER_CONV, 3, 4, 8, 8, 8, 8, 8, 16, 1, 1, 0, 0, 1, 1, graph_wt + 900, graph_wt + 1100, 0, 7 },
+        { ARM_NN_LAYER_RELU, 4, 4, 8, 8, 16, 8, 8, 16, 0, 0, 0, 0, 0, 0, NULL, NULL, 0, 0 },
+        { ARM_NN_LAYER_AVE_POOL, 4, 5, 8, 8, 16, 4, 4, 16, 2, 2, 0, 0, 2, 2, NULL, NULL, 0, 0 },
+        { ARM_NN_LAYER_CONV, 5, 6, 4, 4, 16, 4, 4, 8, 3, 3, 1, 1, 1, 1, graph_wt + 1200, graph_wt + 2400, 0, 9 },
+        { ARM_NN_LAYER_FULLY_CONNECTED, 6, 7, 4, 4, 8, 1, 1, GRAPH_OUT_DIM, 0, 0, 0, 0, 0, 0, graph_wt + 2500, graph_wt + 3800, 0, 8 },
+        { ARM_NN_LAYER_SOFTMAX, 7, 8, 1, 1, GRAPH_OUT_DIM, 1, 1, GRAPH_OUT_DIM, 0, 0, 0, 0, 0, 0, NULL, NULL, 0, 0 },
+    };
+
+    arm_nn_tensor graph_tensors[ARM_NN_GRAPH_NUM_TENSORS( GRAPH_NUM_TENSORS, GRAPH_NUM_LAYERS )];
+    uint32_t  graph_cycles[GRAPH_NUM_LAYERS];
+    arm_nn_graph graph;
+
+    graph.layers = graph_layers;
+    graph.num_layers = GRAPH_NUM_LAYERS;
+    graph.num_tensors = GRAPH_NUM_TENSORS;
+    graph.input = 0;
+    graph.output = 8;
+    graph.tensors = graph_tensors;
+    graph.get_cycles = graph_get_cycles;
+    graph.cycles = graph_cycles;
+
+    printf( "start graph planner\n" );
+
+    test_flags[test_index++] = arm_nn_graph_plan( &graph ) != ARM_MATH_SUCCESS;
+
+    printf( "arena %d bytes\n", ( int ) graph.peak_size );
+
+    // the first layer needs its input, its output and the im2col buffer at the same
+    // time, 768 + 2048 + 300 bytes, and no other layer needs more
+    test_flags[test_index++] = graph.peak_size != 768 + 2048 + 300;
+
+    graph.arena = new q7_t[graph.peak_size];
+    graph.arena_size = graph.peak_size;
+
+    // reference: the same network with a separate buffer per tensor
+    q7_t     *graph_in = new q7_t[GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH];
+    q7_t     *graph_t1 = new q7_t[16 * 16 * 8];
+    q7_t     *graph_t2 = new q7_t[8 * 8 * 8];
+    q7_t     *graph_t3 = new q7_t[8 * 8 * 8];
+    q7_t     *graph_t4 = new q7_t[8 * 8 * 16];
+    q7_t     *graph_t5 = new q7_t[4 * 4 * 16];
+    q7_t     *graph_t6 = new q7_t[4 * 4 * 8];
+    q7_t     *graph_t7 = new q7_t[GRAPH_OUT_DIM];
+    q7_t     *graph_ref = new q7_t[GRAPH_OUT_DIM];
+    q15_t    *graph_buf = new q15_t[2 * 16 * 3 * 3];
+
+    for( int i = 0; i < GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH; i++ )
+    {
+        graph_in[i] = rand() % 256 - 128;
+    }
+
+    memcpy( arm_nn_graph_tensor( &graph, graph.input ), graph_in, GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH );
+
+    printf( "start graph reference implementation\n" );
+
+    arm_convolve_HWC_q7_ref_nonsquare( graph_in, 16, 16, 3, graph_wt, 8, 5, 5, 2, 2, 1, 1, graph_wt + 600, 0, 9,
+                                       graph_t1, 16, 16, graph_buf, NULL );
+    arm_relu_q7_ref( graph_t1, 16 * 16 * 8 );
+    arm_maxpool_q7_HWC_ref( graph_t1, 16, 8, 3, 1, 2, 8, NULL, graph_t2 );
+    arm_depthwise_separable_conv_HWC_q7_ref_nonsquare( graph_t2, 8, 8, 8, graph_wt + 700, 8, 3, 3, 1, 1, 1, 1,
+            graph_wt + 800, 0, 7, graph_t3, 8, 8, graph_buf, NULL );
+    arm_convolve_HWC_q7_ref_nonsquare( graph_t3, 8, 8, 8, graph_wt + 900, 16, 1, 1, 0, 0, 1, 1, graph_wt + 1100, 0, 7,
+                                       graph_t4, 8, 8, graph_buf, NULL );
+    arm_relu_q7_ref( graph_t4, 8 * 8 * 16 );
+    // the optimized average pooling rounds differently from its reference
+    arm_avepool_q7_HWC( graph_t4, 8, 16, 2, 0, 2, 4, ( q7_t * ) graph_buf, graph_t5 );
+    arm_convolve_HWC_q7_ref_nonsquare( graph_t5, 4, 4, 16, graph_wt + 1200, 8, 3, 3, 1, 1, 1, 1, graph_wt + 2400, 0, 9,
+                                       graph_t6, 4, 4, graph_buf, NULL );
+    arm_fully_connected_q7_ref( graph_t6, graph_wt + 2500, 4 * 4 * 8, GRAPH_OUT_DIM, 0, 8, graph_wt + 3800, graph_t7,
+                                graph_buf );
+    arm_softmax_q7( graph_t7, GRAPH_OUT_DIM, graph_ref );
+
+    printf( "start graph implementation\n" );
+
+    test_flags[test_index++] = arm_nn_graph_run( &graph ) != ARM_MATH_SUCCESS;
+
+    for( int i = 0; i < GRAPH_NUM_LAYERS; i++ )
+    {
+        printf( "layer %d: %d cycles\n", i, ( int ) graph_cycles[i] );
+    }
+
+    verify_results_q7( graph_ref, arm_nn_graph_tensor( &graph, graph.output ), GRAPH_OUT_DIM );
+
+    // the intermediate result before the softmax is compared as well
+    verify_results_q7( graph_t7, arm_nn_graph_tensor( &graph, 7 ), GRAPH_OUT_DIM );
+
+    delete[]graph_wt;
+    delete[]graph.arena;
+    delete[]graph_in;
+    delete[]graph_t1;
+    delete[]graph_t2;
+    delete[]graph_t3;
+    delete[]graph_t4;
+    delete[]graph_t5;
+    delete[]graph_t6;
+    delete[]graph_t7;
+    delete[]graph_ref;
+    delete[]graph_buf;
+
 #endif
 
     test_pass = true;
@@ -11,7 +11,7 @@
 #include "ref_functions.h"
 
 extern int test_index;
-extern q7_t test_flags[50];
+extern q7_t test_flags[200];
 
 void initialize_results_q7( q7_t *ref, q7_t *opt, int length )
 {
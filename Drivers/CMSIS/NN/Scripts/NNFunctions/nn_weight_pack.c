@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_weight_pack.c
+ * Description:  Host tool packing weights for the opt fully-connected functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Host
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * Packs a row-major weight matrix into the layout of one of the opt
+ * fully-connected functions, with the arm_nn_pack_weights_*() functions
+ * of the library, so the tool and the kernels cannot disagree.
+ *
+ * Build on the host, from this directory:
+ *
+ *   gcc -DARM_MATH_CM0 -I../../Include -I../../../DSP/Include -I../../../Include
+ *       nn_weight_pack.c ../../Source/NNSupportFunctions/arm_nn_pack_weights.c -o nn_weight_pack
+ *
+ * The convolution functions take their weights in the natural
+ * [out_ch, ker_y, ker_x, in_ch] order and need no packing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnsupportfunctions.h"
+
+static void usage( void )
+{
+    fprintf( stderr,
+             "usage: nn_weight_pack LAYOUT ROWS COLS INPUT OUTPUT [NAME]\n"
+             "\n"
+             "LAYOUT     q7_x4      arm_fully_connected_q7_opt()\n"
+             "           q7_q15_x4  arm_fully_connected_mat_q7_vec_q15_opt(), arm_fully_connected_s8_opt(),\n"
+             "                      arm_gru_cell_q7_q15(), arm_lstm_cell_q7_q15()\n"
+             "           q15_x4     arm_fully_connected_q15_opt()\n"
+             "ROWS COLS  size of the weight matrix, ROWS outputs of COLS inputs each\n"
+             "INPUT      row-major weights, int8, or little-endian int16 for q15_x4\n"
+             "OUTPUT     packed weights in the same format, or a C header\n"
+             "           with #define NAME {...} when NAME is given\n" );
+}
+
+int main( int argc, char **argv )
+{
+    long      rows, cols;
+    size_t    num, size, i;
+    int       is_q15;
+    unsigned char *raw;
+    q7_t     *src7 = NULL, *dst7 = NULL;
+    q15_t    *src15 = NULL, *dst15 = NULL;
+    FILE     *f;
+
+    if( argc != 6 && argc != 7 )
+    {
+        usage();
+        return 1;
+    }
+
+    rows = strtol( argv[2], NULL, 0 );
+    cols = strtol( argv[3], NULL, 0 );
+
+    if( rows <= 0 || cols <= 0 || rows > 0xFFFF || cols > 0xFFFF )
+    {
+        fprintf( stderr, "nn_weight_pack: ROWS and COLS must be in 1..65535\n" );
+        return 1;
+    }
+
+    if( strcmp( argv[1], "q15_x4" ) == 0 )
+    {
+        is_q15 = 1;
+    }
+    else if( strcmp( argv[1], "q7_x4" ) == 0 || strcmp( argv[1], "q7_q15_x4" ) == 0 )
+    {
+        is_q15 = 0;
+    }
+    else
+    {
+        usage();
+        return 1;
+    }
+
+    num = ( size_t ) rows * ( size_t ) cols;
+    size = num * ( is_q15 ? 2 : 1 );
+    raw = malloc( size );
+
+    if( raw == NULL )
+    {
+        fprintf( stderr, "nn_weight_pack: out of memory\n" );
+        return 1;
+    }
+
+    f = fopen( argv[4], "rb" );
+
+    if( f == NULL || fread( raw, 1, size, f ) != size || fgetc( f ) != EOF )
+    {
+        fprintf( stderr, "nn_weight_pack: %s must hold exactly %lu bytes\n", argv[4], ( unsigned long ) size );
+        return 1;
+    }
+
+    fclose( f );
+
+    if( is_q15 )
+    {
+        src15 = malloc( num * sizeof( q15_t ) );
+        dst15 = malloc( num * sizeof( q15_t ) );
+
+        if( src15 == NULL || dst15 == NULL )
+        {
+            fprintf( stderr, "nn_weight_pack: out of memory\n" );
+            return 1;
+        }
+
+        for( i = 0; i < num; i++ )
+        {
+            src15[i] = ( q15_t )( raw[2 * i] | ( raw[2 * i + 1] << 8 ) );
+        }
+
+        arm_nn_pack_weights_q15_x4( src15, ( uint16_t ) rows, ( uint16_t ) cols, dst15 );
+
+        for( i = 0; i < num; i++ )
+        {
+            raw[2 * i] = ( unsigned char )( dst15[i] & 0xFF );
+            raw[2 * i + 1] = ( unsigned char )( ( dst15[i] >> 8 ) & 0xFF );
+        }
+    }
+    else
+    {
+        src7 = ( q7_t * ) raw;
+        dst7 = malloc( num );
+
+        if( dst7 == NULL )
+        {
+            fprintf( stderr, "nn_weight_pack: out of memory\n" );
+            return 1;
+        }
+
+        if( strcmp( argv[1], "q7_x4" ) == 0 )
+        {
+            arm_nn_pack_weights_q7_x4( src7, ( uint16_t ) rows, ( uint16_t ) cols, dst7 );
+        }
+        else
+        {
+            arm_nn_pack_weights_q7_q15_x4( src7, ( uint16_t ) rows, ( uint16_t ) cols, dst7 );
+        }
+
+        memcpy( raw, dst7, num );
+    }
+
+    f = fopen( argv[5], argc == 7 ? "w" : "wb" );
+
+    if( f == NULL )
+    {
+        fprintf( stderr, "nn_weight_pack: cannot open %s\n", argv[5] );
+        return 1;
+    }
+
+    if( argc == 7 )
+    {
+        /* same style as the headers of the test weights */
+        fprintf( f, "/* Generated by nn_weight_pack %s %ld %ld, do not edit. */\n\n", argv[1], rows, cols );
+        fprintf( f, "#define %s {", argv[6] );
+
+        for( i = 0; i < num; i++ )
+        {
+            fprintf( f, i ? ",%d" : "%d", is_q15 ? dst15[i] : dst7[i] );
+        }
+
+        fprintf( f, "}\n" );
+    }
+    else
+    {
+        fwrite( raw, 1, size, f );
+    }
+
+    if( fclose( f ) != 0 )
+    {
+        fprintf( stderr, "nn_weight_pack: cannot write %s\n", argv[5] );
+        return 1;
+    }
+
+    free( raw );
+    free( dst7 );
+    free( src15 );
+    free( dst15 );
+    return 0;
+}
@@ -0,0 +1,267 @@
+#!/usr/bin/env python
+#
+# Golden vectors for the recurrent cells (arm_gru_cell_q7_q15 and
+# arm_lstm_cell_q7_q15).
+#
+# Random weights and input sequences are quantized to the fixed-point formats
+# the cells expect, and the expected states after every time step are
+# computed with the integer arithmetic of the kernels, including the table
+# look-up of arm_nn_activations_direct_q15() with the tables of
+# arm_nntables.c. The result is written to
+#
+#   NN_Lib_Tests/nn_test/Ref_Implementations/rnn_golden_vectors.h
+#
+# with the weights already reordered for
+# arm_fully_connected_mat_q7_vec_q15_opt(). Each sequence is also run in
+# floating point, so a mistake in the formats cannot go unnoticed.
+#
+# Usage: rnn_golden_vector_generation.py [output header]
+
+from __future__ import print_function
+
+import math
+import os
+import random
+import re
+import sys
+
+SEQ_LEN = 8
+
+
+def sat16(x):
+  return min(max(x, -32768), 32767)
+
+
+def clamp(x, lo, hi):
+  return min(max(x, lo), hi)
+
+
+def load_table(path, name):
+  text = open(path).read()
+  body = re.search(name + r'\[256\]\s*=\s*\{([^}]*)\}', text).group(1)
+  values = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body)]
+  assert len(values) == 256
+  return [v - 0x10000 if v & 0x8000 else v for v in values]
+
+
+def activation(values, int_width, table):
+  """arm_nn_activations_direct_q15()"""
+  shift = 8 + 3 - int_width
+  bit_mask = 0x7FF >> int_width
+  full_frac = bit_mask + 1
+  out = []
+  for v in values:
+    idx = v >> shift
+    frac = v & bit_mask
+    value = table[idx & 0xFF]
+    if idx != 0x7F:
+      value = ((full_frac - frac) * value + table[(idx + 1) & 0xFF] * frac) >> shift
+    out.append(value)
+  return out
+
+
+def fully_connected(vec, weights, rows, bias, bias_shift, out_shift):
+  """arm_fully_connected_mat_q7_vec_q15_opt() on the natural weight layout"""
+  cols = len(vec)
+  out = []
+  for r in range(rows):
+    acc = (bias[r] << bias_shift) + (1 << (out_shift - 1))
+    for c in range(cols):
+      acc += weights[r * cols + c] * vec[c]
+    out.append(sat16(acc >> out_shift))
+  return out
+
+
+def reorder_q7_q15(weights, rows, cols):
+  """weight layout of arm_fully_connected_mat_q7_vec_q15_opt()"""
+  out = []
+  for base in range(0, rows - rows % 4, 4):
+    w = [weights[(base + i) * cols:(base + i + 1) * cols] for i in range(4)]
+    for j in range(0, cols - 1, 2):
+      out += [w[0][j], w[1][j], w[0][j + 1], w[1][j + 1], w[2][j], w[3][j], w[2][j + 1], w[3][j + 1]]
+    if cols % 2:
+      out += [w[0][-1], w[1][-1], w[2][-1], w[3][-1]]
+  out += weights[(rows - rows % 4) * cols:]
+  assert len(out) == rows * cols
+  return out
+
+
+def quantize(values, frac_bits, lo, hi):
+  return [clamp(int(math.floor(v * (1 << frac_bits) + 0.5)), lo, hi) for v in values]
+
+
+def random_tensor(rng, size, limit):
+  return [rng.uniform(-limit, limit) for _ in range(size)]
+
+
+def sigmoid(x):
+  return 1.0 / (1.0 + math.exp(-x))
+
+
+def matvec(weights, scale, vec, rows):
+  cols = len(vec)
+  return [sum(weights[r * cols + c] * scale * vec[c] for c in range(cols)) for r in range(rows)]
+
+
+# x is Q2.13 and h is Q0.15. The input weights are Q0.7 for the GRU, which
+# has a separate shift for each part, and Q(-2).9 for the LSTM, so that both
+# parts of the concatenated vector give products with 22 fractional bits.
+X_FRAC = 13
+H_FRAC = 15
+W_FRAC = 7
+B_FRAC = 7
+
+
+def gru_case(rng, dim_x, dim_h, gate_int_width, tables):
+  sig, tanh = tables
+  gate_frac = 15 - gate_int_width
+  p = dict(dim_x=dim_x, dim_h=dim_h, gate_int_width=gate_int_width, seq_len=SEQ_LEN,
+           bias_shift_x=X_FRAC + W_FRAC - B_FRAC, out_shift_x=X_FRAC + W_FRAC - gate_frac,
+           bias_shift_h=H_FRAC + W_FRAC - B_FRAC, out_shift_h=H_FRAC + W_FRAC - gate_frac)
+  wt_x = quantize(random_tensor(rng, 3 * dim_h * dim_x, 0.6), W_FRAC, -128, 127)
+  wt_h = quantize(random_tensor(rng, 3 * dim_h * dim_h, 0.6), W_FRAC, -128, 127)
+  bias_x = quantize(random_tensor(rng, 3 * dim_h, 0.5), B_FRAC, -128, 127)
+  bias_h = quantize(random_tensor(rng, 3 * dim_h, 0.5), B_FRAC, -128, 127)
+  xs = quantize(random_tensor(rng, SEQ_LEN * dim_x, 2.0), X_FRAC, -32768, 32767)
+  h = quantize(random_tensor(rng, dim_h, 0.5), H_FRAC, -32768, 32767)
+  p['h_init'] = list(h)
+
+  hf = [v / 32768.0 for v in h]
+  p['output'] = []
+  max_err = 0.0
+  for t in range(SEQ_LEN):
+    x = xs[t * dim_x:(t + 1) * dim_x]
+    gx = fully_connected(x, wt_x, 3 * dim_h, bias_x, p['bias_shift_x'], p['out_shift_x'])
+    gh = fully_connected(h, wt_h, 3 * dim_h, bias_h, p['bias_shift_h'], p['out_shift_h'])
+    rz = activation([sat16(a + b) for a, b in zip(gx[:2 * dim_h], gh[:2 * dim_h])], gate_int_width, sig)
+    r, z = rz[:dim_h], rz[dim_h:]
+    n = activation([sat16(gx[2 * dim_h + i] + ((r[i] * gh[2 * dim_h + i]) >> 15)) for i in range(dim_h)],
+                   gate_int_width, tanh)
+    h = [sat16(n[i] + ((z[i] * (h[i] - n[i])) >> 15)) for i in range(dim_h)]
+    p['output'] += h
+
+    # floating point
+    xf = [v / float(1 << X_FRAC) for v in x]
+    gxf = [a + b / float(1 << B_FRAC) for a, b in zip(matvec(wt_x, 2.0 ** -W_FRAC, xf, 3 * dim_h), bias_x)]
+    ghf = [a + b / float(1 << B_FRAC) for a, b in zip(matvec(wt_h, 2.0 ** -W_FRAC, hf, 3 * dim_h), bias_h)]
+    rf = [sigmoid(gxf[i] + ghf[i]) for i in range(dim_h)]
+    zf = [sigmoid(gxf[dim_h + i] + ghf[dim_h + i]) for i in range(dim_h)]
+    nf = [math.tanh(gxf[2 * dim_h + i] + rf[i] * ghf[2 * dim_h + i]) for i in range(dim_h)]
+    hf = [(1 - zf[i]) * nf[i] + zf[i] * hf[i] for i in range(dim_h)]
+    max_err = max([max_err] + [abs(hf[i] - h[i] / 32768.0) for i in range(dim_h)])
+
+  assert max_err < 0.03, max_err
+  print('GRU: maximum error %f' % max_err)
+  p['input'] = xs
+  p['wt_x'] = reorder_q7_q15(wt_x, 3 * dim_h, dim_x)
+  p['wt_h'] = reorder_q7_q15(wt_h, 3 * dim_h, dim_h)
+  p['bias_x'] = bias_x
+  p['bias_h'] = bias_h
+  return p
+
+
+def lstm_case(rng, dim_x, dim_h, gate_int_width, cell_int_width, tables):
+  sig, tanh = tables
+  gate_frac = 15 - gate_int_width
+  cell_frac = 15 - cell_int_width
+  wx_frac = H_FRAC + W_FRAC - X_FRAC
+  cols = dim_x + dim_h
+  p = dict(dim_x=dim_x, dim_h=dim_h, gate_int_width=gate_int_width, cell_int_width=cell_int_width,
+           seq_len=SEQ_LEN, bias_shift=H_FRAC + W_FRAC - B_FRAC, out_shift=H_FRAC + W_FRAC - gate_frac)
+  # the rows are {W_i; W_f; W_g; W_o}, each over {x, h}
+  wt = []
+  for _ in range(4 * dim_h):
+    wt += quantize(random_tensor(rng, dim_x, 0.15), wx_frac, -128, 127)
+    wt += quantize(random_tensor(rng, dim_h, 0.6), W_FRAC, -128, 127)
+  bias = quantize(random_tensor(rng, 4 * dim_h, 0.5), B_FRAC, -128, 127)
+  xs = quantize(random_tensor(rng, SEQ_LEN * dim_x, 2.0), X_FRAC, -32768, 32767)
+  h = quantize(random_tensor(rng, dim_h, 0.5), H_FRAC, -32768, 32767)
+  c = quantize(random_tensor(rng, dim_h, 1.0), cell_frac, -32768, 32767)
+  p['h_init'] = list(h)
+  p['c_init'] = list(c)
+
+  hf = [v / 32768.0 for v in h]
+  cf = [v / float(1 << cell_frac) for v in c]
+  scales = [2.0 ** -wx_frac] * dim_x + [2.0 ** -W_FRAC] * dim_h
+  p['output'] = []
+  p['cell'] = []
+  max_err = 0.0
+  for t in range(SEQ_LEN):
+    x = xs[t * dim_x:(t + 1) * dim_x]
+    g = fully_connected(x + h, wt, 4 * dim_h, bias, p['bias_shift'], p['out_shift'])
+    i_g = activation(g[:dim_h], gate_int_width, sig)
+    f_g = activation(g[dim_h:2 * dim_h], gate_int_width, sig)
+    g_g = activation(g[2 * dim_h:3 * dim_h], gate_int_width, tanh)
+    o_g = activation(g[3 * dim_h:], gate_int_width, sig)
+    c = [sat16(((f_g[k] * c[k]) >> 15) + ((i_g[k] * g_g[k]) >> (15 + cell_int_width))) for k in range(dim_h)]
+    tc = activation(c, cell_int_width, tanh)
+    h = [sat16((o_g[k] * tc[k]) >> 15) for k in range(dim_h)]
+    p['output'] += h
+    p['cell'] += c
+
+    # floating point
+    vf = [v / float(1 << X_FRAC) for v in x] + hf
+    gf = [sum(wt[r * cols + k] * scales[k] * vf[k] for k in range(cols)) + bias[r] / float(1 << B_FRAC)
+          for r in range(4 * dim_h)]
+    cf = [sigmoid(gf[dim_h + k]) * cf[k] + sigmoid(gf[k]) * math.tanh(gf[2 * dim_h + k]) for k in range(dim_h)]
+    hf = [sigmoid(gf[3 * dim_h + k]) * math.tanh(cf[k]) for k in range(dim_h)]
+    max_err = max([max_err] + [abs(hf[k] - h[k] / 32768.0) for k in range(dim_h)] +
+                  [abs(cf[k] - c[k] / float(1 << cell_frac)) for k in range(dim_h)])
+
+  assert max_err < 0.03, max_err
+  print('LSTM: maximum error %f' % max_err)
+  p['input'] = xs
+  p['wt'] = reorder_q7_q15(wt, 4 * dim_h, cols)
+  p['bias'] = bias
+  return p
+
+
+def array(name, values):
+  return '#define %s {%s}\n' % (name, ','.join(str(v) for v in values))
+
+
+def scalars(prefix, p, keys):
+  return ''.join('#define %s_%s %d\n' % (prefix, k.upper(), p[k]) for k in keys)
+
+
+def main():
+  here = os.path.dirname(os.path.abspath(__file__))
+  path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+      here, '..', '..', 'NN_Lib_Tests', 'nn_test', 'Ref_Implementations', 'rnn_golden_vectors.h')
+  table_file = os.path.join(here, '..', '..', 'Source', 'NNSupportFunctions', 'arm_nntables.c')
+  tables = (load_table(table_file, 'sigmoidTable_q15'), load_table(table_file, 'tanhTable_q15'))
+  rng = random.Random(20261018)
+
+  text = '/* Generated by Scripts/NNFunctions/rnn_golden_vector_generation.py, do not edit. */\n\n'
+
+  # 21 gate rows and an odd input length exercise the left-overs of the opt kernel
+  p = gru_case(rng, 5, 7, 2, tables)
+  text += scalars('RNN_GRU', p, ['dim_x', 'dim_h', 'seq_len', 'bias_shift_x', 'out_shift_x', 'bias_shift_h',
+                                 'out_shift_h', 'gate_int_width'])
+  text += array('RNN_GRU_WT_X', p['wt_x'])
+  text += array('RNN_GRU_BIAS_X', p['bias_x'])
+  text += array('RNN_GRU_WT_H', p['wt_h'])
+  text += array('RNN_GRU_BIAS_H', p['bias_h'])
+  text += array('RNN_GRU_INPUT', p['input'])
+  text += array('RNN_GRU_H_INIT', p['h_init'])
+  text += array('RNN_GRU_OUTPUT', p['output'])
+  text += '\n'
+
+  p = lstm_case(rng, 5, 6, 3, 2, tables)
+  text += scalars('RNN_LSTM', p, ['dim_x', 'dim_h', 'seq_len', 'bias_shift', 'out_shift', 'gate_int_width',
+                                  'cell_int_width'])
+  text += array('RNN_LSTM_WT', p['wt'])
+  text += array('RNN_LSTM_BIAS', p['bias'])
+  text += array('RNN_LSTM_INPUT', p['input'])
+  text += array('RNN_LSTM_H_INIT', p['h_init'])
+  text += array('RNN_LSTM_C_INIT', p['c_init'])
+  text += array('RNN_LSTM_OUTPUT', p['output'])
+  text += array('RNN_LSTM_CELL', p['cell'])
+
+  with open(path, 'w') as f:
+    f.write(text)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
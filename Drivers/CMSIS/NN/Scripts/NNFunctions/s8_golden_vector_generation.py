@@ -0,0 +1,466 @@
+#!/usr/bin/env python
+#
+# Golden vectors for the int8 asymmetric kernels (arm_*_s8).
+#
+# Random tensors are quantized the way TensorFlow Lite quantizes them:
+# asymmetric int8 activations, symmetric int8 weights with a scale per
+# output channel, and int32 bias with the scale input_scale * weight_scale.
+# The expected outputs are computed with the integer arithmetic of the
+# TensorFlow Lite reference kernels and written, together with the inputs and
+# the quantization parameters, to
+#
+#   NN_Lib_Tests/nn_test/Ref_Implementations/s8_golden_vectors.h
+#
+# Each case is also checked against the floating-point result, so a mistake in
+# the quantization parameters cannot go unnoticed.
+#
+# Usage: s8_golden_vector_generation.py [output header]
+
+from __future__ import print_function
+
+import math
+import os
+import random
+import sys
+
+Q31_MAX = (1 << 31) - 1
+Q31_MIN = -(1 << 31)
+
+
+def wrap32(x):
+  x &= 0xFFFFFFFF
+  return x - (1 << 32) if x & 0x80000000 else x
+
+
+def sat_doubling_high_mult(a, b):
+  if a == b == Q31_MIN:
+    return Q31_MAX
+  ab = a * b + ((1 << 30) if (a < 0) == (b < 0) else 1 - (1 << 30))
+  # truncating division, as in C
+  q = abs(ab) >> 31
+  return q if ab >= 0 else -q
+
+
+def divide_by_power_of_two(x, exponent):
+  mask = (1 << exponent) - 1
+  remainder = x & mask
+  result = x >> exponent
+  threshold = (mask >> 1) + (1 if result < 0 else 0)
+  return result + 1 if remainder > threshold else result
+
+
+def requantize(val, mult, shift):
+  left = max(shift, 0)
+  right = max(-shift, 0)
+  return divide_by_power_of_two(sat_doubling_high_mult(wrap32(val * (1 << left)), mult), right)
+
+
+def round_away(x):
+  return int(math.floor(abs(x) + 0.5)) * (1 if x >= 0 else -1)
+
+
+def quantize_multiplier(real):
+  """QuantizeMultiplier(): real = mult * 2^(shift - 31)."""
+  if real == 0.0:
+    return 0, 0
+  q, shift = math.frexp(real)
+  mult = round_away(q * (1 << 31))
+  if mult == (1 << 31):
+    mult //= 2
+    shift += 1
+  if shift < -31:
+    return 0, 0
+  return mult, shift
+
+
+def clamp(x, lo, hi):
+  return min(max(x, lo), hi)
+
+
+# Quantization of random data
+
+def quantize_asym(values, scale, zero_point):
+  return [clamp(round_away(v / scale) + zero_point, -128, 127) for v in values]
+
+
+def random_tensor(rng, size, lo, hi):
+  return [rng.uniform(lo, hi) for _ in range(size)]
+
+
+def asym_params(lo, hi):
+  scale = (hi - lo) / 255.0
+  zero_point = clamp(round_away(-128 - lo / scale), -128, 127)
+  return scale, zero_point
+
+
+def per_channel_weights(rng, channels, per_channel):
+  weights = []
+  scales = []
+  for _ in range(channels):
+    w = random_tensor(rng, per_channel, -1.0, 1.0)
+    scale = max(abs(v) for v in w) / 127.0
+    weights.append([clamp(round_away(v / scale), -127, 127) for v in w])
+    scales.append(scale)
+  return weights, scales
+
+
+# Reference kernels
+
+def conv_s8(p):
+  out = []
+  for oy in range(p['output_y']):
+    for ox in range(p['output_x']):
+      for oc in range(p['output_ch']):
+        acc = p['bias'][oc]
+        for ky in range(p['kernel_y']):
+          for kx in range(p['kernel_x']):
+            iy = oy * p['stride_y'] - p['pad_y'] + ky
+            ix = ox * p['stride_x'] - p['pad_x'] + kx
+            if 0 <= iy < p['input_y'] and 0 <= ix < p['input_x']:
+              for ic in range(p['input_ch']):
+                x = p['input'][(iy * p['input_x'] + ix) * p['input_ch'] + ic]
+                w = p['kernel'][((oc * p['kernel_y'] + ky) * p['kernel_x'] + kx) * p['input_ch'] + ic]
+                acc += (x + p['input_offset']) * w
+        acc = requantize(acc, p['output_mult'][oc], p['output_shift'][oc]) + p['output_offset']
+        out.append(clamp(acc, p['act_min'], p['act_max']))
+  return out
+
+
+def depthwise_conv_s8(p):
+  out = []
+  output_ch = p['input_ch'] * p['ch_mult']
+  for oy in range(p['output_y']):
+    for ox in range(p['output_x']):
+      for oc in range(output_ch):
+        ic = oc // p['ch_mult']
+        acc = p['bias'][oc]
+        for ky in range(p['kernel_y']):
+          for kx in range(p['kernel_x']):
+            iy = oy * p['stride_y'] - p['pad_y'] + ky
+            ix = ox * p['stride_x'] - p['pad_x'] + kx
+            if 0 <= iy < p['input_y'] and 0 <= ix < p['input_x']:
+              x = p['input'][(iy * p['input_x'] + ix) * p['input_ch'] + ic]
+              w = p['kernel'][(ky * p['kernel_x'] + kx) * output_ch + oc]
+              acc += (x + p['input_offset']) * w
+        acc = requantize(acc, p['output_mult'][oc], p['output_shift'][oc]) + p['output_offset']
+        out.append(clamp(acc, p['act_min'], p['act_max']))
+  return out
+
+
+def fully_connected_s8(p):
+  out = []
+  for r in range(p['rows']):
+    acc = p['bias'][r]
+    for c in range(p['cols']):
+      acc += (p['input'][c] + p['input_offset']) * p['weights'][r * p['cols'] + c]
+    acc = requantize(acc, p['output_mult'], p['output_shift']) + p['output_offset']
+    out.append(clamp(acc, p['act_min'], p['act_max']))
+  return out
+
+
+def pool_s8(p, average):
+  out = []
+  for oy in range(p['output_y']):
+    for ox in range(p['output_x']):
+      for c in range(p['ch']):
+        values = []
+        for ky in range(p['kernel_y']):
+          for kx in range(p['kernel_x']):
+            iy = oy * p['stride_y'] - p['pad_y'] + ky
+            ix = ox * p['stride_x'] - p['pad_x'] + kx
+            if 0 <= iy < p['input_y'] and 0 <= ix < p['input_x']:
+              values.append(p['input'][(iy * p['input_x'] + ix) * p['ch'] + c])
+        if average:
+          s, n = sum(values), len(values)
+          # rounding half away from zero
+          v = (s + n // 2) // n if s > 0 else -((-s + n // 2) // n)
+        else:
+          v = max(values)
+        out.append(clamp(v, p['act_min'], p['act_max']))
+  return out
+
+
+def mult_by_power_of_two(val, exp):
+  thresh = (1 << (31 - exp)) - 1
+  if val > thresh:
+    return Q31_MAX
+  if val < -thresh:
+    return Q31_MIN
+  return wrap32(val << exp)
+
+
+def exp_on_negative_values(val):
+  shift = 24
+  val_mod_minus_quarter = (val & ((1 << shift) - 1)) - (1 << shift)
+  remainder = val_mod_minus_quarter - val
+  x = wrap32(val_mod_minus_quarter << 5) + (1 << 28)
+  x2 = sat_doubling_high_mult(x, x)
+  x4_over_4 = divide_by_power_of_two(sat_doubling_high_mult(x2, x2), 2)
+  poly = divide_by_power_of_two(sat_doubling_high_mult(x4_over_4 + sat_doubling_high_mult(x2, x), 715827883) + x2, 1)
+  result = 1895147668 + sat_doubling_high_mult(1895147668, x + poly)
+  for k in (1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242):
+    if remainder & (1 << shift):
+      result = sat_doubling_high_mult(result, k)
+    shift += 1
+  return Q31_MAX if val == 0 else result
+
+
+def one_over_one_plus_x_for_x_in_0_1(val):
+  half_denominator = (val + Q31_MAX + 1) // 2
+  one = 1 << 29
+  x = 1515870810 + sat_doubling_high_mult(half_denominator, -1010580540)
+  for _ in range(3):
+    x += mult_by_power_of_two(sat_doubling_high_mult(x, one - sat_doubling_high_mult(half_denominator, x)), 2)
+  return mult_by_power_of_two(x, 1)
+
+
+def clz32(x):
+  n = 0
+  while n < 32 and not x & (0x80000000 >> n):
+    n += 1
+  return n
+
+
+def softmax_s8(p):
+  accum_bits = 12
+  out = []
+  for r in range(p['rows']):
+    row = p['input'][r * p['cols']:(r + 1) * p['cols']]
+    m = max(row)
+    exps = []
+    for v in row:
+      diff = v - m
+      if diff >= p['diff_min']:
+        exps.append(exp_on_negative_values(sat_doubling_high_mult(diff * (1 << p['shift']), p['mult'])))
+      else:
+        exps.append(None)
+    total = sum(divide_by_power_of_two(e, accum_bits) for e in exps if e is not None)
+    headroom = clz32(total)
+    bits_over_unit = accum_bits - headroom + 23
+    shifted_scale = one_over_one_plus_x_for_x_in_0_1(((total << headroom) & 0xFFFFFFFF) - 0x80000000)
+    for e in exps:
+      if e is None:
+        out.append(-128)
+      else:
+        res = divide_by_power_of_two(sat_doubling_high_mult(shifted_scale, e), bits_over_unit) - 128
+        out.append(clamp(res, -128, 127))
+  return out
+
+
+# Test cases
+
+def conv_case(rng, input_x, input_y, input_ch, output_ch, kernel_x, kernel_y, pad_x, pad_y, stride_x, stride_y):
+  in_scale, in_zp = asym_params(-1.0, 3.0)
+  out_scale, out_zp = asym_params(-6.0, 10.0)
+  output_x = (input_x + 2 * pad_x - kernel_x) // stride_x + 1
+  output_y = (input_y + 2 * pad_y - kernel_y) // stride_y + 1
+
+  real_in = random_tensor(rng, input_x * input_y * input_ch, -1.0, 3.0)
+  weights, w_scales = per_channel_weights(rng, output_ch, kernel_x * kernel_y * input_ch)
+  real_bias = random_tensor(rng, output_ch, -0.5, 0.5)
+
+  p = dict(input_x=input_x, input_y=input_y, input_ch=input_ch, output_ch=output_ch,
+           kernel_x=kernel_x, kernel_y=kernel_y, pad_x=pad_x, pad_y=pad_y,
+           stride_x=stride_x, stride_y=stride_y, output_x=output_x, output_y=output_y,
+           input_offset=-in_zp, output_offset=out_zp, act_min=-128, act_max=127)
+  p['input'] = quantize_asym(real_in, in_scale, in_zp)
+  p['kernel'] = [w for row in weights for w in row]
+  p['bias'] = [round_away(b / (in_scale * s)) for b, s in zip(real_bias, w_scales)]
+  quant = [quantize_multiplier(in_scale * s / out_scale) for s in w_scales]
+  p['output_mult'] = [m for m, _ in quant]
+  p['output_shift'] = [s for _, s in quant]
+  p['output'] = conv_s8(p)
+
+  # floating-point check on the dequantized inputs
+  for i, q in enumerate(p['output']):
+    oc = i % output_ch
+    pix = i // output_ch
+    oy, ox = divmod(pix, output_x)
+    acc = p['bias'][oc] * in_scale * w_scales[oc]
+    for ky in range(kernel_y):
+      for kx in range(kernel_x):
+        iy = oy * stride_y - pad_y + ky
+        ix = ox * stride_x - pad_x + kx
+        if 0 <= iy < input_y and 0 <= ix < input_x:
+          for ic in range(input_ch):
+            x = (p['input'][(iy * input_x + ix) * input_ch + ic] - in_zp) * in_scale
+            w = p['kernel'][((oc * kernel_y + ky) * kernel_x + kx) * input_ch + ic] * w_scales[oc]
+            acc += x * w
+    expected = clamp(round_away(acc / out_scale) + out_zp, -128, 127)
+    assert abs(expected - q) <= 1, (i, expected, q)
+  return p
+
+
+def depthwise_case(rng, input_x, input_y, input_ch, ch_mult, kernel_x, kernel_y, pad_x, pad_y, stride_x, stride_y):
+  in_scale, in_zp = asym_params(-2.0, 2.0)
+  out_scale, out_zp = asym_params(-4.0, 3.0)
+  output_ch = input_ch * ch_mult
+  output_x = (input_x + 2 * pad_x - kernel_x) // stride_x + 1
+  output_y = (input_y + 2 * pad_y - kernel_y) // stride_y + 1
+
+  real_in = random_tensor(rng, input_x * input_y * input_ch, -2.0, 2.0)
+  weights, w_scales = per_channel_weights(rng, output_ch, kernel_x * kernel_y)
+  real_bias = random_tensor(rng, output_ch, -0.5, 0.5)
+
+  p = dict(input_x=input_x, input_y=input_y, input_ch=input_ch, ch_mult=ch_mult, output_ch=output_ch,
+           kernel_x=kernel_x, kernel_y=kernel_y, pad_x=pad_x, pad_y=pad_y,
+           stride_x=stride_x, stride_y=stride_y, output_x=output_x, output_y=output_y,
+           input_offset=-in_zp, output_offset=out_zp, act_min=-100, act_max=100)
+  p['input'] = quantize_asym(real_in, in_scale, in_zp)
+  # [kernel_y, kernel_x, output_ch]
+  p['kernel'] = [weights[oc][k] for k in range(kernel_x * kernel_y) for oc in range(output_ch)]
+  p['bias'] = [round_away(b / (in_scale * s)) for b, s in zip(real_bias, w_scales)]
+  quant = [quantize_multiplier(in_scale * s / out_scale) for s in w_scales]
+  p['output_mult'] = [m for m, _ in quant]
+  p['output_shift'] = [s for _, s in quant]
+  p['output'] = depthwise_conv_s8(p)
+
+  for i, q in enumerate(p['output']):
+    oc = i % output_ch
+    pix = i // output_ch
+    oy, ox = divmod(pix, output_x)
+    acc = p['bias'][oc] * in_scale * w_scales[oc]
+    for ky in range(kernel_y):
+      for kx in range(kernel_x):
+        iy = oy * stride_y - pad_y + ky
+        ix = ox * stride_x - pad_x + kx
+        if 0 <= iy < input_y and 0 <= ix < input_x:
+          x = (p['input'][(iy * input_x + ix) * input_ch + oc // ch_mult] - in_zp) * in_scale
+          acc += x * p['kernel'][(ky * kernel_x + kx) * output_ch + oc] * w_scales[oc]
+    expected = clamp(round_away(acc / out_scale) + out_zp, -100, 100)
+    assert abs(expected - q) <= 1, (i, expected, q)
+  return p
+
+
+def fc_case(rng, cols, rows):
+  in_scale, in_zp = asym_params(-3.0, 1.0)
+  out_scale, out_zp = asym_params(-8.0, 8.0)
+
+  real_in = random_tensor(rng, cols, -3.0, 1.0)
+  real_w = random_tensor(rng, rows * cols, -0.5, 0.5)
+  w_scale = max(abs(v) for v in real_w) / 127.0
+  real_bias = random_tensor(rng, rows, -1.0, 1.0)
+
+  p = dict(cols=cols, rows=rows, input_offset=-in_zp, output_offset=out_zp, act_min=-128, act_max=127)
+  p['input'] = quantize_asym(real_in, in_scale, in_zp)
+  p['weights'] = [clamp(round_away(v / w_scale), -127, 127) for v in real_w]
+  p['bias'] = [round_away(b / (in_scale * w_scale)) for b in real_bias]
+  p['output_mult'], p['output_shift'] = quantize_multiplier(in_scale * w_scale / out_scale)
+  p['output'] = fully_connected_s8(p)
+
+  for r, q in enumerate(p['output']):
+    acc = p['bias'][r] * in_scale * w_scale
+    for c in range(cols):
+      acc += (p['input'][c] - in_zp) * in_scale * p['weights'][r * cols + c] * w_scale
+    expected = clamp(round_away(acc / out_scale) + out_zp, -128, 127)
+    assert abs(expected - q) <= 1, (r, expected, q)
+  return p
+
+
+def pool_case(rng, input_x, input_y, ch, kernel_x, kernel_y, pad_x, pad_y, stride_x, stride_y, act_min, act_max):
+  p = dict(input_x=input_x, input_y=input_y, ch=ch, kernel_x=kernel_x, kernel_y=kernel_y,
+           pad_x=pad_x, pad_y=pad_y, stride_x=stride_x, stride_y=stride_y,
+           output_x=(input_x + 2 * pad_x - kernel_x) // stride_x + 1,
+           output_y=(input_y + 2 * pad_y - kernel_y) // stride_y + 1,
+           act_min=act_min, act_max=act_max)
+  p['input'] = [rng.randint(-128, 127) for _ in range(input_x * input_y * ch)]
+  p['avg_output'] = pool_s8(p, True)
+  p['max_output'] = pool_s8(p, False)
+  return p
+
+
+def softmax_case(rng, rows, cols, in_scale, beta):
+  scaled_diff_integer_bits = 5
+  # PreprocessSoftmaxScaling()
+  real_mult = min(beta * in_scale * (1 << (31 - scaled_diff_integer_bits)), float(Q31_MAX))
+  mult, shift = quantize_multiplier(real_mult)
+  assert shift >= 0
+  # CalculateInputRadius()
+  radius = ((1 << scaled_diff_integer_bits) - 1) * (1 << (31 - scaled_diff_integer_bits)) / float(1 << shift)
+  p = dict(rows=rows, cols=cols, mult=mult, shift=shift, diff_min=-int(math.floor(radius)))
+  p['input'] = [rng.randint(-128, 127) for _ in range(rows * cols)]
+  p['output'] = softmax_s8(p)
+
+  for r in range(rows):
+    row = p['input'][r * cols:(r + 1) * cols]
+    e = [math.exp(beta * in_scale * (v - max(row))) for v in row]
+    for c in range(cols):
+      expected = clamp(round_away(e[c] / sum(e) * 256) - 128, -128, 127)
+      assert abs(expected - p['output'][r * cols + c]) <= 1, (r, c, expected, p['output'][r * cols + c])
+  return p
+
+
+def array(name, values):
+  return '#define %s {%s}\n' % (name, ','.join(str(v) for v in values))
+
+
+def scalars(prefix, p, keys):
+  return ''.join('#define %s_%s %d\n' % (prefix, k.upper(), p[k]) for k in keys)
+
+
+def main():
+  here = os.path.dirname(os.path.abspath(__file__))
+  path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+      here, '..', '..', 'NN_Lib_Tests', 'nn_test', 'Ref_Implementations', 's8_golden_vectors.h')
+  rng = random.Random(20181018)
+
+  conv_keys = ['input_x', 'input_y', 'input_ch', 'output_ch', 'kernel_x', 'kernel_y', 'pad_x', 'pad_y',
+               'stride_x', 'stride_y', 'output_x', 'output_y', 'input_offset', 'output_offset',
+               'act_min', 'act_max']
+  dw_keys = conv_keys + ['ch_mult']
+  pool_keys = ['input_x', 'input_y', 'ch', 'kernel_x', 'kernel_y', 'pad_x', 'pad_y', 'stride_x', 'stride_y',
+               'output_x', 'output_y', 'act_min', 'act_max']
+
+  text = '/* Generated by Scripts/NNFunctions/s8_golden_vector_generation.py, do not edit. */\n\n'
+
+  # odd number of output pixels and output channels, 3x3 kernel
+  for name, p in (('S8_CONV1', conv_case(rng, 7, 5, 3, 5, 3, 3, 1, 1, 1, 1)),
+                  # non-square kernel and stride
+                  ('S8_CONV2', conv_case(rng, 9, 6, 4, 6, 2, 3, 0, 1, 2, 2))):
+    text += scalars(name, p, conv_keys)
+    text += array(name + '_INPUT', p['input'])
+    text += array(name + '_KERNEL', p['kernel'])
+    text += array(name + '_BIAS', p['bias'])
+    text += array(name + '_OUTPUT_MULT', p['output_mult'])
+    text += array(name + '_OUTPUT_SHIFT', p['output_shift'])
+    text += array(name + '_OUTPUT', p['output'])
+    text += '\n'
+
+  p = depthwise_case(rng, 6, 6, 3, 2, 3, 3, 1, 1, 2, 2)
+  text += scalars('S8_DW', p, dw_keys)
+  text += array('S8_DW_INPUT', p['input'])
+  text += array('S8_DW_KERNEL', p['kernel'])
+  text += array('S8_DW_BIAS', p['bias'])
+  text += array('S8_DW_OUTPUT_MULT', p['output_mult'])
+  text += array('S8_DW_OUTPUT_SHIFT', p['output_shift'])
+  text += array('S8_DW_OUTPUT', p['output'])
+  text += '\n'
+
+  p = fc_case(rng, 37, 9)
+  text += scalars('S8_FC', p, ['cols', 'rows', 'input_offset', 'output_offset', 'output_mult', 'output_shift',
+                               'act_min', 'act_max'])
+  text += array('S8_FC_INPUT', p['input'])
+  text += array('S8_FC_WEIGHTS', p['weights'])
+  text += array('S8_FC_BIAS', p['bias'])
+  text += array('S8_FC_OUTPUT', p['output'])
+  text += '\n'
+
+  p = pool_case(rng, 7, 7, 5, 3, 3, 1, 1, 2, 2, -90, 110)
+  text += scalars('S8_POOL', p, pool_keys)
+  text += array('S8_POOL_INPUT', p['input'])
+  text += array('S8_POOL_AVG_OUTPUT', p['avg_output'])
+  text += array('S8_POOL_MAX_OUTPUT', p['max_output'])
+  text += '\n'
+
+  p = softmax_case(rng, 3, 10, 0.15, 1.0)
+  text += scalars('S8_SOFTMAX', p, ['rows', 'cols', 'mult', 'shift', 'diff_min'])
+  text += array('S8_SOFTMAX_INPUT', p['input'])
+  text += array('S8_SOFTMAX_OUTPUT', p['output'])
+
+  with open(path, 'w') as f:
+    f.write(text)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_1d_q7.c
+ * Description:  Q7 version of 1-D (temporal) convolution
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief Computes all output channels of one column
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       col         pointer to the q15 column
+ * @param[in]       ch_im_out   number of filters
+ * @param[in]       num_col     length of the column
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in,out]   pOut        pointer to output
+ * @return     The function returns the incremented output pointer
+ */
+
+static q7_t *conv_1d_column_q7( const q7_t *wt,
+                                const q15_t *col,
+                                const uint16_t ch_im_out,
+                                const uint16_t num_col,
+                                const q7_t *bias,
+                                const uint16_t bias_shift,
+                                const uint16_t out_shift,
+                                q7_t *pOut )
+{
+    const q7_t *pA = wt;
+    int       i;
+
+    for( i = 0; i < ch_im_out; i++ )
+    {
+        /* Load the accumulator with bias first */
+        q31_t     sum = ( ( q31_t )bias[i] << bias_shift ) + NN_ROUND( out_shift );
+        const q15_t *pB = col;
+        uint16_t  colCnt;
+
+#if defined (ARM_MATH_DSP)
+        /* Each time it process 4 entries */
+        colCnt = num_col >> 2;
+
+        while( colCnt )
+        {
+            q31_t     inA1, inA2;
+            q31_t     inB1, inB2;
+
+            pA = ( q7_t * ) read_and_pad( ( void * )pA, &inA1, &inA2 );
+
+            inB1 = *__SIMD32( pB )++;
+            sum = __SMLAD( inA1, inB1, sum );
+            inB2 = *__SIMD32( pB )++;
+            sum = __SMLAD( inA2, inB2, sum );
+
+            colCnt--;
+        }
+
+        colCnt = num_col & 0x3;
+#else
+        colCnt = num_col;
+#endif                          /* ARM_MATH_DSP */
+
+        while( colCnt )
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            sum += inA1 * inB1;
+            colCnt--;
+        }
+
+        *pOut++ = ( q7_t ) __SSAT( ( sum >> out_shift ), 8 );
+    }
+
+    return pOut;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief Q7 1-D convolution function
+ * @param[in]       Im_in       pointer to input tensor, dim_im_in frames of ch_im_in values
+ * @param[in]       dim_im_in   input tensor length
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding size before the first frame
+ * @param[in]       stride      convolution stride
+ * @param[in]       dilation    distance between the taps of the kernel
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @param[in]       dim_im_out  output tensor length
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*ch_im_in*dim_kernel
+ *
+ * Output frame i is computed from the input frames
+ * i*stride - padding + k*dilation, k = 0 .. dim_kernel-1, and frames
+ * outside the input count as zero. The weights are laid out as for
+ * arm_convolve_HWC_q7_basic_nonsquare() with a 1 x dim_kernel kernel, i.e.
+ * [ch_im_out][dim_kernel][ch_im_in].
+ *
+ * A causal convolution, where each output depends on the current and past
+ * frames only, uses padding = (dim_kernel-1)*dilation and
+ * dim_im_out = dim_im_in. arm_convolve_1d_stream_q7() computes the same
+ * outputs one frame at a time.
+ *
+ * Compared with a 1 x N image through the 2-D functions, the im2col
+ * runs over a single dimension and gathers one frame of ch_im_in values
+ * per tap. On cores without the DSP extension no im2col is done at all.
+ *
+ * The function returns ARM_MATH_ARGUMENT_ERROR if the stride or the
+ * dilation is zero.
+ */
+
+arm_status arm_convolve_1d_q7( const q7_t *Im_in,
+                               const uint16_t dim_im_in,
+                               const uint16_t ch_im_in,
+                               const q7_t *wt,
+                               const uint16_t ch_im_out,
+                               const uint16_t dim_kernel,
+                               const uint16_t padding,
+                               const uint16_t stride,
+                               const uint16_t dilation,
+                               const q7_t *bias,
+                               const uint16_t bias_shift,
+                               const uint16_t out_shift,
+                               q7_t *Im_out,
+                               const uint16_t dim_im_out,
+                               q15_t *bufferA )
+{
+    int32_t   i_out, i_ker, i_in;
+    q7_t     *pOut = Im_out;
+#if defined (ARM_MATH_DSP)
+    const uint16_t num_col = ch_im_in * dim_kernel;
+    q15_t    *pBuffer = bufferA;
+#else
+    uint16_t  i, l;
+#endif                          /* ARM_MATH_DSP */
+
+    if( stride == 0 || dilation == 0 )
+    {
+        /* check if the argument constraints are met */
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    /* This part implements the im2col function */
+    for( i_out = 0; i_out < dim_im_out; i_out++ )
+    {
+        i_in = i_out * stride - padding;
+
+        for( i_ker = 0; i_ker < dim_kernel; i_ker++ )
+        {
+            if( i_in < 0 || i_in >= dim_im_in )
+            {
+                /* Filling 0 for out-of-bound paddings */
+                memset( pBuffer, 0, sizeof( q15_t ) * ch_im_in );
+            }
+            else
+            {
+                /* Copying the frame to the column */
+                arm_q7_to_q15_no_shift( ( q7_t * ) Im_in + i_in * ch_im_in, pBuffer, ch_im_in );
+            }
+
+            pBuffer += ch_im_in;
+            i_in += dilation;
+        }
+
+        /* Computation is done for every 2 columns */
+        if( pBuffer == bufferA + 2 * num_col )
+        {
+            pOut = arm_nn_mat_mult_kernel_q7_q15( wt, bufferA, ch_im_out, num_col, bias_shift, out_shift, bias, pOut );
+
+            /* counter reset */
+            pBuffer = bufferA;
+        }
+    }
+
+    /* left-over because odd number of output frames */
+    if( pBuffer != bufferA )
+    {
+        conv_1d_column_q7( wt, bufferA, ch_im_out, num_col, bias, bias_shift, out_shift, pOut );
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    for( i_out = 0; i_out < dim_im_out; i_out++ )
+    {
+        for( i = 0; i < ch_im_out; i++ )
+        {
+            q31_t     sum = ( ( q31_t )bias[i] << bias_shift ) + NN_ROUND( out_shift );
+            const q7_t *pA = wt + i * ch_im_in * dim_kernel;
+
+            i_in = i_out * stride - padding;
+
+            /* taps that fall into the padding are skipped */
+            for( i_ker = 0; i_ker < dim_kernel; i_ker++ )
+            {
+                if( i_in >= 0 && i_in < dim_im_in )
+                {
+                    const q7_t *pB = Im_in + i_in * ch_im_in;
+
+                    for( l = 0; l < ch_im_in; l++ )
+                    {
+                        sum += pA[l] * pB[l];
+                    }
+                }
+
+                pA += ch_im_in;
+                i_in += dilation;
+            }
+
+            *pOut++ = ( q7_t ) __SSAT( ( sum >> out_shift ), 8 );
+        }
+    }
+
+    ( void ) bufferA;
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Initialization function for the Q7 streaming 1-D convolution
+ * @param[in,out]   S           points to an instance of the Q7 streaming 1-D convolution structure
+ * @param[in]       ch_im_in    number of input channels
+ * @param[in]       wt          pointer to kernel weights
+ * @param[in]       ch_im_out   number of filters, i.e., output channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       dilation    distance between the taps of the kernel
+ * @param[in]       bias        pointer to bias
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       pState      pointer to the state buffer
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * pState size: ((dim_kernel-1)*dilation+1)*ch_im_in
+ *
+ * The state is a ring buffer of the last (dim_kernel-1)*dilation+1 input
+ * frames. It is cleared, so the first outputs see zeros for the frames
+ * before the start of the stream, as a causal convolution does.
+ */
+
+arm_status arm_convolve_1d_stream_init_q7( arm_convolve_1d_instance_q7 *S,
+        const uint16_t ch_im_in,
+        const q7_t *wt,
+        const uint16_t ch_im_out,
+        const uint16_t dim_kernel,
+        const uint16_t dilation,
+        const q7_t *bias,
+        const uint16_t bias_shift,
+        const uint16_t out_shift,
+        q7_t *pState )
+{
+    if( dim_kernel == 0 || dilation == 0 )
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    S->ch_im_in = ch_im_in;
+    S->ch_im_out = ch_im_out;
+    S->dim_kernel = dim_kernel;
+    S->dilation = dilation;
+    S->wt = wt;
+    S->bias = bias;
+    S->bias_shift = bias_shift;
+    S->out_shift = out_shift;
+    S->stateLength = ( dim_kernel - 1 ) * dilation + 1;
+    S->stateIndex = 0;
+    S->pState = pState;
+
+    memset( pState, 0, S->stateLength * ch_im_in );
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Q7 streaming 1-D convolution function
+ * @param[in,out]   S           points to an instance of the Q7 streaming 1-D convolution structure
+ * @param[in]       pSrc        pointer to blockSize input frames
+ * @param[out]      pDst        pointer to blockSize output frames
+ * @param[in]       blockSize   number of frames to process
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: ch_im_in*dim_kernel
+ *
+ * Each input frame is written to the ring buffer of the instance and only
+ * the output frame that it completes is computed, with stride 1. The
+ * outputs are the ones of arm_convolve_1d_q7() with causal padding on the
+ * whole stream, so a detector can run one step per new sensor frame
+ * instead of recomputing the whole window.
+ */
+
+void arm_convolve_1d_stream_q7( arm_convolve_1d_instance_q7 *S,
+                                const q7_t *pSrc,
+                                q7_t *pDst,
+                                uint32_t blockSize,
+                                q15_t *bufferA )
+{
+    const uint16_t ch_im_in = S->ch_im_in;
+    const uint16_t stateLength = S->stateLength;
+    uint16_t  index = S->stateIndex;
+    uint16_t  i_ker;
+
+    while( blockSize > 0u )
+    {
+        q15_t    *pBuffer = bufferA;
+
+        /* the newest frame replaces the oldest one */
+        memcpy( S->pState + index * ch_im_in, pSrc, ch_im_in );
+        pSrc += ch_im_in;
+
+        if( ++index == stateLength )
+        {
+            index = 0;
+        }
+
+        /* the oldest frame of the window is now at index */
+        for( i_ker = 0; i_ker < S->dim_kernel; i_ker++ )
+        {
+            uint32_t  frame = index + ( uint32_t ) i_ker * S->dilation;
+
+            if( frame >= stateLength )
+            {
+                frame -= stateLength;
+            }
+
+            arm_q7_to_q15_no_shift( S->pState + frame * ch_im_in, pBuffer, ch_im_in );
+            pBuffer += ch_im_in;
+        }
+
+        pDst = conv_1d_column_q7( S->wt, bufferA, S->ch_im_out, ch_im_in * S->dim_kernel, S->bias, S->bias_shift,
+                                  S->out_shift, pDst );
+
+        blockSize--;
+    }
+
+    S->stateIndex = index;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_s8.c
+ * Description:  int8 asymmetric version of convolution with per-channel requantization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief int8 convolution function with per-channel requantization
+ * @param[in]       input               pointer to input tensor
+ * @param[in]       input_x             input tensor dimension x
+ * @param[in]       input_y             input tensor dimension y
+ * @param[in]       input_ch            number of input tensor channels
+ * @param[in]       kernel              pointer to kernel weights
+ * @param[in]       output_ch           number of filters, i.e., output tensor channels
+ * @param[in]       kernel_x            filter kernel size x
+ * @param[in]       kernel_y            filter kernel size y
+ * @param[in]       pad_x               padding size x
+ * @param[in]       pad_y               padding size y
+ * @param[in]       stride_x            convolution stride x
+ * @param[in]       stride_y            convolution stride y
+ * @param[in]       bias                pointer to per-channel int32 bias
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_shift        pointer to per-channel output shifts
+ * @param[in]       output_mult         pointer to per-channel output multipliers
+ * @param[in]       out_offset          output zero point
+ * @param[in]       input_offset        negated input zero point, in the range [-127, 128]
+ * @param[in]       out_activation_min  minimum output value, usually -128
+ * @param[in]       out_activation_max  maximum output value, usually 127
+ * @param[in]       output_x            output tensor dimension x
+ * @param[in]       output_y            output tensor dimension y
+ * @param[in,out]   buffer_a            pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * buffer_a size: 2*input_ch*kernel_x*kernel_y
+ *
+ * The tensors are in HWC order and the weights in [output_ch, kernel_y,
+ * kernel_x, input_ch] order, as exported by TensorFlow Lite. The weights
+ * are symmetric, so they have no zero point. Padded positions take the
+ * value of the input zero point, i.e. they contribute nothing.
+ *
+ * The im2col scheme of the q7 functions is used: two columns are expanded
+ * to q15 with the input offset added and multiplied with the weights by
+ * arm_nn_mat_mult_kernel_s8_s16(). Each accumulator is then rescaled with
+ * arm_nn_requantize() using the multiplier and shift of its channel.
+ */
+
+arm_status arm_convolve_s8( const q7_t *input,
+                            const uint16_t input_x,
+                            const uint16_t input_y,
+                            const uint16_t input_ch,
+                            const q7_t *kernel,
+                            const uint16_t output_ch,
+                            const uint16_t kernel_x,
+                            const uint16_t kernel_y,
+                            const uint16_t pad_x,
+                            const uint16_t pad_y,
+                            const uint16_t stride_x,
+                            const uint16_t stride_y,
+                            const int32_t *bias,
+                            q7_t *output,
+                            const int32_t *output_shift,
+                            const int32_t *output_mult,
+                            const int32_t out_offset,
+                            const int32_t input_offset,
+                            const int32_t out_activation_min,
+                            const int32_t out_activation_max,
+                            const uint16_t output_x,
+                            const uint16_t output_y,
+                            q15_t *buffer_a )
+{
+    int32_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    const uint16_t num_col = input_ch * kernel_y * kernel_x;
+
+    /*
+     *  Here we use buffer_a as q15_t internally as computation are done with q15_t level
+     *  im2col are done to output in q15_t format from q7_t input
+     */
+    q15_t    *pBuffer = buffer_a;
+    q7_t     *pOut = output;
+
+    /* This part implements the im2col function */
+    for( i_out_y = 0; i_out_y < output_y; i_out_y++ )
+    {
+        for( i_out_x = 0; i_out_x < output_x; i_out_x++ )
+        {
+            for( i_ker_y = i_out_y * stride_y - pad_y; i_ker_y < i_out_y * stride_y - pad_y + kernel_y; i_ker_y++ )
+            {
+                for( i_ker_x = i_out_x * stride_x - pad_x; i_ker_x < i_out_x * stride_x - pad_x + kernel_x; i_ker_x++ )
+                {
+                    if( i_ker_y < 0 || i_ker_y >= input_y || i_ker_x < 0 || i_ker_x >= input_x )
+                    {
+                        /* Padding is the input zero point, i.e. 0 once the offset is added */
+                        memset( pBuffer, 0, sizeof( q15_t )*input_ch );
+                    }
+                    else
+                    {
+                        /* Copying the pixel data to column */
+                        arm_q7_to_q15_with_offset( input + ( i_ker_y * input_x + i_ker_x ) * input_ch,
+                                                   pBuffer, input_ch, ( q15_t ) input_offset );
+                    }
+
+                    pBuffer += input_ch;
+                }
+            }
+
+            /* Computation is filed for every 2 columns */
+            if( pBuffer == buffer_a + 2 * num_col )
+            {
+                pOut = arm_nn_mat_mult_kernel_s8_s16( kernel, buffer_a, output_ch,
+                                                      output_shift, output_mult,
+                                                      out_offset,
+                                                      ( int16_t ) out_activation_min,
+                                                      ( int16_t ) out_activation_max,
+                                                      num_col, bias, pOut );
+
+                /* counter reset */
+                pBuffer = buffer_a;
+            }
+        }
+    }
+
+    /* left-over because odd number of output pixels */
+    if( pBuffer != buffer_a )
+    {
+        const q7_t *pA = kernel;
+        int       i;
+
+        for( i = 0; i < output_ch; i++ )
+        {
+            /* Load the accumulator with bias first */
+            q31_t     sum = bias[i];
+
+            /* Point to the beging of the im2col buffer */
+            const q15_t *pB = buffer_a;
+
+            /* Each time it process 4 entries */
+            uint16_t  colCnt = num_col >> 2;
+
+            while( colCnt )
+            {
+#if defined (ARM_MATH_DSP)
+                q31_t     inA1, inA2;
+                q31_t     inB1, inB2;
+
+                pA = ( q7_t * ) read_and_pad( ( void * )pA, &inA1, &inA2 );
+
+                inB1 = *__SIMD32( pB )++;
+                sum = __SMLAD( inA1, inB1, sum );
+                inB2 = *__SIMD32( pB )++;
+                sum = __SMLAD( inA2, inB2, sum );
+#else
+                sum += pA[0] * pB[0];
+                sum += pA[1] * pB[1];
+                sum += pA[2] * pB[2];
+                sum += pA[3] * pB[3];
+                pA += 4;
+                pB += 4;
+#endif                          /* ARM_MATH_DSP */
+
+                colCnt--;
+            }
+
+            colCnt = num_col & 0x3;
+
+            while( colCnt )
+            {
+                q7_t      inA1 = *pA++;
+                q15_t     inB1 = *pB++;
+                sum += inA1 * inB1;
+                colCnt--;
+            }
+
+            sum = arm_nn_requantize( sum, output_mult[i], output_shift[i] ) + out_offset;
+            sum = MAX( sum, out_activation_min );
+            sum = MIN( sum, out_activation_max );
+            *pOut++ = ( q7_t ) sum;
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_s8.c
+ * Description:  int8 asymmetric version of depthwise convolution with per-channel requantization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief int8 depthwise convolution function with per-channel requantization
+ * @param[in]       input               pointer to input tensor
+ * @param[in]       input_x             input tensor dimension x
+ * @param[in]       input_y             input tensor dimension y
+ * @param[in]       input_ch            number of input tensor channels
+ * @param[in]       kernel              pointer to kernel weights
+ * @param[in]       output_ch           number of output tensor channels, input_ch * ch_mult
+ * @param[in]       ch_mult             channel multiplier
+ * @param[in]       kernel_x            filter kernel size x
+ * @param[in]       kernel_y            filter kernel size y
+ * @param[in]       pad_x               padding size x
+ * @param[in]       pad_y               padding size y
+ * @param[in]       stride_x            convolution stride x
+ * @param[in]       stride_y            convolution stride y
+ * @param[in]       bias                pointer to per-channel int32 bias
+ * @param[in,out]   output              pointer to output tensor
+ * @param[in]       output_shift        pointer to per-channel output shifts
+ * @param[in]       output_mult         pointer to per-channel output multipliers
+ * @param[in]       output_x            output tensor dimension x
+ * @param[in]       output_y            output tensor dimension y
+ * @param[in]       output_offset       output zero point
+ * @param[in]       input_offset        negated input zero point, in the range [-127, 128]
+ * @param[in]       output_activation_min   minimum output value, usually -128
+ * @param[in]       output_activation_max   maximum output value, usually 127
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ *
+ * The weights are in [kernel_y, kernel_x, output_ch] order, as exported by
+ * TensorFlow Lite. Output channel c is computed from input channel
+ * c / ch_mult. Padded positions take the value of the input zero point.
+ *
+ * The part of the kernel that overlaps the input is found once per output
+ * pixel, so the inner loops run without bound checks.
+ */
+
+arm_status arm_depthwise_conv_s8( const q7_t *input,
+                                  const uint16_t input_x,
+                                  const uint16_t input_y,
+                                  const uint16_t input_ch,
+                                  const q7_t *kernel,
+                                  const uint16_t output_ch,
+                                  const uint16_t ch_mult,
+                                  const uint16_t kernel_x,
+                                  const uint16_t kernel_y,
+                                  const uint16_t pad_x,
+                                  const uint16_t pad_y,
+                                  const uint16_t stride_x,
+                                  const uint16_t stride_y,
+                                  const int32_t *bias,
+                                  q7_t *output,
+                                  const int32_t *output_shift,
+                                  const int32_t *output_mult,
+                                  const uint16_t output_x,
+                                  const uint16_t output_y,
+                                  const int32_t output_offset,
+                                  const int32_t input_offset,
+                                  const int32_t output_activation_min,
+                                  const int32_t output_activation_max )
+{
+    int32_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    int32_t   base_y, base_x;
+    int32_t   ker_y_start, ker_y_end, ker_x_start, ker_x_end;
+    uint16_t  i_in_ch, i_mult, i_out_ch;
+    q7_t     *pOut = output;
+
+    if( output_ch != input_ch * ch_mult )
+    {
+        /* check if the output channel count matches the multiplier */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for( i_out_y = 0; i_out_y < output_y; i_out_y++ )
+    {
+        base_y = stride_y * i_out_y - pad_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( kernel_y, input_y - base_y );
+
+        for( i_out_x = 0; i_out_x < output_x; i_out_x++ )
+        {
+            base_x = stride_x * i_out_x - pad_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( kernel_x, input_x - base_x );
+
+            i_out_ch = 0;
+
+            for( i_in_ch = 0; i_in_ch < input_ch; i_in_ch++ )
+            {
+                for( i_mult = 0; i_mult < ch_mult; i_mult++ )
+                {
+                    q31_t     sum = bias[i_out_ch];
+
+                    for( i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++ )
+                    {
+                        const q7_t *pIn = input + ( ( base_y + i_ker_y ) * input_x + base_x + ker_x_start ) * input_ch + i_in_ch;
+                        const q7_t *pKer = kernel + ( i_ker_y * kernel_x + ker_x_start ) * output_ch + i_out_ch;
+
+                        for( i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++ )
+                        {
+                            sum += ( *pIn + input_offset ) * *pKer;
+                            pIn += input_ch;
+                            pKer += output_ch;
+                        }
+                    }
+
+                    sum = arm_nn_requantize( sum, output_mult[i_out_ch], output_shift[i_out_ch] ) + output_offset;
+                    sum = MAX( sum, output_activation_min );
+                    sum = MIN( sum, output_activation_max );
+                    *pOut++ = ( q7_t ) sum;
+
+                    i_out_ch++;
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_kernel_s8_s16.c
+ * Description:  Matrix-multiplication function for int8 convolution
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief Requantize one accumulator and clamp it to the activation range
+ */
+
+__STATIC_FORCEINLINE q7_t requantize_and_clamp( q31_t sum,
+        const int32_t mult,
+        const int32_t shift,
+        const int32_t out_offset,
+        const int16_t activation_min,
+        const int16_t activation_max )
+{
+    sum = arm_nn_requantize( sum, mult, shift ) + out_offset;
+    sum = MAX( sum, activation_min );
+    sum = MIN( sum, activation_max );
+    return ( q7_t ) sum;
+}
+
+/**
+ * @brief Matrix-multiplication function for int8 convolution
+ * @param[in]       input_a         pointer to operand A, the int8 weights
+ * @param[in]       input_b         pointer to operand B, always consists of 2 vectors
+ * @param[in]       output_ch       numRow of A
+ * @param[in]       out_shift       per-channel output shifts
+ * @param[in]       out_mult        per-channel output multipliers
+ * @param[in]       out_offset      output zero point
+ * @param[in]       activation_min  minimum output value
+ * @param[in]       activation_max  maximum output value
+ * @param[in]       num_col_a       numCol of A
+ * @param[in]       output_bias     per-channel int32 bias
+ * @param[in,out]   out_0           pointer to output
+ * @return     The function returns the incremented output pointer
+ *
+ * @details
+ *
+ * This function does the matrix multiplication with weight matrix
+ * and 2 columns from im2col. The columns already have the input offset
+ * added, so the int8 weights are multiplied with them directly.
+ */
+
+q7_t     *arm_nn_mat_mult_kernel_s8_s16( const q7_t *input_a,
+        const q15_t *input_b,
+        const uint16_t output_ch,
+        const int32_t *out_shift,
+        const int32_t *out_mult,
+        const int32_t out_offset,
+        const int16_t activation_min,
+        const int16_t activation_max,
+        const uint16_t num_col_a,
+        const int32_t *output_bias,
+        q7_t *out_0 )
+{
+    /* set up the second output pointers */
+    q7_t     *out_1 = out_0 + output_ch;
+    const int32_t *bias = output_bias;
+    const q7_t *pA = input_a;
+    uint16_t  rowCnt = output_ch >> 1;
+    uint16_t  ch = 0;
+
+    /* this loop over rows in A */
+    while( rowCnt )
+    {
+        /* setup pointers for B */
+        const q15_t *pB = input_b;
+        const q15_t *pB2 = pB + num_col_a;
+
+        /* align the second pointer for A */
+        const q7_t *pA2 = pA + num_col_a;
+
+        /* init the sum with bias */
+        q31_t     sum = *bias;
+        q31_t     sum2 = *bias++;
+        q31_t     sum3 = *bias;
+        q31_t     sum4 = *bias++;
+
+        uint16_t  colCnt = num_col_a >> 2;
+
+        /* accumulate over the vector */
+        while( colCnt )
+        {
+#if defined (ARM_MATH_DSP)
+            q31_t     inA11, inA12, inA21, inA22;
+            q31_t     inB1 = *__SIMD32( pB )++;
+            q31_t     inB2 = *__SIMD32( pB2 )++;
+
+            pA = ( q7_t * ) read_and_pad( ( void * )pA, &inA11, &inA12 );
+            pA2 = ( q7_t * ) read_and_pad( ( void * )pA2, &inA21, &inA22 );
+
+            sum = __SMLAD( inA11, inB1, sum );
+            sum2 = __SMLAD( inA11, inB2, sum2 );
+            sum3 = __SMLAD( inA21, inB1, sum3 );
+            sum4 = __SMLAD( inA21, inB2, sum4 );
+
+            inB1 = *__SIMD32( pB )++;
+            inB2 = *__SIMD32( pB2 )++;
+
+            sum = __SMLAD( inA12, inB1, sum );
+            sum2 = __SMLAD( inA12, inB2, sum2 );
+            sum3 = __SMLAD( inA22, inB1, sum3 );
+            sum4 = __SMLAD( inA22, inB2, sum4 );
+#else
+            /* Each weight is loaded once for both columns */
+            q31_t     inA1, inA2;
+            uint16_t  k;
+
+            for( k = 0; k < 4; k++ )
+            {
+                inA1 = *pA++;
+                inA2 = *pA2++;
+
+                sum += inA1 * pB[k];
+                sum2 += inA1 * pB2[k];
+                sum3 += inA2 * pB[k];
+                sum4 += inA2 * pB2[k];
+            }
+
+            pB += 4;
+            pB2 += 4;
+#endif                          /* ARM_MATH_DSP */
+
+            colCnt--;
+        }                       /* while over colCnt */
+
+        colCnt = num_col_a & 0x3;
+
+        while( colCnt )
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            q7_t      inA2 = *pA2++;
+            q15_t     inB2 = *pB2++;
+
+            sum += inA1 * inB1;
+            sum2 += inA1 * inB2;
+            sum3 += inA2 * inB1;
+            sum4 += inA2 * inB2;
+            colCnt--;
+        }                       /* while over colCnt */
+
+        *out_0++ = requantize_and_clamp( sum, out_mult[ch], out_shift[ch], out_offset, activation_min, activation_max );
+        *out_0++ = requantize_and_clamp( sum3, out_mult[ch + 1], out_shift[ch + 1], out_offset, activation_min, activation_max );
+        *out_1++ = requantize_and_clamp( sum2, out_mult[ch], out_shift[ch], out_offset, activation_min, activation_max );
+        *out_1++ = requantize_and_clamp( sum4, out_mult[ch + 1], out_shift[ch + 1], out_offset, activation_min, activation_max );
+
+        /* skip the row computed with A2 */
+        pA += num_col_a;
+        ch += 2;
+        rowCnt--;
+    }                           /* for over output_ch */
+
+    /* compute left-over row if any */
+    if( output_ch & 0x1 )
+    {
+        /* setup pointers for B */
+        const q15_t *pB = input_b;
+        const q15_t *pB2 = pB + num_col_a;
+
+        /* load the bias */
+        q31_t     sum = *bias;
+        q31_t     sum2 = *bias;
+
+        uint16_t  colCnt = num_col_a;
+
+        while( colCnt )
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            q15_t     inB2 = *pB2++;
+
+            sum += inA1 * inB1;
+            sum2 += inA1 * inB2;
+            colCnt--;
+        }
+
+        *out_0++ = requantize_and_clamp( sum, out_mult[ch], out_shift[ch], out_offset, activation_min, activation_max );
+        *out_1++ = requantize_and_clamp( sum2, out_mult[ch], out_shift[ch], out_offset, activation_min, activation_max );
+    }
+
+    out_0 += output_ch;
+
+    /* return the new output pointer with offset */
+    return out_0;
+}
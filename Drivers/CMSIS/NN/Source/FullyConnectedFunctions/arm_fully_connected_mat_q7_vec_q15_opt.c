@@ -111,6 +111,8 @@
  *
  *  | a62 | a63 | a64 | a65 | a66 | a67 |
  *
+ *  arm_nn_pack_weights_q7_q15_x4() packs a row-major weight matrix in this order.
+ *
  */
 
 arm_status arm_fully_connected_mat_q7_vec_q15_opt( const q15_t *pV,
@@ -91,6 +91,9 @@
  *  | a13 | a23 | a33 | a43 | a51 | a52 | a53 | a61 |
  *
  *  | a62 | a63 |
+ *
+ *  arm_nn_pack_weights_q15_x4() packs a row-major weight matrix in this order.
+ *
  */
 
 arm_status arm_fully_connected_q15_opt( const q15_t *pV,
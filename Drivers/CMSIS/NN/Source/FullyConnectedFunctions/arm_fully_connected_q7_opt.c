@@ -122,6 +122,7 @@
  *
  *  | a62 | a63 | a64 | a65 | a66 | a67 |
  *
+ *  arm_nn_pack_weights_q7_x4() packs a row-major weight matrix in this order.
  *
  */
 
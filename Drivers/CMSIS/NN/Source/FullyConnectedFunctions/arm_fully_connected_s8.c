@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_s8.c
+ * Description:  int8 asymmetric version of fully-connected layer function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/**
+ * @brief int8 fully-connected layer function
+ * @param[in]       pV                      pointer to input vector
+ * @param[in]       pM                      pointer to matrix weights
+ * @param[in]       dim_vec                 length of the vector
+ * @param[in]       num_of_rows             number of rows in weight matrix
+ * @param[in]       input_offset            negated input zero point, in the range [-127, 128]
+ * @param[in]       out_mult                output multiplier
+ * @param[in]       out_shift               output shift, positive to the left
+ * @param[in]       output_offset           output zero point
+ * @param[in]       bias                    pointer to int32 bias
+ * @param[in,out]   pOut                    pointer to output vector
+ * @param[in]       output_activation_min   minimum output value, usually -128
+ * @param[in]       output_activation_max   maximum output value, usually 127
+ * @param[in,out]   vec_buffer              pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * vec_buffer size: dim_vec
+ *
+ * The weight matrix is in regular [num_of_rows, dim_vec] order and is
+ * symmetric, so it has no zero point. TensorFlow Lite quantizes
+ * fully-connected layers per tensor, hence a single multiplier and shift.
+ *
+ * The input vector is expanded to q15 once, with the input offset added,
+ * and two rows are computed at a time so that each input value is loaded
+ * once for both.
+ */
+
+arm_status arm_fully_connected_s8( const q7_t *pV,
+                                   const q7_t *pM,
+                                   const uint16_t dim_vec,
+                                   const uint16_t num_of_rows,
+                                   const int32_t input_offset,
+                                   const int32_t out_mult,
+                                   const int32_t out_shift,
+                                   const int32_t output_offset,
+                                   const int32_t *bias,
+                                   q7_t *pOut,
+                                   const int32_t output_activation_min,
+                                   const int32_t output_activation_max,
+                                   q15_t *vec_buffer )
+{
+    const q7_t *pB = pM;
+    const q7_t *pB2;
+    q7_t     *pO = pOut;
+    const int32_t *pBias = bias;
+    const q15_t *pA;
+    uint16_t  rowCnt = num_of_rows >> 1;
+    uint16_t  colCnt;
+    q31_t     sum, sum2;
+
+    /* expand the input vector with the offset added */
+    arm_q7_to_q15_with_offset( pV, vec_buffer, dim_vec, ( q15_t ) input_offset );
+
+    while( rowCnt )
+    {
+        sum = *pBias++;
+        sum2 = *pBias++;
+
+        pA = vec_buffer;
+        pB2 = pB + dim_vec;
+
+        colCnt = dim_vec >> 2;
+
+        while( colCnt )
+        {
+#if defined (ARM_MATH_DSP)
+            q31_t     inV, inM11, inM12, inM21, inM22;
+
+            pB = ( q7_t * ) read_and_pad( ( void * )pB, &inM11, &inM12 );
+            pB2 = ( q7_t * ) read_and_pad( ( void * )pB2, &inM21, &inM22 );
+
+            inV = *__SIMD32( pA )++;
+            sum = __SMLAD( inV, inM11, sum );
+            sum2 = __SMLAD( inV, inM21, sum2 );
+
+            inV = *__SIMD32( pA )++;
+            sum = __SMLAD( inV, inM12, sum );
+            sum2 = __SMLAD( inV, inM22, sum2 );
+#else
+            q31_t     inV;
+            uint16_t  k;
+
+            for( k = 0; k < 4; k++ )
+            {
+                inV = *pA++;
+                sum += inV * *pB++;
+                sum2 += inV * *pB2++;
+            }
+#endif                          /* ARM_MATH_DSP */
+
+            colCnt--;
+        }
+
+        colCnt = dim_vec & 0x3;
+
+        while( colCnt )
+        {
+            q15_t     inV = *pA++;
+            q7_t      inM = *pB++;
+            q7_t      inM2 = *pB2++;
+
+            sum += inV * inM;
+            sum2 += inV * inM2;
+            colCnt--;
+        }                       /* while over colCnt */
+
+        sum = arm_nn_requantize( sum, out_mult, out_shift ) + output_offset;
+        sum = MAX( sum, output_activation_min );
+        *pO++ = ( q7_t ) MIN( sum, output_activation_max );
+
+        sum2 = arm_nn_requantize( sum2, out_mult, out_shift ) + output_offset;
+        sum2 = MAX( sum2, output_activation_min );
+        *pO++ = ( q7_t ) MIN( sum2, output_activation_max );
+
+        /* adjust the pointers and counters */
+        pB += dim_vec;
+        rowCnt--;
+    }
+
+    /* left-over part of the rows */
+    if( num_of_rows & 0x1 )
+    {
+        sum = *pBias;
+        pA = vec_buffer;
+        colCnt = dim_vec;
+
+        while( colCnt )
+        {
+            q15_t     inV = *pA++;
+            q7_t      inM = *pB++;
+
+            sum += inV * inM;
+            colCnt--;
+        }
+
+        sum = arm_nn_requantize( sum, out_mult, out_shift ) + output_offset;
+        sum = MAX( sum, output_activation_min );
+        *pO++ = ( q7_t ) MIN( sum, output_activation_max );
+    }
+
+    /* Return to ARM_MATH_SUCCESS */
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of FC group
+ */
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_s8_opt.c
+ * Description:  int8 asymmetric opt version of fully-connected layer function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief Requantize one accumulator and clamp it to the activation range
+ */
+
+__STATIC_FORCEINLINE q7_t requantize_and_clamp( q31_t sum,
+        const int32_t mult,
+        const int32_t shift,
+        const int32_t out_offset,
+        const int32_t activation_min,
+        const int32_t activation_max )
+{
+    sum = arm_nn_requantize( sum, mult, shift ) + out_offset;
+    sum = MAX( sum, activation_min );
+    sum = MIN( sum, activation_max );
+    return ( q7_t ) sum;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/**
+ * @brief int8 opt fully-connected layer function
+ * @param[in]       pV                      pointer to input vector
+ * @param[in]       pM                      pointer to matrix weights, packed with arm_nn_pack_weights_q7_q15_x4()
+ * @param[in]       dim_vec                 length of the vector
+ * @param[in]       num_of_rows             number of rows in weight matrix
+ * @param[in]       input_offset            negated input zero point, in the range [-127, 128]
+ * @param[in]       out_mult                output multiplier
+ * @param[in]       out_shift               output shift, positive to the left
+ * @param[in]       output_offset           output zero point
+ * @param[in]       bias                    pointer to int32 bias
+ * @param[in,out]   pOut                    pointer to output vector
+ * @param[in]       output_activation_min   minimum output value, usually -128
+ * @param[in]       output_activation_max   maximum output value, usually 127
+ * @param[in,out]   vec_buffer              pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * vec_buffer size: dim_vec
+ *
+ * Same arithmetic as arm_fully_connected_s8(), with the weights in the
+ * layout of arm_fully_connected_mat_q7_vec_q15_opt(). The input vector is
+ * expanded to q15 once, with the input offset added, and four rows are
+ * computed at a time from a single weight pointer, so each pair of input
+ * values is loaded once for four rows instead of two.
+ *
+ * The packed weights are produced offline or at start-up with
+ * arm_nn_pack_weights_q7_q15_x4().
+ */
+
+arm_status arm_fully_connected_s8_opt( const q7_t *pV,
+                                       const q7_t *pM,
+                                       const uint16_t dim_vec,
+                                       const uint16_t num_of_rows,
+                                       const int32_t input_offset,
+                                       const int32_t out_mult,
+                                       const int32_t out_shift,
+                                       const int32_t output_offset,
+                                       const int32_t *bias,
+                                       q7_t *pOut,
+                                       const int32_t output_activation_min,
+                                       const int32_t output_activation_max,
+                                       q15_t *vec_buffer )
+{
+    const q7_t *pB = pM;
+    q7_t     *pO = pOut;
+    const int32_t *pBias = bias;
+    const q15_t *pA;
+    uint16_t  rowCnt = num_of_rows >> 2;
+    uint16_t  colCnt;
+
+    /* expand the input vector with the offset added */
+    arm_q7_to_q15_with_offset( pV, vec_buffer, dim_vec, ( q15_t ) input_offset );
+
+    while( rowCnt )
+    {
+        q31_t     sum = *pBias++;
+        q31_t     sum2 = *pBias++;
+        q31_t     sum3 = *pBias++;
+        q31_t     sum4 = *pBias++;
+
+        pA = vec_buffer;
+        colCnt = dim_vec >> 1;
+
+        while( colCnt )
+        {
+#if defined (ARM_MATH_DSP)
+            q31_t     inM11, inM12, inM13, inM14;
+            q31_t     inV = *__SIMD32( pA )++;
+
+            inM11 = *__SIMD32( pB )++;
+            inM12 = __SXTB16( __ROR( inM11, 8 ) );
+            inM11 = __SXTB16( inM11 );
+            inM13 = *__SIMD32( pB )++;
+            inM14 = __SXTB16( __ROR( inM13, 8 ) );
+            inM13 = __SXTB16( inM13 );
+
+#ifndef ARM_MATH_BIG_ENDIAN
+            sum = __SMLAD( inM11, inV, sum );
+            sum2 = __SMLAD( inM12, inV, sum2 );
+            sum3 = __SMLAD( inM13, inV, sum3 );
+            sum4 = __SMLAD( inM14, inV, sum4 );
+#else
+            sum = __SMLAD( inM12, inV, sum );
+            sum2 = __SMLAD( inM11, inV, sum2 );
+            sum3 = __SMLAD( inM14, inV, sum3 );
+            sum4 = __SMLAD( inM13, inV, sum4 );
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+#else
+            q15_t     inA1 = *pA++;
+            q15_t     inA2 = *pA++;
+
+            sum += inA1 * pB[0] + inA2 * pB[2];
+            sum2 += inA1 * pB[1] + inA2 * pB[3];
+            sum3 += inA1 * pB[4] + inA2 * pB[6];
+            sum4 += inA1 * pB[5] + inA2 * pB[7];
+            pB += 8;
+#endif                          /* ARM_MATH_DSP */
+
+            colCnt--;
+        }
+
+        /* left-over column, in-order for the four rows */
+        if( dim_vec & 0x1 )
+        {
+            q15_t     inA = *pA++;
+
+            sum += inA * *pB++;
+            sum2 += inA * *pB++;
+            sum3 += inA * *pB++;
+            sum4 += inA * *pB++;
+        }
+
+        *pO++ = requantize_and_clamp( sum, out_mult, out_shift, output_offset, output_activation_min,
+                                      output_activation_max );
+        *pO++ = requantize_and_clamp( sum2, out_mult, out_shift, output_offset, output_activation_min,
+                                      output_activation_max );
+        *pO++ = requantize_and_clamp( sum3, out_mult, out_shift, output_offset, output_activation_min,
+                                      output_activation_max );
+        *pO++ = requantize_and_clamp( sum4, out_mult, out_shift, output_offset, output_activation_min,
+                                      output_activation_max );
+
+        rowCnt--;
+    }
+
+    /* left-over rows, in their original order */
+    rowCnt = num_of_rows & 0x3;
+
+    while( rowCnt )
+    {
+        q31_t     sum = *pBias++;
+
+        pA = vec_buffer;
+
+#if defined (ARM_MATH_DSP)
+        colCnt = dim_vec >> 2;
+
+        while( colCnt )
+        {
+            q31_t     inV1, inV2, inM11, inM12;
+
+            pB = ( q7_t * ) read_and_pad( ( void * )pB, &inM11, &inM12 );
+
+            inV1 = *__SIMD32( pA )++;
+            sum = __SMLAD( inV1, inM11, sum );
+
+            inV2 = *__SIMD32( pA )++;
+            sum = __SMLAD( inV2, inM12, sum );
+
+            colCnt--;
+        }
+
+        colCnt = dim_vec & 0x3;
+#else
+        colCnt = dim_vec;
+#endif                          /* ARM_MATH_DSP */
+
+        while( colCnt )
+        {
+            q15_t     inV = *pA++;
+            q7_t      inM = *pB++;
+
+            sum += inV * inM;
+            colCnt--;
+        }
+
+        *pO++ = requantize_and_clamp( sum, out_mult, out_shift, output_offset, output_activation_min,
+                                      output_activation_max );
+
+        rowCnt--;
+    }
+
+    /* Return to ARM_MATH_SUCCESS */
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of FC group
+ */
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_plan.c
+ * Description:  Static memory planner of the graph executor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/* offset of a tensor that is not placed yet */
+#define UNPLACED 0xFFFFFFFFUL
+
+/* tensors are placed on word boundaries, as the scratch buffers are accessed as words */
+#define ALIGN_WORD(x) (((x) + 3UL) & ~3UL)
+
+static uint32_t layer_input_size( const arm_nn_layer *l )
+{
+    return ( uint32_t ) l->in_x * l->in_y * l->in_ch;
+}
+
+static uint32_t layer_output_size( const arm_nn_layer *l )
+{
+    switch( l->type )
+    {
+    case ARM_NN_LAYER_FULLY_CONNECTED:
+        return l->out_ch;
+
+    case ARM_NN_LAYER_RELU:
+    case ARM_NN_LAYER_SOFTMAX:
+        return layer_input_size( l );
+
+    default:
+        return ( uint32_t ) l->out_x * l->out_y * l->out_ch;
+    }
+}
+
+/* scratch buffer in bytes, from the buffer sizes of the layer functions */
+static uint32_t layer_scratch_size( const arm_nn_layer *l )
+{
+    switch( l->type )
+    {
+    case ARM_NN_LAYER_CONV:
+    case ARM_NN_LAYER_DEPTHWISE_CONV:
+        /* bufferA: 2*ch_im_in*dim_kernel_x*dim_kernel_y q15_t */
+        return 2UL * sizeof( q15_t ) * l->in_ch * l->kernel_x * l->kernel_y;
+
+    case ARM_NN_LAYER_FULLY_CONNECTED:
+        /* vec_buffer: dim_vec q15_t */
+        return sizeof( q15_t ) * layer_input_size( l );
+
+    case ARM_NN_LAYER_AVE_POOL:
+        /* bufferA: 2*dim_im_out*ch_im_in q7_t */
+        return 2UL * l->out_x * l->in_ch;
+
+    default:
+        return 0;
+    }
+}
+
+/* constraints of the layer functions */
+static arm_status layer_check( const arm_nn_layer *l )
+{
+    switch( l->type )
+    {
+    case ARM_NN_LAYER_CONV:
+        break;
+
+    case ARM_NN_LAYER_DEPTHWISE_CONV:
+        if( l->in_ch != l->out_ch || l->in_ch % 2 != 0 )
+        {
+            return ARM_MATH_SIZE_MISMATCH;
+        }
+
+        break;
+
+    case ARM_NN_LAYER_MAX_POOL:
+    case ARM_NN_LAYER_AVE_POOL:
+        /* the q7 pooling functions are square only */
+        if( l->in_x != l->in_y || l->out_x != l->out_y || l->kernel_x != l->kernel_y
+                || l->pad_x != l->pad_y || l->stride_x != l->stride_y || l->in_ch != l->out_ch )
+        {
+            return ARM_MATH_SIZE_MISMATCH;
+        }
+
+        break;
+
+    case ARM_NN_LAYER_RELU:
+        if( l->input != l->output )
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        break;
+
+    case ARM_NN_LAYER_FULLY_CONNECTED:
+    case ARM_NN_LAYER_SOFTMAX:
+        break;
+
+    default:
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* vector lengths are passed as uint16_t */
+    if( layer_input_size( l ) > 0xFFFFUL || layer_output_size( l ) > 0xFFFFUL )
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/* lowest offset where the tensor does not overlap any placed tensor live at the same time */
+static uint32_t find_offset( const arm_nn_tensor *tensors, const uint32_t num, const arm_nn_tensor *t )
+{
+    uint32_t  offset = 0;
+    uint32_t  size = ALIGN_WORD( t->size );
+    uint32_t  i = 0;
+
+    while( i < num )
+    {
+        const arm_nn_tensor *p = &tensors[i];
+
+        if( p != t && p->offset != UNPLACED && p->size != 0
+                && p->first <= t->last && t->first <= p->last
+                && p->offset < offset + size && offset < p->offset + ALIGN_WORD( p->size ) )
+        {
+            /* move past the conflicting tensor and check again */
+            offset = p->offset + ALIGN_WORD( p->size );
+            i = 0;
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return offset;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+/**
+ * @brief Plans the memory of a graph
+ * @param[in,out]   graph       pointer to the graph instance
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>,
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions of connected layers
+ * differ or a layer does not meet the constraints of its function, or
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> if the tensors are not connected
+ * properly.
+ *
+ * @details
+ *
+ * Each layer reads one tensor and writes one tensor. A tensor is written
+ * by a single layer and may be read by any number of later layers; the
+ * network input is written by the application before arm_nn_graph_run().
+ * ReLU layers work in place, so their input and output tensor are the
+ * same. A max pooling layer may overwrite its input, which must not be
+ * read by a later layer.
+ *
+ * The sizes of the tensors and of the scratch buffers follow from the
+ * layer dimensions. A tensor is live from the layer that writes it to
+ * the last layer that reads it, the network output until the end of the
+ * network, and the scratch buffer of a layer during that layer only.
+ * The tensors are placed largest first, each at the lowest offset that
+ * does not overlap a tensor live at the same time. graph->peak_size is
+ * set to the size of the arena this needs.
+ *
+ * The plan depends on the layers only, so it can be made once at start-up,
+ * or offline on the host with the tensor table then stored as a constant.
+ * No memory is allocated.
+ *
+ */
+
+arm_status arm_nn_graph_plan( arm_nn_graph *graph )
+{
+    arm_nn_tensor *tensors = graph->tensors;
+    const uint32_t num = ARM_NN_GRAPH_NUM_TENSORS( graph->num_tensors, graph->num_layers );
+    uint32_t  i, n;
+    uint32_t  peak = 0;
+    arm_status status;
+
+    if( graph->input >= graph->num_tensors || graph->output >= graph->num_tensors )
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for( i = 0; i < num; i++ )
+    {
+        tensors[i].size = 0;
+        tensors[i].offset = UNPLACED;
+        tensors[i].first = -1;
+        tensors[i].last = -1;
+    }
+
+    /* the network input is written before the first layer */
+    tensors[graph->input].first = 0;
+    tensors[graph->input].last = 0;
+
+    /* sizes and lifetimes */
+    for( i = 0; i < graph->num_layers; i++ )
+    {
+        const arm_nn_layer *l = &graph->layers[i];
+        arm_nn_tensor *in, *out, *scratch;
+
+        status = layer_check( l );
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return status;
+        }
+
+        if( l->input >= graph->num_tensors || l->output >= graph->num_tensors )
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        in = &tensors[l->input];
+        out = &tensors[l->output];
+
+        if( in->first < 0 )
+        {
+            /* read before it is written */
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        if( in->size == 0 )
+        {
+            in->size = layer_input_size( l );
+        }
+        else if( in->size != layer_input_size( l ) )
+        {
+            return ARM_MATH_SIZE_MISMATCH;
+        }
+
+        in->last = ( int16_t ) i;
+
+        if( out != in )
+        {
+            if( out->first >= 0 )
+            {
+                /* written twice */
+                return ARM_MATH_ARGUMENT_ERROR;
+            }
+
+            out->size = layer_output_size( l );
+            out->first = ( int16_t ) i;
+            out->last = ( int16_t ) i;
+        }
+
+        scratch = &tensors[graph->num_tensors + i];
+        scratch->size = layer_scratch_size( l );
+        scratch->first = ( int16_t ) i;
+        scratch->last = ( int16_t ) i;
+    }
+
+    for( i = 0; i < graph->num_layers; i++ )
+    {
+        const arm_nn_layer *l = &graph->layers[i];
+
+        if( l->type == ARM_NN_LAYER_MAX_POOL
+                && ( tensors[l->input].last != ( int16_t ) i || l->input == graph->output ) )
+        {
+            /* the input is overwritten while it is still needed */
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    if( tensors[graph->output].first < 0 || tensors[graph->output].size == 0 )
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* the network output is read after the last layer */
+    tensors[graph->output].last = ( int16_t ) graph->num_layers;
+
+    /* greedy placement, largest tensor first */
+    for( n = 0; n < num; n++ )
+    {
+        arm_nn_tensor *largest = NULL;
+
+        for( i = 0; i < num; i++ )
+        {
+            if( tensors[i].offset == UNPLACED && tensors[i].size != 0
+                    && ( largest == NULL || tensors[i].size > largest->size ) )
+            {
+                largest = &tensors[i];
+            }
+        }
+
+        if( largest == NULL )
+        {
+            break;
+        }
+
+        largest->offset = find_offset( tensors, num, largest );
+        peak = MAX( peak, largest->offset + ALIGN_WORD( largest->size ) );
+    }
+
+    /* unused tensors */
+    for( i = 0; i < num; i++ )
+    {
+        if( tensors[i].offset == UNPLACED )
+        {
+            tensors[i].offset = 0;
+        }
+    }
+
+    graph->peak_size = peak;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNGraph group
+ */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_run.c
+ * Description:  Graph executor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+static arm_status run_conv( const arm_nn_layer *l, const q7_t *in, q7_t *out, q15_t *buffer )
+{
+    if( l->in_ch % 4 == 0 && l->out_ch % 2 == 0 )
+    {
+        if( l->kernel_x == 1 && l->kernel_y == 1 && l->pad_x == 0 && l->pad_y == 0
+                && l->stride_x == 1 && l->stride_y == 1 )
+        {
+            return arm_convolve_1x1_HWC_q7_fast_nonsquare( in, l->in_x, l->in_y, l->in_ch, l->weights, l->out_ch,
+                    1, 1, 0, 0, 1, 1, l->bias, l->bias_shift, l->out_shift,
+                    out, l->out_x, l->out_y, buffer, NULL );
+        }
+
+        return arm_convolve_HWC_q7_fast_nonsquare( in, l->in_x, l->in_y, l->in_ch, l->weights, l->out_ch,
+                l->kernel_x, l->kernel_y, l->pad_x, l->pad_y, l->stride_x, l->stride_y,
+                l->bias, l->bias_shift, l->out_shift, out, l->out_x, l->out_y, buffer, NULL );
+    }
+
+    return arm_convolve_HWC_q7_basic_nonsquare( in, l->in_x, l->in_y, l->in_ch, l->weights, l->out_ch,
+            l->kernel_x, l->kernel_y, l->pad_x, l->pad_y, l->stride_x, l->stride_y,
+            l->bias, l->bias_shift, l->out_shift, out, l->out_x, l->out_y, buffer, NULL );
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+/**
+ * @brief Returns the location of a tensor in the arena
+ * @param[in]       graph       pointer to the graph instance
+ * @param[in]       tensor      index of the tensor
+ * @return     pointer to the tensor data
+ *
+ * The application writes the network input to
+ * arm_nn_graph_tensor(graph, graph->input) before arm_nn_graph_run() and
+ * reads the result from arm_nn_graph_tensor(graph, graph->output).
+ */
+
+q7_t     *arm_nn_graph_tensor( const arm_nn_graph *graph, const uint16_t tensor )
+{
+    return graph->arena + graph->tensors[tensor].offset;
+}
+
+/**
+ * @brief Runs the layers of a planned graph
+ * @param[in,out]   graph       pointer to the graph instance
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>, or
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the arena is smaller than the plan.
+ *
+ * @details
+ *
+ * The layers are run in order with their tensors and scratch buffers in
+ * the arena as placed by arm_nn_graph_plan(). Convolutions use the 1x1 or
+ * fast kernels when the channel counts allow it, and the basic kernel
+ * otherwise. When graph->get_cycles and graph->cycles are set, the cycles
+ * spent in each layer are stored in graph->cycles.
+ *
+ */
+
+arm_status arm_nn_graph_run( arm_nn_graph *graph )
+{
+    uint16_t  i;
+    uint32_t  start = 0;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    if( graph->arena == NULL || graph->arena_size < graph->peak_size )
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for( i = 0; i < graph->num_layers; i++ )
+    {
+        const arm_nn_layer *l = &graph->layers[i];
+        q7_t     *in = arm_nn_graph_tensor( graph, l->input );
+        q7_t     *out = arm_nn_graph_tensor( graph, l->output );
+        q7_t     *scratch = arm_nn_graph_tensor( graph, graph->num_tensors + i );
+
+        if( graph->get_cycles != NULL && graph->cycles != NULL )
+        {
+            start = graph->get_cycles();
+        }
+
+        switch( l->type )
+        {
+        case ARM_NN_LAYER_CONV:
+            status = run_conv( l, in, out, ( q15_t * ) scratch );
+            break;
+
+        case ARM_NN_LAYER_DEPTHWISE_CONV:
+            status = arm_depthwise_separable_conv_HWC_q7_nonsquare( in, l->in_x, l->in_y, l->in_ch, l->weights, l->out_ch,
+                     l->kernel_x, l->kernel_y, l->pad_x, l->pad_y, l->stride_x, l->stride_y,
+                     l->bias, l->bias_shift, l->out_shift, out, l->out_x, l->out_y,
+                     ( q15_t * ) scratch, NULL );
+            break;
+
+        case ARM_NN_LAYER_FULLY_CONNECTED:
+            status = arm_fully_connected_q7( in, l->weights, ( uint16_t )( l->in_x * l->in_y * l->in_ch ), l->out_ch,
+                                             l->bias_shift, l->out_shift, l->bias, out, ( q15_t * ) scratch );
+            break;
+
+        case ARM_NN_LAYER_MAX_POOL:
+            arm_maxpool_q7_HWC( in, l->in_x, l->in_ch, l->kernel_x, l->pad_x, l->stride_x, l->out_x, NULL, out );
+            break;
+
+        case ARM_NN_LAYER_AVE_POOL:
+            arm_avepool_q7_HWC( in, l->in_x, l->in_ch, l->kernel_x, l->pad_x, l->stride_x, l->out_x, scratch, out );
+            break;
+
+        case ARM_NN_LAYER_RELU:
+            arm_relu_q7( out, ( uint16_t )( l->in_x * l->in_y * l->in_ch ) );
+            break;
+
+        case ARM_NN_LAYER_SOFTMAX:
+            arm_softmax_q7( in, ( uint16_t )( l->in_x * l->in_y * l->in_ch ), out );
+            break;
+
+        default:
+            status = ARM_MATH_ARGUMENT_ERROR;
+            break;
+        }
+
+        if( status != ARM_MATH_SUCCESS )
+        {
+            return status;
+        }
+
+        if( graph->get_cycles != NULL && graph->cycles != NULL )
+        {
+            graph->cycles[i] = graph->get_cycles() - start;
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNGraph group
+ */
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_pack_weights.c
+ * Description:  Weight packing for the opt fully-connected functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup nndata_convert
+ * @{
+ */
+
+/**
+ * @brief Packs a q7 weight matrix for arm_fully_connected_q7_opt()
+ * @param[in]       *pSrc         points to the weight matrix, num_of_rows x dim_vec in row-major order
+ * @param[in]       num_of_rows   number of rows in weight matrix
+ * @param[in]       dim_vec       length of the vector, i.e. number of columns
+ * @param[out]      *pDst         points to the packed weights, num_of_rows * dim_vec values
+ * @return none.
+ *
+ * \par Description:
+ *
+ * Each group of 4 rows is stored column block by column block. For
+ * columns 4k to 4k+3 of rows r to r+3 the 16 values are:
+ *
+ * <pre>
+ *  | r,4k   | r+1,4k   | r,4k+2 | r+1,4k+2 | r+2,4k   | r+3,4k   | r+2,4k+2 | r+3,4k+2 |
+ *  | r,4k+1 | r+1,4k+1 | r,4k+3 | r+1,4k+3 | r+2,4k+1 | r+3,4k+1 | r+2,4k+3 | r+3,4k+3 |
+ * </pre>
+ *
+ * which matches the vector order of arm_q7_to_q15_reordered_no_shift().
+ * The left-over columns of the group follow one column at a time, rows
+ * r to r+3, and the left-over rows are kept in their original order.
+ * pSrc and pDst must not overlap.
+ *
+ */
+
+void arm_nn_pack_weights_q7_x4( const q7_t *pSrc, const uint16_t num_of_rows, const uint16_t dim_vec, q7_t *pDst )
+{
+    const q7_t *pRow = pSrc;
+    q7_t     *pOut = pDst;
+    uint16_t  rowCnt = num_of_rows >> 2;
+    uint16_t  col;
+
+    while( rowCnt )
+    {
+        const q7_t *pR1 = pRow;
+        const q7_t *pR2 = pR1 + dim_vec;
+        const q7_t *pR3 = pR2 + dim_vec;
+        const q7_t *pR4 = pR3 + dim_vec;
+
+        for( col = 0; col + 4 <= dim_vec; col += 4 )
+        {
+            *pOut++ = pR1[col];
+            *pOut++ = pR2[col];
+            *pOut++ = pR1[col + 2];
+            *pOut++ = pR2[col + 2];
+            *pOut++ = pR3[col];
+            *pOut++ = pR4[col];
+            *pOut++ = pR3[col + 2];
+            *pOut++ = pR4[col + 2];
+
+            *pOut++ = pR1[col + 1];
+            *pOut++ = pR2[col + 1];
+            *pOut++ = pR1[col + 3];
+            *pOut++ = pR2[col + 3];
+            *pOut++ = pR3[col + 1];
+            *pOut++ = pR4[col + 1];
+            *pOut++ = pR3[col + 3];
+            *pOut++ = pR4[col + 3];
+        }
+
+        /* left-over columns */
+        for( ; col < dim_vec; col++ )
+        {
+            *pOut++ = pR1[col];
+            *pOut++ = pR2[col];
+            *pOut++ = pR3[col];
+            *pOut++ = pR4[col];
+        }
+
+        pRow += 4 * dim_vec;
+        rowCnt--;
+    }
+
+    /* left-over rows */
+    memcpy( pOut, pRow, ( num_of_rows & 0x3 ) * dim_vec * sizeof( q7_t ) );
+}
+
+/**
+ * @brief Packs a q7 weight matrix for arm_fully_connected_mat_q7_vec_q15_opt()
+ * @param[in]       *pSrc         points to the weight matrix, num_of_rows x dim_vec in row-major order
+ * @param[in]       num_of_rows   number of rows in weight matrix
+ * @param[in]       dim_vec       length of the vector, i.e. number of columns
+ * @param[out]      *pDst         points to the packed weights, num_of_rows * dim_vec values
+ * @return none.
+ *
+ * \par Description:
+ *
+ * Each group of 4 rows is stored column pair by column pair. For
+ * columns 2k and 2k+1 of rows r to r+3 the 8 values are:
+ *
+ * <pre>
+ *  | r,2k | r+1,2k | r,2k+1 | r+1,2k+1 | r+2,2k | r+3,2k | r+2,2k+1 | r+3,2k+1 |
+ * </pre>
+ *
+ * so the vector is used in its natural order. An odd last column follows
+ * with rows r to r+3, and the left-over rows are kept in their original
+ * order. The same layout is used by arm_fully_connected_s8_opt() and by
+ * the recurrent cells. pSrc and pDst must not overlap.
+ *
+ */
+
+void arm_nn_pack_weights_q7_q15_x4( const q7_t *pSrc, const uint16_t num_of_rows, const uint16_t dim_vec, q7_t *pDst )
+{
+    const q7_t *pRow = pSrc;
+    q7_t     *pOut = pDst;
+    uint16_t  rowCnt = num_of_rows >> 2;
+    uint16_t  col;
+
+    while( rowCnt )
+    {
+        const q7_t *pR1 = pRow;
+        const q7_t *pR2 = pR1 + dim_vec;
+        const q7_t *pR3 = pR2 + dim_vec;
+        const q7_t *pR4 = pR3 + dim_vec;
+
+        for( col = 0; col + 2 <= dim_vec; col += 2 )
+        {
+            *pOut++ = pR1[col];
+            *pOut++ = pR2[col];
+            *pOut++ = pR1[col + 1];
+            *pOut++ = pR2[col + 1];
+            *pOut++ = pR3[col];
+            *pOut++ = pR4[col];
+            *pOut++ = pR3[col + 1];
+            *pOut++ = pR4[col + 1];
+        }
+
+        /* left-over column */
+        if( col < dim_vec )
+        {
+            *pOut++ = pR1[col];
+            *pOut++ = pR2[col];
+            *pOut++ = pR3[col];
+            *pOut++ = pR4[col];
+        }
+
+        pRow += 4 * dim_vec;
+        rowCnt--;
+    }
+
+    /* left-over rows */
+    memcpy( pOut, pRow, ( num_of_rows & 0x3 ) * dim_vec * sizeof( q7_t ) );
+}
+
+/**
+ * @brief Packs a q15 weight matrix for arm_fully_connected_q15_opt()
+ * @param[in]       *pSrc         points to the weight matrix, num_of_rows x dim_vec in row-major order
+ * @param[in]       num_of_rows   number of rows in weight matrix
+ * @param[in]       dim_vec       length of the vector, i.e. number of columns
+ * @param[out]      *pDst         points to the packed weights, num_of_rows * dim_vec values
+ * @return none.
+ *
+ * \par Description:
+ *
+ * Each group of 4 rows is stored column pair by column pair. For
+ * columns 2k and 2k+1 of rows r to r+3 the 8 values are:
+ *
+ * <pre>
+ *  | r,2k | r,2k+1 | r+1,2k | r+1,2k+1 | r+2,2k | r+2,2k+1 | r+3,2k | r+3,2k+1 |
+ * </pre>
+ *
+ * An odd last column follows with rows r to r+3, and the left-over rows
+ * are kept in their original order. pSrc and pDst must not overlap.
+ *
+ */
+
+void arm_nn_pack_weights_q15_x4( const q15_t *pSrc, const uint16_t num_of_rows, const uint16_t dim_vec, q15_t *pDst )
+{
+    const q15_t *pRow = pSrc;
+    q15_t    *pOut = pDst;
+    uint16_t  rowCnt = num_of_rows >> 2;
+    uint16_t  col;
+
+    while( rowCnt )
+    {
+        const q15_t *pR1 = pRow;
+        const q15_t *pR2 = pR1 + dim_vec;
+        const q15_t *pR3 = pR2 + dim_vec;
+        const q15_t *pR4 = pR3 + dim_vec;
+
+        for( col = 0; col + 2 <= dim_vec; col += 2 )
+        {
+            *pOut++ = pR1[col];
+            *pOut++ = pR1[col + 1];
+            *pOut++ = pR2[col];
+            *pOut++ = pR2[col + 1];
+            *pOut++ = pR3[col];
+            *pOut++ = pR3[col + 1];
+            *pOut++ = pR4[col];
+            *pOut++ = pR4[col + 1];
+        }
+
+        /* left-over column */
+        if( col < dim_vec )
+        {
+            *pOut++ = pR1[col];
+            *pOut++ = pR2[col];
+            *pOut++ = pR3[col];
+            *pOut++ = pR4[col];
+        }
+
+        pRow += 4 * dim_vec;
+        rowCnt--;
+    }
+
+    /* left-over rows */
+    memcpy( pOut, pRow, ( num_of_rows & 0x3 ) * dim_vec * sizeof( q15_t ) );
+}
+
+/**
+ * @} end of nndata_convert group
+ */
@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_global_avepool_HWC.c
+ * Description:  Q7 and Q15 global average pooling functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#if defined (ARM_MATH_DSP)
+
+/* number of q7 pixels that can be summed in 16 bits without overflow */
+#define GLOBAL_POOL_Q7_BLOCK 256
+
+#endif                          /* ARM_MATH_DSP */
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/**
+ * @brief Q7 global average pooling function
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor, ch_im_in values
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  6*ch_im_in
+ *
+ * bufferA must be word aligned.
+ *
+ * Averages every channel over the whole input, which is equivalent to an
+ * average pooling whose window is the input, but avoids the window
+ * bookkeeping. The average is truncated towards zero.
+ *
+ * On cores with the DSP extension four channels are read per word and
+ * added to 16-bit partial sums two at a time with __SADD16. A block of 256
+ * pixels cannot overflow the partial sums, which are then added to the
+ * 32-bit sums.
+ *
+ */
+
+void arm_global_avepool_q7_HWC( const q7_t *Im_in,
+                                const uint16_t dim_im_in_x,
+                                const uint16_t dim_im_in_y,
+                                const uint16_t ch_im_in,
+                                q7_t *bufferA,
+                                q7_t *Im_out )
+{
+    q31_t    *sum = ( q31_t * ) bufferA;
+    const q7_t *pIn = Im_in;
+    int32_t   count = dim_im_in_x * dim_im_in_y;
+    uint16_t  i_ch;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    q15_t    *partial = ( q15_t * ) ( sum + ch_im_in );
+    uint16_t  ch_words = ch_im_in >> 2;
+    int32_t   left = count;
+
+    memset( sum, 0, ch_im_in * sizeof( q31_t ) );
+
+    while( left > 0 )
+    {
+        int32_t   block = MIN( left, GLOBAL_POOL_Q7_BLOCK );
+        q31_t    *pSum;
+        q15_t    *pPartial;
+        uint16_t  cnt;
+
+        memset( partial, 0, ch_words * 4 * sizeof( q15_t ) );
+        left -= block;
+
+        while( block > 0 )
+        {
+            pPartial = partial;
+            cnt = ch_words;
+
+            while( cnt > 0u )
+            {
+                q31_t     value = *__SIMD32( pIn )++;
+                q31_t     v1 = __SXTB16( __ROR( value, 8 ) );
+                q31_t     v2 = __SXTB16( value );
+
+                *__SIMD32( pPartial ) = __SADD16( *__SIMD32( pPartial ), v2 );
+                pPartial += 2;
+                *__SIMD32( pPartial ) = __SADD16( *__SIMD32( pPartial ), v1 );
+                pPartial += 2;
+
+                cnt--;
+            }
+
+            /* channels that do not fill a word go to the 32-bit sums directly */
+            for( i_ch = ch_words * 4; i_ch < ch_im_in; i_ch++ )
+            {
+                sum[i_ch] += *pIn++;
+            }
+
+            block--;
+        }
+
+        /* add the partial sums of the block, in channel order */
+        pSum = sum;
+        pPartial = partial;
+        cnt = ch_words;
+
+        while( cnt > 0u )
+        {
+            q31_t     even = *__SIMD32( pPartial )++;
+            q31_t     odd = *__SIMD32( pPartial )++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+            pSum[0] += ( q15_t ) even;
+            pSum[1] += ( q15_t ) odd;
+            pSum[2] += even >> 16;
+            pSum[3] += odd >> 16;
+#else
+            pSum[0] += odd >> 16;
+            pSum[1] += even >> 16;
+            pSum[2] += ( q15_t ) odd;
+            pSum[3] += ( q15_t ) even;
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+
+            pSum += 4;
+            cnt--;
+        }
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    int32_t   i_px;
+
+    memset( sum, 0, ch_im_in * sizeof( q31_t ) );
+
+    for( i_px = 0; i_px < count; i_px++ )
+    {
+        q31_t    *pSum = sum;
+        uint16_t  cnt = ch_im_in >> 2;
+
+        while( cnt > 0u )
+        {
+            pSum[0] += pIn[0];
+            pSum[1] += pIn[1];
+            pSum[2] += pIn[2];
+            pSum[3] += pIn[3];
+
+            pSum += 4;
+            pIn += 4;
+            cnt--;
+        }
+
+        cnt = ch_im_in & 0x3;
+
+        while( cnt > 0u )
+        {
+            *pSum++ += *pIn++;
+            cnt--;
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    for( i_ch = 0; i_ch < ch_im_in; i_ch++ )
+    {
+        Im_out[i_ch] = ( q7_t )( sum[i_ch] / count );
+    }
+}
+
+/**
+ * @brief Q15 global average pooling function
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor, ch_im_in values
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  2*ch_im_in
+ *
+ * bufferA holds one 32-bit sum per channel and must be word aligned.
+ *
+ * Averages every channel over the whole input, which must not have more
+ * than 65536 pixels. The average is truncated towards zero. On cores with
+ * the DSP extension two channels are read per word.
+ *
+ */
+
+void arm_global_avepool_q15_HWC( const q15_t *Im_in,
+                                 const uint16_t dim_im_in_x,
+                                 const uint16_t dim_im_in_y,
+                                 const uint16_t ch_im_in,
+                                 q15_t *bufferA,
+                                 q15_t *Im_out )
+{
+    q31_t    *sum = ( q31_t * ) bufferA;
+    const q15_t *pIn = Im_in;
+    int32_t   count = dim_im_in_x * dim_im_in_y;
+    int32_t   i_px;
+    uint16_t  i_ch;
+
+    memset( sum, 0, ch_im_in * sizeof( q31_t ) );
+
+    for( i_px = 0; i_px < count; i_px++ )
+    {
+        q31_t    *pSum = sum;
+        uint16_t  cnt = ch_im_in >> 1;
+
+        while( cnt > 0u )
+        {
+#if defined (ARM_MATH_DSP)
+            q31_t     value = *__SIMD32( pIn )++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+            pSum[0] += ( q15_t ) value;
+            pSum[1] += value >> 16;
+#else
+            pSum[0] += value >> 16;
+            pSum[1] += ( q15_t ) value;
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+#else
+            pSum[0] += pIn[0];
+            pSum[1] += pIn[1];
+            pIn += 2;
+#endif                          /* ARM_MATH_DSP */
+
+            pSum += 2;
+            cnt--;
+        }
+
+        if( ch_im_in & 0x1 )
+        {
+            *pSum += *pIn++;
+        }
+    }
+
+    for( i_ch = 0; i_ch < ch_im_in; i_ch++ )
+    {
+        Im_out[i_ch] = ( q15_t )( sum[i_ch] / count );
+    }
+}
+
+/**
+ * @} end of Pooling group
+ */
@@ -0,0 +1,371 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pool_q15_HWC.c
+ * Description:  Q15 pooling functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief A few utility functions used by pooling functions
+ *
+ *
+ */
+
+static void compare_and_replace_if_larger_q15( q15_t *base, const q15_t *target, const uint16_t length )
+{
+    q15_t    *pIn = base;
+    const q15_t *pCom = target;
+    uint16_t  cnt;
+
+#if defined (ARM_MATH_DSP)
+    q31_t     in, com;
+
+    cnt = length >> 1;
+
+    while( cnt > 0u )
+    {
+        in = *__SIMD32( pIn );
+        com = *__SIMD32( pCom )++;
+
+        /* GE flags are set for the halfwords where com >= in */
+        ( void ) __SSUB16( com, in );
+        *__SIMD32( pIn )++ = __SEL( com, in );
+
+        cnt--;
+    }
+
+    cnt = length & 0x1;
+#else
+    cnt = length;
+#endif                          /* ARM_MATH_DSP */
+
+    while( cnt > 0u )
+    {
+        if( *pCom > *pIn )
+        {
+            *pIn = *pCom;
+        }
+
+        pIn++;
+        pCom++;
+        cnt--;
+    }
+}
+
+static void accumulate_q15_to_q31( q31_t *base, const q15_t *target, const uint16_t length )
+{
+    q31_t    *pCnt = base;
+    const q15_t *pV = target;
+    uint16_t  cnt = length >> 2;
+
+    while( cnt > 0u )
+    {
+        pCnt[0] += pV[0];
+        pCnt[1] += pV[1];
+        pCnt[2] += pV[2];
+        pCnt[3] += pV[3];
+
+        pCnt += 4;
+        pV += 4;
+        cnt--;
+    }
+
+    cnt = length & 0x3;
+
+    while( cnt > 0u )
+    {
+        *pCnt++ += *pV++;
+        cnt--;
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/**
+ * @brief Q15 max pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for input
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  0
+ *
+ * Each output pixel is built by comparing whole input pixels, two channels
+ * per word on cores with the DSP extension. Padded positions are ignored,
+ * so the padding must be smaller than the kernel. The input is not
+ * modified.
+ *
+ */
+
+void arm_maxpool_q15_HWC_nonsquare( const q15_t *Im_in,
+                                    const uint16_t dim_im_in_x,
+                                    const uint16_t dim_im_in_y,
+                                    const uint16_t ch_im_in,
+                                    const uint16_t dim_kernel_x,
+                                    const uint16_t dim_kernel_y,
+                                    const uint16_t padding_x,
+                                    const uint16_t padding_y,
+                                    const uint16_t stride_x,
+                                    const uint16_t stride_y,
+                                    const uint16_t dim_im_out_x,
+                                    const uint16_t dim_im_out_y,
+                                    q15_t *bufferA,
+                                    q15_t *Im_out )
+{
+    int32_t   i_x, i_y, k_x, k_y;
+    int32_t   base_x, base_y;
+    int32_t   ker_x_start, ker_x_end, ker_y_start, ker_y_end;
+    q15_t    *pOut = Im_out;
+
+    for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+    {
+        base_y = stride_y * i_y - padding_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( dim_kernel_y, dim_im_in_y - base_y );
+
+        for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+        {
+            base_x = stride_x * i_x - padding_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( dim_kernel_x, dim_im_in_x - base_x );
+
+            /* the first pixel of the window is copied, the others are compared */
+            memcpy( pOut, Im_in + ( ( base_y + ker_y_start ) * dim_im_in_x + base_x + ker_x_start ) * ch_im_in,
+                    ch_im_in * sizeof( q15_t ) );
+
+            for( k_y = ker_y_start; k_y < ker_y_end; k_y++ )
+            {
+                for( k_x = ker_x_start; k_x < ker_x_end; k_x++ )
+                {
+                    compare_and_replace_if_larger_q15( pOut, Im_in + ( ( base_y + k_y ) * dim_im_in_x + base_x + k_x ) * ch_im_in,
+                                                       ch_im_in );
+                }
+            }
+
+            pOut += ch_im_in;
+        }
+    }
+}
+
+/**
+ * @brief Q15 average pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  2*ch_im_in
+ *
+ * bufferA holds one 32-bit sum per channel and must be word aligned.
+ *
+ * The average is taken over the input pixels inside the window only and
+ * is truncated towards zero, as in the reference implementation. The
+ * input is not modified.
+ *
+ */
+
+void arm_avepool_q15_HWC_nonsquare( const q15_t *Im_in,
+                                    const uint16_t dim_im_in_x,
+                                    const uint16_t dim_im_in_y,
+                                    const uint16_t ch_im_in,
+                                    const uint16_t dim_kernel_x,
+                                    const uint16_t dim_kernel_y,
+                                    const uint16_t padding_x,
+                                    const uint16_t padding_y,
+                                    const uint16_t stride_x,
+                                    const uint16_t stride_y,
+                                    const uint16_t dim_im_out_x,
+                                    const uint16_t dim_im_out_y,
+                                    q15_t *bufferA,
+                                    q15_t *Im_out )
+{
+    q31_t    *sum = ( q31_t * ) bufferA;
+    int32_t   i_x, i_y, k_x, k_y;
+    int32_t   base_x, base_y;
+    int32_t   ker_x_start, ker_x_end, ker_y_start, ker_y_end;
+    int32_t   count;
+    uint16_t  i_ch;
+    q15_t    *pOut = Im_out;
+
+    for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+    {
+        base_y = stride_y * i_y - padding_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( dim_kernel_y, dim_im_in_y - base_y );
+
+        for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+        {
+            const q15_t *pIn;
+
+            base_x = stride_x * i_x - padding_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( dim_kernel_x, dim_im_in_x - base_x );
+
+            memset( sum, 0, ch_im_in * sizeof( q31_t ) );
+
+            for( k_y = ker_y_start; k_y < ker_y_end; k_y++ )
+            {
+                /* the pixels of a window row are contiguous */
+                pIn = Im_in + ( ( base_y + k_y ) * dim_im_in_x + base_x + ker_x_start ) * ch_im_in;
+
+                for( k_x = ker_x_start; k_x < ker_x_end; k_x++ )
+                {
+                    accumulate_q15_to_q31( sum, pIn, ch_im_in );
+                    pIn += ch_im_in;
+                }
+            }
+
+            count = ( ker_y_end - ker_y_start ) * ( ker_x_end - ker_x_start );
+
+            for( i_ch = 0; i_ch < ch_im_in; i_ch++ )
+            {
+                pOut[i_ch] = ( q15_t )( sum[i_ch] / count );
+            }
+
+            pOut += ch_im_in;
+        }
+    }
+}
+
+/**
+ * @brief Q15 max pooling function
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor dimension
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding sizes
+ * @param[in]       stride      pooling stride
+ * @param[in]       dim_im_out  output tensor dimension
+ * @param[in,out]   bufferA     pointer to buffer space for input
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  0
+ *
+ * Square window version of arm_maxpool_q15_HWC_nonsquare(). It completes
+ * the q15 layer chain, e.g. after arm_convolve_HWC_q15_fast(), without a
+ * conversion to q7 and back.
+ *
+ */
+
+void arm_maxpool_q15_HWC( const q15_t *Im_in,
+                          const uint16_t dim_im_in,
+                          const uint16_t ch_im_in,
+                          const uint16_t dim_kernel,
+                          const uint16_t padding,
+                          const uint16_t stride,
+                          const uint16_t dim_im_out,
+                          q15_t *bufferA,
+                          q15_t *Im_out )
+{
+    arm_maxpool_q15_HWC_nonsquare( Im_in, dim_im_in, dim_im_in, ch_im_in, dim_kernel, dim_kernel, padding, padding,
+                                   stride, stride, dim_im_out, dim_im_out, bufferA, Im_out );
+}
+
+/**
+ * @brief Q15 average pooling function
+ * @param[in]       Im_in       pointer to input tensor
+ * @param[in]       dim_im_in   input tensor dimension
+ * @param[in]       ch_im_in    number of input tensor channels
+ * @param[in]       dim_kernel  filter kernel size
+ * @param[in]       padding     padding sizes
+ * @param[in]       stride      pooling stride
+ * @param[in]       dim_im_out  output tensor dimension
+ * @param[in,out]   bufferA     pointer to buffer space for the sums
+ * @param[in,out]   Im_out      pointer to output tensor
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  2*ch_im_in
+ *
+ * Square window version of arm_avepool_q15_HWC_nonsquare().
+ *
+ */
+
+void arm_avepool_q15_HWC( const q15_t *Im_in,
+                          const uint16_t dim_im_in,
+                          const uint16_t ch_im_in,
+                          const uint16_t dim_kernel,
+                          const uint16_t padding,
+                          const uint16_t stride,
+                          const uint16_t dim_im_out,
+                          q15_t *bufferA,
+                          q15_t *Im_out )
+{
+    arm_avepool_q15_HWC_nonsquare( Im_in, dim_im_in, dim_im_in, ch_im_in, dim_kernel, dim_kernel, padding, padding,
+                                   stride, stride, dim_im_out, dim_im_out, bufferA, Im_out );
+}
+
+/**
+ * @} end of Pooling group
+ */
@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pool_q7_HWC_nonsquare.c
+ * Description:  Q7 pooling functions with non-square windows
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief A few utility functions used by pooling functions
+ *
+ *
+ */
+
+static void compare_and_replace_if_larger_q7( q7_t *base, const q7_t *target, const uint16_t length )
+{
+    q7_t     *pIn = base;
+    const q7_t *pCom = target;
+    uint16_t  cnt;
+
+#if defined (ARM_MATH_DSP)
+    q31_t     in, com;
+
+    cnt = length >> 2;
+
+    while( cnt > 0u )
+    {
+        in = *__SIMD32( pIn );
+        com = *__SIMD32( pCom )++;
+
+        /* GE flags are set for the bytes where com >= in */
+        ( void ) __SSUB8( com, in );
+        *__SIMD32( pIn )++ = __SEL( com, in );
+
+        cnt--;
+    }
+
+    cnt = length & 0x3;
+#else
+    cnt = length;
+#endif                          /* ARM_MATH_DSP */
+
+    while( cnt > 0u )
+    {
+        if( *pCom > *pIn )
+        {
+            *pIn = *pCom;
+        }
+
+        pIn++;
+        pCom++;
+        cnt--;
+    }
+}
+
+static void accumulate_q7_to_q31( q31_t *base, const q7_t *target, const uint16_t length )
+{
+    q31_t    *pCnt = base;
+    const q7_t *pV = target;
+    uint16_t  cnt = length >> 2;
+
+    while( cnt > 0u )
+    {
+        pCnt[0] += pV[0];
+        pCnt[1] += pV[1];
+        pCnt[2] += pV[2];
+        pCnt[3] += pV[3];
+
+        pCnt += 4;
+        pV += 4;
+        cnt--;
+    }
+
+    cnt = length & 0x3;
+
+    while( cnt > 0u )
+    {
+        *pCnt++ += *pV++;
+        cnt--;
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/**
+ * @brief Q7 max pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for input
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  0
+ *
+ * Each output pixel is built by comparing whole input pixels, i.e. all
+ * channels at a time. Padded positions are ignored, so the padding must
+ * be smaller than the kernel. Unlike arm_maxpool_q7_HWC(), the input is
+ * not modified.
+ *
+ */
+
+void arm_maxpool_q7_HWC_nonsquare( const q7_t *Im_in,
+                                   const uint16_t dim_im_in_x,
+                                   const uint16_t dim_im_in_y,
+                                   const uint16_t ch_im_in,
+                                   const uint16_t dim_kernel_x,
+                                   const uint16_t dim_kernel_y,
+                                   const uint16_t padding_x,
+                                   const uint16_t padding_y,
+                                   const uint16_t stride_x,
+                                   const uint16_t stride_y,
+                                   const uint16_t dim_im_out_x,
+                                   const uint16_t dim_im_out_y,
+                                   q7_t *bufferA,
+                                   q7_t *Im_out )
+{
+    int32_t   i_x, i_y, k_x, k_y;
+    int32_t   base_x, base_y;
+    int32_t   ker_x_start, ker_x_end, ker_y_start, ker_y_end;
+    q7_t     *pOut = Im_out;
+
+    for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+    {
+        base_y = stride_y * i_y - padding_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( dim_kernel_y, dim_im_in_y - base_y );
+
+        for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+        {
+            base_x = stride_x * i_x - padding_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( dim_kernel_x, dim_im_in_x - base_x );
+
+            /* the first pixel of the window is copied, the others are compared */
+            memcpy( pOut, Im_in + ( ( base_y + ker_y_start ) * dim_im_in_x + base_x + ker_x_start ) * ch_im_in, ch_im_in );
+
+            for( k_y = ker_y_start; k_y < ker_y_end; k_y++ )
+            {
+                for( k_x = ker_x_start; k_x < ker_x_end; k_x++ )
+                {
+                    compare_and_replace_if_larger_q7( pOut, Im_in + ( ( base_y + k_y ) * dim_im_in_x + base_x + k_x ) * ch_im_in,
+                                                      ch_im_in );
+                }
+            }
+
+            pOut += ch_im_in;
+        }
+    }
+}
+
+/**
+ * @brief Q7 average pooling function with non-square window
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in_x  input tensor dimension x
+ * @param[in]       dim_im_in_y  input tensor dimension y
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       dim_kernel_x filter kernel size x
+ * @param[in]       dim_kernel_y filter kernel size y
+ * @param[in]       padding_x    padding size x
+ * @param[in]       padding_y    padding size y
+ * @param[in]       stride_x     pooling stride x
+ * @param[in]       stride_y     pooling stride y
+ * @param[in]       dim_im_out_x output tensor dimension x
+ * @param[in]       dim_im_out_y output tensor dimension y
+ * @param[in,out]   bufferA      pointer to buffer space for the sums
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  4*ch_im_in
+ *
+ * bufferA holds one 32-bit sum per channel and must be word aligned.
+ *
+ * The average is taken over the input pixels inside the window only and
+ * is truncated towards zero, as in the reference implementation. The
+ * input is not modified.
+ *
+ */
+
+void arm_avepool_q7_HWC_nonsquare( const q7_t *Im_in,
+                                   const uint16_t dim_im_in_x,
+                                   const uint16_t dim_im_in_y,
+                                   const uint16_t ch_im_in,
+                                   const uint16_t dim_kernel_x,
+                                   const uint16_t dim_kernel_y,
+                                   const uint16_t padding_x,
+                                   const uint16_t padding_y,
+                                   const uint16_t stride_x,
+                                   const uint16_t stride_y,
+                                   const uint16_t dim_im_out_x,
+                                   const uint16_t dim_im_out_y,
+                                   q7_t *bufferA,
+                                   q7_t *Im_out )
+{
+    q31_t    *sum = ( q31_t * ) bufferA;
+    int32_t   i_x, i_y, k_x, k_y;
+    int32_t   base_x, base_y;
+    int32_t   ker_x_start, ker_x_end, ker_y_start, ker_y_end;
+    int32_t   count;
+    uint16_t  i_ch;
+    q7_t     *pOut = Im_out;
+
+    for( i_y = 0; i_y < dim_im_out_y; i_y++ )
+    {
+        base_y = stride_y * i_y - padding_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( dim_kernel_y, dim_im_in_y - base_y );
+
+        for( i_x = 0; i_x < dim_im_out_x; i_x++ )
+        {
+            const q7_t *pIn;
+
+            base_x = stride_x * i_x - padding_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( dim_kernel_x, dim_im_in_x - base_x );
+
+            memset( sum, 0, ch_im_in * sizeof( q31_t ) );
+
+            for( k_y = ker_y_start; k_y < ker_y_end; k_y++ )
+            {
+                /* the pixels of a window row are contiguous */
+                pIn = Im_in + ( ( base_y + k_y ) * dim_im_in_x + base_x + ker_x_start ) * ch_im_in;
+
+                for( k_x = ker_x_start; k_x < ker_x_end; k_x++ )
+                {
+                    accumulate_q7_to_q31( sum, pIn, ch_im_in );
+                    pIn += ch_im_in;
+                }
+            }
+
+            count = ( ker_y_end - ker_y_start ) * ( ker_x_end - ker_x_start );
+
+            for( i_ch = 0; i_ch < ch_im_in; i_ch++ )
+            {
+                pOut[i_ch] = ( q7_t )( sum[i_ch] / count );
+            }
+
+            pOut += ch_im_in;
+        }
+    }
+}
+
+/**
+ * @} end of Pooling group
+ */
@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pool_s8_HWC.c
+ * Description:  int8 asymmetric versions of pooling functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief A few utility functions used by pooling functions
+ *
+ *
+ */
+
+static void compare_and_replace_if_larger_s8( q7_t *base, const q7_t *target, const uint16_t length )
+{
+    q7_t     *pIn = base;
+    const q7_t *pCom = target;
+    uint16_t  cnt;
+
+#if defined (ARM_MATH_DSP)
+    q31_t     in, com;
+
+    cnt = length >> 2;
+
+    while( cnt > 0u )
+    {
+        in = *__SIMD32( pIn );
+        com = *__SIMD32( pCom )++;
+
+        /* GE flags are set for the bytes where com >= in */
+        ( void ) __SSUB8( com, in );
+        *__SIMD32( pIn )++ = __SEL( com, in );
+
+        cnt--;
+    }
+
+    cnt = length & 0x3;
+#else
+    cnt = length;
+#endif                          /* ARM_MATH_DSP */
+
+    while( cnt > 0u )
+    {
+        if( *pCom > *pIn )
+        {
+            *pIn = *pCom;
+        }
+
+        pIn++;
+        pCom++;
+        cnt--;
+    }
+}
+
+static void accumulate_s8_to_s32( q31_t *base, const q7_t *target, const uint16_t length )
+{
+    q31_t    *pCnt = base;
+    const q7_t *pV = target;
+    uint16_t  cnt = length >> 2;
+
+    while( cnt > 0u )
+    {
+        pCnt[0] += pV[0];
+        pCnt[1] += pV[1];
+        pCnt[2] += pV[2];
+        pCnt[3] += pV[3];
+
+        pCnt += 4;
+        pV += 4;
+        cnt--;
+    }
+
+    cnt = length & 0x3;
+
+    while( cnt > 0u )
+    {
+        *pCnt++ += *pV++;
+        cnt--;
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+/**
+ * @brief int8 max pooling function
+ * @param[in]       input       pointer to input tensor
+ * @param[in]       input_x     input tensor dimension x
+ * @param[in]       input_y     input tensor dimension y
+ * @param[in]       ch          number of input and output tensor channels
+ * @param[in]       kernel_x    filter kernel size x
+ * @param[in]       kernel_y    filter kernel size y
+ * @param[in]       pad_x       padding size x
+ * @param[in]       pad_y       padding size y
+ * @param[in]       stride_x    pooling stride x
+ * @param[in]       stride_y    pooling stride y
+ * @param[in]       act_min     minimum output value
+ * @param[in]       act_max     maximum output value
+ * @param[in,out]   output      pointer to output tensor
+ * @param[in]       output_x    output tensor dimension x
+ * @param[in]       output_y    output tensor dimension y
+ * @return none.
+ *
+ * @details
+ *
+ * The input and output share their quantization parameters, so the
+ * maximum is taken on the int8 values directly. Padded positions are
+ * ignored. Each output pixel is built by comparing whole input pixels,
+ * i.e. all channels at a time, and the input is not modified.
+ *
+ */
+
+void arm_max_pool_s8( const q7_t *input,
+                      const uint16_t input_x,
+                      const uint16_t input_y,
+                      const uint16_t ch,
+                      const uint16_t kernel_x,
+                      const uint16_t kernel_y,
+                      const uint16_t pad_x,
+                      const uint16_t pad_y,
+                      const uint16_t stride_x,
+                      const uint16_t stride_y,
+                      const int32_t act_min,
+                      const int32_t act_max,
+                      q7_t *output,
+                      const uint16_t output_x,
+                      const uint16_t output_y )
+{
+    int32_t   i_x, i_y, k_x, k_y;
+    int32_t   base_x, base_y;
+    int32_t   ker_x_start, ker_x_end, ker_y_start, ker_y_end;
+    uint16_t  i_ch;
+    q7_t     *pOut = output;
+
+    for( i_y = 0; i_y < output_y; i_y++ )
+    {
+        base_y = stride_y * i_y - pad_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( kernel_y, input_y - base_y );
+
+        for( i_x = 0; i_x < output_x; i_x++ )
+        {
+            base_x = stride_x * i_x - pad_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( kernel_x, input_x - base_x );
+
+            memset( pOut, NN_Q7_MIN, ch );
+
+            for( k_y = ker_y_start; k_y < ker_y_end; k_y++ )
+            {
+                for( k_x = ker_x_start; k_x < ker_x_end; k_x++ )
+                {
+                    compare_and_replace_if_larger_s8( pOut, input + ( ( base_y + k_y ) * input_x + base_x + k_x ) * ch, ch );
+                }
+            }
+
+            for( i_ch = 0; i_ch < ch; i_ch++ )
+            {
+                pOut[i_ch] = ( q7_t ) MIN( MAX( pOut[i_ch], act_min ), act_max );
+            }
+
+            pOut += ch;
+        }
+    }
+}
+
+/**
+ * @brief int8 average pooling function
+ * @param[in]       input       pointer to input tensor
+ * @param[in]       input_x     input tensor dimension x
+ * @param[in]       input_y     input tensor dimension y
+ * @param[in]       ch          number of input and output tensor channels
+ * @param[in]       kernel_x    filter kernel size x
+ * @param[in]       kernel_y    filter kernel size y
+ * @param[in]       pad_x       padding size x
+ * @param[in]       pad_y       padding size y
+ * @param[in]       stride_x    pooling stride x
+ * @param[in]       stride_y    pooling stride y
+ * @param[in]       act_min     minimum output value
+ * @param[in]       act_max     maximum output value
+ * @param[in,out]   output      pointer to output tensor
+ * @param[in]       output_x    output tensor dimension x
+ * @param[in]       output_y    output tensor dimension y
+ * @param[in,out]   buffer_a    pointer to buffer space for the sums
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * buffer_a size:  2*ch
+ *
+ * buffer_a holds one int32 sum per channel and must be word aligned.
+ *
+ * The input and output share their quantization parameters. The average
+ * is taken over the input pixels inside the window only, and is rounded
+ * half away from zero as TensorFlow Lite does.
+ *
+ */
+
+void arm_avgpool_s8( const q7_t *input,
+                     const uint16_t input_x,
+                     const uint16_t input_y,
+                     const uint16_t ch,
+                     const uint16_t kernel_x,
+                     const uint16_t kernel_y,
+                     const uint16_t pad_x,
+                     const uint16_t pad_y,
+                     const uint16_t stride_x,
+                     const uint16_t stride_y,
+                     const int32_t act_min,
+                     const int32_t act_max,
+                     q7_t *output,
+                     const uint16_t output_x,
+                     const uint16_t output_y,
+                     q15_t *buffer_a )
+{
+    q31_t    *sum = ( q31_t * ) buffer_a;
+    int32_t   i_x, i_y, k_y;
+    int32_t   base_x, base_y;
+    int32_t   ker_x_start, ker_x_end, ker_y_start, ker_y_end;
+    int32_t   count, half, avg;
+    uint16_t  i_ch;
+    q7_t     *pOut = output;
+
+    for( i_y = 0; i_y < output_y; i_y++ )
+    {
+        base_y = stride_y * i_y - pad_y;
+        ker_y_start = MAX( 0, -base_y );
+        ker_y_end = MIN( kernel_y, input_y - base_y );
+
+        for( i_x = 0; i_x < output_x; i_x++ )
+        {
+            const q7_t *pIn;
+            int32_t   k_x;
+
+            base_x = stride_x * i_x - pad_x;
+            ker_x_start = MAX( 0, -base_x );
+            ker_x_end = MIN( kernel_x, input_x - base_x );
+
+            memset( sum, 0, ch * sizeof( q31_t ) );
+
+            for( k_y = ker_y_start; k_y < ker_y_end; k_y++ )
+            {
+                /* the pixels of a window row are contiguous */
+                pIn = input + ( ( base_y + k_y ) * input_x + base_x + ker_x_start ) * ch;
+
+                for( k_x = ker_x_start; k_x < ker_x_end; k_x++ )
+                {
+                    accumulate_s8_to_s32( sum, pIn, ch );
+                    pIn += ch;
+                }
+            }
+
+            count = ( ker_y_end - ker_y_start ) * ( ker_x_end - ker_x_start );
+            half = count >> 1;
+
+            for( i_ch = 0; i_ch < ch; i_ch++ )
+            {
+                avg = sum[i_ch] > 0 ? ( sum[i_ch] + half ) / count : ( sum[i_ch] - half ) / count;
+                pOut[i_ch] = ( q7_t ) MIN( MAX( avg, act_min ), act_max );
+            }
+
+            pOut += ch;
+        }
+    }
+}
+
+/**
+ * @} end of Pooling group
+ */
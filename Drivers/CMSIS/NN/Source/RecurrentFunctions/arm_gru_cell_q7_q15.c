@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_gru_cell_q7_q15.c
+ * Description:  Mixed Q15-Q7 GRU cell
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/**
+ * @brief Mixed Q15-Q7 GRU cell function
+ * @param[in]       x               pointer to input vector
+ * @param[in]       dim_x           length of the input vector
+ * @param[in,out]   h               pointer to hidden state, Q0.15
+ * @param[in]       dim_h           length of the hidden state
+ * @param[in]       wt_x            pointer to input weights, reordered for the opt fully-connected function
+ * @param[in]       bias_x          pointer to input bias
+ * @param[in]       bias_shift_x    amount of left-shift for the input bias
+ * @param[in]       out_shift_x     amount of right-shift for the input part
+ * @param[in]       wt_h            pointer to recurrent weights, reordered for the opt fully-connected function
+ * @param[in]       bias_h          pointer to recurrent bias
+ * @param[in]       bias_shift_h    amount of left-shift for the recurrent bias
+ * @param[in]       out_shift_h     amount of right-shift for the recurrent part
+ * @param[in]       gate_int_width  integer bits of the gate pre-activations, up to 3
+ * @param[in,out]   bufferA         pointer to buffer space for the gates
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  6*dim_h
+ *
+ * One time step of the GRU, with the reset gate applied after the
+ * recurrent matrix multiplication:
+ *
+ * <pre>r = sigmoid( W_r &sdot; x + b_r + U_r &sdot; h + c_r )
+ * z = sigmoid( W_z &sdot; x + b_z + U_z &sdot; h + c_z )
+ * n = tanh( W_n &sdot; x + b_n + r &times; ( U_n &sdot; h + c_n ) )
+ * h = ( 1 - z ) &times; n + z &times; h </pre>
+ *
+ * This is the cell of torch.nn.GRU, and of Keras with reset_after=True.
+ * Since r is applied after the multiplication, the three gates are
+ * computed in one pass over the input weights wt_x = {W_r; W_z; W_n},
+ * 3*dim_h x dim_x, and one pass over the recurrent weights
+ * wt_h = {U_r; U_z; U_n}, 3*dim_h x dim_h, both with
+ * arm_fully_connected_mat_q7_vec_q15_opt(). Both parts must give the
+ * pre-activations with gate_int_width integer bits, which is what
+ * arm_nn_activations_direct_q15() expects, and the two have their own
+ * shifts since x and h can have different scales.
+ *
+ * h is Q0.15, so it can be fed back without rescaling.
+ *
+ */
+
+arm_status arm_gru_cell_q7_q15( const q15_t *x,
+                                const uint16_t dim_x,
+                                q15_t *h,
+                                const uint16_t dim_h,
+                                const q7_t *wt_x,
+                                const q7_t *bias_x,
+                                const uint16_t bias_shift_x,
+                                const uint16_t out_shift_x,
+                                const q7_t *wt_h,
+                                const q7_t *bias_h,
+                                const uint16_t bias_shift_h,
+                                const uint16_t out_shift_h,
+                                const uint16_t gate_int_width,
+                                q15_t *bufferA )
+{
+    q15_t    *pGx = bufferA;
+    q15_t    *pGh = bufferA + 3 * dim_h;
+    q15_t    *pR = pGx;
+    q15_t    *pZ = pGx + dim_h;
+    q15_t    *pN = pGx + 2 * dim_h;
+    uint16_t  i;
+
+    if( gate_int_width > 3 )
+    {
+        /* the activation tables cover at most 3 integer bits */
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* all the gates in one pass over each weight matrix */
+    arm_fully_connected_mat_q7_vec_q15_opt( x, wt_x, dim_x, 3 * dim_h, bias_shift_x, out_shift_x, bias_x, pGx, NULL );
+    arm_fully_connected_mat_q7_vec_q15_opt( h, wt_h, dim_h, 3 * dim_h, bias_shift_h, out_shift_h, bias_h, pGh, NULL );
+
+    /* r and z are next to each other */
+    for( i = 0; i < 2 * dim_h; i++ )
+    {
+        pGx[i] = ( q15_t ) __SSAT( ( q31_t ) pGx[i] + pGh[i], 16 );
+    }
+
+    arm_nn_activations_direct_q15( pR, 2 * dim_h, gate_int_width, ARM_SIGMOID );
+
+    for( i = 0; i < dim_h; i++ )
+    {
+        pN[i] = ( q15_t ) __SSAT( ( q31_t ) pN[i] + ( ( ( q31_t ) pR[i] * pGh[2 * dim_h + i] ) >> 15 ), 16 );
+    }
+
+    arm_nn_activations_direct_q15( pN, dim_h, gate_int_width, ARM_TANH );
+
+    for( i = 0; i < dim_h; i++ )
+    {
+        /* (1 - z) * n + z * h = n + z * (h - n) */
+        h[i] = ( q15_t ) __SSAT( ( q31_t ) pN[i] + ( ( ( q31_t ) pZ[i] * ( h[i] - pN[i] ) ) >> 15 ), 16 );
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of RNN group
+ */
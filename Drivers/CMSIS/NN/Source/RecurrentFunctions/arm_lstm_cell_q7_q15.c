@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_lstm_cell_q7_q15.c
+ * Description:  Mixed Q15-Q7 LSTM cell
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup RNN
+ * @{
+ */
+
+/**
+ * @brief Mixed Q15-Q7 LSTM cell function
+ * @param[in]       x               pointer to input vector
+ * @param[in]       dim_x           length of the input vector
+ * @param[in,out]   h               pointer to hidden state, Q0.15
+ * @param[in,out]   c               pointer to cell state
+ * @param[in]       dim_h           length of the hidden and cell states
+ * @param[in]       wt              pointer to gate weights, reordered for the opt fully-connected function
+ * @param[in]       bias            pointer to gate bias
+ * @param[in]       bias_shift      amount of left-shift for bias
+ * @param[in]       out_shift       amount of right-shift for output
+ * @param[in]       gate_int_width  integer bits of the gate pre-activations, up to 3
+ * @param[in]       cell_int_width  integer bits of the cell state, up to 3
+ * @param[in,out]   bufferA         pointer to buffer space for the input and the gates
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size:  dim_x + 5*dim_h
+ *
+ * One time step of the LSTM:
+ *
+ * <pre>i = sigmoid( W_i &sdot; {x, h} + b_i )
+ * f = sigmoid( W_f &sdot; {x, h} + b_f )
+ * g = tanh( W_g &sdot; {x, h} + b_g )
+ * o = sigmoid( W_o &sdot; {x, h} + b_o )
+ * c = f &times; c + i &times; g
+ * h = o &times; tanh( c ) </pre>
+ *
+ * x and h are concatenated in bufferA, and the four gates are computed in
+ * one pass over the weights with arm_fully_connected_mat_q7_vec_q15_opt().
+ * wt is the 4*dim_h x (dim_x + dim_h) matrix {W_i; W_f; W_g; W_o}, in the
+ * order of torch.nn.LSTM, reordered as a whole for the opt function. The
+ * bias and the shifts are shared by the four gates, and must give the
+ * pre-activations with gate_int_width integer bits, which is what
+ * arm_nn_activations_direct_q15() expects.
+ *
+ * The gates are Q0.15. The cell state has cell_int_width integer bits and
+ * saturates. h is Q0.15, so it can be fed back without rescaling.
+ *
+ */
+
+arm_status arm_lstm_cell_q7_q15( const q15_t *x,
+                                 const uint16_t dim_x,
+                                 q15_t *h,
+                                 q15_t *c,
+                                 const uint16_t dim_h,
+                                 const q7_t *wt,
+                                 const q7_t *bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 const uint16_t gate_int_width,
+                                 const uint16_t cell_int_width,
+                                 q15_t *bufferA )
+{
+    q15_t    *pVec = bufferA;
+    q15_t    *pI = bufferA + dim_x + dim_h;
+    q15_t    *pF = pI + dim_h;
+    q15_t    *pG = pF + dim_h;
+    q15_t    *pO = pG + dim_h;
+    uint16_t  i;
+
+    if( gate_int_width > 3 || cell_int_width > 3 )
+    {
+        /* the activation tables cover at most 3 integer bits */
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    memcpy( pVec, x, dim_x * sizeof( q15_t ) );
+    memcpy( pVec + dim_x, h, dim_h * sizeof( q15_t ) );
+
+    /* all the gates in one pass over the weights */
+    arm_fully_connected_mat_q7_vec_q15_opt( pVec, wt, dim_x + dim_h, 4 * dim_h, bias_shift, out_shift, bias, pI,
+                                            NULL );
+
+    /* i and f are next to each other */
+    arm_nn_activations_direct_q15( pI, 2 * dim_h, gate_int_width, ARM_SIGMOID );
+    arm_nn_activations_direct_q15( pG, dim_h, gate_int_width, ARM_TANH );
+    arm_nn_activations_direct_q15( pO, dim_h, gate_int_width, ARM_SIGMOID );
+
+    for( i = 0; i < dim_h; i++ )
+    {
+        q31_t     sum = ( ( q31_t ) pF[i] * c[i] ) >> 15;
+
+        sum += ( ( q31_t ) pI[i] * pG[i] ) >> ( 15 + cell_int_width );
+        c[i] = ( q15_t ) __SSAT( sum, 16 );
+
+        /* g is not needed any more, its place takes tanh(c) */
+        pG[i] = c[i];
+    }
+
+    arm_nn_activations_direct_q15( pG, dim_h, cell_int_width, ARM_TANH );
+
+    for( i = 0; i < dim_h; i++ )
+    {
+        h[i] = ( q15_t ) __SSAT( ( ( q31_t ) pO[i] * pG[i] ) >> 15, 16 );
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of RNN group
+ */
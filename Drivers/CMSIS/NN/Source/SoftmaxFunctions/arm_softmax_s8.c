@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_s8.c
+ * Description:  int8 asymmetric softmax function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/* integer bits of the sum of exponentials */
+#define ACCUM_BITS 12
+
+#define MASK_IF_ZERO(x)     ((x) == 0 ? ~0 : 0)
+#define MASK_IF_NON_ZERO(x) ((x) != 0 ? ~0 : 0)
+#define SELECT_USING_MASK(mask, a, b) (((mask) & (a)) ^ (~(mask) & (b)))
+
+/**
+ * @brief Saturating multiply by a power of two, 0 < exp < 31
+ */
+
+static q31_t mult_by_power_of_two( const q31_t val, const int32_t exp )
+{
+    const q31_t thresh = ( ( 1 << ( 31 - exp ) ) - 1 );
+    q31_t     result = ( q31_t )( ( uint32_t ) val << exp );
+
+    result = SELECT_USING_MASK( MASK_IF_NON_ZERO( val > thresh ), NN_Q31_MAX, result );
+    result = SELECT_USING_MASK( MASK_IF_NON_ZERO( val < -thresh ), NN_Q31_MIN, result );
+    return result;
+}
+
+/**
+ * @brief exp(x) for x <= 0, x with 5 integer bits, result in Q31
+ */
+
+static q31_t exp_on_negative_values( const q31_t val )
+{
+    q31_t     mask;
+    int32_t   shift = 24;
+
+    const q31_t val_mod_minus_quarter = ( val & ( ( 1 << shift ) - 1 ) ) - ( 1 << shift );
+    const q31_t remainder = val_mod_minus_quarter - val;
+    const q31_t x = ( q31_t )( ( uint32_t ) val_mod_minus_quarter << 5 ) + ( 1 << 28 );
+    const q31_t x2 = arm_nn_sat_doubling_high_mult( x, x );
+
+    /* exp(x) on [-1/4, 0) from a Taylor series around -1/8 */
+    q31_t     result = 1895147668 +
+                       arm_nn_sat_doubling_high_mult( 1895147668,
+                               x + arm_nn_divide_by_power_of_two(
+                                   arm_nn_sat_doubling_high_mult(
+                                       arm_nn_divide_by_power_of_two( arm_nn_sat_doubling_high_mult( x2, x2 ), 2 ) +
+                                       arm_nn_sat_doubling_high_mult( x2, x ), 715827883 ) + x2, 1 ) );
+
+    /* multiply by exp(-2^k) for each bit of the integer part */
+#define SELECT_IF_NON_ZERO(x)                                                                    \
+    {                                                                                            \
+        mask = MASK_IF_NON_ZERO( remainder & ( 1 << shift++ ) );                                 \
+        result = SELECT_USING_MASK( mask, arm_nn_sat_doubling_high_mult( result, x ), result );  \
+    }
+
+    SELECT_IF_NON_ZERO( 1672461947 )
+    SELECT_IF_NON_ZERO( 1302514674 )
+    SELECT_IF_NON_ZERO( 790015084 )
+    SELECT_IF_NON_ZERO( 290630308 )
+    SELECT_IF_NON_ZERO( 39332535 )
+    SELECT_IF_NON_ZERO( 720401 )
+    SELECT_IF_NON_ZERO( 242 )
+
+#undef SELECT_IF_NON_ZERO
+
+    mask = MASK_IF_ZERO( val );
+    return SELECT_USING_MASK( mask, NN_Q31_MAX, result );
+}
+
+/**
+ * @brief 1 / (1 + x) for x in [0, 1), Q31 in and out
+ */
+
+static q31_t one_over_one_plus_x_for_x_in_0_1( const q31_t val )
+{
+    const q63_t sum = ( q63_t ) val + ( q63_t ) NN_Q31_MAX;
+    const q31_t half_denominator = ( q31_t )( ( sum + ( sum >= 0 ? 1 : -1 ) ) / 2L );
+    const q31_t one = ( 1 << 29 );
+    q31_t     x = 1515870810 + arm_nn_sat_doubling_high_mult( half_denominator, -1010580540 );
+    int32_t   i;
+
+    /* three Newton-Raphson iterations with 2 integer bits */
+    for( i = 0; i < 3; i++ )
+    {
+        x += mult_by_power_of_two( arm_nn_sat_doubling_high_mult( x, one - arm_nn_sat_doubling_high_mult( half_denominator, x ) ), 2 );
+    }
+
+    return mult_by_power_of_two( x, 1 );
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+/**
+ * @brief int8 softmax function
+ * @param[in]       input       pointer to input, num_rows * row_size values
+ * @param[in]       num_rows    number of rows
+ * @param[in]       row_size    number of elements in a row
+ * @param[in]       mult        input multiplier
+ * @param[in]       shift       input left shift
+ * @param[in]       diff_min    minimum difference with the row maximum that is not ignored
+ * @param[out]      output      pointer to output, scale 1/256 and zero point -128
+ * @return none.
+ *
+ * @details
+ *
+ *  This is the natural logarithm based softmax of TensorFlow Lite, with
+ *  the same fixed-point arithmetic:
+ *
+ *  y_i = exp(beta * s * (x_i - max)) / sum(exp(beta * s * (x_j - max)))
+ *
+ *  where s is the input scale. mult and shift represent beta * s with 5
+ *  integer bits, and diff_min is the negated input radius, as computed by
+ *  PreprocessSoftmaxScaling() and CalculateInputRadius(). Differences below
+ *  diff_min give -128. Rows are limited to 511 elements, which keeps the
+ *  sum of the exponentials below 2^28.
+ *
+ */
+
+void arm_softmax_s8( const q7_t *input,
+                     const int32_t num_rows,
+                     const int32_t row_size,
+                     const int32_t mult,
+                     const int32_t shift,
+                     const int32_t diff_min,
+                     q7_t *output )
+{
+    const int32_t mask = ( 1 << shift );
+    int32_t   col, row_idx;
+
+    for( row_idx = 0; row_idx < num_rows; ++row_idx )
+    {
+        /* Find the maximum value in order to ensure numerical stability */
+        q7_t      max = *input;
+        int32_t   diff, sum, headroom, bits_over_unit, shifted_scale;
+
+        for( col = 1; col < row_size; ++col )
+        {
+            max = MAX( max, input[col] );
+        }
+
+        sum = 0;
+
+        for( col = 0; col < row_size; ++col )
+        {
+            diff = input[col] - max;
+
+            if( diff >= diff_min )
+            {
+                sum += arm_nn_divide_by_power_of_two( exp_on_negative_values( arm_nn_sat_doubling_high_mult( diff * mask, mult ) ),
+                                                      ACCUM_BITS );
+            }
+        }
+
+        /* reciprocal of the sum, normalised to [1, 2) */
+        headroom = __CLZ( ( uint32_t ) sum );
+        bits_over_unit = ACCUM_BITS - headroom + 23;
+        shifted_scale = one_over_one_plus_x_for_x_in_0_1( ( q31_t )( ( ( uint32_t ) sum << headroom ) - 0x80000000U ) );
+
+        for( col = 0; col < row_size; ++col )
+        {
+            diff = input[col] - max;
+
+            if( diff >= diff_min )
+            {
+                const int32_t res =
+                    arm_nn_divide_by_power_of_two( arm_nn_sat_doubling_high_mult( shifted_scale,
+                                                   exp_on_negative_values( arm_nn_sat_doubling_high_mult( diff * mask, mult ) ) ),
+                                                   bits_over_unit ) - 128;
+                output[col] = ( q7_t ) MIN( MAX( res, -128 ), 127 );
+            }
+            else
+            {
+                output[col] = -128;
+            }
+        }
+
+        input += row_size;
+        output += row_size;
+    }
+}
+
+/**
+ * @} end of Softmax group
+ */
@@ -176,6 +176,18 @@ in voltage and temperature.*/
 
 #define USE_SPI_CRC                   1U
 
+/* ################## USB peripheral configuration ########################## */
+
+/* PMA DMA FEATURE: Use to copy the large USB packets to and from the packet
+ * memory with a DMA1 channel (USB_PMA_DMA_CHANNEL, 7 by default) instead of
+ * the CPU
+ * Activated: DMA copy code is present inside the USB driver
+ * Deactivated: the CPU copies all the packets
+ * Not run on hardware yet, only on the emulated DMA1 of the host simulations
+ */
+
+#define USE_USB_PMA_DMA               0U
+
 /* Includes ------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
@@ -112,6 +112,9 @@ typedef struct
     uint32_t                BESL;
 
     void                    *pData;      /*!< Pointer to upper stack Handler */
+    uint16_t                PMAFree;     /*!< First PMA byte left to the automatic buffer allocation */
+    uint16_t                PMAAuto;     /*!< Endpoints with automatically allocated buffers:
+                                              bit n for OUT endpoint n, bit n + 8 for IN endpoint n */
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
     void ( * SOFCallback )( struct __PCD_HandleTypeDef *hpcd );                          /*!< USB OTG PCD SOF callback                */
@@ -390,6 +393,14 @@ PCD_StateTypeDef HAL_PCD_GetState( PCD_HandleTypeDef *hpcd );
   * @}
   */
 
+/** @defgroup PCD_PMA_Size PCD Packet Memory Area size
+  * @{
+  */
+#define PCD_PMA_SIZE                                                  512U
+/**
+  * @}
+  */
+
 /**
   * @}
   */
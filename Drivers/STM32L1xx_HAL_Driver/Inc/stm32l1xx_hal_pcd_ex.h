@@ -54,6 +54,13 @@ HAL_StatusTypeDef  HAL_PCDEx_PMAConfig( PCD_HandleTypeDef *hpcd,
                                         uint16_t ep_kind,
                                         uint32_t pmaadress );
 
+HAL_StatusTypeDef  HAL_PCDEx_PMAAlloc( PCD_HandleTypeDef *hpcd,
+                                       uint16_t ep_addr,
+                                       uint8_t ep_type,
+                                       uint16_t ep_mps );
+
+HAL_StatusTypeDef  HAL_PCDEx_PMAReset( PCD_HandleTypeDef *hpcd );
+
 void HAL_PCDEx_SetConnectionState( PCD_HandleTypeDef *hpcd, uint8_t state );
 
 void HAL_PCDEx_LPM_Callback( PCD_HandleTypeDef *hpcd, PCD_LPM_MsgTypeDef msg );
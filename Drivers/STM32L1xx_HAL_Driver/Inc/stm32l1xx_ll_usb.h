@@ -166,6 +166,30 @@ typedef struct
 #define BTABLE_ADDRESS                     0x000U
 #define PMA_ACCESS                             2U
 
+/* Optional DMA copy to and from the PMA, set USE_USB_PMA_DMA to 1U in
+   stm32l1xx_hal_conf.h: packets of USB_PMA_DMA_THRESHOLD bytes or more
+   held in half-word aligned buffers are moved by DMA1 channel
+   USB_PMA_DMA_CHANNEL, which the application leaves to the USB driver.
+   The DMA copy has not been run on hardware yet: it is only checked
+   against the emulated DMA1 of the USB device library host simulations
+   (Middlewares/ST/STM32_USB_Device_Library/Sim, sim_pma_dma) */
+#ifndef USE_USB_PMA_DMA
+#define USE_USB_PMA_DMA                        0U
+#endif /* USE_USB_PMA_DMA */
+
+#if (USE_USB_PMA_DMA == 1U)
+#ifndef USB_PMA_DMA_CHANNEL
+#define USB_PMA_DMA_CHANNEL                    7U
+#endif /* USB_PMA_DMA_CHANNEL */
+
+#ifndef USB_PMA_DMA_THRESHOLD
+#define USB_PMA_DMA_THRESHOLD                 64U
+#endif /* USB_PMA_DMA_THRESHOLD */
+
+#define USB_PMA_DMA_CHANNEL_INSTANCE           ((DMA_Channel_TypeDef *)(DMA1_Channel1_BASE + \
+                                                (0x14U * (USB_PMA_DMA_CHANNEL - 1U))))
+#endif /* USE_USB_PMA_DMA */
+
 #define EP_ADDR_MSK                          0x7U
 /**
   * @}
@@ -193,6 +193,9 @@ HAL_StatusTypeDef HAL_PCD_Init( PCD_HandleTypeDef *hpcd )
         hpcd->OUT_ep[i].xfer_len = 0U;
     }
 
+    /* No endpoint buffer allocated yet */
+    ( void )HAL_PCDEx_PMAReset( hpcd );
+
     /* Init Device */
     ( void )USB_DevInit( hpcd->Instance, hpcd->Init );
 
@@ -862,6 +865,9 @@ void HAL_PCD_IRQHandler( PCD_HandleTypeDef *hpcd )
     {
         __HAL_PCD_CLEAR_FLAG( hpcd, USB_ISTR_RESET );
 
+        /* The endpoints reopened by the stack rebuild the PMA layout */
+        ( void )HAL_PCDEx_PMAReset( hpcd );
+
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
         hpcd->ResetCallback( hpcd );
 #else
@@ -1208,6 +1214,16 @@ HAL_StatusTypeDef HAL_PCD_EP_Open( PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uin
     }
 
     ep->num = ep_addr & EP_ADDR_MSK;
+
+    __HAL_LOCK( hpcd );
+
+    /* Give the endpoint its PMA buffer(s) unless configured by hand */
+    if( HAL_PCDEx_PMAAlloc( hpcd, ep_addr, ep_type, ep_mps ) != HAL_OK )
+    {
+        __HAL_UNLOCK( hpcd );
+        return HAL_ERROR;
+    }
+
     ep->maxpacket = ep_mps;
     ep->type = ep_type;
 
@@ -1223,7 +1239,6 @@ HAL_StatusTypeDef HAL_PCD_EP_Open( PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uin
         ep->data_pid_start = 0U;
     }
 
-    __HAL_LOCK( hpcd );
     ( void )USB_ActivateEndpoint( hpcd->Instance, ep );
     __HAL_UNLOCK( hpcd );
 
@@ -1681,8 +1696,10 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler( PCD_HandleTypeDef *hpcd )
                 /* clear int flag */
                 PCD_CLEAR_TX_EP_CTR( hpcd->Instance, epindex );
 
-                /* Manage all non bulk transaction or Bulk Single Buffer Transaction */
-                if( ( ep->type != EP_TYPE_BULK ) ||
+                /* Manage Single Buffer Transaction, including a bulk double buffer
+                   endpoint switched to single buffer for a short transfer */
+                if( ( ep->doublebuffer == 0U ) ||
+                        ( ( ep->type != EP_TYPE_BULK ) && ( ep->type != EP_TYPE_ISOC ) ) ||
                         ( ( ep->type == EP_TYPE_BULK ) && ( ( wEPVal & USB_EP_KIND ) == 0U ) ) )
                 {
                     /* multi-packet on the NON control IN endpoint */
@@ -1715,7 +1732,7 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler( PCD_HandleTypeDef *hpcd )
                         ( void )USB_EPStartXfer( hpcd->Instance, ep );
                     }
                 }
-                /* bulk in double buffer enable in case of transferLen> Ep_Mps */
+                /* Double Buffer Iso IN, or bulk IN when transferLen > Ep_Mps */
                 else
                 {
                     ( void )HAL_PCD_EP_DB_Transmit( hpcd, ep, wEPVal );
@@ -1755,7 +1772,9 @@ static uint16_t HAL_PCD_EP_DB_Receive( PCD_HandleTypeDef *hpcd,
             ep->xfer_len = 0U;
         }
 
-        if( ep->xfer_len == 0U )
+        /* A short packet ends the transfer as well: stop the other buffer
+           from taking data before the transfer is prepared again */
+        if( ( ep->xfer_len == 0U ) || ( count < ep->maxpacket ) )
         {
             /* set NAK to OUT endpoint since double buffer is enabled */
             PCD_SET_EP_RX_STATUS( hpcd->Instance, ep->num, USB_EP_RX_NAK );
@@ -1787,7 +1806,7 @@ static uint16_t HAL_PCD_EP_DB_Receive( PCD_HandleTypeDef *hpcd,
             ep->xfer_len = 0U;
         }
 
-        if( ep->xfer_len == 0U )
+        if( ( ep->xfer_len == 0U ) || ( count < ep->maxpacket ) )
         {
             /* set NAK on the current endpoint */
             PCD_SET_EP_RX_STATUS( hpcd->Instance, ep->num, USB_EP_RX_NAK );
@@ -1810,7 +1829,7 @@ static uint16_t HAL_PCD_EP_DB_Receive( PCD_HandleTypeDef *hpcd,
 
 
 /**
-  * @brief  Manage double buffer bulk IN transaction from ISR
+  * @brief  Manage double buffer bulk and isochronous IN transaction from ISR
   * @param  hpcd PCD handle
   * @param  ep current endpoint handle
   * @param  wEPVal Last snapshot of EPRx register value taken in ISR
@@ -1822,6 +1841,51 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
     uint32_t len;
     uint16_t TxByteNbre;
 
+    /* Isochronous: the buffers alternate on each frame, no SW_BUF handshake */
+    if( ep->type == EP_TYPE_ISOC )
+    {
+        if( ( wEPVal & USB_EP_DTOG_TX ) != 0U )
+        {
+            TxByteNbre = ( uint16_t )PCD_GET_EP_DBUF0_CNT( hpcd->Instance, ep->num );
+        }
+        else
+        {
+            TxByteNbre = ( uint16_t )PCD_GET_EP_DBUF1_CNT( hpcd->Instance, ep->num );
+        }
+
+        if( ep->xfer_len > TxByteNbre )
+        {
+            ep->xfer_len -= TxByteNbre;
+        }
+        else
+        {
+            ep->xfer_len = 0U;
+        }
+
+        if( ep->xfer_len == 0U )
+        {
+            /* Answer the next IN tokens with zero length packets rather than
+               the stale buffer, until a new transfer is started */
+            PCD_SET_EP_DBUF_CNT( hpcd->Instance, ep->num, ep->is_in, 0U );
+
+            /* TX COMPLETE */
+#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
+            hpcd->DataInStageCallback( hpcd, ep->num );
+#else
+            HAL_PCD_DataInStageCallback( hpcd, ep->num );
+#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
+        }
+        else
+        {
+            /* Load the next packet in the buffer of the next frame */
+            ep->xfer_buff += TxByteNbre;
+            ep->xfer_count += TxByteNbre;
+            ( void )USB_EPStartXfer( hpcd->Instance, ep );
+        }
+
+        return HAL_OK;
+    }
+
     /* Data Buffer0 ACK received */
     if( ( wEPVal & USB_EP_DTOG_TX ) != 0U )
     {
@@ -1840,17 +1904,15 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
         /* Transfer is completed */
         if( ep->xfer_len == 0U )
         {
-            /* TX COMPLETE */
+            /* The other buffer holds no data of this transfer: keep it, the
+               endpoint NAKs until the next transfer hands a buffer over */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
             hpcd->DataInStageCallback( hpcd, ep->num );
 #else
             HAL_PCD_DataInStageCallback( hpcd, ep->num );
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 
-            if( ( wEPVal & USB_EP_DTOG_RX ) != 0U )
-            {
-                PCD_FreeUserBuffer( hpcd->Instance, ep->num, 1U );
-            }
+            return HAL_OK;
         }
         else /* Transfer is not yet Done */
         {
@@ -1872,11 +1934,6 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
                     len = ep->maxpacket;
                     ep->xfer_len_db -= len;
                 }
-                else if( ep->xfer_len_db == 0U )
-                {
-                    len = TxByteNbre;
-                    ep->xfer_fill_db = 0U;
-                }
                 else
                 {
                     ep->xfer_fill_db = 0U;
@@ -1884,12 +1941,15 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
                     ep->xfer_len_db = 0U;
                 }
 
-                /* Write remaining Data to Buffer */
-                /* Set the Double buffer counter for pma buffer1 */
-                PCD_SET_EP_DBUF0_CNT( hpcd->Instance, ep->num, ep->is_in, len );
+                /* The last packet may already be in the other buffer */
+                if( len != 0U )
+                {
+                    /* Set the Double buffer counter for pmabuffer0 */
+                    PCD_SET_EP_DBUF0_CNT( hpcd->Instance, ep->num, ep->is_in, len );
 
-                /* Copy user buffer to USB PMA */
-                USB_WritePMA( hpcd->Instance, ep->xfer_buff,  ep->pmaaddr0, ( uint16_t )len );
+                    /* Copy user buffer to USB PMA */
+                    USB_WritePMA( hpcd->Instance, ep->xfer_buff,  ep->pmaaddr0, ( uint16_t )len );
+                }
             }
         }
     }
@@ -1910,18 +1970,15 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
         /* Transfer is completed */
         if( ep->xfer_len == 0U )
         {
-            /* TX COMPLETE */
+            /* The other buffer holds no data of this transfer: keep it, the
+               endpoint NAKs until the next transfer hands a buffer over */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
             hpcd->DataInStageCallback( hpcd, ep->num );
 #else
             HAL_PCD_DataInStageCallback( hpcd, ep->num );
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 
-            /*need to Free USB Buff*/
-            if( ( wEPVal & USB_EP_DTOG_RX ) == 0U )
-            {
-                PCD_FreeUserBuffer( hpcd->Instance, ep->num, 1U );
-            }
+            return HAL_OK;
         }
         else /* Transfer is not yet Done */
         {
@@ -1943,11 +2000,6 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
                     len = ep->maxpacket;
                     ep->xfer_len_db -= len;
                 }
-                else if( ep->xfer_len_db == 0U )
-                {
-                    len = TxByteNbre;
-                    ep->xfer_fill_db = 0U;
-                }
                 else
                 {
                     len = ep->xfer_len_db;
@@ -1955,11 +2007,15 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit( PCD_HandleTypeDef *hpcd,
                     ep->xfer_fill_db = 0;
                 }
 
-                /* Set the Double buffer counter for pmabuffer1 */
-                PCD_SET_EP_DBUF1_CNT( hpcd->Instance, ep->num, ep->is_in, len );
+                /* The last packet may already be in the other buffer */
+                if( len != 0U )
+                {
+                    /* Set the Double buffer counter for pmabuffer1 */
+                    PCD_SET_EP_DBUF1_CNT( hpcd->Instance, ep->num, ep->is_in, len );
 
-                /* Copy the user buffer to USB PMA */
-                USB_WritePMA( hpcd->Instance, ep->xfer_buff,  ep->pmaaddr1, ( uint16_t )len );
+                    /* Copy the user buffer to USB PMA */
+                    USB_WritePMA( hpcd->Instance, ep->xfer_buff,  ep->pmaaddr1, ( uint16_t )len );
+                }
             }
         }
     }
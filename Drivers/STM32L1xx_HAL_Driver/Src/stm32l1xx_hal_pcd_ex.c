@@ -56,6 +56,7 @@
  ===============================================================================
     [..]  This section provides functions allowing to:
       (+) Update FIFO configuration
+      (+) Allocate the packet memory of the endpoints
 
 @endverbatim
   * @{
@@ -75,6 +76,8 @@
   *                   is a 32-bit value providing the endpoint buffer 0 address
   *                   in the LSB part of 32-bit value and endpoint buffer 1 address
   *                   in the MSB part of 32-bit value.
+  *                   A null address leaves the buffer(s) to HAL_PCDEx_PMAAlloc
+  *                   when the endpoint is opened.
   * @retval HAL status
   */
 
@@ -115,6 +118,154 @@ HAL_StatusTypeDef  HAL_PCDEx_PMAConfig( PCD_HandleTypeDef *hpcd,
     return HAL_OK;
 }
 
+/**
+  * @brief  Allocate the PMA buffer(s) of an endpoint
+  *         Called by HAL_PCD_EP_Open: buffers set by HAL_PCDEx_PMAConfig
+  *         are kept, an endpoint without buffer gets the next free PMA bytes
+  *         above the buffer table. Isochronous endpoints always get two
+  *         buffers since the peripheral alternates between them on each
+  *         frame; bulk endpoints get two when declared PCD_DBL_BUF.
+  *         Buffers configured by hand must then sit above the allocated ones.
+  * @param  hpcd  Device instance
+  * @param  ep_addr endpoint address
+  * @param  ep_type endpoint type
+  * @param  ep_mps endpoint max packet size
+  * @retval HAL status, HAL_ERROR when the PMA is exhausted
+  */
+HAL_StatusTypeDef  HAL_PCDEx_PMAAlloc( PCD_HandleTypeDef *hpcd,
+                                       uint16_t ep_addr,
+                                       uint8_t ep_type,
+                                       uint16_t ep_mps )
+{
+    PCD_EPTypeDef *ep;
+    uint16_t ep_bit;
+    uint8_t doublebuffer;
+    uint32_t size;
+    uint32_t pmaadress;
+
+    if( ( 0x80U & ep_addr ) == 0x80U )
+    {
+        ep = &hpcd->IN_ep[ep_addr & EP_ADDR_MSK];
+        ep_bit = ( uint16_t )( 0x100U << ( ep_addr & EP_ADDR_MSK ) );
+    }
+    else
+    {
+        ep = &hpcd->OUT_ep[ep_addr & EP_ADDR_MSK];
+        ep_bit = ( uint16_t )( 0x1U << ( ep_addr & EP_ADDR_MSK ) );
+    }
+
+    /* Only bulk and isochronous endpoints can be double buffered */
+    if( ep_type == EP_TYPE_ISOC )
+    {
+        doublebuffer = 1U;
+    }
+    else if( ep_type == EP_TYPE_BULK )
+    {
+        doublebuffer = ep->doublebuffer;
+    }
+    else
+    {
+        doublebuffer = 0U;
+    }
+
+    if( ( hpcd->PMAAuto & ep_bit ) == 0U )
+    {
+        /* Keep the buffers configured by HAL_PCDEx_PMAConfig */
+        if( ( ep->doublebuffer == 0U ) && ( ep->pmaadress != 0U ) )
+        {
+            return HAL_OK;
+        }
+
+        if( ( ep->doublebuffer != 0U ) && ( ( ep->pmaaddr0 != 0U ) || ( ep->pmaaddr1 != 0U ) ) )
+        {
+            return HAL_OK;
+        }
+    }
+    else if( ( doublebuffer == ep->doublebuffer ) && ( ep_mps <= ep->maxpacket ) )
+    {
+        /* Reopened endpoint, its buffers are large enough */
+        return HAL_OK;
+    }
+    else
+    {
+        /* Reopened with a larger packet: the former buffers stay lost
+           until the next bus reset */
+    }
+
+    /* Reception buffers are counted in blocks of 2 bytes up to 62 bytes,
+       in blocks of 32 bytes above */
+    if( ( ( 0x80U & ep_addr ) == 0U ) && ( ep_mps > 62U ) )
+    {
+        size = ( ( uint32_t )ep_mps + 31U ) & ~31U;
+    }
+    else
+    {
+        size = ( ( uint32_t )ep_mps + 1U ) & ~1U;
+    }
+
+    pmaadress = hpcd->PMAFree;
+
+    if( ( pmaadress + ( size * ( ( uint32_t )doublebuffer + 1U ) ) ) > PCD_PMA_SIZE )
+    {
+        return HAL_ERROR;
+    }
+
+    ep->doublebuffer = doublebuffer;
+
+    if( doublebuffer == 0U )
+    {
+        ep->pmaadress = ( uint16_t )pmaadress;
+        pmaadress += size;
+    }
+    else
+    {
+        ep->pmaaddr0 = ( uint16_t )pmaadress;
+        ep->pmaaddr1 = ( uint16_t )( pmaadress + size );
+        pmaadress += 2U * size;
+    }
+
+    ep->maxpacket = ep_mps;
+    hpcd->PMAFree = ( uint16_t )pmaadress;
+    hpcd->PMAAuto |= ep_bit;
+
+    return HAL_OK;
+}
+
+/**
+  * @brief  Release all the PMA buffers allocated by HAL_PCDEx_PMAAlloc
+  *         Called on init and on bus reset, the endpoints get their buffers
+  *         again when the stack reopens them.
+  * @param  hpcd  Device instance
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_PCDEx_PMAReset( PCD_HandleTypeDef *hpcd )
+{
+    uint8_t i;
+
+    for( i = 0U; i < 8U; i++ )
+    {
+        if( ( hpcd->PMAAuto & ( 0x1U << i ) ) != 0U )
+        {
+            hpcd->OUT_ep[i].pmaadress = 0U;
+            hpcd->OUT_ep[i].pmaaddr0 = 0U;
+            hpcd->OUT_ep[i].pmaaddr1 = 0U;
+        }
+
+        if( ( hpcd->PMAAuto & ( 0x100U << i ) ) != 0U )
+        {
+            hpcd->IN_ep[i].pmaadress = 0U;
+            hpcd->IN_ep[i].pmaaddr0 = 0U;
+            hpcd->IN_ep[i].pmaaddr1 = 0U;
+        }
+    }
+
+    /* The buffer table holds 8 bytes per endpoint */
+    hpcd->PMAFree = ( uint16_t )( BTABLE_ADDRESS + ( ( uint32_t )hpcd->Init.dev_endpoints * 8U ) );
+    hpcd->PMAAuto = 0U;
+
+    return HAL_OK;
+}
+
 /**
   * @brief  Software Device Connection,
   *         this function is not required by USB OTG FS peripheral, it is used
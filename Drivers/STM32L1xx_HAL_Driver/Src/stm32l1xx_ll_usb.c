@@ -51,6 +51,9 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+#if (USE_USB_PMA_DMA == 1U)
+static HAL_StatusTypeDef USB_PMA_DMACopy( uint32_t pma, uint32_t mem, uint32_t count, uint32_t dir );
+#endif /* USE_USB_PMA_DMA */
 /* Private functions ---------------------------------------------------------*/
 
 
@@ -169,6 +172,11 @@ HAL_StatusTypeDef USB_DevInit( USB_TypeDef *USBx, USB_CfgTypeDef cfg )
     /*Set Btable Address*/
     USBx->BTABLE = BTABLE_ADDRESS;
 
+#if (USE_USB_PMA_DMA == 1U)
+    /* Clock of the DMA copying the packets to and from the PMA */
+    SET_BIT( RCC->AHBENR, RCC_AHBENR_DMA1EN );
+#endif /* USE_USB_PMA_DMA */
+
     return HAL_OK;
 }
 
@@ -318,6 +326,13 @@ HAL_StatusTypeDef USB_ActivateEndpoint( USB_TypeDef *USBx, USB_EPTypeDef *ep )
             PCD_CLEAR_RX_DTOG( USBx, ep->num );
             PCD_CLEAR_TX_DTOG( USBx, ep->num );
 
+            if( ep->type != EP_TYPE_ISOC )
+            {
+                /* SW_BUF on buffer 1: the peripheral fills buffer 0 then waits
+                   for the ISR to release a buffer, one packet per CTR_RX */
+                PCD_TX_DTOG( USBx, ep->num );
+            }
+
             PCD_SET_EP_RX_STATUS( USBx, ep->num, USB_EP_RX_VALID );
             PCD_SET_EP_TX_STATUS( USBx, ep->num, USB_EP_TX_DIS );
         }
@@ -497,11 +512,25 @@ HAL_StatusTypeDef USB_EPStartXfer( USB_TypeDef *USBx, USB_EPTypeDef *ep )
                         /*Write the user buffer to USB PMA */
                         USB_WritePMA( USBx, ep->xfer_buff, pmabuffer, ( uint16_t )len );
                     }
+
+                    /* Point SW_BUF to the second buffer: the peripheral sends
+                       the first one then waits for the ISR to release the
+                       next, one packet per CTR_TX */
+                    wEPVal = PCD_GET_ENDPOINT( USBx, ep->num );
+
+                    if( ( ( ( wEPVal & USB_EP_DTOG_RX ) != 0U ) && ( ( wEPVal & USB_EP_DTOG_TX ) != 0U ) ) ||
+                            ( ( ( wEPVal & USB_EP_DTOG_RX ) == 0U ) && ( ( wEPVal & USB_EP_DTOG_TX ) == 0U ) ) )
+                    {
+                        PCD_FreeUserBuffer( USBx, ep->num, ep->is_in );
+                    }
                 }
                 /*auto Switch to single buffer mode when transfer <Mps no need to manage in double buffer*/
                 else
                 {
                     len = ep->xfer_len_db;
+                    /* NAK first: once single buffered, the endpoint left valid
+                       by the last transfer would send buffer0 as it is */
+                    PCD_SET_EP_TX_STATUS( USBx, ep->num, USB_EP_TX_NAK );
                     /*disable double buffer mode */
                     PCD_CLEAR_EP_DBUF( USBx, ep->num );
                     /*Set Tx count with nbre of byte to be transmitted */
@@ -562,20 +591,13 @@ HAL_StatusTypeDef USB_EPStartXfer( USB_TypeDef *USBx, USB_EPTypeDef *ep )
             /*Set the Double buffer counter*/
             if( ep->type == EP_TYPE_BULK )
             {
-                PCD_SET_EP_DBUF_CNT( USBx, ep->num, ep->is_in, ep->maxpacket );
-
-                /*Coming from ISR*/
-                if( ep->xfer_count != 0U )
+                /* The buffer sizes are set once per transfer: the peripheral
+                   only updates the byte count, and from the ISR the other
+                   buffer may already hold a packet. The buffers are released
+                   by the ISR only, one per received packet */
+                if( ep->xfer_count == 0U )
                 {
-                    /* update last value to check if there is blocking state*/
-                    wEPVal = PCD_GET_ENDPOINT( USBx, ep->num );
-
-                    /*Blocking State */
-                    if( ( ( ( wEPVal & USB_EP_DTOG_RX ) != 0U ) && ( ( wEPVal & USB_EP_DTOG_TX ) != 0U ) ) ||
-                            ( ( ( wEPVal & USB_EP_DTOG_RX ) == 0U ) && ( ( wEPVal & USB_EP_DTOG_TX ) == 0U ) ) )
-                    {
-                        PCD_FreeUserBuffer( USBx, ep->num, 0U );
-                    }
+                    PCD_SET_EP_DBUF_CNT( USBx, ep->num, ep->is_in, ep->maxpacket );
                 }
             }
             /*iso out double */
@@ -919,6 +941,10 @@ HAL_StatusTypeDef USB_DeActivateRemoteWakeup( USB_TypeDef *USBx )
 
 /**
   * @brief Copy a buffer from user memory area to packet memory area (PMA)
+  *        The PMA holds one half-word per 32-bit word: a word aligned user
+  *        buffer is read one word for two half-words, four half-words per
+  *        loop; other buffers, whatever their alignment, with unaligned word
+  *        loads, which the Cortex-M3 performs in hardware.
   * @param   USBx USB peripheral instance register address.
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
@@ -935,7 +961,50 @@ void USB_WritePMA( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, u
 
     pdwVal = ( __IO uint16_t * )( BaseAddr + 0x400U + ( ( uint32_t )wPMABufAddr * PMA_ACCESS ) );
 
-    for( i = n; i != 0U; i-- )
+#if (USE_USB_PMA_DMA == 1U)
+
+    /* The DMA moves the whole half-words of the large packets */
+    if( ( wNBytes >= USB_PMA_DMA_THRESHOLD ) && ( ( ( uint32_t )pBuf & 1U ) == 0U ) &&
+            ( USB_PMA_DMACopy( ( uint32_t )pdwVal, ( uint32_t )pBuf, ( uint32_t )wNBytes >> 1, DMA_CCR_DIR ) == HAL_OK ) )
+    {
+        pBuf += wNBytes & ~1U;
+        pdwVal += ( ( uint32_t )wNBytes >> 1 ) * PMA_ACCESS;
+        n -= ( uint32_t )wNBytes >> 1;
+    }
+
+#endif /* USE_USB_PMA_DMA */
+
+    if( ( ( uint32_t )pBuf & 3U ) == 0U )
+    {
+        for( i = n >> 2; i != 0U; i-- )
+        {
+            temp1 = *( uint32_t * )pBuf;
+            temp2 = *( uint32_t * )( pBuf + 4U );
+            pdwVal[0] = ( uint16_t )temp1;
+            pdwVal[PMA_ACCESS] = ( uint16_t )( temp1 >> 16 );
+            pdwVal[2U * PMA_ACCESS] = ( uint16_t )temp2;
+            pdwVal[3U * PMA_ACCESS] = ( uint16_t )( temp2 >> 16 );
+            pdwVal += 4U * PMA_ACCESS;
+            pBuf += 8U;
+        }
+    }
+    else
+    {
+        for( i = n >> 2; i != 0U; i-- )
+        {
+            temp1 = __UNALIGNED_UINT32_READ( pBuf );
+            temp2 = __UNALIGNED_UINT32_READ( pBuf + 4U );
+            pdwVal[0] = ( uint16_t )temp1;
+            pdwVal[PMA_ACCESS] = ( uint16_t )( temp1 >> 16 );
+            pdwVal[2U * PMA_ACCESS] = ( uint16_t )temp2;
+            pdwVal[3U * PMA_ACCESS] = ( uint16_t )( temp2 >> 16 );
+            pdwVal += 4U * PMA_ACCESS;
+            pBuf += 8U;
+        }
+    }
+
+    /* Last half-words */
+    for( i = n & 3U; i != 0U; i-- )
     {
         temp1 = *pBuf;
         pBuf++;
@@ -953,7 +1022,9 @@ void USB_WritePMA( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, u
 
 /**
   * @brief Copy data from packet memory area (PMA) to user memory buffer
-  * @param   USBx: USB peripheral instance register address.
+  *        Two PMA half-words make one word store, four half-words per loop,
+  *        aligned or unaligned as for USB_WritePMA.
+  * @param   USBx USB peripheral instance register address.
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
   * @param   wNBytes: no. of bytes to be copied.
@@ -963,13 +1034,51 @@ void USB_ReadPMA( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, ui
 {
     uint32_t n = ( uint32_t )wNBytes >> 1;
     uint32_t BaseAddr = ( uint32_t )USBx;
-    uint32_t i, temp;
+    uint32_t i, temp, temp2;
     __IO uint16_t *pdwVal;
     uint8_t *pBuf = pbUsrBuf;
 
     pdwVal = ( __IO uint16_t * )( BaseAddr + 0x400U + ( ( uint32_t )wPMABufAddr * PMA_ACCESS ) );
 
-    for( i = n; i != 0U; i-- )
+#if (USE_USB_PMA_DMA == 1U)
+
+    if( ( wNBytes >= USB_PMA_DMA_THRESHOLD ) && ( ( ( uint32_t )pBuf & 1U ) == 0U ) &&
+            ( USB_PMA_DMACopy( ( uint32_t )pdwVal, ( uint32_t )pBuf, n, 0U ) == HAL_OK ) )
+    {
+        pBuf += n << 1;
+        pdwVal += n * PMA_ACCESS;
+        n = 0U;
+    }
+
+#endif /* USE_USB_PMA_DMA */
+
+    if( ( ( uint32_t )pBuf & 3U ) == 0U )
+    {
+        for( i = n >> 2; i != 0U; i-- )
+        {
+            temp = ( uint32_t )pdwVal[0] | ( ( uint32_t )pdwVal[PMA_ACCESS] << 16 );
+            temp2 = ( uint32_t )pdwVal[2U * PMA_ACCESS] | ( ( uint32_t )pdwVal[3U * PMA_ACCESS] << 16 );
+            *( uint32_t * )pBuf = temp;
+            *( uint32_t * )( pBuf + 4U ) = temp2;
+            pdwVal += 4U * PMA_ACCESS;
+            pBuf += 8U;
+        }
+    }
+    else
+    {
+        for( i = n >> 2; i != 0U; i-- )
+        {
+            temp = ( uint32_t )pdwVal[0] | ( ( uint32_t )pdwVal[PMA_ACCESS] << 16 );
+            temp2 = ( uint32_t )pdwVal[2U * PMA_ACCESS] | ( ( uint32_t )pdwVal[3U * PMA_ACCESS] << 16 );
+            __UNALIGNED_UINT32_WRITE( pBuf, temp );
+            __UNALIGNED_UINT32_WRITE( pBuf + 4U, temp2 );
+            pdwVal += 4U * PMA_ACCESS;
+            pBuf += 8U;
+        }
+    }
+
+    /* Last half-words */
+    for( i = n & 3U; i != 0U; i-- )
     {
         temp = *( __IO uint16_t * )pdwVal;
         pdwVal++;
@@ -990,6 +1099,58 @@ void USB_ReadPMA( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, ui
     }
 }
 
+#if (USE_USB_PMA_DMA == 1U)
+/**
+  * @brief  Copy half-words between user memory and the PMA with the DMA
+  *         The memory to memory channel USB_PMA_DMA_CHANNEL reads or writes
+  *         the PMA by 32-bit words, which hold one half-word each, and the
+  *         user buffer by half-words. The copy is waited for; a channel
+  *         already running, as when the USB interrupt preempts a copy made
+  *         in thread mode, leaves the copy to the CPU.
+  * @param  pma PMA address as seen from the bus
+  * @param  mem user buffer address, half-word aligned
+  * @param  count number of half-words
+  * @param  dir DMA_CCR_DIR to write the PMA, 0 to read it
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef USB_PMA_DMACopy( uint32_t pma, uint32_t mem, uint32_t count, uint32_t dir )
+{
+    DMA_Channel_TypeDef *channel = USB_PMA_DMA_CHANNEL_INSTANCE;
+    uint32_t shift = 4U * ( USB_PMA_DMA_CHANNEL - 1U );
+    uint32_t primask;
+    uint32_t flags;
+
+    /* Claim the channel */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if( ( channel->CCR & DMA_CCR_EN ) != 0U )
+    {
+        __set_PRIMASK( primask );
+        return HAL_BUSY;
+    }
+
+    channel->CPAR = pma;
+    channel->CMAR = mem;
+    channel->CNDTR = count;
+    channel->CCR = DMA_CCR_MEM2MEM | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_0 |
+                   DMA_CCR_PINC | DMA_CCR_MINC | dir | DMA_CCR_EN;
+
+    __set_PRIMASK( primask );
+
+    do
+    {
+        flags = DMA1->ISR & ( ( DMA_ISR_TCIF1 | DMA_ISR_TEIF1 ) << shift );
+    } while( flags == 0U );
+
+    DMA1->IFCR = DMA_IFCR_CGIF1 << shift;
+    channel->CCR = 0U;
+
+    /* On a transfer error, the CPU does the whole copy again */
+    return ( ( flags & ( DMA_ISR_TEIF1 << shift ) ) != 0U ) ? HAL_ERROR : HAL_OK;
+}
+#endif /* USE_USB_PMA_DMA */
+
 
 /**
   * @}
@@ -50,8 +50,33 @@ extern "C" {
 #define USBD_MAX_NUM_INTERFACES                       1U
 #endif /* USBD_AUDIO_FREQ */
 
+/* Asynchronous streaming: the host paces the OUT endpoint from an explicit
+   feedback endpoint reporting the rate the audio output consumes samples at.
+   Set to 0 for the former mode trimming the playback length on drift */
+#ifndef USBD_AUDIO_ASYNC
+#define USBD_AUDIO_ASYNC                              1U
+#endif /* USBD_AUDIO_ASYNC */
+
+/* The isochronous OUT endpoint takes both buffers of its endpoint register,
+   so the feedback endpoint needs another endpoint number */
 #define AUDIO_OUT_EP                                  0x01U
+#ifndef AUDIO_FB_EP
+#define AUDIO_FB_EP                                   0x82U
+#endif /* AUDIO_FB_EP */
+
+/* Packet memory of the USB peripheral. The endpoints of the class, EP0 and
+   the buffer table must fit in it, which is checked at build time: at 48 kHz
+   in asynchronous mode, USB_MAX_EP0_SIZE must be lowered to 16U in
+   usbd_conf.h and hpcd.Init.dev_endpoints set to 3 */
+#ifndef USBD_AUDIO_PMA_SIZE
+#define USBD_AUDIO_PMA_SIZE                           512U
+#endif /* USBD_AUDIO_PMA_SIZE */
+
+#if (USBD_AUDIO_ASYNC == 1U)
+#define USB_AUDIO_CONFIG_DESC_SIZ                     0x76U
+#else
 #define USB_AUDIO_CONFIG_DESC_SIZ                     0x6DU
+#endif /* USBD_AUDIO_ASYNC */
 #define AUDIO_INTERFACE_DESC_SIZE                     0x09U
 #define USB_AUDIO_DESC_SIZ                            0x09U
 #define AUDIO_STANDARD_ENDPOINT_DESC_SIZE             0x09U
@@ -95,9 +120,38 @@ extern "C" {
 #define AUDIO_OUT_PACKET                              (uint16_t)(((USBD_AUDIO_FREQ * 2U * 2U) / 1000U))
 #define AUDIO_DEFAULT_VOLUME                          70U
 
+/* Largest OUT packet: the nominal samples per frame rounded up, plus the
+   one sample the feedback may ask for */
+#define AUDIO_OUT_MAX_PACKET                          (uint16_t)((((USBD_AUDIO_FREQ + 999U) / 1000U) + 1U) * 2U * 2U)
+
+/* Feedback endpoint: 10.14 samples per frame on 3 bytes, read by the host
+   every 2^AUDIO_FB_REFRESH frames */
+#define AUDIO_FB_PACKET                               3U
+#define AUDIO_FB_NOMINAL                              (((USBD_AUDIO_FREQ) << 14) / 1000U)
+#ifndef AUDIO_FB_REFRESH
+#define AUDIO_FB_REFRESH                              0x01U
+#endif /* AUDIO_FB_REFRESH */
+
+/* Frames over which the feedback cancels a FIFO level error */
+#ifndef AUDIO_FB_LEVEL_FRAMES
+#define AUDIO_FB_LEVEL_FRAMES                         512U
+#endif /* AUDIO_FB_LEVEL_FRAMES */
+
+/* Frames of audio output the consumption rate is averaged over */
+#ifndef AUDIO_FB_RATE_FRAMES
+#define AUDIO_FB_RATE_FRAMES                          8192U
+#endif /* AUDIO_FB_RATE_FRAMES */
+
 /* Number of sub-packets in the audio transfer buffer. You can modify this value but always make sure
-  that it is an even number and higher than 3 */
+  that it is an even number and higher than 3. The feedback keeps the buffer half full, so the
+  asynchronous mode needs far fewer packets */
+#ifndef AUDIO_OUT_PACKET_NUM
+#if (USBD_AUDIO_ASYNC == 1U)
+#define AUDIO_OUT_PACKET_NUM                          8U
+#else
 #define AUDIO_OUT_PACKET_NUM                          80U
+#endif /* USBD_AUDIO_ASYNC */
+#endif /* AUDIO_OUT_PACKET_NUM */
 /* Total size of the audio transfer buffer */
 #define AUDIO_TOTAL_BUF_SIZE                          ((uint16_t)(AUDIO_OUT_PACKET * AUDIO_OUT_PACKET_NUM))
 
@@ -146,6 +200,20 @@ typedef struct
     uint16_t                   rd_ptr;
     uint16_t                   wr_ptr;
     USBD_AUDIO_ControlTypeDef control;
+#if (USBD_AUDIO_ASYNC == 1U)
+    uint8_t                   packet[AUDIO_OUT_MAX_PACKET];
+    uint8_t                   fb_data[AUDIO_FB_PACKET];
+    uint8_t                   fb_busy;
+    uint32_t                  fb_value;       /* 10.14 samples per frame */
+    uint32_t                  sof_count;
+    uint32_t                  wr_total;       /* Bytes received */
+    uint32_t                  rd_total;       /* Bytes played at the last USBD_AUDIO_Sync */
+    uint32_t                  rd_sof;         /* sof_count at the last USBD_AUDIO_Sync */
+    uint32_t                  rate_bytes;     /* Consumption rate measurement */
+    uint32_t                  rate_frames;
+    uint32_t                  underruns;
+    uint32_t                  overruns;
+#endif /* USBD_AUDIO_ASYNC */
 }
 USBD_AUDIO_HandleTypeDef;
 
@@ -17,6 +17,7 @@
   *             - Standard AC Interface Descriptor management
   *             - 1 Audio Streaming Interface (with single channel, PCM, Stereo mode)
   *             - 1 Audio Streaming Endpoint
+  *             - 1 explicit feedback Endpoint (USBD_AUDIO_ASYNC)
   *             - 1 Audio Terminal Input (1 channel)
   *             - Audio Class-Specific AC Interfaces
   *             - Audio Class-Specific AS Interfaces
@@ -36,6 +37,12 @@
   * @note     In HS mode and when the DMA is used, all variables and data structures
   *           dealing with the DMA during the transaction process should be 32-bit aligned.
   *
+  * @note     The isochronous endpoints are double-buffered. On a 512-byte packet
+  *           memory, 48 kHz in asynchronous mode takes 512 bytes with
+  *           USB_MAX_EP0_SIZE set to 16U in usbd_conf.h (and bMaxPacketSize0 in
+  *           the device descriptor) and hpcd.Init.dev_endpoints set to 3. The
+  *           build fails when the endpoints do not fit in USBD_AUDIO_PMA_SIZE.
+  *
   *
   *  @endverbatim
   *
@@ -85,6 +92,31 @@ EndBSPDependencies */
 /** @defgroup USBD_AUDIO_Private_Defines
   * @{
   */
+/* Packet memory taken by the device, as allocated by HAL_PCDEx_PMAAlloc: 8
+   bytes of buffer table per endpoint number, EP0 OUT and IN, then two
+   buffers per isochronous endpoint. Reception buffers above 62 bytes are
+   counted in blocks of 32 bytes */
+#define AUDIO_PMA_TX(mps)              ((((mps) + 1U) / 2U) * 2U)
+#define AUDIO_PMA_RX(mps)              (((mps) > 62U) ? ((((mps) + 31U) / 32U) * 32U) : AUDIO_PMA_TX(mps))
+
+#if (USBD_AUDIO_ASYNC == 1U)
+#define AUDIO_PMA_OUT_PACKET           (((((USBD_AUDIO_FREQ) + 999U) / 1000U) + 1U) * 2U * 2U)
+#define AUDIO_PMA_EP_NUM               ((((AUDIO_FB_EP) & 0x0FU) > ((AUDIO_OUT_EP) & 0x0FU)) ? \
+                                        (((AUDIO_FB_EP) & 0x0FU) + 1U) : (((AUDIO_OUT_EP) & 0x0FU) + 1U))
+#define AUDIO_PMA_FB                   (2U * AUDIO_PMA_TX(AUDIO_FB_PACKET))
+#else
+#define AUDIO_PMA_OUT_PACKET           (((USBD_AUDIO_FREQ) * 2U * 2U) / 1000U)
+#define AUDIO_PMA_EP_NUM               (((AUDIO_OUT_EP) & 0x0FU) + 1U)
+#define AUDIO_PMA_FB                   0U
+#endif /* USBD_AUDIO_ASYNC */
+
+#define AUDIO_PMA_NEEDED               ((8U * AUDIO_PMA_EP_NUM) + AUDIO_PMA_RX(USB_MAX_EP0_SIZE) + \
+                                        AUDIO_PMA_TX(USB_MAX_EP0_SIZE) + \
+                                        (2U * AUDIO_PMA_RX(AUDIO_PMA_OUT_PACKET)) + AUDIO_PMA_FB)
+
+#if (AUDIO_PMA_NEEDED > USBD_AUDIO_PMA_SIZE)
+#error "AUDIO endpoints do not fit in the PMA: lower USB_MAX_EP0_SIZE (16U at 48 kHz) or USBD_AUDIO_FREQ"
+#endif /* AUDIO_PMA_NEEDED */
 /**
   * @}
   */
@@ -98,6 +130,9 @@ EndBSPDependencies */
 #define AUDIO_PACKET_SZE(frq)          (uint8_t)(((frq * 2U * 2U)/1000U) & 0xFFU), \
                                        (uint8_t)((((frq * 2U * 2U)/1000U) >> 8) & 0xFFU)
 
+#define AUDIO_MAX_PACKET_SZE           (uint8_t)(AUDIO_OUT_MAX_PACKET & 0xFFU), \
+                                       (uint8_t)((AUDIO_OUT_MAX_PACKET >> 8) & 0xFFU)
+
 /**
   * @}
   */
@@ -141,6 +176,10 @@ static void AUDIO_REQ_GetCurrent( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
 
 static void AUDIO_REQ_SetCurrent( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req );
 
+#if (USBD_AUDIO_ASYNC == 1U)
+static int32_t USBD_AUDIO_FifoLevel( USBD_AUDIO_HandleTypeDef *haudio );
+#endif /* USBD_AUDIO_ASYNC */
+
 /**
   * @}
   */
@@ -173,7 +212,7 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
     /* Configuration 1 */
     0x09,                                 /* bLength */
     USB_DESC_TYPE_CONFIGURATION,          /* bDescriptorType */
-    LOBYTE( USB_AUDIO_CONFIG_DESC_SIZ ),  /* wTotalLength  109 bytes*/
+    LOBYTE( USB_AUDIO_CONFIG_DESC_SIZ ),  /* wTotalLength  109 bytes, 118 with the feedback endpoint */
     HIBYTE( USB_AUDIO_CONFIG_DESC_SIZ ),
     0x02,                                 /* bNumInterfaces */
     0x01,                                 /* bConfigurationValue */
@@ -264,7 +303,11 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
     USB_DESC_TYPE_INTERFACE,        /* bDescriptorType */
     0x01,                                 /* bInterfaceNumber */
     0x01,                                 /* bAlternateSetting */
+#if (USBD_AUDIO_ASYNC == 1U)
+    0x02,                                 /* bNumEndpoints: data and feedback */
+#else
     0x01,                                 /* bNumEndpoints */
+#endif /* USBD_AUDIO_ASYNC */
     USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
     AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
     AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
@@ -297,11 +340,19 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
     AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
     USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
     AUDIO_OUT_EP,                         /* bEndpointAddress 1 out endpoint*/
+#if (USBD_AUDIO_ASYNC == 1U)
+    USBD_EP_TYPE_ISOC | 0x04U,            /* bmAttributes: isochronous, asynchronous */
+    AUDIO_MAX_PACKET_SZE,                 /* wMaxPacketSize: one sample more than nominal */
+    0x01,                                 /* bInterval */
+    0x00,                                 /* bRefresh */
+    AUDIO_FB_EP,                          /* bSynchAddress: feedback endpoint */
+#else
     USBD_EP_TYPE_ISOC,                    /* bmAttributes */
     AUDIO_PACKET_SZE( USBD_AUDIO_FREQ ),  /* wMaxPacketSize in Bytes (Freq(Samples)*2(Stereo)*2(HalfWord)) */
     0x01,                                 /* bInterval */
     0x00,                                 /* bRefresh */
     0x00,                                 /* bSynchAddress */
+#endif /* USBD_AUDIO_ASYNC */
     /* 09 byte*/
 
     /* Endpoint - Audio Streaming Descriptor*/
@@ -313,6 +364,20 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
     0x00,                                 /* wLockDelay */
     0x00,
     /* 07 byte*/
+#if (USBD_AUDIO_ASYNC == 1U)
+
+    /* Feedback Endpoint - Standard Descriptor */
+    AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+    USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+    AUDIO_FB_EP,                          /* bEndpointAddress */
+    USBD_EP_TYPE_ISOC,                    /* bmAttributes */
+    AUDIO_FB_PACKET,                      /* wMaxPacketSize: 10.14 format */
+    0x00,
+    0x01,                                 /* bInterval */
+    AUDIO_FB_REFRESH,                     /* bRefresh */
+    0x00,                                 /* bSynchAddress */
+    /* 09 byte*/
+#endif /* USBD_AUDIO_ASYNC */
 } ;
 
 /* USB Standard Device Descriptor */
@@ -349,9 +414,19 @@ static uint8_t  USBD_AUDIO_Init( USBD_HandleTypeDef *pdev, uint8_t cfgidx )
 {
     USBD_AUDIO_HandleTypeDef   *haudio;
 
+#if (USBD_AUDIO_ASYNC == 1U)
+    /* Open EP OUT */
+    USBD_LL_OpenEP( pdev, AUDIO_OUT_EP, USBD_EP_TYPE_ISOC, AUDIO_OUT_MAX_PACKET );
+    pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 1U;
+
+    /* Open the feedback EP IN */
+    USBD_LL_OpenEP( pdev, AUDIO_FB_EP, USBD_EP_TYPE_ISOC, AUDIO_FB_PACKET );
+    pdev->ep_in[AUDIO_FB_EP & 0xFU].is_used = 1U;
+#else
     /* Open EP OUT */
     USBD_LL_OpenEP( pdev, AUDIO_OUT_EP, USBD_EP_TYPE_ISOC, AUDIO_OUT_PACKET );
     pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 1U;
+#endif /* USBD_AUDIO_ASYNC */
 
     /* Allocate Audio structure */
     pdev->pClassData = USBD_malloc( sizeof( USBD_AUDIO_HandleTypeDef ) );
@@ -368,6 +443,18 @@ static uint8_t  USBD_AUDIO_Init( USBD_HandleTypeDef *pdev, uint8_t cfgidx )
         haudio->wr_ptr = 0U;
         haudio->rd_ptr = 0U;
         haudio->rd_enable = 0U;
+#if (USBD_AUDIO_ASYNC == 1U)
+        haudio->fb_busy = 0U;
+        haudio->fb_value = AUDIO_FB_NOMINAL;
+        haudio->sof_count = 0U;
+        haudio->wr_total = 0U;
+        haudio->rd_total = 0U;
+        haudio->rd_sof = 0U;
+        haudio->rate_bytes = 0U;
+        haudio->rate_frames = 0U;
+        haudio->underruns = 0U;
+        haudio->overruns = 0U;
+#endif /* USBD_AUDIO_ASYNC */
 
         /* Initialize the Audio output Hardware layer */
         if( ( ( USBD_AUDIO_ItfTypeDef * )pdev->pUserData )->Init( USBD_AUDIO_FREQ,
@@ -377,9 +464,16 @@ static uint8_t  USBD_AUDIO_Init( USBD_HandleTypeDef *pdev, uint8_t cfgidx )
             return USBD_FAIL;
         }
 
+#if (USBD_AUDIO_ASYNC == 1U)
+        /* Packets have a variable length: receive them apart, then copy
+           them into the circular playback buffer */
+        USBD_LL_PrepareReceive( pdev, AUDIO_OUT_EP, haudio->packet,
+                                AUDIO_OUT_MAX_PACKET );
+#else
         /* Prepare Out endpoint to receive 1st packet */
         USBD_LL_PrepareReceive( pdev, AUDIO_OUT_EP, haudio->buffer,
                                 AUDIO_OUT_PACKET );
+#endif /* USBD_AUDIO_ASYNC */
     }
 
     return USBD_OK;
@@ -400,6 +494,12 @@ static uint8_t  USBD_AUDIO_DeInit( USBD_HandleTypeDef *pdev,
     USBD_LL_CloseEP( pdev, AUDIO_OUT_EP );
     pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 0U;
 
+#if (USBD_AUDIO_ASYNC == 1U)
+    /* Close the feedback EP IN */
+    USBD_LL_CloseEP( pdev, AUDIO_FB_EP );
+    pdev->ep_in[AUDIO_FB_EP & 0xFU].is_used = 0U;
+#endif /* USBD_AUDIO_ASYNC */
+
     /* DeInit  physical Interface components */
     if( pdev->pClassData != NULL )
     {
@@ -512,6 +612,9 @@ static uint8_t  USBD_AUDIO_Setup( USBD_HandleTypeDef *pdev,
 
             break;
 
+        case USB_REQ_CLEAR_FEATURE:
+            break;
+
         default:
             USBD_CtlError( pdev, req );
             ret = USBD_FAIL;
@@ -553,6 +656,16 @@ static uint8_t  *USBD_AUDIO_GetCfgDesc( uint16_t *length )
 static uint8_t  USBD_AUDIO_DataIn( USBD_HandleTypeDef *pdev,
                                    uint8_t epnum )
 {
+#if (USBD_AUDIO_ASYNC == 1U)
+    USBD_AUDIO_HandleTypeDef   *haudio;
+    haudio = ( USBD_AUDIO_HandleTypeDef * ) pdev->pClassData;
+
+    /* Feedback sent: the next SOF loads the current value */
+    if( ( haudio != NULL ) && ( epnum == ( AUDIO_FB_EP & 0x7FU ) ) )
+    {
+        haudio->fb_busy = 0U;
+    }
+#endif /* USBD_AUDIO_ASYNC */
 
     /* Only OUT data are processed */
     return USBD_OK;
@@ -602,9 +715,94 @@ static uint8_t  USBD_AUDIO_EP0_TxReady( USBD_HandleTypeDef *pdev )
   */
 static uint8_t  USBD_AUDIO_SOF( USBD_HandleTypeDef *pdev )
 {
+#if (USBD_AUDIO_ASYNC == 1U)
+    USBD_AUDIO_HandleTypeDef   *haudio;
+    int32_t fb;
+    haudio = ( USBD_AUDIO_HandleTypeDef * ) pdev->pClassData;
+
+    if( haudio == NULL )
+    {
+        return USBD_OK;
+    }
+
+    haudio->sof_count++;
+
+    if( haudio->rd_enable == 1U )
+    {
+        /* Measured consumption rate, nominal until a first measure exists */
+        if( haudio->rate_frames != 0U )
+        {
+            fb = ( int32_t )( ( ( uint64_t )haudio->rate_bytes << 12 ) / haudio->rate_frames );
+        }
+        else
+        {
+            fb = ( int32_t )AUDIO_FB_NOMINAL;
+        }
+
+        /* Steer the FIFO back to half full over AUDIO_FB_LEVEL_FRAMES
+           frames: level error in samples, 2^14 per sample. At SOF the
+           level swings from here to one packet more, centre that swing */
+        fb += ( ( ( int32_t )( ( AUDIO_TOTAL_BUF_SIZE / 2U ) - AUDIO_OUT_PACKET ) - USBD_AUDIO_FifoLevel( haudio ) ) *
+                ( 16384 / 4 ) ) / ( int32_t )AUDIO_FB_LEVEL_FRAMES;
+
+        /* Stay within one sample of nominal, the OUT packet size limit */
+        if( fb > ( int32_t )( AUDIO_FB_NOMINAL + 16384U ) )
+        {
+            fb = ( int32_t )( AUDIO_FB_NOMINAL + 16384U );
+        }
+        else if( fb < ( int32_t )( AUDIO_FB_NOMINAL - 16384U ) )
+        {
+            fb = ( int32_t )( AUDIO_FB_NOMINAL - 16384U );
+        }
+        else
+        {
+            /* In range */
+        }
+
+        haudio->fb_value = ( uint32_t )fb;
+    }
+
+    if( haudio->fb_busy == 0U )
+    {
+        haudio->fb_data[0] = ( uint8_t )( haudio->fb_value );
+        haudio->fb_data[1] = ( uint8_t )( haudio->fb_value >> 8 );
+        haudio->fb_data[2] = ( uint8_t )( haudio->fb_value >> 16 );
+        haudio->fb_busy = 1U;
+
+        USBD_LL_Transmit( pdev, AUDIO_FB_EP, haudio->fb_data, AUDIO_FB_PACKET );
+    }
+#endif /* USBD_AUDIO_ASYNC */
+
     return USBD_OK;
 }
 
+#if (USBD_AUDIO_ASYNC == 1U)
+/**
+  * @brief  USBD_AUDIO_FifoLevel
+  *         Estimate the bytes received and not yet played: the playback
+  *         position is only known at each USBD_AUDIO_Sync, it is
+  *         extrapolated at the nominal rate from the frames since then
+  * @param  haudio: audio class handle
+  * @retval level in bytes
+  */
+static int32_t USBD_AUDIO_FifoLevel( USBD_AUDIO_HandleTypeDef *haudio )
+{
+    uint32_t played = 0U;
+
+    if( haudio->rd_enable == 1U )
+    {
+        played = ( haudio->sof_count - haudio->rd_sof ) * AUDIO_OUT_PACKET;
+
+        if( played > ( AUDIO_TOTAL_BUF_SIZE / 2U ) )
+        {
+            played = AUDIO_TOTAL_BUF_SIZE / 2U;
+        }
+    }
+
+    return ( int32_t )( haudio->wr_total - haudio->rd_total - played );
+}
+#endif /* USBD_AUDIO_ASYNC */
+
 /**
   * @brief  USBD_AUDIO_SOF
   *         handle SOF event
@@ -613,12 +811,54 @@ static uint8_t  USBD_AUDIO_SOF( USBD_HandleTypeDef *pdev )
   */
 void  USBD_AUDIO_Sync( USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset )
 {
+#if (USBD_AUDIO_ASYNC == 0U)
     uint32_t cmd = 0U;
+#endif /* USBD_AUDIO_ASYNC */
     USBD_AUDIO_HandleTypeDef   *haudio;
     haudio = ( USBD_AUDIO_HandleTypeDef * ) pdev->pClassData;
 
     haudio->offset =  offset;
 
+#if (USBD_AUDIO_ASYNC == 1U)
+    if( haudio->rd_enable == 1U )
+    {
+        /* Half of the buffer played: measure the consumption rate over the
+           frames it took, halving the totals to follow a drifting clock */
+        haudio->rate_bytes += AUDIO_TOTAL_BUF_SIZE / 2U;
+        haudio->rate_frames += haudio->sof_count - haudio->rd_sof;
+
+        if( haudio->rate_frames >= AUDIO_FB_RATE_FRAMES )
+        {
+            haudio->rate_bytes /= 2U;
+            haudio->rate_frames /= 2U;
+        }
+
+        haudio->rd_sof = haudio->sof_count;
+        haudio->rd_total += AUDIO_TOTAL_BUF_SIZE / 2U;
+        haudio->rd_ptr += ( uint16_t )( AUDIO_TOTAL_BUF_SIZE / 2U );
+
+        if( haudio->rd_ptr == AUDIO_TOTAL_BUF_SIZE )
+        {
+            /* roll back */
+            haudio->rd_ptr = 0U;
+        }
+
+        /* Played data that was not received */
+        if( ( int32_t )( haudio->wr_total - haudio->rd_total ) < 0 )
+        {
+            haudio->underruns++;
+        }
+    }
+
+    /* The feedback paces the host: always the nominal buffer length */
+    if( haudio->offset == AUDIO_OFFSET_FULL )
+    {
+        ( ( USBD_AUDIO_ItfTypeDef * )pdev->pUserData )->AudioCmd( &haudio->buffer[0],
+                AUDIO_TOTAL_BUF_SIZE / 2U,
+                AUDIO_CMD_PLAY );
+        haudio->offset = AUDIO_OFFSET_NONE;
+    }
+#else
     if( haudio->rd_enable == 1U )
     {
         haudio->rd_ptr += ( uint16_t )( AUDIO_TOTAL_BUF_SIZE / 2U );
@@ -666,6 +906,7 @@ void  USBD_AUDIO_Sync( USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset )
                 AUDIO_CMD_PLAY );
         haudio->offset = AUDIO_OFFSET_NONE;
     }
+#endif /* USBD_AUDIO_ASYNC */
 }
 
 /**
@@ -677,6 +918,17 @@ void  USBD_AUDIO_Sync( USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset )
   */
 static uint8_t  USBD_AUDIO_IsoINIncomplete( USBD_HandleTypeDef *pdev, uint8_t epnum )
 {
+#if (USBD_AUDIO_ASYNC == 1U)
+    USBD_AUDIO_HandleTypeDef   *haudio;
+    haudio = ( USBD_AUDIO_HandleTypeDef * ) pdev->pClassData;
+
+    /* Feedback not read in this frame: reload it at the next SOF */
+    if( ( haudio != NULL ) && ( epnum == ( AUDIO_FB_EP & 0x7FU ) ) )
+    {
+        USBD_LL_FlushEP( pdev, AUDIO_FB_EP );
+        haudio->fb_busy = 0U;
+    }
+#endif /* USBD_AUDIO_ASYNC */
 
     return USBD_OK;
 }
@@ -705,6 +957,52 @@ static uint8_t  USBD_AUDIO_DataOut( USBD_HandleTypeDef *pdev,
     USBD_AUDIO_HandleTypeDef   *haudio;
     haudio = ( USBD_AUDIO_HandleTypeDef * ) pdev->pClassData;
 
+#if (USBD_AUDIO_ASYNC == 1U)
+    uint32_t len;
+    uint32_t chunk;
+
+    if( epnum == AUDIO_OUT_EP )
+    {
+        len = USBD_LL_GetRxDataSize( pdev, epnum );
+
+        /* Drop the packet rather than overwrite data not played yet; the
+           estimate may be up to one packet low */
+        if( ( USBD_AUDIO_FifoLevel( haudio ) + ( int32_t )len + ( int32_t )AUDIO_OUT_PACKET ) > ( int32_t )AUDIO_TOTAL_BUF_SIZE )
+        {
+            haudio->overruns++;
+        }
+        else
+        {
+            chunk = AUDIO_TOTAL_BUF_SIZE - ( uint32_t )haudio->wr_ptr;
+
+            if( chunk > len )
+            {
+                chunk = len;
+            }
+
+            ( void )memcpy( &haudio->buffer[haudio->wr_ptr], haudio->packet, chunk );
+            ( void )memcpy( &haudio->buffer[0], &haudio->packet[chunk], len - chunk );
+
+            haudio->wr_ptr = ( uint16_t )( ( haudio->wr_ptr + len ) % AUDIO_TOTAL_BUF_SIZE );
+            haudio->wr_total += len;
+        }
+
+        /* Start the playback from the buffer start once it is half full */
+        if( ( haudio->rd_enable == 0U ) && ( haudio->wr_total >= ( AUDIO_TOTAL_BUF_SIZE / 2U ) ) )
+        {
+            ( ( USBD_AUDIO_ItfTypeDef * )pdev->pUserData )->AudioCmd( &haudio->buffer[0],
+                    AUDIO_TOTAL_BUF_SIZE / 2U,
+                    AUDIO_CMD_START );
+            haudio->offset = AUDIO_OFFSET_NONE;
+            haudio->rd_sof = haudio->sof_count;
+            haudio->rd_enable = 1U;
+        }
+
+        /* Prepare Out endpoint to receive next audio packet */
+        USBD_LL_PrepareReceive( pdev, AUDIO_OUT_EP, haudio->packet,
+                                AUDIO_OUT_MAX_PACKET );
+    }
+#else
     if( epnum == AUDIO_OUT_EP )
     {
         /* Increment the Buffer pointer or roll it back when all buffers are full */
@@ -737,6 +1035,7 @@ static uint8_t  USBD_AUDIO_DataOut( USBD_HandleTypeDef *pdev,
         USBD_LL_PrepareReceive( pdev, AUDIO_OUT_EP, &haudio->buffer[haudio->wr_ptr],
                                 AUDIO_OUT_PACKET );
     }
+#endif /* USBD_AUDIO_ASYNC */
 
     return USBD_OK;
 }
@@ -41,9 +41,15 @@ extern "C" {
 /** @defgroup usbd_cdc_Exported_Defines
   * @{
   */
+#ifndef CDC_IN_EP
 #define CDC_IN_EP                                   0x81U  /* EP1 for data IN */
+#endif /* CDC_IN_EP */
+#ifndef CDC_OUT_EP
 #define CDC_OUT_EP                                  0x01U  /* EP1 for data OUT */
+#endif /* CDC_OUT_EP */
+#ifndef CDC_CMD_EP
 #define CDC_CMD_EP                                  0x82U  /* EP2 for CDC commands */
+#endif /* CDC_CMD_EP */
 
 #ifndef CDC_HS_BINTERVAL
 #define CDC_HS_BINTERVAL                          0x10U
@@ -65,6 +71,24 @@ extern "C" {
 #define CDC_DATA_FS_IN_PACKET_SIZE                  CDC_DATA_FS_MAX_PACKET_SIZE
 #define CDC_DATA_FS_OUT_PACKET_SIZE                 CDC_DATA_FS_MAX_PACKET_SIZE
 
+/* Length of the OUT transfers prepared in FS mode: a multiple of the packet
+   size lets a double-buffered OUT endpoint take back-to-back packets, the
+   transfer ends on the first short packet */
+#ifndef CDC_DATA_FS_OUT_XFER_SIZE
+#define CDC_DATA_FS_OUT_XFER_SIZE                   CDC_DATA_FS_OUT_PACKET_SIZE
+#endif /* CDC_DATA_FS_OUT_XFER_SIZE */
+
+/* TX ring: SOF periods without new data after which the pending bytes are
+   sent as a short packet, or a ZLP closes a burst ending on a packet boundary */
+#ifndef CDC_TX_FLUSH_FRAMES
+#define CDC_TX_FLUSH_FRAMES                         2U
+#endif /* CDC_TX_FLUSH_FRAMES */
+
+/* TX ring: largest transfer handed to the IN endpoint at once */
+#ifndef CDC_TX_MAX_XFER_SIZE
+#define CDC_TX_MAX_XFER_SIZE                        1024U
+#endif /* CDC_TX_MAX_XFER_SIZE */
+
 /*---------------------------------------------------------------------*/
 /*  CDC definitions                                                    */
 /*---------------------------------------------------------------------*/
@@ -120,6 +144,15 @@ typedef struct
 
     __IO uint32_t TxState;
     __IO uint32_t RxState;
+
+    uint8_t  *TxRing;                 /* Optional TX ring, see USBD_CDC_Write */
+    uint32_t TxRingSize;
+    __IO uint32_t TxRingHead;         /* Free running, moved by the writer */
+    __IO uint32_t TxRingTail;         /* Free running, moved on DataIn */
+    uint32_t TxRingXfer;              /* Ring bytes in the current transfer */
+    uint32_t TxRingLastHead;
+    uint8_t  TxRingIdle;
+    uint8_t  TxRingZlp;
 }
 USBD_CDC_HandleTypeDef;
 
@@ -159,6 +192,14 @@ uint8_t  USBD_CDC_SetRxBuffer( USBD_HandleTypeDef   *pdev,
 uint8_t  USBD_CDC_ReceivePacket( USBD_HandleTypeDef *pdev );
 
 uint8_t  USBD_CDC_TransmitPacket( USBD_HandleTypeDef *pdev );
+
+uint8_t  USBD_CDC_SetTxRing( USBD_HandleTypeDef   *pdev,
+                             uint8_t  *pbuff,
+                             uint32_t size );
+
+uint32_t USBD_CDC_Write( USBD_HandleTypeDef *pdev,
+                         const uint8_t *pbuf,
+                         uint32_t length );
 /**
   * @}
   */
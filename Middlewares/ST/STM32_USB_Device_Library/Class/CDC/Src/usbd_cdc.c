@@ -117,6 +117,11 @@ static uint8_t  USBD_CDC_DataOut( USBD_HandleTypeDef *pdev,
 
 static uint8_t  USBD_CDC_EP0_RxReady( USBD_HandleTypeDef *pdev );
 
+static uint8_t  USBD_CDC_SOF( USBD_HandleTypeDef *pdev );
+
+static void     USBD_CDC_TxRingKick( USBD_HandleTypeDef *pdev,
+                                     uint8_t flush );
+
 static uint8_t  *USBD_CDC_GetFSCfgDesc( uint16_t *length );
 
 static uint8_t  *USBD_CDC_GetHSCfgDesc( uint16_t *length );
@@ -161,7 +166,7 @@ USBD_ClassTypeDef  USBD_CDC =
     USBD_CDC_EP0_RxReady,
     USBD_CDC_DataIn,
     USBD_CDC_DataOut,
-    NULL,
+    USBD_CDC_SOF,
     NULL,
     NULL,
     USBD_CDC_GetHSCfgDesc,
@@ -517,6 +522,16 @@ static uint8_t  USBD_CDC_Init( USBD_HandleTypeDef *pdev, uint8_t cfgidx )
     {
         hcdc = ( USBD_CDC_HandleTypeDef * ) pdev->pClassData;
 
+        /* No TX ring until the interface registers one */
+        hcdc->TxRing = NULL;
+        hcdc->TxRingSize = 0U;
+        hcdc->TxRingHead = 0U;
+        hcdc->TxRingTail = 0U;
+        hcdc->TxRingXfer = 0U;
+        hcdc->TxRingLastHead = 0U;
+        hcdc->TxRingIdle = 0U;
+        hcdc->TxRingZlp = 0U;
+
         /* Init  physical Interface components */
         ( ( USBD_CDC_ItfTypeDef * )pdev->pUserData )->Init();
 
@@ -534,7 +549,7 @@ static uint8_t  USBD_CDC_Init( USBD_HandleTypeDef *pdev, uint8_t cfgidx )
         {
             /* Prepare Out endpoint to receive next packet */
             USBD_LL_PrepareReceive( pdev, CDC_OUT_EP, hcdc->RxBuffer,
-                                    CDC_DATA_FS_OUT_PACKET_SIZE );
+                                    CDC_DATA_FS_OUT_XFER_SIZE );
         }
     }
 
@@ -657,6 +672,9 @@ static uint8_t  USBD_CDC_Setup( USBD_HandleTypeDef *pdev,
 
             break;
 
+        case USB_REQ_CLEAR_FEATURE:
+            break;
+
         default:
             USBD_CtlError( pdev, req );
             ret = USBD_FAIL;
@@ -688,7 +706,18 @@ static uint8_t  USBD_CDC_DataIn( USBD_HandleTypeDef *pdev, uint8_t epnum )
 
     if( pdev->pClassData != NULL )
     {
-        if( ( pdev->ep_in[epnum].total_length > 0U ) && ( ( pdev->ep_in[epnum].total_length % hpcd->IN_ep[epnum].maxpacket ) == 0U ) )
+        if( hcdc->TxRingXfer != 0U )
+        {
+            /* Release the ring bytes just sent; a transfer ending on a packet
+               boundary is closed by the ring itself, only once nothing follows */
+            hcdc->TxRingTail += hcdc->TxRingXfer;
+            hcdc->TxRingZlp = ( ( hcdc->TxRingXfer % hpcd->IN_ep[epnum].maxpacket ) == 0U ) ? 1U : 0U;
+            hcdc->TxRingXfer = 0U;
+            hcdc->TxState = 0U;
+
+            USBD_CDC_TxRingKick( pdev, 0U );
+        }
+        else if( ( pdev->ep_in[epnum].total_length > 0U ) && ( ( pdev->ep_in[epnum].total_length % hpcd->IN_ep[epnum].maxpacket ) == 0U ) )
         {
             /* Update the packet total length */
             pdev->ep_in[epnum].total_length = 0U;
@@ -737,6 +766,122 @@ static uint8_t  USBD_CDC_DataOut( USBD_HandleTypeDef *pdev, uint8_t epnum )
     }
 }
 
+/**
+  * @brief  USBD_CDC_SOF
+  *         Start of frame: flush the TX ring once no data came in for
+  *         CDC_TX_FLUSH_FRAMES frames
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_CDC_SOF( USBD_HandleTypeDef *pdev )
+{
+    USBD_CDC_HandleTypeDef   *hcdc = ( USBD_CDC_HandleTypeDef * ) pdev->pClassData;
+    uint32_t head;
+
+    if( ( hcdc == NULL ) || ( hcdc->TxRing == NULL ) )
+    {
+        return USBD_OK;
+    }
+
+    head = hcdc->TxRingHead;
+
+    if( head != hcdc->TxRingLastHead )
+    {
+        hcdc->TxRingLastHead = head;
+        hcdc->TxRingIdle = 0U;
+    }
+    else if( hcdc->TxRingIdle < CDC_TX_FLUSH_FRAMES )
+    {
+        hcdc->TxRingIdle++;
+    }
+
+    USBD_CDC_TxRingKick( pdev, ( hcdc->TxRingIdle >= CDC_TX_FLUSH_FRAMES ) ? 1U : 0U );
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_TxRingKick
+  *         Start the next IN transfer from the TX ring. Whole packets are sent
+  *         as soon as they are queued; a trailing partial packet, or the ZLP
+  *         closing a burst that ended on a packet boundary, waits for a flush.
+  *         Only called from the USB interrupt (DataIn and SOF).
+  * @param  pdev: device instance
+  * @param  flush: send the trailing partial packet or the ZLP now
+  * @retval None
+  */
+static void  USBD_CDC_TxRingKick( USBD_HandleTypeDef *pdev, uint8_t flush )
+{
+    USBD_CDC_HandleTypeDef   *hcdc = ( USBD_CDC_HandleTypeDef * ) pdev->pClassData;
+    uint32_t mps;
+    uint32_t used;
+    uint32_t pos;
+    uint32_t len;
+
+    if( ( hcdc->TxRing == NULL ) || ( hcdc->TxState != 0U ) )
+    {
+        return;
+    }
+
+    mps = ( pdev->dev_speed == USBD_SPEED_HIGH ) ? CDC_DATA_HS_IN_PACKET_SIZE :
+          CDC_DATA_FS_IN_PACKET_SIZE;
+    used = hcdc->TxRingHead - hcdc->TxRingTail;
+
+    if( used == 0U )
+    {
+        if( ( flush != 0U ) && ( hcdc->TxRingZlp != 0U ) )
+        {
+            /* Terminate the host transfer */
+            hcdc->TxRingZlp = 0U;
+            hcdc->TxState = 1U;
+            pdev->ep_in[CDC_IN_EP & 0xFU].total_length = 0U;
+            USBD_LL_Transmit( pdev, CDC_IN_EP, NULL, 0U );
+        }
+
+        return;
+    }
+
+    /* Contiguous bytes from the tail, bounded by the transfer size and by
+       half the ring so that the writer can refill the other half meanwhile */
+    pos = hcdc->TxRingTail & ( hcdc->TxRingSize - 1U );
+    len = hcdc->TxRingSize - pos;
+
+    if( len > used )
+    {
+        len = used;
+    }
+
+    if( len > CDC_TX_MAX_XFER_SIZE )
+    {
+        len = CDC_TX_MAX_XFER_SIZE;
+    }
+
+    if( ( len > ( hcdc->TxRingSize / 2U ) ) && ( ( hcdc->TxRingSize / 2U ) >= mps ) )
+    {
+        len = hcdc->TxRingSize / 2U;
+    }
+
+    if( len >= mps )
+    {
+        len -= len % mps;
+    }
+    else if( ( flush == 0U ) && ( len == used ) )
+    {
+        /* Keep the partial packet until more data or the flush timeout */
+        return;
+    }
+    else
+    {
+        /* Flush, or the end of the ring buffer is reached */
+    }
+
+    hcdc->TxRingZlp = 0U;
+    hcdc->TxRingXfer = len;
+    hcdc->TxState = 1U;
+    pdev->ep_in[CDC_IN_EP & 0xFU].total_length = len;
+    USBD_LL_Transmit( pdev, CDC_IN_EP, &hcdc->TxRing[pos], ( uint16_t )len );
+}
+
 /**
   * @brief  USBD_CDC_EP0_RxReady
   *         Handle EP0 Rx Ready event
@@ -903,6 +1048,95 @@ uint8_t  USBD_CDC_TransmitPacket( USBD_HandleTypeDef *pdev )
 }
 
 
+/**
+  * @brief  USBD_CDC_SetTxRing
+  *         Register the storage of the TX ring used by USBD_CDC_Write.
+  *         To be called from the interface Init callback. The head and
+  *         tail indexes run freely and wrap at 2^32, so the size must be a
+  *         power of two, not smaller than the IN packet size.
+  * @param  pdev: device instance
+  * @param  pbuff: ring storage, NULL to disable the ring
+  * @param  size: ring size in bytes, a power of two
+  * @retval status: USBD_FAIL when the size is not a power of two
+  */
+uint8_t  USBD_CDC_SetTxRing( USBD_HandleTypeDef   *pdev,
+                             uint8_t  *pbuff,
+                             uint32_t size )
+{
+    USBD_CDC_HandleTypeDef   *hcdc = ( USBD_CDC_HandleTypeDef * ) pdev->pClassData;
+
+    if( ( hcdc == NULL ) ||
+        ( ( pbuff != NULL ) && ( ( size == 0U ) || ( ( size & ( size - 1U ) ) != 0U ) ) ) )
+    {
+        return USBD_FAIL;
+    }
+
+    hcdc->TxRingSize = size;
+    hcdc->TxRingHead = 0U;
+    hcdc->TxRingTail = 0U;
+    hcdc->TxRingXfer = 0U;
+    hcdc->TxRingLastHead = 0U;
+    hcdc->TxRingIdle = 0U;
+    hcdc->TxRingZlp = 0U;
+    hcdc->TxRing = pbuff;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_Write
+  *         Queue data in the TX ring. The USB interrupt coalesces the queued
+  *         bytes into whole-packet transfers and flushes the remainder after
+  *         CDC_TX_FLUSH_FRAMES idle frames, so many small writes cost few
+  *         transfers. A single writer context is supported; do not mix with
+  *         USBD_CDC_TransmitPacket.
+  * @param  pdev: device instance
+  * @param  pbuf: data to send
+  * @param  length: number of bytes
+  * @retval number of bytes queued, less than length when the ring is full
+  */
+uint32_t USBD_CDC_Write( USBD_HandleTypeDef *pdev,
+                         const uint8_t *pbuf,
+                         uint32_t length )
+{
+    USBD_CDC_HandleTypeDef   *hcdc = ( USBD_CDC_HandleTypeDef * ) pdev->pClassData;
+    uint32_t head;
+    uint32_t pos;
+    uint32_t chunk;
+    uint32_t done = 0U;
+
+    if( ( hcdc == NULL ) || ( hcdc->TxRing == NULL ) )
+    {
+        return 0U;
+    }
+
+    head = hcdc->TxRingHead;
+
+    if( length > ( hcdc->TxRingSize - ( head - hcdc->TxRingTail ) ) )
+    {
+        length = hcdc->TxRingSize - ( head - hcdc->TxRingTail );
+    }
+
+    while( done < length )
+    {
+        pos = ( head + done ) & ( hcdc->TxRingSize - 1U );
+        chunk = hcdc->TxRingSize - pos;
+
+        if( chunk > ( length - done ) )
+        {
+            chunk = length - done;
+        }
+
+        ( void )memcpy( &hcdc->TxRing[pos], &pbuf[done], chunk );
+        done += chunk;
+    }
+
+    /* Publish the data to the USB interrupt */
+    hcdc->TxRingHead = head + done;
+
+    return done;
+}
+
 /**
   * @brief  USBD_CDC_ReceivePacket
   *         prepare OUT Endpoint for reception
@@ -930,7 +1164,7 @@ uint8_t  USBD_CDC_ReceivePacket( USBD_HandleTypeDef *pdev )
             USBD_LL_PrepareReceive( pdev,
                                     CDC_OUT_EP,
                                     hcdc->RxBuffer,
-                                    CDC_DATA_FS_OUT_PACKET_SIZE );
+                                    CDC_DATA_FS_OUT_XFER_SIZE );
         }
 
         return USBD_OK;
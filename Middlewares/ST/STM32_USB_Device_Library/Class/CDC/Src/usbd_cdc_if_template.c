@@ -97,6 +97,8 @@ static int8_t TEMPLATE_Init( void )
 {
     /*
        Add your initialization code here
+       To send through the class TX ring, register its storage here with
+       USBD_CDC_SetTxRing() and queue data with USBD_CDC_Write()
     */
     return ( 0 );
 }
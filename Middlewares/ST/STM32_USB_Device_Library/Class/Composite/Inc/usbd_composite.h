@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    usbd_composite.h
+  * @author  MCD Application Team
+  * @brief   Header file for the usbd_composite.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_COMPOSITE_H
+#define __USBD_COMPOSITE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE
+  * @brief This file is the header file for usbd_composite.c
+  * @{
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Defines
+  * @{
+  */
+/* Maximum number of class drivers behind the composite driver */
+#ifndef USBD_COMPOSITE_MAX_CLASSES
+#define USBD_COMPOSITE_MAX_CLASSES              3U
+#endif /* USBD_COMPOSITE_MAX_CLASSES */
+
+/* Size of the buffer of the combined configuration descriptor */
+#ifndef USBD_COMPOSITE_MAX_CFG_DESC_SIZE
+#define USBD_COMPOSITE_MAX_CFG_DESC_SIZE        256U
+#endif /* USBD_COMPOSITE_MAX_CFG_DESC_SIZE */
+
+/* Selection of the composite layer itself, no class driver */
+#define USBD_COMPOSITE_NO_CLASS                 0xFFU
+
+#define USB_DESC_TYPE_IAD                       0x0BU
+#define USB_DESC_TYPE_CS_INTERFACE              0x24U
+#define USB_IAD_DESC_SIZ                        0x08U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Exported_TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+    USBD_ClassTypeDef   *pClass;
+    void                *pClassData;
+    void                *pUserData;
+    uint8_t              FirstItf;
+    uint8_t              NumItf;
+} USBD_COMPOSITE_ItemTypeDef;
+
+typedef struct
+{
+    USBD_COMPOSITE_ItemTypeDef  Item[USBD_COMPOSITE_MAX_CLASSES];
+    USBD_COMPOSITE_ItemTypeDef  Self;
+    uint8_t                     NumClasses;
+    uint8_t                     NumItf;
+    uint16_t                    CfgDescLen;
+    uint8_t                     EpInClass[16];
+    uint8_t                     EpOutClass[16];
+    uint8_t                     Ep0Class;
+    uint8_t                     CurClass;
+} USBD_COMPOSITE_HandleTypeDef;
+/**
+  * @}
+  */
+
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Variables
+  * @{
+  */
+
+extern USBD_ClassTypeDef  USBD_COMPOSITE;
+#define USBD_COMPOSITE_CLASS    &USBD_COMPOSITE
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Functions
+  * @{
+  */
+uint8_t  USBD_COMPOSITE_RegisterClass( USBD_HandleTypeDef *pdev,
+                                       USBD_ClassTypeDef *pclass,
+                                       void *pUserData );
+
+uint8_t  USBD_COMPOSITE_SelectClass( USBD_HandleTypeDef *pdev,
+                                     uint8_t classId );
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __USBD_COMPOSITE_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
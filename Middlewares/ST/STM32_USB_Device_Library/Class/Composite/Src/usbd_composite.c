@@ -0,0 +1,989 @@
+/**
+  ******************************************************************************
+  * @file    usbd_composite.c
+  * @author  MCD Application Team
+  * @brief   This file provides the composite layer that exposes several class
+  *          drivers as the functions of one device:
+  *           - Registration of the class drivers and of their user interfaces
+  *           - Combined configuration descriptor built at runtime
+  *           - Dispatch of the requests and endpoint events to the classes
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                Composite Driver Description
+  *          ===================================================================
+  *           The composite driver is registered with USBD_RegisterClass() in
+  *           place of a class driver. The class drivers are then added with
+  *           USBD_COMPOSITE_RegisterClass(), which takes the class user
+  *           interface (e.g. USBD_CDC_ItfTypeDef or USBD_StorageTypeDef) in
+  *           place of USBD_CDC_RegisterInterface() or
+  *           USBD_MSC_RegisterStorage(). The classes are numbered in
+  *           registration order.
+  *
+  *           The class drivers are used unmodified: each one keeps its own
+  *           pClassData and pUserData, which the composite driver loads in
+  *           the device handle before calling it.
+  *             - Interfaces are numbered in registration order. The
+  *               interface numbers of the class descriptors, of the CDC
+  *               functional descriptors and of the Audio control header are
+  *               shifted accordingly, and the requests to an interface reach
+  *               the class with its own interface number.
+  *             - An Interface Association Descriptor is inserted in front of
+  *               the functions with more than one interface.
+  *             - Endpoint events and requests go to the class that declares
+  *               the endpoint in its configuration descriptor. The endpoint
+  *               addresses of the classes must not overlap: they are set in
+  *               usbd_conf.h (e.g. CDC_IN_EP, MSC_EPIN_ADDR, HID_EPIN_ADDR).
+  *             - Class and vendor requests to the device go to the first
+  *               class.
+  *
+  *           The application must also:
+  *             - set USBD_MAX_NUM_INTERFACES to the total number of
+  *               interfaces,
+  *             - give each class its own memory in USBD_malloc(),
+  *             - use the Miscellaneous device class (0xEF, 0x02, 0x01) in the
+  *               device descriptor when a function has more than one
+  *               interface,
+  *             - select the class with USBD_COMPOSITE_SelectClass() before
+  *               calling a class API such as USBD_CDC_TransmitPacket() outside
+  *               of the class callbacks, with the USB interrupt masked, and
+  *               restore the previous selection afterwards.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_composite.h"
+#include "usbd_ctlreq.h"
+
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_COMPOSITE
+  * @brief usbd composite module
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Defines
+  * @{
+  */
+#define COMPOSITE_FS_CFG_DESC                 0U
+#define COMPOSITE_HS_CFG_DESC                 1U
+#define COMPOSITE_OTHER_SPEED_CFG_DESC        2U
+
+/* Interface classes with interface numbers in their class descriptors */
+#define COMPOSITE_ITF_CLASS_AUDIO             0x01U
+#define COMPOSITE_ITF_SUBCLASS_AUDIOCONTROL   0x01U
+#define COMPOSITE_ITF_CLASS_CDC               0x02U
+#define COMPOSITE_AC_HEADER                   0x01U
+#define COMPOSITE_CDC_CALL_MANAGEMENT         0x01U
+#define COMPOSITE_CDC_UNION                   0x06U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+
+
+
+/** @defgroup USBD_COMPOSITE_Private_FunctionPrototypes
+  * @{
+  */
+
+
+static uint8_t  USBD_COMPOSITE_Init( USBD_HandleTypeDef *pdev,
+                                     uint8_t cfgidx );
+
+static uint8_t  USBD_COMPOSITE_DeInit( USBD_HandleTypeDef *pdev,
+                                       uint8_t cfgidx );
+
+static uint8_t  USBD_COMPOSITE_Setup( USBD_HandleTypeDef *pdev,
+                                      USBD_SetupReqTypedef *req );
+
+static uint8_t  USBD_COMPOSITE_EP0_TxReady( USBD_HandleTypeDef *pdev );
+
+static uint8_t  USBD_COMPOSITE_EP0_RxReady( USBD_HandleTypeDef *pdev );
+
+static uint8_t  USBD_COMPOSITE_DataIn( USBD_HandleTypeDef *pdev, uint8_t epnum );
+
+static uint8_t  USBD_COMPOSITE_DataOut( USBD_HandleTypeDef *pdev, uint8_t epnum );
+
+static uint8_t  USBD_COMPOSITE_SOF( USBD_HandleTypeDef *pdev );
+
+static uint8_t  USBD_COMPOSITE_IsoINIncomplete( USBD_HandleTypeDef *pdev, uint8_t epnum );
+
+static uint8_t  USBD_COMPOSITE_IsoOutIncomplete( USBD_HandleTypeDef *pdev, uint8_t epnum );
+
+static uint8_t  *USBD_COMPOSITE_GetFSCfgDesc( uint16_t *length );
+
+static uint8_t  *USBD_COMPOSITE_GetHSCfgDesc( uint16_t *length );
+
+static uint8_t  *USBD_COMPOSITE_GetOtherSpeedCfgDesc( uint16_t *length );
+
+static uint8_t  *USBD_COMPOSITE_GetDeviceQualifierDesc( uint16_t *length );
+
+#if (USBD_SUPPORT_USER_STRING == 1U)
+static uint8_t  *USBD_COMPOSITE_GetUsrStrDesc( USBD_HandleTypeDef *pdev,
+                                               uint8_t index, uint16_t *length );
+#endif
+
+static uint8_t  *USBD_COMPOSITE_BuildCfgDesc( uint8_t speed, uint16_t *length );
+
+static void     USBD_COMPOSITE_RenumberItf( uint8_t *pdesc, uint16_t length,
+                                            uint8_t firstItf );
+
+static uint8_t  USBD_COMPOSITE_FindItf( uint8_t itfnum );
+
+static uint8_t  USBD_COMPOSITE_FindEp( uint8_t epaddr );
+
+static USBD_COMPOSITE_ItemTypeDef  *USBD_COMPOSITE_GetItem( uint8_t classId );
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_Variables
+  * @{
+  */
+
+USBD_ClassTypeDef  USBD_COMPOSITE =
+{
+    USBD_COMPOSITE_Init,
+    USBD_COMPOSITE_DeInit,
+    USBD_COMPOSITE_Setup,
+    USBD_COMPOSITE_EP0_TxReady,
+    USBD_COMPOSITE_EP0_RxReady,
+    USBD_COMPOSITE_DataIn,
+    USBD_COMPOSITE_DataOut,
+    USBD_COMPOSITE_SOF,
+    USBD_COMPOSITE_IsoINIncomplete,
+    USBD_COMPOSITE_IsoOutIncomplete,
+    USBD_COMPOSITE_GetHSCfgDesc,
+    USBD_COMPOSITE_GetFSCfgDesc,
+    USBD_COMPOSITE_GetOtherSpeedCfgDesc,
+    USBD_COMPOSITE_GetDeviceQualifierDesc,
+#if (USBD_SUPPORT_USER_STRING == 1U)
+    USBD_COMPOSITE_GetUsrStrDesc,
+#endif
+};
+
+/* The class data of the composite layer: a single instance, like the
+   descriptors of the class drivers */
+static USBD_COMPOSITE_HandleTypeDef  USBD_COMPOSITE_Handle;
+
+#if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+#endif
+/* USB composite device Configuration Descriptor, built on request */
+static uint8_t USBD_COMPOSITE_CfgDesc[USBD_COMPOSITE_MAX_CFG_DESC_SIZE];
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_COMPOSITE_Init
+  *         Initialize the class drivers
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_Init( USBD_HandleTypeDef *pdev,
+                                     uint8_t cfgidx )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+    uint8_t id;
+
+    if( hcomp->NumClasses == 0U )
+    {
+        return USBD_FAIL;
+    }
+
+    prev = USBD_COMPOSITE_SelectClass( pdev, USBD_COMPOSITE_NO_CLASS );
+    pdev->pClassData = hcomp;
+
+    for( id = 0U; id < hcomp->NumClasses; id++ )
+    {
+        ( void )USBD_COMPOSITE_SelectClass( pdev, id );
+
+        if( hcomp->Item[id].pClass->Init( pdev, cfgidx ) != USBD_OK )
+        {
+            ret = USBD_FAIL;
+        }
+    }
+
+    hcomp->Ep0Class = USBD_COMPOSITE_NO_CLASS;
+    ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_DeInit
+  *         DeInitialize the class drivers
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_DeInit( USBD_HandleTypeDef *pdev,
+                                       uint8_t cfgidx )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t prev;
+    uint8_t id;
+
+    prev = USBD_COMPOSITE_SelectClass( pdev, USBD_COMPOSITE_NO_CLASS );
+
+    for( id = 0U; id < hcomp->NumClasses; id++ )
+    {
+        ( void )USBD_COMPOSITE_SelectClass( pdev, id );
+        hcomp->Item[id].pClass->DeInit( pdev, cfgidx );
+    }
+
+    ( void )USBD_COMPOSITE_SelectClass( pdev, USBD_COMPOSITE_NO_CLASS );
+    pdev->pClassData = NULL;
+    hcomp->Ep0Class = USBD_COMPOSITE_NO_CLASS;
+    ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_Setup
+  *         Route a request to the class that owns its interface or endpoint
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_Setup( USBD_HandleTypeDef *pdev,
+                                      USBD_SetupReqTypedef *req )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint16_t wIndex = req->wIndex;
+    uint8_t ret;
+    uint8_t prev;
+    uint8_t id;
+
+    switch( req->bmRequest & USB_REQ_RECIPIENT_MASK )
+    {
+    case USB_REQ_RECIPIENT_INTERFACE:
+        id = USBD_COMPOSITE_FindItf( LOBYTE( wIndex ) );
+
+        if( id != USBD_COMPOSITE_NO_CLASS )
+        {
+            /* The class sees its own interface number */
+            req->wIndex = ( wIndex & 0xFF00U ) |
+                          ( uint8_t )( LOBYTE( wIndex ) - hcomp->Item[id].FirstItf );
+        }
+
+        break;
+
+    case USB_REQ_RECIPIENT_ENDPOINT:
+        id = USBD_COMPOSITE_FindEp( LOBYTE( wIndex ) );
+        break;
+
+    default:
+        id = ( hcomp->NumClasses != 0U ) ? 0U : USBD_COMPOSITE_NO_CLASS;
+        break;
+    }
+
+    if( id == USBD_COMPOSITE_NO_CLASS )
+    {
+        USBD_CtlError( pdev, req );
+        return USBD_FAIL;
+    }
+
+    /* The data stage of the request goes to the same class */
+    hcomp->Ep0Class = id;
+
+    prev = USBD_COMPOSITE_SelectClass( pdev, id );
+    ret = hcomp->Item[id].pClass->Setup( pdev, req );
+    ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+
+    req->wIndex = wIndex;
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_EP0_TxReady
+  *         handle EP0 Tx Ready event
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_EP0_TxReady( USBD_HandleTypeDef *pdev )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id = hcomp->Ep0Class;
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+
+    if( ( id != USBD_COMPOSITE_NO_CLASS ) &&
+            ( hcomp->Item[id].pClass->EP0_TxSent != NULL ) )
+    {
+        prev = USBD_COMPOSITE_SelectClass( pdev, id );
+        ret = hcomp->Item[id].pClass->EP0_TxSent( pdev );
+        ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_EP0_RxReady
+  *         handle EP0 Rx Ready event
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_EP0_RxReady( USBD_HandleTypeDef *pdev )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id = hcomp->Ep0Class;
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+
+    if( ( id != USBD_COMPOSITE_NO_CLASS ) &&
+            ( hcomp->Item[id].pClass->EP0_RxReady != NULL ) )
+    {
+        prev = USBD_COMPOSITE_SelectClass( pdev, id );
+        ret = hcomp->Item[id].pClass->EP0_RxReady( pdev );
+        ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_DataIn
+  *         handle data IN Stage
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_DataIn( USBD_HandleTypeDef *pdev,
+                                       uint8_t epnum )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id = hcomp->EpInClass[epnum & 0x0FU];
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+
+    if( ( id != USBD_COMPOSITE_NO_CLASS ) &&
+            ( hcomp->Item[id].pClass->DataIn != NULL ) )
+    {
+        prev = USBD_COMPOSITE_SelectClass( pdev, id );
+        ret = hcomp->Item[id].pClass->DataIn( pdev, epnum );
+        ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_DataOut
+  *         handle data OUT Stage
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_DataOut( USBD_HandleTypeDef *pdev,
+                                        uint8_t epnum )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id = hcomp->EpOutClass[epnum & 0x0FU];
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+
+    if( ( id != USBD_COMPOSITE_NO_CLASS ) &&
+            ( hcomp->Item[id].pClass->DataOut != NULL ) )
+    {
+        prev = USBD_COMPOSITE_SelectClass( pdev, id );
+        ret = hcomp->Item[id].pClass->DataOut( pdev, epnum );
+        ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_SOF
+  *         handle SOF event in every class
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_SOF( USBD_HandleTypeDef *pdev )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t prev;
+    uint8_t id;
+
+    for( id = 0U; id < hcomp->NumClasses; id++ )
+    {
+        if( hcomp->Item[id].pClass->SOF != NULL )
+        {
+            prev = USBD_COMPOSITE_SelectClass( pdev, id );
+            ( void )hcomp->Item[id].pClass->SOF( pdev );
+            ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+        }
+    }
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_IsoINIncomplete
+  *         handle data ISO IN Incomplete event
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_IsoINIncomplete( USBD_HandleTypeDef *pdev, uint8_t epnum )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id = hcomp->EpInClass[epnum & 0x0FU];
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+
+    if( ( id != USBD_COMPOSITE_NO_CLASS ) &&
+            ( hcomp->Item[id].pClass->IsoINIncomplete != NULL ) )
+    {
+        prev = USBD_COMPOSITE_SelectClass( pdev, id );
+        ret = hcomp->Item[id].pClass->IsoINIncomplete( pdev, epnum );
+        ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_IsoOutIncomplete
+  *         handle data ISO OUT Incomplete event
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_IsoOutIncomplete( USBD_HandleTypeDef *pdev, uint8_t epnum )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id = hcomp->EpOutClass[epnum & 0x0FU];
+    uint8_t ret = USBD_OK;
+    uint8_t prev;
+
+    if( ( id != USBD_COMPOSITE_NO_CLASS ) &&
+            ( hcomp->Item[id].pClass->IsoOUTIncomplete != NULL ) )
+    {
+        prev = USBD_COMPOSITE_SelectClass( pdev, id );
+        ret = hcomp->Item[id].pClass->IsoOUTIncomplete( pdev, epnum );
+        ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetFSCfgDesc
+  *         return FS configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetFSCfgDesc( uint16_t *length )
+{
+    return USBD_COMPOSITE_BuildCfgDesc( COMPOSITE_FS_CFG_DESC, length );
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetHSCfgDesc
+  *         return HS configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetHSCfgDesc( uint16_t *length )
+{
+    return USBD_COMPOSITE_BuildCfgDesc( COMPOSITE_HS_CFG_DESC, length );
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetOtherSpeedCfgDesc
+  *         return other speed configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetOtherSpeedCfgDesc( uint16_t *length )
+{
+    return USBD_COMPOSITE_BuildCfgDesc( COMPOSITE_OTHER_SPEED_CFG_DESC, length );
+}
+
+/**
+* @brief  USBD_COMPOSITE_GetDeviceQualifierDesc
+*         return Device Qualifier descriptor of the first class
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+static uint8_t  *USBD_COMPOSITE_GetDeviceQualifierDesc( uint16_t *length )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+
+    if( ( hcomp->NumClasses == 0U ) ||
+            ( hcomp->Item[0].pClass->GetDeviceQualifierDescriptor == NULL ) )
+    {
+        *length = 0U;
+        return NULL;
+    }
+
+    return hcomp->Item[0].pClass->GetDeviceQualifierDescriptor( length );
+}
+
+#if (USBD_SUPPORT_USER_STRING == 1U)
+/**
+  * @brief  USBD_COMPOSITE_GetUsrStrDesc
+  *         return the first user string descriptor found in the classes
+  * @param  pdev: device instance
+  * @param  index : string index
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetUsrStrDesc( USBD_HandleTypeDef *pdev,
+                                               uint8_t index, uint16_t *length )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t *pbuf = NULL;
+    uint8_t prev;
+    uint8_t id;
+
+    for( id = 0U; ( id < hcomp->NumClasses ) && ( pbuf == NULL ); id++ )
+    {
+        if( hcomp->Item[id].pClass->GetUsrStrDescriptor != NULL )
+        {
+            prev = USBD_COMPOSITE_SelectClass( pdev, id );
+            pbuf = hcomp->Item[id].pClass->GetUsrStrDescriptor( pdev, index, length );
+            ( void )USBD_COMPOSITE_SelectClass( pdev, prev );
+        }
+    }
+
+    return pbuf;
+}
+#endif
+
+/**
+  * @brief  USBD_COMPOSITE_BuildCfgDesc
+  *         Concatenate the configuration descriptors of the classes
+  * @param  speed: COMPOSITE_FS_CFG_DESC, COMPOSITE_HS_CFG_DESC or
+  *                COMPOSITE_OTHER_SPEED_CFG_DESC
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_BuildCfgDesc( uint8_t speed, uint16_t *length )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    USBD_ClassTypeDef *pclass;
+    uint8_t *pbuf = USBD_COMPOSITE_CfgDesc;
+    uint8_t *pdesc;
+    uint16_t len;
+    uint16_t pos = USB_LEN_CFG_DESC;
+    uint16_t idx;
+    uint8_t id;
+
+    for( idx = 0U; idx < USB_LEN_CFG_DESC; idx++ )
+    {
+        pbuf[idx] = 0U;
+    }
+
+    for( id = 0U; id < hcomp->NumClasses; id++ )
+    {
+        pclass = hcomp->Item[id].pClass;
+
+        if( ( speed == COMPOSITE_HS_CFG_DESC ) && ( pclass->GetHSConfigDescriptor != NULL ) )
+        {
+            pdesc = pclass->GetHSConfigDescriptor( &len );
+        }
+        else if( ( speed == COMPOSITE_OTHER_SPEED_CFG_DESC ) &&
+                 ( pclass->GetOtherSpeedConfigDescriptor != NULL ) )
+        {
+            pdesc = pclass->GetOtherSpeedConfigDescriptor( &len );
+        }
+        else
+        {
+            pdesc = pclass->GetFSConfigDescriptor( &len );
+        }
+
+        if( ( len < USB_LEN_CFG_DESC ) ||
+                ( ( uint32_t )pos + len - USB_LEN_CFG_DESC + USB_IAD_DESC_SIZ >
+                  USBD_COMPOSITE_MAX_CFG_DESC_SIZE ) )
+        {
+            break;
+        }
+
+        /* Header: from the first class, with the union of the attributes and
+           the largest power */
+        if( id == 0U )
+        {
+            for( idx = 0U; idx < USB_LEN_CFG_DESC; idx++ )
+            {
+                pbuf[idx] = pdesc[idx];
+            }
+        }
+
+        pbuf[7] |= pdesc[7];
+
+        if( pdesc[8] > pbuf[8] )
+        {
+            pbuf[8] = pdesc[8];
+        }
+
+        /* Interface Association Descriptor, with the class codes of the first
+           interface of the function */
+        if( hcomp->Item[id].NumItf > 1U )
+        {
+            idx = USB_LEN_CFG_DESC;
+
+            while( ( idx + 8U < len ) && ( pdesc[idx] != 0U ) &&
+                    ( pdesc[idx + 1U] != USB_DESC_TYPE_INTERFACE ) )
+            {
+                idx += pdesc[idx];
+            }
+
+            pbuf[pos]      = USB_IAD_DESC_SIZ;
+            pbuf[pos + 1U] = USB_DESC_TYPE_IAD;
+            pbuf[pos + 2U] = hcomp->Item[id].FirstItf;
+            pbuf[pos + 3U] = hcomp->Item[id].NumItf;
+            pbuf[pos + 4U] = ( idx + 8U < len ) ? pdesc[idx + 5U] : 0U;
+            pbuf[pos + 5U] = ( idx + 8U < len ) ? pdesc[idx + 6U] : 0U;
+            pbuf[pos + 6U] = ( idx + 8U < len ) ? pdesc[idx + 7U] : 0U;
+            pbuf[pos + 7U] = 0U;
+            pos += USB_IAD_DESC_SIZ;
+        }
+
+        for( idx = USB_LEN_CFG_DESC; idx < len; idx++ )
+        {
+            pbuf[pos + idx - USB_LEN_CFG_DESC] = pdesc[idx];
+        }
+
+        USBD_COMPOSITE_RenumberItf( &pbuf[pos], len - USB_LEN_CFG_DESC,
+                                    hcomp->Item[id].FirstItf );
+        pos += len - USB_LEN_CFG_DESC;
+    }
+
+    pbuf[0] = USB_LEN_CFG_DESC;
+    pbuf[2] = LOBYTE( pos );
+    pbuf[3] = HIBYTE( pos );
+    pbuf[4] = hcomp->NumItf;
+
+    *length = pos;
+    return pbuf;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_RenumberItf
+  *         Shift the interface numbers of the descriptors of a class
+  * @param  pdesc: descriptors following the configuration descriptor
+  * @param  length: length of the descriptors
+  * @param  firstItf: interface number of the first interface of the class
+  * @retval None
+  */
+static void  USBD_COMPOSITE_RenumberItf( uint8_t *pdesc, uint16_t length,
+                                         uint8_t firstItf )
+{
+    uint16_t idx = 0U;
+    uint8_t itfclass = 0U;
+    uint8_t itfsubclass = 0U;
+    uint8_t *p;
+    uint8_t k;
+
+    while( ( idx + 2U <= length ) && ( pdesc[idx] != 0U ) &&
+            ( idx + pdesc[idx] <= length ) )
+    {
+        p = &pdesc[idx];
+
+        if( ( p[1] == USB_DESC_TYPE_INTERFACE ) && ( p[0] >= 9U ) )
+        {
+            p[2] += firstItf;
+            itfclass = p[5];
+            itfsubclass = p[6];
+        }
+        else if( p[1] == USB_DESC_TYPE_CS_INTERFACE )
+        {
+            if( itfclass == COMPOSITE_ITF_CLASS_CDC )
+            {
+                if( ( p[2] == COMPOSITE_CDC_CALL_MANAGEMENT ) && ( p[0] >= 5U ) )
+                {
+                    /* bDataInterface */
+                    p[4] += firstItf;
+                }
+                else if( p[2] == COMPOSITE_CDC_UNION )
+                {
+                    /* bControlInterface and bSubordinateInterface */
+                    for( k = 3U; k < p[0]; k++ )
+                    {
+                        p[k] += firstItf;
+                    }
+                }
+            }
+            else if( ( itfclass == COMPOSITE_ITF_CLASS_AUDIO ) &&
+                     ( itfsubclass == COMPOSITE_ITF_SUBCLASS_AUDIOCONTROL ) &&
+                     ( p[2] == COMPOSITE_AC_HEADER ) )
+            {
+                /* baInterfaceNr of the streaming interfaces */
+                for( k = 8U; k < p[0]; k++ )
+                {
+                    p[k] += firstItf;
+                }
+            }
+        }
+
+        idx += p[0];
+    }
+}
+
+/**
+  * @brief  USBD_COMPOSITE_FindItf
+  *         Find the class of an interface
+  * @param  itfnum: interface number in the composite device
+  * @retval class index or USBD_COMPOSITE_NO_CLASS
+  */
+static uint8_t  USBD_COMPOSITE_FindItf( uint8_t itfnum )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    uint8_t id;
+
+    for( id = 0U; id < hcomp->NumClasses; id++ )
+    {
+        if( ( itfnum >= hcomp->Item[id].FirstItf ) &&
+                ( itfnum < ( hcomp->Item[id].FirstItf + hcomp->Item[id].NumItf ) ) )
+        {
+            return id;
+        }
+    }
+
+    return USBD_COMPOSITE_NO_CLASS;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_FindEp
+  *         Find the class of an endpoint
+  * @param  epaddr: endpoint address
+  * @retval class index or USBD_COMPOSITE_NO_CLASS
+  */
+static uint8_t  USBD_COMPOSITE_FindEp( uint8_t epaddr )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+
+    if( ( epaddr & 0x80U ) == 0x80U )
+    {
+        return hcomp->EpInClass[epaddr & 0x0FU];
+    }
+
+    return hcomp->EpOutClass[epaddr & 0x0FU];
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetItem
+  *         Get the context of a class or of the composite layer
+  * @param  classId: class index or USBD_COMPOSITE_NO_CLASS
+  * @retval pointer to the context
+  */
+static USBD_COMPOSITE_ItemTypeDef  *USBD_COMPOSITE_GetItem( uint8_t classId )
+{
+    if( classId == USBD_COMPOSITE_NO_CLASS )
+    {
+        return &USBD_COMPOSITE_Handle.Self;
+    }
+
+    return &USBD_COMPOSITE_Handle.Item[classId];
+}
+
+/**
+  * @brief  USBD_COMPOSITE_RegisterClass
+  *         Add a class driver to the composite device
+  * @param  pdev: device instance
+  * @param  pclass: class driver
+  * @param  pUserData: class user interface (e.g. USBD_CDC_ItfTypeDef)
+  * @retval status
+  */
+uint8_t  USBD_COMPOSITE_RegisterClass( USBD_HandleTypeDef *pdev,
+                                       USBD_ClassTypeDef *pclass,
+                                       void *pUserData )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    USBD_COMPOSITE_ItemTypeDef *pitem;
+    uint8_t *pdesc;
+    uint16_t len;
+    uint16_t idx;
+    uint8_t epaddr;
+    uint8_t id;
+
+    if( ( pclass == NULL ) || ( pclass->GetFSConfigDescriptor == NULL ) ||
+            ( pdev->dev_state == USBD_STATE_CONFIGURED ) )
+    {
+        return USBD_FAIL;
+    }
+
+    if( hcomp->NumClasses == 0U )
+    {
+        for( idx = 0U; idx < 16U; idx++ )
+        {
+            hcomp->EpInClass[idx] = USBD_COMPOSITE_NO_CLASS;
+            hcomp->EpOutClass[idx] = USBD_COMPOSITE_NO_CLASS;
+        }
+
+        hcomp->NumItf = 0U;
+        hcomp->CfgDescLen = USB_LEN_CFG_DESC;
+        hcomp->Ep0Class = USBD_COMPOSITE_NO_CLASS;
+        hcomp->CurClass = USBD_COMPOSITE_NO_CLASS;
+    }
+
+    if( hcomp->NumClasses >= USBD_COMPOSITE_MAX_CLASSES )
+    {
+        return USBD_FAIL;
+    }
+
+    id = hcomp->NumClasses;
+    pitem = &hcomp->Item[id];
+    pdesc = pclass->GetFSConfigDescriptor( &len );
+
+    if( ( len < USB_LEN_CFG_DESC ) ||
+            ( ( uint32_t )hcomp->CfgDescLen + len - USB_LEN_CFG_DESC +
+              ( ( pdesc[4] > 1U ) ? USB_IAD_DESC_SIZ : 0U ) >
+              USBD_COMPOSITE_MAX_CFG_DESC_SIZE ) )
+    {
+        return USBD_FAIL;
+    }
+
+    /* The endpoints must not be used by another class */
+    for( idx = USB_LEN_CFG_DESC; ( idx + 2U < len ) && ( pdesc[idx] != 0U ); idx += pdesc[idx] )
+    {
+        if( pdesc[idx + 1U] == USB_DESC_TYPE_ENDPOINT )
+        {
+            if( USBD_COMPOSITE_FindEp( pdesc[idx + 2U] ) != USBD_COMPOSITE_NO_CLASS )
+            {
+                return USBD_FAIL;
+            }
+        }
+    }
+
+    for( idx = USB_LEN_CFG_DESC; ( idx + 2U < len ) && ( pdesc[idx] != 0U ); idx += pdesc[idx] )
+    {
+        if( pdesc[idx + 1U] == USB_DESC_TYPE_ENDPOINT )
+        {
+            epaddr = pdesc[idx + 2U];
+
+            if( ( epaddr & 0x80U ) == 0x80U )
+            {
+                hcomp->EpInClass[epaddr & 0x0FU] = id;
+            }
+            else
+            {
+                hcomp->EpOutClass[epaddr & 0x0FU] = id;
+            }
+        }
+    }
+
+    pitem->pClass = pclass;
+    pitem->pClassData = NULL;
+    pitem->pUserData = pUserData;
+    pitem->FirstItf = hcomp->NumItf;
+    pitem->NumItf = pdesc[4];
+
+    hcomp->NumItf += pitem->NumItf;
+    hcomp->CfgDescLen += len - USB_LEN_CFG_DESC;
+
+    if( pitem->NumItf > 1U )
+    {
+        hcomp->CfgDescLen += USB_IAD_DESC_SIZ;
+    }
+
+    hcomp->NumClasses++;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_SelectClass
+  *         Load the class data and user interface of a class in the device
+  *         handle, for the class API functions
+  * @param  pdev: device instance
+  * @param  classId: class index or USBD_COMPOSITE_NO_CLASS
+  * @retval class selected before the call
+  */
+uint8_t  USBD_COMPOSITE_SelectClass( USBD_HandleTypeDef *pdev,
+                                     uint8_t classId )
+{
+    USBD_COMPOSITE_HandleTypeDef *hcomp = &USBD_COMPOSITE_Handle;
+    USBD_COMPOSITE_ItemTypeDef *pitem;
+    uint8_t prev = hcomp->CurClass;
+
+    if( ( hcomp->NumClasses == 0U ) ||
+            ( ( classId != USBD_COMPOSITE_NO_CLASS ) && ( classId >= hcomp->NumClasses ) ) )
+    {
+        return prev;
+    }
+
+    if( classId != prev )
+    {
+        pitem = USBD_COMPOSITE_GetItem( prev );
+        pitem->pClassData = pdev->pClassData;
+        pitem->pUserData = pdev->pUserData;
+
+        pitem = USBD_COMPOSITE_GetItem( classId );
+        pdev->pClassData = pitem->pClassData;
+        pdev->pUserData = pitem->pUserData;
+
+        hcomp->CurClass = classId;
+    }
+
+    return prev;
+}
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -42,10 +42,14 @@ extern "C" {
   * @{
   */
 #define CUSTOM_HID_EPIN_ADDR                 0x81U
+#ifndef CUSTOM_HID_EPIN_SIZE
 #define CUSTOM_HID_EPIN_SIZE                 0x02U
+#endif /* CUSTOM_HID_EPIN_SIZE */
 
 #define CUSTOM_HID_EPOUT_ADDR                0x01U
+#ifndef CUSTOM_HID_EPOUT_SIZE
 #define CUSTOM_HID_EPOUT_SIZE                0x02U
+#endif /* CUSTOM_HID_EPOUT_SIZE */
 
 #define USB_CUSTOM_HID_CONFIG_DESC_SIZ       41U
 #define USB_CUSTOM_HID_DESC_SIZ              9U
@@ -65,6 +69,24 @@ extern "C" {
 #define USBD_CUSTOM_HID_REPORT_DESC_SIZE   163U
 #endif /* USBD_CUSTOM_HID_REPORT_DESC_SIZE */
 
+/* IN report FIFO depth, in reports of up to CUSTOM_HID_EPIN_SIZE bytes: 0 or
+   a power of two, the slots are indexed with a mask.
+   0: USBD_CUSTOM_HID_SendReport transmits directly and returns USBD_BUSY
+   while the previous report is in flight */
+#ifndef USBD_CUSTOMHID_INREPORT_FIFO_SIZE
+#define USBD_CUSTOMHID_INREPORT_FIFO_SIZE  0U
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
+#if ( ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE & ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE - 1U ) ) != 0U )
+#error "USBD_CUSTOMHID_INREPORT_FIFO_SIZE must be 0 or a power of two"
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
+
+/* IN report FIFO: 1 packs as many queued reports as fit in one IN packet of
+   CUSTOM_HID_EPIN_SIZE bytes. The report descriptor and the host must then
+   expect the concatenated layout */
+#ifndef USBD_CUSTOMHID_INREPORT_PACKING
+#define USBD_CUSTOMHID_INREPORT_PACKING    0U
+#endif /* USBD_CUSTOMHID_INREPORT_PACKING */
+
 #define CUSTOM_HID_DESCRIPTOR_TYPE           0x21U
 #define CUSTOM_HID_REPORT_DESC               0x22U
 
@@ -100,6 +122,16 @@ typedef struct _USBD_CUSTOM_HID_Itf
 
 } USBD_CUSTOM_HID_ItfTypeDef;
 
+typedef struct
+{
+    uint32_t             Queued;        /* Reports accepted by SendReport */
+    uint32_t             Sent;          /* Reports in completed IN packets */
+    uint32_t             Dropped;       /* Reports refused, FIFO full */
+    uint32_t             Packets;       /* IN packets started */
+    uint32_t             MaxLevel;      /* FIFO high-water mark, in reports */
+}
+USBD_CUSTOM_HID_FifoStatsTypeDef;
+
 typedef struct
 {
     uint8_t              Report_buf[USBD_CUSTOMHID_OUTREPORT_BUF_SIZE];
@@ -108,6 +140,15 @@ typedef struct
     uint32_t             AltSetting;
     uint32_t             IsReportAvailable;
     CUSTOM_HID_StateTypeDef     state;
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    uint8_t              InReport_fifo[USBD_CUSTOMHID_INREPORT_FIFO_SIZE][CUSTOM_HID_EPIN_SIZE];
+    uint16_t             InReport_len[USBD_CUSTOMHID_INREPORT_FIFO_SIZE];
+    uint8_t              InPacket_buf[CUSTOM_HID_EPIN_SIZE];
+    __IO uint32_t        InFifoHead;    /* Free running, moved by SendReport */
+    __IO uint32_t        InFifoTail;    /* Free running, moved by the USB IRQ */
+    uint32_t             InFifoXfer;    /* Reports in the current IN packet */
+    USBD_CUSTOM_HID_FifoStatsTypeDef InFifoStats;
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
 }
 USBD_CUSTOM_HID_HandleTypeDef;
 /**
@@ -146,6 +187,9 @@ uint8_t USBD_CUSTOM_HID_SendReport( USBD_HandleTypeDef *pdev,
 uint8_t  USBD_CUSTOM_HID_RegisterInterface( USBD_HandleTypeDef   *pdev,
         USBD_CUSTOM_HID_ItfTypeDef *fops );
 
+uint8_t  USBD_CUSTOM_HID_GetFifoStats( USBD_HandleTypeDef *pdev,
+                                       USBD_CUSTOM_HID_FifoStatsTypeDef *stats );
+
 /**
   * @}
   */
@@ -106,6 +106,11 @@ static uint8_t  USBD_CUSTOM_HID_DataIn( USBD_HandleTypeDef *pdev, uint8_t epnum
 
 static uint8_t  USBD_CUSTOM_HID_DataOut( USBD_HandleTypeDef *pdev, uint8_t epnum );
 static uint8_t  USBD_CUSTOM_HID_EP0_RxReady( USBD_HandleTypeDef  *pdev );
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+static uint8_t  USBD_CUSTOM_HID_SOF( USBD_HandleTypeDef *pdev );
+
+static void     USBD_CUSTOM_HID_InFifoKick( USBD_HandleTypeDef *pdev );
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
 /**
   * @}
   */
@@ -123,7 +128,11 @@ USBD_ClassTypeDef  USBD_CUSTOM_HID =
     USBD_CUSTOM_HID_EP0_RxReady, /*EP0_RxReady*/ /* STATUS STAGE IN */
     USBD_CUSTOM_HID_DataIn, /*DataIn*/
     USBD_CUSTOM_HID_DataOut,
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    USBD_CUSTOM_HID_SOF, /*SOF */
+#else
     NULL, /*SOF */
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
     NULL,
     NULL,
     USBD_CUSTOM_HID_GetHSCfgDesc,
@@ -383,6 +392,12 @@ static uint8_t  USBD_CUSTOM_HID_Init( USBD_HandleTypeDef *pdev,
         hhid = ( USBD_CUSTOM_HID_HandleTypeDef * ) pdev->pClassData;
 
         hhid->state = CUSTOM_HID_IDLE;
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+        hhid->InFifoHead = 0U;
+        hhid->InFifoTail = 0U;
+        hhid->InFifoXfer = 0U;
+        ( void )memset( &hhid->InFifoStats, 0, sizeof( hhid->InFifoStats ) );
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
         ( ( USBD_CUSTOM_HID_ItfTypeDef * )pdev->pUserData )->Init();
 
         /* Prepare Out endpoint to receive 1st packet */
@@ -532,6 +547,9 @@ static uint8_t  USBD_CUSTOM_HID_Setup( USBD_HandleTypeDef *pdev,
 
             break;
 
+        case USB_REQ_CLEAR_FEATURE:
+            break;
+
         default:
             USBD_CtlError( pdev, req );
             ret = USBD_FAIL;
@@ -551,10 +569,13 @@ static uint8_t  USBD_CUSTOM_HID_Setup( USBD_HandleTypeDef *pdev,
 
 /**
   * @brief  USBD_CUSTOM_HID_SendReport
-  *         Send CUSTOM_HID Report
+  *         Send CUSTOM_HID Report. With USBD_CUSTOMHID_INREPORT_FIFO_SIZE set,
+  *         the report is copied to the IN report FIFO and sent from the USB
+  *         interrupt; the caller is the only producer.
   * @param  pdev: device instance
   * @param  buff: pointer to report
-  * @retval status
+  * @param  len: report length, at most CUSTOM_HID_EPIN_SIZE with the FIFO
+  * @retval status: USBD_BUSY if the report was not taken (FIFO full)
   */
 uint8_t USBD_CUSTOM_HID_SendReport( USBD_HandleTypeDef  *pdev,
                                     uint8_t *report,
@@ -562,6 +583,41 @@ uint8_t USBD_CUSTOM_HID_SendReport( USBD_HandleTypeDef  *pdev,
 {
     USBD_CUSTOM_HID_HandleTypeDef     *hhid = ( USBD_CUSTOM_HID_HandleTypeDef * )pdev->pClassData;
 
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    uint32_t head;
+    uint32_t level;
+    uint32_t slot;
+
+    if( pdev->dev_state == USBD_STATE_CONFIGURED )
+    {
+        if( ( len == 0U ) || ( len > CUSTOM_HID_EPIN_SIZE ) )
+        {
+            return USBD_FAIL;
+        }
+
+        head = hhid->InFifoHead;
+        level = head - hhid->InFifoTail;
+
+        if( level >= USBD_CUSTOMHID_INREPORT_FIFO_SIZE )
+        {
+            hhid->InFifoStats.Dropped++;
+            return USBD_BUSY;
+        }
+
+        slot = head & ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE - 1U );
+        ( void )memcpy( hhid->InReport_fifo[slot], report, len );
+        hhid->InReport_len[slot] = len;
+
+        /* Publish the report once its slot is written */
+        hhid->InFifoHead = head + 1U;
+        hhid->InFifoStats.Queued++;
+
+        if( ( level + 1U ) > hhid->InFifoStats.MaxLevel )
+        {
+            hhid->InFifoStats.MaxLevel = level + 1U;
+        }
+    }
+#else
     if( pdev->dev_state == USBD_STATE_CONFIGURED )
     {
         if( hhid->state == CUSTOM_HID_IDLE )
@@ -574,6 +630,7 @@ uint8_t USBD_CUSTOM_HID_SendReport( USBD_HandleTypeDef  *pdev,
             return USBD_BUSY;
         }
     }
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
 
     return USBD_OK;
 }
@@ -627,13 +684,103 @@ static uint8_t  *USBD_CUSTOM_HID_GetOtherSpeedCfgDesc( uint16_t *length )
 static uint8_t  USBD_CUSTOM_HID_DataIn( USBD_HandleTypeDef *pdev,
                                         uint8_t epnum )
 {
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    USBD_CUSTOM_HID_HandleTypeDef     *hhid = ( USBD_CUSTOM_HID_HandleTypeDef * )pdev->pClassData;
+
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
     /* Ensure that the FIFO is empty before a new transfer, this condition could
     be caused by  a new transfer before the end of the previous transfer */
     ( ( USBD_CUSTOM_HID_HandleTypeDef * )pdev->pClassData )->state = CUSTOM_HID_IDLE;
 
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    hhid->InFifoStats.Sent += hhid->InFifoXfer;
+    hhid->InFifoXfer = 0U;
+
+    /* Next queued report(s), without waiting for the next SOF */
+    USBD_CUSTOM_HID_InFifoKick( pdev );
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
+
     return USBD_OK;
 }
 
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+/**
+  * @brief  USBD_CUSTOM_HID_SOF
+  *         Start of frame: start the IN report FIFO if it went idle
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_CUSTOM_HID_SOF( USBD_HandleTypeDef *pdev )
+{
+    if( pdev->pClassData != NULL )
+    {
+        USBD_CUSTOM_HID_InFifoKick( pdev );
+    }
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CUSTOM_HID_InFifoKick
+  *         Move the oldest queued report, or with USBD_CUSTOMHID_INREPORT_PACKING
+  *         as many as fit, to the IN packet and send it. Only called from the
+  *         USB interrupt (DataIn and SOF), so it never races the endpoint.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CUSTOM_HID_InFifoKick( USBD_HandleTypeDef *pdev )
+{
+    USBD_CUSTOM_HID_HandleTypeDef     *hhid = ( USBD_CUSTOM_HID_HandleTypeDef * )pdev->pClassData;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t slot;
+    uint32_t count = 0U;
+    uint16_t len = 0U;
+
+    if( hhid->state != CUSTOM_HID_IDLE )
+    {
+        return;
+    }
+
+    head = hhid->InFifoHead;
+    tail = hhid->InFifoTail;
+
+    while( tail != head )
+    {
+        slot = tail & ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE - 1U );
+
+        if( ( len + hhid->InReport_len[slot] ) > CUSTOM_HID_EPIN_SIZE )
+        {
+            break;
+        }
+
+        ( void )memcpy( &hhid->InPacket_buf[len], hhid->InReport_fifo[slot],
+                        hhid->InReport_len[slot] );
+        len += hhid->InReport_len[slot];
+        tail++;
+        count++;
+
+        if( USBD_CUSTOMHID_INREPORT_PACKING == 0U )
+        {
+            break;
+        }
+    }
+
+    if( count == 0U )
+    {
+        return;
+    }
+
+    /* The slots are free again once copied to the IN packet */
+    hhid->InFifoTail = tail;
+    hhid->InFifoXfer = count;
+    hhid->InFifoStats.Packets++;
+    hhid->state = CUSTOM_HID_BUSY;
+
+    ( void )USBD_LL_Transmit( pdev, CUSTOM_HID_EPIN_ADDR, hhid->InPacket_buf, len );
+}
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
+
 /**
   * @brief  USBD_CUSTOM_HID_DataOut
   *         handle data OUT Stage
@@ -707,6 +854,30 @@ uint8_t  USBD_CUSTOM_HID_RegisterInterface( USBD_HandleTypeDef   *pdev,
 
     return ret;
 }
+
+/**
+  * @brief  USBD_CUSTOM_HID_GetFifoStats
+  *         Copy the IN report FIFO counters
+  * @param  pdev: device instance
+  * @param  stats: destination
+  * @retval status: USBD_FAIL without FIFO or before the class is initialized
+  */
+uint8_t  USBD_CUSTOM_HID_GetFifoStats( USBD_HandleTypeDef *pdev,
+                                       USBD_CUSTOM_HID_FifoStatsTypeDef *stats )
+{
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    USBD_CUSTOM_HID_HandleTypeDef     *hhid = ( USBD_CUSTOM_HID_HandleTypeDef * )pdev->pClassData;
+
+    if( hhid != NULL )
+    {
+        *stats = hhid->InFifoStats;
+        return USBD_OK;
+    }
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
+
+    ( void )memset( stats, 0, sizeof( *stats ) );
+    return USBD_FAIL;
+}
 /**
   * @}
   */
@@ -49,6 +49,16 @@ extern "C" {
 #define USBD_DFU_XFER_SIZE             1024U
 #endif /* USBD_DFU_XFER_SIZE */
 
+/* Number of download buffers: with 2 buffers and a media providing WriteAsync,
+   the host sends block N+1 while block N is being programmed */
+#ifndef USBD_DFU_BUFFER_NUM
+#define USBD_DFU_BUFFER_NUM            1U
+#endif /* USBD_DFU_BUFFER_NUM */
+
+#if (USBD_DFU_BUFFER_NUM != 1U) && (USBD_DFU_BUFFER_NUM != 2U)
+#error "USBD_DFU_BUFFER_NUM must be 1 or 2"
+#endif
+
 #ifndef USBD_DFU_APP_DEFAULT_ADD
 #define USBD_DFU_APP_DEFAULT_ADD       0x08008000U /* The first sector (32 KB) is reserved for DFU code */
 #endif /* USBD_DFU_APP_DEFAULT_ADD */
@@ -111,6 +121,12 @@ extern "C" {
 #define DFU_MEDIA_ERASE                0x00U
 #define DFU_MEDIA_PROGRAM              0x01U
 
+/**************************************************/
+/* Asynchronous write state                       */
+/**************************************************/
+#define DFU_WRITE_IDLE                 0x00U
+#define DFU_WRITE_BUSY                 0x01U
+
 /**************************************************/
 /* Other defines                                  */
 /**************************************************/
@@ -163,15 +179,17 @@ typedef struct
     {
         uint32_t d32[USBD_DFU_XFER_SIZE / 4U];
         uint8_t  d8[USBD_DFU_XFER_SIZE];
-    } buffer;
+    } buffer[USBD_DFU_BUFFER_NUM];
 
     uint32_t             wblock_num;
     uint32_t             wlength;
     uint32_t             data_ptr;
     uint32_t             alt_setting;
+    uint32_t             rx_buffer;     /* Buffer receiving the next DNLOAD block */
 
     uint8_t              dev_status[DFU_STATUS_DEPTH];
-    uint8_t              ReservedForAlign[2];
+    uint8_t              write_state;   /* DFU_WRITE_IDLE or DFU_WRITE_BUSY */
+    uint8_t              rx_pending;    /* Block received, waiting for the media */
     uint8_t              dev_state;
     uint8_t              manif_state;
 }
@@ -186,6 +204,11 @@ typedef struct
     uint16_t ( * Write )( uint8_t *src, uint8_t *dest, uint32_t Len );
     uint8_t *( * Read )( uint8_t *src, uint8_t *dest, uint32_t Len );
     uint16_t ( * GetStatus )( uint32_t Add, uint8_t cmd, uint8_t *buff );
+    /* Optional: start programming Len bytes and return at once; src stays
+       untouched until WritePoll returns USBD_OK or USBD_FAIL */
+    uint16_t ( * WriteAsync )( uint8_t *src, uint8_t *dest, uint32_t Len );
+    /* Optional: program the next chunk; USBD_BUSY while data remains */
+    uint16_t ( * WritePoll )( void );
 }
 USBD_DFU_MediaTypeDef;
 /**
@@ -18,6 +18,11 @@
   *             - Requests management (supporting ST DFU sub-protocol)
   *             - Memory operations management (Download/Upload/Erase/Detach/GetState/GetStatus)
   *             - DFU state machine implementation.
+  *             - Pipelined download: when the media provides WriteAsync/WritePoll,
+  *               a block is handed to the media as soon as it is received and
+  *               programmed chunk by chunk from the SOF handler; with
+  *               USBD_DFU_BUFFER_NUM set to 2 the host sends the next block
+  *               while the previous one is being programmed.
   *
   *           @note
   *            ST DFU sub-protocol is compliant with DFU protocol and use sub-requests to manage
@@ -87,6 +92,9 @@ EndBSPDependencies */
 /** @defgroup USBD_DFU_Private_Macros
   * @{
   */
+#define DFU_MEDIA_IS_ASYNC(pdev) \
+  ((((USBD_DFU_MediaTypeDef *)(pdev)->pUserData)->WriteAsync != NULL) && \
+   (((USBD_DFU_MediaTypeDef *)(pdev)->pUserData)->WritePoll != NULL))
 
 /**
   * @}
@@ -147,6 +155,14 @@ static void DFU_Abort( USBD_HandleTypeDef *pdev );
 
 static void DFU_Leave( USBD_HandleTypeDef *pdev );
 
+static void DFU_WriteStart( USBD_HandleTypeDef *pdev );
+
+static void DFU_WriteProcess( USBD_HandleTypeDef *pdev );
+
+static void DFU_WriteFlush( USBD_HandleTypeDef *pdev );
+
+static void DFU_WriteError( USBD_HandleTypeDef *pdev );
+
 
 /**
   * @}
@@ -295,6 +311,9 @@ static uint8_t  USBD_DFU_Init( USBD_HandleTypeDef *pdev,
         hdfu->data_ptr = USBD_DFU_APP_DEFAULT_ADD;
         hdfu->wblock_num = 0U;
         hdfu->wlength = 0U;
+        hdfu->rx_buffer = 0U;
+        hdfu->rx_pending = 0U;
+        hdfu->write_state = DFU_WRITE_IDLE;
 
         hdfu->manif_state = DFU_MANIFEST_COMPLETE;
         hdfu->dev_state = DFU_STATE_IDLE;
@@ -329,16 +348,21 @@ static uint8_t  USBD_DFU_DeInit( USBD_HandleTypeDef *pdev,
     USBD_DFU_HandleTypeDef   *hdfu;
     hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
 
-    hdfu->wblock_num = 0U;
-    hdfu->wlength = 0U;
-
-    hdfu->dev_state = DFU_STATE_IDLE;
-    hdfu->dev_status[0] = DFU_ERROR_NONE;
-    hdfu->dev_status[4] = DFU_STATE_IDLE;
-
-    /* DeInit  physical Interface components */
+    /* DeInit  physical Interface components; a disconnection may already
+       have done it */
     if( pdev->pClassData != NULL )
     {
+        hdfu->wblock_num = 0U;
+        hdfu->wlength = 0U;
+
+        hdfu->dev_state = DFU_STATE_IDLE;
+        hdfu->dev_status[0] = DFU_ERROR_NONE;
+        hdfu->dev_status[4] = DFU_STATE_IDLE;
+
+        /* Complete the block being programmed, if any */
+        hdfu->rx_pending = 0U;
+        DFU_WriteFlush( pdev );
+
         /* De-Initialize Hardware layer */
         ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->DeInit();
         USBD_free( pdev->pClassData );
@@ -468,6 +492,9 @@ static uint8_t  USBD_DFU_Setup( USBD_HandleTypeDef *pdev,
 
             break;
 
+        case USB_REQ_CLEAR_FEATURE:
+            break;
+
         default:
             USBD_CtlError( pdev, req );
             ret = USBD_FAIL;
@@ -521,6 +548,17 @@ static uint8_t  USBD_DFU_DataIn( USBD_HandleTypeDef *pdev,
   */
 static uint8_t  USBD_DFU_EP0_RxReady( USBD_HandleTypeDef *pdev )
 {
+    USBD_DFU_HandleTypeDef   *hdfu;
+
+    hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
+
+    /* Hand a firmware block to an asynchronous media as soon as it is received */
+    if( DFU_MEDIA_IS_ASYNC( pdev ) && ( hdfu->dev_state == DFU_STATE_DNLOAD_SYNC ) &&
+            ( hdfu->wblock_num > 1U ) && ( hdfu->wlength != 0U ) )
+    {
+        hdfu->rx_pending = 1U;
+        DFU_WriteStart( pdev );
+    }
 
     return USBD_OK;
 }
@@ -533,6 +571,7 @@ static uint8_t  USBD_DFU_EP0_RxReady( USBD_HandleTypeDef *pdev )
 static uint8_t  USBD_DFU_EP0_TxReady( USBD_HandleTypeDef *pdev )
 {
     uint32_t addr;
+    uint8_t *pbuf;
     USBD_SetupReqTypedef     req;
     USBD_DFU_HandleTypeDef   *hdfu;
 
@@ -540,26 +579,49 @@ static uint8_t  USBD_DFU_EP0_TxReady( USBD_HandleTypeDef *pdev )
 
     if( hdfu->dev_state == DFU_STATE_DNLOAD_BUSY )
     {
+        /* Block queued behind the one the media is programming, or already
+           handed to it: the host polls again */
+        if( DFU_MEDIA_IS_ASYNC( pdev ) && ( ( hdfu->wblock_num > 1U ) || ( hdfu->wlength == 0U ) ) )
+        {
+            hdfu->dev_state = DFU_STATE_DNLOAD_SYNC;
+
+            hdfu->dev_status[1] = 0U;
+            hdfu->dev_status[2] = 0U;
+            hdfu->dev_status[3] = 0U;
+            hdfu->dev_status[4] = hdfu->dev_state;
+            return USBD_OK;
+        }
+
+        /* Commands and synchronous writes follow the blocks already programmed */
+        DFU_WriteFlush( pdev );
+
+        if( hdfu->dev_state == DFU_STATE_ERROR )
+        {
+            return USBD_FAIL;
+        }
+
+        pbuf = hdfu->buffer[hdfu->rx_buffer].d8;
+
         /* Decode the Special Command*/
         if( hdfu->wblock_num == 0U )
         {
-            if( ( hdfu->buffer.d8[0] == DFU_CMD_GETCOMMANDS ) && ( hdfu->wlength == 1U ) )
+            if( ( pbuf[0] == DFU_CMD_GETCOMMANDS ) && ( hdfu->wlength == 1U ) )
             {
 
             }
-            else if( ( hdfu->buffer.d8[0] == DFU_CMD_SETADDRESSPOINTER ) && ( hdfu->wlength == 5U ) )
+            else if( ( pbuf[0] == DFU_CMD_SETADDRESSPOINTER ) && ( hdfu->wlength == 5U ) )
             {
-                hdfu->data_ptr = hdfu->buffer.d8[1];
-                hdfu->data_ptr += ( uint32_t )hdfu->buffer.d8[2] << 8;
-                hdfu->data_ptr += ( uint32_t )hdfu->buffer.d8[3] << 16;
-                hdfu->data_ptr += ( uint32_t )hdfu->buffer.d8[4] << 24;
+                hdfu->data_ptr = pbuf[1];
+                hdfu->data_ptr += ( uint32_t )pbuf[2] << 8;
+                hdfu->data_ptr += ( uint32_t )pbuf[3] << 16;
+                hdfu->data_ptr += ( uint32_t )pbuf[4] << 24;
             }
-            else if( ( hdfu->buffer.d8[0] == DFU_CMD_ERASE ) && ( hdfu->wlength == 5U ) )
+            else if( ( pbuf[0] == DFU_CMD_ERASE ) && ( hdfu->wlength == 5U ) )
             {
-                hdfu->data_ptr = hdfu->buffer.d8[1];
-                hdfu->data_ptr += ( uint32_t )hdfu->buffer.d8[2] << 8;
-                hdfu->data_ptr += ( uint32_t )hdfu->buffer.d8[3] << 16;
-                hdfu->data_ptr += ( uint32_t )hdfu->buffer.d8[4] << 24;
+                hdfu->data_ptr = pbuf[1];
+                hdfu->data_ptr += ( uint32_t )pbuf[2] << 8;
+                hdfu->data_ptr += ( uint32_t )pbuf[3] << 16;
+                hdfu->data_ptr += ( uint32_t )pbuf[4] << 24;
 
                 if( ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->Erase( hdfu->data_ptr ) != USBD_OK )
                 {
@@ -586,7 +648,7 @@ static uint8_t  USBD_DFU_EP0_TxReady( USBD_HandleTypeDef *pdev )
                 addr = ( ( hdfu->wblock_num - 2U ) * USBD_DFU_XFER_SIZE ) + hdfu->data_ptr;
 
                 /* Preform the write operation */
-                if( ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->Write( hdfu->buffer.d8,
+                if( ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->Write( pbuf,
                         ( uint8_t * )addr, hdfu->wlength ) != USBD_OK )
                 {
                     return USBD_FAIL;
@@ -611,6 +673,14 @@ static uint8_t  USBD_DFU_EP0_TxReady( USBD_HandleTypeDef *pdev )
     {
         if( hdfu->dev_state == DFU_STATE_MANIFEST ) /* Manifestation in progress */
         {
+            /* Program the last blocks before leaving */
+            DFU_WriteFlush( pdev );
+
+            if( hdfu->dev_state == DFU_STATE_ERROR )
+            {
+                return USBD_FAIL;
+            }
+
             /* Start leaving DFU mode */
             DFU_Leave( pdev );
         }
@@ -626,6 +696,15 @@ static uint8_t  USBD_DFU_EP0_TxReady( USBD_HandleTypeDef *pdev )
   */
 static uint8_t  USBD_DFU_SOF( USBD_HandleTypeDef *pdev )
 {
+    USBD_DFU_HandleTypeDef   *hdfu;
+
+    hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
+
+    /* Program one chunk per frame so EP0 keeps being served in between */
+    if( ( hdfu != NULL ) && ( hdfu->write_state == DFU_WRITE_BUSY ) )
+    {
+        DFU_WriteProcess( pdev );
+    }
 
     return USBD_OK;
 }
@@ -742,6 +821,10 @@ static void DFU_Detach( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req )
             || hdfu->dev_state == DFU_STATE_DNLOAD_IDLE || hdfu->dev_state == DFU_STATE_MANIFEST_SYNC
             || hdfu->dev_state == DFU_STATE_UPLOAD_IDLE )
     {
+        /* Drop a queued block and complete the one being programmed */
+        hdfu->rx_pending = 0U;
+        DFU_WriteFlush( pdev );
+
         /* Update the state machine */
         hdfu->dev_state = DFU_STATE_IDLE;
         hdfu->dev_status[0] = DFU_ERROR_NONE;
@@ -795,7 +878,7 @@ static void DFU_Download( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req )
             hdfu->dev_status[4] = hdfu->dev_state;
 
             /* Prepare the reception of the buffer over EP0 */
-            USBD_CtlPrepareRx( pdev, ( uint8_t * )hdfu->buffer.d8,
+            USBD_CtlPrepareRx( pdev, ( uint8_t * )hdfu->buffer[hdfu->rx_buffer].d8,
                                ( uint16_t )hdfu->wlength );
         }
         /* Unsupported state */
@@ -847,6 +930,9 @@ static void DFU_Upload( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req )
     {
         if( ( hdfu->dev_state == DFU_STATE_IDLE ) || ( hdfu->dev_state == DFU_STATE_UPLOAD_IDLE ) )
         {
+            /* Read back what has been programmed */
+            DFU_WriteFlush( pdev );
+
             /* Update the global length and block number */
             hdfu->wblock_num = req->wValue;
             hdfu->wlength = req->wLength;
@@ -863,12 +949,12 @@ static void DFU_Upload( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req )
                 hdfu->dev_status[4] = hdfu->dev_state;
 
                 /* Store the values of all supported commands */
-                hdfu->buffer.d8[0] = DFU_CMD_GETCOMMANDS;
-                hdfu->buffer.d8[1] = DFU_CMD_SETADDRESSPOINTER;
-                hdfu->buffer.d8[2] = DFU_CMD_ERASE;
+                hdfu->buffer[hdfu->rx_buffer].d8[0] = DFU_CMD_GETCOMMANDS;
+                hdfu->buffer[hdfu->rx_buffer].d8[1] = DFU_CMD_SETADDRESSPOINTER;
+                hdfu->buffer[hdfu->rx_buffer].d8[2] = DFU_CMD_ERASE;
 
                 /* Send the status data over EP0 */
-                USBD_CtlSendData( pdev, ( uint8_t * )( &( hdfu->buffer.d8[0] ) ), 3U );
+                USBD_CtlSendData( pdev, ( uint8_t * )( &( hdfu->buffer[hdfu->rx_buffer].d8[0] ) ), 3U );
             }
             else if( hdfu->wblock_num > 1U )
             {
@@ -882,7 +968,7 @@ static void DFU_Upload( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req )
                 addr = ( ( hdfu->wblock_num - 2U ) * USBD_DFU_XFER_SIZE ) + hdfu->data_ptr; /* Change is Accelerated*/
 
                 /* Return the physical address where data are stored */
-                phaddr = ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->Read( ( uint8_t * )addr, hdfu->buffer.d8, hdfu->wlength );
+                phaddr = ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->Read( ( uint8_t * )addr, hdfu->buffer[hdfu->rx_buffer].d8, hdfu->wlength );
 
                 /* Send the status data over EP0 */
                 USBD_CtlSendData( pdev, phaddr, ( uint16_t )hdfu->wlength );
@@ -945,7 +1031,7 @@ static void DFU_GetStatus( USBD_HandleTypeDef *pdev )
             hdfu->dev_status[3] = 0U;
             hdfu->dev_status[4] = hdfu->dev_state;
 
-            if( ( hdfu->wblock_num == 0U ) && ( hdfu->buffer.d8[0] == DFU_CMD_ERASE ) )
+            if( ( hdfu->wblock_num == 0U ) && ( hdfu->buffer[hdfu->rx_buffer].d8[0] == DFU_CMD_ERASE ) )
             {
                 ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->GetStatus( hdfu->data_ptr, DFU_MEDIA_ERASE, hdfu->dev_status );
             }
@@ -975,6 +1061,12 @@ static void DFU_GetStatus( USBD_HandleTypeDef *pdev )
             hdfu->dev_status[2] = 0U;
             hdfu->dev_status[3] = 0U;
             hdfu->dev_status[4] = hdfu->dev_state;
+
+            /* The last blocks are programmed before leaving */
+            if( hdfu->write_state == DFU_WRITE_BUSY )
+            {
+                ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->GetStatus( hdfu->data_ptr, DFU_MEDIA_PROGRAM, hdfu->dev_status );
+            }
         }
         else
         {
@@ -1067,6 +1159,10 @@ static void DFU_Abort( USBD_HandleTypeDef *pdev )
             || hdfu->dev_state == DFU_STATE_DNLOAD_IDLE || hdfu->dev_state == DFU_STATE_MANIFEST_SYNC
             || hdfu->dev_state == DFU_STATE_UPLOAD_IDLE )
     {
+        /* Drop a queued block and complete the one being programmed */
+        hdfu->rx_pending = 0U;
+        DFU_WriteFlush( pdev );
+
         hdfu->dev_state = DFU_STATE_IDLE;
         hdfu->dev_status[0] = DFU_ERROR_NONE;
         hdfu->dev_status[1] = 0U;
@@ -1126,6 +1222,125 @@ static void DFU_Leave( USBD_HandleTypeDef *pdev )
     }
 }
 
+/**
+  * @brief  DFU_WriteStart
+  *         Hands the received block to the media if it is not programming.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void DFU_WriteStart( USBD_HandleTypeDef *pdev )
+{
+    USBD_DFU_HandleTypeDef   *hdfu;
+    uint32_t addr;
+
+    hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
+
+    if( ( hdfu->rx_pending == 0U ) || ( hdfu->write_state != DFU_WRITE_IDLE ) )
+    {
+        return;
+    }
+
+    hdfu->rx_pending = 0U;
+
+    /* Decode the required address */
+    addr = ( ( hdfu->wblock_num - 2U ) * USBD_DFU_XFER_SIZE ) + hdfu->data_ptr;
+
+    if( ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->WriteAsync( hdfu->buffer[hdfu->rx_buffer].d8,
+            ( uint8_t * )addr, hdfu->wlength ) != USBD_OK )
+    {
+        DFU_WriteError( pdev );
+        return;
+    }
+
+    hdfu->write_state = DFU_WRITE_BUSY;
+
+#if (USBD_DFU_BUFFER_NUM > 1U)
+    /* The block is accepted, the next one is received in the other buffer */
+    hdfu->rx_buffer ^= 1U;
+    hdfu->wblock_num = 0U;
+    hdfu->wlength = 0U;
+#endif
+}
+
+/**
+  * @brief  DFU_WriteProcess
+  *         Lets the media program the next chunk of the current block.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void DFU_WriteProcess( USBD_HandleTypeDef *pdev )
+{
+    USBD_DFU_HandleTypeDef   *hdfu;
+
+    hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
+
+    switch( ( ( USBD_DFU_MediaTypeDef * )pdev->pUserData )->WritePoll() )
+    {
+    case USBD_BUSY:
+        break;
+
+    case USBD_OK:
+        hdfu->write_state = DFU_WRITE_IDLE;
+
+#if (USBD_DFU_BUFFER_NUM == 1U)
+        /* The buffer is free again: the block is complete */
+        hdfu->wblock_num = 0U;
+        hdfu->wlength = 0U;
+#endif
+
+        /* Start the block received in the meantime */
+        DFU_WriteStart( pdev );
+        break;
+
+    default:
+        DFU_WriteError( pdev );
+        break;
+    }
+}
+
+/**
+  * @brief  DFU_WriteFlush
+  *         Waits until the media has programmed every accepted block.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void DFU_WriteFlush( USBD_HandleTypeDef *pdev )
+{
+    USBD_DFU_HandleTypeDef   *hdfu;
+
+    hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
+
+    while( hdfu->write_state == DFU_WRITE_BUSY )
+    {
+        DFU_WriteProcess( pdev );
+    }
+}
+
+/**
+  * @brief  DFU_WriteError
+  *         Reports an asynchronous write failure at the next GETSTATUS.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void DFU_WriteError( USBD_HandleTypeDef *pdev )
+{
+    USBD_DFU_HandleTypeDef   *hdfu;
+
+    hdfu = ( USBD_DFU_HandleTypeDef * ) pdev->pClassData;
+
+    hdfu->write_state = DFU_WRITE_IDLE;
+    hdfu->rx_pending = 0U;
+    hdfu->wblock_num = 0U;
+    hdfu->wlength = 0U;
+
+    hdfu->dev_state = DFU_STATE_ERROR;
+    hdfu->dev_status[0] = DFU_ERROR_WRITE;
+    hdfu->dev_status[1] = 0U;
+    hdfu->dev_status[2] = 0U;
+    hdfu->dev_status[3] = 0U;
+    hdfu->dev_status[4] = hdfu->dev_state;
+}
+
 /**
   * @}
   */
@@ -39,6 +39,8 @@ uint16_t MEM_If_Write( uint8_t *src, uint8_t *dest, uint32_t Len );
 uint8_t *MEM_If_Read( uint8_t *src, uint8_t *dest, uint32_t Len );
 uint16_t MEM_If_DeInit( void );
 uint16_t MEM_If_GetStatus( uint32_t Add, uint8_t Cmd, uint8_t *buffer );
+uint16_t MEM_If_WriteAsync( uint8_t *src, uint8_t *dest, uint32_t Len );
+uint16_t MEM_If_WritePoll( void );
 
 USBD_DFU_MediaTypeDef USBD_DFU_MEDIA_Template_fops =
 {
@@ -49,7 +51,8 @@ USBD_DFU_MediaTypeDef USBD_DFU_MEDIA_Template_fops =
     MEM_If_Write,
     MEM_If_Read,
     MEM_If_GetStatus,
-
+    MEM_If_WriteAsync,
+    MEM_If_WritePoll,
 };
 /**
   * @brief  MEM_If_Init
@@ -96,6 +99,32 @@ uint16_t MEM_If_Write( uint8_t *src, uint8_t *dest, uint32_t Len )
     return 0;
 }
 
+/**
+  * @brief  MEM_If_WriteAsync
+  *         Start a memory write completed by MEM_If_WritePoll.
+  *         Set this entry to NULL to program each block with MEM_If_Write.
+  * @param  src: Data to write, valid until the write completes.
+  * @param  dest: Address to be written to.
+  * @param  Len: Number of data to be written (in bytes).
+  * @retval 0 if operation is successful, MAL_FAIL else.
+  */
+uint16_t MEM_If_WriteAsync( uint8_t *src, uint8_t *dest, uint32_t Len )
+{
+    return 0;
+}
+
+/**
+  * @brief  MEM_If_WritePoll
+  *         Program the next chunk of the write (e.g. one Flash half page),
+  *         called from the SOF interrupt.
+  * @param  None
+  * @retval USBD_BUSY while data remains, USBD_OK when done, USBD_FAIL on error.
+  */
+uint16_t MEM_If_WritePoll( void )
+{
+    return USBD_OK;
+}
+
 /**
   * @brief  MEM_If_Read
   *         Memory read routine.
@@ -118,6 +147,8 @@ uint8_t *MEM_If_Read( uint8_t *src, uint8_t *dest, uint32_t Len )
   */
 uint16_t MEM_If_GetStatus( uint32_t Add, uint8_t Cmd, uint8_t *buffer )
 {
+    /* Fill bwPollTimeout (buffer[1..3], ms) with the time left for the
+       asynchronous write, plus the erase time for DFU_MEDIA_ERASE */
     switch( Cmd )
     {
     case DFU_MEDIA_PROGRAM:
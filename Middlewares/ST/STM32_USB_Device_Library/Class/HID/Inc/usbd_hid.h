@@ -41,7 +41,9 @@ extern "C" {
 /** @defgroup USBD_HID_Exported_Defines
   * @{
   */
+#ifndef HID_EPIN_ADDR
 #define HID_EPIN_ADDR                 0x81U
+#endif /* HID_EPIN_ADDR */
 #define HID_EPIN_SIZE                 0x04U
 
 #define USB_HID_CONFIG_DESC_SIZ       34U
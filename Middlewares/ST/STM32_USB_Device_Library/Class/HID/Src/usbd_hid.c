@@ -530,6 +530,9 @@ static uint8_t  USBD_HID_Setup( USBD_HandleTypeDef *pdev,
 
             break;
 
+        case USB_REQ_CLEAR_FEATURE:
+            break;
+
         default:
             USBD_CtlError( pdev, req );
             ret = USBD_FAIL;
@@ -48,6 +48,13 @@ extern "C" {
 #define MSC_MEDIA_PACKET             512U
 #endif /* MSC_MEDIA_PACKET */
 
+/* Number of MSC_MEDIA_PACKET buffers of the READ/WRITE pipeline. With 2 or
+   more, the next media access overlaps the USB transfer of the previous
+   packet. */
+#ifndef MSC_MEDIA_BUFFERS
+#define MSC_MEDIA_BUFFERS            1U
+#endif /* MSC_MEDIA_BUFFERS */
+
 #define MSC_MAX_FS_PACKET            0x40U
 #define MSC_MAX_HS_PACKET            0x200U
 
@@ -56,8 +63,12 @@ extern "C" {
 #define USB_MSC_CONFIG_DESC_SIZ      32
 
 
+#ifndef MSC_EPIN_ADDR
 #define MSC_EPIN_ADDR                0x81U
+#endif /* MSC_EPIN_ADDR */
+#ifndef MSC_EPOUT_ADDR
 #define MSC_EPOUT_ADDR               0x01U
+#endif /* MSC_EPOUT_ADDR */
 
 /**
   * @}
@@ -76,6 +87,16 @@ typedef struct _USBD_STORAGE
     int8_t ( * Write )( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
     int8_t ( * GetMaxLun )( void );
     int8_t *pInquiry;
+    /* Optional asynchronous media access, used instead of Read and Write
+       when not NULL. They start the transfer and return; its end is reported
+       with USBD_MSC_ReadCplt() or USBD_MSC_WriteCplt(). */
+    int8_t ( * ReadAsync )( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+    int8_t ( * WriteAsync )( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+    /* Optional cache management: Flush commits the writes cached by the
+       storage (SYNCHRONIZE CACHE, eject), Trim discards a block range (UNMAP,
+       which is rejected when NULL). */
+    int8_t ( * Flush )( uint8_t lun );
+    int8_t ( * Trim )( uint8_t lun, uint32_t blk_addr, uint32_t blk_len );
 
 } USBD_StorageTypeDef;
 
@@ -87,7 +108,7 @@ typedef struct
     uint8_t                  bot_state;
     uint8_t                  bot_status;
     uint16_t                 bot_data_length;
-    uint8_t                  bot_data[MSC_MEDIA_PACKET];
+    uint8_t                  bot_data[MSC_MEDIA_BUFFERS * MSC_MEDIA_PACKET];
     USBD_MSC_BOT_CBWTypeDef  cbw;
     USBD_MSC_BOT_CSWTypeDef  csw;
 
@@ -100,6 +121,17 @@ typedef struct
 
     uint32_t                 scsi_blk_addr;
     uint32_t                 scsi_blk_len;
+
+    /* READ/WRITE pipeline: bytes left to move over USB, and the buffers
+       filled but not yet consumed by the other side */
+    uint32_t                 scsi_usb_len;
+    uint16_t                 scsi_buf_len[MSC_MEDIA_BUFFERS];
+    uint8_t                  scsi_buf_count;
+    uint8_t                  scsi_media_idx;
+    uint8_t                  scsi_usb_idx;
+    uint8_t                  scsi_media_busy;
+    uint8_t                  scsi_usb_busy;
+    uint8_t                  scsi_media_error;
 }
 USBD_MSC_BOT_HandleTypeDef;
 
@@ -109,6 +141,9 @@ extern USBD_ClassTypeDef  USBD_MSC;
 
 uint8_t  USBD_MSC_RegisterStorage( USBD_HandleTypeDef   *pdev,
                                    USBD_StorageTypeDef *fops );
+
+void USBD_MSC_ReadCplt( USBD_HandleTypeDef *pdev, int8_t status );
+void USBD_MSC_WriteCplt( USBD_HandleTypeDef *pdev, int8_t status );
 /**
   * @}
   */
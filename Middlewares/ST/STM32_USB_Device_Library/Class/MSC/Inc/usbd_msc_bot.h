@@ -128,6 +128,8 @@ void MSC_BOT_DataOut( USBD_HandleTypeDef  *pdev,
 void MSC_BOT_SendCSW( USBD_HandleTypeDef  *pdev,
                       uint8_t CSW_Status );
 
+void MSC_BOT_Abort( USBD_HandleTypeDef  *pdev );
+
 void  MSC_BOT_CplClrFeature( USBD_HandleTypeDef  *pdev,
                              uint8_t epnum );
 /**
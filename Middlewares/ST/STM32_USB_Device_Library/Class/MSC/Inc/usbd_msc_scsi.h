@@ -71,9 +71,21 @@ extern "C" {
 #define SCSI_VERIFY12                               0xAFU
 #define SCSI_VERIFY16                               0x8FU
 
+#define SCSI_SYNCHRONIZE_CACHE10                    0x35U
+#define SCSI_SYNCHRONIZE_CACHE16                    0x91U
+#define SCSI_UNMAP                                  0x42U
+
 #define SCSI_SEND_DIAGNOSTIC                        0x1DU
 #define SCSI_READ_FORMAT_CAPACITIES                 0x23U
 
+/* Service action of SCSI_READ_CAPACITY16 */
+#define SCSI_SA_READ_CAPACITY16                     0x10U
+
+/* CDB length from the group code of the operation code */
+#define SCSI_GROUP_CODE_MASK                        0xE0U
+#define SCSI_GROUP_CODE_16                          0x80U
+#define SCSI_GROUP_CODE_12                          0xA0U
+
 #define NO_SENSE                                    0U
 #define RECOVERED_ERROR                             1U
 #define NOT_READY                                   2U
@@ -103,6 +115,9 @@ extern "C" {
 
 #define READ_FORMAT_CAPACITY_DATA_LEN               0x0CU
 #define READ_CAPACITY10_DATA_LEN                    0x08U
+#define READ_CAPACITY16_DATA_LEN                    0x20U
+#define UNMAP_PARAM_HEADER_LEN                      0x08U
+#define UNMAP_BLOCK_DESC_LEN                        0x10U
 #define MODE_SENSE10_DATA_LEN                       0x08U
 #define MODE_SENSE6_DATA_LEN                        0x04U
 #define REQUEST_SENSE_DATA_LEN                      0x12U
@@ -167,6 +182,9 @@ int8_t SCSI_ProcessCmd( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *cmd );
 void SCSI_SenseCode( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t sKey,
                      uint8_t ASC );
 
+void SCSI_ReadCplt( USBD_HandleTypeDef *pdev, int8_t status );
+void SCSI_WriteCplt( USBD_HandleTypeDef *pdev, int8_t status );
+
 /**
   * @}
   */
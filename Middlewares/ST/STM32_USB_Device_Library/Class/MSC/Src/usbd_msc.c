@@ -618,6 +618,40 @@ uint8_t  USBD_MSC_RegisterStorage( USBD_HandleTypeDef   *pdev,
     return USBD_OK;
 }
 
+/**
+* @brief  USBD_MSC_ReadCplt
+*         Report the end of a ReadAsync() media access
+* @param  pdev: device instance
+* @param  status: 0 if the data were read, negative on error
+* @retval None
+* @note   Must not preempt the USB interrupt, e.g. call it from an interrupt
+*         with the same priority as the USB one.
+*/
+void  USBD_MSC_ReadCplt( USBD_HandleTypeDef *pdev, int8_t status )
+{
+    if( pdev->pClassData != NULL )
+    {
+        SCSI_ReadCplt( pdev, status );
+    }
+}
+
+/**
+* @brief  USBD_MSC_WriteCplt
+*         Report the end of a WriteAsync() media access
+* @param  pdev: device instance
+* @param  status: 0 if the data were written, negative on error
+* @retval None
+* @note   Must not preempt the USB interrupt, e.g. call it from an interrupt
+*         with the same priority as the USB one.
+*/
+void  USBD_MSC_WriteCplt( USBD_HandleTypeDef *pdev, int8_t status )
+{
+    if( pdev->pClassData != NULL )
+    {
+        SCSI_WriteCplt( pdev, status );
+    }
+}
+
 /**
   * @}
   */
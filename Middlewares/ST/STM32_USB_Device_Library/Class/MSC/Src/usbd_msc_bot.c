@@ -80,8 +80,6 @@ static void MSC_BOT_CBW_Decode( USBD_HandleTypeDef  *pdev );
 
 static void MSC_BOT_SendData( USBD_HandleTypeDef *pdev, uint8_t *pbuf,
                               uint16_t len );
-
-static void MSC_BOT_Abort( USBD_HandleTypeDef  *pdev );
 /**
   * @}
   */
@@ -168,7 +166,8 @@ void MSC_BOT_DataIn( USBD_HandleTypeDef  *pdev,
                              hmsc->cbw.bLUN,
                              &hmsc->cbw.CB[0] ) < 0 )
         {
-            MSC_BOT_SendCSW( pdev, USBD_CSW_CMD_FAILED );
+            /* The host still expects data: case 5 : Hi > Di */
+            MSC_BOT_Abort( pdev );
         }
 
         break;
@@ -327,12 +326,13 @@ void  MSC_BOT_SendCSW( USBD_HandleTypeDef  *pdev,
 
 /**
 * @brief  MSC_BOT_Abort
-*         Abort the current transfer
+*         Abort the current transfer: stall the data pipe(s), the CSW is sent
+*         once the host has cleared the halt of the IN endpoint
 * @param  pdev: device instance
 * @retval status
 */
 
-static void  MSC_BOT_Abort( USBD_HandleTypeDef  *pdev )
+void  MSC_BOT_Abort( USBD_HandleTypeDef  *pdev )
 {
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
 
@@ -373,6 +373,12 @@ void  MSC_BOT_CplClrFeature( USBD_HandleTypeDef  *pdev, uint8_t epnum )
     {
         MSC_BOT_SendCSW( pdev, USBD_CSW_CMD_FAILED );
     }
+    else if( ( ( epnum & 0x80U ) == 0U ) && ( hmsc->bot_state == USBD_BOT_IDLE ) )
+    {
+        /* Reopening the endpoint cancelled the reception of the next CBW */
+        USBD_LL_PrepareReceive( pdev, MSC_EPOUT_ADDR, ( uint8_t * )( void * )&hmsc->cbw,
+                                USBD_BOT_CBW_LENGTH );
+    }
     else
     {
         return;
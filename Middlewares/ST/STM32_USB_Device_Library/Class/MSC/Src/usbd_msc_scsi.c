@@ -61,6 +61,8 @@ EndBSPDependencies */
 /** @defgroup MSC_SCSI_Private_Macros
   * @{
   */
+#define SCSI_MEDIA_BUF(hmsc, idx)   (&(hmsc)->bot_data[(uint32_t)(idx) * MSC_MEDIA_PACKET])
+#define SCSI_NEXT_BUF(idx)          ((uint8_t)(((uint32_t)(idx) + 1U) % MSC_MEDIA_BUFFERS))
 /**
   * @}
   */
@@ -86,14 +88,26 @@ static int8_t SCSI_RequestSense( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t
 static int8_t SCSI_StartStopUnit( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
 static int8_t SCSI_ModeSense6( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
 static int8_t SCSI_ModeSense10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
-static int8_t SCSI_Write10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
-static int8_t SCSI_Read10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
-static int8_t SCSI_Verify10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_ReadCapacity16( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_Write( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_Read( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_Verify( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_SynchronizeCache( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_Unmap( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params );
+static int8_t SCSI_GetBlockRange( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *params,
+                                  uint32_t *blk_addr, uint32_t *blk_len );
 static int8_t SCSI_CheckAddressRange( USBD_HandleTypeDef *pdev, uint8_t lun,
                                       uint32_t blk_offset, uint32_t blk_nbr );
 
+static void SCSI_PipelineInit( USBD_MSC_BOT_HandleTypeDef *hmsc, uint32_t len );
+static int8_t SCSI_ReadPipeline( USBD_HandleTypeDef *pdev, uint8_t lun );
+static int8_t SCSI_WritePipeline( USBD_HandleTypeDef *pdev, uint8_t lun );
+static void SCSI_ReadDone( USBD_MSC_BOT_HandleTypeDef *hmsc );
+static void SCSI_WriteDone( USBD_MSC_BOT_HandleTypeDef *hmsc );
+
 static int8_t SCSI_ProcessRead( USBD_HandleTypeDef *pdev, uint8_t lun );
 static int8_t SCSI_ProcessWrite( USBD_HandleTypeDef *pdev, uint8_t lun );
+static int8_t SCSI_ProcessUnmap( USBD_HandleTypeDef *pdev, uint8_t lun );
 /**
   * @}
   */
@@ -114,62 +128,84 @@ static int8_t SCSI_ProcessWrite( USBD_HandleTypeDef *pdev, uint8_t lun );
 */
 int8_t SCSI_ProcessCmd( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *cmd )
 {
+    int8_t ret = 0;
+
     switch( cmd[0] )
     {
     case SCSI_TEST_UNIT_READY:
-        SCSI_TestUnitReady( pdev, lun, cmd );
+        ret = SCSI_TestUnitReady( pdev, lun, cmd );
         break;
 
     case SCSI_REQUEST_SENSE:
-        SCSI_RequestSense( pdev, lun, cmd );
+        ret = SCSI_RequestSense( pdev, lun, cmd );
         break;
 
     case SCSI_INQUIRY:
-        SCSI_Inquiry( pdev, lun, cmd );
+        ret = SCSI_Inquiry( pdev, lun, cmd );
         break;
 
     case SCSI_START_STOP_UNIT:
-        SCSI_StartStopUnit( pdev, lun, cmd );
+        ret = SCSI_StartStopUnit( pdev, lun, cmd );
         break;
 
     case SCSI_ALLOW_MEDIUM_REMOVAL:
-        SCSI_StartStopUnit( pdev, lun, cmd );
+        ret = SCSI_StartStopUnit( pdev, lun, cmd );
         break;
 
     case SCSI_MODE_SENSE6:
-        SCSI_ModeSense6( pdev, lun, cmd );
+        ret = SCSI_ModeSense6( pdev, lun, cmd );
         break;
 
     case SCSI_MODE_SENSE10:
-        SCSI_ModeSense10( pdev, lun, cmd );
+        ret = SCSI_ModeSense10( pdev, lun, cmd );
         break;
 
     case SCSI_READ_FORMAT_CAPACITIES:
-        SCSI_ReadFormatCapacity( pdev, lun, cmd );
+        ret = SCSI_ReadFormatCapacity( pdev, lun, cmd );
         break;
 
     case SCSI_READ_CAPACITY10:
-        SCSI_ReadCapacity10( pdev, lun, cmd );
+        ret = SCSI_ReadCapacity10( pdev, lun, cmd );
+        break;
+
+    case SCSI_READ_CAPACITY16:
+        ret = SCSI_ReadCapacity16( pdev, lun, cmd );
         break;
 
     case SCSI_READ10:
-        SCSI_Read10( pdev, lun, cmd );
+    case SCSI_READ12:
+    case SCSI_READ16:
+        ret = SCSI_Read( pdev, lun, cmd );
         break;
 
     case SCSI_WRITE10:
-        SCSI_Write10( pdev, lun, cmd );
+    case SCSI_WRITE12:
+    case SCSI_WRITE16:
+        ret = SCSI_Write( pdev, lun, cmd );
         break;
 
     case SCSI_VERIFY10:
-        SCSI_Verify10( pdev, lun, cmd );
+    case SCSI_VERIFY12:
+    case SCSI_VERIFY16:
+        ret = SCSI_Verify( pdev, lun, cmd );
+        break;
+
+    case SCSI_SYNCHRONIZE_CACHE10:
+    case SCSI_SYNCHRONIZE_CACHE16:
+        ret = SCSI_SynchronizeCache( pdev, lun, cmd );
+        break;
+
+    case SCSI_UNMAP:
+        ret = SCSI_Unmap( pdev, lun, cmd );
         break;
 
     default:
         SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, INVALID_CDB );
-        return -1;
+        ret = -1;
+        break;
     }
 
-    return 0;
+    return ret;
 }
 
 
@@ -284,6 +320,62 @@ static int8_t SCSI_ReadCapacity10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8
         return 0;
     }
 }
+
+/**
+* @brief  SCSI_ReadCapacity16
+*         Process Read Capacity 16 command
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_ReadCapacity16( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
+{
+    USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+    uint32_t len;
+    uint8_t idx;
+
+    /* Only the READ CAPACITY service action of SERVICE ACTION IN(16) */
+    if( ( params[1] & 0x1FU ) != SCSI_SA_READ_CAPACITY16 )
+    {
+        SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, INVALID_CDB );
+        return -1;
+    }
+
+    if( storage->GetCapacity( lun, &hmsc->scsi_blk_nbr, &hmsc->scsi_blk_size ) != 0 )
+    {
+        SCSI_SenseCode( pdev, lun, NOT_READY, MEDIUM_NOT_PRESENT );
+        return -1;
+    }
+
+    for( idx = 0U; idx < READ_CAPACITY16_DATA_LEN; idx++ )
+    {
+        hmsc->bot_data[idx] = 0U;
+    }
+
+    /* 64-bit last LBA, of which only the low 32 bits are used */
+    hmsc->bot_data[4] = ( uint8_t )( ( hmsc->scsi_blk_nbr - 1U ) >> 24 );
+    hmsc->bot_data[5] = ( uint8_t )( ( hmsc->scsi_blk_nbr - 1U ) >> 16 );
+    hmsc->bot_data[6] = ( uint8_t )( ( hmsc->scsi_blk_nbr - 1U ) >>  8 );
+    hmsc->bot_data[7] = ( uint8_t )( hmsc->scsi_blk_nbr - 1U );
+
+    hmsc->bot_data[10] = ( uint8_t )( hmsc->scsi_blk_size >>  8 );
+    hmsc->bot_data[11] = ( uint8_t )( hmsc->scsi_blk_size );
+
+    /* LBPME : the host may UNMAP */
+    if( storage->Trim != NULL )
+    {
+        hmsc->bot_data[14] = 0x80U;
+    }
+
+    len = ( ( uint32_t )params[10] << 24 ) |
+          ( ( uint32_t )params[11] << 16 ) |
+          ( ( uint32_t )params[12] <<  8 ) |
+          ( uint32_t )params[13];
+
+    hmsc->bot_data_length = ( uint16_t )MIN( len, READ_CAPACITY16_DATA_LEN );
+    return 0;
+}
 /**
 * @brief  SCSI_ReadFormatCapacity
 *         Process Read Format Capacity command
@@ -396,8 +488,8 @@ static int8_t SCSI_RequestSense( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t
     {
 
         hmsc->bot_data[2]     = hmsc->scsi_sense[hmsc->scsi_sense_head].Skey;
-        hmsc->bot_data[12]    = hmsc->scsi_sense[hmsc->scsi_sense_head].w.b.ASCQ;
-        hmsc->bot_data[13]    = hmsc->scsi_sense[hmsc->scsi_sense_head].w.b.ASC;
+        hmsc->bot_data[12]    = hmsc->scsi_sense[hmsc->scsi_sense_head].w.b.ASC;
+        hmsc->bot_data[13]    = hmsc->scsi_sense[hmsc->scsi_sense_head].w.b.ASCQ;
         hmsc->scsi_sense_head++;
 
         if( hmsc->scsi_sense_head == SENSE_LIST_DEEPTH )
@@ -430,7 +522,8 @@ void SCSI_SenseCode( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t sKey, uint8
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
 
     hmsc->scsi_sense[hmsc->scsi_sense_tail].Skey  = sKey;
-    hmsc->scsi_sense[hmsc->scsi_sense_tail].w.ASC = ASC << 8;
+    hmsc->scsi_sense[hmsc->scsi_sense_tail].w.b.ASC = ( char )ASC;
+    hmsc->scsi_sense[hmsc->scsi_sense_tail].w.b.ASCQ = 0;
     hmsc->scsi_sense_tail++;
 
     if( hmsc->scsi_sense_tail == SENSE_LIST_DEEPTH )
@@ -448,18 +541,29 @@ void SCSI_SenseCode( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t sKey, uint8
 static int8_t SCSI_StartStopUnit( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
 {
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+
+    /* Commit the cached writes before the medium is ejected */
+    if( ( params[0] == SCSI_START_STOP_UNIT ) && ( ( params[4] & 0x03U ) == 0x02U ) &&
+            ( storage->Flush != NULL ) && ( storage->Flush( lun ) != 0 ) )
+    {
+        SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, WRITE_FAULT );
+        hmsc->bot_state = USBD_BOT_NO_DATA;
+        return -1;
+    }
+
     hmsc->bot_data_length = 0U;
     return 0;
 }
 
 /**
-* @brief  SCSI_Read10
-*         Process Read10 command
+* @brief  SCSI_Read
+*         Process Read10, Read12 and Read16 commands
 * @param  lun: Logical unit number
 * @param  params: Command parameters
 * @retval status
 */
-static int8_t SCSI_Read10( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *params )
+static int8_t SCSI_Read( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *params )
 {
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
 
@@ -478,12 +582,11 @@ static int8_t SCSI_Read10( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *param
             return -1;
         }
 
-        hmsc->scsi_blk_addr = ( ( uint32_t )params[2] << 24 ) |
-                              ( ( uint32_t )params[3] << 16 ) |
-                              ( ( uint32_t )params[4] <<  8 ) |
-                              ( uint32_t )params[5];
-
-        hmsc->scsi_blk_len = ( ( uint32_t )params[7] <<  8 ) | ( uint32_t )params[8];
+        if( SCSI_GetBlockRange( pdev, lun, params, &hmsc->scsi_blk_addr,
+                                &hmsc->scsi_blk_len ) < 0 )
+        {
+            return -1; /* error */
+        }
 
         if( SCSI_CheckAddressRange( pdev, lun, hmsc->scsi_blk_addr,
                                     hmsc->scsi_blk_len ) < 0 )
@@ -494,11 +597,23 @@ static int8_t SCSI_Read10( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *param
         hmsc->bot_state = USBD_BOT_DATA_IN;
 
         /* cases 4,5 : Hi <> Dn */
-        if( hmsc->cbw.dDataLength != ( hmsc->scsi_blk_len * hmsc->scsi_blk_size ) )
+        if( ( ( hmsc->scsi_blk_len > 0U ) &&
+                ( hmsc->scsi_blk_len > ( 0xFFFFFFFFU / hmsc->scsi_blk_size ) ) ) ||
+                ( hmsc->cbw.dDataLength != ( hmsc->scsi_blk_len * hmsc->scsi_blk_size ) ) )
         {
             SCSI_SenseCode( pdev, hmsc->cbw.bLUN, ILLEGAL_REQUEST, INVALID_CDB );
             return -1;
         }
+
+        /* Nothing to transfer */
+        if( hmsc->scsi_blk_len == 0U )
+        {
+            hmsc->bot_state = USBD_BOT_IDLE;
+            hmsc->bot_data_length = 0U;
+            return 0;
+        }
+
+        SCSI_PipelineInit( hmsc, hmsc->cbw.dDataLength );
     }
 
     hmsc->bot_data_length = MSC_MEDIA_PACKET;
@@ -507,14 +622,14 @@ static int8_t SCSI_Read10( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *param
 }
 
 /**
-* @brief  SCSI_Write10
-*         Process Write10 command
+* @brief  SCSI_Write
+*         Process Write10, Write12 and Write16 commands
 * @param  lun: Logical unit number
 * @param  params: Command parameters
 * @retval status
 */
 
-static int8_t SCSI_Write10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
+static int8_t SCSI_Write( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
 {
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
     uint32_t len;
@@ -542,13 +657,11 @@ static int8_t SCSI_Write10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *par
             return -1;
         }
 
-        hmsc->scsi_blk_addr = ( ( uint32_t )params[2] << 24 ) |
-                              ( ( uint32_t )params[3] << 16 ) |
-                              ( ( uint32_t )params[4] << 8 ) |
-                              ( uint32_t )params[5];
-
-        hmsc->scsi_blk_len = ( ( uint32_t )params[7] << 8 ) |
-                             ( uint32_t )params[8];
+        if( SCSI_GetBlockRange( pdev, lun, params, &hmsc->scsi_blk_addr,
+                                &hmsc->scsi_blk_len ) < 0 )
+        {
+            return -1; /* error */
+        }
 
         /* check if LBA address is in the right range */
         if( SCSI_CheckAddressRange( pdev, lun, hmsc->scsi_blk_addr,
@@ -560,17 +673,26 @@ static int8_t SCSI_Write10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *par
         len = hmsc->scsi_blk_len * hmsc->scsi_blk_size;
 
         /* cases 3,11,13 : Hn,Ho <> D0 */
-        if( hmsc->cbw.dDataLength != len )
+        if( ( ( hmsc->scsi_blk_len > 0U ) &&
+                ( hmsc->scsi_blk_len > ( 0xFFFFFFFFU / hmsc->scsi_blk_size ) ) ) ||
+                ( hmsc->cbw.dDataLength != len ) )
         {
             SCSI_SenseCode( pdev, hmsc->cbw.bLUN, ILLEGAL_REQUEST, INVALID_CDB );
             return -1;
         }
 
-        len = MIN( len, MSC_MEDIA_PACKET );
+        /* Nothing to transfer */
+        if( len == 0U )
+        {
+            hmsc->bot_data_length = 0U;
+            return 0;
+        }
 
         /* Prepare EP to receive first data packet */
         hmsc->bot_state = USBD_BOT_DATA_OUT;
-        USBD_LL_PrepareReceive( pdev, MSC_EPOUT_ADDR, hmsc->bot_data, len );
+        SCSI_PipelineInit( hmsc, len );
+
+        return SCSI_WritePipeline( pdev, lun );
     }
     else /* Write Process ongoing */
     {
@@ -582,16 +704,21 @@ static int8_t SCSI_Write10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *par
 
 
 /**
-* @brief  SCSI_Verify10
-*         Process Verify10 command
+* @brief  SCSI_Verify
+*         Process Verify10, Verify12 and Verify16 commands: the blocks are
+*         read back from the media
 * @param  lun: Logical unit number
 * @param  params: Command parameters
 * @retval status
 */
 
-static int8_t SCSI_Verify10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
+static int8_t SCSI_Verify( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
 {
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+    uint32_t blk_addr;
+    uint32_t blk_len;
+    uint32_t blk_nbr;
 
     if( ( params[1] & 0x02U ) == 0x02U )
     {
@@ -599,16 +726,221 @@ static int8_t SCSI_Verify10( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *pa
         return -1; /* Error, Verify Mode Not supported*/
     }
 
-    if( SCSI_CheckAddressRange( pdev, lun, hmsc->scsi_blk_addr,
-                                hmsc->scsi_blk_len ) < 0 )
+    /* case 9 : Hi > D0 */
+    if( hmsc->cbw.dDataLength != 0U )
+    {
+        SCSI_SenseCode( pdev, hmsc->cbw.bLUN, ILLEGAL_REQUEST, INVALID_CDB );
+        return -1;
+    }
+
+    hmsc->bot_state = USBD_BOT_NO_DATA;
+
+    if( storage->IsReady( lun ) != 0 )
+    {
+        SCSI_SenseCode( pdev, lun, NOT_READY, MEDIUM_NOT_PRESENT );
+        return -1;
+    }
+
+    if( SCSI_GetBlockRange( pdev, lun, params, &blk_addr, &blk_len ) < 0 )
     {
         return -1; /* error */
     }
 
+    if( SCSI_CheckAddressRange( pdev, lun, blk_addr, blk_len ) < 0 )
+    {
+        return -1; /* error */
+    }
+
+    /* The blocks are read back one BOT buffer at a time */
+    if( ( blk_len > 0U ) && ( hmsc->scsi_blk_size > sizeof( hmsc->bot_data ) ) )
+    {
+        SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, INVALID_CDB );
+        return -1;
+    }
+
+    while( blk_len > 0U )
+    {
+        blk_nbr = MIN( blk_len, sizeof( hmsc->bot_data ) / hmsc->scsi_blk_size );
+
+        if( storage->Read( lun, hmsc->bot_data, blk_addr, ( uint16_t )blk_nbr ) < 0 )
+        {
+            SCSI_SenseCode( pdev, lun, MEDIUM_ERROR, UNRECOVERED_READ_ERROR );
+            return -1;
+        }
+
+        blk_addr += blk_nbr;
+        blk_len -= blk_nbr;
+    }
+
+    hmsc->bot_state = USBD_BOT_IDLE;
     hmsc->bot_data_length = 0U;
     return 0;
 }
 
+/**
+* @brief  SCSI_SynchronizeCache
+*         Process Synchronize Cache 10 and 16 commands
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_SynchronizeCache( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
+{
+    USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+
+    /* case 9 : Hi > D0 */
+    if( hmsc->cbw.dDataLength != 0U )
+    {
+        SCSI_SenseCode( pdev, hmsc->cbw.bLUN, ILLEGAL_REQUEST, INVALID_CDB );
+        return -1;
+    }
+
+    /* The whole cache is written back, whatever the block range */
+    if( ( storage->Flush != NULL ) && ( storage->Flush( lun ) != 0 ) )
+    {
+        SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, WRITE_FAULT );
+        hmsc->bot_state = USBD_BOT_NO_DATA;
+        return -1;
+    }
+
+    hmsc->bot_data_length = 0U;
+    return 0;
+}
+
+/**
+* @brief  SCSI_Unmap
+*         Process Unmap command
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_Unmap( USBD_HandleTypeDef  *pdev, uint8_t lun, uint8_t *params )
+{
+    USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+    uint32_t len;
+
+    if( hmsc->bot_state == USBD_BOT_IDLE ) /* Idle */
+    {
+        /* Not supported without a Trim callback */
+        if( storage->Trim == NULL )
+        {
+            SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, INVALID_CDB );
+            return -1;
+        }
+
+        /* case 8 : Hi <> Do */
+        if( ( hmsc->cbw.bmFlags & 0x80U ) == 0x80U )
+        {
+            SCSI_SenseCode( pdev, hmsc->cbw.bLUN, ILLEGAL_REQUEST, INVALID_CDB );
+            return -1;
+        }
+
+        if( storage->IsReady( lun ) != 0 )
+        {
+            SCSI_SenseCode( pdev, lun, NOT_READY, MEDIUM_NOT_PRESENT );
+            return -1;
+        }
+
+        if( storage->IsWriteProtected( lun ) != 0 )
+        {
+            SCSI_SenseCode( pdev, lun, NOT_READY, WRITE_PROTECTED );
+            return -1;
+        }
+
+        len = ( ( uint32_t )params[7] << 8 ) | ( uint32_t )params[8];
+
+        /* cases 3,11,13 : Hn,Ho <> D0 */
+        if( hmsc->cbw.dDataLength != len )
+        {
+            SCSI_SenseCode( pdev, hmsc->cbw.bLUN, ILLEGAL_REQUEST, INVALID_CDB );
+            return -1;
+        }
+
+        /* The parameter list is received at once */
+        if( len > sizeof( hmsc->bot_data ) )
+        {
+            SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, PARAMETER_LIST_LENGTH_ERROR );
+            return -1;
+        }
+
+        /* Nothing to unmap */
+        if( len == 0U )
+        {
+            hmsc->bot_data_length = 0U;
+            return 0;
+        }
+
+        hmsc->bot_state = USBD_BOT_DATA_OUT;
+        USBD_LL_PrepareReceive( pdev, MSC_EPOUT_ADDR, hmsc->bot_data, ( uint16_t )len );
+    }
+    else /* Parameter list received */
+    {
+        return SCSI_ProcessUnmap( pdev, lun );
+    }
+
+    return 0;
+}
+
+/**
+* @brief  SCSI_GetBlockRange
+*         Decode the LBA and the transfer length of a 10, 12 or 16-byte CDB
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @param  blk_addr: first block
+* @param  blk_len: number of blocks
+* @retval status
+*/
+static int8_t SCSI_GetBlockRange( USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *params,
+                                  uint32_t *blk_addr, uint32_t *blk_len )
+{
+    switch( params[0] & SCSI_GROUP_CODE_MASK )
+    {
+    case SCSI_GROUP_CODE_16:
+        /* Only the low 32 bits of the LBA are addressable */
+        if( ( params[2] | params[3] | params[4] | params[5] ) != 0U )
+        {
+            SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+            return -1;
+        }
+
+        *blk_addr = ( ( uint32_t )params[6] << 24 ) |
+                    ( ( uint32_t )params[7] << 16 ) |
+                    ( ( uint32_t )params[8] <<  8 ) |
+                    ( uint32_t )params[9];
+
+        *blk_len = ( ( uint32_t )params[10] << 24 ) |
+                   ( ( uint32_t )params[11] << 16 ) |
+                   ( ( uint32_t )params[12] <<  8 ) |
+                   ( uint32_t )params[13];
+        break;
+
+    case SCSI_GROUP_CODE_12:
+        *blk_addr = ( ( uint32_t )params[2] << 24 ) |
+                    ( ( uint32_t )params[3] << 16 ) |
+                    ( ( uint32_t )params[4] <<  8 ) |
+                    ( uint32_t )params[5];
+
+        *blk_len = ( ( uint32_t )params[6] << 24 ) |
+                   ( ( uint32_t )params[7] << 16 ) |
+                   ( ( uint32_t )params[8] <<  8 ) |
+                   ( uint32_t )params[9];
+        break;
+
+    default:
+        *blk_addr = ( ( uint32_t )params[2] << 24 ) |
+                    ( ( uint32_t )params[3] << 16 ) |
+                    ( ( uint32_t )params[4] <<  8 ) |
+                    ( uint32_t )params[5];
+
+        *blk_len = ( ( uint32_t )params[7] <<  8 ) | ( uint32_t )params[8];
+        break;
+    }
+
+    return 0;
+}
+
 /**
 * @brief  SCSI_CheckAddressRange
 *         Check address range
@@ -622,7 +954,8 @@ static int8_t SCSI_CheckAddressRange( USBD_HandleTypeDef *pdev, uint8_t lun,
 {
     USBD_MSC_BOT_HandleTypeDef  *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
 
-    if( ( blk_offset + blk_nbr ) > hmsc->scsi_blk_nbr )
+    if( ( blk_offset > hmsc->scsi_blk_nbr ) ||
+            ( blk_nbr > ( hmsc->scsi_blk_nbr - blk_offset ) ) )
     {
         SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
         return -1;
@@ -631,6 +964,128 @@ static int8_t SCSI_CheckAddressRange( USBD_HandleTypeDef *pdev, uint8_t lun,
     return 0;
 }
 
+/**
+* @brief  SCSI_PipelineInit
+*         Reset the READ/WRITE pipeline for a new command
+* @param  hmsc: MSC handle
+* @param  len: number of bytes of the data stage
+* @retval None
+*/
+static void SCSI_PipelineInit( USBD_MSC_BOT_HandleTypeDef *hmsc, uint32_t len )
+{
+    hmsc->scsi_usb_len = len;
+    hmsc->scsi_buf_count = 0U;
+    hmsc->scsi_media_idx = 0U;
+    hmsc->scsi_usb_idx = 0U;
+    hmsc->scsi_media_busy = 0U;
+    hmsc->scsi_usb_busy = 0U;
+    hmsc->scsi_media_error = 0U;
+}
+
+/**
+* @brief  SCSI_ReadDone
+*         Account for a media read that completed successfully
+* @param  hmsc: MSC handle
+* @retval None
+*/
+static void SCSI_ReadDone( USBD_MSC_BOT_HandleTypeDef *hmsc )
+{
+    uint32_t blk_nbr = hmsc->scsi_buf_len[hmsc->scsi_media_idx] / hmsc->scsi_blk_size;
+
+    hmsc->scsi_blk_addr += blk_nbr;
+    hmsc->scsi_blk_len -= blk_nbr;
+
+    hmsc->scsi_buf_count++;
+    hmsc->scsi_media_idx = SCSI_NEXT_BUF( hmsc->scsi_media_idx );
+    hmsc->scsi_media_busy = 0U;
+}
+
+/**
+* @brief  SCSI_ReadPipeline
+*         Send the buffers read from the media, and read ahead into the free
+*         ones while a packet is on the wire
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_ReadPipeline( USBD_HandleTypeDef  *pdev, uint8_t lun )
+{
+    USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+    uint8_t *pbuf;
+    uint32_t len;
+    int8_t ret;
+
+    for( ;; )
+    {
+        if( ( hmsc->scsi_usb_busy == 0U ) && ( hmsc->scsi_buf_count > 0U ) )
+        {
+            /* Send the oldest buffer */
+            len = hmsc->scsi_buf_len[hmsc->scsi_usb_idx];
+
+            hmsc->scsi_buf_count--;
+            hmsc->scsi_usb_busy = 1U;
+            hmsc->scsi_usb_len -= len;
+
+            /* case 6 : Hi = Di */
+            hmsc->csw.dDataResidue -= len;
+
+            if( hmsc->scsi_usb_len == 0U )
+            {
+                hmsc->bot_state = USBD_BOT_LAST_DATA_IN;
+            }
+
+            USBD_LL_Transmit( pdev, MSC_EPIN_ADDR,
+                              SCSI_MEDIA_BUF( hmsc, hmsc->scsi_usb_idx ), len );
+        }
+        else if( ( hmsc->scsi_media_busy == 0U ) && ( hmsc->scsi_media_error == 0U ) &&
+                 ( hmsc->scsi_blk_len > 0U ) &&
+                 ( ( hmsc->scsi_buf_count + hmsc->scsi_usb_busy ) < MSC_MEDIA_BUFFERS ) )
+        {
+            /* Read the next packet into a free buffer */
+            len = MIN( ( hmsc->scsi_blk_len * hmsc->scsi_blk_size ), MSC_MEDIA_PACKET );
+            pbuf = SCSI_MEDIA_BUF( hmsc, hmsc->scsi_media_idx );
+
+            hmsc->scsi_buf_len[hmsc->scsi_media_idx] = ( uint16_t )len;
+            hmsc->scsi_media_busy = 1U;
+
+            if( storage->ReadAsync != NULL )
+            {
+                ret = storage->ReadAsync( lun, pbuf, hmsc->scsi_blk_addr,
+                                          ( uint16_t )( len / hmsc->scsi_blk_size ) );
+            }
+            else
+            {
+                ret = storage->Read( lun, pbuf, hmsc->scsi_blk_addr,
+                                     ( uint16_t )( len / hmsc->scsi_blk_size ) );
+
+                if( ret >= 0 )
+                {
+                    SCSI_ReadDone( hmsc );
+                }
+            }
+
+            if( ret < 0 )
+            {
+                SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR );
+                hmsc->scsi_media_busy = 0U;
+                hmsc->scsi_media_error = 1U;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    /* Report a read error once no packet is on the wire any more */
+    if( ( hmsc->scsi_media_error != 0U ) && ( hmsc->scsi_usb_busy == 0U ) )
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
 /**
 * @brief  SCSI_ProcessRead
 *         Handle Read Process
@@ -640,30 +1095,155 @@ static int8_t SCSI_CheckAddressRange( USBD_HandleTypeDef *pdev, uint8_t lun,
 static int8_t SCSI_ProcessRead( USBD_HandleTypeDef  *pdev, uint8_t lun )
 {
     USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
-    uint32_t len = hmsc->scsi_blk_len * hmsc->scsi_blk_size;
 
-    len = MIN( len, MSC_MEDIA_PACKET );
+    /* The previous packet has been sent, its buffer is free again */
+    if( hmsc->scsi_usb_busy != 0U )
+    {
+        hmsc->scsi_usb_busy = 0U;
+        hmsc->scsi_usb_idx = SCSI_NEXT_BUF( hmsc->scsi_usb_idx );
+    }
+
+    return SCSI_ReadPipeline( pdev, lun );
+}
+
+/**
+* @brief  SCSI_ReadCplt
+*         Handle the end of an asynchronous media read
+* @param  status: 0 if the data were read, negative on error
+* @retval None
+*/
+void SCSI_ReadCplt( USBD_HandleTypeDef  *pdev, int8_t status )
+{
+    USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
+
+    /* Ignore the completion of a read the host has given up on */
+    if( ( hmsc->scsi_media_busy == 0U ) ||
+            ( ( hmsc->bot_state != USBD_BOT_DATA_IN ) &&
+              ( hmsc->bot_state != USBD_BOT_LAST_DATA_IN ) ) )
+    {
+        hmsc->scsi_media_busy = 0U;
+        return;
+    }
 
-    if( ( ( USBD_StorageTypeDef * )pdev->pUserData )->Read( lun,
-            hmsc->bot_data,
-            hmsc->scsi_blk_addr,
-            ( len / hmsc->scsi_blk_size ) ) < 0 )
+    if( status < 0 )
     {
-        SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR );
-        return -1;
+        SCSI_SenseCode( pdev, hmsc->cbw.bLUN, HARDWARE_ERROR, UNRECOVERED_READ_ERROR );
+        hmsc->scsi_media_busy = 0U;
+        hmsc->scsi_media_error = 1U;
     }
+    else
+    {
+        SCSI_ReadDone( hmsc );
+    }
+
+    if( SCSI_ReadPipeline( pdev, hmsc->cbw.bLUN ) < 0 )
+    {
+        /* The host still expects data: case 5 : Hi > Di */
+        MSC_BOT_Abort( pdev );
+    }
+}
 
-    USBD_LL_Transmit( pdev, MSC_EPIN_ADDR, hmsc->bot_data, len );
+/**
+* @brief  SCSI_WriteDone
+*         Account for a media write that has ended
+* @param  hmsc: MSC handle
+* @retval None
+*/
+static void SCSI_WriteDone( USBD_MSC_BOT_HandleTypeDef *hmsc )
+{
+    uint32_t len = hmsc->scsi_buf_len[hmsc->scsi_media_idx];
 
     hmsc->scsi_blk_addr += ( len / hmsc->scsi_blk_size );
     hmsc->scsi_blk_len -= ( len / hmsc->scsi_blk_size );
 
-    /* case 6 : Hi = Di */
-    hmsc->csw.dDataResidue -= len;
+    /* case 12 : Ho = Do */
+    if( hmsc->scsi_media_error == 0U )
+    {
+        hmsc->csw.dDataResidue -= len;
+    }
+
+    hmsc->scsi_buf_count--;
+    hmsc->scsi_media_idx = SCSI_NEXT_BUF( hmsc->scsi_media_idx );
+    hmsc->scsi_media_busy = 0U;
+}
+
+/**
+* @brief  SCSI_WritePipeline
+*         Receive the next packets into the free buffers, and write the
+*         received ones to the media meanwhile
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_WritePipeline( USBD_HandleTypeDef  *pdev, uint8_t lun )
+{
+    USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
+    USBD_StorageTypeDef *storage = ( USBD_StorageTypeDef * )pdev->pUserData;
+    uint8_t *pbuf;
+    uint32_t len;
+    int8_t ret;
 
-    if( hmsc->scsi_blk_len == 0U )
+    for( ;; )
     {
-        hmsc->bot_state = USBD_BOT_LAST_DATA_IN;
+        if( ( hmsc->scsi_usb_busy == 0U ) && ( hmsc->scsi_usb_len > 0U ) &&
+                ( hmsc->scsi_buf_count < MSC_MEDIA_BUFFERS ) )
+        {
+            /* Prepare EP to Receive next packet */
+            len = MIN( hmsc->scsi_usb_len, MSC_MEDIA_PACKET );
+
+            hmsc->scsi_buf_len[hmsc->scsi_usb_idx] = ( uint16_t )len;
+            hmsc->scsi_usb_busy = 1U;
+
+            USBD_LL_PrepareReceive( pdev, MSC_EPOUT_ADDR,
+                                    SCSI_MEDIA_BUF( hmsc, hmsc->scsi_usb_idx ), len );
+        }
+        else if( ( hmsc->scsi_media_busy == 0U ) && ( hmsc->scsi_buf_count > 0U ) )
+        {
+            /* After a write error the rest of the data is received and dropped */
+            if( hmsc->scsi_media_error != 0U )
+            {
+                SCSI_WriteDone( hmsc );
+                continue;
+            }
+
+            len = hmsc->scsi_buf_len[hmsc->scsi_media_idx];
+            pbuf = SCSI_MEDIA_BUF( hmsc, hmsc->scsi_media_idx );
+
+            hmsc->scsi_media_busy = 1U;
+
+            if( storage->WriteAsync != NULL )
+            {
+                ret = storage->WriteAsync( lun, pbuf, hmsc->scsi_blk_addr,
+                                           ( uint16_t )( len / hmsc->scsi_blk_size ) );
+            }
+            else
+            {
+                ret = storage->Write( lun, pbuf, hmsc->scsi_blk_addr,
+                                      ( uint16_t )( len / hmsc->scsi_blk_size ) );
+
+                if( ret >= 0 )
+                {
+                    SCSI_WriteDone( hmsc );
+                }
+            }
+
+            if( ret < 0 )
+            {
+                SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, WRITE_FAULT );
+                hmsc->scsi_media_error = 1U;
+                SCSI_WriteDone( hmsc );
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if( ( hmsc->bot_state == USBD_BOT_DATA_OUT ) && ( hmsc->scsi_usb_len == 0U ) &&
+            ( hmsc->scsi_usb_busy == 0U ) && ( hmsc->scsi_buf_count == 0U ) )
+    {
+        MSC_BOT_SendCSW( pdev, ( hmsc->scsi_media_error == 0U ) ?
+                         USBD_CSW_CMD_PASSED : USBD_CSW_CMD_FAILED );
     }
 
     return 0;
@@ -679,38 +1259,120 @@ static int8_t SCSI_ProcessRead( USBD_HandleTypeDef  *pdev, uint8_t lun )
 static int8_t SCSI_ProcessWrite( USBD_HandleTypeDef  *pdev, uint8_t lun )
 {
     USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * ) pdev->pClassData;
-    uint32_t len = hmsc->scsi_blk_len * hmsc->scsi_blk_size;
-
-    len = MIN( len, MSC_MEDIA_PACKET );
 
-    if( ( ( USBD_StorageTypeDef * )pdev->pUserData )->Write( lun, hmsc->bot_data,
-            hmsc->scsi_blk_addr,
-            ( len / hmsc->scsi_blk_size ) ) < 0 )
+    /* A packet has been received, queue its buffer for the media */
+    if( hmsc->scsi_usb_busy != 0U )
     {
-        SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, WRITE_FAULT );
-
-        return -1;
+        hmsc->scsi_usb_len -= hmsc->scsi_buf_len[hmsc->scsi_usb_idx];
+        hmsc->scsi_usb_busy = 0U;
+        hmsc->scsi_buf_count++;
+        hmsc->scsi_usb_idx = SCSI_NEXT_BUF( hmsc->scsi_usb_idx );
     }
 
-    hmsc->scsi_blk_addr += ( len / hmsc->scsi_blk_size );
-    hmsc->scsi_blk_len -= ( len / hmsc->scsi_blk_size );
+    return SCSI_WritePipeline( pdev, lun );
+}
+
+/**
+* @brief  SCSI_ProcessUnmap
+*         Unmap the block ranges of the received parameter list
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_ProcessUnmap( USBD_HandleTypeDef  *pdev, uint8_t lun )
+{
+    USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
+    uint8_t *pDesc;
+    uint32_t len;
+    uint32_t desc_len;
+    uint32_t blk_addr;
+    uint32_t blk_nbr;
+    uint32_t i;
+    uint8_t pass;
+
+    len = MIN( USBD_LL_GetRxDataSize( pdev, MSC_EPOUT_ADDR ), hmsc->cbw.dDataLength );
 
     /* case 12 : Ho = Do */
     hmsc->csw.dDataResidue -= len;
 
-    if( hmsc->scsi_blk_len == 0U )
+    desc_len = 0U;
+
+    if( len >= UNMAP_PARAM_HEADER_LEN )
     {
-        MSC_BOT_SendCSW( pdev, USBD_CSW_CMD_PASSED );
+        desc_len = ( ( uint32_t )hmsc->bot_data[2] << 8 ) | ( uint32_t )hmsc->bot_data[3];
+        desc_len = MIN( desc_len, len - UNMAP_PARAM_HEADER_LEN );
     }
-    else
+
+    /* Check all the ranges first, then unmap them */
+    for( pass = 0U; pass < 2U; pass++ )
     {
-        len = MIN( ( hmsc->scsi_blk_len * hmsc->scsi_blk_size ), MSC_MEDIA_PACKET );
-        /* Prepare EP to Receive next packet */
-        USBD_LL_PrepareReceive( pdev, MSC_EPOUT_ADDR, hmsc->bot_data, len );
+        for( i = 0U; ( i + UNMAP_BLOCK_DESC_LEN ) <= desc_len; i += UNMAP_BLOCK_DESC_LEN )
+        {
+            pDesc = &hmsc->bot_data[UNMAP_PARAM_HEADER_LEN + i];
+
+            blk_addr = ( ( uint32_t )pDesc[4] << 24 ) |
+                       ( ( uint32_t )pDesc[5] << 16 ) |
+                       ( ( uint32_t )pDesc[6] <<  8 ) |
+                       ( uint32_t )pDesc[7];
+
+            blk_nbr = ( ( uint32_t )pDesc[8] << 24 ) |
+                      ( ( uint32_t )pDesc[9] << 16 ) |
+                      ( ( uint32_t )pDesc[10] <<  8 ) |
+                      ( uint32_t )pDesc[11];
+
+            if( pass == 0U )
+            {
+                /* Only the low 32 bits of the LBA are addressable */
+                if( ( pDesc[0] | pDesc[1] | pDesc[2] | pDesc[3] ) != 0U )
+                {
+                    SCSI_SenseCode( pdev, lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+                    return -1;
+                }
+
+                if( SCSI_CheckAddressRange( pdev, lun, blk_addr, blk_nbr ) < 0 )
+                {
+                    return -1; /* error */
+                }
+            }
+            else if( ( blk_nbr > 0U ) &&
+                     ( ( ( USBD_StorageTypeDef * )pdev->pUserData )->Trim( lun, blk_addr, blk_nbr ) < 0 ) )
+            {
+                SCSI_SenseCode( pdev, lun, HARDWARE_ERROR, WRITE_FAULT );
+                return -1;
+            }
+        }
     }
 
+    MSC_BOT_SendCSW( pdev, USBD_CSW_CMD_PASSED );
+
     return 0;
 }
+
+/**
+* @brief  SCSI_WriteCplt
+*         Handle the end of an asynchronous media write
+* @param  status: 0 if the data were written, negative on error
+* @retval None
+*/
+void SCSI_WriteCplt( USBD_HandleTypeDef  *pdev, int8_t status )
+{
+    USBD_MSC_BOT_HandleTypeDef *hmsc = ( USBD_MSC_BOT_HandleTypeDef * )pdev->pClassData;
+
+    /* Ignore the completion of a write the host has given up on */
+    if( ( hmsc->scsi_media_busy == 0U ) || ( hmsc->bot_state != USBD_BOT_DATA_OUT ) )
+    {
+        hmsc->scsi_media_busy = 0U;
+        return;
+    }
+
+    if( status < 0 )
+    {
+        SCSI_SenseCode( pdev, hmsc->cbw.bLUN, HARDWARE_ERROR, WRITE_FAULT );
+        hmsc->scsi_media_error = 1U;
+    }
+
+    SCSI_WriteDone( hmsc );
+    ( void )SCSI_WritePipeline( pdev, hmsc->cbw.bLUN );
+}
 /**
   * @}
   */
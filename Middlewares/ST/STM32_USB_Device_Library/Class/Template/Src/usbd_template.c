@@ -242,6 +242,9 @@ static uint8_t  USBD_TEMPLATE_Setup( USBD_HandleTypeDef *pdev,
     case USB_REQ_TYPE_STANDARD:
         switch( req->bRequest )
         {
+        case USB_REQ_CLEAR_FEATURE:
+            break;
+
         default:
             USBD_CtlError( pdev, req );
             ret = USBD_FAIL;
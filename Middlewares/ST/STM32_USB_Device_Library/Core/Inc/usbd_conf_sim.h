@@ -0,0 +1,284 @@
+/**
+  ******************************************************************************
+  * @file    usbd_conf_sim.h
+  * @author  MCD Application Team
+  * @brief   Header file for the usbd_conf_sim.c file: host-side simulated
+  *          low level driver and host model.
+  *
+  *          The simulator replaces usbd_conf.c and the PCD driver on a
+  *          development host, so the core and the class drivers run without
+  *          a board. To build a simulation:
+  *           - copy usbd_conf_template.h to usbd_conf.h and include this file
+  *             instead of the HAL header,
+  *           - compile usbd_core.c, usbd_ctlreq.c, usbd_ioreq.c, the class
+  *             driver(s), a usbd_desc.c, usbd_conf_sim.c and a host script.
+  *          The host script initializes the device as an application would
+  *          (USBD_Init, USBD_RegisterClass, USBD_Start), then drives the bus
+  *          through the USBD_SIM_xxx functions below. The scripts and the
+  *          Makefile of Middlewares/ST/STM32_USB_Device_Library/Sim are
+  *          examples.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_CONF_SIM_H
+#define __USBD_CONF_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_CONF_SIM
+  * @brief Simulated low level driver
+  * @{
+  */
+
+/** @defgroup USBD_CONF_SIM_Exported_Defines
+  * @{
+  */
+#ifndef __IO
+#define __IO                                  volatile
+#endif /* __IO */
+
+#ifndef UNUSED
+#define UNUSED(X)                             (void)X
+#endif /* UNUSED */
+
+/* Number of endpoints per direction, endpoint 0 included: hpcd.Init.dev_endpoints */
+#ifndef USBD_SIM_MAX_EP
+#define USBD_SIM_MAX_EP                       8U
+#endif /* USBD_SIM_MAX_EP */
+
+/* Packet memory, as on the STM32L1 USB peripheral. The buffer descriptor
+   table takes 8 bytes per endpoint (USBD_SIM_MAX_EP of them), as allocated
+   by HAL_PCDEx_PMAAlloc; isochronous endpoints are double-buffered */
+#ifndef USBD_SIM_PMA_SIZE
+#define USBD_SIM_PMA_SIZE                     512U
+#endif /* USBD_SIM_PMA_SIZE */
+
+/* Bus bytes in one full-speed frame: 12 Mbit/s over 1 ms */
+#ifndef USBD_SIM_FRAME_BYTES
+#define USBD_SIM_FRAME_BYTES                  1500U
+#endif /* USBD_SIM_FRAME_BYTES */
+
+/* Frames a synchronous control request or transfer may take */
+#ifndef USBD_SIM_TIMEOUT_FRAMES
+#define USBD_SIM_TIMEOUT_FRAMES               1000U
+#endif /* USBD_SIM_TIMEOUT_FRAMES */
+
+/* Protocol overhead per transaction in bus bytes (USB 2.0, 5.6.3 to 5.8.3):
+   token, data packet framing, handshake and inter-packet delays */
+#define USBD_SIM_OVERHEAD_CTRL                13U
+#define USBD_SIM_OVERHEAD_BULK                13U
+#define USBD_SIM_OVERHEAD_INTR                13U
+#define USBD_SIM_OVERHEAD_ISOC                9U
+#define USBD_SIM_OVERHEAD_NAK                 6U
+
+/* USBD_SIM_Submit flags */
+#define USBD_SIM_XFER_ZLP                     0x01U  /* OUT: end a transfer of a
+                                                        multiple of the packet
+                                                        size with a ZLP */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CONF_SIM_Exported_Types
+  * @{
+  */
+typedef enum
+{
+    USBD_SIM_OK = 0U,
+    USBD_SIM_STALL,
+    USBD_SIM_TIMEOUT,
+    USBD_SIM_ERROR,
+} USBD_SIM_StatusTypeDef;
+
+typedef enum
+{
+    USBD_SIM_PIPE_IDLE = 0U,
+    USBD_SIM_PIPE_BUSY,
+    USBD_SIM_PIPE_DONE,
+    USBD_SIM_PIPE_STALL,
+} USBD_SIM_PipeStateTypeDef;
+
+typedef struct
+{
+    uint32_t  packets;          /* Transactions carrying data, ZLPs included */
+    uint32_t  bytes;            /* Payload bytes */
+    uint32_t  naks;             /* Tokens NAKed because the endpoint was not armed */
+    uint32_t  stalls;           /* Tokens answered with STALL */
+    uint32_t  missed;           /* Isochronous frames with no transfer armed */
+    uint32_t  errors;           /* Stack misuse: re-arm while busy, overrun */
+    uint32_t  xfers;            /* Transfer completions reported to the stack */
+    uint64_t  cpu_ns;           /* CPU time spent in those stack callbacks */
+    uint32_t  cpu_max_ns;
+} USBD_SIM_EPStatsTypeDef;
+
+struct _USBD_SIM_Handle;
+
+typedef void ( *USBD_SIM_XferCpltCallbackTypeDef )( struct _USBD_SIM_Handle *hsim,
+        uint8_t ep_addr, uint32_t length );
+
+typedef void ( *USBD_SIM_TickCallbackTypeDef )( struct _USBD_SIM_Handle *hsim,
+        uint64_t time_us );
+
+typedef struct
+{
+    uint8_t   num;
+    uint8_t   is_in;
+    uint8_t   is_open;
+    uint8_t   is_stall;
+    uint8_t   type;
+    uint16_t  maxpacket;
+    uint16_t  pmasize;          /* Packet memory taken by the endpoint */
+
+    /* Device side transfer, as armed by the stack */
+    uint8_t   *xfer_buff;
+    uint32_t  xfer_len;
+    uint32_t  xfer_count;
+    uint8_t   armed;
+
+    /* Host side pipe */
+    uint8_t   *pipe_buff;
+    uint32_t  pipe_len;
+    uint32_t  pipe_count;
+    uint8_t   pipe_zlp;
+    uint8_t   pipe_state;
+    uint8_t   interval;         /* Interrupt and isochronous pipes, in frames */
+    USBD_SIM_XferCpltCallbackTypeDef XferCplt;
+
+    USBD_SIM_EPStatsTypeDef stats;
+} USBD_SIM_EPTypeDef;
+
+typedef struct _USBD_SIM_Handle
+{
+    USBD_SIM_EPTypeDef  IN_ep[USBD_SIM_MAX_EP];
+    USBD_SIM_EPTypeDef  OUT_ep[USBD_SIM_MAX_EP];
+    void                *pData;         /* USBD_HandleTypeDef */
+
+    uint8_t             started;
+    uint8_t             connected;
+    uint8_t             suspended;
+    uint8_t             address;
+    uint8_t             pending_address;
+
+    uint32_t            frame;          /* Frames run since USBD_LL_Init */
+    uint32_t            budget;         /* Bus bytes left in the current frame */
+    uint8_t             in_frame;
+    uint32_t            busy_us;        /* Device CPU time still to run with the
+                                           USB interrupt masked */
+    uint32_t            busy_frames;    /* Frames the device missed entirely */
+    USBD_SIM_TickCallbackTypeDef Tick;
+    uint32_t            frames;         /* Frames counted in the statistics */
+    uint64_t            bus_bytes;      /* Bus bytes, overhead included */
+    uint64_t            data_bytes;     /* Payload bytes, all endpoints */
+    uint32_t            frame_max;      /* Payload bytes in the busiest frame */
+    USBD_SIM_EPStatsTypeDef sof;        /* SOF callback time */
+
+    uint16_t            pma_used;
+    uint16_t            pma_peak;
+    uint32_t            pma_overflow;   /* OpenEP calls that did not fit */
+    uint32_t            system_resets;  /* NVIC_SystemReset calls */
+
+    /* Control pipe */
+    uint8_t             setup[8];
+    uint8_t             ctrl_stage;
+    uint8_t             ctrl_status;
+    uint8_t             *ctrl_buff;
+    uint16_t            ctrl_len;
+    uint16_t            ctrl_count;
+} USBD_SIM_HandleTypeDef;
+
+/* Classes reading the endpoint sizes from the PCD handle see the simulator */
+typedef USBD_SIM_HandleTypeDef PCD_HandleTypeDef;
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CONF_SIM_Exported_Variables
+  * @{
+  */
+extern USBD_SIM_HandleTypeDef hsim_usb;
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CONF_SIM_Exported_FunctionsPrototype
+  * @{
+  */
+void                    USBD_SIM_Connect( USBD_SIM_HandleTypeDef *hsim );
+void                    USBD_SIM_Disconnect( USBD_SIM_HandleTypeDef *hsim );
+void                    USBD_SIM_Suspend( USBD_SIM_HandleTypeDef *hsim );
+void                    USBD_SIM_Resume( USBD_SIM_HandleTypeDef *hsim );
+void                    USBD_SIM_RunFrames( USBD_SIM_HandleTypeDef *hsim,
+        uint32_t nframes );
+
+USBD_SIM_StatusTypeDef  USBD_SIM_Control( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t bmRequest, uint8_t bRequest,
+        uint16_t wValue, uint16_t wIndex,
+        uint8_t *pbuf, uint16_t *plength );
+USBD_SIM_StatusTypeDef  USBD_SIM_Enumerate( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t cfgidx );
+
+void                    USBD_SIM_SetPipe( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t ep_addr, uint8_t interval,
+        USBD_SIM_XferCpltCallbackTypeDef XferCplt );
+USBD_SIM_StatusTypeDef  USBD_SIM_Submit( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t ep_addr, uint8_t *pbuf,
+        uint32_t length, uint8_t flags );
+USBD_SIM_StatusTypeDef  USBD_SIM_Transfer( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t ep_addr, uint8_t *pbuf,
+        uint32_t length, uint8_t flags,
+        uint32_t *pactual );
+
+void                    USBD_SIM_SetTick( USBD_SIM_HandleTypeDef *hsim,
+        USBD_SIM_TickCallbackTypeDef Tick );
+uint64_t                USBD_SIM_GetTime( USBD_SIM_HandleTypeDef *hsim );
+void                    USBD_SIM_Busy( USBD_SIM_HandleTypeDef *hsim, uint32_t time_us );
+
+void                    USBD_SIM_ResetStats( USBD_SIM_HandleTypeDef *hsim );
+void                    USBD_SIM_PrintStats( USBD_SIM_HandleTypeDef *hsim );
+
+void                    NVIC_SystemReset( void );
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBD_CONF_SIM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
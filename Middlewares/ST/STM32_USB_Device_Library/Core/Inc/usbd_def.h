@@ -123,7 +123,11 @@ extern "C" {
 
 #define USB_HS_MAX_PACKET_SIZE                          512U
 #define USB_FS_MAX_PACKET_SIZE                          64U
+/* Control endpoint packet size: 8, 16, 32 or 64, may be lowered in
+   usbd_conf.h to save packet memory */
+#ifndef USB_MAX_EP0_SIZE
 #define USB_MAX_EP0_SIZE                                64U
+#endif /* USB_MAX_EP0_SIZE */
 
 /*  Device Status */
 #define USBD_STATE_DEFAULT                              0x01U
@@ -0,0 +1,1480 @@
+/**
+  ******************************************************************************
+  * @file    usbd_conf_sim.c
+  * @author  MCD Application Team
+  * @brief   Host-side simulated low level driver and host model.
+  *
+  *          The USBD_LL_xxx functions emulate the STM32L1 USB peripheral as the
+  *          PCD driver exposes it to the stack: per-packet completions on
+  *          endpoint 0, multi-packet transfers on the other endpoints, packet
+  *          memory allocation and STALL/NAK handshakes.
+  *
+  *          The host model runs the bus frame by frame. Each frame starts with
+  *          a SOF, then serves the periodic pipes due in that frame, the
+  *          control pipe and the bulk pipes in turn, within the full-speed
+  *          frame budget. A NAKed bulk pipe is polled again after the other
+  *          pipes as long as the frame has time left; a NAKed control stage
+  *          is retried in the next frame.
+  *          Every stack callback is timed with the thread CPU clock;
+  *          USBD_SIM_PrintStats reports bytes per frame and CPU time per
+  *          transfer for each endpoint.
+  *
+  *          The callbacks run on the host thread: stack code executes
+  *          instantly in bus time, and host completion callbacks must not
+  *          run frames themselves. Bus time is kept in us: the Tick callback
+  *          is called before every transaction, so a script can model
+  *          timers and media completions, and USBD_SIM_Busy accounts the
+  *          time the device spends with the USB interrupt masked (blocking
+  *          media accesses, USBD_LL_Delay).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_core.h"
+#include "usbd_conf_sim.h"
+#include <time.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define USBD_SIM_CTRL_IDLE              0U
+#define USBD_SIM_CTRL_SETUP             1U
+#define USBD_SIM_CTRL_DATA_IN           2U
+#define USBD_SIM_CTRL_DATA_OUT          3U
+#define USBD_SIM_CTRL_STATUS_IN         4U
+#define USBD_SIM_CTRL_STATUS_OUT        5U
+#define USBD_SIM_CTRL_DONE              6U
+
+#define USBD_SIM_BTABLE_SIZE            ( 8U * USBD_SIM_MAX_EP )
+
+/* Outcome of one transaction */
+#define USBD_SIM_PKT_NONE               0U  /* Not enough bus time left */
+#define USBD_SIM_PKT_DATA               1U  /* Data moved */
+#define USBD_SIM_PKT_HANDSHAKE          2U  /* NAK, STALL or missed isochronous frame */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+USBD_SIM_HandleTypeDef hsim_usb;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t USBD_SIM_Clock( void );
+static void     USBD_SIM_Account( USBD_SIM_EPStatsTypeDef *stats, uint64_t start );
+static USBD_SIM_EPTypeDef *USBD_SIM_GetEP( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr );
+static void     USBD_SIM_UpdatePMA( USBD_SIM_HandleTypeDef *hsim );
+static void     USBD_SIM_Tick( USBD_SIM_HandleTypeDef *hsim );
+static uint8_t  USBD_SIM_Spend( USBD_SIM_HandleTypeDef *hsim, uint32_t overhead, uint32_t length );
+static void     USBD_SIM_DataIn( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep );
+static void     USBD_SIM_DataOut( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep );
+static void     USBD_SIM_PipeDone( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep, uint8_t state );
+static uint8_t  USBD_SIM_InPacket( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep );
+static uint8_t  USBD_SIM_OutPacket( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep );
+static uint8_t  USBD_SIM_CtrlPacket( USBD_SIM_HandleTypeDef *hsim );
+static void     USBD_SIM_Frame( USBD_SIM_HandleTypeDef *hsim );
+static void     USBD_SIM_PrintEP( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep );
+
+/* Private functions ---------------------------------------------------------*/
+
+/*******************************************************************************
+                       LL Driver Interface (USB Device Library --> PCD)
+*******************************************************************************/
+/**
+  * @brief  Initializes the Low Level portion of the Device driver.
+  * @param  pdev: Device handle
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_Init( USBD_HandleTypeDef *pdev )
+{
+    uint8_t i;
+
+    ( void )memset( &hsim_usb, 0, sizeof( hsim_usb ) );
+
+    for( i = 0U; i < USBD_SIM_MAX_EP; i++ )
+    {
+        hsim_usb.IN_ep[i].num = i;
+        hsim_usb.IN_ep[i].is_in = 1U;
+        hsim_usb.IN_ep[i].interval = 1U;
+        hsim_usb.OUT_ep[i].num = i;
+        hsim_usb.OUT_ep[i].interval = 1U;
+    }
+
+    /* Link the simulator and the stack */
+    hsim_usb.pData = pdev;
+    pdev->pData = &hsim_usb;
+
+    USBD_SIM_UpdatePMA( &hsim_usb );
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  De-Initializes the Low Level portion of the Device driver.
+  * @param  pdev: Device handle
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_DeInit( USBD_HandleTypeDef *pdev )
+{
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    hsim_usb.started = 0U;
+    hsim_usb.connected = 0U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Starts the Low Level portion of the Device driver: the device
+  *         now answers a bus reset from USBD_SIM_Connect.
+  * @param  pdev: Device handle
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_Start( USBD_HandleTypeDef *pdev )
+{
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    hsim_usb.started = 1U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Stops the Low Level portion of the Device driver.
+  * @param  pdev: Device handle
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_Stop( USBD_HandleTypeDef *pdev )
+{
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    hsim_usb.started = 0U;
+    hsim_usb.connected = 0U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Opens an endpoint of the Low Level Driver.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @param  ep_type: Endpoint Type
+  * @param  ep_mps: Endpoint Max Packet Size
+  * @retval USBD Status: USBD_FAIL if the packet memory is exhausted
+  */
+USBD_StatusTypeDef USBD_LL_OpenEP( USBD_HandleTypeDef *pdev,
+                                   uint8_t ep_addr,
+                                   uint8_t ep_type,
+                                   uint16_t ep_mps )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( ep == NULL )
+    {
+        return USBD_FAIL;
+    }
+
+    ep->is_open = 1U;
+    ep->is_stall = 0U;
+    ep->armed = 0U;
+    ep->type = ep_type;
+    ep->maxpacket = ep_mps;
+    /* Reception buffers above 62 bytes are counted in blocks of 32 bytes */
+    if( ( ( ep_addr & 0x80U ) == 0U ) && ( ep_mps > 62U ) )
+    {
+        ep->pmasize = ( uint16_t )( ( ep_mps + 31U ) & ~31U );
+    }
+    else
+    {
+        ep->pmasize = ( uint16_t )( ( ep_mps + 1U ) & ~1U );
+    }
+
+    if( ep_type == USBD_EP_TYPE_ISOC )
+    {
+        ep->pmasize *= 2U;
+    }
+
+    USBD_SIM_UpdatePMA( &hsim_usb );
+
+    if( hsim_usb.pma_used > USBD_SIM_PMA_SIZE )
+    {
+        hsim_usb.pma_overflow++;
+        USBD_ErrLog( "USBD_SIM: EP 0x%02X does not fit in the PMA (%u > %u)",
+                     ep_addr, hsim_usb.pma_used, USBD_SIM_PMA_SIZE );
+        return USBD_FAIL;
+    }
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Closes an endpoint of the Low Level Driver.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_CloseEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( ep == NULL )
+    {
+        return USBD_FAIL;
+    }
+
+    ep->is_open = 0U;
+    ep->armed = 0U;
+    USBD_SIM_UpdatePMA( &hsim_usb );
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Flushes an endpoint of the Low Level Driver.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_FlushEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+    /* Prevent unused arguments compilation warning */
+    UNUSED( pdev );
+    UNUSED( ep_addr );
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Sets a Stall condition on an endpoint of the Low Level Driver.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_StallEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( ep == NULL )
+    {
+        return USBD_FAIL;
+    }
+
+    ep->is_stall = 1U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Clears a Stall condition on an endpoint of the Low Level Driver.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_ClearStallEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( ep == NULL )
+    {
+        return USBD_FAIL;
+    }
+
+    ep->is_stall = 0U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Returns Stall condition.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @retval Stall (1: Yes, 0: No)
+  */
+uint8_t USBD_LL_IsStallEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    return ( ep != NULL ) ? ep->is_stall : 0U;
+}
+
+/**
+  * @brief  Assigns a USB address to the device. As on the hardware, a non
+  *         zero address is applied once the status stage is sent.
+  * @param  pdev: Device handle
+  * @param  dev_addr: Endpoint Number
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_SetUSBAddress( USBD_HandleTypeDef *pdev, uint8_t dev_addr )
+{
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( dev_addr == 0U )
+    {
+        hsim_usb.address = 0U;
+    }
+    else
+    {
+        hsim_usb.pending_address = dev_addr;
+    }
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Transmits data over an endpoint. Endpoint 0 sends one packet per
+  *         call, as the PCD driver does.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @param  pbuf: Pointer to data to be sent
+  * @param  size: Data size
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_Transmit( USBD_HandleTypeDef *pdev,
+                                     uint8_t ep_addr,
+                                     uint8_t *pbuf,
+                                     uint16_t size )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr | 0x80U );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( ep == NULL )
+    {
+        return USBD_FAIL;
+    }
+
+    if( ( ep->armed != 0U ) && ( ep->num != 0U ) )
+    {
+        ep->stats.errors++;
+        USBD_ErrLog( "USBD_SIM: EP 0x%02X armed while busy", ep_addr );
+    }
+
+    ep->xfer_buff = pbuf;
+    ep->xfer_len = ( ep->num == 0U ) ? MIN( size, ep->maxpacket ) : size;
+    ep->xfer_count = 0U;
+    ep->armed = 1U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Prepares an endpoint for reception.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @param  pbuf: Pointer to data to be received
+  * @param  size: Data size
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_PrepareReceive( USBD_HandleTypeDef *pdev,
+        uint8_t ep_addr,
+        uint8_t *pbuf,
+        uint16_t size )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr & 0x7FU );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    if( ep == NULL )
+    {
+        return USBD_FAIL;
+    }
+
+    ep->xfer_buff = pbuf;
+    ep->xfer_len = size;
+    ep->xfer_count = 0U;
+    ep->armed = 1U;
+
+    return USBD_OK;
+}
+
+/**
+  * @brief  Returns the last transferred packet size.
+  * @param  pdev: Device handle
+  * @param  ep_addr: Endpoint Number
+  * @retval Received Data Size
+  */
+uint32_t USBD_LL_GetRxDataSize( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( &hsim_usb, ep_addr & 0x7FU );
+
+    /* Prevent unused argument compilation warning */
+    UNUSED( pdev );
+
+    return ( ep != NULL ) ? ep->xfer_count : 0U;
+}
+
+/**
+  * @brief  Delays routine for the USB Device Library: the device is busy,
+  *         the bus goes on.
+  * @param  Delay: Delay in ms
+  * @retval None
+  */
+void USBD_LL_Delay( uint32_t Delay )
+{
+    USBD_SIM_Busy( &hsim_usb, Delay * 1000U );
+}
+
+/**
+  * @brief  System reset requested by a class (DFU manifestation): counted,
+  *         and the device drops off the bus.
+  * @retval None
+  */
+__weak void NVIC_SystemReset( void )
+{
+    hsim_usb.system_resets++;
+    hsim_usb.connected = 0U;
+}
+
+/*******************************************************************************
+                       Host model
+*******************************************************************************/
+/**
+  * @brief  Attaches the device and resets the bus, at full speed.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+void USBD_SIM_Connect( USBD_SIM_HandleTypeDef *hsim )
+{
+    uint8_t i;
+
+    if( hsim->started == 0U )
+    {
+        return;
+    }
+
+    for( i = 0U; i < USBD_SIM_MAX_EP; i++ )
+    {
+        hsim->IN_ep[i].armed = 0U;
+        hsim->IN_ep[i].is_stall = 0U;
+        hsim->IN_ep[i].pipe_state = USBD_SIM_PIPE_IDLE;
+        hsim->OUT_ep[i].armed = 0U;
+        hsim->OUT_ep[i].is_stall = 0U;
+        hsim->OUT_ep[i].pipe_state = USBD_SIM_PIPE_IDLE;
+    }
+
+    hsim->connected = 1U;
+    hsim->suspended = 0U;
+    hsim->address = 0U;
+    hsim->pending_address = 0U;
+    hsim->ctrl_stage = USBD_SIM_CTRL_IDLE;
+
+    ( void )USBD_LL_SetSpeed( ( USBD_HandleTypeDef * )hsim->pData, USBD_SPEED_FULL );
+    ( void )USBD_LL_Reset( ( USBD_HandleTypeDef * )hsim->pData );
+}
+
+/**
+  * @brief  Detaches the device.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+void USBD_SIM_Disconnect( USBD_SIM_HandleTypeDef *hsim )
+{
+    hsim->connected = 0U;
+    ( void )USBD_LL_DevDisconnected( ( USBD_HandleTypeDef * )hsim->pData );
+}
+
+/**
+  * @brief  Suspends the bus: no SOF and no transaction until resumed.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+void USBD_SIM_Suspend( USBD_SIM_HandleTypeDef *hsim )
+{
+    hsim->suspended = 1U;
+    ( void )USBD_LL_Suspend( ( USBD_HandleTypeDef * )hsim->pData );
+}
+
+/**
+  * @brief  Resumes the bus.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+void USBD_SIM_Resume( USBD_SIM_HandleTypeDef *hsim )
+{
+    hsim->suspended = 0U;
+    ( void )USBD_LL_Resume( ( USBD_HandleTypeDef * )hsim->pData );
+}
+
+/**
+  * @brief  Runs the bus for a number of frames.
+  * @param  hsim: simulator handle
+  * @param  nframes: number of 1 ms frames
+  * @retval None
+  */
+void USBD_SIM_RunFrames( USBD_SIM_HandleTypeDef *hsim, uint32_t nframes )
+{
+    while( nframes-- > 0U )
+    {
+        USBD_SIM_Frame( hsim );
+    }
+}
+
+/**
+  * @brief  Runs a control request to completion, other pipes keep running.
+  * @param  hsim: simulator handle
+  * @param  bmRequest, bRequest, wValue, wIndex: SETUP packet fields
+  * @param  pbuf: data stage buffer
+  * @param  plength: in: wLength, out: data stage length. NULL: no data stage
+  * @retval status
+  */
+USBD_SIM_StatusTypeDef USBD_SIM_Control( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t bmRequest, uint8_t bRequest,
+        uint16_t wValue, uint16_t wIndex,
+        uint8_t *pbuf, uint16_t *plength )
+{
+    uint16_t length = ( plength != NULL ) ? *plength : 0U;
+    uint32_t frames = 0U;
+
+    if( ( hsim->connected == 0U ) || ( hsim->ctrl_stage != USBD_SIM_CTRL_IDLE ) )
+    {
+        return USBD_SIM_ERROR;
+    }
+
+    hsim->setup[0] = bmRequest;
+    hsim->setup[1] = bRequest;
+    hsim->setup[2] = LOBYTE( wValue );
+    hsim->setup[3] = HIBYTE( wValue );
+    hsim->setup[4] = LOBYTE( wIndex );
+    hsim->setup[5] = HIBYTE( wIndex );
+    hsim->setup[6] = LOBYTE( length );
+    hsim->setup[7] = HIBYTE( length );
+    hsim->ctrl_buff = pbuf;
+    hsim->ctrl_len = length;
+    hsim->ctrl_count = 0U;
+    hsim->ctrl_status = USBD_SIM_OK;
+    hsim->ctrl_stage = USBD_SIM_CTRL_SETUP;
+
+    while( ( hsim->ctrl_stage != USBD_SIM_CTRL_DONE ) && ( frames < USBD_SIM_TIMEOUT_FRAMES ) &&
+            ( hsim->connected != 0U ) )
+    {
+        USBD_SIM_Frame( hsim );
+        frames++;
+    }
+
+    if( plength != NULL )
+    {
+        *plength = hsim->ctrl_count;
+    }
+
+    if( hsim->ctrl_stage != USBD_SIM_CTRL_DONE )
+    {
+        hsim->ctrl_stage = USBD_SIM_CTRL_IDLE;
+        return ( hsim->connected != 0U ) ? USBD_SIM_TIMEOUT : USBD_SIM_ERROR;
+    }
+
+    hsim->ctrl_stage = USBD_SIM_CTRL_IDLE;
+
+    return ( USBD_SIM_StatusTypeDef )hsim->ctrl_status;
+}
+
+/**
+  * @brief  Resets the bus and enumerates the device as a host would:
+  *         device descriptor, SET_ADDRESS, configuration descriptor and
+  *         SET_CONFIGURATION.
+  * @param  hsim: simulator handle
+  * @param  cfgidx: configuration value to select
+  * @retval status
+  */
+USBD_SIM_StatusTypeDef USBD_SIM_Enumerate( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t cfgidx )
+{
+    static uint8_t desc[1024];
+    USBD_SIM_StatusTypeDef ret;
+    uint16_t length;
+
+    USBD_SIM_Connect( hsim );
+
+    length = 64U;
+    ret = USBD_SIM_Control( hsim, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                            ( uint16_t )USB_DESC_TYPE_DEVICE << 8, 0U, desc, &length );
+
+    if( ret == USBD_SIM_OK )
+    {
+        ret = USBD_SIM_Control( hsim, 0x00U, USB_REQ_SET_ADDRESS, 1U, 0U, NULL, NULL );
+    }
+
+    if( ret == USBD_SIM_OK )
+    {
+        length = USB_LEN_DEV_DESC;
+        ret = USBD_SIM_Control( hsim, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                                ( uint16_t )USB_DESC_TYPE_DEVICE << 8, 0U, desc, &length );
+    }
+
+    if( ret == USBD_SIM_OK )
+    {
+        length = USB_LEN_CFG_DESC;
+        ret = USBD_SIM_Control( hsim, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                                ( uint16_t )USB_DESC_TYPE_CONFIGURATION << 8, 0U, desc, &length );
+    }
+
+    if( ret == USBD_SIM_OK )
+    {
+        length = MIN( ( uint16_t )SWAPBYTE( &desc[2] ), ( uint16_t )sizeof( desc ) );
+        ret = USBD_SIM_Control( hsim, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                                ( uint16_t )USB_DESC_TYPE_CONFIGURATION << 8, 0U, desc, &length );
+    }
+
+    if( ret == USBD_SIM_OK )
+    {
+        ret = USBD_SIM_Control( hsim, 0x00U, USB_REQ_SET_CONFIGURATION, cfgidx, 0U, NULL, NULL );
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  Configures a host pipe.
+  * @param  hsim: simulator handle
+  * @param  ep_addr: endpoint address
+  * @param  interval: polling period of an interrupt or isochronous pipe, frames
+  * @param  XferCplt: called when a submitted transfer completes, may submit
+  *         the next one. NULL: none
+  * @retval None
+  */
+void USBD_SIM_SetPipe( USBD_SIM_HandleTypeDef *hsim,
+                       uint8_t ep_addr, uint8_t interval,
+                       USBD_SIM_XferCpltCallbackTypeDef XferCplt )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( hsim, ep_addr );
+
+    if( ep != NULL )
+    {
+        ep->interval = ( interval != 0U ) ? interval : 1U;
+        ep->XferCplt = XferCplt;
+    }
+}
+
+/**
+  * @brief  Queues a host transfer on a pipe. An IN transfer ends on a short
+  *         packet or when length bytes are read; an isochronous transfer
+  *         carries one packet.
+  * @param  hsim: simulator handle
+  * @param  ep_addr: endpoint address
+  * @param  pbuf: host buffer. NULL on IN: data is counted and discarded
+  * @param  length: transfer length
+  * @param  flags: USBD_SIM_XFER_ZLP
+  * @retval status: USBD_SIM_ERROR if the pipe is busy
+  */
+USBD_SIM_StatusTypeDef USBD_SIM_Submit( USBD_SIM_HandleTypeDef *hsim,
+                                        uint8_t ep_addr, uint8_t *pbuf,
+                                        uint32_t length, uint8_t flags )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( hsim, ep_addr );
+
+    if( ( ep == NULL ) || ( ep->num == 0U ) || ( ep->pipe_state == USBD_SIM_PIPE_BUSY ) )
+    {
+        return USBD_SIM_ERROR;
+    }
+
+    ep->pipe_buff = pbuf;
+    ep->pipe_len = length;
+    ep->pipe_count = 0U;
+    ep->pipe_zlp = ( ( flags & USBD_SIM_XFER_ZLP ) != 0U ) ? 1U : 0U;
+    ep->pipe_state = USBD_SIM_PIPE_BUSY;
+
+    return USBD_SIM_OK;
+}
+
+/**
+  * @brief  Runs a host transfer to completion.
+  * @param  hsim: simulator handle
+  * @param  ep_addr: endpoint address
+  * @param  pbuf: host buffer
+  * @param  length: transfer length
+  * @param  flags: USBD_SIM_XFER_ZLP
+  * @param  pactual: bytes transferred, may be NULL
+  * @retval status
+  */
+USBD_SIM_StatusTypeDef USBD_SIM_Transfer( USBD_SIM_HandleTypeDef *hsim,
+        uint8_t ep_addr, uint8_t *pbuf,
+        uint32_t length, uint8_t flags,
+        uint32_t *pactual )
+{
+    USBD_SIM_EPTypeDef *ep = USBD_SIM_GetEP( hsim, ep_addr );
+    USBD_SIM_StatusTypeDef ret;
+    uint32_t frames = 0U;
+
+    ret = USBD_SIM_Submit( hsim, ep_addr, pbuf, length, flags );
+
+    if( ret != USBD_SIM_OK )
+    {
+        return ret;
+    }
+
+    while( ( ep->pipe_state == USBD_SIM_PIPE_BUSY ) && ( frames < USBD_SIM_TIMEOUT_FRAMES ) &&
+            ( hsim->connected != 0U ) )
+    {
+        USBD_SIM_Frame( hsim );
+        frames++;
+    }
+
+    if( pactual != NULL )
+    {
+        *pactual = ep->pipe_count;
+    }
+
+    if( ep->pipe_state == USBD_SIM_PIPE_BUSY )
+    {
+        ep->pipe_state = USBD_SIM_PIPE_IDLE;
+        return USBD_SIM_TIMEOUT;
+    }
+
+    return ( ep->pipe_state == USBD_SIM_PIPE_STALL ) ? USBD_SIM_STALL : USBD_SIM_OK;
+}
+
+/**
+  * @brief  Sets the callback called with the bus time before every
+  *         transaction and at the end of each frame.
+  * @param  hsim: simulator handle
+  * @param  Tick: callback, NULL: none. It may call the stack and
+  *         USBD_SIM_Busy, submit host transfers, but not run frames
+  * @retval None
+  */
+void USBD_SIM_SetTick( USBD_SIM_HandleTypeDef *hsim,
+                       USBD_SIM_TickCallbackTypeDef Tick )
+{
+    hsim->Tick = Tick;
+}
+
+/**
+  * @brief  Returns the bus time.
+  * @param  hsim: simulator handle
+  * @retval time since USBD_LL_Init, in us
+  */
+uint64_t USBD_SIM_GetTime( USBD_SIM_HandleTypeDef *hsim )
+{
+    if( hsim->in_frame == 0U )
+    {
+        return ( uint64_t )hsim->frame * 1000U;
+    }
+
+    return ( ( uint64_t )hsim->frame - 1U ) * 1000U +
+           ( ( uint64_t )( USBD_SIM_FRAME_BYTES - hsim->budget ) * 1000U ) / USBD_SIM_FRAME_BYTES;
+}
+
+/**
+  * @brief  Accounts device CPU time spent with the USB interrupt masked,
+  *         e.g. by a blocking media access. The device misses the bus for
+  *         that long: the rest of the frame, then whole frames, go by
+  *         without SOF or transaction for it.
+  * @param  hsim: simulator handle
+  * @param  time_us: busy time, in us
+  * @retval None
+  */
+void USBD_SIM_Busy( USBD_SIM_HandleTypeDef *hsim, uint32_t time_us )
+{
+    uint64_t bytes = ( ( uint64_t )time_us * USBD_SIM_FRAME_BYTES ) / 1000U;
+
+    if( hsim->in_frame == 0U )
+    {
+        hsim->busy_us += time_us;
+    }
+    else if( bytes <= hsim->budget )
+    {
+        hsim->budget -= ( uint32_t )bytes;
+    }
+    else
+    {
+        hsim->busy_us += time_us - ( ( hsim->budget * 1000U ) / USBD_SIM_FRAME_BYTES );
+        hsim->budget = 0U;
+    }
+}
+
+/**
+  * @brief  Clears the bus and endpoint statistics.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+void USBD_SIM_ResetStats( USBD_SIM_HandleTypeDef *hsim )
+{
+    uint8_t i;
+
+    for( i = 0U; i < USBD_SIM_MAX_EP; i++ )
+    {
+        ( void )memset( &hsim->IN_ep[i].stats, 0, sizeof( USBD_SIM_EPStatsTypeDef ) );
+        ( void )memset( &hsim->OUT_ep[i].stats, 0, sizeof( USBD_SIM_EPStatsTypeDef ) );
+    }
+
+    ( void )memset( &hsim->sof, 0, sizeof( USBD_SIM_EPStatsTypeDef ) );
+    hsim->frames = 0U;
+    hsim->busy_frames = 0U;
+    hsim->bus_bytes = 0U;
+    hsim->data_bytes = 0U;
+    hsim->frame_max = 0U;
+}
+
+/**
+  * @brief  Prints the bus and per endpoint statistics since the last reset.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+void USBD_SIM_PrintStats( USBD_SIM_HandleTypeDef *hsim )
+{
+    uint32_t frames = ( hsim->frames != 0U ) ? hsim->frames : 1U;
+    uint8_t i;
+
+    printf( "USBD_SIM: %u frames (%u busy), %.1f payload B/frame (max %u), bus %.1f%%, "
+            "PMA %u/%u B (peak %u, %u overflow)\n",
+            hsim->frames, hsim->busy_frames, ( double )hsim->data_bytes / frames, hsim->frame_max,
+            100.0 * ( double )hsim->bus_bytes / ( ( double )frames * USBD_SIM_FRAME_BYTES ),
+            hsim->pma_used, USBD_SIM_PMA_SIZE, hsim->pma_peak, hsim->pma_overflow );
+    printf( "  SOF            %9u calls                     %8.2f us/call (max %.2f)\n",
+            hsim->sof.xfers,
+            ( hsim->sof.xfers != 0U ) ? ( double )hsim->sof.cpu_ns / 1000.0 / hsim->sof.xfers : 0.0,
+            hsim->sof.cpu_max_ns / 1000.0 );
+
+    for( i = 0U; i < USBD_SIM_MAX_EP; i++ )
+    {
+        USBD_SIM_PrintEP( hsim, &hsim->OUT_ep[i] );
+        USBD_SIM_PrintEP( hsim, &hsim->IN_ep[i] );
+    }
+}
+
+/**
+  * @brief  Reads the CPU time of the calling thread.
+  * @retval time in ns
+  */
+static uint64_t USBD_SIM_Clock( void )
+{
+    struct timespec ts;
+
+    ( void )clock_gettime( CLOCK_THREAD_CPUTIME_ID, &ts );
+
+    return ( uint64_t )ts.tv_sec * 1000000000U + ( uint64_t )ts.tv_nsec;
+}
+
+/**
+  * @brief  Accounts one stack callback.
+  * @param  stats: endpoint statistics
+  * @param  start: USBD_SIM_Clock value before the callback
+  * @retval None
+  */
+static void USBD_SIM_Account( USBD_SIM_EPStatsTypeDef *stats, uint64_t start )
+{
+    uint64_t elapsed = USBD_SIM_Clock() - start;
+
+    stats->xfers++;
+    stats->cpu_ns += elapsed;
+
+    if( elapsed > stats->cpu_max_ns )
+    {
+        stats->cpu_max_ns = ( uint32_t )elapsed;
+    }
+}
+
+/**
+  * @brief  Returns the endpoint of an address.
+  * @param  hsim: simulator handle
+  * @param  ep_addr: endpoint address
+  * @retval endpoint, NULL if out of range
+  */
+static USBD_SIM_EPTypeDef *USBD_SIM_GetEP( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr )
+{
+    uint8_t num = ep_addr & 0x7FU;
+
+    if( num >= USBD_SIM_MAX_EP )
+    {
+        return NULL;
+    }
+
+    return ( ( ep_addr & 0x80U ) != 0U ) ? &hsim->IN_ep[num] : &hsim->OUT_ep[num];
+}
+
+/**
+  * @brief  Recomputes the packet memory taken by the open endpoints.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+static void USBD_SIM_UpdatePMA( USBD_SIM_HandleTypeDef *hsim )
+{
+    uint32_t used = USBD_SIM_BTABLE_SIZE;
+    uint8_t i;
+
+    for( i = 0U; i < USBD_SIM_MAX_EP; i++ )
+    {
+        used += ( hsim->IN_ep[i].is_open != 0U ) ? hsim->IN_ep[i].pmasize : 0U;
+        used += ( hsim->OUT_ep[i].is_open != 0U ) ? hsim->OUT_ep[i].pmasize : 0U;
+    }
+
+    hsim->pma_used = ( uint16_t )used;
+    hsim->pma_peak = MAX( hsim->pma_peak, hsim->pma_used );
+}
+
+/**
+  * @brief  Calls the Tick callback with the current bus time.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+static void USBD_SIM_Tick( USBD_SIM_HandleTypeDef *hsim )
+{
+    if( hsim->Tick != NULL )
+    {
+        hsim->Tick( hsim, USBD_SIM_GetTime( hsim ) );
+    }
+}
+
+/**
+  * @brief  Takes the bus time of one transaction from the frame budget.
+  * @param  hsim: simulator handle
+  * @param  overhead: protocol overhead, bytes
+  * @param  length: payload, bytes
+  * @retval 1 if it fits in the frame, 0 otherwise
+  */
+static uint8_t USBD_SIM_Spend( USBD_SIM_HandleTypeDef *hsim, uint32_t overhead, uint32_t length )
+{
+    if( ( overhead + length ) > hsim->budget )
+    {
+        hsim->budget = 0U;
+        return 0U;
+    }
+
+    hsim->budget -= overhead + length;
+    hsim->bus_bytes += overhead + length;
+    hsim->data_bytes += length;
+
+    return 1U;
+}
+
+/**
+  * @brief  Completes the device side IN transfer of an endpoint.
+  * @param  hsim: simulator handle
+  * @param  ep: endpoint
+  * @retval None
+  */
+static void USBD_SIM_DataIn( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep )
+{
+    uint64_t start;
+
+    ep->armed = 0U;
+
+    if( ( ep->num == 0U ) && ( ep->xfer_len == 0U ) && ( hsim->pending_address != 0U ) )
+    {
+        hsim->address = hsim->pending_address;
+        hsim->pending_address = 0U;
+    }
+
+    start = USBD_SIM_Clock();
+    ( void )USBD_LL_DataInStage( ( USBD_HandleTypeDef * )hsim->pData, ep->num, ep->xfer_buff );
+    USBD_SIM_Account( &ep->stats, start );
+}
+
+/**
+  * @brief  Completes the device side OUT transfer of an endpoint.
+  * @param  hsim: simulator handle
+  * @param  ep: endpoint
+  * @retval None
+  */
+static void USBD_SIM_DataOut( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep )
+{
+    uint64_t start;
+
+    ep->armed = 0U;
+
+    start = USBD_SIM_Clock();
+    ( void )USBD_LL_DataOutStage( ( USBD_HandleTypeDef * )hsim->pData, ep->num, ep->xfer_buff );
+    USBD_SIM_Account( &ep->stats, start );
+}
+
+/**
+  * @brief  Completes the host transfer of a pipe.
+  * @param  hsim: simulator handle
+  * @param  ep: endpoint
+  * @param  state: USBD_SIM_PIPE_DONE or USBD_SIM_PIPE_STALL
+  * @retval None
+  */
+static void USBD_SIM_PipeDone( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep, uint8_t state )
+{
+    ep->pipe_state = state;
+
+    if( ep->XferCplt != NULL )
+    {
+        ep->XferCplt( hsim, ( ep->is_in != 0U ) ? ( ep->num | 0x80U ) : ep->num, ep->pipe_count );
+    }
+}
+
+/**
+  * @brief  One IN transaction on a bulk, interrupt or isochronous pipe.
+  * @param  hsim: simulator handle
+  * @param  ep: endpoint
+  * @retval USBD_SIM_PKT_xxx
+  */
+static uint8_t USBD_SIM_InPacket( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep )
+{
+    uint32_t overhead = ( ep->type == USBD_EP_TYPE_ISOC ) ? USBD_SIM_OVERHEAD_ISOC : USBD_SIM_OVERHEAD_BULK;
+    uint32_t length;
+    uint32_t room;
+
+    if( ( ep->is_stall != 0U ) || ( ep->armed == 0U ) )
+    {
+        if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_NAK, 0U ) == 0U )
+        {
+            return USBD_SIM_PKT_NONE;
+        }
+
+        if( ep->is_stall != 0U )
+        {
+            ep->stats.stalls++;
+            USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_STALL );
+        }
+        else if( ep->type == USBD_EP_TYPE_ISOC )
+        {
+            ep->stats.missed++;
+            ( void )USBD_LL_IsoINIncomplete( ( USBD_HandleTypeDef * )hsim->pData, ep->num );
+            USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_DONE );
+        }
+        else
+        {
+            ep->stats.naks++;
+        }
+
+        return USBD_SIM_PKT_HANDSHAKE;
+    }
+
+    length = MIN( ep->xfer_len - ep->xfer_count, ep->maxpacket );
+
+    if( USBD_SIM_Spend( hsim, overhead, length ) == 0U )
+    {
+        return USBD_SIM_PKT_NONE;
+    }
+
+    room = MIN( length, ep->pipe_len - ep->pipe_count );
+
+    if( room < length )
+    {
+        /* Babble: more data than the host asked for */
+        ep->stats.errors++;
+    }
+
+    if( ( ep->pipe_buff != NULL ) && ( room != 0U ) )
+    {
+        ( void )memcpy( &ep->pipe_buff[ep->pipe_count], ep->xfer_buff, room );
+    }
+
+    ep->pipe_count += room;
+    ep->xfer_buff += length;
+    ep->xfer_count += length;
+    ep->stats.packets++;
+    ep->stats.bytes += length;
+
+    if( ep->xfer_count >= ep->xfer_len )
+    {
+        USBD_SIM_DataIn( hsim, ep );
+    }
+
+    if( ( ep->type == USBD_EP_TYPE_ISOC ) || ( length < ep->maxpacket ) ||
+            ( ep->pipe_count >= ep->pipe_len ) )
+    {
+        USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_DONE );
+    }
+
+    return USBD_SIM_PKT_DATA;
+}
+
+/**
+  * @brief  One OUT transaction on a bulk, interrupt or isochronous pipe.
+  * @param  hsim: simulator handle
+  * @param  ep: endpoint
+  * @retval USBD_SIM_PKT_xxx
+  */
+static uint8_t USBD_SIM_OutPacket( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep )
+{
+    uint32_t overhead = ( ep->type == USBD_EP_TYPE_ISOC ) ? USBD_SIM_OVERHEAD_ISOC : USBD_SIM_OVERHEAD_BULK;
+    uint32_t length = MIN( ep->pipe_len - ep->pipe_count, ep->maxpacket );
+    uint32_t room;
+
+    if( ( ep->is_stall != 0U ) || ( ( ep->armed == 0U ) && ( ep->type != USBD_EP_TYPE_ISOC ) ) )
+    {
+        /* The data packet goes out before the handshake comes back */
+        if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_NAK + length, 0U ) == 0U )
+        {
+            return USBD_SIM_PKT_NONE;
+        }
+
+        if( ep->is_stall != 0U )
+        {
+            ep->stats.stalls++;
+            USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_STALL );
+        }
+        else
+        {
+            ep->stats.naks++;
+        }
+
+        return USBD_SIM_PKT_HANDSHAKE;
+    }
+
+    if( USBD_SIM_Spend( hsim, overhead, length ) == 0U )
+    {
+        return USBD_SIM_PKT_NONE;
+    }
+
+    ep->pipe_count += length;
+
+    if( ep->armed == 0U )
+    {
+        /* Isochronous data with no buffer armed is lost */
+        ep->stats.missed++;
+        ( void )USBD_LL_IsoOUTIncomplete( ( USBD_HandleTypeDef * )hsim->pData, ep->num );
+        USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_DONE );
+        return USBD_SIM_PKT_HANDSHAKE;
+    }
+
+    room = MIN( length, ep->xfer_len - ep->xfer_count );
+
+    if( room < length )
+    {
+        /* The packet overruns the receive buffer */
+        ep->stats.errors++;
+    }
+
+    if( ( ep->xfer_buff != NULL ) && ( room != 0U ) )
+    {
+        ( void )memcpy( ep->xfer_buff, &ep->pipe_buff[ep->pipe_count - length], room );
+    }
+
+    ep->xfer_buff += room;
+    ep->xfer_count += room;
+    ep->stats.packets++;
+    ep->stats.bytes += length;
+
+    if( ( length < ep->maxpacket ) || ( ep->xfer_count >= ep->xfer_len ) )
+    {
+        USBD_SIM_DataOut( hsim, ep );
+    }
+
+    if( ( ep->type == USBD_EP_TYPE_ISOC ) || ( length < ep->maxpacket ) )
+    {
+        USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_DONE );
+    }
+    else if( ep->pipe_count >= ep->pipe_len )
+    {
+        if( ep->pipe_zlp == 0U )
+        {
+            USBD_SIM_PipeDone( hsim, ep, USBD_SIM_PIPE_DONE );
+        }
+    }
+
+    return USBD_SIM_PKT_DATA;
+}
+
+/**
+  * @brief  One transaction of the control request in progress.
+  * @param  hsim: simulator handle
+  * @retval USBD_SIM_PKT_xxx
+  */
+static uint8_t USBD_SIM_CtrlPacket( USBD_SIM_HandleTypeDef *hsim )
+{
+    USBD_SIM_EPTypeDef *in = &hsim->IN_ep[0];
+    USBD_SIM_EPTypeDef *out = &hsim->OUT_ep[0];
+    USBD_SIM_EPTypeDef *ep = ( ( hsim->ctrl_stage == USBD_SIM_CTRL_DATA_IN ) ||
+                               ( hsim->ctrl_stage == USBD_SIM_CTRL_STATUS_IN ) ) ? in : out;
+    uint64_t start;
+    uint32_t length;
+    uint32_t room;
+
+    if( hsim->ctrl_stage == USBD_SIM_CTRL_SETUP )
+    {
+        if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_CTRL, 8U ) == 0U )
+        {
+            return USBD_SIM_PKT_NONE;
+        }
+
+        /* A SETUP is always accepted; both directions then NAK until armed */
+        in->is_stall = 0U;
+        in->armed = 0U;
+        out->is_stall = 0U;
+        out->armed = 0U;
+        out->stats.packets++;
+        out->stats.bytes += 8U;
+
+        if( hsim->ctrl_len == 0U )
+        {
+            hsim->ctrl_stage = USBD_SIM_CTRL_STATUS_IN;
+        }
+        else
+        {
+            hsim->ctrl_stage = ( ( hsim->setup[0] & 0x80U ) != 0U ) ? USBD_SIM_CTRL_DATA_IN :
+                               USBD_SIM_CTRL_DATA_OUT;
+        }
+
+        start = USBD_SIM_Clock();
+        ( void )USBD_LL_SetupStage( ( USBD_HandleTypeDef * )hsim->pData, hsim->setup );
+        USBD_SIM_Account( &out->stats, start );
+
+        return USBD_SIM_PKT_DATA;
+    }
+
+    if( ( ep->is_stall != 0U ) || ( ep->armed == 0U ) )
+    {
+        if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_NAK, 0U ) == 0U )
+        {
+            return USBD_SIM_PKT_NONE;
+        }
+
+        if( ep->is_stall != 0U )
+        {
+            ep->stats.stalls++;
+            hsim->ctrl_status = USBD_SIM_STALL;
+            hsim->ctrl_stage = USBD_SIM_CTRL_DONE;
+        }
+        else
+        {
+            ep->stats.naks++;
+        }
+
+        return USBD_SIM_PKT_HANDSHAKE;
+    }
+
+    switch( hsim->ctrl_stage )
+    {
+        case USBD_SIM_CTRL_DATA_IN:
+            length = MIN( in->xfer_len - in->xfer_count, in->maxpacket );
+
+            if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_CTRL, length ) == 0U )
+            {
+                return USBD_SIM_PKT_NONE;
+            }
+
+            room = MIN( length, ( uint32_t )hsim->ctrl_len - hsim->ctrl_count );
+
+            if( ( hsim->ctrl_buff != NULL ) && ( room != 0U ) )
+            {
+                ( void )memcpy( &hsim->ctrl_buff[hsim->ctrl_count], in->xfer_buff, room );
+            }
+
+            hsim->ctrl_count += ( uint16_t )room;
+            in->xfer_buff += length;
+            in->xfer_count += length;
+            in->stats.packets++;
+            in->stats.bytes += length;
+
+            if( ( length < in->maxpacket ) || ( hsim->ctrl_count >= hsim->ctrl_len ) )
+            {
+                hsim->ctrl_stage = USBD_SIM_CTRL_STATUS_OUT;
+            }
+
+            if( in->xfer_count >= in->xfer_len )
+            {
+                USBD_SIM_DataIn( hsim, in );
+            }
+            break;
+
+        case USBD_SIM_CTRL_DATA_OUT:
+            length = MIN( ( uint32_t )hsim->ctrl_len - hsim->ctrl_count, out->maxpacket );
+
+            if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_CTRL, length ) == 0U )
+            {
+                return USBD_SIM_PKT_NONE;
+            }
+
+            room = MIN( length, out->xfer_len - out->xfer_count );
+
+            if( room < length )
+            {
+                out->stats.errors++;
+            }
+
+            if( ( out->xfer_buff != NULL ) && ( hsim->ctrl_buff != NULL ) && ( room != 0U ) )
+            {
+                ( void )memcpy( out->xfer_buff, &hsim->ctrl_buff[hsim->ctrl_count], room );
+            }
+
+            hsim->ctrl_count += ( uint16_t )length;
+            out->xfer_buff += room;
+            out->xfer_count += room;
+            out->stats.packets++;
+            out->stats.bytes += length;
+
+            if( hsim->ctrl_count >= hsim->ctrl_len )
+            {
+                hsim->ctrl_stage = USBD_SIM_CTRL_STATUS_IN;
+            }
+
+            /* As the HAL PCD driver, each packet of the data stage is
+               reported: the core counts the rest and re-arms EP0 */
+            USBD_SIM_DataOut( hsim, out );
+            break;
+
+        case USBD_SIM_CTRL_STATUS_IN:
+            if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_CTRL, 0U ) == 0U )
+            {
+                return USBD_SIM_PKT_NONE;
+            }
+
+            in->stats.packets++;
+            hsim->ctrl_stage = USBD_SIM_CTRL_DONE;
+            USBD_SIM_DataIn( hsim, in );
+            break;
+
+        case USBD_SIM_CTRL_STATUS_OUT:
+            if( USBD_SIM_Spend( hsim, USBD_SIM_OVERHEAD_CTRL, 0U ) == 0U )
+            {
+                return USBD_SIM_PKT_NONE;
+            }
+
+            out->stats.packets++;
+            hsim->ctrl_stage = USBD_SIM_CTRL_DONE;
+            USBD_SIM_DataOut( hsim, out );
+            break;
+
+        default:
+            return USBD_SIM_PKT_NONE;
+    }
+
+    return USBD_SIM_PKT_DATA;
+}
+
+/**
+  * @brief  Runs one frame: SOF, periodic pipes, control pipe, bulk pipes.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+static void USBD_SIM_Frame( USBD_SIM_HandleTypeDef *hsim )
+{
+    USBD_SIM_EPTypeDef *ep;
+    uint64_t data_bytes = hsim->data_bytes;
+    uint64_t start;
+    uint8_t progress;
+    uint8_t ret = USBD_SIM_PKT_DATA;
+    uint8_t i;
+    uint8_t n;
+
+    hsim->frame++;
+
+    if( ( hsim->connected == 0U ) || ( hsim->suspended != 0U ) )
+    {
+        return;
+    }
+
+    hsim->frames++;
+    hsim->in_frame = 1U;
+    hsim->budget = USBD_SIM_FRAME_BYTES;
+
+    if( hsim->busy_us >= 1000U )
+    {
+        /* The USB interrupt stays masked for the whole frame: no SOF, and
+           the pipes of the device wait */
+        hsim->busy_us -= 1000U;
+        hsim->busy_frames++;
+        hsim->budget = 0U;
+        USBD_SIM_Tick( hsim );
+        hsim->in_frame = 0U;
+        return;
+    }
+
+    hsim->budget -= ( hsim->busy_us * USBD_SIM_FRAME_BYTES ) / 1000U;
+    hsim->busy_us = 0U;
+
+    USBD_SIM_Tick( hsim );
+
+    start = USBD_SIM_Clock();
+    ( void )USBD_LL_SOF( ( USBD_HandleTypeDef * )hsim->pData );
+    USBD_SIM_Account( &hsim->sof, start );
+
+    /* Periodic pipes due in this frame */
+    for( i = 1U; i < ( 2U * USBD_SIM_MAX_EP ); i++ )
+    {
+        ep = ( ( i & 1U ) != 0U ) ? &hsim->OUT_ep[i >> 1] : &hsim->IN_ep[i >> 1];
+
+        if( ( ep->is_open != 0U ) && ( ep->pipe_state == USBD_SIM_PIPE_BUSY ) &&
+                ( ( ep->type == USBD_EP_TYPE_ISOC ) || ( ep->type == USBD_EP_TYPE_INTR ) ) &&
+                ( ( hsim->frame % ep->interval ) == 0U ) )
+        {
+            USBD_SIM_Tick( hsim );
+            ( void )( ( ep->is_in != 0U ) ? USBD_SIM_InPacket( hsim, ep ) : USBD_SIM_OutPacket( hsim, ep ) );
+        }
+    }
+
+    /* Control pipe, until it NAKs */
+    do
+    {
+        USBD_SIM_Tick( hsim );
+    }
+    while( ( hsim->ctrl_stage != USBD_SIM_CTRL_IDLE ) && ( hsim->ctrl_stage != USBD_SIM_CTRL_DONE ) &&
+            ( USBD_SIM_CtrlPacket( hsim ) == USBD_SIM_PKT_DATA ) );
+
+    /* Bulk pipes, round robin from a different pipe each frame, until the
+       frame is over or no bulk transfer is pending */
+    do
+    {
+        progress = 0U;
+
+        for( n = 0U; ( n < ( 2U * USBD_SIM_MAX_EP ) ) && ( ret != USBD_SIM_PKT_NONE ); n++ )
+        {
+            i = ( uint8_t )( ( hsim->frame + n ) % ( 2U * USBD_SIM_MAX_EP ) );
+            ep = ( ( i & 1U ) != 0U ) ? &hsim->OUT_ep[i >> 1] : &hsim->IN_ep[i >> 1];
+
+            if( ( ep->num != 0U ) && ( ep->is_open != 0U ) && ( ep->type == USBD_EP_TYPE_BULK ) &&
+                    ( ep->pipe_state == USBD_SIM_PIPE_BUSY ) )
+            {
+                USBD_SIM_Tick( hsim );
+                ret = ( ep->is_in != 0U ) ? USBD_SIM_InPacket( hsim, ep ) : USBD_SIM_OutPacket( hsim, ep );
+                progress = 1U;
+            }
+        }
+    }
+    while( ( progress != 0U ) && ( ret != USBD_SIM_PKT_NONE ) );
+
+    /* Idle until the end of the frame */
+    hsim->budget = 0U;
+    USBD_SIM_Tick( hsim );
+    hsim->in_frame = 0U;
+
+    hsim->frame_max = MAX( hsim->frame_max, ( uint32_t )( hsim->data_bytes - data_bytes ) );
+}
+
+/**
+  * @brief  Prints the statistics line of an endpoint that saw traffic.
+  * @param  hsim: simulator handle
+  * @param  ep: endpoint
+  * @retval None
+  */
+static void USBD_SIM_PrintEP( USBD_SIM_HandleTypeDef *hsim, USBD_SIM_EPTypeDef *ep )
+{
+    static const char *const type_name[] = { "CTRL", "ISOC", "BULK", "INTR" };
+    uint32_t frames = ( hsim->frames != 0U ) ? hsim->frames : 1U;
+
+    if( ( ep->stats.packets == 0U ) && ( ep->stats.naks == 0U ) && ( ep->stats.stalls == 0U ) &&
+            ( ep->stats.missed == 0U ) && ( ep->stats.xfers == 0U ) )
+    {
+        return;
+    }
+
+    printf( "  EP 0x%02X %s %4u %9u pkts %10u B %8.1f B/frame %7u NAK %5u STALL %5u miss %3u err"
+            " | %8u xfers %8.2f us/xfer (max %.2f)\n",
+            ( ep->is_in != 0U ) ? ( ep->num | 0x80U ) : ep->num, type_name[ep->type & 3U],
+            ep->maxpacket, ep->stats.packets, ep->stats.bytes, ( double )ep->stats.bytes / frames,
+            ep->stats.naks, ep->stats.stalls, ep->stats.missed, ep->stats.errors, ep->stats.xfers,
+            ( ep->stats.xfers != 0U ) ? ( double )ep->stats.cpu_ns / 1000.0 / ep->stats.xfers : 0.0,
+            ep->stats.cpu_max_ns / 1000.0 );
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
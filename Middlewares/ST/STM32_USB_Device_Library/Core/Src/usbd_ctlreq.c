@@ -320,6 +320,13 @@ USBD_StatusTypeDef  USBD_StdEPReq( USBD_HandleTypeDef *pdev, USBD_SetupReqTypede
                     }
 
                     USBD_CtlSendStatus( pdev );
+
+                    /* Let the class resume its endpoint, e.g. the MSC BOT
+                       reset recovery */
+                    if( ( ep_addr & 0x7FU ) != 0x00U )
+                    {
+                        pdev->pClass->Setup( pdev, req );
+                    }
                 }
 
                 break;
@@ -0,0 +1,37 @@
+/**
+  ******************************************************************************
+  * @file    sim_check.h
+  * @author  MCD Application Team
+  * @brief   Checks of the host-side simulation scripts, for the scripts
+  *          that do not run the device library (sim_common.c).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SIM_CHECK_H
+#define __SIM_CHECK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void SIM_Check( const char *name, uint32_t cond );
+int  SIM_Result( void );
+
+#endif /* __SIM_CHECK_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.h
+  * @author  MCD Application Team
+  * @brief   Header of sim_hal.c: the USB peripheral of the STM32L1 seen by
+  *          the HAL PCD driver on the host.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SIM_HAL_H
+#define __SIM_HAL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef void ( *SIM_HAL_HookTypeDef )( void );
+
+/* Exported constants --------------------------------------------------------*/
+#define SIM_HAL_EP_NUM                8U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Buffer table entries of endpoint ep: ADDR_TX, COUNT_TX, ADDR_RX, COUNT_RX,
+   also the two buffers of a double-buffered endpoint */
+#define SIM_HAL_BTABLE_ADDR0          0U
+#define SIM_HAL_BTABLE_COUNT0         2U
+#define SIM_HAL_BTABLE_ADDR1          4U
+#define SIM_HAL_BTABLE_COUNT1         6U
+
+/* Exported variables --------------------------------------------------------*/
+extern uint16_t SIM_HAL_EPR[SIM_HAL_EP_NUM];
+
+#if (USE_USB_PMA_DMA == 1U)
+extern uint32_t SIM_HAL_DMACopies;
+extern uint8_t  SIM_HAL_DMAFailNext;
+#endif /* USE_USB_PMA_DMA */
+
+/* Exported functions ------------------------------------------------------- */
+void              SIM_HAL_Init( void );
+void              SIM_HAL_Reset( void );
+void              SIM_HAL_EPSet( uint32_t ep, uint16_t value );
+void              SIM_HAL_SetWriteHook( SIM_HAL_HookTypeDef hook );
+volatile uint16_t *SIM_HAL_BTable( uint32_t ep, uint32_t entry );
+void              SIM_HAL_PMAPut( uint16_t addr, const uint8_t *pbuf, uint32_t len );
+void              SIM_HAL_PMAGet( uint16_t addr, uint8_t *pbuf, uint32_t len );
+uint32_t          SIM_HAL_RxCapacity( uint16_t count );
+void              *SIM_HAL_LowAlloc( uint32_t size );
+
+#endif /* __SIM_HAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
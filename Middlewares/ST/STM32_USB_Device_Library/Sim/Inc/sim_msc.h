@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    sim_msc.h
+  * @author  MCD Application Team
+  * @brief   Host side of the Mass Storage Bulk-Only Transport, shared by the
+  *          MSC simulation scripts.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SIM_MSC_H
+#define __SIM_MSC_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_common.h"
+#include "usbd_msc.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#define SIM_MSC_BLOCK_SIZE            512U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+extern uint32_t SIM_MSC_HaltsCleared;   /* CLEAR_FEATURE(ENDPOINT_HALT) sent */
+
+/* Exported functions ------------------------------------------------------- */
+int SIM_MSC_Command( const uint8_t *cb, uint8_t cb_length, uint8_t dir_in,
+                     uint8_t *pbuf, uint32_t length, uint32_t *presidue );
+int SIM_MSC_ReadWrite10( uint8_t write, uint32_t lba, uint16_t blocks,
+                         uint8_t *pbuf, uint32_t *presidue );
+int SIM_MSC_RequestSense( uint8_t *pasc );
+void SIM_MSC_PutBE( uint8_t *p, uint64_t value, uint8_t length );
+
+#endif /* __SIM_MSC_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
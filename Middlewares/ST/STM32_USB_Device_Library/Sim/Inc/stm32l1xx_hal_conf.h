@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    stm32l1xx_hal_conf.h
+  * @author  MCD Application Team
+  * @brief   HAL configuration of the host-side simulations of the USB
+  *          peripheral driver: only the PCD module is built, and the
+  *          endpoint registers go through the register file of sim_hal.c,
+  *          which gives their toggle and clear-only bits the hardware
+  *          behavior. With USE_USB_PMA_DMA, DMA1 is the emulated controller
+  *          of sim_hal.c.
+  *          With SIM_HAL_FLASH, only the FLASH module is declared instead,
+  *          for the Flash media of the DFU script, which runs on the
+  *          simulated low level driver and provides the Flash functions.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32L1xx_HAL_CONF_H
+#define __STM32L1xx_HAL_CONF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/* ########################## Module Selection ############################## */
+#ifdef SIM_HAL_FLASH
+#define HAL_FLASH_MODULE_ENABLED
+#else
+#define HAL_PCD_MODULE_ENABLED
+#endif /* SIM_HAL_FLASH */
+
+/* ########################## Oscillator Values ############################# */
+#define HSE_VALUE                     8000000U
+#define HSE_STARTUP_TIMEOUT           100U
+#define MSI_VALUE                     2097000U
+#define HSI_VALUE                     16000000U
+#define LSI_VALUE                     37000U
+#define LSE_VALUE                     32768U
+#define LSE_STARTUP_TIMEOUT           5000U
+
+/* ########################### System Configuration ######################### */
+#define  VDD_VALUE                    3300U
+#define  TICK_INT_PRIORITY            0x000FU
+#define  USE_RTOS                     0U
+#define  PREFETCH_ENABLE              1U
+#define  USE_HAL_PCD_REGISTER_CALLBACKS         0U
+
+/* ########################## Assert Selection ############################## */
+#define assert_param(expr) ((void)0U)
+
+/* Includes ------------------------------------------------------------------*/
+#ifdef SIM_HAL_FLASH
+#include "stm32l1xx_hal_flash.h"
+
+/* usbd_conf_sim.c provides the system reset, not CMSIS */
+#undef NVIC_SystemReset
+#else
+#include "stm32l1xx_hal_pcd.h"
+
+/* Exported macro ------------------------------------------------------------*/
+/* Endpoint registers of the simulated peripheral */
+uint16_t SIM_HAL_EPRead( uint32_t ep );
+void     SIM_HAL_EPWrite( uint32_t ep, uint16_t value );
+
+#undef PCD_SET_ENDPOINT
+#undef PCD_GET_ENDPOINT
+#define PCD_SET_ENDPOINT(USBx, bEpNum, wRegValue)  SIM_HAL_EPWrite((bEpNum), (uint16_t)(wRegValue))
+#define PCD_GET_ENDPOINT(USBx, bEpNum)             SIM_HAL_EPRead(bEpNum)
+
+#if (USE_USB_PMA_DMA == 1U)
+/* Emulated DMA controller; no interrupt to mask on the host */
+DMA_TypeDef *SIM_HAL_DMA1( void );
+
+#undef DMA1
+#define DMA1                                       SIM_HAL_DMA1()
+#define __get_PRIMASK()                            0U
+#define __set_PRIMASK(priMask)                     ((void)(priMask))
+#define __disable_irq()                            ((void)0U)
+#endif /* USE_USB_PMA_DMA */
+#endif /* SIM_HAL_FLASH */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32L1xx_HAL_CONF_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    usbd_conf.h
+  * @author  MCD Application Team
+  * @brief   USB device library configuration of the host-side simulations.
+  *          Class settings may be overridden from the Makefile (-D).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_CONF_H
+#define __USBD_CONF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_conf_sim.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_CONF
+  * @brief USB device low level driver configuration file
+  * @{
+  */
+
+/** @defgroup USBD_CONF_Exported_Defines
+  * @{
+  */
+
+#define USBD_MAX_NUM_INTERFACES               4U
+#define USBD_MAX_NUM_CONFIGURATION            1U
+#define USBD_MAX_STR_DESC_SIZ                 0x100U
+#define USBD_SUPPORT_USER_STRING              0U
+#define USBD_SELF_POWERED                     1U
+#define USBD_DEBUG_LEVEL                      2U
+
+/* MSC Class Config */
+#ifndef MSC_MEDIA_PACKET
+#define MSC_MEDIA_PACKET                      512U
+#endif /* MSC_MEDIA_PACKET */
+
+/* DFU Class Config */
+#define USBD_DFU_MAX_ITF_NUM                  1U
+#ifndef USBD_DFU_XFER_SIZE
+#define USBD_DFU_XFER_SIZE                    1024U
+#endif /* USBD_DFU_XFER_SIZE */
+#ifndef USBD_DFU_APP_DEFAULT_ADD
+#define USBD_DFU_APP_DEFAULT_ADD              0x08007000U
+#endif /* USBD_DFU_APP_DEFAULT_ADD */
+#ifndef USBD_DFU_APP_END_ADD
+#define USBD_DFU_APP_END_ADD                  0x08020000U
+#endif /* USBD_DFU_APP_END_ADD */
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CONF_Exported_Macros
+  * @{
+  */
+
+/* Memory management macros: allocations are counted by the scripts */
+#define USBD_malloc               SIM_Malloc
+#define USBD_free                 SIM_Free
+#define USBD_memset               memset
+#define USBD_memcpy               memcpy
+#define USBD_Delay                USBD_LL_Delay
+
+/* DEBUG macros */
+#if (USBD_DEBUG_LEVEL > 0U)
+#define  USBD_UsrLog(...)   do { \
+                            printf(__VA_ARGS__); \
+                            printf("\n"); \
+} while (0)
+#else
+#define USBD_UsrLog(...) do {} while (0)
+#endif
+
+#if (USBD_DEBUG_LEVEL > 1U)
+
+#define  USBD_ErrLog(...) do { \
+                            printf("ERROR: ") ; \
+                            printf(__VA_ARGS__); \
+                            printf("\n"); \
+} while (0)
+#else
+#define USBD_ErrLog(...) do {} while (0)
+#endif
+
+#if (USBD_DEBUG_LEVEL > 2U)
+#define  USBD_DbgLog(...)   do { \
+                            printf("DEBUG : ") ; \
+                            printf(__VA_ARGS__); \
+                            printf("\n"); \
+} while (0)
+#else
+#define USBD_DbgLog(...) do {} while (0)
+#endif
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CONF_Exported_FunctionsPrototype
+  * @{
+  */
+void *SIM_Malloc( uint32_t size );
+void  SIM_Free( void *p );
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBD_CONF_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    sim_audio.c
+  * @author  MCD Application Team
+  * @brief   Host script: plays an isochronous stream to the AUDIO class while
+  *          the audio output runs on its own drifting clock, and reports the
+  *          buffer occupancy, the underruns, the overruns and the samples
+  *          lost or repeated. The host paces the stream from the feedback
+  *          endpoint in asynchronous mode, and sends the nominal packet size
+  *          otherwise (USBD_AUDIO_ASYNC=0U).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include "sim_common.h"
+#include "usbd_audio.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    double      ppm;            /* Audio clock offset */
+    double      wander;         /* Amplitude of a slow sine drift, ppm */
+} SIM_AudioCaseTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define AUDIO_CASE_FRAMES             30000U      /* 30 s per case */
+#define AUDIO_SETTLE_FRAMES           5000U       /* Not counted in the occupancy */
+#define AUDIO_WANDER_FRAMES           20000.0     /* Period of the drift */
+#define AUDIO_SAMPLE_BYTES            4U          /* 16-bit stereo */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t Audio_Init( uint32_t AudioFreq, uint32_t Volume, uint32_t options );
+static int8_t Audio_DeInit( uint32_t options );
+static int8_t Audio_PlaybackCmd( uint8_t *pbuf, uint32_t size, uint8_t cmd );
+static int8_t Audio_VolumeCtl( uint8_t vol );
+static int8_t Audio_MuteCtl( uint8_t cmd );
+static int8_t Audio_PeriodicTC( uint8_t cmd );
+static int8_t Audio_GetState( void );
+
+/* Private variables ---------------------------------------------------------*/
+static USBD_AUDIO_ItfTypeDef Audio_fops =
+{
+    Audio_Init,
+    Audio_DeInit,
+    Audio_PlaybackCmd,
+    Audio_VolumeCtl,
+    Audio_MuteCtl,
+    Audio_PeriodicTC,
+    Audio_GetState,
+};
+
+static const SIM_AudioCaseTypeDef Audio_Cases[] =
+{
+    { "clock 0 ppm",             0.0,    0.0 },
+    { "clock +300 ppm",        300.0,    0.0 },
+    { "clock -300 ppm",       -300.0,    0.0 },
+    { "clock +1000 ppm",      1000.0,    0.0 },
+    { "clock -1000 ppm",     -1000.0,    0.0 },
+    { "clock 0 +/-500 ppm",      0.0,  500.0 },
+};
+
+/* Host side */
+static uint8_t  Host_Packet[AUDIO_OUT_MAX_PACKET];
+#if (USBD_AUDIO_ASYNC == 1U)
+static uint8_t  Host_Feedback[AUDIO_FB_PACKET];
+#endif /* USBD_AUDIO_ASYNC */
+static uint32_t Host_FbValue;       /* 10.14 samples per frame */
+static uint32_t Host_FbAcc;
+static uint32_t Host_Samples;       /* Samples sent */
+
+/* Audio output: a circular DMA on the buffer given by AUDIO_CMD_START */
+static const SIM_AudioCaseTypeDef *Dac_Case;
+static uint8_t  *Dac_Buffer;
+static uint32_t Dac_Length;
+static uint32_t Dac_NextLength;
+static uint32_t Dac_Pos;
+static uint8_t  Dac_Running;
+static uint8_t  Dac_First;
+static uint32_t Dac_Expected;
+static uint64_t Dac_LastUs;
+static double   Dac_Acc;
+static uint32_t Dac_Played;
+static uint32_t Dac_Glitches;
+static uint32_t Dac_Trims;
+
+/* Private functions ---------------------------------------------------------*/
+
+static int8_t Audio_Init( uint32_t AudioFreq, uint32_t Volume, uint32_t options )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_DeInit( uint32_t options )
+{
+    Dac_Running = 0U;
+    return ( USBD_OK );
+}
+
+/* As the BSP glue of the examples: play or requeue 2 * size bytes */
+static int8_t Audio_PlaybackCmd( uint8_t *pbuf, uint32_t size, uint8_t cmd )
+{
+    switch( cmd )
+    {
+    case AUDIO_CMD_START:
+        Dac_Buffer = pbuf;
+        Dac_Length = 2U * size;
+        Dac_NextLength = 2U * size;
+        Dac_Pos = 0U;
+        Dac_Running = 1U;
+        break;
+
+    case AUDIO_CMD_PLAY:
+        if( ( 2U * size ) != AUDIO_TOTAL_BUF_SIZE )
+        {
+            Dac_Trims++;
+        }
+
+        Dac_NextLength = 2U * size;
+        break;
+
+    case AUDIO_CMD_STOP:
+        Dac_Running = 0U;
+        break;
+
+    default:
+        break;
+    }
+
+    return ( USBD_OK );
+}
+
+static int8_t Audio_VolumeCtl( uint8_t vol )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_MuteCtl( uint8_t cmd )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_PeriodicTC( uint8_t cmd )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_GetState( void )
+{
+    return ( USBD_OK );
+}
+
+/**
+  * @brief  Audio output clock: plays the samples due since the last call
+  *         and signals the half and full buffer events as the DMA would.
+  *         Each sample must follow the previous one, anything else is a
+  *         glitch: samples lost or repeated.
+  * @param  hsim: simulator handle
+  * @param  time_us: simulated time
+  * @retval None
+  */
+static void Dac_Tick( USBD_SIM_HandleTypeDef *hsim, uint64_t time_us )
+{
+    double ppm = Dac_Case->ppm +
+                 ( Dac_Case->wander * sin( ( 2.0 * M_PI * ( double )hsim->frame ) / AUDIO_WANDER_FRAMES ) );
+    uint32_t sample;
+
+    Dac_Acc += ( ( double )( time_us - Dac_LastUs ) * USBD_AUDIO_FREQ * ( 1.0 + ( ppm * 1e-6 ) ) ) / 1e6;
+    Dac_LastUs = time_us;
+
+    while( Dac_Acc >= 1.0 )
+    {
+        Dac_Acc -= 1.0;
+
+        if( Dac_Running == 0U )
+        {
+            continue;
+        }
+
+        ( void )memcpy( &sample, &Dac_Buffer[Dac_Pos], sizeof( sample ) );
+
+        if( ( Dac_First == 0U ) && ( sample != Dac_Expected ) )
+        {
+            Dac_Glitches++;
+        }
+
+        Dac_First = 0U;
+        Dac_Expected = sample + 1U;
+        Dac_Played++;
+        Dac_Pos += AUDIO_SAMPLE_BYTES;
+
+        if( Dac_Pos == ( Dac_Length / 2U ) )
+        {
+            USBD_AUDIO_Sync( &USBD_Device, AUDIO_OFFSET_HALF );
+        }
+
+        if( Dac_Pos >= Dac_Length )
+        {
+            Dac_Pos = 0U;
+            USBD_AUDIO_Sync( &USBD_Device, AUDIO_OFFSET_FULL );
+            Dac_Length = Dac_NextLength;
+        }
+    }
+}
+
+/**
+  * @brief  Queues the next OUT packet: the samples the feedback asks for,
+  *         or the nominal count. Each sample holds its sequence number.
+  * @param  hsim: simulator handle
+  * @retval None
+  */
+static void Host_SubmitPacket( USBD_SIM_HandleTypeDef *hsim )
+{
+    uint32_t samples;
+    uint32_t i;
+
+#if (USBD_AUDIO_ASYNC == 1U)
+    Host_FbAcc += Host_FbValue;
+    samples = Host_FbAcc >> 14;
+    Host_FbAcc -= samples << 14;
+#else
+    samples = USBD_AUDIO_FREQ / 1000U;
+#endif /* USBD_AUDIO_ASYNC */
+
+    for( i = 0U; i < samples; i++ )
+    {
+        uint32_t sample = Host_Samples + i;
+        ( void )memcpy( &Host_Packet[i * AUDIO_SAMPLE_BYTES], &sample, sizeof( sample ) );
+    }
+
+    Host_Samples += samples;
+    USBD_SIM_Submit( hsim, AUDIO_OUT_EP, Host_Packet, samples * AUDIO_SAMPLE_BYTES, 0U );
+}
+
+static void Host_OutCplt( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr, uint32_t length )
+{
+    Host_SubmitPacket( hsim );
+}
+
+#if (USBD_AUDIO_ASYNC == 1U)
+static void Host_FeedbackCplt( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr, uint32_t length )
+{
+    if( length == AUDIO_FB_PACKET )
+    {
+        Host_FbValue = ( uint32_t )Host_Feedback[0] | ( ( uint32_t )Host_Feedback[1] << 8 ) |
+                       ( ( uint32_t )Host_Feedback[2] << 16 );
+    }
+
+    USBD_SIM_Submit( hsim, AUDIO_FB_EP, Host_Feedback, sizeof( Host_Feedback ), 0U );
+}
+#endif /* USBD_AUDIO_ASYNC */
+
+/**
+  * @brief  Runs one clock case and checks the stream.
+  * @param  pcase: audio clock
+  * @retval None
+  */
+static void SIM_RunCase( const SIM_AudioCaseTypeDef *pcase )
+{
+    char     check[96];
+    double   sum = 0.0;
+    double   sum2 = 0.0;
+    double   level;
+    double   mean;
+    double   min_level = 1e9;
+    double   max_level = -1e9;
+    double   fb_sum = 0.0;
+    uint32_t n = 0U;
+    uint32_t k;
+
+    Dac_Case = pcase;
+    Dac_Running = 0U;
+    Dac_First = 1U;
+    Dac_Acc = 0.0;
+    Dac_Played = 0U;
+    Dac_Glitches = 0U;
+    Dac_Trims = 0U;
+    Host_FbValue = AUDIO_FB_NOMINAL;
+    Host_FbAcc = 0U;
+    Host_Samples = 0U;
+
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, USBD_AUDIO_CLASS );
+    USBD_AUDIO_RegisterInterface( &USBD_Device, &Audio_fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "enumerate", ( USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK ) &&
+               ( hsim_usb.pma_overflow == 0U ) );
+    SIM_Check( "SET_INTERFACE 1/1", USBD_SIM_Control( &hsim_usb, 0x01U, USB_REQ_SET_INTERFACE, 1U, 1U,
+                                                      NULL, NULL ) == USBD_SIM_OK );
+
+    Dac_LastUs = USBD_SIM_GetTime( &hsim_usb );
+    USBD_SIM_SetTick( &hsim_usb, Dac_Tick );
+    USBD_SIM_ResetStats( &hsim_usb );
+    USBD_SIM_SetPipe( &hsim_usb, AUDIO_OUT_EP, 1U, Host_OutCplt );
+    Host_SubmitPacket( &hsim_usb );
+#if (USBD_AUDIO_ASYNC == 1U)
+    USBD_SIM_SetPipe( &hsim_usb, AUDIO_FB_EP, ( uint8_t )( 1U << AUDIO_FB_REFRESH ), Host_FeedbackCplt );
+    USBD_SIM_Submit( &hsim_usb, AUDIO_FB_EP, Host_Feedback, sizeof( Host_Feedback ), 0U );
+#endif /* USBD_AUDIO_ASYNC */
+
+    for( k = 0U; k < AUDIO_CASE_FRAMES; k++ )
+    {
+        USBD_SIM_RunFrames( &hsim_usb, 1U );
+        fb_sum += ( double )Host_FbValue;
+
+        if( ( Dac_Running != 0U ) && ( k >= AUDIO_SETTLE_FRAMES ) )
+        {
+            /* Samples received and not played yet */
+            level = ( double )( Host_Samples - Dac_Played );
+            sum += level;
+            sum2 += level * level;
+            min_level = MIN( min_level, level );
+            max_level = MAX( max_level, level );
+            n++;
+        }
+    }
+
+    mean = ( n != 0U ) ? ( sum / n ) : 0.0;
+    printf( "%-20s level mean %6.1f sd %5.2f min %4.0f max %4.0f samples of %u, glitches %u",
+            pcase->name, mean, ( n != 0U ) ? sqrt( ( sum2 / n ) - ( mean * mean ) ) : 0.0,
+            min_level, max_level, ( unsigned )( AUDIO_TOTAL_BUF_SIZE / AUDIO_SAMPLE_BYTES ),
+            ( unsigned )Dac_Glitches );
+#if (USBD_AUDIO_ASYNC == 1U)
+    {
+        USBD_AUDIO_HandleTypeDef *haudio = ( USBD_AUDIO_HandleTypeDef * )USBD_Device.pClassData;
+
+        printf( ", underruns %u, overruns %u, mean feedback %.4f samples/frame\n",
+                ( unsigned )haudio->underruns, ( unsigned )haudio->overruns,
+                fb_sum / AUDIO_CASE_FRAMES / 16384.0 );
+
+        ( void )snprintf( check, sizeof( check ), "%s: no sample lost or repeated", pcase->name );
+        SIM_Check( check, ( Dac_Glitches == 0U ) && ( haudio->underruns == 0U ) && ( haudio->overruns == 0U ) );
+        ( void )snprintf( check, sizeof( check ), "%s: feedback follows the clock", pcase->name );
+        SIM_Check( check, fabs( ( fb_sum / AUDIO_CASE_FRAMES / 16384.0 ) -
+                                ( ( USBD_AUDIO_FREQ / 1000.0 ) * ( 1.0 + ( pcase->ppm * 1e-6 ) ) ) ) < 0.01 );
+    }
+#else
+    printf( ", length trims %u\n", ( unsigned )Dac_Trims );
+
+    /* Report only: the output starts when the write pointer rolls back and
+       reads where the host writes, so the samples are not checked */
+    ( void )snprintf( check, sizeof( check ), "%s: playback started", pcase->name );
+    SIM_Check( check, Dac_Played > ( ( AUDIO_CASE_FRAMES / 2U ) * ( USBD_AUDIO_FREQ / 1000U ) ) );
+#endif /* USBD_AUDIO_ASYNC */
+
+    ( void )snprintf( check, sizeof( check ), "%s: no isochronous frame missed", pcase->name );
+    SIM_Check( check, hsim_usb.OUT_ep[AUDIO_OUT_EP & 0x7FU].stats.missed == 0U );
+
+    USBD_SIM_SetTick( &hsim_usb, NULL );
+    USBD_DeInit( &USBD_Device );
+    SIM_Check( "DeInit frees the class data", SIM_Allocations == 0 );
+}
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval 0 when all checks passed
+  */
+int main( void )
+{
+    uint32_t i;
+
+    printf( "%s, %u Hz stereo 16-bit, buffer %u B, EP0 %u B, %u s per case\n",
+            ( USBD_AUDIO_ASYNC == 1U ) ? "asynchronous with feedback" : "synchronous, length trimming",
+            ( unsigned )USBD_AUDIO_FREQ, ( unsigned )AUDIO_TOTAL_BUF_SIZE, ( unsigned )USB_MAX_EP0_SIZE,
+            ( unsigned )( AUDIO_CASE_FRAMES / 1000U ) );
+
+    for( i = 0U; i < ( sizeof( Audio_Cases ) / sizeof( Audio_Cases[0] ) ); i++ )
+    {
+        SIM_RunCase( &Audio_Cases[i] );
+    }
+
+    printf( "PMA %u of %u B\n", ( unsigned )hsim_usb.pma_peak, ( unsigned )USBD_SIM_PMA_SIZE );
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
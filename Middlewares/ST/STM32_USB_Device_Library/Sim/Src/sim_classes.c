@@ -0,0 +1,745 @@
+/**
+  ******************************************************************************
+  * @file    sim_classes.c
+  * @author  MCD Application Team
+  * @brief   Host script: enumerates the CDC, MSC, HID, CustomHID and AUDIO
+  *          classes on the simulated low level driver and runs traffic
+  *          through each of them.
+  *          Usage: sim_classes [cdc|msc|hid|customhid|audio]
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_common.h"
+#include "usbd_cdc.h"
+#include "usbd_msc.h"
+#include "usbd_hid.h"
+#include "usbd_customhid.h"
+#include "usbd_audio.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define HOST_BUFFER_SIZE              ( 1024U * 1024U )
+#define CDC_TRANSFER_SIZE             ( 256U * 1024U )
+#define CDC_TX_RING_SIZE              2048U
+#define CDC_IN_REQUEST_SIZE           4096U
+#define CDC_TX_RING_START             0xFFFF8000U  /* 32 KiB before the wrap */
+#define MSC_DISK_BLOCKS               4096U
+#define MSC_BLOCK_SIZE                512U
+#define MSC_BLOCKS_PER_COMMAND        64U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t CDC_Itf_Init( void );
+static int8_t CDC_Itf_DeInit( void );
+static int8_t CDC_Itf_Control( uint8_t cmd, uint8_t *pbuf, uint16_t length );
+static int8_t CDC_Itf_Receive( uint8_t *pbuf, uint32_t *Len );
+
+static int8_t STORAGE_Init( uint8_t lun );
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size );
+static int8_t STORAGE_IsReady( uint8_t lun );
+static int8_t STORAGE_IsWriteProtected( uint8_t lun );
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_GetMaxLun( void );
+
+static int8_t CustomHID_Init( void );
+static int8_t CustomHID_DeInit( void );
+static int8_t CustomHID_OutEvent( uint8_t event_idx, uint8_t state );
+
+static int8_t Audio_Init( uint32_t AudioFreq, uint32_t Volume, uint32_t options );
+static int8_t Audio_DeInit( uint32_t options );
+static int8_t Audio_PlaybackCmd( uint8_t *pbuf, uint32_t size, uint8_t cmd );
+static int8_t Audio_VolumeCtl( uint8_t vol );
+static int8_t Audio_MuteCtl( uint8_t cmd );
+static int8_t Audio_PeriodicTC( uint8_t cmd );
+static int8_t Audio_GetState( void );
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t HostBuffer[HOST_BUFFER_SIZE];
+static uint8_t HostInBuffer[CDC_IN_REQUEST_SIZE];
+
+static USBD_CDC_ItfTypeDef CDC_fops =
+{
+    CDC_Itf_Init,
+    CDC_Itf_DeInit,
+    CDC_Itf_Control,
+    CDC_Itf_Receive
+};
+
+static uint8_t  CDC_RxBuffer[CDC_DATA_FS_OUT_XFER_SIZE];
+static uint8_t  CDC_TxRing[CDC_TX_RING_SIZE];
+static uint8_t  CDC_LineCoding[7];
+static uint32_t CDC_RxTotal;
+static uint32_t CDC_RxErrors;
+static uint32_t CDC_HostInTotal;
+static uint32_t CDC_HostInErrors;
+
+/* USB Mass storage Standard Inquiry Data */
+static int8_t STORAGE_Inquirydata[] =
+{
+    0x00, 0x80, 0x02, 0x02,
+    ( STANDARD_INQUIRY_DATA_LEN - 5 ),
+    0x00, 0x00, 0x00,
+    'S', 'T', 'M', ' ', ' ', ' ', ' ', ' ', /* Manufacturer: 8 bytes */
+    'S', 'i', 'm', 'u', 'l', 'a', 't', 'e', /* Product: 16 Bytes */
+    'd', ' ', 'd', 'i', 's', 'k', ' ', ' ',
+    '0', '.', '0', '1',                     /* Version: 4 Bytes */
+};
+
+static USBD_StorageTypeDef STORAGE_fops =
+{
+    STORAGE_Init,
+    STORAGE_GetCapacity,
+    STORAGE_IsReady,
+    STORAGE_IsWriteProtected,
+    STORAGE_Read,
+    STORAGE_Write,
+    STORAGE_GetMaxLun,
+    STORAGE_Inquirydata,
+    NULL,
+    NULL,
+};
+
+static uint8_t StorageDisk[MSC_DISK_BLOCKS * MSC_BLOCK_SIZE];
+
+static uint8_t CustomHID_ReportDesc[4] = { 0x06, 0x00, 0xFF, 0xC0 };
+
+static USBD_CUSTOM_HID_ItfTypeDef CustomHID_fops =
+{
+    CustomHID_ReportDesc,
+    CustomHID_Init,
+    CustomHID_DeInit,
+    CustomHID_OutEvent
+};
+
+static uint32_t HID_ReportsIn;
+static uint32_t HID_OutReports;
+static uint32_t HID_RequestSize;
+static uint8_t  HID_InBuffer[64];
+
+static USBD_AUDIO_ItfTypeDef Audio_fops =
+{
+    Audio_Init,
+    Audio_DeInit,
+    Audio_PlaybackCmd,
+    Audio_VolumeCtl,
+    Audio_MuteCtl,
+    Audio_PeriodicTC,
+    Audio_GetState,
+};
+
+static uint8_t  Audio_Packet[AUDIO_OUT_PACKET];
+static uint32_t Audio_IsoPackets;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Starts the device with one class, as an application would.
+  * @param  pclass: class driver
+  * @retval None
+  */
+static void SIM_StartClass( USBD_ClassTypeDef *pclass )
+{
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, pclass );
+}
+
+/**
+  * @brief  Stops the device and checks the class released its memory.
+  * @param  name: class name, for the report
+  * @retval None
+  */
+static void SIM_StopClass( const char *name )
+{
+    char check[64];
+
+    USBD_DeInit( &USBD_Device );
+
+    ( void )snprintf( check, sizeof( check ), "%s DeInit frees the class data", name );
+    SIM_Check( check, SIM_Allocations == 0 );
+}
+
+/* CDC ------------------------------------------------------------------------*/
+
+static int8_t CDC_Itf_Init( void )
+{
+    USBD_CDC_SetRxBuffer( &USBD_Device, CDC_RxBuffer );
+    USBD_CDC_SetTxRing( &USBD_Device, CDC_TxRing, sizeof( CDC_TxRing ) );
+    return ( USBD_OK );
+}
+
+static int8_t CDC_Itf_DeInit( void )
+{
+    return ( USBD_OK );
+}
+
+static int8_t CDC_Itf_Control( uint8_t cmd, uint8_t *pbuf, uint16_t length )
+{
+    switch( cmd )
+    {
+    case CDC_SET_LINE_CODING:
+        ( void )memcpy( CDC_LineCoding, pbuf, MIN( length, sizeof( CDC_LineCoding ) ) );
+        break;
+
+    case CDC_GET_LINE_CODING:
+        ( void )memcpy( pbuf, CDC_LineCoding, MIN( length, sizeof( CDC_LineCoding ) ) );
+        break;
+
+    default:
+        break;
+    }
+
+    return ( USBD_OK );
+}
+
+static int8_t CDC_Itf_Receive( uint8_t *pbuf, uint32_t *Len )
+{
+    uint32_t i;
+
+    for( i = 0U; i < *Len; i++ )
+    {
+        if( pbuf[i] != ( uint8_t )( CDC_RxTotal + i ) )
+        {
+            CDC_RxErrors++;
+        }
+    }
+
+    CDC_RxTotal += *Len;
+    USBD_CDC_ReceivePacket( &USBD_Device );
+    return ( USBD_OK );
+}
+
+static void CDC_HostInCplt( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr, uint32_t length )
+{
+    uint32_t i;
+
+    for( i = 0U; i < length; i++ )
+    {
+        if( HostInBuffer[i] != ( uint8_t )( CDC_HostInTotal + i ) )
+        {
+            CDC_HostInErrors++;
+        }
+    }
+
+    CDC_HostInTotal += length;
+    USBD_SIM_Submit( hsim, ep_addr, HostInBuffer, sizeof( HostInBuffer ), 0U );
+}
+
+/**
+  * @brief  CDC: enumeration, class requests, a stall on EP0, then bulk OUT
+  *         to the receive callback and bulk IN through the TX ring.
+  * @retval None
+  */
+static void SIM_RunCDC( void )
+{
+    uint8_t  line_coding[7] = { 0x00, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x08 };
+    uint8_t  status[2];
+    uint16_t length;
+    uint32_t actual;
+    uint32_t sent;
+    USBD_CDC_HandleTypeDef *hcdc;
+    uint32_t written;
+    uint32_t i;
+
+    SIM_StartClass( USBD_CDC_CLASS );
+    USBD_CDC_RegisterInterface( &USBD_Device, &CDC_fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "cdc enumerate", ( USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK ) &&
+               ( USBD_Device.dev_state == USBD_STATE_CONFIGURED ) );
+    SIM_Check( "cdc SET_ADDRESS applied after the status stage", hsim_usb.address == 1U );
+
+    length = sizeof( line_coding );
+    SIM_Check( "cdc SET_LINE_CODING",
+               ( USBD_SIM_Control( &hsim_usb, 0x21U, CDC_SET_LINE_CODING, 0U, 0U,
+                                   line_coding, &length ) == USBD_SIM_OK ) &&
+               ( CDC_LineCoding[1] == 0xC2U ) );
+
+    length = sizeof( line_coding );
+    ( void )memset( line_coding, 0, sizeof( line_coding ) );
+    SIM_Check( "cdc GET_LINE_CODING",
+               ( USBD_SIM_Control( &hsim_usb, 0xA1U, CDC_GET_LINE_CODING, 0U, 0U,
+                                   line_coding, &length ) == USBD_SIM_OK ) &&
+               ( length == 7U ) && ( line_coding[6] == 8U ) );
+
+    length = sizeof( status );
+    SIM_Check( "GET_STATUS on a missing interface stalls",
+               USBD_SIM_Control( &hsim_usb, 0x81U, USB_REQ_GET_STATUS, 0U, 9U,
+                                 status, &length ) == USBD_SIM_STALL );
+
+    length = sizeof( line_coding );
+    SIM_Check( "control pipe recovers after a stall",
+               USBD_SIM_Control( &hsim_usb, 0xA1U, CDC_GET_LINE_CODING, 0U, 0U,
+                                 line_coding, &length ) == USBD_SIM_OK );
+
+    for( i = 0U; i < sizeof( HostBuffer ); i++ )
+    {
+        HostBuffer[i] = ( uint8_t )i;
+    }
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    SIM_Check( "cdc bulk OUT 256 KiB",
+               ( USBD_SIM_Transfer( &hsim_usb, CDC_OUT_EP, HostBuffer, CDC_TRANSFER_SIZE,
+                                    USBD_SIM_XFER_ZLP, &actual ) == USBD_SIM_OK ) &&
+               ( actual == CDC_TRANSFER_SIZE ) && ( CDC_RxTotal == CDC_TRANSFER_SIZE ) &&
+               ( CDC_RxErrors == 0U ) );
+    printf( "--- CDC bulk OUT, 256 KiB\n" );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    SIM_Check( "cdc TX ring of a size that is not a power of two rejected",
+               USBD_CDC_SetTxRing( &USBD_Device, CDC_TxRing, CDC_TX_RING_SIZE - CDC_DATA_FS_MAX_PACKET_SIZE ) ==
+               USBD_FAIL );
+    SIM_Check( "cdc TX ring registered again",
+               USBD_CDC_SetTxRing( &USBD_Device, CDC_TxRing, CDC_TX_RING_SIZE ) == USBD_OK );
+
+    /* The free running indexes wrap at 2^32 in the middle of the transfer */
+    hcdc = ( USBD_CDC_HandleTypeDef * )USBD_Device.pClassData;
+    hcdc->TxRingHead = CDC_TX_RING_START;
+    hcdc->TxRingTail = CDC_TX_RING_START;
+    hcdc->TxRingLastHead = CDC_TX_RING_START;
+
+    /* The application main loop writes 16 bytes at a time and the bus runs
+       one frame whenever the ring is full or 2 KiB were written */
+    USBD_SIM_ResetStats( &hsim_usb );
+    USBD_SIM_SetPipe( &hsim_usb, CDC_IN_EP, 1U, CDC_HostInCplt );
+    USBD_SIM_Submit( &hsim_usb, CDC_IN_EP, HostInBuffer, sizeof( HostInBuffer ), 0U );
+
+    sent = 0U;
+    while( sent < CDC_TRANSFER_SIZE )
+    {
+        written = USBD_CDC_Write( &USBD_Device, &HostBuffer[sent & 0xFFFFU],
+                                  MIN( 16U, CDC_TRANSFER_SIZE - sent ) );
+        sent += written;
+
+        if( ( written == 0U ) || ( ( sent & 2047U ) == 0U ) )
+        {
+            USBD_SIM_RunFrames( &hsim_usb, 1U );
+        }
+    }
+
+    for( i = 0U; ( i < 20U ) && ( CDC_HostInTotal < sent ); i++ )
+    {
+        USBD_SIM_RunFrames( &hsim_usb, 1U );
+    }
+
+    SIM_Check( "cdc bulk IN 256 KiB through the TX ring, indexes wrapped",
+               ( CDC_HostInTotal == CDC_TRANSFER_SIZE ) && ( CDC_HostInErrors == 0U ) &&
+               ( hcdc->TxRingTail == ( uint32_t )( CDC_TX_RING_START + CDC_TRANSFER_SIZE ) ) );
+    printf( "--- CDC bulk IN through the TX ring, 16 B writes\n" );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    SIM_StopClass( "cdc" );
+}
+
+/* MSC ------------------------------------------------------------------------*/
+
+static int8_t STORAGE_Init( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size )
+{
+    *block_num  = MSC_DISK_BLOCKS;
+    *block_size = MSC_BLOCK_SIZE;
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsReady( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsWriteProtected( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    ( void )memcpy( buf, &StorageDisk[blk_addr * MSC_BLOCK_SIZE], blk_len * MSC_BLOCK_SIZE );
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    ( void )memcpy( &StorageDisk[blk_addr * MSC_BLOCK_SIZE], buf, blk_len * MSC_BLOCK_SIZE );
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetMaxLun( void )
+{
+    return ( 0 );
+}
+
+/**
+  * @brief  Runs one Bulk-Only Transport command: CBW, data stage, CSW.
+  * @param  cb: 10-byte command block
+  * @param  length: data stage length
+  * @param  pbuf: data stage buffer
+  * @param  dir_in: 1 for a device to host data stage
+  * @retval CSW status, or -1 when a stage failed
+  */
+static int SIM_MSC_Command( const uint8_t *cb, uint32_t length, uint8_t *pbuf, uint8_t dir_in )
+{
+    uint8_t  cbw[USBD_BOT_CBW_LENGTH] = { 'U', 'S', 'B', 'C', 0x01U, 0x02U, 0x03U, 0x04U };
+    uint8_t  csw[USBD_BOT_CSW_LENGTH];
+    uint32_t actual;
+
+    cbw[8]  = ( uint8_t )length;
+    cbw[9]  = ( uint8_t )( length >> 8 );
+    cbw[10] = ( uint8_t )( length >> 16 );
+    cbw[11] = ( uint8_t )( length >> 24 );
+    cbw[12] = ( dir_in != 0U ) ? 0x80U : 0x00U;
+    cbw[14] = 10U;
+    ( void )memcpy( &cbw[15], cb, 10U );
+
+    if( USBD_SIM_Transfer( &hsim_usb, MSC_EPOUT_ADDR, cbw, sizeof( cbw ), 0U, &actual ) != USBD_SIM_OK )
+    {
+        return -1;
+    }
+
+    if( ( length != 0U ) &&
+        ( ( USBD_SIM_Transfer( &hsim_usb, ( dir_in != 0U ) ? MSC_EPIN_ADDR : MSC_EPOUT_ADDR,
+                               pbuf, length, 0U, &actual ) != USBD_SIM_OK ) || ( actual != length ) ) )
+    {
+        return -1;
+    }
+
+    if( ( USBD_SIM_Transfer( &hsim_usb, MSC_EPIN_ADDR, csw, sizeof( csw ), 0U, &actual ) != USBD_SIM_OK ) ||
+        ( actual != sizeof( csw ) ) )
+    {
+        return -1;
+    }
+
+    return ( int )csw[12];
+}
+
+static int SIM_MSC_ReadWrite( uint8_t opcode, uint32_t lba, uint16_t blocks, uint8_t *pbuf )
+{
+    uint8_t cb[10] = { opcode, 0U, ( uint8_t )( lba >> 24 ), ( uint8_t )( lba >> 16 ),
+                       ( uint8_t )( lba >> 8 ), ( uint8_t )lba, 0U,
+                       ( uint8_t )( blocks >> 8 ), ( uint8_t )blocks, 0U
+                     };
+
+    return SIM_MSC_Command( cb, ( uint32_t )blocks * MSC_BLOCK_SIZE, pbuf, ( opcode == SCSI_READ10 ) ? 1U : 0U );
+}
+
+/**
+  * @brief  MSC: enumeration, GET_MAX_LUN, READ CAPACITY, then 1 MiB read
+  *         and 1 MiB written in 32 KiB commands.
+  * @retval None
+  */
+static void SIM_RunMSC( void )
+{
+    uint8_t  max_lun[1];
+    uint8_t  cb[10] = { SCSI_READ_CAPACITY10 };
+    uint8_t  capacity[8];
+    uint16_t length;
+    uint32_t lba;
+    uint32_t i;
+    int status;
+
+    for( i = 0U; i < sizeof( StorageDisk ); i++ )
+    {
+        StorageDisk[i] = ( uint8_t )( i * 7U );
+    }
+
+    SIM_StartClass( USBD_MSC_CLASS );
+    USBD_MSC_RegisterStorage( &USBD_Device, &STORAGE_fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "msc enumerate", USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK );
+
+    length = sizeof( max_lun );
+    SIM_Check( "msc GET_MAX_LUN",
+               ( USBD_SIM_Control( &hsim_usb, 0xA1U, BOT_GET_MAX_LUN, 0U, 0U,
+                                   max_lun, &length ) == USBD_SIM_OK ) &&
+               ( length == 1U ) && ( max_lun[0] == 0U ) );
+
+    SIM_Check( "msc READ CAPACITY(10)",
+               ( SIM_MSC_Command( cb, sizeof( capacity ), capacity, 1U ) == 0 ) &&
+               ( capacity[2] == ( uint8_t )( ( MSC_DISK_BLOCKS - 1U ) >> 8 ) ) &&
+               ( capacity[6] == ( uint8_t )( MSC_BLOCK_SIZE >> 8 ) ) );
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    status = 0;
+    for( lba = 0U; ( lba < 2048U ) && ( status == 0 ); lba += MSC_BLOCKS_PER_COMMAND )
+    {
+        status = SIM_MSC_ReadWrite( SCSI_READ10, lba, MSC_BLOCKS_PER_COMMAND,
+                                    &HostBuffer[lba * MSC_BLOCK_SIZE] );
+    }
+    SIM_Check( "msc READ(10) 1 MiB",
+               ( status == 0 ) && ( memcmp( HostBuffer, StorageDisk, HOST_BUFFER_SIZE ) == 0 ) );
+    printf( "--- MSC READ(10), 1 MiB in 32 KiB commands\n" );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    for( i = 0U; i < HOST_BUFFER_SIZE; i++ )
+    {
+        HostBuffer[i] = ( uint8_t )( ( i * 13U ) + 1U );
+    }
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    for( lba = 0U; ( lba < 2048U ) && ( status == 0 ); lba += MSC_BLOCKS_PER_COMMAND )
+    {
+        status = SIM_MSC_ReadWrite( SCSI_WRITE10, 2048U + lba, MSC_BLOCKS_PER_COMMAND,
+                                    &HostBuffer[lba * MSC_BLOCK_SIZE] );
+    }
+    SIM_Check( "msc WRITE(10) 1 MiB",
+               ( status == 0 ) &&
+               ( memcmp( HostBuffer, &StorageDisk[HOST_BUFFER_SIZE], HOST_BUFFER_SIZE ) == 0 ) );
+    printf( "--- MSC WRITE(10), 1 MiB in 32 KiB commands\n" );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    SIM_StopClass( "msc" );
+}
+
+/* HID and CustomHID ----------------------------------------------------------*/
+
+static void HID_HostInCplt( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr, uint32_t length )
+{
+    HID_ReportsIn++;
+    USBD_SIM_Submit( hsim, ep_addr, HID_InBuffer, HID_RequestSize, 0U );
+}
+
+/**
+  * @brief  HID mouse: report descriptor, then a report offered every frame
+  *         while the host polls at bInterval.
+  * @retval None
+  */
+static void SIM_RunHID( void )
+{
+    uint8_t  report[4] = { 0x00U, 0x01U, 0x01U, 0x00U };
+    uint8_t  report_desc[255];
+    uint16_t length;
+    uint32_t refused = 0U;
+    uint32_t i;
+
+    SIM_StartClass( USBD_HID_CLASS );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "hid enumerate", USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK );
+
+    length = sizeof( report_desc );
+    SIM_Check( "hid GET_DESCRIPTOR(report)",
+               ( USBD_SIM_Control( &hsim_usb, 0x81U, USB_REQ_GET_DESCRIPTOR,
+                                   ( uint16_t )( HID_REPORT_DESC << 8 ), 0U,
+                                   report_desc, &length ) == USBD_SIM_OK ) &&
+               ( length == HID_MOUSE_REPORT_DESC_SIZE ) );
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    HID_ReportsIn   = 0U;
+    HID_RequestSize = HID_EPIN_SIZE;
+    USBD_SIM_SetPipe( &hsim_usb, HID_EPIN_ADDR, HID_FS_BINTERVAL, HID_HostInCplt );
+    USBD_SIM_Submit( &hsim_usb, HID_EPIN_ADDR, HID_InBuffer, HID_RequestSize, 0U );
+
+    for( i = 0U; i < 1000U; i++ )
+    {
+        if( ( ( USBD_HID_HandleTypeDef * )USBD_Device.pClassData )->state == HID_IDLE )
+        {
+            USBD_HID_SendReport( &USBD_Device, report, sizeof( report ) );
+        }
+        else
+        {
+            refused++;
+        }
+
+        USBD_SIM_RunFrames( &hsim_usb, 1U );
+    }
+
+    SIM_Check( "hid one report per bInterval", HID_ReportsIn == ( 1000U / HID_FS_BINTERVAL ) );
+    printf( "--- HID mouse, a report offered every frame, bInterval %u (%u refused)\n",
+            HID_FS_BINTERVAL, refused );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    SIM_StopClass( "hid" );
+}
+
+static int8_t CustomHID_Init( void )
+{
+    return ( USBD_OK );
+}
+
+static int8_t CustomHID_DeInit( void )
+{
+    return ( USBD_OK );
+}
+
+static int8_t CustomHID_OutEvent( uint8_t event_idx, uint8_t state )
+{
+    HID_OutReports++;
+    return ( USBD_OK );
+}
+
+/**
+  * @brief  CustomHID: IN reports offered at 1 kHz, one OUT report.
+  * @retval None
+  */
+static void SIM_RunCustomHID( void )
+{
+    uint8_t  report[2] = { 0x01U, 0x00U };
+    uint8_t  out_report[2] = { 0x02U, 0x01U };
+    uint32_t busy = 0U;
+    uint32_t actual;
+    uint32_t i;
+
+    SIM_StartClass( USBD_CUSTOM_HID_CLASS );
+    USBD_CUSTOM_HID_RegisterInterface( &USBD_Device, &CustomHID_fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "customhid enumerate", USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK );
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    HID_ReportsIn   = 0U;
+    HID_RequestSize = CUSTOM_HID_EPIN_SIZE;
+    USBD_SIM_SetPipe( &hsim_usb, CUSTOM_HID_EPIN_ADDR, CUSTOM_HID_FS_BINTERVAL, HID_HostInCplt );
+    USBD_SIM_Submit( &hsim_usb, CUSTOM_HID_EPIN_ADDR, HID_InBuffer, HID_RequestSize, 0U );
+
+    for( i = 0U; i < 1000U; i++ )
+    {
+        if( USBD_CUSTOM_HID_SendReport( &USBD_Device, report, sizeof( report ) ) != USBD_OK )
+        {
+            busy++;
+        }
+
+        USBD_SIM_RunFrames( &hsim_usb, 1U );
+    }
+
+    SIM_Check( "customhid one IN report per bInterval",
+               HID_ReportsIn == ( 1000U / CUSTOM_HID_FS_BINTERVAL ) );
+    SIM_Check( "customhid OUT report",
+               ( USBD_SIM_Transfer( &hsim_usb, CUSTOM_HID_EPOUT_ADDR, out_report,
+                                    sizeof( out_report ), 0U, &actual ) == USBD_SIM_OK ) &&
+               ( HID_OutReports == 1U ) );
+    printf( "--- CustomHID, reports offered at 1 kHz, bInterval %u: %u delivered, %u not accepted\n",
+            CUSTOM_HID_FS_BINTERVAL, HID_ReportsIn, busy );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    SIM_StopClass( "customhid" );
+}
+
+/* AUDIO ----------------------------------------------------------------------*/
+
+static int8_t Audio_Init( uint32_t AudioFreq, uint32_t Volume, uint32_t options )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_DeInit( uint32_t options )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_PlaybackCmd( uint8_t *pbuf, uint32_t size, uint8_t cmd )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_VolumeCtl( uint8_t vol )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_MuteCtl( uint8_t cmd )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_PeriodicTC( uint8_t cmd )
+{
+    return ( USBD_OK );
+}
+
+static int8_t Audio_GetState( void )
+{
+    return ( USBD_OK );
+}
+
+static void Audio_HostOutCplt( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr, uint32_t length )
+{
+    Audio_IsoPackets++;
+    USBD_SIM_Submit( hsim, ep_addr, Audio_Packet, sizeof( Audio_Packet ), 0U );
+}
+
+/**
+  * @brief  AUDIO: enumeration, alternate setting 1, then 2 s of
+  *         isochronous OUT at the nominal rate.
+  * @retval None
+  */
+static void SIM_RunAudio( void )
+{
+    SIM_StartClass( USBD_AUDIO_CLASS );
+    USBD_AUDIO_RegisterInterface( &USBD_Device, &Audio_fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "audio enumerate", USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK );
+    SIM_Check( "audio endpoints fit in the PMA", hsim_usb.pma_overflow == 0U );
+    SIM_Check( "audio SET_INTERFACE 1/1",
+               USBD_SIM_Control( &hsim_usb, 0x01U, USB_REQ_SET_INTERFACE, 1U, 1U,
+                                 NULL, NULL ) == USBD_SIM_OK );
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    USBD_SIM_SetPipe( &hsim_usb, AUDIO_OUT_EP, 1U, Audio_HostOutCplt );
+    USBD_SIM_Submit( &hsim_usb, AUDIO_OUT_EP, Audio_Packet, sizeof( Audio_Packet ), 0U );
+    USBD_SIM_RunFrames( &hsim_usb, 2000U );
+
+    SIM_Check( "audio 2000 isochronous frames, none missed",
+               ( Audio_IsoPackets == 2000U ) &&
+               ( hsim_usb.OUT_ep[AUDIO_OUT_EP & 0x7FU].stats.missed == 0U ) );
+    printf( "--- AUDIO isochronous OUT, %u B/frame, 2 s\n", AUDIO_OUT_PACKET );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    SIM_StopClass( "audio" );
+}
+
+/**
+  * @brief  Main program
+  * @param  argc, argv: optional class name, all classes by default
+  * @retval 0 when all checks passed
+  */
+int main( int argc, char **argv )
+{
+    const char *what = ( argc > 1 ) ? argv[1] : "all";
+    uint8_t all = ( strcmp( what, "all" ) == 0 ) ? 1U : 0U;
+
+    if( ( all != 0U ) || ( strcmp( what, "cdc" ) == 0 ) )
+    {
+        SIM_RunCDC();
+    }
+
+    if( ( all != 0U ) || ( strcmp( what, "msc" ) == 0 ) )
+    {
+        SIM_RunMSC();
+    }
+
+    if( ( all != 0U ) || ( strcmp( what, "hid" ) == 0 ) )
+    {
+        SIM_RunHID();
+    }
+
+    if( ( all != 0U ) || ( strcmp( what, "customhid" ) == 0 ) )
+    {
+        SIM_RunCustomHID();
+    }
+
+    if( ( all != 0U ) || ( strcmp( what, "audio" ) == 0 ) )
+    {
+        SIM_RunAudio();
+    }
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
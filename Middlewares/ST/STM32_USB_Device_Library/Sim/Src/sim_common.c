@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    sim_common.c
+  * @author  MCD Application Team
+  * @brief   Helpers shared by the host-side simulation scripts: the device
+  *          handle, checks and the class memory allocator.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_common.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+USBD_HandleTypeDef USBD_Device;
+int32_t SIM_Allocations;
+
+static uint32_t SIM_Checks;
+static uint32_t SIM_Failures;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Reports one check.
+  * @param  name: what is checked
+  * @param  cond: 0 if the check failed
+  * @retval None
+  */
+void SIM_Check( const char *name, uint32_t cond )
+{
+    SIM_Checks++;
+
+    if( cond == 0U )
+    {
+        SIM_Failures++;
+        printf( "FAIL %s\n", name );
+    }
+    else
+    {
+        printf( "ok   %s\n", name );
+    }
+}
+
+/**
+  * @brief  Prints the summary of the checks.
+  * @retval Exit status of the script: 0 if every check passed
+  */
+int SIM_Result( void )
+{
+    if( SIM_Failures != 0U )
+    {
+        printf( "%u of %u checks FAILED\n", SIM_Failures, SIM_Checks );
+        return 1;
+    }
+
+    printf( "all %u checks passed\n", SIM_Checks );
+    return 0;
+}
+
+/**
+  * @brief  Allocates class memory (USBD_malloc), zeroed as a static block
+  *         would be at startup.
+  * @param  size: size in bytes
+  * @retval block, NULL if out of memory
+  */
+void *SIM_Malloc( uint32_t size )
+{
+    void *p = calloc( 1U, size );
+
+    if( p != NULL )
+    {
+        SIM_Allocations++;
+    }
+
+    return p;
+}
+
+/**
+  * @brief  Frees class memory (USBD_free).
+  * @param  p: block, may be NULL
+  * @retval None
+  */
+void SIM_Free( void *p )
+{
+    if( p != NULL )
+    {
+        SIM_Allocations--;
+    }
+
+    free( p );
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
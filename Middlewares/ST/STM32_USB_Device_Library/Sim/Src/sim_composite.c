@@ -0,0 +1,485 @@
+/**
+  ******************************************************************************
+  * @file    sim_composite.c
+  * @author  MCD Application Team
+  * @brief   Host script: enumerates a CDC + MSC + HID composite device, walks
+  *          its configuration descriptor, then runs the class requests and
+  *          the data endpoints of each function through the composite driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_msc.h"
+#include "usbd_composite.h"
+#include "usbd_cdc.h"
+#include "usbd_hid.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DISK_BLOCKS                   1024U
+#define CDC_TX_RING_SIZE              256U
+
+/* Configuration descriptor: header, IAD, CDC, MSC and HID functions */
+#define COMPOSITE_CFG_DESC_SIZE       ( USB_LEN_CFG_DESC + USB_IAD_DESC_SIZ + 58U + 23U + 25U )
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t CDC_Itf_Init( void );
+static int8_t CDC_Itf_DeInit( void );
+static int8_t CDC_Itf_Control( uint8_t cmd, uint8_t *pbuf, uint16_t length );
+static int8_t CDC_Itf_Receive( uint8_t *pbuf, uint32_t *Len );
+
+static int8_t STORAGE_Init( uint8_t lun );
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size );
+static int8_t STORAGE_IsReady( uint8_t lun );
+static int8_t STORAGE_IsWriteProtected( uint8_t lun );
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_GetMaxLun( void );
+
+/* Private variables ---------------------------------------------------------*/
+static USBD_CDC_ItfTypeDef CDC_fops =
+{
+    CDC_Itf_Init,
+    CDC_Itf_DeInit,
+    CDC_Itf_Control,
+    CDC_Itf_Receive
+};
+
+static uint8_t  CDC_RxBuffer[CDC_DATA_FS_OUT_XFER_SIZE];
+static uint8_t  CDC_TxRing[CDC_TX_RING_SIZE];
+static uint8_t  CDC_LineCoding[7];
+static int32_t  CDC_Initialized;
+static int32_t  CDC_LastCmd = -1;
+static uint32_t CDC_RxLength;
+static uint8_t  CDC_RxData[8];
+
+static int8_t STORAGE_Inquirydata[STANDARD_INQUIRY_DATA_LEN] =
+{
+    0x00, 0x80, 0x02, 0x02,
+    ( STANDARD_INQUIRY_DATA_LEN - 5 ),
+    0x00, 0x00, 0x00,
+    'S', 'T', 'M', ' ', ' ', ' ', ' ', ' ', /* Manufacturer: 8 bytes */
+};
+
+static USBD_StorageTypeDef STORAGE_fops =
+{
+    STORAGE_Init,
+    STORAGE_GetCapacity,
+    STORAGE_IsReady,
+    STORAGE_IsWriteProtected,
+    STORAGE_Read,
+    STORAGE_Write,
+    STORAGE_GetMaxLun,
+    STORAGE_Inquirydata,
+    NULL,
+    NULL,
+};
+
+static uint8_t StorageDisk[DISK_BLOCKS * SIM_MSC_BLOCK_SIZE];
+static uint8_t ConfigDesc[USBD_COMPOSITE_MAX_CFG_DESC_SIZE];
+static uint8_t HostBuffer[4U * SIM_MSC_BLOCK_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+
+/* CDC ------------------------------------------------------------------------*/
+
+static int8_t CDC_Itf_Init( void )
+{
+    CDC_Initialized++;
+    USBD_CDC_SetRxBuffer( &USBD_Device, CDC_RxBuffer );
+    USBD_CDC_SetTxRing( &USBD_Device, CDC_TxRing, sizeof( CDC_TxRing ) );
+    return ( USBD_OK );
+}
+
+static int8_t CDC_Itf_DeInit( void )
+{
+    CDC_Initialized--;
+    return ( USBD_OK );
+}
+
+static int8_t CDC_Itf_Control( uint8_t cmd, uint8_t *pbuf, uint16_t length )
+{
+    CDC_LastCmd = cmd;
+
+    switch( cmd )
+    {
+    case CDC_SET_LINE_CODING:
+        ( void )memcpy( CDC_LineCoding, pbuf, MIN( length, sizeof( CDC_LineCoding ) ) );
+        break;
+
+    case CDC_GET_LINE_CODING:
+        ( void )memcpy( pbuf, CDC_LineCoding, MIN( length, sizeof( CDC_LineCoding ) ) );
+        break;
+
+    default:
+        break;
+    }
+
+    return ( USBD_OK );
+}
+
+static int8_t CDC_Itf_Receive( uint8_t *pbuf, uint32_t *Len )
+{
+    CDC_RxLength = *Len;
+    ( void )memcpy( CDC_RxData, pbuf, MIN( *Len, sizeof( CDC_RxData ) ) );
+    USBD_CDC_ReceivePacket( &USBD_Device );
+    return ( USBD_OK );
+}
+
+/* MSC ------------------------------------------------------------------------*/
+
+static int8_t STORAGE_Init( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size )
+{
+    *block_num  = DISK_BLOCKS;
+    *block_size = SIM_MSC_BLOCK_SIZE;
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsReady( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsWriteProtected( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    ( void )memcpy( buf, &StorageDisk[blk_addr * SIM_MSC_BLOCK_SIZE], blk_len * SIM_MSC_BLOCK_SIZE );
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    ( void )memcpy( &StorageDisk[blk_addr * SIM_MSC_BLOCK_SIZE], buf, blk_len * SIM_MSC_BLOCK_SIZE );
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetMaxLun( void )
+{
+    return ( 0 );
+}
+
+/* Script ---------------------------------------------------------------------*/
+
+/**
+  * @brief  Runs READ CAPACITY(10), as a host does before any READ or WRITE.
+  * @retval 1 when the capacity is the one of the storage
+  */
+static uint8_t SIM_ReadCapacity( void )
+{
+    uint8_t cb[10] = { SCSI_READ_CAPACITY10 };
+    uint8_t capacity[8];
+
+    return ( SIM_MSC_Command( cb, sizeof( cb ), 1U, capacity, sizeof( capacity ), NULL ) == 0 ) &&
+           ( capacity[2] == ( uint8_t )( ( DISK_BLOCKS - 1U ) >> 8 ) ) && ( capacity[6] == 0x02U );
+}
+
+/**
+  * @brief  Prints the configuration descriptor, one line per descriptor.
+  * @param  pdesc: configuration descriptor
+  * @param  length: descriptor length
+  * @retval None
+  */
+static void SIM_DumpConfig( const uint8_t *pdesc, uint16_t length )
+{
+    const uint8_t *d;
+    uint16_t i;
+
+    for( i = 0U; ( i < length ) && ( pdesc[i] != 0U ); i += pdesc[i] )
+    {
+        d = &pdesc[i];
+
+        switch( d[1] )
+        {
+        case USB_DESC_TYPE_CONFIGURATION:
+            printf( "  CONFIGURATION total %u, %u interfaces, attributes 0x%02X, %u mA\n",
+                    ( unsigned )( d[2] | ( d[3] << 8 ) ), d[4], d[7], 2U * d[8] );
+            break;
+
+        case USB_DESC_TYPE_IAD:
+            printf( "  IAD first %u, count %u, class %02X/%02X/%02X\n", d[2], d[3], d[4], d[5], d[6] );
+            break;
+
+        case USB_DESC_TYPE_INTERFACE:
+            printf( "  INTERFACE %u alt %u, %u endpoints, class %02X/%02X/%02X\n",
+                    d[2], d[3], d[4], d[5], d[6], d[7] );
+            break;
+
+        case USB_DESC_TYPE_ENDPOINT:
+            printf( "    ENDPOINT 0x%02X type %u, max packet %u\n", d[2], d[3] & 0x03U,
+                    ( unsigned )( d[4] | ( d[5] << 8 ) ) );
+            break;
+
+        case USB_DESC_TYPE_CS_INTERFACE:
+            printf( "    CS_INTERFACE subtype 0x%02X\n", d[2] );
+            break;
+
+        default:
+            printf( "    type 0x%02X, %u bytes\n", d[1], d[0] );
+            break;
+        }
+    }
+}
+
+/**
+  * @brief  Enumerates the device and checks its configuration descriptor:
+  *         interface numbering, IAD, CDC references and endpoints.
+  * @retval None
+  */
+static void SIM_CheckConfig( void )
+{
+    uint8_t  ep_used[32];
+    uint16_t length = USB_LEN_CFG_DESC;
+    uint16_t total;
+    uint16_t i;
+    uint8_t  itf = 0U;
+    uint8_t  iad = 0U;
+    uint8_t  errors = 0U;
+    uint8_t  duplicates = 0U;
+    uint8_t  call_mgmt_itf = 0xFFU;
+    uint8_t  union_itf[2] = { 0xFFU, 0xFFU };
+    const uint8_t *d;
+
+    SIM_Check( "enumerate", ( USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK ) &&
+               ( USBD_Device.dev_state == USBD_STATE_CONFIGURED ) );
+    SIM_Check( "one block of class data per class, CDC initialized",
+               ( SIM_Allocations == 3 ) && ( CDC_Initialized == 1 ) );
+
+    ( void )USBD_SIM_Control( &hsim_usb, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                              ( uint16_t )USB_DESC_TYPE_CONFIGURATION << 8, 0U, ConfigDesc, &length );
+    total = ( uint16_t )( ConfigDesc[2] | ( ConfigDesc[3] << 8 ) );
+    SIM_Check( "configuration descriptor header: 4 interfaces",
+               ( length == USB_LEN_CFG_DESC ) && ( ConfigDesc[4] == 4U ) );
+
+    length = sizeof( ConfigDesc );
+    ( void )USBD_SIM_Control( &hsim_usb, 0x80U, USB_REQ_GET_DESCRIPTOR,
+                              ( uint16_t )USB_DESC_TYPE_CONFIGURATION << 8, 0U, ConfigDesc, &length );
+    SIM_Check( "configuration descriptor length", ( length == total ) && ( total == COMPOSITE_CFG_DESC_SIZE ) );
+    printf( "configuration descriptor, %u bytes:\n", length );
+    SIM_DumpConfig( ConfigDesc, length );
+
+    ( void )memset( ep_used, 0, sizeof( ep_used ) );
+
+    for( i = 0U; i < length; i += ConfigDesc[i] )
+    {
+        d = &ConfigDesc[i];
+
+        if( d[1] == USB_DESC_TYPE_INTERFACE )
+        {
+            errors += ( d[2] != itf ) ? 1U : 0U;
+            itf++;
+        }
+        else if( d[1] == USB_DESC_TYPE_IAD )
+        {
+            iad++;
+            errors += ( ( d[2] != 0U ) || ( d[3] != 2U ) || ( d[4] != 0x02U ) ) ? 1U : 0U;
+        }
+        else if( ( d[1] == USB_DESC_TYPE_CS_INTERFACE ) && ( d[2] == 0x01U ) )
+        {
+            call_mgmt_itf = d[4];
+        }
+        else if( ( d[1] == USB_DESC_TYPE_CS_INTERFACE ) && ( d[2] == 0x06U ) )
+        {
+            union_itf[0] = d[3];
+            union_itf[1] = d[4];
+        }
+        else if( d[1] == USB_DESC_TYPE_ENDPOINT )
+        {
+            duplicates += ep_used[( d[2] & 0x0FU ) + ( ( ( d[2] & 0x80U ) != 0U ) ? 16U : 0U )]++;
+        }
+        else
+        {
+        }
+    }
+
+    SIM_Check( "interfaces numbered 0 to 3", ( itf == 4U ) && ( errors == 0U ) );
+    SIM_Check( "one IAD, in front of the CDC function", iad == 1U );
+    SIM_Check( "CDC functional descriptors point at interfaces 0 and 1",
+               ( call_mgmt_itf == 1U ) && ( union_itf[0] == 0U ) && ( union_itf[1] == 1U ) );
+    SIM_Check( "endpoint addresses unique", duplicates == 0U );
+    SIM_Check( "self powered, merged attributes and power", ( ConfigDesc[7] & 0x40U ) != 0U );
+}
+
+/**
+  * @brief  Class requests to each interface, then a request to an
+  *         interface that does not exist.
+  * @retval None
+  */
+static void SIM_CheckRequests( void )
+{
+    uint8_t  line_coding[7] = { 0x00, 0x10, 0x0E, 0x00, 0x00, 0x00, 0x08 };
+    uint8_t  data[HID_MOUSE_REPORT_DESC_SIZE];
+    uint16_t length;
+
+    length = sizeof( line_coding );
+    SIM_Check( "CDC SET_LINE_CODING on interface 0",
+               ( USBD_SIM_Control( &hsim_usb, 0x21U, CDC_SET_LINE_CODING, 0U, 0U, line_coding, &length ) ==
+                 USBD_SIM_OK ) && ( CDC_LastCmd == CDC_SET_LINE_CODING ) &&
+               ( memcmp( CDC_LineCoding, line_coding, sizeof( line_coding ) ) == 0 ) );
+    length = sizeof( line_coding );
+    ( void )memset( data, 0, sizeof( data ) );
+    SIM_Check( "CDC GET_LINE_CODING on interface 0",
+               ( USBD_SIM_Control( &hsim_usb, 0xA1U, CDC_GET_LINE_CODING, 0U, 0U, data, &length ) ==
+                 USBD_SIM_OK ) && ( length == 7U ) && ( memcmp( data, line_coding, 7U ) == 0 ) );
+    SIM_Check( "CDC SET_CONTROL_LINE_STATE",
+               ( USBD_SIM_Control( &hsim_usb, 0x21U, CDC_SET_CONTROL_LINE_STATE, 3U, 0U, NULL, NULL ) ==
+                 USBD_SIM_OK ) && ( CDC_LastCmd == CDC_SET_CONTROL_LINE_STATE ) );
+
+    length = 1U;
+    data[0] = 0xFFU;
+    SIM_Check( "MSC GET_MAX_LUN on interface 2",
+               ( USBD_SIM_Control( &hsim_usb, 0xA1U, BOT_GET_MAX_LUN, 0U, 2U, data, &length ) == USBD_SIM_OK ) &&
+               ( length == 1U ) && ( data[0] == 0U ) );
+
+    length = sizeof( data );
+    SIM_Check( "HID report descriptor on interface 3",
+               ( USBD_SIM_Control( &hsim_usb, 0x81U, USB_REQ_GET_DESCRIPTOR, ( uint16_t )HID_REPORT_DESC << 8,
+                                   3U, data, &length ) == USBD_SIM_OK ) &&
+               ( length == HID_MOUSE_REPORT_DESC_SIZE ) && ( data[0] == 0x05U ) );
+    SIM_Check( "HID SET_IDLE on interface 3",
+               USBD_SIM_Control( &hsim_usb, 0x21U, HID_REQ_SET_IDLE, 0U, 3U, NULL, NULL ) == USBD_SIM_OK );
+    length = 1U;
+    SIM_Check( "HID GET_PROTOCOL on interface 3",
+               ( USBD_SIM_Control( &hsim_usb, 0xA1U, HID_REQ_GET_PROTOCOL, 0U, 3U, data, &length ) ==
+                 USBD_SIM_OK ) && ( length == 1U ) );
+
+    length = 1U;
+    SIM_Check( "request to interface 4 stalls",
+               USBD_SIM_Control( &hsim_usb, 0xA1U, BOT_GET_MAX_LUN, 0U, 4U, data, &length ) == USBD_SIM_STALL );
+    length = 2U;
+    SIM_Check( "next request completes",
+               ( USBD_SIM_Control( &hsim_usb, 0x80U, USB_REQ_GET_STATUS, 0U, 0U, data, &length ) ==
+                 USBD_SIM_OK ) && ( length == 2U ) );
+}
+
+/**
+  * @brief  Data endpoints of each function, and class APIs called from the
+  *         application with the class selected.
+  * @retval None
+  */
+static void SIM_CheckEndpoints( void )
+{
+    uint8_t  cb[6] = { SCSI_INQUIRY, 0U, 0U, 0U, STANDARD_INQUIRY_DATA_LEN, 0U };
+    uint8_t  cdc_out[5] = { 'h', 'e', 'l', 'l', 'o' };
+    uint8_t  report[HID_EPIN_SIZE] = { 0x01U, 0x02U, 0x03U, 0x00U };
+    uint8_t  data[CDC_DATA_FS_MAX_PACKET_SIZE];
+    uint32_t actual;
+    uint32_t written;
+    uint32_t residue;
+    uint32_t halts;
+    uint32_t i;
+    uint8_t  read10[10] = { 0U };
+    uint8_t  prev;
+    int      status;
+
+    SIM_Check( "CDC OUT reaches the CDC interface",
+               ( USBD_SIM_Transfer( &hsim_usb, CDC_OUT_EP, cdc_out, sizeof( cdc_out ), 0U, NULL ) ==
+                 USBD_SIM_OK ) && ( CDC_RxLength == sizeof( cdc_out ) ) &&
+               ( memcmp( CDC_RxData, cdc_out, sizeof( cdc_out ) ) == 0 ) );
+
+    SIM_Check( "MSC INQUIRY",
+               ( SIM_MSC_Command( cb, sizeof( cb ), 1U, HostBuffer, STANDARD_INQUIRY_DATA_LEN, &residue ) == 0 ) &&
+               ( residue == 0U ) && ( memcmp( &HostBuffer[8], "STM", 3U ) == 0 ) );
+
+    SIM_Check( "MSC READ CAPACITY(10)", SIM_ReadCapacity() == 1U );
+
+    for( i = 0U; i < sizeof( HostBuffer ); i++ )
+    {
+        HostBuffer[i] = ( uint8_t )( i * 7U );
+    }
+
+    SIM_Check( "MSC WRITE(10)", SIM_MSC_ReadWrite10( 1U, 100U, 4U, HostBuffer, NULL ) == 0 );
+    ( void )memset( HostBuffer, 0, sizeof( HostBuffer ) );
+    SIM_Check( "MSC READ(10)", ( SIM_MSC_ReadWrite10( 0U, 100U, 4U, HostBuffer, NULL ) == 0 ) &&
+               ( memcmp( HostBuffer, &StorageDisk[100U * SIM_MSC_BLOCK_SIZE], sizeof( HostBuffer ) ) == 0 ) &&
+               ( HostBuffer[1] == 7U ) );
+
+    /* 2 blocks asked in a 512-byte transfer: case 7 (Hi < Di), the IN pipe
+       halts and CLEAR_FEATURE must reach the MSC class */
+    halts = SIM_MSC_HaltsCleared;
+    read10[0] = SCSI_READ10;
+    SIM_MSC_PutBE( &read10[7], 2U, 2U );
+    status = SIM_MSC_Command( read10, sizeof( read10 ), 1U, HostBuffer, SIM_MSC_BLOCK_SIZE, NULL );
+    SIM_Check( "MSC halt on a length mismatch, cleared through the composite driver",
+               ( status == USBD_CSW_CMD_FAILED ) && ( SIM_MSC_HaltsCleared == ( halts + 1U ) ) );
+    SIM_Check( "MSC READ(10) after the halt",
+               SIM_MSC_ReadWrite10( 0U, 100U, 1U, HostBuffer, NULL ) == 0 );
+
+    prev = USBD_COMPOSITE_SelectClass( &USBD_Device, 2U );
+    SIM_Check( "HID SendReport with the HID class selected",
+               USBD_HID_SendReport( &USBD_Device, report, sizeof( report ) ) == USBD_OK );
+    USBD_COMPOSITE_SelectClass( &USBD_Device, prev );
+    SIM_Check( "HID report on its endpoint",
+               ( USBD_SIM_Transfer( &hsim_usb, HID_EPIN_ADDR, data, HID_EPIN_SIZE, 0U, &actual ) == USBD_SIM_OK ) &&
+               ( actual == HID_EPIN_SIZE ) && ( memcmp( data, report, sizeof( report ) ) == 0 ) );
+
+    prev = USBD_COMPOSITE_SelectClass( &USBD_Device, 0U );
+    written = USBD_CDC_Write( &USBD_Device, ( const uint8_t * )"abc", 3U );
+    USBD_COMPOSITE_SelectClass( &USBD_Device, prev );
+    SIM_Check( "CDC write with the CDC class selected", written == 3U );
+    SIM_Check( "CDC data on its endpoint",
+               ( USBD_SIM_Transfer( &hsim_usb, CDC_IN_EP, data, sizeof( data ), 0U, &actual ) == USBD_SIM_OK ) &&
+               ( actual == 3U ) && ( memcmp( data, "abc", 3U ) == 0 ) );
+    SIM_Check( "no class selected between the calls", prev == USBD_COMPOSITE_NO_CLASS );
+}
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval 0 when all checks passed
+  */
+int main( void )
+{
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, USBD_COMPOSITE_CLASS );
+    SIM_Check( "register CDC",
+               USBD_COMPOSITE_RegisterClass( &USBD_Device, USBD_CDC_CLASS, &CDC_fops ) == USBD_OK );
+    SIM_Check( "register MSC",
+               USBD_COMPOSITE_RegisterClass( &USBD_Device, USBD_MSC_CLASS, &STORAGE_fops ) == USBD_OK );
+    SIM_Check( "register HID",
+               USBD_COMPOSITE_RegisterClass( &USBD_Device, USBD_HID_CLASS, NULL ) == USBD_OK );
+    SIM_Check( "reject a class beyond USBD_COMPOSITE_MAX_CLASSES",
+               USBD_COMPOSITE_RegisterClass( &USBD_Device, USBD_HID_CLASS, NULL ) == USBD_FAIL );
+    USBD_Start( &USBD_Device );
+
+    SIM_CheckConfig();
+    SIM_CheckRequests();
+    SIM_CheckEndpoints();
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    /* A bus reset releases every class, the next configuration allocates again */
+    USBD_SIM_Connect( &hsim_usb );
+    SIM_Check( "bus reset frees the class data of every class",
+               ( SIM_Allocations == 0 ) && ( CDC_Initialized == 0 ) );
+    SIM_Check( "enumerate again", ( USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK ) &&
+               ( SIM_Allocations == 3 ) && ( CDC_Initialized == 1 ) );
+    SIM_Check( "MSC READ(10) after the bus reset",
+               ( SIM_ReadCapacity() == 1U ) && ( SIM_MSC_ReadWrite10( 0U, 100U, 1U, HostBuffer, NULL ) == 0 ) );
+
+    USBD_DeInit( &USBD_Device );
+    SIM_Check( "DeInit frees the class data", SIM_Allocations == 0 );
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
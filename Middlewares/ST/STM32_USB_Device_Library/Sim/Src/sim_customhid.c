@@ -0,0 +1,310 @@
+/**
+  ******************************************************************************
+  * @file    sim_customhid.c
+  * @author  MCD Application Team
+  * @brief   Host script of a high-rate CustomHID sensor: a 1 kHz timer
+  *          interrupt with +/-300 us jitter offers 8-byte reports carrying a
+  *          sequence number to USBD_CUSTOM_HID_SendReport, and the host reads
+  *          the interrupt IN endpoint:
+  *           - every frame, resubmitting its request at once,
+  *           - every frame, resubmitting 2% of its requests one frame late,
+  *           - the same with an 8 ms host stall every 100 ms,
+  *           - every other frame.
+  *          Reports the reports delivered and dropped, the IN packets, the
+  *          latency and the FIFO high-water mark, and checks that the
+  *          accepted reports arrive in order, none lost, and that the FIFO
+  *          counters match the host side. Built without the IN report FIFO
+  *          (sim_customhid_0), with a FIFO of 16 reports (sim_customhid) and
+  *          with packing into 64-byte packets (sim_customhid_pack).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_common.h"
+#include "usbd_customhid.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint8_t     interval;       /* Host polling period, frames */
+    uint32_t    late_pct;       /* Requests resubmitted one frame late, % */
+    uint32_t    stall_period;   /* 8 ms host stall every stall_period frames, 0: none */
+} SIM_CustomHIDCaseTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define HID_CASE_FRAMES               60000U      /* 60 s per case */
+#define HID_DRAIN_FRAMES              200U
+#define HID_STALL_FRAMES              8U
+#define HID_REPORT_SIZE               8U
+#define HID_PERIOD_US                 1000U       /* 1 kHz */
+#define HID_JITTER_US                 300U
+#define HID_TIME_SLOTS                1024U       /* Reports in flight, at most */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t CustomHID_Init( void );
+static int8_t CustomHID_DeInit( void );
+static int8_t CustomHID_OutEvent( uint8_t event_idx, uint8_t state );
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t CustomHID_ReportDesc[4] = { 0x06U, 0x00U, 0xFFU, 0xC0U };
+
+static USBD_CUSTOM_HID_ItfTypeDef CustomHID_fops =
+{
+    CustomHID_ReportDesc,
+    CustomHID_Init,
+    CustomHID_DeInit,
+    CustomHID_OutEvent
+};
+
+static const SIM_CustomHIDCaseTypeDef HID_Cases[] =
+{
+    { "bInterval 1",                1U, 0U,   0U },
+    { "bInterval 1, 2% late",       1U, 2U,   0U },
+    { "+ 8 ms stall every 100 ms",  1U, 2U, 100U },
+    { "bInterval 2",                2U, 0U,   0U },
+};
+
+/* Sensor: the timer interrupt */
+static uint8_t  Prod_Enabled;
+static uint64_t Prod_Next;
+static uint32_t Prod_Offered;
+static uint32_t Prod_Accepted;      /* Also the sequence number of the next report */
+static uint32_t Prod_Refused;
+static uint64_t Prod_Time[HID_TIME_SLOTS];
+/* Without the FIFO the class sends from the caller's buffer: one report in
+   flight, one being written */
+static uint8_t  Prod_Report[2][HID_REPORT_SIZE];
+
+/* Host side */
+static uint8_t  Host_InBuffer[CUSTOM_HID_EPIN_SIZE];
+static uint32_t Host_Reports;
+static uint32_t Host_Packets;
+static uint32_t Host_Errors;
+static uint64_t Host_LatencySum;
+static uint64_t Host_LatencyMax;
+
+/* Private functions ---------------------------------------------------------*/
+
+static int8_t CustomHID_Init( void )
+{
+    return ( USBD_OK );
+}
+
+static int8_t CustomHID_DeInit( void )
+{
+    return ( USBD_OK );
+}
+
+static int8_t CustomHID_OutEvent( uint8_t event_idx, uint8_t state )
+{
+    return ( USBD_OK );
+}
+
+/**
+  * @brief  Sensor timer interrupt: offers the reports due since the last
+  *         call. A refused report is lost, the next one keeps its sequence
+  *         number.
+  * @param  hsim: simulator handle
+  * @param  time_us: simulated time
+  * @retval None
+  */
+static void Prod_Tick( USBD_SIM_HandleTypeDef *hsim, uint64_t time_us )
+{
+    uint8_t *report;
+
+    while( ( Prod_Enabled != 0U ) && ( time_us >= Prod_Next ) )
+    {
+        report = Prod_Report[Prod_Accepted & 1U];
+        ( void )memset( report, 0, HID_REPORT_SIZE );
+        ( void )memcpy( report, &Prod_Accepted, sizeof( Prod_Accepted ) );
+        Prod_Time[Prod_Accepted % HID_TIME_SLOTS] = time_us;
+        Prod_Offered++;
+
+        if( USBD_CUSTOM_HID_SendReport( &USBD_Device, report, HID_REPORT_SIZE ) == USBD_OK )
+        {
+            Prod_Accepted++;
+        }
+        else
+        {
+            Prod_Refused++;
+        }
+
+        Prod_Next += ( HID_PERIOD_US - HID_JITTER_US ) + ( ( uint32_t )rand() % ( ( 2U * HID_JITTER_US ) + 1U ) );
+    }
+}
+
+/**
+  * @brief  Host IN request done: each report must hold the next sequence
+  *         number. The request is resubmitted from the main loop.
+  * @param  hsim: simulator handle
+  * @param  ep_addr: endpoint address
+  * @param  length: bytes received
+  * @retval None
+  */
+static void Host_InCplt( USBD_SIM_HandleTypeDef *hsim, uint8_t ep_addr, uint32_t length )
+{
+    uint64_t now = USBD_SIM_GetTime( hsim );
+    uint64_t latency;
+    uint32_t seq;
+    uint32_t offset;
+
+    if( length != 0U )
+    {
+        Host_Packets++;
+    }
+
+    for( offset = 0U; ( offset + HID_REPORT_SIZE ) <= length; offset += HID_REPORT_SIZE )
+    {
+        ( void )memcpy( &seq, &Host_InBuffer[offset], sizeof( seq ) );
+
+        if( seq != Host_Reports )
+        {
+            Host_Errors++;
+        }
+
+        latency = now - Prod_Time[seq % HID_TIME_SLOTS];
+        Host_LatencySum += latency;
+        Host_LatencyMax = MAX( Host_LatencyMax, latency );
+        Host_Reports = seq + 1U;
+    }
+
+    if( ( length % HID_REPORT_SIZE ) != 0U )
+    {
+        Host_Errors++;
+    }
+}
+
+/**
+  * @brief  Runs frames, the host resubmitting its IN request unless it is
+  *         late or stalled.
+  * @param  pcase: host behavior
+  * @param  nframes: number of frames
+  * @retval None
+  */
+static void SIM_RunHost( const SIM_CustomHIDCaseTypeDef *pcase, uint32_t nframes )
+{
+    USBD_SIM_EPTypeDef *ep = &hsim_usb.IN_ep[CUSTOM_HID_EPIN_ADDR & 0x7FU];
+    uint32_t k;
+
+    for( k = 0U; k < nframes; k++ )
+    {
+        if( ( ep->pipe_state != USBD_SIM_PIPE_BUSY ) &&
+                ( ( pcase->stall_period == 0U ) || ( ( hsim_usb.frame % pcase->stall_period ) >= HID_STALL_FRAMES ) ) &&
+                ( ( ( uint32_t )rand() % 100U ) >= pcase->late_pct ) )
+        {
+            USBD_SIM_Submit( &hsim_usb, CUSTOM_HID_EPIN_ADDR, Host_InBuffer, sizeof( Host_InBuffer ), 0U );
+        }
+
+        USBD_SIM_RunFrames( &hsim_usb, 1U );
+    }
+}
+
+/**
+  * @brief  Runs one host case and checks the reports.
+  * @param  pcase: host behavior
+  * @retval None
+  */
+static void SIM_RunCase( const SIM_CustomHIDCaseTypeDef *pcase )
+{
+    USBD_CUSTOM_HID_FifoStatsTypeDef stats;
+    uint8_t  status;
+    char     check[96];
+
+    Prod_Offered = 0U;
+    Prod_Accepted = 0U;
+    Prod_Refused = 0U;
+    Host_Reports = 0U;
+    Host_Packets = 0U;
+    Host_Errors = 0U;
+    Host_LatencySum = 0U;
+    Host_LatencyMax = 0U;
+
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, USBD_CUSTOM_HID_CLASS );
+    USBD_CUSTOM_HID_RegisterInterface( &USBD_Device, &CustomHID_fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "enumerate", ( USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK ) &&
+               ( hsim_usb.pma_overflow == 0U ) );
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    USBD_SIM_SetPipe( &hsim_usb, CUSTOM_HID_EPIN_ADDR, pcase->interval, Host_InCplt );
+    Prod_Next = USBD_SIM_GetTime( &hsim_usb ) + ( HID_PERIOD_US / 2U );
+    Prod_Enabled = 1U;
+    USBD_SIM_SetTick( &hsim_usb, Prod_Tick );
+
+    SIM_RunHost( pcase, HID_CASE_FRAMES );
+    Prod_Enabled = 0U;
+    SIM_RunHost( &HID_Cases[0], HID_DRAIN_FRAMES );
+
+    status = USBD_CUSTOM_HID_GetFifoStats( &USBD_Device, &stats );
+
+    printf( "%-26s offered %6u delivered %6u (%5.1f%%) dropped %6u, %6u packets, "
+            "latency avg %5.2f max %6.2f ms, FIFO peak %u\n",
+            pcase->name, ( unsigned )Prod_Offered, ( unsigned )Host_Reports,
+            ( 100.0 * Host_Reports ) / Prod_Offered, ( unsigned )Prod_Refused, ( unsigned )Host_Packets,
+            ( Host_Reports != 0U ) ? ( ( double )Host_LatencySum / 1000.0 / Host_Reports ) : 0.0,
+            ( double )Host_LatencyMax / 1000.0, ( unsigned )stats.MaxLevel );
+
+    ( void )snprintf( check, sizeof( check ), "%s: accepted reports in order, none lost", pcase->name );
+    SIM_Check( check, ( Host_Errors == 0U ) && ( Host_Reports == Prod_Accepted ) );
+
+#if ( USBD_CUSTOMHID_INREPORT_FIFO_SIZE > 0U )
+    ( void )snprintf( check, sizeof( check ), "%s: FIFO counters match the host", pcase->name );
+    SIM_Check( check, ( status == USBD_OK ) && ( stats.Queued == Prod_Accepted ) &&
+               ( stats.Sent == Host_Reports ) && ( stats.Dropped == Prod_Refused ) &&
+               ( stats.Packets == Host_Packets ) && ( stats.MaxLevel <= USBD_CUSTOMHID_INREPORT_FIFO_SIZE ) );
+#else
+    ( void )snprintf( check, sizeof( check ), "%s: no FIFO counters", pcase->name );
+    SIM_Check( check, status == USBD_FAIL );
+#endif /* USBD_CUSTOMHID_INREPORT_FIFO_SIZE */
+
+#if ( USBD_CUSTOMHID_INREPORT_PACKING == 1U )
+    ( void )snprintf( check, sizeof( check ), "%s: every report delivered", pcase->name );
+    SIM_Check( check, Prod_Refused == 0U );
+#endif /* USBD_CUSTOMHID_INREPORT_PACKING */
+
+    USBD_SIM_SetTick( &hsim_usb, NULL );
+    USBD_DeInit( &USBD_Device );
+    SIM_Check( "DeInit frees the class data", SIM_Allocations == 0 );
+}
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval 0 when all checks passed
+  */
+int main( void )
+{
+    uint32_t i;
+
+    printf( "%u-byte reports at 1 kHz +/-%u us, IN packets of %u B, FIFO %u reports%s, %u s per case\n",
+            ( unsigned )HID_REPORT_SIZE, ( unsigned )HID_JITTER_US, ( unsigned )CUSTOM_HID_EPIN_SIZE,
+            ( unsigned )USBD_CUSTOMHID_INREPORT_FIFO_SIZE,
+            ( USBD_CUSTOMHID_INREPORT_PACKING == 1U ) ? ", packed" : "",
+            ( unsigned )( HID_CASE_FRAMES / 1000U ) );
+
+    srand( 1U );
+
+    for( i = 0U; i < ( sizeof( HID_Cases ) / sizeof( HID_Cases[0] ) ); i++ )
+    {
+        SIM_RunCase( &HID_Cases[i] );
+    }
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
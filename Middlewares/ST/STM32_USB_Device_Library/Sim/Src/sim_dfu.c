@@ -0,0 +1,452 @@
+/**
+  ******************************************************************************
+  * @file    sim_dfu.c
+  * @author  MCD Application Team
+  * @brief   Host script of a DFU download: the DFU class and the Flash media
+  *          of the DFU_Standalone application (usbd_dfu_flash.c) on a model
+  *          of the STM32L1 Flash, driven by a host that behaves as dfu-util
+  *          (GETSTATUS, then wait bwPollTimeout while the device is busy):
+  *           - 98404 bytes after a mass erase, through the synchronous Write
+  *             of the media (WriteAsync and WritePoll removed) and through
+  *             the half-page writes run from SOF: download time, Flash busy
+  *             time, polls, longest time with the USB interrupt masked,
+  *           - short images at an address that is not half-page aligned,
+  *           - a half page that fails to program.
+  *          The Flash model takes tprog (3.94 ms) per word or half page and
+  *          per erased page, with the USB interrupt masked, and reads 0 once
+  *          erased. Built with one and two download buffers (sim_dfu_1,
+  *          sim_dfu).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <sys/mman.h>
+#include "sim_common.h"
+#include "usbd_dfu_flash.h"
+#include "stm32l1xx_hal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint32_t    size;
+    uint32_t    start;
+    uint8_t     async;          /* Media with WriteAsync and WritePoll */
+    int32_t     fail_at;        /* Half page that fails to program, -1 none */
+} SIM_DfuCaseTypeDef;
+
+typedef struct
+{
+    uint64_t    time_us;        /* Download, from SET_ADDRESS_POINTER to the reset */
+    uint64_t    flash_us;       /* Flash busy during the download */
+    uint32_t    polls;
+    uint32_t    busy_polls;     /* GETSTATUS answered dfuDNBUSY */
+    uint32_t    masked_us;      /* Longest time with the USB interrupt masked */
+    uint8_t     state;          /* Last bState */
+    uint8_t     status;         /* Last bStatus */
+    uint8_t     image_ok;
+    uint8_t     reset;
+} SIM_DfuResultTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define FLASH_TPROG_US                3940U       /* Word, half page or page erase */
+#define FLASH_SIM_SIZE                (USBD_DFU_APP_END_ADD - FLASH_BASE)
+#define FLASH_SIM_HALFPAGE            128U
+#define DFU_ERASED                    0x00U       /* Erased Flash of the STM32L1 */
+#define DFU_UNTOUCHED                 0xA5U
+#define DFU_MAX_POLLS                 100000U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static const SIM_DfuCaseTypeDef Dfu_Cases[] =
+{
+    { "synchronous Write",     98404U, USBD_DFU_APP_DEFAULT_ADD,         0U, -1 },
+    { "half pages from SOF",   98404U, USBD_DFU_APP_DEFAULT_ADD,         1U, -1 },
+    { "1 byte, unaligned",         1U, USBD_DFU_APP_DEFAULT_ADD + 0x46U, 1U, -1 },
+    { "127 bytes, unaligned",    127U, USBD_DFU_APP_DEFAULT_ADD + 0x46U, 1U, -1 },
+    { "1025 bytes, unaligned",  1025U, USBD_DFU_APP_DEFAULT_ADD + 0x46U, 1U, -1 },
+    { "4099 bytes, unaligned",  4099U, USBD_DFU_APP_DEFAULT_ADD + 0x7FU, 1U, -1 },
+    { "half page 10 fails",     8192U, USBD_DFU_APP_DEFAULT_ADD,         1U, 10 },
+};
+
+static USBD_DFU_MediaTypeDef Dfu_Media;
+static uint8_t  *Dfu_Image;
+
+/* Flash model */
+static uint8_t  *Flash_Mem;
+static uint64_t Flash_BusyUs;
+static uint64_t Flash_BlockStart;
+static uint64_t Flash_BlockEnd;
+static uint32_t Flash_MaskedUs;
+static uint32_t Flash_HalfPages;
+static int32_t  Flash_FailAt;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Flash_Program( uint32_t time_us );
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Accounts a Flash operation: the CPU waits with the USB interrupt
+  *         masked. Operations made back to back, before the bus could run,
+  *         add up to one masked period.
+  * @param  time_us: operation time
+  * @retval None
+  */
+static void Flash_Program( uint32_t time_us )
+{
+    uint64_t now = USBD_SIM_GetTime( &hsim_usb );
+
+    if( now < Flash_BlockEnd )
+    {
+        Flash_BlockEnd += time_us;
+    }
+    else
+    {
+        Flash_BlockStart = now;
+        Flash_BlockEnd = now + time_us;
+    }
+
+    if( ( Flash_BlockEnd - Flash_BlockStart ) > Flash_MaskedUs )
+    {
+        Flash_MaskedUs = ( uint32_t )( Flash_BlockEnd - Flash_BlockStart );
+    }
+
+    Flash_BusyUs += time_us;
+    USBD_SIM_Busy( &hsim_usb, time_us );
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock( void )
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock( void )
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase( FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError )
+{
+    if( ( pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES ) ||
+            ( ( pEraseInit->PageAddress % FLASH_PAGE_SIZE ) != 0U ) ||
+            ( ( pEraseInit->PageAddress + ( pEraseInit->NbPages * FLASH_PAGE_SIZE ) ) > USBD_DFU_APP_END_ADD ) )
+    {
+        return HAL_ERROR;
+    }
+
+    ( void )memset( ( void * )( uintptr_t )pEraseInit->PageAddress, DFU_ERASED,
+                    pEraseInit->NbPages * FLASH_PAGE_SIZE );
+    Flash_Program( pEraseInit->NbPages * FLASH_TPROG_US );
+    *PageError = 0xFFFFFFFFU;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program( uint32_t TypeProgram, uint32_t Address, uint32_t Data )
+{
+    if( ( TypeProgram != FLASH_TYPEPROGRAM_WORD ) || ( ( Address % 4U ) != 0U ) ||
+            ( Address < FLASH_BASE ) || ( Address >= USBD_DFU_APP_END_ADD ) )
+    {
+        return HAL_ERROR;
+    }
+
+    *( volatile uint32_t * )( uintptr_t )Address = Data;
+    Flash_Program( FLASH_TPROG_US );
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_HalfPageProgram( uint32_t Address, uint32_t *pBuffer )
+{
+    if( ( ( Address % FLASH_SIM_HALFPAGE ) != 0U ) ||
+            ( Address < FLASH_BASE ) || ( Address >= USBD_DFU_APP_END_ADD ) )
+    {
+        return HAL_ERROR;
+    }
+
+    if( ( int32_t )Flash_HalfPages++ == Flash_FailAt )
+    {
+        Flash_Program( FLASH_TPROG_US );
+        return HAL_ERROR;
+    }
+
+    ( void )memcpy( ( void * )( uintptr_t )Address, pBuffer, FLASH_SIM_HALFPAGE );
+    Flash_Program( FLASH_TPROG_US );
+
+    return HAL_OK;
+}
+
+/**
+  * @brief  GETSTATUS.
+  * @param  result: polls counted, bStatus and bState
+  * @retval bwPollTimeout, ms
+  */
+static uint32_t Host_GetStatus( SIM_DfuResultTypeDef *result )
+{
+    uint8_t  status[6] = { 0U };
+    uint16_t len = sizeof( status );
+
+    if( USBD_SIM_Control( &hsim_usb, 0xA1U, DFU_GETSTATUS, 0U, 0U, status, &len ) != USBD_SIM_OK )
+    {
+        result->state = 0xFFU;
+        return 0U;
+    }
+
+    result->polls++;
+    result->status = status[0];
+    result->state = status[4];
+
+    return ( uint32_t )status[1] | ( ( uint32_t )status[2] << 8 ) | ( ( uint32_t )status[3] << 16 );
+}
+
+/**
+  * @brief  DNLOAD, then GETSTATUS and wait bwPollTimeout while the device
+  *         is busy, as dfu-util does.
+  * @param  block: wValue, block number
+  * @param  pbuf: data
+  * @param  len: data length
+  * @param  result: polls counted, bStatus and bState
+  * @retval 1 when the device is back in dfuDNLOAD-IDLE
+  */
+static uint8_t Host_Download( uint16_t block, uint8_t *pbuf, uint16_t len, SIM_DfuResultTypeDef *result )
+{
+    uint32_t timeout;
+    uint32_t n;
+
+    if( USBD_SIM_Control( &hsim_usb, 0x21U, DFU_DNLOAD, block, 0U, pbuf, &len ) != USBD_SIM_OK )
+    {
+        return 0U;
+    }
+
+    for( n = 0U; n < DFU_MAX_POLLS; n++ )
+    {
+        timeout = Host_GetStatus( result );
+        USBD_SIM_RunFrames( &hsim_usb, timeout );
+
+        if( result->state != DFU_STATE_DNLOAD_BUSY )
+        {
+            break;
+        }
+
+        result->busy_polls++;
+    }
+
+    return ( result->state == DFU_STATE_DNLOAD_IDLE ) ? 1U : 0U;
+}
+
+/**
+  * @brief  Command of block 0: a command byte and an address.
+  * @param  cmd: DFU_CMD_xxx
+  * @param  addr: address
+  * @param  result: polls counted, bStatus and bState
+  * @retval 1 when the device is back in dfuDNLOAD-IDLE
+  */
+static uint8_t Host_Command( uint8_t cmd, uint32_t addr, SIM_DfuResultTypeDef *result )
+{
+    uint8_t buf[5];
+
+    buf[0] = cmd;
+    buf[1] = ( uint8_t )addr;
+    buf[2] = ( uint8_t )( addr >> 8 );
+    buf[3] = ( uint8_t )( addr >> 16 );
+    buf[4] = ( uint8_t )( addr >> 24 );
+
+    return Host_Download( 0U, buf, sizeof( buf ), result );
+}
+
+/**
+  * @brief  Checks the image in the Flash, the erased application area
+  *         around it and the untouched Flash below the application.
+  * @param  pcase: case
+  * @retval 1 if correct
+  */
+static uint8_t SIM_CheckFlash( const SIM_DfuCaseTypeDef *pcase )
+{
+    uint32_t addr;
+    uint8_t  expected;
+
+    if( memcmp( &Flash_Mem[pcase->start - FLASH_BASE], Dfu_Image, pcase->size ) != 0 )
+    {
+        return 0U;
+    }
+
+    for( addr = FLASH_BASE; addr < USBD_DFU_APP_END_ADD; addr++ )
+    {
+        if( ( addr >= pcase->start ) && ( addr < ( pcase->start + pcase->size ) ) )
+        {
+            continue;
+        }
+
+        expected = ( addr < USBD_DFU_APP_DEFAULT_ADD ) ? DFU_UNTOUCHED : DFU_ERASED;
+
+        if( Flash_Mem[addr - FLASH_BASE] != expected )
+        {
+            return 0U;
+        }
+    }
+
+    return 1U;
+}
+
+/**
+  * @brief  Erase, SET_ADDRESS_POINTER, blocks, then the zero-length DNLOAD
+  *         and GETSTATUS until the device resets.
+  * @param  pcase: case
+  * @param  result: measures
+  * @retval None
+  */
+static void SIM_RunCase( const SIM_DfuCaseTypeDef *pcase, SIM_DfuResultTypeDef *result )
+{
+    uint64_t t0;
+    uint64_t flash0;
+    uint32_t offset;
+    uint32_t len;
+    uint32_t timeout;
+    uint16_t block = 2U;
+    uint8_t  ok;
+    uint32_t n;
+
+    ( void )memset( result, 0, sizeof( *result ) );
+    ( void )memset( Flash_Mem, DFU_UNTOUCHED, FLASH_SIM_SIZE );
+    Flash_BlockStart = 0U;
+    Flash_BlockEnd = 0U;
+    Flash_HalfPages = 0U;
+    Flash_FailAt = pcase->fail_at;
+
+    for( n = 0U; n < pcase->size; n++ )
+    {
+        Dfu_Image[n] = ( uint8_t )rand();
+    }
+
+    Dfu_Media = USBD_DFU_Flash_fops;
+
+    if( pcase->async == 0U )
+    {
+        Dfu_Media.WriteAsync = NULL;
+        Dfu_Media.WritePoll = NULL;
+    }
+
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, USBD_DFU_CLASS );
+    USBD_DFU_RegisterMedia( &USBD_Device, &Dfu_Media );
+    USBD_Start( &USBD_Device );
+
+    ok = ( USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK ) ? 1U : 0U;
+    ok &= Host_Command( DFU_CMD_ERASE, USBD_DFU_APP_DEFAULT_ADD, result );
+
+    /* The download, the erase left out */
+    t0 = USBD_SIM_GetTime( &hsim_usb );
+    flash0 = Flash_BusyUs;
+    Flash_MaskedUs = 0U;
+    ok &= Host_Command( DFU_CMD_SETADDRESSPOINTER, pcase->start, result );
+
+    for( offset = 0U; ( ok != 0U ) && ( offset < pcase->size ); offset += USBD_DFU_XFER_SIZE )
+    {
+        len = MIN( USBD_DFU_XFER_SIZE, pcase->size - offset );
+        ok = Host_Download( block, &Dfu_Image[offset], ( uint16_t )len, result );
+        block++;
+    }
+
+    if( ok != 0U )
+    {
+        ( void )USBD_SIM_Control( &hsim_usb, 0x21U, DFU_DNLOAD, block, 0U, NULL, NULL );
+
+        for( n = 0U; ( n < DFU_MAX_POLLS ) && ( hsim_usb.system_resets == 0U ); n++ )
+        {
+            timeout = Host_GetStatus( result );
+            USBD_SIM_RunFrames( &hsim_usb, timeout );
+
+            if( ( result->state != DFU_STATE_MANIFEST_SYNC ) && ( result->state != DFU_STATE_MANIFEST ) &&
+                    ( hsim_usb.system_resets == 0U ) )
+            {
+                break;
+            }
+        }
+    }
+
+    result->time_us = USBD_SIM_GetTime( &hsim_usb ) - t0;
+    result->flash_us = Flash_BusyUs - flash0;
+    result->masked_us = Flash_MaskedUs;
+    result->reset = ( hsim_usb.system_resets != 0U ) ? 1U : 0U;
+    result->image_ok = SIM_CheckFlash( pcase );
+
+    printf( "%-22s %6u B at 0x%08x: %8.1f ms, Flash busy %8.1f ms (%5.1f%%), %5u polls (%4u busy), "
+            "USB interrupt masked at most %7.2f ms, %6.1f KB/s\n",
+            pcase->name, ( unsigned )pcase->size, ( unsigned )pcase->start, ( double )result->time_us / 1000.0,
+            ( double )result->flash_us / 1000.0, ( 100.0 * ( double )result->flash_us ) / ( double )result->time_us,
+            ( unsigned )result->polls, ( unsigned )result->busy_polls, ( double )result->masked_us / 1000.0,
+            ( double )pcase->size / 1.024 / ( ( double )result->time_us / 1000.0 ) );
+
+    USBD_DeInit( &USBD_Device );
+    hsim_usb.system_resets = 0U;
+}
+
+int main( void )
+{
+    SIM_DfuResultTypeDef result[sizeof( Dfu_Cases ) / sizeof( Dfu_Cases[0] )];
+    char     check[128];
+    uint32_t i;
+    uint8_t  ok;
+
+    Flash_Mem = mmap( ( void * )FLASH_BASE, FLASH_SIM_SIZE, PROT_READ | PROT_WRITE,
+                      MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+    if( Flash_Mem != ( uint8_t * )FLASH_BASE )
+    {
+        printf( "cannot map the Flash at 0x%08lx\n", ( unsigned long )FLASH_BASE );
+        return 2;
+    }
+
+    Dfu_Image = malloc( USBD_DFU_APP_END_ADD - USBD_DFU_APP_DEFAULT_ADD );
+    srand( 1U );
+
+    printf( "%u download buffer(s) of %u B, tprog %u us\n", ( unsigned )USBD_DFU_BUFFER_NUM,
+            ( unsigned )USBD_DFU_XFER_SIZE, ( unsigned )FLASH_TPROG_US );
+
+    for( i = 0U; i < ( sizeof( Dfu_Cases ) / sizeof( Dfu_Cases[0] ) ); i++ )
+    {
+        SIM_RunCase( &Dfu_Cases[i], &result[i] );
+    }
+
+    SIM_Check( "synchronous Write: image programmed, device reset",
+               ( result[0].image_ok != 0U ) && ( result[0].reset != 0U ) );
+    SIM_Check( "half pages from SOF: image programmed, device reset",
+               ( result[1].image_ok != 0U ) && ( result[1].reset != 0U ) );
+    SIM_Check( "half pages from SOF: USB interrupt masked one tprog at most",
+               result[1].masked_us <= FLASH_TPROG_US );
+    SIM_Check( "half pages from SOF: download 10 times faster than the synchronous Write",
+               ( result[1].time_us * 10U ) < result[0].time_us );
+
+    ok = 1U;
+
+    for( i = 2U; i < 6U; i++ )
+    {
+        ok &= result[i].image_ok & result[i].reset;
+    }
+
+    SIM_Check( "short images at unaligned addresses: image programmed, Flash around it kept", ok );
+
+    ( void )snprintf( check, sizeof( check ), "failed half page: dfuERROR, errWRITE (state %u, status %u)",
+                      ( unsigned )result[6].state, ( unsigned )result[6].status );
+    SIM_Check( check, ( result[6].state == DFU_STATE_ERROR ) && ( result[6].status == DFU_ERROR_WRITE ) &&
+               ( result[6].reset == 0U ) );
+    SIM_Check( "DeInit frees the class data", SIM_Allocations == 0 );
+
+    free( Dfu_Image );
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
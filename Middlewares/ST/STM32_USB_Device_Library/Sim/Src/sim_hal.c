@@ -0,0 +1,413 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.c
+  * @author  MCD Application Team
+  * @brief   The USB peripheral of the STM32L1 for the HAL PCD driver running
+  *          on the host:
+  *           - the peripheral registers and the packet memory (PMA, one
+  *             half-word in each 32-bit word) are mapped at their addresses,
+  *           - the endpoint registers are a register file: the DTOG and STAT
+  *             bits toggle when written 1, CTR_RX and CTR_TX are cleared
+  *             when written 0, and ISTR reports the endpoint with a correct
+  *             transfer, as the peripheral does.
+  *          The host side of a script moves the data with SIM_HAL_EPSet and
+  *          the PMA helpers.
+  *          With USE_USB_PMA_DMA, DMA1 is emulated too: the memory to memory
+  *          transfer of an enabled channel is made when the driver next
+  *          reads the DMA registers, and SIM_HAL_DMAFailNext turns the next
+  *          transfer into a transfer error.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "sim_hal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Pages holding the USB registers and the PMA, and EXTI */
+#define SIM_HAL_USB_PAGE              0x40005000UL
+#define SIM_HAL_USB_PAGE_SIZE         0x2000UL
+#define SIM_HAL_EXTI_PAGE             0x40010000UL
+#define SIM_HAL_EXTI_PAGE_SIZE        0x1000UL
+/* Pages holding RCC and DMA1 */
+#define SIM_HAL_AHB_PAGE              0x40023000UL
+#define SIM_HAL_AHB_PAGE_SIZE         0x4000UL
+/* User memory below 4 GB, the DMA takes 32-bit addresses */
+#define SIM_HAL_LOW_PAGE              0x30000000UL
+#define SIM_HAL_LOW_PAGE_SIZE         0x10000UL
+
+#define SIM_HAL_EP_RW                 (USB_EP_T_FIELD | USB_EP_KIND | USB_EPADDR_FIELD)
+#define SIM_HAL_EP_TOGGLE             (USB_EP_DTOG_RX | USB_EPRX_STAT | USB_EP_DTOG_TX | USB_EPTX_STAT)
+#define SIM_HAL_EP_RC_W0              (USB_EP_CTR_RX | USB_EP_CTR_TX)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+uint16_t SIM_HAL_EPR[SIM_HAL_EP_NUM];
+
+static SIM_HAL_HookTypeDef SIM_HAL_WriteHook;
+static uint32_t SIM_HAL_LowUsed;
+
+#if (USE_USB_PMA_DMA == 1U)
+uint32_t SIM_HAL_DMACopies;
+uint8_t  SIM_HAL_DMAFailNext;
+#endif /* USE_USB_PMA_DMA */
+
+/* Private function prototypes -----------------------------------------------*/
+static void SIM_HAL_Map( uintptr_t addr, size_t size );
+static void SIM_HAL_UpdateISTR( void );
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Maps the peripheral memory used by the driver, once.
+  * @retval None
+  */
+void SIM_HAL_Init( void )
+{
+    static uint8_t mapped = 0U;
+
+    if( mapped == 0U )
+    {
+        SIM_HAL_Map( SIM_HAL_USB_PAGE, SIM_HAL_USB_PAGE_SIZE );
+        SIM_HAL_Map( SIM_HAL_EXTI_PAGE, SIM_HAL_EXTI_PAGE_SIZE );
+        SIM_HAL_Map( SIM_HAL_AHB_PAGE, SIM_HAL_AHB_PAGE_SIZE );
+        SIM_HAL_Map( SIM_HAL_LOW_PAGE, SIM_HAL_LOW_PAGE_SIZE );
+        mapped = 1U;
+    }
+
+    SIM_HAL_Reset();
+}
+
+/**
+  * @brief  Puts the peripheral in its reset state. The PMA is filled with a
+  *         pattern, not cleared, so that a buffer read before it was
+  *         written shows.
+  * @retval None
+  */
+void SIM_HAL_Reset( void )
+{
+    ( void )memset( SIM_HAL_EPR, 0, sizeof( SIM_HAL_EPR ) );
+    ( void )memset( ( void * )USB, 0, sizeof( USB_TypeDef ) );
+    ( void )memset( ( void * )( USB_BASE + 0x400U ), 0xA5, PCD_PMA_SIZE * PMA_ACCESS );
+    ( void )memset( ( void * )DMA1_BASE, 0, 0x100U );
+    SIM_HAL_WriteHook = NULL;
+}
+
+/**
+  * @brief  Write of an endpoint register by the driver.
+  * @param  ep: endpoint number
+  * @param  value: value written
+  * @retval None
+  */
+void SIM_HAL_EPWrite( uint32_t ep, uint16_t value )
+{
+    uint16_t reg = SIM_HAL_EPR[ep];
+
+    reg = ( uint16_t )( ( reg & ~SIM_HAL_EP_RW ) | ( value & SIM_HAL_EP_RW ) );
+    reg ^= ( uint16_t )( value & SIM_HAL_EP_TOGGLE );
+    reg &= ( uint16_t )( value | ~SIM_HAL_EP_RC_W0 );
+    SIM_HAL_EPR[ep] = reg;
+    SIM_HAL_UpdateISTR();
+
+    /* The bus runs while the driver works */
+    if( SIM_HAL_WriteHook != NULL )
+    {
+        SIM_HAL_WriteHook();
+    }
+}
+
+/**
+  * @brief  Read of an endpoint register by the driver.
+  * @param  ep: endpoint number
+  * @retval Register value
+  */
+uint16_t SIM_HAL_EPRead( uint32_t ep )
+{
+    return SIM_HAL_EPR[ep];
+}
+
+/**
+  * @brief  Change of an endpoint register by the peripheral: the end of a
+  *         transaction on the bus.
+  * @param  ep: endpoint number
+  * @param  value: new register value
+  * @retval None
+  */
+void SIM_HAL_EPSet( uint32_t ep, uint16_t value )
+{
+    SIM_HAL_EPR[ep] = value;
+    SIM_HAL_UpdateISTR();
+}
+
+/**
+  * @brief  Sets the function called after each endpoint register write made
+  *         by the driver, NULL for none.
+  * @param  hook: function to call
+  * @retval None
+  */
+void SIM_HAL_SetWriteHook( SIM_HAL_HookTypeDef hook )
+{
+    SIM_HAL_WriteHook = hook;
+}
+
+/**
+  * @brief  Entry of the buffer table.
+  * @param  ep: endpoint number
+  * @param  entry: SIM_HAL_BTABLE_xxx
+  * @retval Address of the entry
+  */
+volatile uint16_t *SIM_HAL_BTable( uint32_t ep, uint32_t entry )
+{
+    return ( volatile uint16_t * )( USB_BASE + 0x400U +
+                                    ( ( USB->BTABLE + ( ep * 8U ) + entry ) * PMA_ACCESS ) );
+}
+
+/**
+  * @brief  Stores a packet in the PMA, as the peripheral does on reception.
+  * @param  addr: PMA address
+  * @param  pbuf: packet
+  * @param  len: packet length
+  * @retval None
+  */
+void SIM_HAL_PMAPut( uint16_t addr, const uint8_t *pbuf, uint32_t len )
+{
+    uint32_t i;
+    uint16_t val;
+
+    for( i = 0U; i < len; i += 2U )
+    {
+        val = pbuf[i];
+
+        if( ( i + 1U ) < len )
+        {
+            val |= ( uint16_t )( ( uint16_t )pbuf[i + 1U] << 8 );
+        }
+
+        *( volatile uint16_t * )( USB_BASE + 0x400U + ( ( addr + i ) * PMA_ACCESS ) ) = val;
+    }
+}
+
+/**
+  * @brief  Reads a packet from the PMA, as the peripheral does on
+  *         transmission.
+  * @param  addr: PMA address
+  * @param  pbuf: packet
+  * @param  len: packet length
+  * @retval None
+  */
+void SIM_HAL_PMAGet( uint16_t addr, uint8_t *pbuf, uint32_t len )
+{
+    uint32_t i;
+    uint16_t val;
+
+    for( i = 0U; i < len; i++ )
+    {
+        val = *( volatile uint16_t * )( USB_BASE + 0x400U + ( ( addr + ( i & ~1U ) ) * PMA_ACCESS ) );
+        pbuf[i] = ( uint8_t )( ( ( i & 1U ) != 0U ) ? ( val >> 8 ) : val );
+    }
+}
+
+/**
+  * @brief  Size of a reception buffer, from its COUNT_RX entry.
+  * @param  count: COUNT_RX value
+  * @retval Bytes the peripheral may store
+  */
+uint32_t SIM_HAL_RxCapacity( uint16_t count )
+{
+    uint32_t blocks = ( ( uint32_t )count >> 10 ) & 0x1FU;
+
+    return ( ( count & 0x8000U ) != 0U ) ? ( 32U * ( blocks + 1U ) ) : ( 2U * blocks );
+}
+
+/**
+  * @brief  Allocates user memory below 4 GB, as on the device where the DMA
+  *         can reach any buffer. The memory is never freed.
+  * @param  size: bytes
+  * @retval Memory, 4-byte aligned
+  */
+void *SIM_HAL_LowAlloc( uint32_t size )
+{
+    uint8_t *p = ( uint8_t * )SIM_HAL_LOW_PAGE + SIM_HAL_LowUsed;
+
+    size = ( size + 3U ) & ~3U;
+
+    if( ( SIM_HAL_LowUsed + size ) > SIM_HAL_LOW_PAGE_SIZE )
+    {
+        printf( "out of low memory\n" );
+        exit( 2 );
+    }
+
+    SIM_HAL_LowUsed += size;
+    return p;
+}
+
+#if (USE_USB_PMA_DMA == 1U)
+/**
+  * @brief  Access of the driver to the DMA1 registers. Pending IFCR writes
+  *         clear their flags, then the enabled memory to memory transfer of
+  *         channel USB_PMA_DMA_CHANNEL is made, with its sizes, increments
+  *         and direction, and sets TCIF, or TEIF if SIM_HAL_DMAFailNext is
+  *         set.
+  * @retval DMA1 registers
+  */
+DMA_TypeDef *SIM_HAL_DMA1( void )
+{
+    DMA_TypeDef *dma = ( DMA_TypeDef * )DMA1_BASE;
+    DMA_Channel_TypeDef *channel = USB_PMA_DMA_CHANNEL_INSTANCE;
+    uint32_t shift = 4U * ( USB_PMA_DMA_CHANNEL - 1U );
+    uint32_t ccr = channel->CCR;
+    uint32_t clear = dma->IFCR;
+    uint32_t psize, msize, i, val;
+    uintptr_t paddr, maddr;
+
+    /* CGIFx clears the four flags of channel x */
+    for( i = 0U; i < 7U; i++ )
+    {
+        if( ( clear & ( DMA_IFCR_CGIF1 << ( 4U * i ) ) ) != 0U )
+        {
+            clear |= 0xFU << ( 4U * i );
+        }
+    }
+
+    dma->ISR &= ~clear;
+    dma->IFCR = 0U;
+
+    if( ( ( ccr & DMA_CCR_EN ) == 0U ) || ( ( ccr & DMA_CCR_MEM2MEM ) == 0U ) || ( channel->CNDTR == 0U ) )
+    {
+        return dma;
+    }
+
+    if( SIM_HAL_DMAFailNext != 0U )
+    {
+        SIM_HAL_DMAFailNext = 0U;
+        channel->CNDTR = 0U;
+        dma->ISR |= ( DMA_ISR_TEIF1 | DMA_ISR_GIF1 ) << shift;
+        return dma;
+    }
+
+    psize = 1U << ( ( ccr & DMA_CCR_PSIZE ) >> DMA_CCR_PSIZE_Pos );
+    msize = 1U << ( ( ccr & DMA_CCR_MSIZE ) >> DMA_CCR_MSIZE_Pos );
+    paddr = channel->CPAR;
+    maddr = channel->CMAR;
+
+    if( ( ( paddr % psize ) != 0U ) || ( ( maddr % msize ) != 0U ) )
+    {
+        printf( "DMA transfer misaligned: CPAR 0x%08lx CMAR 0x%08lx\n",
+                ( unsigned long )paddr, ( unsigned long )maddr );
+        exit( 2 );
+    }
+
+    for( i = channel->CNDTR; i != 0U; i-- )
+    {
+        /* Values are zero-extended or truncated to the destination size */
+        if( ( ccr & DMA_CCR_DIR ) != 0U )
+        {
+            val = ( msize == 2U ) ? *( volatile uint16_t * )maddr : *( volatile uint32_t * )maddr;
+
+            if( psize == 4U )
+            {
+                *( volatile uint32_t * )paddr = val;
+            }
+            else
+            {
+                *( volatile uint16_t * )paddr = ( uint16_t )val;
+            }
+        }
+        else
+        {
+            val = ( psize == 2U ) ? *( volatile uint16_t * )paddr : *( volatile uint32_t * )paddr;
+
+            if( msize == 4U )
+            {
+                *( volatile uint32_t * )maddr = val;
+            }
+            else
+            {
+                *( volatile uint16_t * )maddr = ( uint16_t )val;
+            }
+        }
+
+        paddr += ( ( ccr & DMA_CCR_PINC ) != 0U ) ? psize : 0U;
+        maddr += ( ( ccr & DMA_CCR_MINC ) != 0U ) ? msize : 0U;
+    }
+
+    channel->CNDTR = 0U;
+    SIM_HAL_DMACopies++;
+    dma->ISR |= ( DMA_ISR_TCIF1 | DMA_ISR_GIF1 ) << shift;
+    return dma;
+}
+#endif /* USE_USB_PMA_DMA */
+
+/**
+  * @brief  HAL time base, not used by the scripts.
+  * @retval 0
+  */
+uint32_t HAL_GetTick( void )
+{
+    return 0U;
+}
+
+void HAL_Delay( uint32_t Delay )
+{
+}
+
+/**
+  * @brief  Maps memory at the address of a peripheral.
+  * @param  addr: page address
+  * @param  size: bytes
+  * @retval None
+  */
+static void SIM_HAL_Map( uintptr_t addr, size_t size )
+{
+    void *p = mmap( ( void * )addr, size, PROT_READ | PROT_WRITE,
+                    MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+    if( p != ( void * )addr )
+    {
+        printf( "cannot map the peripheral memory at 0x%08lx\n", ( unsigned long )addr );
+        exit( 2 );
+    }
+}
+
+/**
+  * @brief  ISTR: CTR, DIR and EP_ID of the first endpoint with a correct
+  *         transfer, as the peripheral reports them.
+  * @retval None
+  */
+static void SIM_HAL_UpdateISTR( void )
+{
+    uint16_t istr = ( uint16_t )( USB->ISTR & ~( USB_ISTR_CTR | USB_ISTR_DIR | USB_ISTR_EP_ID ) );
+    uint32_t ep;
+
+    for( ep = 0U; ep < SIM_HAL_EP_NUM; ep++ )
+    {
+        if( ( SIM_HAL_EPR[ep] & SIM_HAL_EP_RC_W0 ) != 0U )
+        {
+            istr |= ( uint16_t )( USB_ISTR_CTR | ep );
+
+            if( ( SIM_HAL_EPR[ep] & USB_EP_CTR_RX ) != 0U )
+            {
+                istr |= USB_ISTR_DIR;
+            }
+
+            break;
+        }
+    }
+
+    USB->ISTR = istr;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
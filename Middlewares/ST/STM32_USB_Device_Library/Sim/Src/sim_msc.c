@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file    sim_msc.c
+  * @author  MCD Application Team
+  * @brief   Host side of the Mass Storage Bulk-Only Transport, shared by the
+  *          MSC simulation scripts: CBW, data stage and CSW, with the halt
+  *          recovery of the BOT specification (5.3.3 and 6.7).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_msc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SIM_MSC_CBW_SIGNATURE         0x43425355U
+#define SIM_MSC_CSW_SIGNATURE         0x53425355U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+uint32_t SIM_MSC_HaltsCleared;
+
+static uint32_t SIM_MSC_Tag = 1U;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SIM_MSC_PutLE( uint8_t *p, uint32_t value );
+static uint32_t SIM_MSC_GetLE( const uint8_t *p );
+static USBD_SIM_StatusTypeDef SIM_MSC_ClearHalt( uint8_t ep_addr );
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Runs one command: CBW, data stage, CSW. A stalled data stage
+  *         or CSW is recovered with CLEAR_FEATURE(ENDPOINT_HALT), as a host
+  *         driver does.
+  * @param  cb: command block
+  * @param  cb_length: command block length, 6 to 16
+  * @param  dir_in: 1 for a device to host data stage
+  * @param  pbuf: data stage buffer
+  * @param  length: dCBWDataTransferLength
+  * @param  presidue: dCSWDataResidue, may be NULL
+  * @retval bCSWStatus, or -1 when the transport failed
+  */
+int SIM_MSC_Command( const uint8_t *cb, uint8_t cb_length, uint8_t dir_in,
+                     uint8_t *pbuf, uint32_t length, uint32_t *presidue )
+{
+    uint8_t  cbw[USBD_BOT_CBW_LENGTH];
+    uint8_t  csw[USBD_BOT_CSW_LENGTH];
+    uint32_t tag = SIM_MSC_Tag++;
+    uint32_t actual;
+    USBD_SIM_StatusTypeDef ret;
+
+    ( void )memset( cbw, 0, sizeof( cbw ) );
+    SIM_MSC_PutLE( &cbw[0], SIM_MSC_CBW_SIGNATURE );
+    SIM_MSC_PutLE( &cbw[4], tag );
+    SIM_MSC_PutLE( &cbw[8], length );
+    cbw[12] = ( dir_in != 0U ) ? 0x80U : 0x00U;
+    cbw[14] = cb_length;
+    ( void )memcpy( &cbw[15], cb, cb_length );
+
+    if( USBD_SIM_Transfer( &hsim_usb, MSC_EPOUT_ADDR, cbw, sizeof( cbw ), 0U, &actual ) != USBD_SIM_OK )
+    {
+        return -1;
+    }
+
+    if( length != 0U )
+    {
+        uint8_t ep_addr = ( dir_in != 0U ) ? MSC_EPIN_ADDR : MSC_EPOUT_ADDR;
+
+        ret = USBD_SIM_Transfer( &hsim_usb, ep_addr, pbuf, length, 0U, &actual );
+
+        if( ret == USBD_SIM_STALL )
+        {
+            ret = SIM_MSC_ClearHalt( ep_addr );
+        }
+
+        if( ret != USBD_SIM_OK )
+        {
+            return -1;
+        }
+    }
+
+    ret = USBD_SIM_Transfer( &hsim_usb, MSC_EPIN_ADDR, csw, sizeof( csw ), 0U, &actual );
+
+    if( ret == USBD_SIM_STALL )
+    {
+        if( SIM_MSC_ClearHalt( MSC_EPIN_ADDR ) != USBD_SIM_OK )
+        {
+            return -1;
+        }
+
+        ret = USBD_SIM_Transfer( &hsim_usb, MSC_EPIN_ADDR, csw, sizeof( csw ), 0U, &actual );
+    }
+
+    if( ( ret != USBD_SIM_OK ) || ( actual != sizeof( csw ) ) ||
+        ( SIM_MSC_GetLE( &csw[0] ) != SIM_MSC_CSW_SIGNATURE ) || ( SIM_MSC_GetLE( &csw[4] ) != tag ) )
+    {
+        return -1;
+    }
+
+    if( presidue != NULL )
+    {
+        *presidue = SIM_MSC_GetLE( &csw[8] );
+    }
+
+    return ( int )csw[12];
+}
+
+/**
+  * @brief  Runs a READ(10) or WRITE(10) of 512-byte blocks.
+  * @param  write: 1 for WRITE(10)
+  * @param  lba: first block
+  * @param  blocks: number of blocks
+  * @param  pbuf: data
+  * @param  presidue: dCSWDataResidue, may be NULL
+  * @retval bCSWStatus, or -1 when the transport failed
+  */
+int SIM_MSC_ReadWrite10( uint8_t write, uint32_t lba, uint16_t blocks,
+                         uint8_t *pbuf, uint32_t *presidue )
+{
+    uint8_t cb[10] = { 0U };
+
+    cb[0] = ( write != 0U ) ? SCSI_WRITE10 : SCSI_READ10;
+    SIM_MSC_PutBE( &cb[2], lba, 4U );
+    SIM_MSC_PutBE( &cb[7], blocks, 2U );
+
+    return SIM_MSC_Command( cb, sizeof( cb ), ( write != 0U ) ? 0U : 1U, pbuf,
+                            ( uint32_t )blocks * SIM_MSC_BLOCK_SIZE, presidue );
+}
+
+/**
+  * @brief  Runs a REQUEST SENSE.
+  * @param  pasc: additional sense code
+  * @retval sense key, or -1 when the command failed
+  */
+int SIM_MSC_RequestSense( uint8_t *pasc )
+{
+    uint8_t cb[6] = { SCSI_REQUEST_SENSE, 0U, 0U, 0U, REQUEST_SENSE_DATA_LEN, 0U };
+    uint8_t sense[REQUEST_SENSE_DATA_LEN];
+
+    ( void )memset( sense, 0, sizeof( sense ) );
+
+    if( SIM_MSC_Command( cb, sizeof( cb ), 1U, sense, sizeof( sense ), NULL ) != 0 )
+    {
+        return -1;
+    }
+
+    *pasc = sense[12];
+    return ( int )( sense[2] & 0x0FU );
+}
+
+/**
+  * @brief  Stores a big-endian field of a command block.
+  * @param  p: destination
+  * @param  value: field value
+  * @param  length: field length in bytes
+  * @retval None
+  */
+void SIM_MSC_PutBE( uint8_t *p, uint64_t value, uint8_t length )
+{
+    while( length > 0U )
+    {
+        length--;
+        p[length] = ( uint8_t )value;
+        value >>= 8;
+    }
+}
+
+static void SIM_MSC_PutLE( uint8_t *p, uint32_t value )
+{
+    p[0] = ( uint8_t )value;
+    p[1] = ( uint8_t )( value >> 8 );
+    p[2] = ( uint8_t )( value >> 16 );
+    p[3] = ( uint8_t )( value >> 24 );
+}
+
+static uint32_t SIM_MSC_GetLE( const uint8_t *p )
+{
+    return ( uint32_t )p[0] | ( ( uint32_t )p[1] << 8 ) |
+           ( ( uint32_t )p[2] << 16 ) | ( ( uint32_t )p[3] << 24 );
+}
+
+static USBD_SIM_StatusTypeDef SIM_MSC_ClearHalt( uint8_t ep_addr )
+{
+    SIM_MSC_HaltsCleared++;
+
+    return USBD_SIM_Control( &hsim_usb, 0x02U, USB_REQ_CLEAR_FEATURE, USB_FEATURE_EP_HALT,
+                             ep_addr, NULL, NULL );
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,394 @@
+/**
+  ******************************************************************************
+  * @file    sim_msc_pipeline.c
+  * @author  MCD Application Team
+  * @brief   Host script: MSC throughput with the synchronous and the
+  *          asynchronous storage interfaces, on a media model with SD card
+  *          latencies, then odd sizes and media errors in the middle of a
+  *          transfer. Build it with MSC_MEDIA_BUFFERS set to 1 and to 2.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_msc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DISK_BLOCKS                   8192U
+#define BENCH_BLOCKS_PER_COMMAND      128U          /* 64 KiB commands */
+#define BENCH_COMMANDS                32U           /* 2 MiB */
+#define BENCH_SIZE                    ( BENCH_BLOCKS_PER_COMMAND * BENCH_COMMANDS * SIM_MSC_BLOCK_SIZE )
+
+/* Media model, in us: an SD card in SPI or SDIO 1-bit mode */
+#define MEDIA_READ_SETUP_US           250U
+#define MEDIA_READ_BLOCK_US           45U
+#define MEDIA_WRITE_SETUP_US          600U
+#define MEDIA_WRITE_BLOCK_US          60U
+#define MEDIA_ASYNC_START_US          5U            /* DMA set-up */
+
+#define MEDIA_NO_FAILURE              0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t STORAGE_Init( uint8_t lun );
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size );
+static int8_t STORAGE_IsReady( uint8_t lun );
+static int8_t STORAGE_IsWriteProtected( uint8_t lun );
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_GetMaxLun( void );
+static int8_t STORAGE_ReadAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_WriteAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+
+/* Private variables ---------------------------------------------------------*/
+static int8_t STORAGE_Inquirydata[STANDARD_INQUIRY_DATA_LEN] = { 0x00, 0x80, 0x02, 0x02, ( STANDARD_INQUIRY_DATA_LEN - 5 ) };
+
+static USBD_StorageTypeDef STORAGE_SyncFops =
+{
+    STORAGE_Init,
+    STORAGE_GetCapacity,
+    STORAGE_IsReady,
+    STORAGE_IsWriteProtected,
+    STORAGE_Read,
+    STORAGE_Write,
+    STORAGE_GetMaxLun,
+    STORAGE_Inquirydata,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+static USBD_StorageTypeDef STORAGE_AsyncFops =
+{
+    STORAGE_Init,
+    STORAGE_GetCapacity,
+    STORAGE_IsReady,
+    STORAGE_IsWriteProtected,
+    STORAGE_Read,
+    STORAGE_Write,
+    STORAGE_GetMaxLun,
+    STORAGE_Inquirydata,
+    STORAGE_ReadAsync,
+    STORAGE_WriteAsync,
+    NULL,
+    NULL,
+};
+
+static uint8_t  StorageDisk[DISK_BLOCKS * SIM_MSC_BLOCK_SIZE];
+static uint32_t StorageFailBlock = MEDIA_NO_FAILURE;
+
+/* Asynchronous transfer in progress */
+static uint8_t  Media_Busy;
+static uint8_t  Media_Write;
+static uint8_t  *Media_Buffer;
+static uint32_t Media_Block;
+static uint16_t Media_Length;
+static uint64_t Media_DoneTime;
+
+static uint8_t HostBuffer[BENCH_SIZE];
+static uint8_t RefBuffer[BENCH_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint8_t Media_Fails( uint32_t blk_addr, uint16_t blk_len )
+{
+    return ( ( StorageFailBlock >= blk_addr ) && ( StorageFailBlock < ( blk_addr + blk_len ) ) ) ? 1U : 0U;
+}
+
+static int8_t Media_Access( uint8_t write, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    if( Media_Fails( blk_addr, blk_len ) != 0U )
+    {
+        return ( -1 );
+    }
+
+    if( write != 0U )
+    {
+        ( void )memcpy( &StorageDisk[blk_addr * SIM_MSC_BLOCK_SIZE], buf, blk_len * SIM_MSC_BLOCK_SIZE );
+    }
+    else
+    {
+        ( void )memcpy( buf, &StorageDisk[blk_addr * SIM_MSC_BLOCK_SIZE], blk_len * SIM_MSC_BLOCK_SIZE );
+    }
+
+    return ( USBD_OK );
+}
+
+static uint32_t Media_Time( uint8_t write, uint16_t blk_len )
+{
+    return ( write != 0U ) ? ( MEDIA_WRITE_SETUP_US + ( MEDIA_WRITE_BLOCK_US * blk_len ) ) :
+           ( MEDIA_READ_SETUP_US + ( MEDIA_READ_BLOCK_US * blk_len ) );
+}
+
+static int8_t STORAGE_Init( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size )
+{
+    *block_num  = DISK_BLOCKS;
+    *block_size = SIM_MSC_BLOCK_SIZE;
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsReady( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsWriteProtected( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+/* Blocking accesses: the device polls the card with the USB interrupt masked */
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    USBD_SIM_Busy( &hsim_usb, Media_Time( 0U, blk_len ) );
+    return Media_Access( 0U, buf, blk_addr, blk_len );
+}
+
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    USBD_SIM_Busy( &hsim_usb, Media_Time( 1U, blk_len ) );
+    return Media_Access( 1U, buf, blk_addr, blk_len );
+}
+
+static int8_t STORAGE_GetMaxLun( void )
+{
+    return ( 0 );
+}
+
+/* Asynchronous accesses: a DMA transfer, completed from Media_Tick */
+static int8_t Media_Start( uint8_t write, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    if( Media_Busy != 0U )
+    {
+        SIM_Check( "media: one asynchronous access at a time", 0U );
+        return ( -1 );
+    }
+
+    Media_Busy     = 1U;
+    Media_Write    = write;
+    Media_Buffer   = buf;
+    Media_Block    = blk_addr;
+    Media_Length   = blk_len;
+    Media_DoneTime = USBD_SIM_GetTime( &hsim_usb ) + Media_Time( write, blk_len );
+
+    USBD_SIM_Busy( &hsim_usb, MEDIA_ASYNC_START_US );
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_ReadAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    return Media_Start( 0U, buf, blk_addr, blk_len );
+}
+
+static int8_t STORAGE_WriteAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    return Media_Start( 1U, buf, blk_addr, blk_len );
+}
+
+static void Media_Tick( USBD_SIM_HandleTypeDef *hsim, uint64_t time_us )
+{
+    int8_t status;
+
+    if( ( Media_Busy != 0U ) && ( time_us >= Media_DoneTime ) )
+    {
+        Media_Busy = 0U;
+        status = Media_Access( Media_Write, Media_Buffer, Media_Block, Media_Length );
+
+        if( Media_Write != 0U )
+        {
+            USBD_MSC_WriteCplt( &USBD_Device, status );
+        }
+        else
+        {
+            USBD_MSC_ReadCplt( &USBD_Device, status );
+        }
+    }
+}
+
+/**
+  * @brief  Starts the MSC device on the given storage interface.
+  * @param  fops: storage interface
+  * @retval None
+  */
+static void SIM_StartMSC( USBD_StorageTypeDef *fops )
+{
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, USBD_MSC_CLASS );
+    USBD_MSC_RegisterStorage( &USBD_Device, fops );
+    USBD_Start( &USBD_Device );
+    USBD_SIM_SetTick( &hsim_usb, Media_Tick );
+    Media_Busy = 0U;
+
+    SIM_Check( "enumerate", USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK );
+}
+
+/**
+  * @brief  Runs the throughput and error scenarios on one storage interface.
+  * @param  fops: storage interface
+  * @param  name: interface name, for the report
+  * @param  pread_mbps: read throughput, in MB/s
+  * @retval None
+  */
+static void SIM_RunPipeline( USBD_StorageTypeDef *fops, const char *name, double *pread_mbps )
+{
+    uint8_t  tur[6] = { SCSI_TEST_UNIT_READY };
+    uint8_t  read_capacity[10] = { SCSI_READ_CAPACITY10 };
+    uint8_t  capacity[8];
+    uint8_t  asc = 0U;
+    uint32_t residue;
+    uint32_t i;
+    uint32_t errors;
+    uint32_t halts;
+    uint64_t start;
+    double   write_mbps;
+    int      status;
+    int      key;
+    uint16_t n;
+
+    printf( "=== %s storage interface, MSC_MEDIA_BUFFERS %u\n", name, ( unsigned )MSC_MEDIA_BUFFERS );
+    SIM_StartMSC( fops );
+    SIM_Check( "TEST UNIT READY", SIM_MSC_Command( tur, sizeof( tur ), 0U, NULL, 0U, &residue ) == 0 );
+    SIM_Check( "READ CAPACITY(10)",
+               ( SIM_MSC_Command( read_capacity, sizeof( read_capacity ), 1U, capacity,
+                                  sizeof( capacity ), &residue ) == 0 ) &&
+               ( capacity[2] == ( uint8_t )( ( DISK_BLOCKS - 1U ) >> 8 ) ) );
+
+    /* Throughput: 2 MiB in 64 KiB commands each way */
+    USBD_SIM_ResetStats( &hsim_usb );
+    start = USBD_SIM_GetTime( &hsim_usb );
+    errors = 0U;
+    for( i = 0U; i < BENCH_COMMANDS; i++ )
+    {
+        status = SIM_MSC_ReadWrite10( 0U, i * BENCH_BLOCKS_PER_COMMAND, BENCH_BLOCKS_PER_COMMAND,
+                                      &HostBuffer[i * BENCH_BLOCKS_PER_COMMAND * SIM_MSC_BLOCK_SIZE], &residue );
+        errors += ( ( status != 0 ) || ( residue != 0U ) ) ? 1U : 0U;
+    }
+    *pread_mbps = ( double )BENCH_SIZE / ( double )( USBD_SIM_GetTime( &hsim_usb ) - start );
+    SIM_Check( "READ(10) 2 MiB", ( errors == 0U ) && ( memcmp( HostBuffer, StorageDisk, BENCH_SIZE ) == 0 ) );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    for( i = 0U; i < BENCH_SIZE; i++ )
+    {
+        RefBuffer[i] = ( uint8_t )rand();
+    }
+    ( void )memcpy( HostBuffer, RefBuffer, BENCH_SIZE );
+
+    USBD_SIM_ResetStats( &hsim_usb );
+    start = USBD_SIM_GetTime( &hsim_usb );
+    errors = 0U;
+    for( i = 0U; i < BENCH_COMMANDS; i++ )
+    {
+        status = SIM_MSC_ReadWrite10( 1U, 4096U + ( i * BENCH_BLOCKS_PER_COMMAND ), BENCH_BLOCKS_PER_COMMAND,
+                                      &HostBuffer[i * BENCH_BLOCKS_PER_COMMAND * SIM_MSC_BLOCK_SIZE], &residue );
+        errors += ( ( status != 0 ) || ( residue != 0U ) ) ? 1U : 0U;
+    }
+    write_mbps = ( double )BENCH_SIZE / ( double )( USBD_SIM_GetTime( &hsim_usb ) - start );
+    SIM_Check( "WRITE(10) 2 MiB",
+               ( errors == 0U ) &&
+               ( memcmp( &StorageDisk[4096U * SIM_MSC_BLOCK_SIZE], RefBuffer, BENCH_SIZE ) == 0 ) );
+    USBD_SIM_PrintStats( &hsim_usb );
+
+    /* Transfers of 1 to 9 blocks, then empty ones */
+    errors = 0U;
+    for( n = 1U; n <= 9U; n++ )
+    {
+        status = SIM_MSC_ReadWrite10( 0U, 100U + n, n, HostBuffer, &residue );
+        errors += ( ( status != 0 ) || ( residue != 0U ) ||
+                    ( memcmp( HostBuffer, &StorageDisk[( 100U + n ) * SIM_MSC_BLOCK_SIZE],
+                              n * SIM_MSC_BLOCK_SIZE ) != 0 ) ) ? 1U : 0U;
+
+        for( i = 0U; i < ( n * SIM_MSC_BLOCK_SIZE ); i++ )
+        {
+            HostBuffer[i] = ( uint8_t )rand();
+        }
+        ( void )memcpy( RefBuffer, HostBuffer, n * SIM_MSC_BLOCK_SIZE );
+
+        status = SIM_MSC_ReadWrite10( 1U, 200U + ( n * 10U ), n, HostBuffer, &residue );
+        errors += ( ( status != 0 ) || ( residue != 0U ) ||
+                    ( memcmp( RefBuffer, &StorageDisk[( 200U + ( n * 10U ) ) * SIM_MSC_BLOCK_SIZE],
+                              n * SIM_MSC_BLOCK_SIZE ) != 0 ) ) ? 1U : 0U;
+    }
+    SIM_Check( "READ(10) and WRITE(10) of 1 to 9 blocks", errors == 0U );
+    SIM_Check( "READ(10) of 0 blocks", SIM_MSC_ReadWrite10( 0U, 5U, 0U, HostBuffer, &residue ) == 0 );
+    SIM_Check( "WRITE(10) of 0 blocks", SIM_MSC_ReadWrite10( 1U, 5U, 0U, HostBuffer, &residue ) == 0 );
+
+    /* Media errors on the 6th block of a 16-block transfer */
+    StorageFailBlock = 1005U;
+    halts = SIM_MSC_HaltsCleared;
+    status = SIM_MSC_ReadWrite10( 0U, 1000U, 16U, HostBuffer, &residue );
+    key = SIM_MSC_RequestSense( &asc );
+    SIM_Check( "READ(10) media error mid-transfer stalls the IN pipe, then fails the command",
+               ( status == USBD_CSW_CMD_FAILED ) && ( residue != 0U ) &&
+               ( SIM_MSC_HaltsCleared == ( halts + 1U ) ) &&
+               ( key == HARDWARE_ERROR ) && ( asc == UNRECOVERED_READ_ERROR ) );
+
+    ( void )memset( HostBuffer, 0x5A, 16U * SIM_MSC_BLOCK_SIZE );
+    status = SIM_MSC_ReadWrite10( 1U, 1000U, 16U, HostBuffer, &residue );
+    key = SIM_MSC_RequestSense( &asc );
+    SIM_Check( "WRITE(10) media error mid-transfer fails the command",
+               ( status == USBD_CSW_CMD_FAILED ) && ( key == HARDWARE_ERROR ) && ( asc == WRITE_FAULT ) );
+    SIM_Check( "WRITE(10) media error: blocks before the failure written, none after",
+               ( StorageDisk[1000U * SIM_MSC_BLOCK_SIZE] == 0x5AU ) &&
+               ( StorageDisk[( 1004U * SIM_MSC_BLOCK_SIZE ) + 511U] == 0x5AU ) &&
+               ( StorageDisk[1006U * SIM_MSC_BLOCK_SIZE] != 0x5AU ) );
+    StorageFailBlock = MEDIA_NO_FAILURE;
+
+    status = SIM_MSC_ReadWrite10( 0U, 1000U, 16U, HostBuffer, &residue );
+    SIM_Check( "READ(10) after the errors",
+               ( status == 0 ) && ( residue == 0U ) &&
+               ( memcmp( HostBuffer, &StorageDisk[1000U * SIM_MSC_BLOCK_SIZE], 16U * SIM_MSC_BLOCK_SIZE ) == 0 ) );
+
+    printf( "MSC_MEDIA_BUFFERS=%u %-5s: read %.3f MB/s, write %.3f MB/s\n",
+            ( unsigned )MSC_MEDIA_BUFFERS, name, *pread_mbps, write_mbps );
+
+    USBD_DeInit( &USBD_Device );
+    SIM_Check( "DeInit frees the class data", SIM_Allocations == 0 );
+}
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval 0 when all checks passed
+  */
+int main( void )
+{
+    double   sync_mbps;
+    double   async_mbps;
+    uint32_t i;
+
+    srand( 1U );
+    for( i = 0U; i < sizeof( StorageDisk ); i++ )
+    {
+        StorageDisk[i] = ( uint8_t )rand();
+    }
+
+    SIM_RunPipeline( &STORAGE_SyncFops, "sync", &sync_mbps );
+    SIM_RunPipeline( &STORAGE_AsyncFops, "async", &async_mbps );
+
+    /* With one buffer the media and the bus take turns whatever the interface */
+    if( MSC_MEDIA_BUFFERS > 1U )
+    {
+        SIM_Check( "asynchronous reads overlap the media and the bus", async_mbps > ( sync_mbps * 1.5 ) );
+    }
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,512 @@
+/**
+  ******************************************************************************
+  * @file    sim_msc_scsi.c
+  * @author  MCD Application Team
+  * @brief   Host script: replays CBW/CSW sequences of the SCSI command set on
+  *          the MSC class and checks the status and sense data: READ/WRITE
+  *          12 and 16, VERIFY, SYNCHRONIZE CACHE, UNMAP, START STOP UNIT,
+  *          then the errors of each, and recovery afterwards.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_msc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DISK_BLOCKS                   8192U
+#define UNMAP_MAX_DESCRIPTORS         4U
+#define TRIM_LOG_SIZE                 16U
+#define MEDIA_NO_FAILURE              0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t STORAGE_Init( uint8_t lun );
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size );
+static int8_t STORAGE_IsReady( uint8_t lun );
+static int8_t STORAGE_IsWriteProtected( uint8_t lun );
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+static int8_t STORAGE_GetMaxLun( void );
+static int8_t STORAGE_Flush( uint8_t lun );
+static int8_t STORAGE_Trim( uint8_t lun, uint32_t blk_addr, uint32_t blk_len );
+
+/* Private variables ---------------------------------------------------------*/
+static int8_t STORAGE_Inquirydata[STANDARD_INQUIRY_DATA_LEN] = { 0x00, 0x80, 0x02, 0x02, ( STANDARD_INQUIRY_DATA_LEN - 5 ) };
+
+/* Write-back cached storage, with the Flush and Trim hooks */
+static USBD_StorageTypeDef STORAGE_CachedFops =
+{
+    STORAGE_Init,
+    STORAGE_GetCapacity,
+    STORAGE_IsReady,
+    STORAGE_IsWriteProtected,
+    STORAGE_Read,
+    STORAGE_Write,
+    STORAGE_GetMaxLun,
+    STORAGE_Inquirydata,
+    NULL,
+    NULL,
+    STORAGE_Flush,
+    STORAGE_Trim,
+};
+
+/* The same storage without the optional hooks */
+static USBD_StorageTypeDef STORAGE_PlainFops =
+{
+    STORAGE_Init,
+    STORAGE_GetCapacity,
+    STORAGE_IsReady,
+    STORAGE_IsWriteProtected,
+    STORAGE_Read,
+    STORAGE_Write,
+    STORAGE_GetMaxLun,
+    STORAGE_Inquirydata,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+static uint16_t StorageBlockSize = SIM_MSC_BLOCK_SIZE;
+static uint8_t  StorageDisk[DISK_BLOCKS * SIM_MSC_BLOCK_SIZE];
+static uint8_t  StorageCache[DISK_BLOCKS * SIM_MSC_BLOCK_SIZE];
+static uint8_t  StorageDirty[DISK_BLOCKS];
+static uint32_t StorageFailBlock = MEDIA_NO_FAILURE;
+static uint8_t  StorageFlushFails;
+static uint32_t StorageFlushes;
+static uint32_t StorageTrims;
+static uint32_t StorageTrimLog[TRIM_LOG_SIZE][2];
+
+static uint8_t HostBuffer[24U * SIM_MSC_BLOCK_SIZE];
+static uint8_t RefBuffer[24U * SIM_MSC_BLOCK_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+
+static int8_t STORAGE_Init( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetCapacity( uint8_t lun, uint32_t *block_num, uint16_t *block_size )
+{
+    *block_num  = ( DISK_BLOCKS * SIM_MSC_BLOCK_SIZE ) / StorageBlockSize;
+    *block_size = StorageBlockSize;
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsReady( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_IsWriteProtected( uint8_t lun )
+{
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    uint32_t i;
+
+    if( ( StorageFailBlock >= blk_addr ) && ( StorageFailBlock < ( blk_addr + blk_len ) ) )
+    {
+        return ( -1 );
+    }
+
+    for( i = 0U; i < blk_len; i++ )
+    {
+        ( void )memcpy( &buf[i * SIM_MSC_BLOCK_SIZE],
+                        ( StorageDirty[blk_addr + i] != 0U ) ? &StorageCache[( blk_addr + i ) * SIM_MSC_BLOCK_SIZE] :
+                        &StorageDisk[( blk_addr + i ) * SIM_MSC_BLOCK_SIZE], SIM_MSC_BLOCK_SIZE );
+    }
+
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    ( void )memcpy( &StorageCache[blk_addr * SIM_MSC_BLOCK_SIZE], buf, blk_len * SIM_MSC_BLOCK_SIZE );
+    ( void )memset( &StorageDirty[blk_addr], 1, blk_len );
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_GetMaxLun( void )
+{
+    return ( 0 );
+}
+
+static int8_t STORAGE_Flush( uint8_t lun )
+{
+    uint32_t i;
+
+    StorageFlushes++;
+
+    if( StorageFlushFails != 0U )
+    {
+        return ( -1 );
+    }
+
+    for( i = 0U; i < DISK_BLOCKS; i++ )
+    {
+        if( StorageDirty[i] != 0U )
+        {
+            ( void )memcpy( &StorageDisk[i * SIM_MSC_BLOCK_SIZE], &StorageCache[i * SIM_MSC_BLOCK_SIZE],
+                            SIM_MSC_BLOCK_SIZE );
+            StorageDirty[i] = 0U;
+        }
+    }
+
+    return ( USBD_OK );
+}
+
+static int8_t STORAGE_Trim( uint8_t lun, uint32_t blk_addr, uint32_t blk_len )
+{
+    if( StorageTrims < TRIM_LOG_SIZE )
+    {
+        StorageTrimLog[StorageTrims][0] = blk_addr;
+        StorageTrimLog[StorageTrims][1] = blk_len;
+    }
+
+    StorageTrims++;
+    ( void )memset( &StorageDisk[blk_addr * SIM_MSC_BLOCK_SIZE], 0, blk_len * SIM_MSC_BLOCK_SIZE );
+    ( void )memset( &StorageDirty[blk_addr], 0, blk_len );
+    return ( USBD_OK );
+}
+
+/**
+  * @brief  Checks a command failed with the given sense data.
+  * @param  name: check name
+  * @param  status: CSW status of the command
+  * @param  key: expected sense key
+  * @param  asc: expected additional sense code
+  * @retval None
+  */
+static void SIM_CheckSense( const char *name, int status, uint8_t key, uint8_t asc )
+{
+    uint8_t sense_asc = 0U;
+    int     sense_key = SIM_MSC_RequestSense( &sense_asc );
+
+    if( ( status != USBD_CSW_CMD_FAILED ) || ( sense_key != ( int )key ) || ( sense_asc != asc ) )
+    {
+        printf( "     status %d, sense %d/0x%02X\n", status, sense_key, sense_asc );
+    }
+
+    SIM_Check( name, ( status == USBD_CSW_CMD_FAILED ) && ( sense_key == ( int )key ) && ( sense_asc == asc ) );
+}
+
+static int SIM_ReadWrite12( uint8_t write, uint32_t lba, uint32_t blocks, uint8_t *pbuf )
+{
+    uint8_t  cb[12] = { 0U };
+    uint32_t residue = 0U;
+    int      status;
+
+    cb[0] = ( write != 0U ) ? SCSI_WRITE12 : SCSI_READ12;
+    SIM_MSC_PutBE( &cb[2], lba, 4U );
+    SIM_MSC_PutBE( &cb[6], blocks, 4U );
+
+    status = SIM_MSC_Command( cb, sizeof( cb ), ( write != 0U ) ? 0U : 1U, pbuf,
+                              blocks * SIM_MSC_BLOCK_SIZE, &residue );
+
+    return ( ( status == 0 ) && ( residue != 0U ) ) ? -1 : status;
+}
+
+static int SIM_ReadWrite16( uint8_t write, uint64_t lba, uint32_t blocks, uint8_t *pbuf )
+{
+    uint8_t  cb[16] = { 0U };
+    uint32_t residue = 0U;
+    int      status;
+
+    cb[0] = ( write != 0U ) ? SCSI_WRITE16 : SCSI_READ16;
+    SIM_MSC_PutBE( &cb[2], lba, 8U );
+    SIM_MSC_PutBE( &cb[10], blocks, 4U );
+
+    status = SIM_MSC_Command( cb, sizeof( cb ), ( write != 0U ) ? 0U : 1U, pbuf,
+                              blocks * SIM_MSC_BLOCK_SIZE, &residue );
+
+    return ( ( status == 0 ) && ( residue != 0U ) ) ? -1 : status;
+}
+
+static int SIM_Verify10( uint32_t lba, uint16_t blocks, uint8_t flags )
+{
+    uint8_t cb[10] = { SCSI_VERIFY10, 0U };
+
+    cb[1] = flags;
+    SIM_MSC_PutBE( &cb[2], lba, 4U );
+    SIM_MSC_PutBE( &cb[7], blocks, 2U );
+
+    return SIM_MSC_Command( cb, sizeof( cb ), 0U, NULL, 0U, NULL );
+}
+
+/**
+  * @brief  Sends an UNMAP parameter list.
+  * @param  desc: block ranges, LBA and number of blocks
+  * @param  ndesc: number of ranges; 0 sends no parameter list
+  * @param  lba_high: high 32 bits of every LBA
+  * @retval CSW status
+  */
+static int SIM_Unmap( const uint32_t ( *desc )[2], uint32_t ndesc, uint32_t lba_high )
+{
+    uint8_t  list[8U + ( 16U * UNMAP_MAX_DESCRIPTORS )];
+    uint8_t  cb[10] = { SCSI_UNMAP };
+    uint32_t length = ( ndesc != 0U ) ? ( 8U + ( 16U * ndesc ) ) : 0U;
+    uint32_t i;
+
+    ( void )memset( list, 0, sizeof( list ) );
+    SIM_MSC_PutBE( &list[0], ( length != 0U ) ? ( length - 2U ) : 0U, 2U );
+    SIM_MSC_PutBE( &list[2], 16U * ndesc, 2U );
+
+    for( i = 0U; i < ndesc; i++ )
+    {
+        SIM_MSC_PutBE( &list[8U + ( 16U * i )], ( ( uint64_t )lba_high << 32 ) | desc[i][0], 8U );
+        SIM_MSC_PutBE( &list[16U + ( 16U * i )], desc[i][1], 4U );
+    }
+
+    SIM_MSC_PutBE( &cb[7], length, 2U );
+
+    return SIM_MSC_Command( cb, sizeof( cb ), 0U, ( length != 0U ) ? list : NULL, length, NULL );
+}
+
+/**
+  * @brief  Starts the MSC device on a storage interface, then runs TEST
+  *         UNIT READY and READ CAPACITY(10) as a host does first.
+  * @param  fops: storage interface
+  * @retval None
+  */
+static void SIM_StartMSC( USBD_StorageTypeDef *fops )
+{
+    uint8_t tur[6] = { SCSI_TEST_UNIT_READY };
+    uint8_t read_capacity[10] = { SCSI_READ_CAPACITY10 };
+    uint8_t capacity[8];
+
+    USBD_Init( &USBD_Device, &SIM_Desc, 0 );
+    USBD_RegisterClass( &USBD_Device, USBD_MSC_CLASS );
+    USBD_MSC_RegisterStorage( &USBD_Device, fops );
+    USBD_Start( &USBD_Device );
+
+    SIM_Check( "enumerate", USBD_SIM_Enumerate( &hsim_usb, 1U ) == USBD_SIM_OK );
+    SIM_Check( "TEST UNIT READY", SIM_MSC_Command( tur, sizeof( tur ), 0U, NULL, 0U, NULL ) == 0 );
+    SIM_Check( "READ CAPACITY(10)",
+               ( SIM_MSC_Command( read_capacity, sizeof( read_capacity ), 1U, capacity,
+                                  sizeof( capacity ), NULL ) == 0 ) &&
+               ( ( ( ( uint32_t )capacity[6] << 8 ) | capacity[7] ) == StorageBlockSize ) );
+}
+
+/**
+  * @brief  READ CAPACITY(16), READ and WRITE 12 and 16, with their errors.
+  * @retval None
+  */
+static void SIM_ReplayReadWrite( void )
+{
+    uint8_t  cb[16] = { SCSI_READ_CAPACITY16, SCSI_SA_READ_CAPACITY16 };
+    uint8_t  data[32];
+    uint32_t residue;
+    uint32_t i;
+    int      status;
+
+    SIM_MSC_PutBE( &cb[10], sizeof( data ), 4U );
+    ( void )memset( data, 0xEE, sizeof( data ) );
+    status = SIM_MSC_Command( cb, sizeof( cb ), 1U, data, sizeof( data ), &residue );
+    SIM_Check( "READ CAPACITY(16)",
+               ( status == 0 ) && ( residue == 0U ) && ( data[0] == 0U ) && ( data[3] == 0U ) &&
+               ( data[6] == ( uint8_t )( ( DISK_BLOCKS - 1U ) >> 8 ) ) && ( data[7] == 0xFFU ) &&
+               ( data[10] == 0x02U ) && ( data[11] == 0x00U ) && ( ( data[14] & 0x80U ) != 0U ) );
+
+    SIM_MSC_PutBE( &cb[10], 12U, 4U );
+    status = SIM_MSC_Command( cb, sizeof( cb ), 1U, data, 12U, &residue );
+    SIM_Check( "READ CAPACITY(16) with a short allocation length", ( status == 0 ) && ( residue == 0U ) );
+
+    for( i = 0U; i < sizeof( RefBuffer ); i++ )
+    {
+        RefBuffer[i] = ( uint8_t )rand();
+    }
+
+    ( void )memcpy( HostBuffer, RefBuffer, sizeof( HostBuffer ) );
+    SIM_Check( "WRITE(12)", SIM_ReadWrite12( 1U, 300U, 24U, HostBuffer ) == 0 );
+    ( void )memset( HostBuffer, 0, sizeof( HostBuffer ) );
+    SIM_Check( "READ(12)", ( SIM_ReadWrite12( 0U, 300U, 24U, HostBuffer ) == 0 ) &&
+               ( memcmp( HostBuffer, RefBuffer, sizeof( HostBuffer ) ) == 0 ) );
+
+    ( void )memcpy( HostBuffer, RefBuffer, sizeof( HostBuffer ) );
+    HostBuffer[0] ^= 0xFFU;
+    SIM_Check( "WRITE(16)", SIM_ReadWrite16( 1U, 7000U, 24U, HostBuffer ) == 0 );
+    ( void )memset( RefBuffer, 0, sizeof( RefBuffer ) );
+    SIM_Check( "READ(16)", ( SIM_ReadWrite16( 0U, 7000U, 24U, RefBuffer ) == 0 ) &&
+               ( memcmp( HostBuffer, RefBuffer, sizeof( HostBuffer ) ) == 0 ) );
+    SIM_Check( "READ(16) of the last block", SIM_ReadWrite16( 0U, DISK_BLOCKS - 1U, 1U, HostBuffer ) == 0 );
+
+    SIM_CheckSense( "READ(16) of an LBA above 32 bits",
+                    SIM_ReadWrite16( 0U, 0x100000000ULL, 1U, HostBuffer ), ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_CheckSense( "WRITE(16) of an LBA above 32 bits",
+                    SIM_ReadWrite16( 1U, 0x100000000ULL, 1U, HostBuffer ), ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_CheckSense( "READ(12) past the end",
+                    SIM_ReadWrite12( 0U, DISK_BLOCKS - 2U, 4U, HostBuffer ), ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_CheckSense( "READ(12) of a range wrapping at 2^32",
+                    SIM_ReadWrite12( 0U, 0xFFFFFFF0U, 0x20U, HostBuffer ), ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_CheckSense( "WRITE(16) past the end",
+                    SIM_ReadWrite16( 1U, DISK_BLOCKS, 1U, HostBuffer ), ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+}
+
+/**
+  * @brief  VERIFY, SYNCHRONIZE CACHE, UNMAP and START STOP UNIT on the
+  *         cached storage.
+  * @retval None
+  */
+static void SIM_ReplayCache( void )
+{
+    const uint32_t good[3][2] = { { 100U, 8U }, { 500U, 0U }, { 2000U, 32U } };
+    const uint32_t bad[2][2] = { { 100U, 8U }, { DISK_BLOCKS - 4U, 8U } };
+    uint8_t sync10[10] = { SCSI_SYNCHRONIZE_CACHE10 };
+    uint8_t sync16[16] = { SCSI_SYNCHRONIZE_CACHE16 };
+    uint8_t eject[6] = { SCSI_START_STOP_UNIT, 0U, 0U, 0U, 0x02U, 0U };
+
+    SIM_Check( "VERIFY(10) of 64 blocks", SIM_Verify10( 10U, 64U, 0U ) == 0 );
+    StorageFailBlock = 40U;
+    SIM_CheckSense( "VERIFY(10) of an unreadable block", SIM_Verify10( 10U, 64U, 0U ),
+                    MEDIUM_ERROR, UNRECOVERED_READ_ERROR );
+    StorageFailBlock = MEDIA_NO_FAILURE;
+    SIM_CheckSense( "VERIFY(10) past the end", SIM_Verify10( DISK_BLOCKS - 1U, 2U, 0U ),
+                    ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_CheckSense( "VERIFY(10) with BYTCHK", SIM_Verify10( 10U, 1U, 0x02U ),
+                    ILLEGAL_REQUEST, INVALID_FIELED_IN_COMMAND );
+
+    SIM_Check( "writes are cached before SYNCHRONIZE CACHE",
+               ( StorageDirty[300] != 0U ) &&
+               ( memcmp( &StorageDisk[300U * SIM_MSC_BLOCK_SIZE], &StorageCache[300U * SIM_MSC_BLOCK_SIZE],
+                         SIM_MSC_BLOCK_SIZE ) != 0 ) );
+    StorageFlushes = 0U;
+    SIM_Check( "SYNCHRONIZE CACHE(10) flushes",
+               ( SIM_MSC_Command( sync10, sizeof( sync10 ), 0U, NULL, 0U, NULL ) == 0 ) &&
+               ( StorageFlushes == 1U ) && ( StorageDirty[300] == 0U ) && ( StorageDirty[7000] == 0U ) );
+    SIM_Check( "the data are on the media after SYNCHRONIZE CACHE",
+               memcmp( &StorageDisk[7000U * SIM_MSC_BLOCK_SIZE], RefBuffer, sizeof( RefBuffer ) ) == 0 );
+    SIM_Check( "SYNCHRONIZE CACHE(16) flushes",
+               ( SIM_MSC_Command( sync16, sizeof( sync16 ), 0U, NULL, 0U, NULL ) == 0 ) &&
+               ( StorageFlushes == 2U ) );
+    StorageFlushFails = 1U;
+    SIM_CheckSense( "SYNCHRONIZE CACHE of a failing flush",
+                    SIM_MSC_Command( sync10, sizeof( sync10 ), 0U, NULL, 0U, NULL ), HARDWARE_ERROR, WRITE_FAULT );
+    StorageFlushFails = 0U;
+
+    StorageTrims = 0U;
+    SIM_Check( "UNMAP of 3 descriptors, the empty one skipped",
+               ( SIM_Unmap( good, 3U, 0U ) == 0 ) && ( StorageTrims == 2U ) &&
+               ( StorageTrimLog[0][0] == 100U ) && ( StorageTrimLog[0][1] == 8U ) &&
+               ( StorageTrimLog[1][0] == 2000U ) && ( StorageTrimLog[1][1] == 32U ) &&
+               ( StorageDisk[2000U * SIM_MSC_BLOCK_SIZE] == 0U ) &&
+               ( StorageDisk[( 2031U * SIM_MSC_BLOCK_SIZE ) + 511U] == 0U ) );
+    StorageTrims = 0U;
+    SIM_CheckSense( "UNMAP of an out of range descriptor", SIM_Unmap( bad, 2U, 0U ),
+                    ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_Check( "UNMAP is all or nothing", StorageTrims == 0U );
+    SIM_CheckSense( "UNMAP of an LBA above 32 bits", SIM_Unmap( good, 1U, 1U ),
+                    ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE );
+    SIM_Check( "UNMAP without parameter list", ( SIM_Unmap( good, 0U, 0U ) == 0 ) && ( StorageTrims == 0U ) );
+
+    HostBuffer[0] = 0x77U;
+    ( void )SIM_ReadWrite12( 1U, 50U, 1U, HostBuffer );
+    StorageFlushes = 0U;
+    SIM_Check( "START STOP UNIT eject flushes",
+               ( SIM_MSC_Command( eject, sizeof( eject ), 0U, NULL, 0U, NULL ) == 0 ) &&
+               ( StorageFlushes == 1U ) && ( StorageDisk[50U * SIM_MSC_BLOCK_SIZE] == 0x77U ) );
+}
+
+/**
+  * @brief  Commands on a storage without the optional hooks, then recovery.
+  * @retval None
+  */
+static void SIM_ReplayPlain( void )
+{
+    const uint32_t one[1][2] = { { 100U, 8U } };
+    uint8_t sync10[10] = { SCSI_SYNCHRONIZE_CACHE10 };
+    uint8_t unknown[10] = { 0xE7U };
+    uint8_t cbw[USBD_BOT_CBW_LENGTH] = { 'U', 'S', 'B', 'X' };
+    uint32_t halts;
+
+    SIM_Check( "SYNCHRONIZE CACHE without Flush",
+               SIM_MSC_Command( sync10, sizeof( sync10 ), 0U, NULL, 0U, NULL ) == 0 );
+    SIM_CheckSense( "UNMAP without Trim", SIM_Unmap( one, 1U, 0U ), ILLEGAL_REQUEST, INVALID_CDB );
+    SIM_CheckSense( "unknown operation code", SIM_MSC_Command( unknown, sizeof( unknown ), 0U, NULL, 0U, NULL ),
+                    ILLEGAL_REQUEST, INVALID_CDB );
+
+    /* An invalid CBW halts both pipes until a Bulk-Only Mass Storage Reset */
+    halts = SIM_MSC_HaltsCleared;
+    SIM_Check( "invalid CBW signature stalls the IN pipe",
+               ( USBD_SIM_Transfer( &hsim_usb, MSC_EPOUT_ADDR, cbw, sizeof( cbw ), 0U, NULL ) == USBD_SIM_OK ) &&
+               ( USBD_SIM_Transfer( &hsim_usb, MSC_EPIN_ADDR, HostBuffer, USBD_BOT_CSW_LENGTH, 0U, NULL ) ==
+                 USBD_SIM_STALL ) );
+    SIM_Check( "Bulk-Only Mass Storage Reset",
+               USBD_SIM_Control( &hsim_usb, 0x21U, BOT_RESET, 0U, 0U, NULL, NULL ) == USBD_SIM_OK );
+    SIM_Check( "CLEAR_FEATURE(ENDPOINT_HALT) on both pipes",
+               ( USBD_SIM_Control( &hsim_usb, 0x02U, USB_REQ_CLEAR_FEATURE, USB_FEATURE_EP_HALT,
+                                   MSC_EPIN_ADDR, NULL, NULL ) == USBD_SIM_OK ) &&
+               ( USBD_SIM_Control( &hsim_usb, 0x02U, USB_REQ_CLEAR_FEATURE, USB_FEATURE_EP_HALT,
+                                   MSC_EPOUT_ADDR, NULL, NULL ) == USBD_SIM_OK ) &&
+               ( SIM_MSC_HaltsCleared == halts ) );
+
+    SIM_Check( "READ(10) after the errors",
+               ( SIM_MSC_ReadWrite10( 0U, 0U, 4U, HostBuffer, NULL ) == 0 ) &&
+               ( memcmp( HostBuffer, StorageDisk, 4U * SIM_MSC_BLOCK_SIZE ) == 0 ) );
+}
+
+/**
+  * @brief  VERIFY on a storage whose blocks are larger than the BOT buffer.
+  * @retval None
+  */
+static void SIM_ReplayLargeBlocks( void )
+{
+    SIM_CheckSense( "VERIFY(10) of blocks larger than the BOT buffer", SIM_Verify10( 0U, 1U, 0U ),
+                    ILLEGAL_REQUEST, INVALID_CDB );
+    SIM_Check( "VERIFY(10) of 0 blocks larger than the BOT buffer", SIM_Verify10( 0U, 0U, 0U ) == 0 );
+}
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval 0 when all checks passed
+  */
+int main( void )
+{
+    uint32_t i;
+
+    srand( 1U );
+    for( i = 0U; i < sizeof( StorageDisk ); i++ )
+    {
+        StorageDisk[i] = ( uint8_t )rand();
+    }
+
+    printf( "=== cached storage, Flush and Trim hooks\n" );
+    SIM_StartMSC( &STORAGE_CachedFops );
+    SIM_ReplayReadWrite();
+    SIM_ReplayCache();
+    USBD_DeInit( &USBD_Device );
+
+    printf( "=== storage without the optional hooks\n" );
+    SIM_StartMSC( &STORAGE_PlainFops );
+    SIM_ReplayPlain();
+    USBD_DeInit( &USBD_Device );
+
+    printf( "=== storage with %u-byte blocks\n", ( unsigned )( 2U * MSC_MEDIA_PACKET ) );
+    StorageBlockSize = ( uint16_t )( 2U * MSC_MEDIA_PACKET );
+    SIM_StartMSC( &STORAGE_PlainFops );
+    SIM_ReplayLargeBlocks();
+
+    USBD_DeInit( &USBD_Device );
+    SIM_Check( "DeInit frees the class data", SIM_Allocations == 0 );
+    printf( "%u endpoint halts cleared\n", SIM_MSC_HaltsCleared );
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
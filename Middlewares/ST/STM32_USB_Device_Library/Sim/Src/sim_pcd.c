@@ -0,0 +1,970 @@
+/**
+  ******************************************************************************
+  * @file    sim_pcd.c
+  * @author  MCD Application Team
+  * @brief   Host script of the HAL PCD driver (stm32l1xx_hal_pcd.c, _ex.c
+  *          and stm32l1xx_ll_usb.c) on the simulated register file and PMA
+  *          of sim_hal.c:
+  *           - HAL_PCDEx_PMAAlloc on random endpoint lists: the buffers lie
+  *             in the PMA, above the buffer table and apart from each other,
+  *             reopening an endpoint reuses its buffers and a bus reset
+  *             gives the same layout again,
+  *           - single and double-buffered bulk endpoints, OUT and IN, with
+  *             the interrupt served 0 to 3 bus slots after the transfer and
+  *             one bus slot per endpoint register write it makes,
+  *           - double-buffered isochronous endpoints, IN and OUT.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdarg.h>
+#include <stdlib.h>
+#include "sim_hal.h"
+#include "sim_check.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t    lo;
+    uint32_t    hi;
+    const char *what;
+    uint32_t    ep;
+} PCD_SpanTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define PCD_NAK                       (-1)        /* Host_In, Host_Out: NAK */
+#define PCD_NO_ANSWER                 (-2)        /* Isochronous: nothing sent */
+#define PCD_STREAM_SIZE               (1U << 20)
+#define PCD_ALLOC_TRIALS              20000U
+#define PCD_MAX_SLOTS                 50000000L
+#define PCD_MAX_ERRORS                20U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static PCD_HandleTypeDef hpcd;
+static uint8_t  Pcd_Stream[PCD_STREAM_SIZE];
+static uint32_t Pcd_Errors;
+
+/* Device side: OUT */
+static uint8_t  Dev_RxBuf[2048];
+static uint32_t Dev_RxTotal;
+static uint32_t Dev_RxRequest;
+static uint8_t  Dev_RxEp;
+
+/* Device side: IN */
+static uint32_t Dev_TxPos;
+static uint32_t Dev_TxTotal;
+static uint32_t Dev_TxChunk;
+static uint8_t  Dev_TxEp;
+static uint8_t  Dev_TxIdle;
+
+static uint8_t  Dev_ReopenEP0;
+
+/* Host side */
+static long     Host_Slots;
+static long     Host_Acks;
+static uint32_t Host_Sent;
+static uint32_t Host_Total;
+static uint32_t Host_Got;
+static uint32_t Host_MaxPacket;
+static uint8_t  Host_Zlp;
+static uint8_t  Host_Rx[PCD_STREAM_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Pcd_Error( const char *format, ... );
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Counts a failed condition and prints the first ones.
+  * @param  format: printf format
+  * @retval None
+  */
+static void Pcd_Error( const char *format, ... )
+{
+    va_list args;
+
+    if( Pcd_Errors < PCD_MAX_ERRORS )
+    {
+        va_start( args, format );
+        printf( "     " );
+        vprintf( format, args );
+        printf( "\n" );
+        va_end( args );
+    }
+
+    Pcd_Errors++;
+}
+
+/**
+  * @brief  IN token from the host.
+  * @param  ep: endpoint number
+  * @param  pbuf: packet received
+  * @retval Packet length, PCD_NAK or PCD_NO_ANSWER
+  */
+static int32_t Host_In( uint32_t ep, uint8_t *pbuf )
+{
+    uint16_t reg = SIM_HAL_EPR[ep];
+    uint16_t type = reg & USB_EP_T_FIELD;
+    uint16_t stat = reg & USB_EPTX_STAT;
+    uint32_t buf;
+    uint32_t len;
+
+    if( type == USB_EP_ISOCHRONOUS )
+    {
+        if( stat != USB_EP_TX_VALID )
+        {
+            return PCD_NO_ANSWER;
+        }
+
+        buf = ( ( reg & USB_EP_DTOG_TX ) != 0U ) ? SIM_HAL_BTABLE_ADDR1 : SIM_HAL_BTABLE_ADDR0;
+        len = *SIM_HAL_BTable( ep, buf + 2U ) & 0x3FFU;
+        SIM_HAL_PMAGet( *SIM_HAL_BTable( ep, buf ), pbuf, len );
+        SIM_HAL_EPSet( ep, ( uint16_t )( ( reg ^ USB_EP_DTOG_TX ) | USB_EP_CTR_TX ) );
+    }
+    else if( ( type == USB_EP_BULK ) && ( ( reg & USB_EP_KIND ) != 0U ) )
+    {
+        /* The buffer DTOG_TX points to is held by the driver (SW_BUF) */
+        if( ( stat != USB_EP_TX_VALID ) ||
+                ( ( ( reg & USB_EP_DTOG_TX ) != 0U ) == ( ( reg & USB_EP_DTOG_RX ) != 0U ) ) )
+        {
+            return PCD_NAK;
+        }
+
+        buf = ( ( reg & USB_EP_DTOG_TX ) != 0U ) ? SIM_HAL_BTABLE_ADDR1 : SIM_HAL_BTABLE_ADDR0;
+        len = *SIM_HAL_BTable( ep, buf + 2U ) & 0x3FFU;
+        SIM_HAL_PMAGet( *SIM_HAL_BTable( ep, buf ), pbuf, len );
+        SIM_HAL_EPSet( ep, ( uint16_t )( ( reg ^ USB_EP_DTOG_TX ) | USB_EP_CTR_TX ) );
+    }
+    else
+    {
+        if( stat != USB_EP_TX_VALID )
+        {
+            return PCD_NAK;
+        }
+
+        len = *SIM_HAL_BTable( ep, SIM_HAL_BTABLE_COUNT0 ) & 0x3FFU;
+        SIM_HAL_PMAGet( *SIM_HAL_BTable( ep, SIM_HAL_BTABLE_ADDR0 ), pbuf, len );
+        SIM_HAL_EPSet( ep, ( uint16_t )( ( ( reg ^ USB_EP_DTOG_TX ) & ~USB_EPTX_STAT ) |
+                                         USB_EP_TX_NAK | USB_EP_CTR_TX ) );
+    }
+
+    return ( int32_t )len;
+}
+
+/**
+  * @brief  OUT packet from the host.
+  * @param  ep: endpoint number
+  * @param  pbuf: packet
+  * @param  len: packet length
+  * @retval Packet length, PCD_NAK or PCD_NO_ANSWER
+  */
+static int32_t Host_Out( uint32_t ep, const uint8_t *pbuf, uint32_t len )
+{
+    uint16_t reg = SIM_HAL_EPR[ep];
+    uint16_t type = reg & USB_EP_T_FIELD;
+    uint16_t stat = reg & USB_EPRX_STAT;
+    volatile uint16_t *count;
+    uint32_t buf;
+
+    if( ( type == USB_EP_ISOCHRONOUS ) || ( ( type == USB_EP_BULK ) && ( ( reg & USB_EP_KIND ) != 0U ) ) )
+    {
+        if( stat != USB_EP_RX_VALID )
+        {
+            return ( type == USB_EP_ISOCHRONOUS ) ? PCD_NO_ANSWER : PCD_NAK;
+        }
+
+        /* The buffer DTOG_RX points to is held by the driver (SW_BUF) */
+        if( ( type == USB_EP_BULK ) &&
+                ( ( ( reg & USB_EP_DTOG_TX ) != 0U ) == ( ( reg & USB_EP_DTOG_RX ) != 0U ) ) )
+        {
+            return PCD_NAK;
+        }
+
+        buf = ( ( reg & USB_EP_DTOG_RX ) != 0U ) ? SIM_HAL_BTABLE_ADDR1 : SIM_HAL_BTABLE_ADDR0;
+        count = SIM_HAL_BTable( ep, buf + 2U );
+
+        if( len > SIM_HAL_RxCapacity( *count ) )
+        {
+            Pcd_Error( "EP%u buffer %u: %u bytes in %u", ( unsigned )ep, ( unsigned )( buf / 4U ),
+                       ( unsigned )len, ( unsigned )SIM_HAL_RxCapacity( *count ) );
+        }
+
+        SIM_HAL_PMAPut( *SIM_HAL_BTable( ep, buf ), pbuf, len );
+        *count = ( uint16_t )( ( *count & 0xFC00U ) | len );
+        SIM_HAL_EPSet( ep, ( uint16_t )( ( reg ^ USB_EP_DTOG_RX ) | USB_EP_CTR_RX ) );
+    }
+    else
+    {
+        if( stat != USB_EP_RX_VALID )
+        {
+            return PCD_NAK;
+        }
+
+        count = SIM_HAL_BTable( ep, SIM_HAL_BTABLE_COUNT1 );
+
+        if( len > SIM_HAL_RxCapacity( *count ) )
+        {
+            Pcd_Error( "EP%u: %u bytes in %u", ( unsigned )ep, ( unsigned )len,
+                       ( unsigned )SIM_HAL_RxCapacity( *count ) );
+        }
+
+        SIM_HAL_PMAPut( *SIM_HAL_BTable( ep, SIM_HAL_BTABLE_ADDR1 ), pbuf, len );
+        *count = ( uint16_t )( ( *count & 0xFC00U ) | len );
+        SIM_HAL_EPSet( ep, ( uint16_t )( ( ( reg ^ USB_EP_DTOG_RX ) & ~USB_EPRX_STAT ) |
+                                         USB_EP_RX_NAK | USB_EP_CTR_RX ) );
+    }
+
+    return ( int32_t )len;
+}
+
+/**
+  * @brief  Queues the next reception of the device.
+  * @retval None
+  */
+static void Dev_Receive( void )
+{
+    HAL_PCD_EP_Receive( &hpcd, Dev_RxEp, Dev_RxBuf, Dev_RxRequest );
+}
+
+/**
+  * @brief  Queues the next transmission of the device: random lengths, one
+  *         in four a multiple of the packet size.
+  * @retval None
+  */
+static void Dev_Transmit( void )
+{
+    uint32_t len;
+
+    if( Dev_TxPos >= Dev_TxTotal )
+    {
+        Dev_TxIdle = 1U;
+        return;
+    }
+
+    len = 1U + ( ( uint32_t )rand() % Dev_TxChunk );
+
+    if( ( rand() % 4 ) == 0 )
+    {
+        len = ( ( len / 64U ) + 1U ) * 64U;
+    }
+
+    if( len > ( Dev_TxTotal - Dev_TxPos ) )
+    {
+        len = Dev_TxTotal - Dev_TxPos;
+    }
+
+    Dev_TxIdle = 0U;
+    HAL_PCD_EP_Transmit( &hpcd, Dev_TxEp | 0x80U, &Pcd_Stream[Dev_TxPos], len );
+    Dev_TxPos += len;
+}
+
+void HAL_PCD_DataOutStageCallback( PCD_HandleTypeDef *h, uint8_t epnum )
+{
+    uint32_t len = h->OUT_ep[epnum].xfer_count;
+
+    if( memcmp( Dev_RxBuf, &Pcd_Stream[Dev_RxTotal], len ) != 0 )
+    {
+        Pcd_Error( "EP%u OUT: data differ at byte %u", ( unsigned )epnum, ( unsigned )Dev_RxTotal );
+    }
+
+    Dev_RxTotal += len;
+    Dev_Receive();
+}
+
+void HAL_PCD_DataInStageCallback( PCD_HandleTypeDef *h, uint8_t epnum )
+{
+    Dev_Transmit();
+}
+
+void HAL_PCD_ResetCallback( PCD_HandleTypeDef *h )
+{
+    /* The stack reopens EP0 on a bus reset */
+    if( Dev_ReopenEP0 != 0U )
+    {
+        HAL_PCD_EP_Open( h, 0x00U, 64U, EP_TYPE_CTRL );
+        HAL_PCD_EP_Open( h, 0x80U, 64U, EP_TYPE_CTRL );
+    }
+}
+
+/**
+  * @brief  USB interrupt, when a transfer is pending.
+  * @retval None
+  */
+static void Dev_IRQHandler( void )
+{
+    if( ( USB->ISTR & USB_ISTR_CTR ) != 0U )
+    {
+        HAL_PCD_IRQHandler( &hpcd );
+    }
+}
+
+/**
+  * @brief  Resets the peripheral and initializes the driver.
+  * @param  ep_num: hpcd.Init.dev_endpoints
+  * @retval None
+  */
+static void Dev_Init( uint32_t ep_num )
+{
+    SIM_HAL_Reset();
+    ( void )memset( &hpcd, 0, sizeof( hpcd ) );
+    hpcd.Instance = USB;
+    hpcd.Init.dev_endpoints = ep_num;
+    hpcd.Init.speed = PCD_SPEED_FULL;
+    hpcd.Init.phy_itface = PCD_PHY_EMBEDDED;
+    Dev_ReopenEP0 = 0U;
+    HAL_PCD_Init( &hpcd );
+}
+
+/**
+  * @brief  Size of the PMA buffer of an endpoint.
+  * @param  is_in: 1 for IN
+  * @param  mps: max packet size
+  * @retval Bytes
+  */
+static uint32_t Pcd_BufferSize( uint32_t is_in, uint32_t mps )
+{
+    /* Reception buffers above 62 bytes are counted in blocks of 32 bytes */
+    return ( ( is_in == 0U ) && ( mps > 62U ) ) ? ( ( mps + 31U ) & ~31U ) : ( ( mps + 1U ) & ~1U );
+}
+
+/**
+  * @brief  Checks that every buffer the peripheral may use lies in the PMA,
+  *         above the buffer table, and apart from all the others.
+  * @param  ep_num: hpcd.Init.dev_endpoints
+  * @retval None
+  */
+static void Pcd_CheckLayout( uint32_t ep_num )
+{
+    PCD_SpanTypeDef span[2U * 2U * SIM_HAL_EP_NUM + 1U];
+    PCD_EPTypeDef *ep;
+    uint32_t count = 0U;
+    uint32_t size;
+    uint32_t n;
+    uint32_t dir;
+    uint32_t i;
+    uint32_t j;
+
+    span[count++] = ( PCD_SpanTypeDef ) { 0U, ep_num * 8U, "buffer table", 0U };
+
+    for( n = 0U; n < SIM_HAL_EP_NUM; n++ )
+    {
+        for( dir = 0U; dir < 2U; dir++ )
+        {
+            ep = ( dir != 0U ) ? &hpcd.IN_ep[n] : &hpcd.OUT_ep[n];
+
+            if( ( ep->maxpacket == 0U ) || ( ( ep->pmaadress == 0U ) && ( ep->pmaaddr0 == 0U ) ) )
+            {
+                continue;
+            }
+
+            size = Pcd_BufferSize( dir, ep->maxpacket );
+
+            if( ep->doublebuffer != 0U )
+            {
+                span[count++] = ( PCD_SpanTypeDef ) { ep->pmaaddr0, ep->pmaaddr0 + size, ( dir != 0U ) ? "IN0" : "OUT0", n };
+                span[count++] = ( PCD_SpanTypeDef ) { ep->pmaaddr1, ep->pmaaddr1 + size, ( dir != 0U ) ? "IN1" : "OUT1", n };
+            }
+            else
+            {
+                span[count++] = ( PCD_SpanTypeDef ) { ep->pmaadress, ep->pmaadress + size, ( dir != 0U ) ? "IN" : "OUT", n };
+            }
+        }
+    }
+
+    for( i = 0U; i < count; i++ )
+    {
+        if( ( span[i].hi > PCD_PMA_SIZE ) || ( ( span[i].lo & 1U ) != 0U ) )
+        {
+            Pcd_Error( "%s%u [%x, %x) outside the PMA or odd", span[i].what, ( unsigned )span[i].ep,
+                       ( unsigned )span[i].lo, ( unsigned )span[i].hi );
+        }
+
+        for( j = i + 1U; j < count; j++ )
+        {
+            if( ( span[i].lo < span[j].hi ) && ( span[j].lo < span[i].hi ) )
+            {
+                Pcd_Error( "%s%u [%x, %x) overlaps %s%u [%x, %x)",
+                           span[i].what, ( unsigned )span[i].ep, ( unsigned )span[i].lo, ( unsigned )span[i].hi,
+                           span[j].what, ( unsigned )span[j].ep, ( unsigned )span[j].lo, ( unsigned )span[j].hi );
+            }
+        }
+    }
+}
+
+/**
+  * @brief  Opens random endpoint lists, some beyond the PMA, then reopens
+  *         the endpoints and resets the bus.
+  * @retval None
+  */
+static void SIM_RunAlloc( void )
+{
+    static const uint8_t types[] = { EP_TYPE_BULK, EP_TYPE_INTR, EP_TYPE_ISOC };
+    uint32_t errors_open = 0U;
+    uint32_t errors_reopen = 0U;
+    uint32_t errors_reset = 0U;
+    uint32_t fitting = 0U;
+    uint32_t full = 0U;
+    uint32_t trial;
+
+    srand( 46U );
+
+    for( trial = 0U; trial < PCD_ALLOC_TRIALS; trial++ )
+    {
+        uint32_t ep_num = 2U + ( ( uint32_t )rand() % 7U );
+        uint32_t need = ( ep_num * 8U ) + 128U;
+        uint32_t error = Pcd_Errors;
+        uint8_t  overflow = 0U;
+        uint16_t before;
+        uint32_t n;
+        uint32_t dir;
+
+        Dev_Init( ep_num );
+
+        if( ( HAL_PCD_EP_Open( &hpcd, 0x00U, 64U, EP_TYPE_CTRL ) != HAL_OK ) ||
+                ( HAL_PCD_EP_Open( &hpcd, 0x80U, 64U, EP_TYPE_CTRL ) != HAL_OK ) )
+        {
+            Pcd_Error( "EP0 open failed" );
+        }
+
+        /* Class endpoint list: random types and sizes, some bulk endpoints
+           declared double-buffered */
+        for( n = 1U; n < ep_num; n++ )
+        {
+            for( dir = 0U; dir < 2U; dir++ )
+            {
+                uint8_t  type;
+                uint16_t mps;
+                uint8_t  addr = ( uint8_t )( n | ( ( dir != 0U ) ? 0x80U : 0U ) );
+                uint32_t size;
+                uint8_t  db;
+                HAL_StatusTypeDef status;
+                PCD_EPTypeDef *ep = ( dir != 0U ) ? &hpcd.IN_ep[n] : &hpcd.OUT_ep[n];
+
+                if( ( rand() % 3 ) == 0 )
+                {
+                    continue;
+                }
+
+                type = types[rand() % 3];
+
+                if( type == EP_TYPE_ISOC )
+                {
+                    mps = ( uint16_t )( 1 + ( rand() % 200 ) );
+                }
+                else if( type == EP_TYPE_BULK )
+                {
+                    mps = ( uint16_t )( 8U << ( rand() % 4 ) );
+                }
+                else
+                {
+                    mps = ( uint16_t )( 1 + ( rand() % 64 ) );
+                }
+
+                size = Pcd_BufferSize( dir, mps );
+                db = ( uint8_t )( ( type == EP_TYPE_ISOC ) || ( ( type == EP_TYPE_BULK ) && ( ( rand() % 2 ) != 0 ) ) );
+
+                if( ( db != 0U ) && ( type == EP_TYPE_BULK ) )
+                {
+                    HAL_PCDEx_PMAConfig( &hpcd, addr, PCD_DBL_BUF, 0U );
+                }
+
+                need += ( db != 0U ) ? ( 2U * size ) : size;
+                status = HAL_PCD_EP_Open( &hpcd, addr, mps, type );
+
+                if( need > PCD_PMA_SIZE )
+                {
+                    if( status != HAL_ERROR )
+                    {
+                        Pcd_Error( "EP %02x beyond the PMA opened", addr );
+                    }
+
+                    need -= ( db != 0U ) ? ( 2U * size ) : size;
+                    overflow = 1U;
+                }
+                else if( status != HAL_OK )
+                {
+                    Pcd_Error( "EP %02x open failed with %u bytes used", addr, ( unsigned )need );
+                }
+                else if( ( ep->doublebuffer != 0U ) != ( db != 0U ) )
+                {
+                    Pcd_Error( "EP %02x double buffer flag", addr );
+                }
+            }
+        }
+
+        if( hpcd.PMAFree != need )
+        {
+            Pcd_Error( "PMAFree %u, %u bytes used", ( unsigned )hpcd.PMAFree, ( unsigned )need );
+        }
+
+        Pcd_CheckLayout( ep_num );
+        errors_open += Pcd_Errors - error;
+        error = Pcd_Errors;
+
+        /* Reopening (SET_CONFIGURATION, SET_INTERFACE) reuses the buffers */
+        before = hpcd.PMAFree;
+
+        for( n = 1U; n < ep_num; n++ )
+        {
+            for( dir = 0U; dir < 2U; dir++ )
+            {
+                PCD_EPTypeDef *ep = ( dir != 0U ) ? &hpcd.IN_ep[n] : &hpcd.OUT_ep[n];
+                uint8_t addr = ( uint8_t )( n | ( ( dir != 0U ) ? 0x80U : 0U ) );
+
+                if( ( ep->maxpacket != 0U ) && ( ( ep->pmaadress != 0U ) || ( ep->pmaaddr0 != 0U ) ) )
+                {
+                    HAL_PCD_EP_Close( &hpcd, addr );
+                    HAL_PCD_EP_Open( &hpcd, addr, ( uint16_t )ep->maxpacket, ep->type );
+                }
+            }
+        }
+
+        if( hpcd.PMAFree != before )
+        {
+            Pcd_Error( "reopen took %d more bytes", ( int )hpcd.PMAFree - ( int )before );
+        }
+
+        Pcd_CheckLayout( ep_num );
+        errors_reopen += Pcd_Errors - error;
+        error = Pcd_Errors;
+
+        /* A bus reset releases the buffers, the stack reopens EP0 */
+        Dev_ReopenEP0 = 1U;
+        USB->ISTR |= USB_ISTR_RESET;
+        HAL_PCD_IRQHandler( &hpcd );
+        USB->ISTR = 0U;
+
+        if( ( hpcd.PMAFree != ( ( ep_num * 8U ) + 128U ) ) || ( hpcd.OUT_ep[0].pmaadress != ( ep_num * 8U ) ) )
+        {
+            Pcd_Error( "after a bus reset: PMAFree %u, EP0 OUT at %u", ( unsigned )hpcd.PMAFree,
+                       ( unsigned )hpcd.OUT_ep[0].pmaadress );
+        }
+
+        errors_reset += Pcd_Errors - error;
+
+        if( overflow != 0U )
+        {
+            full++;
+        }
+        else
+        {
+            fitting++;
+        }
+    }
+
+    printf( "allocator: %u endpoint lists, %u fitting, %u reaching the end of the PMA\n",
+            ( unsigned )PCD_ALLOC_TRIALS, ( unsigned )fitting, ( unsigned )full );
+    SIM_Check( "allocator: buffers in the PMA, apart, overflow reported", errors_open == 0U );
+    SIM_Check( "allocator: reopening the endpoints reuses their buffers", errors_reopen == 0U );
+    SIM_Check( "allocator: bus reset releases the buffers", errors_reset == 0U );
+
+    /* Buffers placed by HAL_PCDEx_PMAConfig are kept, the others follow */
+    Dev_Init( 8U );
+    HAL_PCDEx_PMAConfig( &hpcd, 0x00U, PCD_SNG_BUF, 0x180U );
+    HAL_PCDEx_PMAConfig( &hpcd, 0x81U, PCD_DBL_BUF, 0x1C0U | ( 0x1E0U << 16 ) );
+    HAL_PCD_EP_Open( &hpcd, 0x00U, 64U, EP_TYPE_CTRL );
+    HAL_PCD_EP_Open( &hpcd, 0x80U, 64U, EP_TYPE_CTRL );
+    HAL_PCD_EP_Open( &hpcd, 0x81U, 32U, EP_TYPE_BULK );
+    HAL_PCD_EP_Open( &hpcd, 0x01U, 64U, EP_TYPE_BULK );
+    SIM_Check( "allocator: buffers placed by HAL_PCDEx_PMAConfig kept",
+               ( hpcd.OUT_ep[0].pmaadress == 0x180U ) && ( hpcd.IN_ep[1].pmaaddr0 == 0x1C0U ) &&
+               ( hpcd.IN_ep[1].pmaaddr1 == 0x1E0U ) && ( hpcd.IN_ep[0].pmaadress == 0x40U ) &&
+               ( hpcd.OUT_ep[1].pmaadress == 0x80U ) );
+    SIM_Check( "allocator: buffer table",
+               ( *SIM_HAL_BTable( 0U, SIM_HAL_BTABLE_ADDR1 ) == 0x180U ) &&
+               ( *SIM_HAL_BTable( 1U, SIM_HAL_BTABLE_ADDR0 ) == 0x1C0U ) &&
+               ( *SIM_HAL_BTable( 1U, SIM_HAL_BTABLE_ADDR1 ) == 0x80U ) );
+}
+
+/**
+  * @brief  OUT bus slot: next packet of the stream, a transfer ending on a
+  *         packet boundary is closed by a zero length packet.
+  * @retval None
+  */
+static void Host_OutSlot( void )
+{
+    uint32_t len = Host_Total - Host_Sent;
+    int32_t  result;
+
+    if( len > Host_MaxPacket )
+    {
+        len = Host_MaxPacket;
+    }
+
+    Host_Slots++;
+
+    if( ( Host_Sent < Host_Total ) ||
+            ( ( ( Host_Total % Host_MaxPacket ) == 0U ) && ( Host_Zlp == 0U ) ) )
+    {
+        result = Host_Out( 1U, &Pcd_Stream[Host_Sent], len );
+
+        if( result >= 0 )
+        {
+            Host_Sent += ( uint32_t )result;
+            Host_Acks++;
+
+            if( result == 0 )
+            {
+                Host_Zlp = 1U;
+            }
+        }
+    }
+}
+
+/**
+  * @brief  IN bus slot.
+  * @retval None
+  */
+static void Host_InSlot( void )
+{
+    uint8_t packet[1024];
+    int32_t result;
+
+    Host_Slots++;
+    result = Host_In( 1U, packet );
+
+    if( result >= 0 )
+    {
+        Host_Acks++;
+
+        if( ( Host_Got + ( uint32_t )result ) > Host_Total )
+        {
+            Pcd_Error( "IN: %u bytes past the end", ( unsigned )( Host_Got + ( uint32_t )result - Host_Total ) );
+        }
+        else
+        {
+            ( void )memcpy( &Host_Rx[Host_Got], packet, ( uint32_t )result );
+            Host_Got += ( uint32_t )result;
+        }
+    }
+}
+
+static uint8_t Host_OutDone( void )
+{
+    return ( uint8_t )( Dev_RxTotal >= Host_Total );
+}
+
+static uint8_t Host_InDone( void )
+{
+    return ( uint8_t )( ( Host_Got >= Host_Total ) && ( Dev_TxIdle != 0U ) && ( ( USB->ISTR & USB_ISTR_CTR ) == 0U ) );
+}
+
+/**
+  * @brief  Runs the bus until done: the interrupt is served latency slots
+  *         after a transfer, and each endpoint register write it makes lets
+  *         one more slot run, so that every race window is hit.
+  * @param  slot: bus slot of the host
+  * @param  latency: interrupt latency in slots
+  * @param  done: end condition
+  * @retval None
+  */
+static void Host_Run( void ( *slot )( void ), int32_t latency, uint8_t ( *done )( void ) )
+{
+    int32_t pending = -1;
+
+    Host_Slots = 0;
+    Host_Acks = 0;
+
+    while( ( done() == 0U ) && ( Host_Slots < PCD_MAX_SLOTS ) )
+    {
+        slot();
+
+        if( ( ( USB->ISTR & USB_ISTR_CTR ) != 0U ) && ( pending < 0 ) )
+        {
+            pending = latency;
+        }
+
+        if( ( pending >= 0 ) && ( pending-- == 0 ) )
+        {
+            SIM_HAL_SetWriteHook( slot );
+            Dev_IRQHandler();
+            SIM_HAL_SetWriteHook( NULL );
+            pending = -1;
+        }
+    }
+}
+
+/**
+  * @brief  Bulk OUT stream on EP1.
+  * @param  db: 1 for double-buffered
+  * @param  mps: max packet size
+  * @param  latency: interrupt latency in slots
+  * @param  total: bytes sent
+  * @param  request: length of each HAL_PCD_EP_Receive
+  * @retval None
+  */
+static void SIM_BulkOut( uint8_t db, uint16_t mps, int32_t latency, uint32_t total, uint32_t request )
+{
+    Dev_Init( 8U );
+    Dev_RxEp = 0x01U;
+    Dev_RxTotal = 0U;
+    Dev_RxRequest = request;
+    Host_Sent = 0U;
+    Host_Total = total;
+    Host_MaxPacket = mps;
+    Host_Zlp = 0U;
+
+    if( db != 0U )
+    {
+        HAL_PCDEx_PMAConfig( &hpcd, 0x01U, PCD_DBL_BUF, 0U );
+    }
+
+    HAL_PCD_EP_Open( &hpcd, 0x01U, mps, EP_TYPE_BULK );
+    Dev_Receive();
+    Host_Run( Host_OutSlot, latency, Host_OutDone );
+
+    if( Dev_RxTotal != total )
+    {
+        Pcd_Error( "OUT %s mps %u latency %d: %u of %u bytes", ( db != 0U ) ? "double" : "single",
+                   ( unsigned )mps, ( int )latency, ( unsigned )Dev_RxTotal, ( unsigned )total );
+    }
+}
+
+/**
+  * @brief  Bulk IN stream on EP1, transfers of random lengths.
+  * @param  db: 1 for double-buffered
+  * @param  mps: max packet size
+  * @param  latency: interrupt latency in slots
+  * @param  total: bytes sent
+  * @param  chunk: longest transfer
+  * @retval None
+  */
+static void SIM_BulkIn( uint8_t db, uint16_t mps, int32_t latency, uint32_t total, uint32_t chunk )
+{
+    uint8_t  packet[1024];
+    int32_t  result;
+    uint32_t k;
+
+    Dev_Init( 8U );
+    Dev_TxEp = 0x01U;
+    Dev_TxPos = 0U;
+    Dev_TxTotal = total;
+    Dev_TxChunk = chunk;
+    Host_Got = 0U;
+    Host_Total = total;
+    Host_MaxPacket = mps;
+
+    if( db != 0U )
+    {
+        HAL_PCDEx_PMAConfig( &hpcd, 0x81U, PCD_DBL_BUF, 0U );
+    }
+
+    HAL_PCD_EP_Open( &hpcd, 0x81U, mps, EP_TYPE_BULK );
+    Dev_Transmit();
+    Host_Run( Host_InSlot, latency, Host_InDone );
+
+    /* The host keeps polling, nothing more may come */
+    for( k = 0U; k < 8U; k++ )
+    {
+        result = Host_In( 1U, packet );
+
+        if( result >= 0 )
+        {
+            Pcd_Error( "IN %s: %d bytes after the end", ( db != 0U ) ? "double" : "single", ( int )result );
+        }
+
+        Dev_IRQHandler();
+    }
+
+    if( ( Host_Got != total ) || ( memcmp( Host_Rx, Pcd_Stream, total ) != 0 ) )
+    {
+        Pcd_Error( "IN %s mps %u latency %d: %u of %u bytes, or data differ", ( db != 0U ) ? "double" : "single",
+                   ( unsigned )mps, ( int )latency, ( unsigned )Host_Got, ( unsigned )total );
+    }
+}
+
+/**
+  * @brief  Isochronous IN on EP2: one packet per frame, a transfer of three
+  *         packets every 50 frames, and the device leaves a frame idle
+  *         every 37.
+  * @param  frames: frames to run
+  * @retval None
+  */
+static void SIM_IsoIn( uint32_t frames )
+{
+    uint8_t  packet[1024];
+    uint32_t pos;
+    uint32_t sent = 0U;
+    uint32_t zlp = 0U;
+    uint32_t idle = 0U;
+    uint32_t error = Pcd_Errors;
+    uint32_t before;
+    uint32_t len;
+    uint32_t f;
+    int32_t  result;
+
+    Dev_Init( 8U );
+    HAL_PCD_EP_Open( &hpcd, 0x82U, 196U, EP_TYPE_ISOC );
+    SIM_Check( "iso IN: double-buffered", hpcd.IN_ep[2].doublebuffer == 1U );
+
+    HAL_PCD_EP_Transmit( &hpcd, 0x82U, Pcd_Stream, 192U );
+    pos = 192U;
+
+    for( f = 0U; f < frames; f++ )
+    {
+        result = Host_In( 2U, packet );
+
+        if( result > 0 )
+        {
+            if( memcmp( packet, &Pcd_Stream[sent], ( uint32_t )result ) != 0 )
+            {
+                Pcd_Error( "iso IN frame %u: data differ", ( unsigned )f );
+            }
+
+            sent += ( uint32_t )result;
+        }
+        else if( result == 0 )
+        {
+            zlp++;
+        }
+        else
+        {
+        }
+
+        if( ( USB->ISTR & USB_ISTR_CTR ) != 0U )
+        {
+            before = hpcd.IN_ep[2].xfer_len;
+            HAL_PCD_IRQHandler( &hpcd );
+
+            if( hpcd.IN_ep[2].xfer_len == 0U )
+            {
+                if( ( before != 0U ) && ( ( f % 37U ) == 36U ) )
+                {
+                    idle++;
+                    continue;
+                }
+
+                len = ( before == 0U ) ? 188U :
+                      ( ( ( f % 50U ) == 49U ) ? ( 3U * 192U ) : ( 176U + ( 4U * ( f % 5U ) ) ) );
+                HAL_PCD_EP_Transmit( &hpcd, 0x82U, &Pcd_Stream[pos], len );
+                pos += len;
+            }
+        }
+    }
+
+    printf( "iso IN: %u frames, %u bytes, %u zero length packets, %u idle frames\n",
+            ( unsigned )frames, ( unsigned )sent, ( unsigned )zlp, ( unsigned )idle );
+    SIM_Check( "iso IN: data in order", Pcd_Errors == error );
+    SIM_Check( "iso IN: one zero length packet per idle frame", zlp == idle );
+    SIM_Check( "iso IN: no data lost", ( pos - sent ) <= ( 3U * 192U ) );
+}
+
+/**
+  * @brief  Isochronous OUT on EP2: one packet per frame. Every 7 frames the
+  *         interrupt comes a frame late: the next packet goes to the other
+  *         buffer, the late one is lost and the newest one is kept.
+  * @param  frames: frames to run
+  * @retval None
+  */
+static void SIM_IsoOut( uint32_t frames )
+{
+    uint32_t error = Pcd_Errors;
+    uint32_t pos = 0U;
+    uint32_t late = 0U;
+    uint32_t len;
+    uint32_t f;
+
+    Dev_Init( 8U );
+    HAL_PCD_EP_Open( &hpcd, 0x02U, 196U, EP_TYPE_ISOC );
+    SIM_Check( "iso OUT: double-buffered", hpcd.OUT_ep[2].doublebuffer == 1U );
+
+    Dev_RxEp = 0x02U;
+    Dev_RxTotal = 0U;
+    Dev_RxRequest = 196U;
+    Dev_Receive();
+
+    for( f = 0U; f < frames; f++ )
+    {
+        len = 188U + ( 4U * ( f % 3U ) );
+        ( void )Host_Out( 2U, &Pcd_Stream[pos], len );
+        pos += len;
+
+        if( ( f % 7U ) != 3U )
+        {
+            Dev_IRQHandler();
+        }
+        else
+        {
+            /* Skipped by the device */
+            Dev_RxTotal += len;
+            late++;
+        }
+    }
+
+    Dev_IRQHandler();
+
+    printf( "iso OUT: %u frames, %u bytes, %u late frames lost\n",
+            ( unsigned )frames, ( unsigned )Dev_RxTotal, ( unsigned )late );
+    SIM_Check( "iso OUT: newest packet kept, data in order", ( Pcd_Errors == error ) && ( Dev_RxTotal == pos ) );
+}
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval 0 when all checks passed
+  */
+int main( void )
+{
+    uint32_t error;
+    uint32_t i;
+    int32_t  latency;
+
+    SIM_HAL_Init();
+    srand( 1U );
+
+    for( i = 0U; i < PCD_STREAM_SIZE; i++ )
+    {
+        Pcd_Stream[i] = ( uint8_t )rand();
+    }
+
+    SIM_RunAlloc();
+
+    for( latency = 0; latency <= 3; latency++ )
+    {
+        char check[96];
+
+        error = Pcd_Errors;
+        SIM_BulkOut( 0U, 64U, latency, 200000U, 512U );
+        SIM_BulkOut( 1U, 64U, latency, 200000U, 512U );
+        ( void )snprintf( check, sizeof( check ), "bulk OUT 64 B single and double-buffered, latency %d", ( int )latency );
+        SIM_Check( check, Pcd_Errors == error );
+
+        error = Pcd_Errors;
+        SIM_BulkIn( 0U, 64U, latency, 200000U, 1024U );
+        SIM_BulkIn( 1U, 64U, latency, 200000U, 1024U );
+        ( void )snprintf( check, sizeof( check ), "bulk IN 64 B single and double-buffered, latency %d", ( int )latency );
+        SIM_Check( check, Pcd_Errors == error );
+    }
+
+    error = Pcd_Errors;
+
+    for( i = 0U; i < 200U; i++ )
+    {
+        uint16_t mps = ( uint16_t )( 8U << ( i % 4U ) );
+
+        srand( i );
+        SIM_BulkIn( 1U, mps, ( int32_t )( i % 4U ), 5000U + ( i * 37U ), 1U + ( i * 7U ) );
+        SIM_BulkOut( 1U, mps, ( int32_t )( i % 4U ), 5000U + ( i * 37U ), ( uint32_t )mps << ( i % 3U ) );
+    }
+
+    SIM_Check( "bulk double-buffered, 200 runs of random sizes and latencies", Pcd_Errors == error );
+
+    SIM_IsoIn( 5000U );
+    SIM_IsoOut( 5000U );
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
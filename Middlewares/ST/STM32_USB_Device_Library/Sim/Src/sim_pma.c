@@ -0,0 +1,401 @@
+/**
+  ******************************************************************************
+  * @file    sim_pma.c
+  * @author  MCD Application Team
+  * @brief   Host script of the PMA copy of stm32l1xx_ll_usb.c, USB_WritePMA
+  *          and USB_ReadPMA, against the former half-word loops:
+  *           - user buffers at the offsets 0 to 7 from a word, PMA buffers
+  *             at the even addresses 0 to 62, every length up to 80 bytes
+  *             then every 7th up to the end of the PMA: the PMA written,
+  *             the upper half-words left alone and the bytes read must be
+  *             those of the former loops, with nothing written past the
+  *             buffers,
+  *           - built with USE_USB_PMA_DMA (sim_pma_dma), on the emulated
+  *             DMA1 of sim_hal.c: the long packets of half-word aligned
+  *             buffers go through the DMA, and a busy channel or a transfer
+  *             error leave the copy to the CPU,
+  *           - built without, the time of a copy on the host, former loop
+  *             and new, for information.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sim_hal.h"
+#include "sim_check.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef void ( *PMA_CopyTypeDef )( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, uint16_t wNBytes );
+
+/* Private define ------------------------------------------------------------*/
+#define PMA_WORDS                     PCD_PMA_SIZE        /* 32-bit words, one half-word used */
+#define PMA_USER_SIZE                 (PCD_PMA_SIZE + 16U)
+#define PMA_MAX_OFFSET                8U
+#define PMA_MAX_ADDR                  64U
+#define PMA_MAX_ERRORS                20U
+#define PMA_BENCH_BYTES               (8U << 20)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static volatile uint32_t *const Pma = ( volatile uint32_t * )( USB_BASE + 0x400U );
+static uint32_t Pma_Saved[PMA_WORDS];
+static uint8_t  *Pma_Src;
+static uint8_t  *Pma_Dst;
+static uint8_t  *Pma_RefDst;
+static uint32_t Pma_Errors;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Pma_Error( const char *format, ... );
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Counts a failed condition and prints the first ones.
+  * @param  format: printf format
+  * @retval None
+  */
+static void Pma_Error( const char *format, ... )
+{
+    va_list args;
+
+    if( Pma_Errors < PMA_MAX_ERRORS )
+    {
+        va_start( args, format );
+        printf( "     " );
+        vprintf( format, args );
+        printf( "\n" );
+        va_end( args );
+    }
+
+    Pma_Errors++;
+}
+
+/**
+  * @brief  USB_WritePMA before the word copy: one half-word per loop.
+  * @param   USBx: USB peripheral instance register address.
+  * @param   pbUsrBuf pointer to user memory area.
+  * @param   wPMABufAddr address into PMA.
+  * @param   wNBytes: no. of bytes to be copied.
+  * @retval None
+  */
+static void Pma_FormerWrite( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, uint16_t wNBytes )
+{
+    uint32_t n = ( ( uint32_t )wNBytes + 1U ) >> 1;
+    uint32_t BaseAddr = ( uint32_t )USBx;
+    uint32_t i, temp1, temp2;
+    __IO uint16_t *pdwVal;
+    uint8_t *pBuf = pbUsrBuf;
+
+    pdwVal = ( __IO uint16_t * )( BaseAddr + 0x400U + ( ( uint32_t )wPMABufAddr * PMA_ACCESS ) );
+
+    for( i = n; i != 0U; i-- )
+    {
+        temp1 = *pBuf;
+        pBuf++;
+        temp2 = temp1 | ( ( uint16_t )( ( uint16_t ) * pBuf << 8 ) );
+        *pdwVal = ( uint16_t )temp2;
+        pdwVal++;
+
+#if PMA_ACCESS > 1U
+        pdwVal++;
+#endif
+
+        pBuf++;
+    }
+}
+
+/**
+  * @brief  USB_ReadPMA before the word copy: one half-word per loop.
+  * @param   USBx: USB peripheral instance register address.
+  * @param   pbUsrBuf pointer to user memory area.
+  * @param   wPMABufAddr address into PMA.
+  * @param   wNBytes: no. of bytes to be copied.
+  * @retval None
+  */
+static void Pma_FormerRead( USB_TypeDef *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAddr, uint16_t wNBytes )
+{
+    uint32_t n = ( uint32_t )wNBytes >> 1;
+    uint32_t BaseAddr = ( uint32_t )USBx;
+    uint32_t i, temp;
+    __IO uint16_t *pdwVal;
+    uint8_t *pBuf = pbUsrBuf;
+
+    pdwVal = ( __IO uint16_t * )( BaseAddr + 0x400U + ( ( uint32_t )wPMABufAddr * PMA_ACCESS ) );
+
+    for( i = n; i != 0U; i-- )
+    {
+        temp = *( __IO uint16_t * )pdwVal;
+        pdwVal++;
+        *pBuf = ( uint8_t )( ( temp >> 0 ) & 0xFFU );
+        pBuf++;
+        *pBuf = ( uint8_t )( ( temp >> 8 ) & 0xFFU );
+        pBuf++;
+
+#if PMA_ACCESS > 1U
+        pdwVal++;
+#endif
+    }
+
+    if( ( wNBytes % 2U ) != 0U )
+    {
+        temp = *pdwVal;
+        *pBuf = ( uint8_t )( ( temp >> 0 ) & 0xFFU );
+    }
+}
+
+/**
+  * @brief  Fills the PMA, upper half-words included, with a pattern.
+  * @param  seed: pattern seed
+  * @retval None
+  */
+static void Pma_Fill( uint32_t seed )
+{
+    uint32_t i;
+
+    for( i = 0U; i < PMA_WORDS; i++ )
+    {
+        Pma[i] = ( ( seed * 2654435761U ) + ( i * 40503U ) ) | 0xDEAD0000U;
+    }
+}
+
+/**
+  * @brief  Compares a write of the driver with the one of the former loop.
+  * @param  off: user buffer offset
+  * @param  addr: PMA address
+  * @param  len: bytes
+  * @retval None
+  */
+static void Pma_CheckWrite( uint32_t off, uint32_t addr, uint32_t len )
+{
+    uint32_t first = addr / 2U;
+    uint32_t last = ( addr + len + 1U ) / 2U;
+    uint32_t i;
+
+    Pma_Fill( len );
+    Pma_FormerWrite( USB, Pma_Src + off, ( uint16_t )addr, ( uint16_t )len );
+
+    for( i = 0U; i < PMA_WORDS; i++ )
+    {
+        Pma_Saved[i] = Pma[i];
+    }
+
+    Pma_Fill( len );
+    USB_WritePMA( USB, Pma_Src + off, ( uint16_t )addr, ( uint16_t )len );
+
+    for( i = 0U; i < PMA_WORDS; i++ )
+    {
+        /* The DMA writes 32-bit words: the upper half-word, which the
+           peripheral does not implement, may read 0 in the buffer */
+        if( ( ( uint16_t )Pma[i] != ( uint16_t )Pma_Saved[i] ) ||
+                ( ( ( Pma[i] >> 16 ) != ( Pma_Saved[i] >> 16 ) ) &&
+                  ( ( i < first ) || ( i >= last ) || ( ( Pma[i] >> 16 ) != 0U ) ) ) )
+        {
+            Pma_Error( "write offset %u addr %u len %u: PMA word %u 0x%08x, former loop 0x%08x",
+                       ( unsigned )off, ( unsigned )addr, ( unsigned )len, ( unsigned )i,
+                       ( unsigned )Pma[i], ( unsigned )Pma_Saved[i] );
+            break;
+        }
+    }
+}
+
+/**
+  * @brief  Compares a read of the driver with the one of the former loop,
+  *         the bytes around the user buffer included.
+  * @param  off: user buffer offset
+  * @param  addr: PMA address
+  * @param  len: bytes
+  * @retval None
+  */
+static void Pma_CheckRead( uint32_t off, uint32_t addr, uint32_t len )
+{
+    Pma_Fill( len + 1U );
+    ( void )memset( Pma_Dst, 0x5A, PMA_USER_SIZE );
+    ( void )memset( Pma_RefDst, 0x5A, PMA_USER_SIZE );
+
+    Pma_FormerRead( USB, Pma_RefDst + off, ( uint16_t )addr, ( uint16_t )len );
+    USB_ReadPMA( USB, Pma_Dst + off, ( uint16_t )addr, ( uint16_t )len );
+
+    if( memcmp( Pma_Dst, Pma_RefDst, PMA_USER_SIZE ) != 0 )
+    {
+        Pma_Error( "read offset %u addr %u len %u differs from the former loop",
+                   ( unsigned )off, ( unsigned )addr, ( unsigned )len );
+    }
+}
+
+/**
+  * @brief  Every user offset, PMA address and length.
+  * @param  dma: returns the number of copies expected through the DMA
+  * @retval Number of cases
+  */
+static uint32_t SIM_Sweep( uint32_t *dma )
+{
+    uint32_t off, addr, len;
+    uint32_t cases = 0U;
+
+    *dma = 0U;
+
+    for( off = 0U; off < PMA_MAX_OFFSET; off++ )
+    {
+        for( addr = 0U; addr < PMA_MAX_ADDR; addr += 2U )
+        {
+            for( len = 0U; ( addr + len ) <= PCD_PMA_SIZE; len += ( len < 80U ) ? 1U : 7U )
+            {
+                Pma_CheckWrite( off, addr, len );
+                Pma_CheckRead( off, addr, len );
+                cases++;
+
+#if (USE_USB_PMA_DMA == 1U)
+                if( ( len >= USB_PMA_DMA_THRESHOLD ) && ( ( off & 1U ) == 0U ) )
+                {
+                    *dma += 2U;
+                }
+#endif /* USE_USB_PMA_DMA */
+            }
+        }
+    }
+
+    return cases;
+}
+
+#if (USE_USB_PMA_DMA == 1U)
+/**
+  * @brief  Copies the CPU makes again when the DMA cannot: channel busy
+  *         with another transfer, transfer error.
+  * @retval None
+  */
+static void SIM_DMAFallback( void )
+{
+    DMA_Channel_TypeDef *channel = USB_PMA_DMA_CHANNEL_INSTANCE;
+    uint32_t shift = 4U * ( USB_PMA_DMA_CHANNEL - 1U );
+    uint32_t copies;
+    uint32_t error;
+
+    /* Channel running a peripheral transfer: left alone */
+    error = Pma_Errors;
+    copies = SIM_HAL_DMACopies;
+    channel->CCR = DMA_CCR_EN;
+    Pma_CheckWrite( 0U, 0U, 128U );
+    Pma_CheckRead( 0U, 0U, 128U );
+    SIM_Check( "busy DMA channel: copies made by the CPU, channel left running",
+               ( Pma_Errors == error ) && ( SIM_HAL_DMACopies == copies ) &&
+               ( channel->CCR == DMA_CCR_EN ) );
+    channel->CCR = 0U;
+
+    /* Transfer error: the CPU copies the packet again, the channel is
+       disabled and its flags cleared */
+    error = Pma_Errors;
+    SIM_HAL_DMAFailNext = 1U;
+    Pma_CheckWrite( 0U, 0U, 128U );
+    SIM_Check( "DMA transfer error on a write: copy made by the CPU, channel disabled",
+               ( Pma_Errors == error ) && ( SIM_HAL_DMAFailNext == 0U ) && ( channel->CCR == 0U ) &&
+               ( ( SIM_HAL_DMA1()->ISR & ( 0xFU << shift ) ) == 0U ) );
+
+    error = Pma_Errors;
+    SIM_HAL_DMAFailNext = 1U;
+    Pma_CheckRead( 2U, 16U, 200U );
+    SIM_Check( "DMA transfer error on a read: copy made by the CPU, channel disabled",
+               ( Pma_Errors == error ) && ( SIM_HAL_DMAFailNext == 0U ) && ( channel->CCR == 0U ) &&
+               ( ( SIM_HAL_DMA1()->ISR & ( 0xFU << shift ) ) == 0U ) );
+}
+#else
+/**
+  * @brief  Time of a copy on the host, in ns.
+  * @param  copy: copy function
+  * @param  off: user buffer offset
+  * @param  len: bytes
+  * @retval ns per copy
+  */
+static double Pma_Time( PMA_CopyTypeDef copy, uint32_t off, uint32_t len )
+{
+    struct timespec t0, t1;
+    uint32_t n = PMA_BENCH_BYTES / len;
+    uint32_t i;
+
+    ( void )clock_gettime( CLOCK_MONOTONIC, &t0 );
+
+    for( i = 0U; i < n; i++ )
+    {
+        copy( USB, Pma_Src + off, 0U, ( uint16_t )len );
+    }
+
+    ( void )clock_gettime( CLOCK_MONOTONIC, &t1 );
+
+    return ( ( ( double )( t1.tv_sec - t0.tv_sec ) * 1e9 ) + ( double )( t1.tv_nsec - t0.tv_nsec ) ) / n;
+}
+
+/**
+  * @brief  Prints the time of the copies on the host. The PMA is plain
+  *         memory there: the figures compare the CPU paths, not the
+  *         peripheral bus of the device.
+  * @retval None
+  */
+static void SIM_Bench( void )
+{
+    static const uint32_t lens[] = { 8U, 64U, 512U };
+    uint32_t i, off;
+
+    printf( "  ns per copy on the host, former loop -> new\n" );
+
+    for( i = 0U; i < ( sizeof( lens ) / sizeof( lens[0] ) ); i++ )
+    {
+        for( off = 0U; off < 2U; off++ )
+        {
+            printf( "    %3u bytes, user offset %u: write %7.1f -> %7.1f, read %7.1f -> %7.1f\n",
+                    ( unsigned )lens[i], ( unsigned )off,
+                    Pma_Time( Pma_FormerWrite, off, lens[i] ), Pma_Time( USB_WritePMA, off, lens[i] ),
+                    Pma_Time( Pma_FormerRead, off, lens[i] ), Pma_Time( USB_ReadPMA, off, lens[i] ) );
+        }
+    }
+}
+#endif /* USE_USB_PMA_DMA */
+
+int main( void )
+{
+    uint32_t cases;
+    uint32_t dma;
+    uint32_t i;
+
+    SIM_HAL_Init();
+    srand( 1U );
+
+    Pma_Src = SIM_HAL_LowAlloc( PMA_USER_SIZE );
+    Pma_Dst = SIM_HAL_LowAlloc( PMA_USER_SIZE );
+    Pma_RefDst = SIM_HAL_LowAlloc( PMA_USER_SIZE );
+
+    for( i = 0U; i < PMA_USER_SIZE; i++ )
+    {
+        Pma_Src[i] = ( uint8_t )rand();
+    }
+
+    cases = SIM_Sweep( &dma );
+    printf( "  %u cases: user offsets 0 to %u, PMA addresses 0 to %u, lengths 0 to %u\n",
+            ( unsigned )cases, PMA_MAX_OFFSET - 1U, PMA_MAX_ADDR - 2U, PCD_PMA_SIZE );
+    SIM_Check( "USB_WritePMA and USB_ReadPMA copy as the former loops", Pma_Errors == 0U );
+
+#if (USE_USB_PMA_DMA == 1U)
+    printf( "  %u copies through the DMA, %u expected\n", ( unsigned )SIM_HAL_DMACopies, ( unsigned )dma );
+    SIM_Check( "copies of USB_PMA_DMA_THRESHOLD bytes or more from half-word aligned buffers use the DMA",
+               SIM_HAL_DMACopies == dma );
+    SIM_DMAFallback();
+#else
+    ( void )dma;
+    SIM_Bench();
+#endif /* USE_USB_PMA_DMA */
+
+    return SIM_Result();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
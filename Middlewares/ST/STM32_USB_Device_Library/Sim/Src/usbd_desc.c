@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file    usbd_desc.c
+  * @author  MCD Application Team
+  * @brief   USBD descriptors of the host-side simulations. The device
+  *          declares the IAD class codes, so that it fits single class and
+  *          composite configurations alike.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2015 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                      http://www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_core.h"
+#include "usbd_desc.h"
+#include "usbd_conf.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define USBD_VID                      0x0483
+#define USBD_PID                      0x5740
+#define USBD_LANGID_STRING            0x409
+#define USBD_MANUFACTURER_STRING      "STMicroelectronics"
+#define USBD_PRODUCT_FS_STRING        "STM32 USB Device Simulation"
+#define USBD_SERIAL_STRING            "000000000001"
+#define USBD_CONFIGURATION_FS_STRING  "SIM Config"
+#define USBD_INTERFACE_FS_STRING      "SIM Interface"
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+uint8_t *USBD_SIM_DeviceDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+uint8_t *USBD_SIM_LangIDStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+uint8_t *USBD_SIM_ManufacturerStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+uint8_t *USBD_SIM_ProductStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+uint8_t *USBD_SIM_SerialStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+uint8_t *USBD_SIM_ConfigStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+uint8_t *USBD_SIM_InterfaceStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length );
+
+/* Private variables ---------------------------------------------------------*/
+USBD_DescriptorsTypeDef SIM_Desc =
+{
+    USBD_SIM_DeviceDescriptor,
+    USBD_SIM_LangIDStrDescriptor,
+    USBD_SIM_ManufacturerStrDescriptor,
+    USBD_SIM_ProductStrDescriptor,
+    USBD_SIM_SerialStrDescriptor,
+    USBD_SIM_ConfigStrDescriptor,
+    USBD_SIM_InterfaceStrDescriptor,
+};
+
+/* USB Standard Device Descriptor */
+const uint8_t hUSBDDeviceDesc[USB_LEN_DEV_DESC] =
+{
+    0x12,                       /* bLength */
+    USB_DESC_TYPE_DEVICE,       /* bDescriptorType */
+    0x00,                       /* bcdUSB */
+    0x02,
+    0xEF,                       /* bDeviceClass: Miscellaneous */
+    0x02,                       /* bDeviceSubClass: Common Class */
+    0x01,                       /* bDeviceProtocol: Interface Association */
+    USB_MAX_EP0_SIZE,           /* bMaxPacketSize */
+    LOBYTE( USBD_VID ),         /* idVendor */
+    HIBYTE( USBD_VID ),         /* idVendor */
+    LOBYTE( USBD_PID ),         /* idVendor */
+    HIBYTE( USBD_PID ),         /* idVendor */
+    0x00,                       /* bcdDevice rel. 2.00 */
+    0x02,
+    USBD_IDX_MFC_STR,           /* Index of manufacturer string */
+    USBD_IDX_PRODUCT_STR,       /* Index of product string */
+    USBD_IDX_SERIAL_STR,        /* Index of serial number string */
+    USBD_MAX_NUM_CONFIGURATION  /* bNumConfigurations */
+}; /* USB_DeviceDescriptor */
+
+/* USB Standard Device Descriptor */
+const uint8_t USBD_LangIDDesc[USB_LEN_LANGID_STR_DESC] =
+{
+    USB_LEN_LANGID_STR_DESC,
+    USB_DESC_TYPE_STRING,
+    LOBYTE( USBD_LANGID_STRING ),
+    HIBYTE( USBD_LANGID_STRING ),
+};
+
+uint8_t USBD_StrDesc[USBD_MAX_STR_DESC_SIZ];
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Returns the device descriptor.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_DeviceDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    *length = sizeof( hUSBDDeviceDesc );
+    return ( uint8_t * )hUSBDDeviceDesc;
+}
+
+/**
+  * @brief  Returns the LangID string descriptor.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_LangIDStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    *length = sizeof( USBD_LangIDDesc );
+    return ( uint8_t * )USBD_LangIDDesc;
+}
+
+/**
+  * @brief  Returns the product string descriptor.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_ProductStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    USBD_GetString( ( uint8_t * )USBD_PRODUCT_FS_STRING, USBD_StrDesc, length );
+    return USBD_StrDesc;
+}
+
+/**
+  * @brief  Returns the manufacturer string descriptor.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_ManufacturerStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    USBD_GetString( ( uint8_t * )USBD_MANUFACTURER_STRING, USBD_StrDesc, length );
+    return USBD_StrDesc;
+}
+
+/**
+  * @brief  Returns the serial number string descriptor: a fixed one, the
+  *         host has no unique device ID to read.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_SerialStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    USBD_GetString( ( uint8_t * )USBD_SERIAL_STRING, USBD_StrDesc, length );
+    return USBD_StrDesc;
+}
+
+/**
+  * @brief  Returns the configuration string descriptor.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_ConfigStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    USBD_GetString( ( uint8_t * )USBD_CONFIGURATION_FS_STRING, USBD_StrDesc, length );
+    return USBD_StrDesc;
+}
+
+/**
+  * @brief  Returns the interface string descriptor.
+  * @param  speed: Current device speed
+  * @param  length: Pointer to data length variable
+  * @retval Pointer to descriptor buffer
+  */
+uint8_t *USBD_SIM_InterfaceStrDescriptor( USBD_SpeedTypeDef speed, uint16_t *length )
+{
+    UNUSED( speed );
+
+    USBD_GetString( ( uint8_t * )USBD_INTERFACE_FS_STRING, USBD_StrDesc, length );
+    return USBD_StrDesc;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
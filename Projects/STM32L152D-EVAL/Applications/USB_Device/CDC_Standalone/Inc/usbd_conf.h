@@ -37,6 +37,9 @@
 #define USBD_SELF_POWERED                     1
 #define USBD_DEBUG_LEVEL                      0
 
+/* CDC Class Config */
+#define CDC_DATA_FS_OUT_XFER_SIZE             512
+
 /* Exported macro ------------------------------------------------------------*/
 /* Memory management macros */
 
@@ -46,7 +49,7 @@
 void *USBD_static_malloc( uint32_t size );
 void USBD_static_free( void *p );
 
-#define MAX_STATIC_ALLOC_SIZE     140 /*CDC Class Driver Structure size*/
+#define MAX_STATIC_ALLOC_SIZE     150 /*CDC Class Driver Structure size*/
 
 #define USBD_malloc               (uint32_t *)USBD_static_malloc
 #define USBD_free                 USBD_static_free
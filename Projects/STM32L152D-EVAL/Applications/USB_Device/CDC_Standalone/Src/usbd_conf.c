@@ -228,11 +228,10 @@ USBD_StatusTypeDef USBD_LL_Init( USBD_HandleTypeDef *pdev )
     /* Initialize LL Driver */
     HAL_PCD_Init( pdev->pData );
 
-    HAL_PCDEx_PMAConfig( pdev->pData, 0x00, PCD_SNG_BUF, 0x40 );
-    HAL_PCDEx_PMAConfig( pdev->pData, 0x80, PCD_SNG_BUF, 0x80 );
-    HAL_PCDEx_PMAConfig( pdev->pData, CDC_IN_EP, PCD_SNG_BUF, 0xC0 );
-    HAL_PCDEx_PMAConfig( pdev->pData, CDC_OUT_EP, PCD_SNG_BUF, 0x110 );
-    HAL_PCDEx_PMAConfig( pdev->pData, CDC_CMD_EP, PCD_SNG_BUF, 0x100 );
+    /* The PMA buffers are allocated as the endpoints are opened.
+       Double-buffered OUT: the next packet lands in PMA while the
+       current one is read out */
+    HAL_PCDEx_PMAConfig( pdev->pData, CDC_OUT_EP, PCD_DBL_BUF, 0U );
 
     return USBD_OK;
 }
@@ -287,10 +286,14 @@ USBD_StatusTypeDef USBD_LL_OpenEP( USBD_HandleTypeDef *pdev,
                                    uint8_t ep_type,
                                    uint16_t ep_mps )
 {
-    HAL_PCD_EP_Open( pdev->pData,
-                     ep_addr,
-                     ep_mps,
-                     ep_type );
+    /* Fails when the endpoint buffers do not fit in the PMA */
+    if( HAL_PCD_EP_Open( pdev->pData,
+                         ep_addr,
+                         ep_mps,
+                         ep_type ) != HAL_OK )
+    {
+        return USBD_FAIL;
+    }
 
     return USBD_OK;
 }
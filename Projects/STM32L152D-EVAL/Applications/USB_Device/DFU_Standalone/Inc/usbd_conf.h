@@ -41,6 +41,7 @@
 /* DFU Class Config */
 #define USBD_DFU_MAX_ITF_NUM                   1
 #define USBD_DFU_XFER_SIZE                     1024   /* Max DFU Packet Size   = 1024 bytes */
+#define USBD_DFU_BUFFER_NUM                    2      /* Receive a block while the previous one is programmed */
 #define USBD_DFU_APP_DEFAULT_ADD               0x08007000 /*ADDR_FLASH_PAGE_14*/
 #define USBD_DFU_APP_END_ADD                   0x08020000 /*ADDR_FLASH_PAGE_64*/
 /* Exported macro ------------------------------------------------------------*/
@@ -51,7 +52,7 @@
 void *USBD_static_malloc( uint32_t size );
 void USBD_static_free( void *p );
 
-#define MAX_STATIC_ALLOC_SIZE     263 /*DFU Class Driver Structure size*/
+#define MAX_STATIC_ALLOC_SIZE     520 /*DFU Class Driver Structure size*/
 
 #define USBD_malloc               (uint32_t *)USBD_static_malloc
 #define USBD_free                 USBD_static_free
@@ -25,11 +25,18 @@
 /* Private define ------------------------------------------------------------*/
 /*128 pages of 2 Kbytes*/
 #define FLASH_DESC_STR      "@Internal Flash   /0x08000000/12*01Ka,84*01Kg"
-#define FLASH_ERASE_TIME    (uint16_t)50
-#define FLASH_PROGRAM_TIME  (uint16_t)50
+#define FLASH_HALFPAGE_SIZE 128U          /* 32 words programmed at once */
+#define FLASH_ERASE_TIME    (uint16_t)4   /* Per page, tprog max is 3.94 ms */
+#define FLASH_PROGRAM_TIME  (uint16_t)4   /* Per half page, tprog max is 3.94 ms */
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Asynchronous write in progress */
+static uint8_t  *FlashIfSrc;
+static uint32_t FlashIfDest;
+static uint32_t FlashIfLen;
+static uint32_t FlashIfHalfPage[FLASH_HALFPAGE_SIZE / 4U];
+
 /* Private function prototypes -----------------------------------------------*/
 /* Extern function prototypes ------------------------------------------------*/
 uint16_t Flash_If_Init( void );
@@ -38,6 +45,8 @@ uint16_t Flash_If_Write( uint8_t *src, uint8_t *dest, uint32_t Len );
 uint8_t *Flash_If_Read( uint8_t *src, uint8_t *dest, uint32_t Len );
 uint16_t Flash_If_DeInit( void );
 uint16_t Flash_If_GetStatus( uint32_t Add, uint8_t Cmd, uint8_t *buffer );
+uint16_t Flash_If_WriteAsync( uint8_t *src, uint8_t *dest, uint32_t Len );
+uint16_t Flash_If_WritePoll( void );
 
 USBD_DFU_MediaTypeDef USBD_DFU_Flash_fops =
 {
@@ -48,6 +57,8 @@ USBD_DFU_MediaTypeDef USBD_DFU_Flash_fops =
     Flash_If_Write,
     Flash_If_Read,
     Flash_If_GetStatus,
+    Flash_If_WriteAsync,
+    Flash_If_WritePoll,
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -137,6 +148,81 @@ uint16_t Flash_If_Write( uint8_t *src, uint8_t *dest, uint32_t Len )
     return 0;
 }
 
+/**
+  * @brief  Starts writing Data into Memory by half pages.
+  * @param  src: Pointer to the source buffer, kept until the write completes.
+  * @param  dest: Pointer to the destination buffer.
+  * @param  Len: Number of data to be written (in bytes).
+  * @retval 0 if operation is successeful, MAL_FAIL else.
+  */
+uint16_t Flash_If_WriteAsync( uint8_t *src, uint8_t *dest, uint32_t Len )
+{
+    if( FlashIfLen != 0U )
+    {
+        /* A write is already in progress */
+        return 1;
+    }
+
+    FlashIfSrc = src;
+    FlashIfDest = ( uint32_t )dest;
+    FlashIfLen = Len;
+
+    return 0;
+}
+
+/**
+  * @brief  Programs the next half page of the write started by Flash_If_WriteAsync.
+  * @param  None
+  * @retval USBD_BUSY while data remains, USBD_OK when done, USBD_FAIL on error.
+  */
+uint16_t Flash_If_WritePoll( void )
+{
+    uint32_t addr = FlashIfDest & ~( FLASH_HALFPAGE_SIZE - 1U );
+    uint32_t offset = FlashIfDest - addr;
+    uint32_t len = MIN( FLASH_HALFPAGE_SIZE - offset, FlashIfLen );
+    uint32_t i = 0;
+
+    if( FlashIfLen == 0U )
+    {
+        return USBD_OK;
+    }
+
+    /* Keep the part of the half page the block does not cover */
+    for( i = 0; i < ( FLASH_HALFPAGE_SIZE / 4U ); i++ )
+    {
+        FlashIfHalfPage[i] = *( __IO uint32_t * )( addr + ( 4U * i ) );
+    }
+
+    for( i = 0; i < len; i++ )
+    {
+        ( ( uint8_t * )FlashIfHalfPage )[offset + i] = FlashIfSrc[i];
+    }
+
+    if( HAL_FLASHEx_HalfPageProgram( addr, FlashIfHalfPage ) != HAL_OK )
+    {
+        /* Error occurred while writing data in Flash memory */
+        FlashIfLen = 0U;
+        return USBD_FAIL;
+    }
+
+    for( i = 0; i < ( FLASH_HALFPAGE_SIZE / 4U ); i++ )
+    {
+        /* Check the written value */
+        if( *( __IO uint32_t * )( addr + ( 4U * i ) ) != FlashIfHalfPage[i] )
+        {
+            /* Flash content doesn't match SRAM content */
+            FlashIfLen = 0U;
+            return USBD_FAIL;
+        }
+    }
+
+    FlashIfSrc += len;
+    FlashIfDest += len;
+    FlashIfLen -= len;
+
+    return ( FlashIfLen != 0U ) ? USBD_BUSY : USBD_OK;
+}
+
 /**
   * @brief  Reads Data into Memory.
   * @param  src: Pointer to the source buffer. Address to be written to.
@@ -166,22 +252,31 @@ uint8_t *Flash_If_Read( uint8_t *src, uint8_t *dest, uint32_t Len )
   */
 uint16_t Flash_If_GetStatus( uint32_t Add, uint8_t Cmd, uint8_t *buffer )
 {
+    uint32_t timeout = 0;
+
+    /* Half pages the asynchronous write still has to program */
+    if( FlashIfLen != 0U )
+    {
+        timeout = ( ( FlashIfDest & ( FLASH_HALFPAGE_SIZE - 1U ) ) + FlashIfLen + FLASH_HALFPAGE_SIZE - 1U ) / FLASH_HALFPAGE_SIZE;
+        timeout *= FLASH_PROGRAM_TIME;
+    }
+
     switch( Cmd )
     {
     case DFU_MEDIA_PROGRAM:
-        buffer[1] = ( uint8_t )FLASH_PROGRAM_TIME;
-        buffer[2] = ( uint8_t )( FLASH_PROGRAM_TIME << 8 );
-        buffer[3] = 0;
         break;
 
     case DFU_MEDIA_ERASE:
     default:
-        buffer[1] = ( uint8_t )FLASH_ERASE_TIME;
-        buffer[2] = ( uint8_t )( FLASH_ERASE_TIME << 8 );
-        buffer[3] = 0;
+        timeout += ( ( USBD_DFU_APP_END_ADD - USBD_DFU_APP_DEFAULT_ADD ) / FLASH_PAGE_SIZE ) * FLASH_ERASE_TIME;
         break;
     }
 
+    /* bwPollTimeout */
+    buffer[1] = ( uint8_t )timeout;
+    buffer[2] = ( uint8_t )( timeout >> 8 );
+    buffer[3] = ( uint8_t )( timeout >> 16 );
+
     return 0;
 }
 
@@ -39,6 +39,7 @@
 
 /* MSC Class Config */
 #define MSC_MEDIA_PACKET                      512
+#define MSC_MEDIA_BUFFERS                     2
 
 /* Exported macro ------------------------------------------------------------*/
 /* Memory management macros */
@@ -49,7 +50,7 @@
 void *USBD_static_malloc( uint32_t size );
 void USBD_static_free( void *p );
 
-#define MAX_STATIC_ALLOC_SIZE     155 /*MSC Class Driver Structure size*/
+#define MAX_STATIC_ALLOC_SIZE     296 /*MSC Class Driver Structure size*/
 
 #define USBD_malloc               (uint32_t *)USBD_static_malloc
 #define USBD_free                 USBD_static_free
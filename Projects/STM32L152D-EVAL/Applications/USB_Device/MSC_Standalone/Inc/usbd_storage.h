@@ -30,6 +30,8 @@
 /* Exported functions ------------------------------------------------------- */
 extern USBD_StorageTypeDef  USBD_DISK_fops;
 
+void STORAGE_Process( void );
+
 #endif /* __USBD_STORAGE_H_ */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -147,6 +147,9 @@ void SysTick_Handler( void )
 void USB_LP_IRQHandler( void )
 {
     HAL_PCD_IRQHandler( &hpcd );
+
+    /* End of the SD accesses started by the MSC class */
+    STORAGE_Process();
 }
 
 /**
@@ -27,9 +27,15 @@
 #define STORAGE_BLK_NBR                  0x10000
 #define STORAGE_BLK_SIZ                  0x200
 
+#define STORAGE_ASYNC_NONE               0U
+#define STORAGE_ASYNC_READ               1U
+#define STORAGE_ASYNC_WRITE              2U
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 __IO uint32_t writestatus, readstatus = 0U;
+static __IO uint8_t async_op = STORAGE_ASYNC_NONE;
+extern USBD_HandleTypeDef USBD_Device;
 /* USB Mass storage Standard Inquiry Data */
 int8_t STORAGE_Inquirydata[] =   /* 36 */
 {
@@ -56,6 +62,8 @@ int8_t STORAGE_IsWriteProtected( uint8_t lun );
 int8_t STORAGE_Read( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
 int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
 int8_t STORAGE_GetMaxLun( void );
+int8_t STORAGE_ReadAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
+int8_t STORAGE_WriteAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len );
 
 USBD_StorageTypeDef USBD_DISK_fops =
 {
@@ -67,6 +75,8 @@ USBD_StorageTypeDef USBD_DISK_fops =
     STORAGE_Write,
     STORAGE_GetMaxLun,
     STORAGE_Inquirydata,
+    STORAGE_ReadAsync,
+    STORAGE_WriteAsync,
 };
 /* Private functions ---------------------------------------------------------*/
 
@@ -219,6 +229,97 @@ int8_t STORAGE_Write( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk
     return ret;
 }
 
+/**
+  * @brief  Starts reading data from the medium.
+  * @param  lun: Logical unit number
+  * @param  blk_addr: Logical block address
+  * @param  blk_len: Blocks number
+  * @retval Status (0: Ok / -1: Error)
+  */
+int8_t STORAGE_ReadAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    int8_t ret = -1;
+
+    if( BSP_SD_IsDetected() != SD_NOT_PRESENT )
+    {
+        readstatus = 0;
+        async_op = STORAGE_ASYNC_READ;
+
+        if( BSP_SD_ReadBlocks_DMA( ( uint32_t * )buf, blk_addr, blk_len ) == MSD_OK )
+        {
+            ret = 0;
+        }
+        else
+        {
+            async_op = STORAGE_ASYNC_NONE;
+        }
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  Starts writing data into the medium.
+  * @param  lun: Logical unit number
+  * @param  blk_addr: Logical block address
+  * @param  blk_len: Blocks number
+  * @retval Status (0 : Ok / -1 : Error)
+  */
+int8_t STORAGE_WriteAsync( uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len )
+{
+    int8_t ret = -1;
+
+    if( BSP_SD_IsDetected() != SD_NOT_PRESENT )
+    {
+        writestatus = 0;
+        async_op = STORAGE_ASYNC_WRITE;
+
+        if( BSP_SD_WriteBlocks_DMA( ( uint32_t * )buf, blk_addr, blk_len ) == MSD_OK )
+        {
+            ret = 0;
+        }
+        else
+        {
+            async_op = STORAGE_ASYNC_NONE;
+        }
+    }
+
+    return ret;
+}
+
+/**
+  * @brief  Reports the end of the asynchronous medium access to the MSC class.
+  *         Called from the USB interrupt, which the SD callbacks trigger.
+  * @param  None
+  * @retval None
+  */
+void STORAGE_Process( void )
+{
+    if( ( ( async_op == STORAGE_ASYNC_READ ) && ( readstatus != 0U ) ) ||
+            ( ( async_op == STORAGE_ASYNC_WRITE ) && ( writestatus != 0U ) ) )
+    {
+        /* Come back until SD card is ready to use for new operation */
+        if( BSP_SD_GetCardState() != SD_TRANSFER_OK )
+        {
+            HAL_NVIC_SetPendingIRQ( USB_LP_IRQn );
+            return;
+        }
+
+        if( async_op == STORAGE_ASYNC_READ )
+        {
+            readstatus = 0;
+            async_op = STORAGE_ASYNC_NONE;
+            USBD_MSC_ReadCplt( &USBD_Device, 0 );
+        }
+        else
+        {
+            writestatus = 0;
+            async_op = STORAGE_ASYNC_NONE;
+            USBD_MSC_WriteCplt( &USBD_Device, 0 );
+        }
+    }
+}
+
 /**
   * @brief  Returns the Max Supported LUNs.
   * @param  None
@@ -237,6 +338,11 @@ int8_t STORAGE_GetMaxLun( void )
 void BSP_SD_WriteCpltCallback( void )
 {
     writestatus = 1;
+
+    if( async_op != STORAGE_ASYNC_NONE )
+    {
+        HAL_NVIC_SetPendingIRQ( USB_LP_IRQn );
+    }
 }
 
 /**
@@ -247,6 +353,11 @@ void BSP_SD_WriteCpltCallback( void )
 void BSP_SD_ReadCpltCallback( void )
 {
     readstatus = 1;
+
+    if( async_op != STORAGE_ASYNC_NONE )
+    {
+        HAL_NVIC_SetPendingIRQ( USB_LP_IRQn );
+    }
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/